@@ -47,6 +47,103 @@
 #define EGL_DIRECT_COMPOSITION_ANGLE 0x33A5
 #endif /* EGL_ANGLE_direct_composition */
 
+#ifndef EGL_ANGLE_d3d11_frame_latency
+#define EGL_ANGLE_d3d11_frame_latency 1
+#define EGL_D3D11_MAX_FRAME_LATENCY_ANGLE 0x34DC
+#define EGL_D3D11_FRAME_LATENCY_WAITABLE_OBJECT_ANGLE 0x34DD
+#endif /* EGL_ANGLE_d3d11_frame_latency */
+
+#ifndef EGL_ANGLE_memory_pressure_callback
+#define EGL_ANGLE_memory_pressure_callback 1
+#define EGL_MEMORY_PRESSURE_CALLBACK_ANGLE 0x34DE
+#define EGL_MEMORY_PRESSURE_USER_PARAM_ANGLE 0x34DF
+typedef void(EGLAPIENTRY *PFNEGLMEMORYPRESSURECALLBACKANGLEPROC)(void *userParam,
+                                                                 EGLuint64KHR allocatedBytes,
+                                                                 EGLuint64KHR budgetBytes);
+#endif /* EGL_ANGLE_memory_pressure_callback */
+
+#ifndef EGL_ANGLE_frame_profile
+#define EGL_ANGLE_frame_profile 1
+#define EGL_FRAME_PROFILE_HISTORY_ANGLE 0x34E0
+#define EGL_FRAME_PROFILE_HISTORY_SIZE_ANGLE 64
+typedef struct ANGLEFrameProfileRecord
+{
+    EGLuint64KHR frameNumber;
+    EGLuint64KHR cpuFrameTimeNs;
+    EGLuint64KHR gpuFrameTimeNs;
+    EGLuint64KHR drawCalls;
+    EGLuint64KHR renderPasses;
+    EGLuint64KHR submitCalls;
+    EGLuint64KHR pipelineCacheHits;
+    EGLuint64KHR pipelineCacheMisses;
+    EGLuint64KHR writeDescriptorSets;
+    /* CPU time the GL thread spent waiting for a swapchain image during the frame, whether in a
+     * synchronous acquire or waiting on an acquire running on a worker thread. */
+    EGLuint64KHR acquireImageWaitNs;
+    /* CPU time spent throttling in swap, waiting for an earlier frame's commands to finish. */
+    EGLuint64KHR swapThrottleWaitNs;
+    /* Time spent inside the presentation call, reflecting presentation engine backpressure. */
+    EGLuint64KHR presentCallNs;
+} ANGLEFrameProfileRecord;
+typedef struct ANGLEFrameProfileHistory
+{
+    /* Total number of records written.  The most recent record is at
+     * records[(recordCount - 1) % EGL_FRAME_PROFILE_HISTORY_SIZE_ANGLE].  GPU frame times are
+     * filled in a few frames late, once the corresponding timestamp queries complete. */
+    EGLuint64KHR recordCount;
+    ANGLEFrameProfileRecord records[EGL_FRAME_PROFILE_HISTORY_SIZE_ANGLE];
+} ANGLEFrameProfileHistory;
+#define EGL_RENDER_PASS_CLOSURE_COUNTS_ANGLE 0x34E2
+#define EGL_RENDER_PASS_CLOSURE_REASON_COUNT_ANGLE 96
+typedef struct ANGLERenderPassClosureCounts
+{
+    /* Number of valid entries in reasonNames/counts. */
+    EGLuint64KHR reasonCount;
+    /* Static, human-readable description of each closure reason; entries at and beyond
+     * reasonCount are null. */
+    const char *reasonNames[EGL_RENDER_PASS_CLOSURE_REASON_COUNT_ANGLE];
+    /* Cumulative number of render passes closed for each reason since context creation.  The
+     * snapshot is refreshed at each present. */
+    EGLuint64KHR counts[EGL_RENDER_PASS_CLOSURE_REASON_COUNT_ANGLE];
+} ANGLERenderPassClosureCounts;
+#endif /* EGL_ANGLE_frame_profile */
+
+#ifndef EGL_ANGLE_surface_memory_fd
+#define EGL_ANGLE_surface_memory_fd 1
+#define EGL_SURFACE_MEMORY_FD_ANGLE 0x34E1
+#endif /* EGL_ANGLE_surface_memory_fd */
+
+#ifndef EGL_ANGLE_display_telemetry
+#define EGL_ANGLE_display_telemetry 1
+#define EGL_TELEMETRY_COUNTERS_ANGLE 0x34E3
+/* A block of raw counters owned by the display, queried once through
+ * eglQueryDisplayAttribEXT(EGL_TELEMETRY_COUNTERS_ANGLE) and then sampled directly.  The block
+ * stays valid until the display is terminated.  ANGLE updates the fields once per presented frame
+ * with relaxed atomic stores; samplers should read them with relaxed atomic loads.  The per-frame
+ * update is skipped entirely until the block is queried for the first time. */
+typedef struct ANGLETelemetryCounters
+{
+    /* Layout version of this block, currently 1. */
+    EGLuint64KHR version;
+    /* Number of frames presented on this display. */
+    EGLuint64KHR frameCount;
+    /* Time between the two most recent presents, in nanoseconds. */
+    EGLuint64KHR lastSwapIntervalNs;
+    /* Cumulative command buffer submissions. */
+    EGLuint64KHR commandBuffersSubmitted;
+    /* Cumulative pipeline compiles (pipeline cache misses). */
+    EGLuint64KHR pipelineCompiles;
+    /* Size of the backend pipeline cache in bytes, as of its last sync. */
+    EGLuint64KHR pipelineCacheSizeBytes;
+    /* Current number of entries across the descriptor set caches. */
+    EGLuint64KHR descriptorSetCacheSize;
+    /* Current number of entries in the framebuffer cache. */
+    EGLuint64KHR framebufferCacheSize;
+    /* Cumulative descriptor pool growth events (new VkDescriptorPool allocations). */
+    EGLuint64KHR descriptorPoolGrowthEvents;
+} ANGLETelemetryCounters;
+#endif /* EGL_ANGLE_display_telemetry */
+
 #ifndef EGL_ANGLE_platform_angle
 #define EGL_ANGLE_platform_angle 1
 #define EGL_PLATFORM_ANGLE_ANGLE          0x3202
@@ -667,4 +667,14 @@ GL_APICALL void GL_APIENTRY glLogicOpANGLE (GLenum);
 #endif
 #endif /* GL_ANGLE_logic_op */
 
+#ifndef GL_ANGLE_lock_draws
+#define GL_ANGLE_lock_draws
+typedef void (GL_APIENTRYP PFNGLBEGINLOCKEDDRAWSANGLEPROC) (void);
+typedef void (GL_APIENTRYP PFNGLENDLOCKEDDRAWSANGLEPROC) (void);
+#ifdef GL_GLEXT_PROTOTYPES
+GL_APICALL void GL_APIENTRY glBeginLockedDrawsANGLE (void);
+GL_APICALL void GL_APIENTRY glEndLockedDrawsANGLE (void);
+#endif
+#endif /* GL_ANGLE_lock_draws */
+
 #endif  // INCLUDE_GLES2_GL2EXT_ANGLE_H_
@@ -391,6 +391,14 @@ struct FeaturesGL : FeatureSetBase
         &members,
     };
 
+    FeatureInfo useBufferRenameChainOnOrphan = {
+        "useBufferRenameChainOnOrphan",
+        FeatureCategory::OpenGLWorkarounds,
+        "Rotate between client-side backing buffer names when a buffer is orphaned with "
+        "glBufferData instead of relying on the driver's rename heuristics.",
+        &members,
+    };
+
     FeatureInfo setZeroLevelBeforeGenerateMipmap = {
         "setZeroLevelBeforeGenerateMipmap",
         FeatureCategory::OpenGLWorkarounds,
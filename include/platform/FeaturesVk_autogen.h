@@ -316,6 +316,12 @@ struct FeaturesVk : FeatureSetBase
                                      "Use CommandQueue worker thread to dispatch work to GPU.",
                                      &members, "http://anglebug.com/4324"};
 
+    FeatureInfo batchCommandQueueSubmits = {
+        "batchCommandQueueSubmits", FeatureCategory::VulkanFeatures,
+        "Accumulate finished command batches and submit them with a single vkQueueSubmit call "
+        "once a limit is reached or a dependency forces a flush.",
+        &members, "http://anglebug.com/8009"};
+
     FeatureInfo supportsShaderFloat16 = {
         "supportsShaderFloat16", FeatureCategory::VulkanFeatures,
         "VkDevice supports the VK_KHR_shader_float16_int8 extension "
@@ -338,6 +344,50 @@ struct FeaturesVk : FeatureSetBase
         "VkDevice supports VK_EXT_load_store_op_none extension.", &members,
         "http://anglebug.com/5371"};
 
+    FeatureInfo predictiveRenderPassStoreOps = {
+        "predictiveRenderPassStoreOps", FeatureCategory::VulkanFeatures,
+        "Use cross-render-pass attachment usage history to switch attachments that are stored but "
+        "never read afterwards to STORE_OP_DONT_CARE, saving bandwidth on tiler GPUs.  May render "
+        "incorrectly for a frame when an application changes its usage pattern, so it is disabled "
+        "by default.",
+        &members, "http://anglebug.com/7880"};
+
+    FeatureInfo batchScissoredClearAttachments = {
+        "batchScissoredClearAttachments", FeatureCategory::VulkanFeatures,
+        "Accumulate consecutive mid-render-pass scissored clears that share clear state and "
+        "record them as a single vkCmdClearAttachments call covering every rect, instead of one "
+        "draw-based clear each.",
+        &members, "http://anglebug.com/7992"};
+
+    FeatureInfo compressStagedImageUpdates = {
+        "compressStagedImageUpdates", FeatureCategory::VulkanFeatures,
+        "Compress large staged image update payloads instead of holding full-size staging "
+        "allocations until flush, bounding pending-update memory during bursty texture loads at "
+        "the cost of some CPU time.",
+        &members, "http://anglebug.com/8005"};
+
+    FeatureInfo deferRenderPassBreakOnFramebufferSwitch = {
+        "deferRenderPassBreakOnFramebufferSwitch", FeatureCategory::VulkanFeatures,
+        "Keep the current render pass open across draw framebuffer binding changes, and reattach "
+        "it if the application switches back to the same framebuffer without recording anything "
+        "that required the pass to close.",
+        &members, "http://anglebug.com/7880"};
+
+    FeatureInfo coalesceSmallBufferUpdates = {
+        "coalesceSmallBufferUpdates", FeatureCategory::VulkanFeatures,
+        "Accumulate small glBufferSubData updates to device-local buffers in a CPU shadow and "
+        "emit them as merged copy regions when the buffer is next used by the GPU, instead of "
+        "staging one copy per call.",
+        &members, "http://anglebug.com/7880"};
+
+    FeatureInfo adaptiveBufferMemoryType = {
+        "adaptiveBufferMemoryType", FeatureCategory::VulkanFeatures,
+        "Choose buffer memory types from observed access patterns: persistent-mapped buffer "
+        "storage goes to DEVICE_LOCAL|HOST_VISIBLE memory, and device-local buffers that keep "
+        "taking staged CPU writes are migrated there once enough evidence accumulates.  Intended "
+        "for systems where such memory is plentiful (resizable BAR, UMA).",
+        &members, "http://anglebug.com/7880"};
+
     FeatureInfo disallowMixedDepthStencilLoadOpNoneAndLoad = {
         "disallowMixedDepthStencilLoadOpNoneAndLoad", FeatureCategory::VulkanWorkarounds,
         "Disallow use of LOAD_OP_NONE for only one of the depth or stencil aspects of a "
@@ -624,6 +674,27 @@ struct FeaturesVk : FeatureSetBase
         "forceSubmitImmutableTextureUpdates", FeatureCategory::VulkanAppWorkarounds,
         "Force submit updates to immutable textures", &members, "http://anglebug.com/6929"};
 
+    FeatureInfo deferImmutableTextureAllocation = {
+        "deferImmutableTextureAllocation", FeatureCategory::VulkanFeatures,
+        "Defer the image and memory allocation of glTexStorage textures until the first upload "
+        "or use, so textures that are allocated but never (or only later) touched do not commit "
+        "memory up front",
+        &members, "http://anglebug.com/7888"};
+
+    FeatureInfo eagerlySubmitLargeTextureUpdates = {
+        "eagerlySubmitLargeTextureUpdates", FeatureCategory::VulkanFeatures,
+        "Flush and submit a texture's staged updates once they exceed a size threshold, so the "
+        "GPU performs the copies while the application keeps recording instead of serializing a "
+        "large upload right before the texture is drawn",
+        &members, "http://anglebug.com/7887"};
+
+    FeatureInfo stageLargeTextureUpdatesInChunks = {
+        "stageLargeTextureUpdatesInChunks", FeatureCategory::VulkanFeatures,
+        "Stage large subimage uploads as multiple row bands with bounded staging allocations, "
+        "keeping peak staging memory under a fixed cap instead of allocating staging space for "
+        "the whole image at once",
+        &members, "http://anglebug.com/7889"};
+
     FeatureInfo retainSPIRVDebugInfo = {"retainSPIRVDebugInfo", FeatureCategory::VulkanFeatures,
                                         "Retain debug info in SPIR-V blob.", &members,
                                         "http://anglebug.com/5901"};
@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+#
+# Copyright 2023 The ANGLE Project Authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+"""Converts a built-in trace dump (ANGLE_BUILTIN_TRACE, see src/common/event_tracer.cpp) to
+chrome://tracing JSON.
+
+Usage: convert_builtin_trace.py angle_trace.abt [trace.json]
+"""
+
+import json
+import struct
+import sys
+
+MAGIC = 0x54474E41  # "ANGT"
+VERSION = 1
+
+
+def read_exact(f, size):
+    data = f.read(size)
+    if len(data) != size:
+        raise ValueError('Truncated trace file')
+    return data
+
+
+def read_uint32(f):
+    return struct.unpack('<I', read_exact(f, 4))[0]
+
+
+def read_uint64(f):
+    return struct.unpack('<Q', read_exact(f, 8))[0]
+
+
+def convert(input_path, output_path):
+    trace_events = []
+
+    with open(input_path, 'rb') as f:
+        if read_uint32(f) != MAGIC:
+            raise ValueError('Not a built-in trace file')
+        if read_uint32(f) != VERSION:
+            raise ValueError('Unsupported trace file version')
+        event_size = read_uint32(f)
+
+        categories = []
+        for _ in range(read_uint32(f)):
+            length = read_uint32(f)
+            categories.append(read_exact(f, length).decode('utf-8'))
+
+        for _ in range(read_uint32(f)):
+            thread_id = read_uint64(f)
+            event_count = read_uint64(f)
+            for _ in range(event_count):
+                event = read_exact(f, event_size)
+                timestamp_s, phase, category_id = struct.unpack_from('<dcB', event)
+                name = event[10:].split(b'\0', 1)[0].decode('utf-8', 'replace')
+                trace_events.append({
+                    'ph': phase.decode('ascii'),
+                    'ts': timestamp_s * 1e6,
+                    'pid': 1,
+                    'tid': thread_id,
+                    'cat': categories[category_id],
+                    'name': name,
+                })
+
+    trace_events.sort(key=lambda event: event['ts'])
+
+    with open(output_path, 'w') as f:
+        json.dump({'traceEvents': trace_events}, f)
+
+    print('Wrote %d events to %s' % (len(trace_events), output_path))
+
+
+def main():
+    if len(sys.argv) not in (2, 3):
+        print(__doc__)
+        return 1
+    input_path = sys.argv[1]
+    output_path = sys.argv[2] if len(sys.argv) == 3 else input_path + '.json'
+    convert(input_path, output_path)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -11,15 +11,62 @@
 
 #include "common/debug.h"
 
+#if defined(ANGLE_PLATFORM_POSIX)
+#    include <sys/mman.h>
+#endif
+
 namespace angle
 {
 
+namespace
+{
+// Allocations at least this large are backed by mmap so the kernel can use huge pages for them,
+// which cuts soft page faults when multi-MB staging buffers are repeatedly touched.
+constexpr size_t kLargeAllocationThreshold = 2 * 1024 * 1024;
+
+uint8_t *AllocateMemory(size_t size, bool *isMappedOut)
+{
+#if defined(ANGLE_PLATFORM_POSIX)
+    if (size >= kLargeAllocationThreshold)
+    {
+        void *memory =
+            mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory != MAP_FAILED)
+        {
+#    if defined(MADV_HUGEPAGE)
+            // Best effort; the allocation is usable either way.
+            madvise(memory, size, MADV_HUGEPAGE);
+#    endif
+            *isMappedOut = true;
+            return static_cast<uint8_t *>(memory);
+        }
+        // Fall through to malloc on mmap failure.
+    }
+#endif
+    *isMappedOut = false;
+    return static_cast<uint8_t *>(malloc(size));
+}
+
+void DeallocateMemory(uint8_t *data, size_t size, bool isMapped)
+{
+#if defined(ANGLE_PLATFORM_POSIX)
+    if (isMapped)
+    {
+        munmap(data, size);
+        return;
+    }
+#endif
+    ASSERT(!isMapped);
+    free(data);
+}
+}  // anonymous namespace
+
 // MemoryBuffer implementation.
 MemoryBuffer::~MemoryBuffer()
 {
     if (mData)
     {
-        free(mData);
+        DeallocateMemory(mData, mCapacity, mIsMapped);
         mData = nullptr;
     }
 }
@@ -30,20 +77,24 @@ bool MemoryBuffer::resize(size_t size)
     {
         if (mData)
         {
-            free(mData);
-            mData = nullptr;
+            DeallocateMemory(mData, mCapacity, mIsMapped);
+            mData     = nullptr;
+            mCapacity = 0;
+            mIsMapped = false;
         }
         mSize = 0;
         return true;
     }
 
-    if (size == mSize)
+    // Reuse the existing allocation when possible; only growing past the capacity reallocates.
+    if (size <= mCapacity)
     {
+        mSize = size;
         return true;
     }
 
-    // Only reallocate if the size has changed.
-    uint8_t *newMemory = static_cast<uint8_t *>(malloc(sizeof(uint8_t) * size));
+    bool newIsMapped   = false;
+    uint8_t *newMemory = AllocateMemory(size, &newIsMapped);
     if (newMemory == nullptr)
     {
         return false;
@@ -53,11 +104,13 @@ bool MemoryBuffer::resize(size_t size)
     {
         // Copy the intersection of the old data and the new data
         std::copy(mData, mData + std::min(mSize, size), newMemory);
-        free(mData);
+        DeallocateMemory(mData, mCapacity, mIsMapped);
     }
 
-    mData = newMemory;
-    mSize = size;
+    mData     = newMemory;
+    mCapacity = size;
+    mIsMapped = newIsMapped;
+    mSize     = size;
 
     return true;
 }
@@ -78,6 +131,8 @@ MemoryBuffer::MemoryBuffer(MemoryBuffer &&other) : MemoryBuffer()
 MemoryBuffer &MemoryBuffer::operator=(MemoryBuffer &&other)
 {
     std::swap(mSize, other.mSize);
+    std::swap(mCapacity, other.mCapacity);
+    std::swap(mIsMapped, other.mIsMapped);
     std::swap(mData, other.mData);
     return *this;
 }
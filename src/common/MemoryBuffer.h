@@ -29,6 +29,9 @@ class MemoryBuffer final : NonCopyable
     [[nodiscard]] bool resize(size_t size);
     void clear() { (void)resize(0); }
     size_t size() const { return mSize; }
+    // The allocation backing this buffer; resize() only reallocates when growing beyond it, so
+    // repeated grow/shrink cycles (ScratchBuffer, pixel pack/unpack staging) reuse the same pages.
+    size_t capacity() const { return mCapacity; }
     bool empty() const { return mSize == 0; }
 
     const uint8_t *data() const { return mData; }
@@ -52,7 +55,11 @@ class MemoryBuffer final : NonCopyable
     void fill(uint8_t datum);
 
   private:
-    size_t mSize   = 0;
+    size_t mSize     = 0;
+    size_t mCapacity = 0;
+    // True when the allocation came from mmap (large buffers, for huge-page backing) rather than
+    // malloc; deallocation must match.
+    bool mIsMapped = false;
     uint8_t *mData = nullptr;
 };
 
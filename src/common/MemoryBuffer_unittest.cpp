@@ -0,0 +1,78 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryBuffer_unittest:
+//   Tests of the MemoryBuffer and ScratchBuffer classes
+//
+
+#include <gtest/gtest.h>
+
+#include "common/MemoryBuffer.h"
+
+namespace angle
+{
+// Verify that resize preserves data and only reallocates when growing past the capacity.
+TEST(MemoryBufferTest, ResizeReusesAllocation)
+{
+    constexpr size_t kSize = 1024;
+
+    MemoryBuffer buffer;
+    ASSERT_TRUE(buffer.resize(kSize));
+    EXPECT_EQ(buffer.size(), kSize);
+    EXPECT_GE(buffer.capacity(), kSize);
+
+    buffer.fill(0xAB);
+    const uint8_t *data = buffer.data();
+
+    // Shrinking and growing back within the capacity must not move the data.
+    ASSERT_TRUE(buffer.resize(kSize / 2));
+    EXPECT_EQ(buffer.size(), kSize / 2);
+    ASSERT_TRUE(buffer.resize(kSize));
+    EXPECT_EQ(buffer.data(), data);
+    EXPECT_EQ(buffer[kSize / 2 - 1], 0xAB);
+
+    // Growing past the capacity keeps the old contents.
+    ASSERT_TRUE(buffer.resize(kSize * 4));
+    EXPECT_EQ(buffer[0], 0xAB);
+    EXPECT_EQ(buffer[kSize - 1], 0xAB);
+
+    // resize(0) releases the allocation.
+    buffer.clear();
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_EQ(buffer.capacity(), 0u);
+}
+
+// Verify large buffers round-trip data; these take the mmap-backed allocation path.
+TEST(MemoryBufferTest, LargeAllocation)
+{
+    constexpr size_t kSize = 4 * 1024 * 1024;
+
+    MemoryBuffer buffer;
+    ASSERT_TRUE(buffer.resize(kSize));
+    buffer.fill(0x5A);
+    EXPECT_EQ(buffer[0], 0x5A);
+    EXPECT_EQ(buffer[kSize - 1], 0x5A);
+
+    // Shrink to a malloc-sized request; the large allocation is retained and reused.
+    ASSERT_TRUE(buffer.resize(16));
+    EXPECT_GE(buffer.capacity(), kSize);
+    EXPECT_EQ(buffer[0], 0x5A);
+}
+
+// Verify ScratchBuffer reuses its backing store across differently-sized requests.
+TEST(ScratchBufferTest, Reuse)
+{
+    ScratchBuffer scratch(100);
+
+    MemoryBuffer *large = nullptr;
+    ASSERT_TRUE(scratch.get(2048, &large));
+    large->fill(0x42);
+    const uint8_t *data = large->data();
+
+    MemoryBuffer *small = nullptr;
+    ASSERT_TRUE(scratch.get(256, &small));
+    EXPECT_EQ(small->data(), data);
+}
+}  // namespace angle
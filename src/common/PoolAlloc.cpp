@@ -13,6 +13,7 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include "common/aligned_memory.h"
 #include "common/angleutils.h"
 #include "common/debug.h"
 #include "common/mathutil.h"
@@ -149,6 +150,23 @@ class PageHeader
     Allocation *lastAllocation;
 #    endif
 };
+
+namespace
+{
+// Page memory is aligned to the cache line so that command data recorded on one thread doesn't
+// false-share with data being replayed by worker threads out of neighboring heap allocations.
+constexpr size_t kPageMemoryAlignment = 64;
+
+PageHeader *AllocatePageMemory(size_t numBytes)
+{
+    return reinterpret_cast<PageHeader *>(AlignedAlloc(numBytes, kPageMemoryAlignment));
+}
+
+void FreePageMemory(PageHeader *page)
+{
+    AlignedFree(page);
+}
+}  // anonymous namespace
 #endif
 
 //
@@ -218,7 +236,7 @@ PoolAllocator::~PoolAllocator()
     {
         PageHeader *next = mInUseList->nextPage;
         mInUseList->~PageHeader();
-        delete[] reinterpret_cast<char *>(mInUseList);
+        FreePageMemory(mInUseList);
         mInUseList = next;
     }
     // We should not check the guard blocks
@@ -228,7 +246,7 @@ PoolAllocator::~PoolAllocator()
     while (mFreeList)
     {
         PageHeader *next = mFreeList->nextPage;
-        delete[] reinterpret_cast<char *>(mFreeList);
+        FreePageMemory(mFreeList);
         mFreeList = next;
     }
 #else  // !defined(ANGLE_DISABLE_POOL_ALLOC)
@@ -304,7 +322,7 @@ void PoolAllocator::pop()
         PageHeader *nextInUse = mInUseList->nextPage;
         if (mInUseList->pageCount > 1)
         {
-            delete[] reinterpret_cast<char *>(mInUseList);
+            FreePageMemory(mInUseList);
         }
         else
         {
@@ -334,6 +352,22 @@ void PoolAllocator::popAll()
         pop();
 }
 
+void PoolAllocator::preallocatePages(size_t numPages)
+{
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
+    for (size_t page = 0; page < numPages; ++page)
+    {
+        PageHeader *memory = AllocatePageMemory(mPageSize);
+        if (memory == nullptr)
+        {
+            return;
+        }
+        memory->nextPage = mFreeList;
+        mFreeList        = memory;
+    }
+#endif
+}
+
 void *PoolAllocator::allocate(size_t numBytes)
 {
     ASSERT(!mLocked);
@@ -379,7 +413,7 @@ void *PoolAllocator::allocate(size_t numBytes)
         // Integer overflow is unexpected.
         ASSERT(numBytesToAlloc >= allocationSize);
 
-        PageHeader *memory = reinterpret_cast<PageHeader *>(::new char[numBytesToAlloc]);
+        PageHeader *memory = AllocatePageMemory(numBytesToAlloc);
         if (memory == nullptr)
         {
             return nullptr;
@@ -426,7 +460,7 @@ uint8_t *PoolAllocator::allocateNewPage(size_t numBytes)
     }
     else
     {
-        memory = reinterpret_cast<PageHeader *>(::new char[mPageSize]);
+        memory = AllocatePageMemory(mPageSize);
         if (memory == nullptr)
         {
             return nullptr;
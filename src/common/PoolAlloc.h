@@ -90,6 +90,13 @@ class PoolAllocator : angle::NonCopyable
     //
     void popAll();
 
+    //
+    // Call preallocatePages() to stock the free page list ahead of time.  Later growth that fits
+    // in a single page is then satisfied without going to the system allocator, keeping
+    // allocation off the global heap lock on recording hot paths.
+    //
+    void preallocatePages(size_t numPages);
+
     //
     // Call allocate() to actually acquire memory.  Returns 0 if no memory
     // available, otherwise a properly aligned pointer to 'numBytes' of memory.
@@ -176,6 +183,39 @@ class PoolAllocator : angle::NonCopyable
     bool mLocked;
 };
 
+// An STL-compatible allocator bound to a PoolAllocator, for containers whose contents are
+// transient enough to be mass-freed when the pool pops -- for example per-frame scratch vectors
+// served out of the frame arena (gl::State::getFrameArena).  deallocate() is intentionally a
+// no-op: the pool reclaims everything at once, so the bound pool must outlive the container and
+// must not pop while the container is still in use.
+template <typename T>
+class StlPoolAllocator
+{
+  public:
+    using value_type = T;
+
+    // Intentionally implicit, so containers can be constructed directly from a PoolAllocator.
+    StlPoolAllocator(PoolAllocator *pool) : mPool(pool) {}
+    template <typename U>
+    StlPoolAllocator(const StlPoolAllocator<U> &other) : mPool(other.getPool())
+    {}
+
+    T *allocate(size_t count) { return static_cast<T *>(mPool->allocate(count * sizeof(T))); }
+    void deallocate(T *, size_t) {}
+
+    PoolAllocator *getPool() const { return mPool; }
+
+    bool operator==(const StlPoolAllocator &rhs) const { return mPool == rhs.mPool; }
+    bool operator!=(const StlPoolAllocator &rhs) const { return mPool != rhs.mPool; }
+
+  private:
+    PoolAllocator *mPool;
+};
+
+// Shorthand for a std::vector that serves its storage from a PoolAllocator.
+template <typename T>
+using PoolVector = std::vector<T, StlPoolAllocator<T>>;
+
 }  // namespace angle
 
 #endif  // COMMON_POOLALLOC_H_
@@ -50,6 +50,21 @@ TEST(PoolAllocatorTest, Interface)
     poolAllocator.popAll();
 }
 
+// Verify preallocated pages can back subsequent allocations
+TEST(PoolAllocatorTest, PreallocatePages)
+{
+    PoolAllocator poolAllocator;
+    poolAllocator.preallocatePages(4);
+    // Allocate enough to consume several pages; all allocations must succeed
+    for (uint32_t i = 0; i < 64; ++i)
+    {
+        void *allocation = poolAllocator.allocate(1024);
+        EXPECT_NE(nullptr, allocation);
+        memset(allocation, 0x5a, 1024);
+    }
+    poolAllocator.popAll();
+}
+
 #if !defined(ANGLE_POOL_ALLOC_GUARD_BLOCKS)
 // Verify allocations are correctly aligned for different alignments
 class PoolAllocatorAlignmentTest : public testing::TestWithParam<int>
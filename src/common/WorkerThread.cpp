@@ -17,13 +17,24 @@
 #endif  // !defined(ANGLE_STD_ASYNC_WORKERS) && & !defined(ANGLE_ENABLE_WINDOWS_UWP)
 
 #if (ANGLE_DELEGATE_WORKERS == ANGLE_ENABLED) || (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+#    include <algorithm>
+#    include <atomic>
 #    include <condition_variable>
+#    include <deque>
 #    include <future>
 #    include <mutex>
 #    include <queue>
 #    include <thread>
 #endif  // (ANGLE_DELEGATE_WORKERS == ANGLE_ENABLED) || (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
 
+#if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+#    if defined(ANGLE_PLATFORM_WINDOWS)
+#        include <windows.h>
+#    elif defined(ANGLE_PLATFORM_ANDROID) || defined(ANGLE_PLATFORM_LINUX)
+#        include <sys/resource.h>
+#    endif
+#endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+
 namespace angle
 {
 
@@ -104,6 +115,37 @@ bool SingleThreadedWorkerPool::isAsync()
 
 #if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
 
+// Task affinity: there is no portable core-affinity API, but on big.LITTLE devices the scheduler
+// places low-priority threads on little cores.  Lowering the worker's priority while a background
+// task runs therefore steers foreground work (compiles, links) to big cores and opportunistic
+// work (serialization, cache warm up) to little ones.  Other platforms keep the default priority.
+void SetThreadTaskPriority(TaskPriority priority)
+{
+#    if defined(ANGLE_PLATFORM_WINDOWS)
+    ::SetThreadPriority(::GetCurrentThread(), priority == TaskPriority::Background
+                                                  ? THREAD_PRIORITY_BELOW_NORMAL
+                                                  : THREAD_PRIORITY_NORMAL);
+#    elif defined(ANGLE_PLATFORM_ANDROID)
+    // With PRIO_PROCESS, a |who| of zero means the calling thread on Linux.
+    setpriority(PRIO_PROCESS, 0, priority == TaskPriority::Background ? 10 : 0);
+#    elif defined(ANGLE_PLATFORM_LINUX)
+    // Unlike Android, stock Linux only lets a process lower its nice value back to 0 when
+    // RLIMIT_NICE allows it (or with CAP_SYS_NICE), and the desktop default limit does not.
+    // Without that, the restore after a background task silently fails and the worker stays
+    // demoted forever, so only demote when the restore is known to work.
+    static const bool canRestorePriority = [] {
+        struct rlimit limit;
+        // A limit of N permits lowering nice down to 20 - N; restoring to 0 needs N >= 20.
+        return getrlimit(RLIMIT_NICE, &limit) == 0 && limit.rlim_cur >= 20;
+    }();
+    if (canRestorePriority)
+    {
+        // With PRIO_PROCESS, a |who| of zero means the calling thread on Linux.
+        setpriority(PRIO_PROCESS, 0, priority == TaskPriority::Background ? 10 : 0);
+    }
+#    endif
+}
+
 class AsyncWorkerPool final : public WorkerThreadPool
 {
   public:
@@ -112,6 +154,10 @@ class AsyncWorkerPool final : public WorkerThreadPool
     ~AsyncWorkerPool() override;
 
     std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task) override;
+    std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task,
+                                                  TaskPriority priority) override;
+
+    void reportFrameTime(double durationSeconds) override;
 
     bool isAsync() override;
 
@@ -120,20 +166,53 @@ class AsyncWorkerPool final : public WorkerThreadPool
 
     using Task = std::pair<std::shared_ptr<AsyncWaitableEvent>, std::shared_ptr<Closure>>;
 
+    // Foreground tasks live in per-worker deques: each worker pops its own deque from the front
+    // and steals from the back of its neighbors' when it runs dry, so concurrent workers don't
+    // convoy on a single queue lock.
+    struct WorkerDeque : angle::NonCopyable
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
     // Thread's main loop
-    void threadLoop();
+    void threadLoop(size_t threadIndex);
+
+    // Blocks until a task is available (returns true) or the pool is terminated (returns false).
+    bool getTask(size_t threadIndex, Task *taskOut, bool *isBackgroundOut);
+
+    bool tryPopForeground(size_t threadIndex, Task *taskOut);
+
+    // Wakes one worker if any is asleep.  When all workers are already busy chewing on a batch of
+    // tasks, posting more is wakeup-free.
+    void wakeOneWorker();
 
     bool mTerminated = false;
-    std::mutex mMutex;                 // Protects access to the fields in this class
-    std::condition_variable mCondVar;  // Signals when work is available in the queue
-    std::queue<Task> mTaskQueue;
+    std::mutex mMutex;                 // Protects access to the fields below
+    std::condition_variable mCondVar;  // Signals when work is available
+    // Foreground tasks always run before background tasks, and background tasks additionally obey
+    // the concurrency limit set by the CPU budget governor (see reportFrameTime).  The background
+    // lane is throttled anyway, so it stays a single shared queue.
+    std::queue<Task> mBackgroundTaskQueue;
+    size_t mActiveBackgroundTasks = 0;
+    size_t mBackgroundConcurrencyLimit;
+    size_t mSmoothFrameCount = 0;
     std::deque<std::thread> mThreads;
     size_t mDesiredThreadCount;
+
+    // The deques are created once (under |mMutex|) before any worker starts and are not resized
+    // afterwards; only the tasks inside them need locking.
+    std::vector<std::unique_ptr<WorkerDeque>> mForegroundDeques;
+    std::atomic<bool> mThreadsCreated{false};
+    std::atomic<size_t> mNextPostDeque{0};
+    std::atomic<size_t> mPendingForegroundTasks{0};
+    std::atomic<size_t> mSleepingThreads{0};
 };
 
 // AsyncWorkerPool implementation.
 
-AsyncWorkerPool::AsyncWorkerPool(size_t numThreads) : mDesiredThreadCount(numThreads)
+AsyncWorkerPool::AsyncWorkerPool(size_t numThreads)
+    : mBackgroundConcurrencyLimit(numThreads), mDesiredThreadCount(numThreads)
 {
     ASSERT(numThreads != 0);
 }
@@ -160,43 +239,197 @@ void AsyncWorkerPool::createThreads()
     }
     ASSERT(mThreads.empty());
 
+    mForegroundDeques.reserve(mDesiredThreadCount);
+    for (size_t i = 0; i < mDesiredThreadCount; ++i)
+    {
+        mForegroundDeques.emplace_back(new WorkerDeque());
+    }
     for (size_t i = 0; i < mDesiredThreadCount; ++i)
     {
-        mThreads.emplace_back(&AsyncWorkerPool::threadLoop, this);
+        mThreads.emplace_back(&AsyncWorkerPool::threadLoop, this, i);
     }
+    mThreadsCreated.store(true, std::memory_order_release);
 }
 
 std::shared_ptr<WaitableEvent> AsyncWorkerPool::postWorkerTask(std::shared_ptr<Closure> task)
 {
-    // Thread safety: This function is thread-safe because access to |mTaskQueue| is protected by
-    // |mMutex|.
+    return postWorkerTask(std::move(task), TaskPriority::Foreground);
+}
+
+std::shared_ptr<WaitableEvent> AsyncWorkerPool::postWorkerTask(std::shared_ptr<Closure> task,
+                                                               TaskPriority priority)
+{
+    // Thread safety: This function is thread-safe because the task queues are protected by
+    // per-deque locks (foreground) or |mMutex| (background).
     auto waitable = std::make_shared<AsyncWaitableEvent>();
+
+    // Lazily create the threads on first task
+    if (!mThreadsCreated.load(std::memory_order_acquire))
     {
         std::lock_guard<std::mutex> lock(mMutex);
-
-        // Lazily create the threads on first task
         createThreads();
+    }
 
-        mTaskQueue.push(std::make_pair(waitable, task));
+    if (priority == TaskPriority::Foreground)
+    {
+        // Round-robin over the worker deques; an idle worker steals the task back if the chosen
+        // worker is busy.
+        const size_t dequeIndex =
+            mNextPostDeque.fetch_add(1, std::memory_order_relaxed) % mForegroundDeques.size();
+        WorkerDeque &workerDeque = *mForegroundDeques[dequeIndex];
+        {
+            std::lock_guard<std::mutex> lock(workerDeque.mutex);
+            workerDeque.tasks.push_back(std::make_pair(waitable, task));
+        }
+        mPendingForegroundTasks.fetch_add(1);
+        wakeOneWorker();
+    }
+    else
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mBackgroundTaskQueue.push(std::make_pair(waitable, task));
+        }
+        wakeOneWorker();
     }
-    mCondVar.notify_one();
     return waitable;
 }
 
-void AsyncWorkerPool::threadLoop()
+void AsyncWorkerPool::wakeOneWorker()
 {
-    while (true)
+    if (mSleepingThreads.load() == 0)
     {
-        Task task;
+        return;
+    }
+    // Locking (and immediately releasing) |mMutex| ensures a worker that found no work but has
+    // not yet blocked in wait() cannot miss the notification: it either re-evaluates its
+    // predicate after this lock, or it is already waiting.
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+    }
+    mCondVar.notify_one();
+}
+
+void AsyncWorkerPool::reportFrameTime(double durationSeconds)
+{
+    // CPU budget governor: background concurrency is halved as soon as a frame hitches and creeps
+    // back up after a stretch of smooth frames.  The thresholds correspond to clearly missing or
+    // comfortably making a 60Hz deadline; foreground tasks are never throttled.
+    constexpr double kHitchThresholdSeconds   = 0.020;
+    constexpr double kSmoothThresholdSeconds  = 0.014;
+    constexpr size_t kSmoothFramesBeforeRaise = 30;
+
+    bool raised = false;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (durationSeconds > kHitchThresholdSeconds)
         {
-            std::unique_lock<std::mutex> lock(mMutex);
-            mCondVar.wait(lock, [this] { return !mTaskQueue.empty() || mTerminated; });
-            if (mTerminated)
+            mBackgroundConcurrencyLimit = std::max<size_t>(1, mBackgroundConcurrencyLimit / 2);
+            mSmoothFrameCount           = 0;
+        }
+        else if (durationSeconds < kSmoothThresholdSeconds &&
+                 mBackgroundConcurrencyLimit < mDesiredThreadCount)
+        {
+            if (++mSmoothFrameCount >= kSmoothFramesBeforeRaise)
             {
-                return;
+                ++mBackgroundConcurrencyLimit;
+                mSmoothFrameCount = 0;
+                raised            = true;
             }
-            task = mTaskQueue.front();
-            mTaskQueue.pop();
+        }
+    }
+    if (raised)
+    {
+        mCondVar.notify_all();
+    }
+}
+
+bool AsyncWorkerPool::tryPopForeground(size_t threadIndex, Task *taskOut)
+{
+    // Pop the worker's own deque from the front (post order) and steal from the back of the
+    // neighbors' so that a thief and a busy owner contend on opposite ends.
+    const size_t dequeCount = mForegroundDeques.size();
+    for (size_t offset = 0; offset < dequeCount; ++offset)
+    {
+        WorkerDeque &workerDeque = *mForegroundDeques[(threadIndex + offset) % dequeCount];
+        std::lock_guard<std::mutex> lock(workerDeque.mutex);
+        if (workerDeque.tasks.empty())
+        {
+            continue;
+        }
+        if (offset == 0)
+        {
+            *taskOut = workerDeque.tasks.front();
+            workerDeque.tasks.pop_front();
+        }
+        else
+        {
+            *taskOut = workerDeque.tasks.back();
+            workerDeque.tasks.pop_back();
+        }
+        mPendingForegroundTasks.fetch_sub(1);
+        return true;
+    }
+    return false;
+}
+
+bool AsyncWorkerPool::getTask(size_t threadIndex, Task *taskOut, bool *isBackgroundOut)
+{
+    while (true)
+    {
+        if (tryPopForeground(threadIndex, taskOut))
+        {
+            *isBackgroundOut = false;
+            return true;
+        }
+
+        std::unique_lock<std::mutex> lock(mMutex);
+        if (!mBackgroundTaskQueue.empty() && mActiveBackgroundTasks < mBackgroundConcurrencyLimit)
+        {
+            *taskOut = mBackgroundTaskQueue.front();
+            mBackgroundTaskQueue.pop();
+            *isBackgroundOut = true;
+            ++mActiveBackgroundTasks;
+            return true;
+        }
+        if (mTerminated)
+        {
+            return false;
+        }
+
+        ++mSleepingThreads;
+        mCondVar.wait(lock, [this] {
+            return mTerminated || mPendingForegroundTasks.load() != 0 ||
+                   (!mBackgroundTaskQueue.empty() &&
+                    mActiveBackgroundTasks < mBackgroundConcurrencyLimit);
+        });
+        --mSleepingThreads;
+        if (mTerminated)
+        {
+            return false;
+        }
+        // Go around and race for the task that woke us.
+    }
+}
+
+void AsyncWorkerPool::threadLoop(size_t threadIndex)
+{
+    TaskPriority currentPriority = TaskPriority::Foreground;
+    while (true)
+    {
+        Task task;
+        bool isBackground = false;
+        if (!getTask(threadIndex, &task, &isBackground))
+        {
+            return;
+        }
+
+        const TaskPriority taskPriority =
+            isBackground ? TaskPriority::Background : TaskPriority::Foreground;
+        if (taskPriority != currentPriority)
+        {
+            SetThreadTaskPriority(taskPriority);
+            currentPriority = taskPriority;
         }
 
         auto &waitable = task.first;
@@ -206,6 +439,15 @@ void AsyncWorkerPool::threadLoop()
         // in traces.
         (*closure)();
         waitable->markAsReady();
+
+        if (isBackground)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                --mActiveBackgroundTasks;
+            }
+            mCondVar.notify_one();
+        }
     }
 }
 
@@ -23,6 +23,16 @@ namespace angle
 
 class WorkerThreadPool;
 
+// Task priority lanes.  Foreground tasks are those whose results the render thread may block on,
+// such as compiles and links started by API calls.  Background tasks are opportunistic work such
+// as pipeline cache warm up.  Pools that support lanes run foreground tasks first and may throttle
+// background concurrency (see WorkerThreadPool::reportFrameTime).
+enum class TaskPriority
+{
+    Background,
+    Foreground,
+};
+
 // A callback function with no return value and no arguments.
 class Closure
 {
@@ -83,6 +93,19 @@ class WorkerThreadPool : angle::NonCopyable
     // returns null.  This function is thread-safe.
     virtual std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task) = 0;
 
+    // Same, with an explicit priority lane.  Pools without lane support run every task as if it
+    // were foreground.  This function is thread-safe.
+    virtual std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task,
+                                                          TaskPriority priority)
+    {
+        return postWorkerTask(task);
+    }
+
+    // Feeds an observed frame time to the pool's CPU budget governor, if any.  Adapting pools use
+    // it to throttle background task concurrency so opportunistic work never starves the thread
+    // producing frames.  This function is thread-safe.
+    virtual void reportFrameTime(double durationSeconds) {}
+
     virtual bool isAsync() = 0;
 
   private:
@@ -48,4 +48,46 @@ TEST(WorkerPoolTest, SimpleTask)
     }
 }
 
+// Tests that tasks on both priority lanes complete, including while the background lane is
+// throttled by the CPU budget governor.
+TEST(WorkerPoolTest, PriorityLanes)
+{
+    class TestTask : public Closure
+    {
+      public:
+        void operator()() override { fired = true; }
+
+        bool fired = false;
+    };
+
+    std::array<std::shared_ptr<WorkerThreadPool>, 2> pools = {
+        {WorkerThreadPool::Create(1, ANGLEPlatformCurrent()),
+         WorkerThreadPool::Create(0, ANGLEPlatformCurrent())}};
+    for (auto &pool : pools)
+    {
+        // Simulate hitching frames so an adapting pool throttles its background lane down to the
+        // minimum; background tasks must still run.
+        for (uint32_t frame = 0; frame < 10; ++frame)
+        {
+            pool->reportFrameTime(0.1);
+        }
+
+        std::array<std::shared_ptr<TestTask>, 4> tasks = {
+            {std::make_shared<TestTask>(), std::make_shared<TestTask>(),
+             std::make_shared<TestTask>(), std::make_shared<TestTask>()}};
+        std::array<std::shared_ptr<WaitableEvent>, 4> waitables = {
+            {pool->postWorkerTask(tasks[0], TaskPriority::Background),
+             pool->postWorkerTask(tasks[1], TaskPriority::Foreground),
+             pool->postWorkerTask(tasks[2], TaskPriority::Background),
+             pool->postWorkerTask(tasks[3], TaskPriority::Foreground)}};
+
+        WaitableEvent::WaitMany(&waitables);
+
+        for (const auto &task : tasks)
+        {
+            EXPECT_TRUE(task->fired);
+        }
+    }
+}
+
 }  // anonymous namespace
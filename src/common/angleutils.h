@@ -144,11 +144,21 @@ struct PerfMonitorTriplet
     FN(vkQueueSubmitCallsTotal)                    \
     FN(vkQueueSubmitCallsPerFrame)                 \
     FN(renderPasses)                               \
+    FN(renderPassBreaksAvoided)                    \
+    FN(drawCalls)                                  \
+    FN(vertexShaderInvocations)                    \
+    FN(fragmentShaderInvocations)                  \
+    FN(estimatedAttachmentBandwidthBytes)          \
+    FN(estimatedTextureFetchBandwidthBytes)        \
+    FN(estimatedBufferTransferBandwidthBytes)      \
     FN(writeDescriptorSets)                        \
     FN(flushedOutsideRenderPassCommandBuffers)     \
+    FN(imageBarriersMerged)                        \
+    FN(imageCopyRegionsBatched)                    \
     FN(swapchainResolveInSubpass)                  \
     FN(swapchainResolveOutsideSubpass)             \
     FN(resolveImageCommands)                       \
+    FN(blitResolveOutsideSubpass)                  \
     FN(colorLoadOpClears)                          \
     FN(colorLoadOpLoads)                           \
     FN(colorLoadOpNones)                           \
@@ -178,7 +188,9 @@ struct PerfMonitorTriplet
     FN(pipelineCreationCacheMisses)                \
     FN(pipelineCreationTotalCacheHitsDurationNs)   \
     FN(pipelineCreationTotalCacheMissesDurationNs) \
+    FN(pipelineCacheSizeBytes)                     \
     FN(descriptorSetAllocations)                   \
+    FN(descriptorPoolAllocations)                  \
     FN(descriptorSetCacheTotalSize)                \
     FN(descriptorSetCacheKeySizeBytes)             \
     FN(uniformsAndXfbDescriptorSetCacheHits)       \
@@ -192,10 +204,14 @@ struct PerfMonitorTriplet
     FN(shaderResourcesDescriptorSetCacheMisses)    \
     FN(shaderResourcesDescriptorSetCacheTotalSize) \
     FN(buffersGhosted)                             \
+    FN(texturesGhosted)                            \
     FN(vertexArraySyncStateCalls)                  \
     FN(allocateNewBufferBlockCalls)                \
     FN(dynamicBufferAllocations)                   \
-    FN(framebufferCacheSize)
+    FN(framebufferCacheSize)                       \
+    FN(bufferPoolTotalMemorySize)                  \
+    FN(bufferPoolUnusedMemorySize)                 \
+    FN(heapAllocationsTotal)
 
 #define ANGLE_DECLARE_PERF_COUNTER(COUNTER) uint64_t COUNTER;
 
@@ -540,6 +556,16 @@ class MsanScopedDisableInterceptorChecks final : angle::NonCopyable
 #    define ANGLE_NOINLINE
 #endif
 
+// Opt-in initial-exec TLS model for hot thread-local variables (the current context and thread
+// pointers read on every entry point).  Initial-exec turns the lookup into a direct
+// thread-pointer-relative load, but consumes static TLS space that is limited when the library is
+// dlopen'ed, hence the build flag.
+#if defined(ANGLE_USE_INITIAL_EXEC_TLS) && (defined(__clang__) || defined(__GNUC__))
+#    define ANGLE_HOT_TLS_MODEL __attribute__((tls_model("initial-exec")))
+#else
+#    define ANGLE_HOT_TLS_MODEL
+#endif
+
 #if defined(__clang__) || (defined(__GNUC__) && defined(__has_attribute))
 #    if __has_attribute(format)
 #        define ANGLE_FORMAT_PRINTF(fmt, args) __attribute__((format(__printf__, fmt, args)))
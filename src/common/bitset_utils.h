@@ -162,6 +162,12 @@ class BitSetT final
     constexpr ParamT first() const;
     constexpr ParamT last() const;
 
+    // Invokes |func| once per set bit, in ascending order.  A count-trailing-zeros chain over a
+    // local copy of the bits avoids the copy-and-reset work the Iterator performs per step, which
+    // makes a measurable difference on hot dirty-bit walks.
+    template <typename Func>
+    void forEachSetBit(Func &&func) const;
+
     // Produces a mask of ones up to the "x"th bit.
     constexpr static BitsT Mask(std::size_t x) { return BitMask<BitsT>(static_cast<ParamT>(x)); }
 
@@ -437,6 +443,16 @@ ParamT BitSetT<N, BitsT, ParamT>::Iterator::operator*() const
     return static_cast<ParamT>(mCurrentBit);
 }
 
+template <size_t N, typename BitsT, typename ParamT>
+template <typename Func>
+ANGLE_INLINE void BitSetT<N, BitsT, ParamT>::forEachSetBit(Func &&func) const
+{
+    for (BitsT bits = mBits; bits != 0; bits &= bits - 1)
+    {
+        func(static_cast<ParamT>(gl::ScanForward(bits)));
+    }
+}
+
 template <size_t N, typename BitsT, typename ParamT>
 std::size_t BitSetT<N, BitsT, ParamT>::Iterator::getNextBit()
 {
@@ -683,6 +699,12 @@ class BitSetArray final
     constexpr param_type first() const;
     constexpr param_type last() const;
 
+    // Invokes |func| once per set bit, in ascending order.  Zero words are skipped with a single
+    // compare, and set bits within a word are walked with a count-trailing-zeros chain, so
+    // mostly-empty wide sets cost little more than the word scan itself.
+    template <typename Func>
+    void forEachSetBit(Func &&func) const;
+
     constexpr value_type bits(size_t index) const;
 
   private:
@@ -1054,6 +1076,26 @@ constexpr typename BitSetArray<N>::param_type BitSetArray<N>::last() const
     return 0;
 }
 
+template <std::size_t N>
+template <typename Func>
+ANGLE_INLINE void BitSetArray<N>::forEachSetBit(Func &&func) const
+{
+    for (std::size_t index = 0; index < kArraySize; index++)
+    {
+        value_type bits = mBaseBitSetArray[index].bits();
+        if (bits == 0)
+        {
+            continue;
+        }
+        const std::size_t base = index * priv::kDefaultBitSetSize;
+        do
+        {
+            func(base + gl::ScanForward(bits));
+            bits &= bits - 1;
+        } while (bits != 0);
+    }
+}
+
 template <std::size_t N>
 constexpr typename BitSetArray<N>::value_type BitSetArray<N>::bits(size_t index) const
 {
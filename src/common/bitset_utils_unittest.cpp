@@ -7,7 +7,9 @@
 //   Tests bitset helpers and custom classes.
 //
 
+#include <algorithm>
 #include <array>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -241,6 +243,25 @@ TYPED_TEST(BitSetIteratorTest, IterationOrder)
     EXPECT_EQ(fetchOrder.size(), mStateBits.count());
 }
 
+// Test forEachSetBit matches iterator order and handles the empty set.
+TYPED_TEST(BitSetIteratorTest, ForEachSetBit)
+{
+    TypeParam mStateBits = this->mStateBits;
+
+    std::vector<size_t> visited;
+    mStateBits.forEachSetBit([&](size_t bit) { visited.push_back(bit); });
+    EXPECT_TRUE(visited.empty());
+
+    const std::array<size_t, 5> expected = {0, 7, 16, 31, 39};
+    for (size_t value : expected)
+    {
+        mStateBits.set(value);
+    }
+
+    mStateBits.forEachSetBit([&](size_t bit) { visited.push_back(bit); });
+    EXPECT_EQ(visited, std::vector<size_t>(expected.begin(), expected.end()));
+}
+
 // Test an empty iterator.
 TYPED_TEST(BitSetIteratorTest, EmptySet)
 {
@@ -630,6 +651,28 @@ TYPED_TEST(BitSetArrayTest, IterationWithGaps)
     mBits.reset();
 }
 
+TYPED_TEST(BitSetArrayTest, ForEachSetBit)
+{
+    TypeParam &mBits = this->mBitSet;
+
+    std::vector<size_t> visited;
+    mBits.forEachSetBit([&](size_t bit) { visited.push_back(bit); });
+    EXPECT_TRUE(visited.empty());
+
+    // Include bits in the first and last words and on a word boundary.
+    std::vector<size_t> bitsToBeSet = {0, 63, 64, mBits.size() / 2, mBits.size() - 1};
+    std::sort(bitsToBeSet.begin(), bitsToBeSet.end());
+    bitsToBeSet.erase(std::unique(bitsToBeSet.begin(), bitsToBeSet.end()), bitsToBeSet.end());
+    for (size_t bit : bitsToBeSet)
+    {
+        mBits.set(bit);
+    }
+
+    mBits.forEachSetBit([&](size_t bit) { visited.push_back(bit); });
+    EXPECT_EQ(visited, bitsToBeSet);
+    mBits.reset();
+}
+
 // Unit test for angle::Bit
 TEST(Bit, Test)
 {
@@ -10,6 +10,7 @@
 
 #include <stdarg.h>
 
+#include <algorithm>
 #include <array>
 #include <cstdio>
 #include <cstring>
@@ -29,6 +30,21 @@
 #    include <windows.h>
 #endif
 
+#if defined(ANGLE_ENABLE_ENTRY_POINT_CYCLE_PROFILING)
+#    if defined(_MSC_VER)
+#        include <intrin.h>
+#    elif defined(__i386__) || defined(__x86_64__)
+#        include <x86intrin.h>
+#    endif
+#endif
+
+#if defined(ANGLE_ENABLE_ALLOCATION_PROFILING)
+#    include <atomic>
+#    include <cstdlib>
+#    include <mutex>
+#    include <new>
+#endif
+
 #include "anglebase/no_destructor.h"
 #include "common/Optional.h"
 #include "common/angleutils.h"
@@ -65,6 +81,143 @@ bool ShouldCreateLogMessage(LogSeverity severity)
 #endif
 }
 
+#if defined(ANGLE_ENABLE_ENTRY_POINT_CYCLE_PROFILING)
+// The EntryPoint enumeration has no count entry; the WGL entry points are last.
+constexpr size_t kEntryPointCount =
+    static_cast<size_t>(angle::EntryPoint::WGLUseFontOutlinesW) + 1;
+
+uint64_t GetCpuCycleCounter()
+{
+#    if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+    return __rdtsc();
+#    elif defined(_M_ARM64)
+    return _ReadStatusReg(ARM64_CNTVCT);
+#    elif defined(__aarch64__)
+    uint64_t cycles;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(cycles));
+    return cycles;
+#    else
+#        error "No cycle counter available for this architecture."
+#    endif
+}
+
+struct EntryPointCycleTable
+{
+    std::array<uint64_t, kEntryPointCount> calls  = {};
+    std::array<uint64_t, kEntryPointCount> cycles = {};
+};
+
+// Each thread accumulates into its own table to keep the entry point hot path free of atomics.
+// The registry below lets the dump aggregate over live threads; tables of exited threads are
+// folded into gRetiredEntryPointCycles.
+std::mutex gEntryPointProfileMutex;
+EntryPointCycleTable gRetiredEntryPointCycles;
+std::vector<EntryPointCycleTable *> gLiveEntryPointCycleTables;
+
+struct ThreadEntryPointCycleTable : EntryPointCycleTable
+{
+    ThreadEntryPointCycleTable()
+    {
+        std::lock_guard<std::mutex> lock(gEntryPointProfileMutex);
+        gLiveEntryPointCycleTables.push_back(this);
+    }
+    ~ThreadEntryPointCycleTable()
+    {
+        std::lock_guard<std::mutex> lock(gEntryPointProfileMutex);
+        for (size_t index = 0; index < kEntryPointCount; ++index)
+        {
+            gRetiredEntryPointCycles.calls[index] += calls[index];
+            gRetiredEntryPointCycles.cycles[index] += cycles[index];
+        }
+        gLiveEntryPointCycleTables.erase(std::find(gLiveEntryPointCycleTables.begin(),
+                                                   gLiveEntryPointCycleTables.end(), this));
+    }
+};
+
+thread_local ThreadEntryPointCycleTable gEntryPointCycleTable;
+#endif  // defined(ANGLE_ENABLE_ENTRY_POINT_CYCLE_PROFILING)
+
+#if defined(ANGLE_ENABLE_ALLOCATION_PROFILING)
+// The EntryPoint enumeration has no count entry; the WGL entry points are last.  Allocations
+// made outside any entry point are attributed to EntryPoint::Invalid.
+constexpr size_t kAllocationEntryPointCount =
+    static_cast<size_t>(angle::EntryPoint::WGLUseFontOutlinesW) + 1;
+
+struct AllocationTable
+{
+    std::array<uint64_t, kAllocationEntryPointCount> allocations = {};
+    std::array<uint64_t, kAllocationEntryPointCount> bytes       = {};
+};
+
+// Mirrors the cycle profile: per-thread tables keep the allocator hook free of contention on
+// the table itself; exited threads fold their counts into gRetiredAllocations.
+std::mutex gAllocationProfileMutex;
+AllocationTable gRetiredAllocations;
+std::vector<AllocationTable *> gLiveAllocationTables;
+
+// Allocations inside scopes marked with ANGLE_ASSERT_NO_ALLOCATIONS, keyed by the scope's name
+// literal.  Small and fixed-size so recording a violation cannot itself allocate.
+constexpr size_t kMaxNoAllocationScopes = 32;
+struct NoAllocationScopeViolations
+{
+    std::array<const char *, kMaxNoAllocationScopes> names = {};
+    std::array<uint64_t, kMaxNoAllocationScopes> counts    = {};
+};
+NoAllocationScopeViolations gNoAllocationScopeViolations;
+
+std::atomic<uint64_t> gTotalAllocations{0};
+std::atomic<uint64_t> gAllocationProfileFrames{0};
+
+struct ThreadAllocationTable : AllocationTable
+{
+    ThreadAllocationTable()
+    {
+        std::lock_guard<std::mutex> lock(gAllocationProfileMutex);
+        gLiveAllocationTables.push_back(this);
+    }
+    ~ThreadAllocationTable()
+    {
+        std::lock_guard<std::mutex> lock(gAllocationProfileMutex);
+        for (size_t index = 0; index < kAllocationEntryPointCount; ++index)
+        {
+            gRetiredAllocations.allocations[index] += allocations[index];
+            gRetiredAllocations.bytes[index] += bytes[index];
+        }
+        gLiveAllocationTables.erase(
+            std::find(gLiveAllocationTables.begin(), gLiveAllocationTables.end(), this));
+    }
+};
+
+// The allocator hook recurses when the table's registration path allocates (e.g. the vector
+// push_back); gInAllocationHook suppresses accounting during that window.
+thread_local angle::EntryPoint gCurrentAllocationEntryPoint = angle::EntryPoint::Invalid;
+thread_local uint64_t gThreadAllocationCount                = 0;
+thread_local const char *gNoAllocationScopeName             = nullptr;
+thread_local bool gInAllocationHook                         = false;
+
+ThreadAllocationTable *GetThreadAllocationTable()
+{
+    thread_local ThreadAllocationTable table;
+    return &table;
+}
+
+void RecordNoAllocationScopeViolation(const char *scopeName)
+{
+    std::lock_guard<std::mutex> lock(gAllocationProfileMutex);
+    for (size_t index = 0; index < kMaxNoAllocationScopes; ++index)
+    {
+        if (gNoAllocationScopeViolations.names[index] == scopeName ||
+            gNoAllocationScopeViolations.names[index] == nullptr)
+        {
+            gNoAllocationScopeViolations.names[index] = scopeName;
+            gNoAllocationScopeViolations.counts[index]++;
+            return;
+        }
+    }
+}
+
+#endif  // defined(ANGLE_ENABLE_ALLOCATION_PROFILING)
+
 }  // namespace
 
 namespace priv
@@ -133,6 +286,172 @@ std::mutex &GetDebugMutex()
     return *g_debugMutex;
 }
 
+#if defined(ANGLE_ENABLE_ENTRY_POINT_CYCLE_PROFILING)
+ScopedEntryPointCycleProfile::ScopedEntryPointCycleProfile(angle::EntryPoint entryPoint)
+    : mEntryPoint(entryPoint), mStartCycles(GetCpuCycleCounter())
+{}
+
+ScopedEntryPointCycleProfile::~ScopedEntryPointCycleProfile()
+{
+    const size_t index = static_cast<size_t>(mEntryPoint);
+    gEntryPointCycleTable.calls[index]++;
+    gEntryPointCycleTable.cycles[index] += GetCpuCycleCounter() - mStartCycles;
+}
+
+void DumpEntryPointCycleProfile()
+{
+    // Live threads may still be mutating their tables; a torn counter read only perturbs the
+    // profile, so no attempt is made to stop them.
+    EntryPointCycleTable total;
+    {
+        std::lock_guard<std::mutex> lock(gEntryPointProfileMutex);
+        total = gRetiredEntryPointCycles;
+        for (const EntryPointCycleTable *table : gLiveEntryPointCycleTables)
+        {
+            for (size_t index = 0; index < kEntryPointCount; ++index)
+            {
+                total.calls[index] += table->calls[index];
+                total.cycles[index] += table->cycles[index];
+            }
+        }
+    }
+
+    std::vector<size_t> ranking;
+    for (size_t index = 0; index < kEntryPointCount; ++index)
+    {
+        if (total.calls[index] != 0)
+        {
+            ranking.push_back(index);
+        }
+    }
+    std::sort(ranking.begin(), ranking.end(),
+              [&total](size_t a, size_t b) { return total.cycles[a] > total.cycles[b]; });
+
+    INFO() << "Entry point cycle profile:";
+    for (size_t index : ranking)
+    {
+        INFO() << GetEntryPointName(static_cast<angle::EntryPoint>(index)) << ": "
+               << total.calls[index] << " calls, " << total.cycles[index] << " cycles, "
+               << total.cycles[index] / total.calls[index] << " cycles/call";
+    }
+}
+#endif  // defined(ANGLE_ENABLE_ENTRY_POINT_CYCLE_PROFILING)
+
+#if defined(ANGLE_ENABLE_ALLOCATION_PROFILING)
+void RecordProfiledAllocation(size_t bytes)
+{
+    if (gInAllocationHook)
+    {
+        return;
+    }
+    gInAllocationHook = true;
+
+    ThreadAllocationTable *table = GetThreadAllocationTable();
+    const size_t index           = static_cast<size_t>(gCurrentAllocationEntryPoint);
+    table->allocations[index]++;
+    table->bytes[index] += bytes;
+    gThreadAllocationCount++;
+    gTotalAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    if (gNoAllocationScopeName != nullptr)
+    {
+        RecordNoAllocationScopeViolation(gNoAllocationScopeName);
+    }
+
+    gInAllocationHook = false;
+}
+
+ScopedEntryPointAllocationScope::ScopedEntryPointAllocationScope(angle::EntryPoint entryPoint)
+    : mPreviousEntryPoint(gCurrentAllocationEntryPoint)
+{
+    gCurrentAllocationEntryPoint = entryPoint;
+}
+
+ScopedEntryPointAllocationScope::~ScopedEntryPointAllocationScope()
+{
+    gCurrentAllocationEntryPoint = mPreviousEntryPoint;
+}
+
+ScopedAllocationAssertion::ScopedAllocationAssertion(const char *scopeName)
+    : mScopeName(scopeName), mStartAllocations(gThreadAllocationCount)
+{
+    // Nested no-allocation scopes attribute to the innermost scope.
+    gNoAllocationScopeName = scopeName;
+}
+
+ScopedAllocationAssertion::~ScopedAllocationAssertion()
+{
+    gNoAllocationScopeName = nullptr;
+    ASSERT(gThreadAllocationCount == mStartAllocations);
+}
+
+uint64_t GetAllocationProfileTotalCount()
+{
+    return gTotalAllocations.load(std::memory_order_relaxed);
+}
+
+void AdvanceAllocationProfileFrame()
+{
+    gAllocationProfileFrames.fetch_add(1, std::memory_order_relaxed);
+}
+
+void DumpAllocationProfile()
+{
+    // Live threads may still be mutating their tables; a torn counter read only perturbs the
+    // profile, so no attempt is made to stop them.
+    AllocationTable total;
+    NoAllocationScopeViolations violations;
+    {
+        std::lock_guard<std::mutex> lock(gAllocationProfileMutex);
+        total      = gRetiredAllocations;
+        violations = gNoAllocationScopeViolations;
+        for (const AllocationTable *table : gLiveAllocationTables)
+        {
+            for (size_t index = 0; index < kAllocationEntryPointCount; ++index)
+            {
+                total.allocations[index] += table->allocations[index];
+                total.bytes[index] += table->bytes[index];
+            }
+        }
+    }
+
+    std::vector<size_t> ranking;
+    for (size_t index = 0; index < kAllocationEntryPointCount; ++index)
+    {
+        if (total.allocations[index] != 0)
+        {
+            ranking.push_back(index);
+        }
+    }
+    std::sort(ranking.begin(), ranking.end(), [&total](size_t a, size_t b) {
+        return total.allocations[a] > total.allocations[b];
+    });
+
+    const uint64_t frames = gAllocationProfileFrames.load(std::memory_order_relaxed);
+    INFO() << "Allocation profile (" << GetAllocationProfileTotalCount() << " allocations, "
+           << frames << " frames):";
+    for (size_t index : ranking)
+    {
+        const angle::EntryPoint entryPoint = static_cast<angle::EntryPoint>(index);
+        const char *name                   = entryPoint == angle::EntryPoint::Invalid
+                                                 ? "(outside entry points)"
+                                                 : GetEntryPointName(entryPoint);
+        INFO() << name << ": " << total.allocations[index] << " allocations, "
+               << total.bytes[index] << " bytes"
+               << (frames != 0 ? ", " + std::to_string(total.allocations[index] / frames) +
+                                     " allocations/frame"
+                               : "");
+    }
+
+    for (size_t index = 0;
+         index < kMaxNoAllocationScopes && violations.names[index] != nullptr; ++index)
+    {
+        WARN() << "Allocations inside no-allocation scope " << violations.names[index] << ": "
+               << violations.counts[index];
+    }
+}
+#endif  // defined(ANGLE_ENABLE_ALLOCATION_PROFILING)
+
 ScopedPerfEventHelper::ScopedPerfEventHelper(gl::Context *context, angle::EntryPoint entryPoint)
     : mContext(context), mEntryPoint(entryPoint), mFunctionName(nullptr), mCalledBeginEvent(false)
 {}
@@ -347,3 +666,45 @@ priv::FmtHexHelper<DWORD, char> FmtErr(DWORD value)
 #endif  // defined(ANGLE_PLATFORM_WINDOWS)
 
 }  // namespace gl
+
+#if defined(ANGLE_ENABLE_ALLOCATION_PROFILING)
+// Global allocator shim: every heap allocation in the binary is routed through here so it can be
+// attributed to the entry point on the stack.  Sized/aligned delete overloads are not needed;
+// the unsized forms below are valid matches for them.
+void *operator new(std::size_t size)
+{
+    gl::RecordProfiledAllocation(size);
+    void *memory = std::malloc(size);
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void *operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    gl::RecordProfiledAllocation(size);
+    return std::malloc(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &tag) noexcept
+{
+    return ::operator new(size, tag);
+}
+
+void operator delete(void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void *memory) noexcept
+{
+    std::free(memory);
+}
+#endif  // defined(ANGLE_ENABLE_ALLOCATION_PROFILING)
@@ -53,6 +53,65 @@ class [[nodiscard]] ScopedPerfEventHelper : angle::NonCopyable
     bool mCalledBeginEvent;
 };
 
+#if defined(ANGLE_ENABLE_ENTRY_POINT_CYCLE_PROFILING)
+// Accumulates the enclosing entry point's call count and CPU cycle count (rdtsc on x86, cntvct
+// on ARM64) into a per-thread table, so that entry points can be ranked by the time spent in
+// them without an external profiler.  Instantiated by EVENT() in every entry point.
+class [[nodiscard]] ScopedEntryPointCycleProfile : angle::NonCopyable
+{
+  public:
+    ScopedEntryPointCycleProfile(angle::EntryPoint entryPoint);
+    ~ScopedEntryPointCycleProfile();
+
+  private:
+    const angle::EntryPoint mEntryPoint;
+    const uint64_t mStartCycles;
+};
+
+// Logs the profile aggregated over all threads, sorted by total cycles.  Called by eglTerminate.
+void DumpEntryPointCycleProfile();
+#endif  // defined(ANGLE_ENABLE_ENTRY_POINT_CYCLE_PROFILING)
+
+#if defined(ANGLE_ENABLE_ALLOCATION_PROFILING)
+// Tags heap allocations made while the enclosing entry point is on the stack, so that heap
+// traffic can be attributed per entry point.  Instantiated by EVENT() in every entry point.
+class [[nodiscard]] ScopedEntryPointAllocationScope : angle::NonCopyable
+{
+  public:
+    ScopedEntryPointAllocationScope(angle::EntryPoint entryPoint);
+    ~ScopedEntryPointAllocationScope();
+
+  private:
+    const angle::EntryPoint mPreviousEntryPoint;
+};
+
+// Marks a scope that is expected to be allocation-free.  Allocations inside the scope are
+// recorded against the scope's name for the profile dump, and trip an assertion in debug.
+class [[nodiscard]] ScopedAllocationAssertion : angle::NonCopyable
+{
+  public:
+    ScopedAllocationAssertion(const char *scopeName);
+    ~ScopedAllocationAssertion();
+
+  private:
+    const char *mScopeName;
+    const uint64_t mStartAllocations;
+};
+
+// Called by the global allocator shim for every allocation.
+void RecordProfiledAllocation(size_t bytes);
+
+// Total allocations made by the process since startup; sampled by the Vulkan perf counters.
+uint64_t GetAllocationProfileTotalCount();
+
+// Marks a frame boundary, so the dump can report per-frame averages.  Called by eglSwapBuffers.
+void AdvanceAllocationProfileFrame();
+
+// Logs allocation counts and bytes per entry point, per-frame averages, and any allocations that
+// happened inside scopes marked allocation-free.  Called by eglTerminate.
+void DumpAllocationProfile();
+#endif  // defined(ANGLE_ENABLE_ALLOCATION_PROFILING)
+
 using LogSeverity = int;
 // Note: the log severities are used to index into the array of names,
 // see g_logSeverityNames.
@@ -271,10 +330,34 @@ std::ostream &FmtHex(std::ostream &os, T value)
 #define ERR() ANGLE_LOG(ERR)
 #define FATAL() ANGLE_LOG(FATAL)
 
+// Accounts the enclosing entry point's call in the per-thread cycle tables.
+#if defined(ANGLE_ENABLE_ENTRY_POINT_CYCLE_PROFILING)
+#    define ANGLE_PROFILE_ENTRY_POINT(entryPoint)                      \
+        gl::ScopedEntryPointCycleProfile scopedEntryPointCycleProfile( \
+            angle::EntryPoint::entryPoint);
+#else
+#    define ANGLE_PROFILE_ENTRY_POINT(entryPoint)
+#endif
+
+// Attributes heap allocations made below the enclosing entry point to it, and marks scopes that
+// are expected to stay allocation-free.
+#if defined(ANGLE_ENABLE_ALLOCATION_PROFILING)
+#    define ANGLE_TRACK_ENTRY_POINT_ALLOCATIONS(entryPoint)                      \
+        gl::ScopedEntryPointAllocationScope scopedEntryPointAllocationScope(     \
+            angle::EntryPoint::entryPoint);
+#    define ANGLE_ASSERT_NO_ALLOCATIONS(scopeName) \
+        gl::ScopedAllocationAssertion scopedAllocationAssertion(scopeName);
+#else
+#    define ANGLE_TRACK_ENTRY_POINT_ALLOCATIONS(entryPoint)
+#    define ANGLE_ASSERT_NO_ALLOCATIONS(scopeName)
+#endif
+
 // A macro to log a performance event around a scope.
 #if defined(ANGLE_TRACE_ENABLED)
 #    if defined(_MSC_VER)
 #        define EVENT(context, entryPoint, message, ...)                                     \
+            ANGLE_PROFILE_ENTRY_POINT(entryPoint)                                            \
+            ANGLE_TRACK_ENTRY_POINT_ALLOCATIONS(entryPoint)                                  \
             gl::ScopedPerfEventHelper scopedPerfEventHelper##__LINE__(                       \
                 context, angle::EntryPoint::entryPoint);                                     \
             do                                                                               \
@@ -288,6 +371,8 @@ std::ostream &FmtHex(std::ostream &os, T value)
             } while (0)
 #    else
 #        define EVENT(context, entryPoint, message, ...)                                          \
+            ANGLE_PROFILE_ENTRY_POINT(entryPoint)                                                 \
+            ANGLE_TRACK_ENTRY_POINT_ALLOCATIONS(entryPoint)                                       \
             gl::ScopedPerfEventHelper scopedPerfEventHelper(context,                              \
                                                             angle::EntryPoint::entryPoint);       \
             do                                                                                    \
@@ -301,7 +386,9 @@ std::ostream &FmtHex(std::ostream &os, T value)
             } while (0)
 #    endif  // _MSC_VER
 #else
-#    define EVENT(message, ...) (void(0))
+#    define EVENT(context, entryPoint, message, ...) \
+        ANGLE_PROFILE_ENTRY_POINT(entryPoint)        \
+        ANGLE_TRACK_ENTRY_POINT_ALLOCATIONS(entryPoint)
 #endif
 
 // The state tracked by ANGLE will be validated with the driver state before each call
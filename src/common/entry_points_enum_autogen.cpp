@@ -492,6 +492,8 @@ const char *GetEntryPointName(EntryPoint ep)
             return "glBegin";
         case EntryPoint::GLBeginConditionalRender:
             return "glBeginConditionalRender";
+        case EntryPoint::GLBeginLockedDrawsANGLE:
+            return "glBeginLockedDrawsANGLE";
         case EntryPoint::GLBeginPerfMonitorAMD:
             return "glBeginPerfMonitorAMD";
         case EntryPoint::GLBeginPixelLocalStorageANGLE:
@@ -1102,6 +1104,8 @@ const char *GetEntryPointName(EntryPoint ep)
             return "glEndConditionalRender";
         case EntryPoint::GLEndList:
             return "glEndList";
+        case EntryPoint::GLEndLockedDrawsANGLE:
+            return "glEndLockedDrawsANGLE";
         case EntryPoint::GLEndPerfMonitorAMD:
             return "glEndPerfMonitorAMD";
         case EntryPoint::GLEndPixelLocalStorageANGLE:
@@ -252,6 +252,7 @@ enum class EntryPoint
     GLAttachShader,
     GLBegin,
     GLBeginConditionalRender,
+    GLBeginLockedDrawsANGLE,
     GLBeginPerfMonitorAMD,
     GLBeginPixelLocalStorageANGLE,
     GLBeginQuery,
@@ -557,6 +558,7 @@ enum class EntryPoint
     GLEnd,
     GLEndConditionalRender,
     GLEndList,
+    GLEndLockedDrawsANGLE,
     GLEndPerfMonitorAMD,
     GLEndPixelLocalStorageANGLE,
     GLEndQuery,
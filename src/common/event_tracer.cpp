@@ -4,13 +4,205 @@
 
 #include "common/event_tracer.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/angleutils.h"
 #include "common/debug.h"
+#include "common/system_utils.h"
 
 namespace angle
 {
+namespace
+{
+
+constexpr char kBuiltInTraceVarName[]      = "ANGLE_BUILTIN_TRACE";
+constexpr char kBuiltInTraceAndroidProp[]  = "debug.angle.builtin_trace";
+constexpr char kBuiltInTraceFileVarName[]  = "ANGLE_BUILTIN_TRACE_FILE";
+constexpr char kDefaultBuiltInTraceFile[]  = "angle_trace.abt";
+constexpr uint32_t kBuiltInTraceFileMagic  = 0x54474E41;  // "ANGT"
+constexpr uint32_t kBuiltInTraceCurrentVersion = 1;
+
+// Categories known at compile time.  The enabled flag for each category doubles as its id, by
+// index into this table; AddTraceEvent recovers the id from the flag pointer without any string
+// lookup.
+constexpr const char *kBuiltInTraceCategories[] = {"gpu.angle", "gpu.angle.gpu"};
+constexpr size_t kNumBuiltInTraceCategories     = ArraySize(kBuiltInTraceCategories);
+
+unsigned char gBuiltInCategoryEnabled[kNumBuiltInTraceCategories] = {};
+
+// A fixed-size event record.  Event names can be stack-allocated (the GPU event tracer formats
+// them on the fly), so they are copied rather than stored by pointer.
+struct BuiltInTraceEvent
+{
+    double timestampS;
+    char phase;
+    uint8_t categoryId;
+    char name[54];
+};
+static_assert(sizeof(BuiltInTraceEvent) == 64, "BuiltInTraceEvent should be cache-line friendly");
+
+// Per-thread ring buffer.  Only the owning thread writes; the dumper reads the write index with
+// acquire semantics, so no lock is taken on the hot path.
+class ThreadTraceBuffer : NonCopyable
+{
+  public:
+    static constexpr uint32_t kEventCount = 1 << 14;  // 1MB per thread
+
+    uint64_t threadId = 0;
+    std::atomic<uint64_t> writeIndex{0};
+    BuiltInTraceEvent events[kEventCount];
+};
+
+struct BuiltInTraceState
+{
+    std::mutex registryMutex;
+    // Buffers are never destroyed so that events from exited threads survive until the dump.
+    std::vector<std::unique_ptr<ThreadTraceBuffer>> buffers;
+    std::string outputPath;
+};
+
+BuiltInTraceState *GetBuiltInTraceState()
+{
+    static BuiltInTraceState *state = new BuiltInTraceState;
+    return state;
+}
+
+ThreadTraceBuffer *GetThreadTraceBuffer()
+{
+    thread_local ThreadTraceBuffer *buffer = []() {
+        auto owned      = std::make_unique<ThreadTraceBuffer>();
+        owned->threadId = std::hash<std::thread::id>{}(std::this_thread::get_id());
+
+        BuiltInTraceState *state = GetBuiltInTraceState();
+        std::lock_guard<std::mutex> lock(state->registryMutex);
+        state->buffers.push_back(std::move(owned));
+        return state->buffers.back().get();
+    }();
+    return buffer;
+}
+
+void AddBuiltInTraceEvent(char phase, uint8_t categoryId, const char *name)
+{
+    ThreadTraceBuffer *buffer = GetThreadTraceBuffer();
+
+    const uint64_t index    = buffer->writeIndex.load(std::memory_order_relaxed);
+    BuiltInTraceEvent &event = buffer->events[index % ThreadTraceBuffer::kEventCount];
+
+    event.timestampS = GetCurrentSystemTime();
+    event.phase      = phase;
+    event.categoryId = categoryId;
+
+    size_t nameLen = strlen(name);
+    if (nameLen >= sizeof(event.name))
+    {
+        nameLen = sizeof(event.name) - 1;
+    }
+    memcpy(event.name, name, nameLen);
+    event.name[nameLen] = '\0';
+
+    buffer->writeIndex.store(index + 1, std::memory_order_release);
+}
+
+}  // anonymous namespace
+
+bool IsBuiltInTraceEnabled()
+{
+    static const bool enabled = []() {
+        std::string var =
+            GetEnvironmentVarOrAndroidProperty(kBuiltInTraceVarName, kBuiltInTraceAndroidProp);
+        if (var != "1")
+        {
+            return false;
+        }
+
+        std::string path = GetEnvironmentVar(kBuiltInTraceFileVarName);
+        GetBuiltInTraceState()->outputPath =
+            path.empty() ? std::string(kDefaultBuiltInTraceFile) : path;
+
+        atexit(DumpBuiltInTrace);
+        return true;
+    }();
+    return enabled;
+}
+
+void DumpBuiltInTrace()
+{
+    if (!IsBuiltInTraceEnabled())
+    {
+        return;
+    }
+
+    BuiltInTraceState *state = GetBuiltInTraceState();
+    std::lock_guard<std::mutex> lock(state->registryMutex);
+
+    SaveFileHelper saveFile(state->outputPath);
+
+    auto writeUint32 = [&saveFile](uint32_t value) {
+        saveFile.write(reinterpret_cast<const uint8_t *>(&value), sizeof(value));
+    };
+    auto writeUint64 = [&saveFile](uint64_t value) {
+        saveFile.write(reinterpret_cast<const uint8_t *>(&value), sizeof(value));
+    };
+
+    writeUint32(kBuiltInTraceFileMagic);
+    writeUint32(kBuiltInTraceCurrentVersion);
+    writeUint32(sizeof(BuiltInTraceEvent));
+
+    writeUint32(static_cast<uint32_t>(kNumBuiltInTraceCategories));
+    for (const char *category : kBuiltInTraceCategories)
+    {
+        const uint32_t length = static_cast<uint32_t>(strlen(category));
+        writeUint32(length);
+        saveFile.write(reinterpret_cast<const uint8_t *>(category), length);
+    }
+
+    writeUint32(static_cast<uint32_t>(state->buffers.size()));
+    for (const std::unique_ptr<ThreadTraceBuffer> &buffer : state->buffers)
+    {
+        const uint64_t writeIndex = buffer->writeIndex.load(std::memory_order_acquire);
+        const uint64_t count      = std::min<uint64_t>(writeIndex, ThreadTraceBuffer::kEventCount);
+        const uint64_t start      = writeIndex - count;
+
+        writeUint64(buffer->threadId);
+        writeUint64(count);
+
+        // Write the ring contents oldest-first, in at most two contiguous spans.
+        const uint64_t startSlot = start % ThreadTraceBuffer::kEventCount;
+        const uint64_t firstSpan = std::min(count, ThreadTraceBuffer::kEventCount - startSlot);
+        saveFile.write(reinterpret_cast<const uint8_t *>(&buffer->events[startSlot]),
+                       firstSpan * sizeof(BuiltInTraceEvent));
+        if (firstSpan < count)
+        {
+            saveFile.write(reinterpret_cast<const uint8_t *>(&buffer->events[0]),
+                           (count - firstSpan) * sizeof(BuiltInTraceEvent));
+        }
+    }
+}
 
 const unsigned char *GetTraceCategoryEnabledFlag(PlatformMethods *platform, const char *name)
 {
+    if (IsBuiltInTraceEnabled())
+    {
+        for (size_t index = 0; index < kNumBuiltInTraceCategories; ++index)
+        {
+            if (strcmp(kBuiltInTraceCategories[index], name) == 0)
+            {
+                gBuiltInCategoryEnabled[index] = 1;
+                return &gBuiltInCategoryEnabled[index];
+            }
+        }
+
+        static unsigned char disabled = 0;
+        return &disabled;
+    }
+
     ASSERT(platform);
 
     const unsigned char *categoryEnabledFlag =
@@ -35,6 +227,18 @@ angle::TraceEventHandle AddTraceEvent(PlatformMethods *platform,
                                       const unsigned long long *argValues,
                                       unsigned char flags)
 {
+    if (IsBuiltInTraceEnabled())
+    {
+        // The category enabled flag doubles as the category id.
+        if (categoryGroupEnabled >= gBuiltInCategoryEnabled &&
+            categoryGroupEnabled < gBuiltInCategoryEnabled + kNumBuiltInTraceCategories)
+        {
+            AddBuiltInTraceEvent(
+                phase, static_cast<uint8_t>(categoryGroupEnabled - gBuiltInCategoryEnabled), name);
+        }
+        return static_cast<angle::TraceEventHandle>(0);
+    }
+
     ASSERT(platform);
 
     double timestamp = platform->monotonicallyIncreasingTime(platform);
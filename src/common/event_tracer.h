@@ -10,6 +10,15 @@
 
 namespace angle
 {
+// Built-in event tracer.  When ANGLE_BUILTIN_TRACE is set in the environment (or the
+// debug.angle.builtin_trace property on Android), trace events are recorded into per-thread
+// lock-free ring buffers instead of being forwarded to the platform callbacks, so production
+// builds can be traced without a full platform integration.  The buffers are dumped to a binary
+// file at process exit (or whenever DumpBuiltInTrace() is called), which
+// scripts/convert_builtin_trace.py converts to chrome://tracing JSON.
+bool IsBuiltInTraceEnabled();
+void DumpBuiltInTrace();
+
 const unsigned char *GetTraceCategoryEnabledFlag(PlatformMethods *platform, const char *name);
 angle::TraceEventHandle AddTraceEvent(PlatformMethods *platform,
                                       char phase,
@@ -198,6 +198,41 @@ inline bool supportsSSE2()
             supports = (info[3] >> 26) & 1;
         }
     }
+#    elif defined(__GNUC__)
+    supports = __builtin_cpu_supports("sse2");
+#    endif  // defined(ANGLE_PLATFORM_WINDOWS) && !defined(_M_ARM) && !defined(_M_ARM64)
+    checked = true;
+    return supports;
+#else  // defined(ANGLE_USE_SSE)
+    return false;
+#endif
+}
+
+inline bool supportsSSSE3()
+{
+#if defined(ANGLE_USE_SSE)
+    static bool checked  = false;
+    static bool supports = false;
+
+    if (checked)
+    {
+        return supports;
+    }
+
+#    if defined(ANGLE_PLATFORM_WINDOWS) && !defined(_M_ARM) && !defined(_M_ARM64)
+    {
+        int info[4];
+        __cpuid(info, 0);
+
+        if (info[0] >= 1)
+        {
+            __cpuid(info, 1);
+
+            supports = (info[2] >> 9) & 1;
+        }
+    }
+#    elif defined(__GNUC__)
+    supports = __builtin_cpu_supports("ssse3");
 #    endif  // defined(ANGLE_PLATFORM_WINDOWS) && !defined(_M_ARM) && !defined(_M_ARM64)
     checked = true;
     return supports;
@@ -8,9 +8,54 @@
 
 #include "common/matrix_utils.h"
 
+#include "common/platform.h"
+
 namespace angle
 {
 
+namespace
+{
+
+#if defined(ANGLE_USE_SSE) || defined(ANGLE_USE_NEON)
+// Column-major 4x4 multiply: each column of the result is a linear combination of the columns of
+// |a| weighted by the matching column of |b|.  GLES1 matrix-stack operations funnel through this,
+// so the scalar expansion is worth replacing with vector arithmetic where it is available.
+inline void MultiplyMat4Simd(const float *a, const float *b, float *out)
+{
+#    if defined(ANGLE_USE_SSE)
+    const __m128 aCol0 = _mm_loadu_ps(a + 0);
+    const __m128 aCol1 = _mm_loadu_ps(a + 4);
+    const __m128 aCol2 = _mm_loadu_ps(a + 8);
+    const __m128 aCol3 = _mm_loadu_ps(a + 12);
+
+    for (int col = 0; col < 4; col++)
+    {
+        __m128 result = _mm_mul_ps(aCol0, _mm_set1_ps(b[4 * col + 0]));
+        result        = _mm_add_ps(result, _mm_mul_ps(aCol1, _mm_set1_ps(b[4 * col + 1])));
+        result        = _mm_add_ps(result, _mm_mul_ps(aCol2, _mm_set1_ps(b[4 * col + 2])));
+        result        = _mm_add_ps(result, _mm_mul_ps(aCol3, _mm_set1_ps(b[4 * col + 3])));
+        _mm_storeu_ps(out + 4 * col, result);
+    }
+#    else
+    const float32x4_t aCol0 = vld1q_f32(a + 0);
+    const float32x4_t aCol1 = vld1q_f32(a + 4);
+    const float32x4_t aCol2 = vld1q_f32(a + 8);
+    const float32x4_t aCol3 = vld1q_f32(a + 12);
+
+    for (int col = 0; col < 4; col++)
+    {
+        float32x4_t result = vmulq_n_f32(aCol0, b[4 * col + 0]);
+        result             = vfmaq_n_f32(result, aCol1, b[4 * col + 1]);
+        result             = vfmaq_n_f32(result, aCol2, b[4 * col + 2]);
+        result             = vfmaq_n_f32(result, aCol3, b[4 * col + 3]);
+        vst1q_f32(out + 4 * col, result);
+    }
+#    endif
+}
+#endif  // defined(ANGLE_USE_SSE) || defined(ANGLE_USE_NEON)
+
+}  // anonymous namespace
+
 Mat4::Mat4() : Mat4(1.f, 0.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f)
 {}
 
@@ -243,6 +288,11 @@ Mat4 Mat4::product(const Mat4 &m)
     const float *a = mElements.data();
     const float *b = m.mElements.data();
 
+#if defined(ANGLE_USE_SSE) || defined(ANGLE_USE_NEON)
+    Mat4 result;
+    MultiplyMat4Simd(a, b, result.mElements.data());
+    return result;
+#else
     return Mat4(a[0] * b[0] + a[4] * b[1] + a[8] * b[2] + a[12] * b[3],
                 a[1] * b[0] + a[5] * b[1] + a[9] * b[2] + a[13] * b[3],
                 a[2] * b[0] + a[6] * b[1] + a[10] * b[2] + a[14] * b[3],
@@ -262,6 +312,7 @@ Mat4 Mat4::product(const Mat4 &m)
                 a[1] * b[12] + a[5] * b[13] + a[9] * b[14] + a[13] * b[15],
                 a[2] * b[12] + a[6] * b[13] + a[10] * b[14] + a[14] * b[15],
                 a[3] * b[12] + a[7] * b[13] + a[11] * b[14] + a[15] * b[15]);
+#endif
 }
 
 Vector4 Mat4::product(const Vector4 &b)
@@ -107,6 +107,13 @@
 #    define ANGLE_USE_SSE
 #endif
 
+// NEON is mandatory on aarch64; on 32-bit ARM it is not universal and float division is not
+// available as a NEON instruction, so the scalar paths are kept there.
+#if defined(__GNUC__) && defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#    include <arm_neon.h>
+#    define ANGLE_USE_NEON
+#endif
+
 // Mips and arm devices need to include stddef for size_t.
 #if defined(__mips__) || defined(__arm__) || defined(__aarch64__)
 #    include <stddef.h>
@@ -24,6 +24,236 @@
 namespace
 {
 
+#if defined(ANGLE_USE_SSE) || defined(ANGLE_USE_NEON)
+// Vector min/max scans over index data, used by ComputeTypedIndexRange when primitive restart is
+// disabled and no index needs to be filtered out.  Each overload consumes whole vectors and
+// finishes the remainder with a scalar loop.  Callers guarantee at least one full vector of data.
+inline void ScanIndexMinMaxSimd(const GLubyte *indices,
+                                size_t count,
+                                GLubyte *minOut,
+                                GLubyte *maxOut)
+{
+    constexpr size_t kLaneCount = 16;
+    ASSERT(count >= kLaneCount);
+
+#    if defined(ANGLE_USE_SSE)
+    __m128i mins = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices));
+    __m128i maxs = mins;
+
+    size_t i = kLaneCount;
+    for (; i + kLaneCount <= count; i += kLaneCount)
+    {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i));
+        mins               = _mm_min_epu8(mins, data);
+        maxs               = _mm_max_epu8(maxs, data);
+    }
+
+    GLubyte laneMins[kLaneCount];
+    GLubyte laneMaxs[kLaneCount];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(laneMins), mins);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(laneMaxs), maxs);
+
+    GLubyte minIndex = laneMins[0];
+    GLubyte maxIndex = laneMaxs[0];
+    for (size_t lane = 1; lane < kLaneCount; lane++)
+    {
+        minIndex = std::min(minIndex, laneMins[lane]);
+        maxIndex = std::max(maxIndex, laneMaxs[lane]);
+    }
+#    else
+    uint8x16_t mins = vld1q_u8(indices);
+    uint8x16_t maxs = mins;
+
+    size_t i = kLaneCount;
+    for (; i + kLaneCount <= count; i += kLaneCount)
+    {
+        const uint8x16_t data = vld1q_u8(indices + i);
+        mins                  = vminq_u8(mins, data);
+        maxs                  = vmaxq_u8(maxs, data);
+    }
+
+    GLubyte minIndex = vminvq_u8(mins);
+    GLubyte maxIndex = vmaxvq_u8(maxs);
+#    endif
+
+    for (; i < count; i++)
+    {
+        minIndex = std::min(minIndex, indices[i]);
+        maxIndex = std::max(maxIndex, indices[i]);
+    }
+
+    *minOut = minIndex;
+    *maxOut = maxIndex;
+}
+
+inline void ScanIndexMinMaxSimd(const GLushort *indices,
+                                size_t count,
+                                GLushort *minOut,
+                                GLushort *maxOut)
+{
+    constexpr size_t kLaneCount = 8;
+    ASSERT(count >= kLaneCount);
+
+#    if defined(ANGLE_USE_SSE)
+    // SSE2 only has signed 16-bit min/max; biasing both operands by 0x8000 makes the signed
+    // comparison order match the unsigned one.
+    const __m128i bias = _mm_set1_epi16(static_cast<short>(0x8000));
+
+    __m128i mins =
+        _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(indices)), bias);
+    __m128i maxs = mins;
+
+    size_t i = kLaneCount;
+    for (; i + kLaneCount <= count; i += kLaneCount)
+    {
+        const __m128i data =
+            _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i)), bias);
+        mins = _mm_min_epi16(mins, data);
+        maxs = _mm_max_epi16(maxs, data);
+    }
+
+    GLushort laneMins[kLaneCount];
+    GLushort laneMaxs[kLaneCount];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(laneMins), _mm_xor_si128(mins, bias));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(laneMaxs), _mm_xor_si128(maxs, bias));
+
+    GLushort minIndex = laneMins[0];
+    GLushort maxIndex = laneMaxs[0];
+    for (size_t lane = 1; lane < kLaneCount; lane++)
+    {
+        minIndex = std::min(minIndex, laneMins[lane]);
+        maxIndex = std::max(maxIndex, laneMaxs[lane]);
+    }
+#    else
+    uint16x8_t mins = vld1q_u16(indices);
+    uint16x8_t maxs = mins;
+
+    size_t i = kLaneCount;
+    for (; i + kLaneCount <= count; i += kLaneCount)
+    {
+        const uint16x8_t data = vld1q_u16(indices + i);
+        mins                  = vminq_u16(mins, data);
+        maxs                  = vmaxq_u16(maxs, data);
+    }
+
+    GLushort minIndex = vminvq_u16(mins);
+    GLushort maxIndex = vmaxvq_u16(maxs);
+#    endif
+
+    for (; i < count; i++)
+    {
+        minIndex = std::min(minIndex, indices[i]);
+        maxIndex = std::max(maxIndex, indices[i]);
+    }
+
+    *minOut = minIndex;
+    *maxOut = maxIndex;
+}
+
+inline void ScanIndexMinMaxSimd(const GLuint *indices, size_t count, GLuint *minOut, GLuint *maxOut)
+{
+    constexpr size_t kLaneCount = 4;
+    ASSERT(count >= kLaneCount);
+
+#    if defined(ANGLE_USE_SSE)
+    // SSE2 has no 32-bit min/max at all; select lanes with a biased signed comparison instead.
+    const __m128i bias = _mm_set1_epi32(static_cast<int>(0x80000000));
+
+    __m128i mins = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices));
+    __m128i maxs = mins;
+
+    size_t i = kLaneCount;
+    for (; i + kLaneCount <= count; i += kLaneCount)
+    {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i));
+        const __m128i biasedData = _mm_xor_si128(data, bias);
+
+        const __m128i less = _mm_cmpgt_epi32(_mm_xor_si128(mins, bias), biasedData);
+        mins = _mm_or_si128(_mm_and_si128(less, data), _mm_andnot_si128(less, mins));
+
+        const __m128i greater = _mm_cmpgt_epi32(biasedData, _mm_xor_si128(maxs, bias));
+        maxs = _mm_or_si128(_mm_and_si128(greater, data), _mm_andnot_si128(greater, maxs));
+    }
+
+    GLuint laneMins[kLaneCount];
+    GLuint laneMaxs[kLaneCount];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(laneMins), mins);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(laneMaxs), maxs);
+
+    GLuint minIndex = laneMins[0];
+    GLuint maxIndex = laneMaxs[0];
+    for (size_t lane = 1; lane < kLaneCount; lane++)
+    {
+        minIndex = std::min(minIndex, laneMins[lane]);
+        maxIndex = std::max(maxIndex, laneMaxs[lane]);
+    }
+#    else
+    uint32x4_t mins = vld1q_u32(indices);
+    uint32x4_t maxs = mins;
+
+    size_t i = kLaneCount;
+    for (; i + kLaneCount <= count; i += kLaneCount)
+    {
+        const uint32x4_t data = vld1q_u32(indices + i);
+        mins                  = vminq_u32(mins, data);
+        maxs                  = vmaxq_u32(maxs, data);
+    }
+
+    GLuint minIndex = vminvq_u32(mins);
+    GLuint maxIndex = vmaxvq_u32(maxs);
+#    endif
+
+    for (; i < count; i++)
+    {
+        minIndex = std::min(minIndex, indices[i]);
+        maxIndex = std::max(maxIndex, indices[i]);
+    }
+
+    *minOut = minIndex;
+    *maxOut = maxIndex;
+}
+#endif  // defined(ANGLE_USE_SSE) || defined(ANGLE_USE_NEON)
+
+template <class IndexType>
+void ScanIndexMinMax(const IndexType *indices, size_t count, IndexType *minOut, IndexType *maxOut)
+{
+    constexpr size_t kLaneCount = 16 / sizeof(IndexType);
+
+#if defined(ANGLE_USE_SSE)
+    if (count >= kLaneCount && gl::supportsSSE2())
+    {
+        ScanIndexMinMaxSimd(indices, count, minOut, maxOut);
+        return;
+    }
+#elif defined(ANGLE_USE_NEON)
+    if (count >= kLaneCount)
+    {
+        ScanIndexMinMaxSimd(indices, count, minOut, maxOut);
+        return;
+    }
+#else
+    ANGLE_UNUSED_VARIABLE(kLaneCount);
+#endif
+
+    IndexType minIndex = indices[0];
+    IndexType maxIndex = indices[0];
+
+    for (size_t i = 1; i < count; i++)
+    {
+        if (minIndex > indices[i])
+        {
+            minIndex = indices[i];
+        }
+        if (maxIndex < indices[i])
+        {
+            maxIndex = indices[i];
+        }
+    }
+
+    *minOut = minIndex;
+    *maxOut = maxIndex;
+}
+
 template <class IndexType>
 gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
                                       size_t count,
@@ -46,12 +276,12 @@ gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
             {
                 minIndex = indices[i];
                 maxIndex = indices[i];
-                nonPrimitiveRestartIndices++;
                 break;
             }
         }
 
-        // Loop over the rest of the indices
+        // Loop over the rest of the indices, starting over at the initializing index so it is
+        // counted exactly once.
         for (; i < count; i++)
         {
             if (indices[i] != primitiveRestartIndex)
@@ -70,21 +300,8 @@ gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
     }
     else
     {
-        minIndex                   = indices[0];
-        maxIndex                   = indices[0];
+        ScanIndexMinMax(indices, count, &minIndex, &maxIndex);
         nonPrimitiveRestartIndices = count;
-
-        for (size_t i = 1; i < count; i++)
-        {
-            if (minIndex > indices[i])
-            {
-                minIndex = indices[i];
-            }
-            if (maxIndex < indices[i])
-            {
-                maxIndex = indices[i];
-            }
-        }
     }
 
     return gl::IndexRange(static_cast<size_t>(minIndex), static_cast<size_t>(maxIndex),
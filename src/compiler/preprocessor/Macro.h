@@ -7,9 +7,9 @@
 #ifndef COMPILER_PREPROCESSOR_MACRO_H_
 #define COMPILER_PREPROCESSOR_MACRO_H_
 
-#include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace angle
@@ -44,7 +44,10 @@ struct Macro
     Replacements replacements;
 };
 
-typedef std::map<std::string, std::shared_ptr<Macro>> MacroSet;
+// The macro set is probed for every identifier token that comes out of the tokenizer, so macro
+// lookup is on the critical path of preprocessing; it is never iterated, only probed and updated
+// by name.
+typedef std::unordered_map<std::string, std::shared_ptr<Macro>> MacroSet;
 
 void PredefineMacro(MacroSet *macroSet, const char *name, int value);
 
@@ -171,7 +171,10 @@ class CallDAG::CallDAGCreator : public TIntermTraverser
 
         InitResult result = INITDAG_SUCCESS;
 
-        std::stringstream errorStream = sh::InitializeStream<std::stringstream>();
+        // Only remember which function triggered the failure here; the error message itself is
+        // built after the loop.  This function runs once per function in the shader, so the
+        // success path shouldn't pay for constructing a stream that is almost never used.
+        CreatorFunctionData *errorFunction = nullptr;
 
         while (!functionsToProcess.empty())
         {
@@ -189,9 +192,8 @@ class CallDAG::CallDAGCreator : public TIntermTraverser
 
             if (!function->definitionNode)
             {
-                errorStream << "Undefined function '" << function->name
-                            << "()' used in the following call chain:";
-                result = INITDAG_UNDEFINED;
+                errorFunction = function;
+                result        = INITDAG_UNDEFINED;
                 break;
             }
 
@@ -211,7 +213,6 @@ class CallDAG::CallDAGCreator : public TIntermTraverser
                 // in the chain printed in the info log.
                 if (callee->visiting)
                 {
-                    errorStream << "Recursive function call in the following call chain:";
                     result = INITDAG_RECURSION;
                     break;
                 }
@@ -226,6 +227,18 @@ class CallDAG::CallDAGCreator : public TIntermTraverser
         // The call chain is made of the function we were visiting when the error was detected.
         if (result != INITDAG_SUCCESS)
         {
+            std::stringstream errorStream = sh::InitializeStream<std::stringstream>();
+            if (result == INITDAG_UNDEFINED)
+            {
+                errorStream << "Undefined function '" << errorFunction->name
+                            << "()' used in the following call chain:";
+            }
+            else
+            {
+                ASSERT(result == INITDAG_RECURSION);
+                errorStream << "Recursive function call in the following call chain:";
+            }
+
             bool first = true;
             for (auto function : functionsToProcess)
             {
@@ -181,6 +181,10 @@ class CollectVariablesTraverser : public TIntermTraverser
 
     std::map<std::string, ShaderVariable *> mInterfaceBlockFields;
 
+    // Records the symbols already processed by visitSymbol so that repeated references to the
+    // same variable skip the linear searches over the collected variable lists.
+    std::set<int> mReferencedSymbols;
+
     // Shader uniforms
     bool mDepthRangeAdded;
     bool mNumSamplesAdded;
@@ -409,6 +413,13 @@ void CollectVariablesTraverser::visitSymbol(TIntermSymbol *symbol)
         return;
     }
 
+    // Everything below is idempotent per variable, so only the first reference to each variable
+    // needs to be processed.
+    if (!mReferencedSymbols.insert(symbol->variable().uniqueId().get()).second)
+    {
+        return;
+    }
+
     ShaderVariable *var = nullptr;
 
     const ImmutableString &symbolName = symbol->getName();
@@ -36,18 +36,11 @@ ImmutableString HashName(const ImmutableString &name, ShHashFunction64 hashFunct
     return hashedName;
 }
 
-void AddToNameMapIfNotMapped(const ImmutableString &name,
-                             const ImmutableString &hashedName,
-                             NameMap *nameMap)
+// Callers have already checked that |name| is not in the map.
+void AddToNameMap(const ImmutableString &name, const ImmutableString &hashedName, NameMap *nameMap)
 {
     if (nameMap)
     {
-        NameMap::const_iterator it = nameMap->find(name.data());
-        if (it != nameMap->end())
-        {
-            // (How bout returning?)
-            return;
-        }
         (*nameMap)[name.data()] = hashedName.data();
     }
 }
@@ -60,6 +53,18 @@ ImmutableString HashName(const ImmutableString &name,
 {
     const ImmutableString kUnhashedNamePrefix(kUserDefinedNamePrefix);
 
+    // Names get hashed once per occurrence in the output, so consult the map first; each unique
+    // name then only pays for building the hashed string (and calling back into a user-provided
+    // hash function) once per compile.
+    if (nameMap)
+    {
+        NameMap::const_iterator it = nameMap->find(name.data());
+        if (it != nameMap->end())
+        {
+            return ImmutableString(it->second);
+        }
+    }
+
     if (hashFunction == nullptr)
     {
         if (name.length() + kUnhashedNamePrefix.length() > kESSLMaxIdentifierLength)
@@ -72,13 +77,13 @@ ImmutableString HashName(const ImmutableString &name,
         ImmutableStringBuilder prefixedName(kUnhashedNamePrefix.length() + name.length());
         prefixedName << kUnhashedNamePrefix << name;
         ImmutableString res = prefixedName;
-        AddToNameMapIfNotMapped(name, res, nameMap);
+        AddToNameMap(name, res, nameMap);
         return res;
     }
 
     // Has a hash function
     ImmutableString hashedName = HashName(name, hashFunction);
-    AddToNameMapIfNotMapped(name, hashedName, nameMap);
+    AddToNameMap(name, hashedName, nameMap);
     return hashedName;
 }
 
@@ -6,6 +6,8 @@
 
 #include "compiler/translator/InfoSink.h"
 
+#include <algorithm>
+
 #include "compiler/translator/ImmutableString.h"
 #include "compiler/translator/Symbol.h"
 #include "compiler/translator/Types.h"
@@ -13,63 +15,97 @@
 namespace sh
 {
 
+void TInfoSinkBase::append(const char *str, size_t length)
+{
+    if (length == 0)
+    {
+        return;
+    }
+    // Start a new chunk rather than letting the current one reallocate.
+    if (chunks.empty() || chunks.back().size() + length > chunks.back().capacity())
+    {
+        TPersistString chunk;
+        chunk.reserve(std::max(length, nextChunkSize));
+        nextChunkSize = std::min(nextChunkSize * 2, kMaxChunkSize);
+        chunks.push_back(std::move(chunk));
+    }
+    chunks.back().append(str, length);
+}
+
+void TInfoSinkBase::flatten() const
+{
+    if (chunks.empty())
+    {
+        return;
+    }
+    size_t total = sink.size();
+    for (const TPersistString &chunk : chunks)
+    {
+        total += chunk.size();
+    }
+    sink.reserve(total);
+    for (const TPersistString &chunk : chunks)
+    {
+        sink.append(chunk);
+    }
+    chunks.clear();
+}
+
 void TInfoSinkBase::prefix(Severity severity)
 {
     switch (severity)
     {
         case SH_WARNING:
-            sink.append("WARNING: ");
+            *this << "WARNING: ";
             break;
         case SH_ERROR:
-            sink.append("ERROR: ");
+            *this << "ERROR: ";
             break;
         default:
-            sink.append("UNKOWN ERROR: ");
+            *this << "UNKOWN ERROR: ";
             break;
     }
 }
 
 TInfoSinkBase &TInfoSinkBase::operator<<(const ImmutableString &str)
 {
-    sink.append(str.data());
+    append(str.data(), str.length());
     return *this;
 }
 
 TInfoSinkBase &TInfoSinkBase::operator<<(const TType &type)
 {
     if (type.isInvariant())
-        sink.append("invariant ");
+        *this << "invariant ";
     if (type.getQualifier() != EvqTemporary && type.getQualifier() != EvqGlobal)
     {
-        sink.append(type.getQualifierString());
-        sink.append(" ");
+        *this << type.getQualifierString() << " ";
     }
     if (type.getPrecision() != EbpUndefined)
     {
-        sink.append(type.getPrecisionString());
-        sink.append(" ");
+        *this << type.getPrecisionString() << " ";
     }
 
     const TMemoryQualifier &memoryQualifier = type.getMemoryQualifier();
     if (memoryQualifier.readonly)
     {
-        sink.append("readonly ");
+        *this << "readonly ";
     }
     if (memoryQualifier.writeonly)
     {
-        sink.append("writeonly ");
+        *this << "writeonly ";
     }
     if (memoryQualifier.coherent)
     {
-        sink.append("coherent ");
+        *this << "coherent ";
     }
     if (memoryQualifier.restrictQualifier)
     {
-        sink.append("restrict ");
+        *this << "restrict ";
     }
     if (memoryQualifier.volatileQualifier)
     {
-        sink.append("volatile ");
+        *this << "volatile ";
     }
 
     if (type.isArray())
@@ -88,7 +124,7 @@ TInfoSinkBase &TInfoSinkBase::operator<<(const TType &type)
     else if (type.isVector())
         *this << static_cast<uint32_t>(type.getNominalSize()) << "-component vector of ";
 
-    sink.append(type.getBasicString());
+    *this << type.getBasicString();
 
     if (type.getStruct() != nullptr)
     {
@@ -118,7 +154,7 @@ void TInfoSinkBase::location(int file, int line)
         stream << file << ":? ";
     stream << ": ";
 
-    sink.append(stream.str());
+    *this << stream.str();
 }
 
 }  // namespace sh
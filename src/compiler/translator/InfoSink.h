@@ -9,6 +9,7 @@
 
 #include <math.h>
 #include <stdlib.h>
+#include <string.h>
 #include "GLSLANG/ShaderLang.h"
 #include "compiler/translator/Common.h"
 #include "compiler/translator/Severity.h"
@@ -34,6 +35,11 @@ class ImmutableString;
 // The methods are a general set of tools for getting a variety of
 // messages and types inserted into the log.
 //
+// Output is accumulated in a list of fixed-capacity chunks and only gathered
+// into one contiguous string when str() or c_str() is called.  This keeps
+// appends O(1) without repeatedly reallocating and copying a growing buffer,
+// which dominates when emitting large translated shaders.
+//
 class TInfoSinkBase
 {
   public:
@@ -44,29 +50,30 @@ class TInfoSinkBase
     {
         TPersistStringStream stream = sh::InitializeStream<TPersistStringStream>();
         stream << t;
-        sink.append(stream.str());
+        TPersistString str = stream.str();
+        append(str.data(), str.size());
         return *this;
     }
     // Override << operator for specific types. It is faster to append strings
     // and characters directly to the sink.
     TInfoSinkBase &operator<<(char c)
     {
-        sink.append(1, c);
+        append(&c, 1);
         return *this;
     }
     TInfoSinkBase &operator<<(const char *str)
     {
-        sink.append(str);
+        append(str, strlen(str));
         return *this;
     }
     TInfoSinkBase &operator<<(const TPersistString &str)
     {
-        sink.append(str);
+        append(str.data(), str.size());
         return *this;
     }
     TInfoSinkBase &operator<<(const TString &str)
     {
-        sink.append(str.c_str());
+        append(str.data(), str.size());
         return *this;
     }
     TInfoSinkBase &operator<<(const ImmutableString &str);
@@ -93,32 +100,48 @@ class TInfoSinkBase
             stream.precision(8);
             stream << f;
         }
-        sink.append(stream.str());
+        TPersistString str = stream.str();
+        append(str.data(), str.size());
         return *this;
     }
     // Write boolean values as their names instead of integral value.
     TInfoSinkBase &operator<<(bool b)
     {
-        const char *str = b ? "true" : "false";
-        sink.append(str);
+        *this << (b ? "true" : "false");
         return *this;
     }
 
     void erase()
     {
         sink.clear();
+        chunks.clear();
+        nextChunkSize = kMinChunkSize;
         binarySink.clear();
     }
-    int size() { return static_cast<int>(isBinary() ? binarySink.size() : sink.size()); }
+    int size()
+    {
+        if (isBinary())
+        {
+            return static_cast<int>(binarySink.size());
+        }
+        size_t total = sink.size();
+        for (const TPersistString &chunk : chunks)
+        {
+            total += chunk.size();
+        }
+        return static_cast<int>(total);
+    }
 
     const TPersistString &str() const
     {
         ASSERT(!isBinary());
+        flatten();
         return sink;
     }
     const char *c_str() const
     {
         ASSERT(!isBinary());
+        flatten();
         return sink.c_str();
     }
 
@@ -134,8 +157,21 @@ class TInfoSinkBase
     }
 
   private:
-    // The data in the info sink is either in human readable form (|sink|) or binary (|binarySink|).
-    TPersistString sink;
+    // Chunks grow geometrically between these bounds so that small logs stay
+    // small while large object code uses few, large chunks.
+    static constexpr size_t kMinChunkSize = 4096;
+    static constexpr size_t kMaxChunkSize = 256 * 1024;
+
+    void append(const char *str, size_t length);
+    // Gathers all pending chunks into |sink| with a single reserve.  Chunks
+    // appended after a flatten simply queue up behind the flattened prefix.
+    void flatten() const;
+
+    // The data in the info sink is either in human readable form (|sink| plus any not yet
+    // flattened |chunks|) or binary (|binarySink|).
+    mutable TPersistString sink;
+    mutable std::vector<TPersistString> chunks;
+    size_t nextChunkSize = kMinChunkSize;
     BinaryBlob binarySink;
 };
 
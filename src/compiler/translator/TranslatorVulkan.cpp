@@ -76,6 +76,19 @@ bool IsDefaultUniform(const TType &type)
            !IsOpaqueType(type.getBasicType());
 }
 
+template <typename Variable>
+bool AnyVariableInactive(const std::vector<Variable> &variables)
+{
+    for (const Variable &variable : variables)
+    {
+        if (!variable.active)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 class ReplaceDefaultUniformsTraverser : public TIntermTraverser
 {
   public:
@@ -692,6 +705,8 @@ bool TranslatorVulkan::translateImpl(TInfoSinkBase &sink,
     int aggregateTypesUsedForUniforms = 0;
     int r32fImageCount                = 0;
     int atomicCounterCount            = 0;
+    int opaqueUniformCount            = 0;
+    int arrayOfArrayOfOpaqueCount     = 0;
     for (const auto &uniform : getUniforms())
     {
         if (!uniform.isBuiltIn() && uniform.active && !gl::IsOpaqueType(uniform.type))
@@ -704,6 +719,15 @@ bool TranslatorVulkan::translateImpl(TInfoSinkBase &sink,
             ++aggregateTypesUsedForUniforms;
         }
 
+        if (gl::IsOpaqueType(uniform.type))
+        {
+            ++opaqueUniformCount;
+            if (uniform.isArrayOfArrays())
+            {
+                ++arrayOfArrayOfOpaqueCount;
+            }
+        }
+
         if (uniform.active && gl::IsImageType(uniform.type) && uniform.imageUnitFormat == GL_R32F)
         {
             ++r32fImageCount;
@@ -715,15 +739,26 @@ bool TranslatorVulkan::translateImpl(TInfoSinkBase &sink,
         }
     }
 
+    // Structs may contain samplers, so opaque uniforms can also appear once struct uniforms are
+    // broken up.  A number of the transformations below are only concerned with opaque types; the
+    // corresponding traversals are skipped altogether when this shows they would find nothing.
+    const bool mayHaveOpaqueUniforms = opaqueUniformCount > 0 || aggregateTypesUsedForUniforms > 0;
+
     // Remove declarations of inactive shader interface variables so glslang wrapper doesn't need to
     // replace them.  Note that currently, CollectVariables marks every field of an active uniform
     // that's of struct type as active, i.e. no extracted sampler is inactive, so this can be done
-    // before extracting samplers from structs.
-    if (!RemoveInactiveInterfaceVariables(this, root, &getSymbolTable(), getAttributes(),
-                                          getInputVaryings(), getOutputVariables(), getUniforms(),
-                                          getInterfaceBlocks(), true))
+    // before extracting samplers from structs.  When everything is active, the traversal would not
+    // remove anything and is skipped.
+    if (AnyVariableInactive(getAttributes()) || AnyVariableInactive(getInputVaryings()) ||
+        AnyVariableInactive(getOutputVariables()) || AnyVariableInactive(getUniforms()) ||
+        AnyVariableInactive(getInterfaceBlocks()))
     {
-        return false;
+        if (!RemoveInactiveInterfaceVariables(this, root, &getSymbolTable(), getAttributes(),
+                                              getInputVaryings(), getOutputVariables(),
+                                              getUniforms(), getInterfaceBlocks(), true))
+        {
+            return false;
+        }
     }
 
     // If there are any function calls that take array-of-array of opaque uniform parameters, or
@@ -736,14 +771,20 @@ bool TranslatorVulkan::translateImpl(TInfoSinkBase &sink,
     // - It dramatically simplifies future transformations w.r.t to samplers in structs, array of
     //   arrays of opaque types, atomic counters etc.
     // - Avoids the need for shader*ArrayDynamicIndexing Vulkan features.
-    UnsupportedFunctionArgsBitSet args{UnsupportedFunctionArgs::StructContainingSamplers,
-                                       UnsupportedFunctionArgs::ArrayOfArrayOfSamplerOrImage,
-                                       UnsupportedFunctionArgs::AtomicCounter,
-                                       UnsupportedFunctionArgs::SamplerCubeEmulation,
-                                       UnsupportedFunctionArgs::Image};
-    if (!MonomorphizeUnsupportedFunctions(this, root, &getSymbolTable(), compileOptions, args))
+    //
+    // Every unsupported argument kind involves an opaque type, so shaders without opaque uniforms
+    // have nothing to monomorphize.
+    if (mayHaveOpaqueUniforms)
     {
-        return false;
+        UnsupportedFunctionArgsBitSet args{UnsupportedFunctionArgs::StructContainingSamplers,
+                                           UnsupportedFunctionArgs::ArrayOfArrayOfSamplerOrImage,
+                                           UnsupportedFunctionArgs::AtomicCounter,
+                                           UnsupportedFunctionArgs::SamplerCubeEmulation,
+                                           UnsupportedFunctionArgs::Image};
+        if (!MonomorphizeUnsupportedFunctions(this, root, &getSymbolTable(), compileOptions, args))
+        {
+            return false;
+        }
     }
 
     if (aggregateTypesUsedForUniforms > 0)
@@ -764,10 +805,14 @@ bool TranslatorVulkan::translateImpl(TInfoSinkBase &sink,
 
     // Replace array of array of opaque uniforms with a flattened array.  This is run after
     // MonomorphizeUnsupportedFunctions and RewriteStructSamplers so that it's not possible for an
-    // array of array of opaque type to be partially subscripted and passed to a function.
-    if (!RewriteArrayOfArrayOfOpaqueUniforms(this, root, &getSymbolTable()))
+    // array of array of opaque type to be partially subscripted and passed to a function.  Struct
+    // rewriting can extract new array-of-array samplers, so aggregate uniforms keep this enabled.
+    if (arrayOfArrayOfOpaqueCount > 0 || aggregateTypesUsedForUniforms > 0)
     {
-        return false;
+        if (!RewriteArrayOfArrayOfOpaqueUniforms(this, root, &getSymbolTable()))
+        {
+            return false;
+        }
     }
 
     // Rewrite samplerCubes as sampler2DArrays.  This must be done after rewriting struct samplers
@@ -781,9 +826,14 @@ bool TranslatorVulkan::translateImpl(TInfoSinkBase &sink,
         }
     }
 
-    if (!FlagSamplersForTexelFetch(this, root, &getSymbolTable(), &mUniforms))
+    // texelFetch can only be flagged on sampler uniforms, so the traversal is skipped when the
+    // shader can't have any.
+    if (mayHaveOpaqueUniforms)
     {
-        return false;
+        if (!FlagSamplersForTexelFetch(this, root, &getSymbolTable(), &mUniforms))
+        {
+            return false;
+        }
     }
 
     gl::ShaderType packedShaderType = gl::FromGLenum<gl::ShaderType>(getShaderType());
@@ -8,6 +8,8 @@
 
 #include "compiler/translator/tree_ops/ClampIndirectIndices.h"
 
+#include <limits>
+
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/StaticType.h"
 #include "compiler/translator/SymbolTable.h"
@@ -18,8 +20,240 @@ namespace sh
 {
 namespace
 {
+// Known value range of a canonical for-loop induction variable, used to prove indices in bounds.
+struct InductionVarRange
+{
+    int symbolId;
+    int min;
+    int max;
+};
+
+// Returns the value of a scalar integer constant, if the node is one.
+bool GetConstInt(TIntermTyped *node, int *valueOut)
+{
+    TIntermConstantUnion *constant = node->getAsConstantUnion();
+    if (constant == nullptr || !constant->getType().isScalarInt())
+    {
+        return false;
+    }
+
+    if (constant->getBasicType() == EbtInt)
+    {
+        *valueOut = constant->getIConst(0);
+        return true;
+    }
+
+    const unsigned int value = constant->getUConst(0);
+    if (value > static_cast<unsigned int>(std::numeric_limits<int>::max()))
+    {
+        return false;
+    }
+    *valueOut = static_cast<int>(value);
+    return true;
+}
+
+// Traverser that determines whether a variable is statically assigned anywhere in a subtree,
+// including through out/inout function arguments.
+class IsVariableWrittenTraverser : public TLValueTrackingTraverser
+{
+  public:
+    IsVariableWrittenTraverser(int symbolId, TSymbolTable *symbolTable)
+        : TLValueTrackingTraverser(true, false, false, symbolTable),
+          mSymbolId(symbolId),
+          mWritten(false)
+    {}
+
+    bool isWritten() const { return mWritten; }
+
+    void visitSymbol(TIntermSymbol *symbol) override
+    {
+        if (symbol->uniqueId().get() == mSymbolId && isLValueRequiredHere())
+        {
+            mWritten = true;
+        }
+    }
+
+  private:
+    int mSymbolId;
+    bool mWritten;
+};
+
+// Derives the value range of the induction variable of a canonical for loop:
+//
+//     for (int i = constant; i <op> constant; i++/i--/i += constant/i -= constant)
+//
+// This mirrors the loop shape ValidateLimitations enforces for WebGL 1 shaders, but is applied
+// opportunistically; loops not matching the pattern (or whose induction variable is assigned in
+// the loop body) simply yield no range.
+bool DeriveInductionVarRange(TIntermLoop *loop,
+                             TSymbolTable *symbolTable,
+                             InductionVarRange *rangeOut)
+{
+    if (loop->getType() != ELoopFor || loop->getInit() == nullptr ||
+        loop->getCondition() == nullptr || loop->getExpression() == nullptr ||
+        loop->getBody() == nullptr)
+    {
+        return false;
+    }
+
+    // init: a single declaration of a scalar int with a constant initializer.
+    TIntermDeclaration *decl = loop->getInit()->getAsDeclarationNode();
+    if (decl == nullptr || decl->getSequence()->size() != 1)
+    {
+        return false;
+    }
+    TIntermBinary *declInit = (*decl->getSequence())[0]->getAsBinaryNode();
+    if (declInit == nullptr || declInit->getOp() != EOpInitialize)
+    {
+        return false;
+    }
+    TIntermSymbol *symbol = declInit->getLeft()->getAsSymbolNode();
+    int initValue         = 0;
+    if (symbol == nullptr || symbol->getBasicType() != EbtInt ||
+        !GetConstInt(declInit->getRight(), &initValue))
+    {
+        return false;
+    }
+
+    // condition: the induction variable compared against a constant.
+    TIntermBinary *cond = loop->getCondition()->getAsBinaryNode();
+    if (cond == nullptr)
+    {
+        return false;
+    }
+    TIntermSymbol *condSymbol = cond->getLeft()->getAsSymbolNode();
+    int limitValue            = 0;
+    if (condSymbol == nullptr || condSymbol->uniqueId() != symbol->uniqueId() ||
+        !GetConstInt(cond->getRight(), &limitValue))
+    {
+        return false;
+    }
+
+    // expression: increment or decrement of the induction variable, possibly by a constant.
+    TIntermUnary *unOp    = loop->getExpression()->getAsUnaryNode();
+    TIntermBinary *binOp  = unOp != nullptr ? nullptr : loop->getExpression()->getAsBinaryNode();
+    TIntermSymbol *exprSymbol = nullptr;
+    int step                  = 0;
+    if (unOp != nullptr)
+    {
+        switch (unOp->getOp())
+        {
+            case EOpPostIncrement:
+            case EOpPreIncrement:
+                step = 1;
+                break;
+            case EOpPostDecrement:
+            case EOpPreDecrement:
+                step = -1;
+                break;
+            default:
+                return false;
+        }
+        exprSymbol = unOp->getOperand()->getAsSymbolNode();
+    }
+    else if (binOp != nullptr)
+    {
+        int stepValue = 0;
+        if (!GetConstInt(binOp->getRight(), &stepValue))
+        {
+            return false;
+        }
+        // Negating INT_MIN below would overflow.
+        if (stepValue == std::numeric_limits<int>::min())
+        {
+            return false;
+        }
+        switch (binOp->getOp())
+        {
+            case EOpAddAssign:
+                step = stepValue;
+                break;
+            case EOpSubAssign:
+                step = -stepValue;
+                break;
+            default:
+                return false;
+        }
+        exprSymbol = binOp->getLeft()->getAsSymbolNode();
+    }
+    else
+    {
+        return false;
+    }
+    if (exprSymbol == nullptr || exprSymbol->uniqueId() != symbol->uniqueId() || step == 0)
+    {
+        return false;
+    }
+
+    // Derive the inclusive range, done in 64 bits to sidestep overflow on pathological bounds.
+    int64_t minValue = 0;
+    int64_t maxValue = 0;
+    if (step > 0)
+    {
+        minValue = initValue;
+        switch (cond->getOp())
+        {
+            case EOpLessThan:
+                maxValue = static_cast<int64_t>(limitValue) - 1;
+                break;
+            case EOpLessThanEqual:
+                maxValue = limitValue;
+                break;
+            default:
+                return false;
+        }
+    }
+    else
+    {
+        maxValue = initValue;
+        switch (cond->getOp())
+        {
+            case EOpGreaterThan:
+                minValue = static_cast<int64_t>(limitValue) + 1;
+                break;
+            case EOpGreaterThanEqual:
+                minValue = limitValue;
+                break;
+            default:
+                return false;
+        }
+    }
+    if (minValue > maxValue)
+    {
+        // The loop body never executes; no point tracking a range.
+        return false;
+    }
+
+    // The range only holds if stepping from any in-range value cannot wrap around: GLSL ES
+    // defines signed overflow as wraparound, so a wrapped induction variable passes the loop
+    // condition again with a value outside the derived range (e.g. i += large wraps to a
+    // negative value that still satisfies i < limit, or i <= INT_MAX wraps past the limit).
+    if (step > 0 && maxValue + step > std::numeric_limits<int>::max())
+    {
+        return false;
+    }
+    if (step < 0 && minValue + step < std::numeric_limits<int>::min())
+    {
+        return false;
+    }
+
+    // The range only holds if the induction variable is not assigned inside the loop body.
+    IsVariableWrittenTraverser writtenCheck(symbol->uniqueId().get(), symbolTable);
+    loop->getBody()->traverse(&writtenCheck);
+    if (writtenCheck.isWritten())
+    {
+        return false;
+    }
+
+    rangeOut->symbolId = symbol->uniqueId().get();
+    rangeOut->min = static_cast<int>(std::max<int64_t>(minValue, std::numeric_limits<int>::min()));
+    rangeOut->max = static_cast<int>(std::min<int64_t>(maxValue, std::numeric_limits<int>::max()));
+    return true;
+}
+
 // Traverser that finds EOpIndexIndirect nodes and applies a clamp to their right-hand side
-// expression.
+// expression.  Indices that are provably in bounds -- constants and canonical loop induction
+// variables with known bounds -- are left unclamped.
 class ClampIndirectIndicesTraverser : public TIntermTraverser
 {
   public:
@@ -27,6 +261,44 @@ class ClampIndirectIndicesTraverser : public TIntermTraverser
         : TIntermTraverser(true, false, false, symbolTable), mCompiler(compiler)
     {}
 
+    bool visitLoop(Visit visit, TIntermLoop *node) override
+    {
+        ASSERT(visit == PreVisit);
+
+        // Visit the loop header without the induction variable's range in scope; at the condition
+        // and expression the variable may hold its exiting value.
+        if (node->getInit() != nullptr)
+        {
+            node->getInit()->traverse(this);
+        }
+        if (node->getCondition() != nullptr)
+        {
+            node->getCondition()->traverse(this);
+        }
+        if (node->getExpression() != nullptr)
+        {
+            node->getExpression()->traverse(this);
+        }
+
+        InductionVarRange range = {};
+        const bool hasRange     = DeriveInductionVarRange(node, mSymbolTable, &range);
+        if (hasRange)
+        {
+            mInductionVarRanges.push_back(range);
+        }
+        if (node->getBody() != nullptr)
+        {
+            node->getBody()->traverse(this);
+        }
+        if (hasRange)
+        {
+            mInductionVarRanges.pop_back();
+        }
+
+        // The loop is fully processed - no need to visit children.
+        return false;
+    }
+
     bool visitBinary(Visit visit, TIntermBinary *node) override
     {
         ASSERT(visit == PreVisit);
@@ -37,6 +309,28 @@ class ClampIndirectIndicesTraverser : public TIntermTraverser
             return true;
         }
 
+        const TType &leftType = node->getLeft()->getType();
+
+        // Don't clamp indirect indices on unsized arrays in buffer blocks.  They are covered by the
+        // relevant robust access behavior of the backend.
+        if (leftType.isUnsizedArray())
+        {
+            return true;
+        }
+
+        // If the index is provably within bounds, the clamp is unnecessary; continue into the
+        // children normally.
+        const int maxIndex = leftType.isArray()
+                                 ? static_cast<int>(leftType.getOutermostArraySize()) - 1
+                                 : leftType.getNominalSize() - 1;
+        int indexMin       = 0;
+        int indexMax       = 0;
+        if (getIndexRange(node->getRight(), &indexMin, &indexMax) && indexMin >= 0 &&
+            indexMax <= maxIndex)
+        {
+            return true;
+        }
+
         // Apply the transformation to the left and right nodes
         bool valid = ClampIndirectIndices(mCompiler, node->getLeft(), mSymbolTable);
         ASSERT(valid);
@@ -45,16 +339,8 @@ class ClampIndirectIndicesTraverser : public TIntermTraverser
 
         // Generate clamp(right, 0, N), where N is the size of the array being indexed minus 1.  If
         // the array is runtime-sized, the length() method is called on it.
-        const TType &leftType  = node->getLeft()->getType();
         const TType &rightType = node->getRight()->getType();
 
-        // Don't clamp indirect indices on unsized arrays in buffer blocks.  They are covered by the
-        // relevant robust access behavior of the backend.
-        if (leftType.isUnsizedArray())
-        {
-            return true;
-        }
-
         // On GLSL es 100, clamp is only defined for float, so float arguments are used.
         //
         // However, float clamp is unconditionally emitted to workaround driver bugs with integer
@@ -63,20 +349,14 @@ class ClampIndirectIndicesTraverser : public TIntermTraverser
         // const bool useFloatClamp = mCompiler->getShaderVersion() == 100;
         const bool useFloatClamp = true;
 
-        TIntermConstantUnion *zero = createClampValue(0, useFloatClamp);
-        TIntermTyped *max;
-
-        if (leftType.isArray())
-        {
-            max = createClampValue(static_cast<int>(leftType.getOutermostArraySize()) - 1,
-                                   useFloatClamp);
-        }
-        else
+        if (!leftType.isArray())
         {
             ASSERT(leftType.isVector() || leftType.isMatrix());
-            max = createClampValue(leftType.getNominalSize() - 1, useFloatClamp);
         }
 
+        TIntermConstantUnion *zero = createClampValue(0, useFloatClamp);
+        TIntermTyped *max          = createClampValue(maxIndex, useFloatClamp);
+
         TIntermTyped *index = node->getRight();
         // If the index node is not an int (i.e. it's a uint), or a float (if using float clamp),
         // cast it.
@@ -122,7 +402,37 @@ class ClampIndirectIndicesTraverser : public TIntermTraverser
         return CreateIndexNode(value);
     }
 
+    // Returns a conservative range for the index expression when one can be proven: constants,
+    // and induction variables of enclosing canonical loops.
+    bool getIndexRange(TIntermTyped *index, int *minOut, int *maxOut) const
+    {
+        int value = 0;
+        if (GetConstInt(index, &value))
+        {
+            *minOut = value;
+            *maxOut = value;
+            return true;
+        }
+
+        TIntermSymbol *symbol = index->getAsSymbolNode();
+        if (symbol != nullptr)
+        {
+            for (const InductionVarRange &range : mInductionVarRanges)
+            {
+                if (range.symbolId == symbol->uniqueId().get())
+                {
+                    *minOut = range.min;
+                    *maxOut = range.max;
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
     TCompiler *mCompiler;
+    std::vector<InductionVarRange> mInductionVarRanges;
 };
 }  // anonymous namespace
 
@@ -124,6 +124,87 @@ constexpr char kJsonVerSubMinor[] = "VerSubMinor";
 // patch value of a version.
 constexpr char kJsonVerPatch[] = "VerPatch";
 
+// The following two classes implement a compact, versioned binary encoding of a parsed RuleList.
+// Parsing the JSON rules is the expensive part of using this library (on Android it happens during
+// app launch), so the EGL loader can serialize the parsed rules once with ANGLERulesToBinary(),
+// cache the bytes, and recreate the rules on later launches with ANGLEAndroidParseRulesBinary()
+// without any JSON involvement.  All multi-byte values are stored little-endian.
+
+// The first four bytes of a binary rules blob ("ANGR"), to reject arbitrary data early:
+constexpr uint32_t kBinaryRulesMagic = 0x52474E41;
+// The version of the binary encoding.  This must be bumped whenever the encoding of any of the
+// classes below changes; a cached blob with a different version is simply rejected and the caller
+// falls back to JSON parsing.
+constexpr uint32_t kBinaryRulesVersion = 1;
+
+class BinaryWriter
+{
+  public:
+    void writeBool(bool value) { mBytes.push_back(value ? 1 : 0); }
+    void writeUint(uint32_t value)
+    {
+        mBytes.push_back(static_cast<uint8_t>(value & 0xFF));
+        mBytes.push_back(static_cast<uint8_t>((value >> 8) & 0xFF));
+        mBytes.push_back(static_cast<uint8_t>((value >> 16) & 0xFF));
+        mBytes.push_back(static_cast<uint8_t>((value >> 24) & 0xFF));
+    }
+    void writeString(const std::string &value)
+    {
+        writeUint(static_cast<uint32_t>(value.size()));
+        mBytes.insert(mBytes.end(), value.begin(), value.end());
+    }
+    const std::vector<uint8_t> &getBytes() const { return mBytes; }
+
+  private:
+    std::vector<uint8_t> mBytes;
+};
+
+// Every read is bounds-checked against the blob size; a truncated or corrupt blob makes the
+// current read (and the overall parse) fail rather than reading out of bounds.
+class BinaryReader
+{
+  public:
+    BinaryReader(const uint8_t *bytes, size_t size) : mBytes(bytes), mSize(size), mOffset(0) {}
+    bool readBool(bool *value)
+    {
+        if (mSize - mOffset < 1)
+        {
+            return false;
+        }
+        *value = (mBytes[mOffset++] != 0);
+        return true;
+    }
+    bool readUint(uint32_t *value)
+    {
+        if (mSize - mOffset < 4)
+        {
+            return false;
+        }
+        *value = static_cast<uint32_t>(mBytes[mOffset]) |
+                 (static_cast<uint32_t>(mBytes[mOffset + 1]) << 8) |
+                 (static_cast<uint32_t>(mBytes[mOffset + 2]) << 16) |
+                 (static_cast<uint32_t>(mBytes[mOffset + 3]) << 24);
+        mOffset += 4;
+        return true;
+    }
+    bool readString(std::string *value)
+    {
+        uint32_t length = 0;
+        if (!readUint(&length) || mSize - mOffset < length)
+        {
+            return false;
+        }
+        value->assign(reinterpret_cast<const char *>(mBytes + mOffset), length);
+        mOffset += length;
+        return true;
+    }
+
+  private:
+    const uint8_t *mBytes;
+    size_t mSize;
+    size_t mOffset;
+};
+
 // This encapsulates a std::string.  The default constructor (not given a string) assumes that this
 // is a wildcard (i.e. will match all other StringPart objects).
 class StringPart
@@ -147,6 +228,19 @@ class StringPart
         return (mWildcard || toCheck.mWildcard || (toCheck.mPart == mPart));
     }
 
+    void writeTo(BinaryWriter *writer) const
+    {
+        writer->writeBool(mWildcard);
+        if (!mWildcard)
+        {
+            writer->writeString(mPart);
+        }
+    }
+    bool readFrom(BinaryReader *reader)
+    {
+        return reader->readBool(&mWildcard) && (mWildcard || reader->readString(&mPart));
+    }
+
   public:
     std::string mPart;
     bool mWildcard = true;
@@ -175,6 +269,19 @@ class IntegerPart
         return (mWildcard || toCheck.mWildcard || (toCheck.mPart == mPart));
     }
 
+    void writeTo(BinaryWriter *writer) const
+    {
+        writer->writeBool(mWildcard);
+        if (!mWildcard)
+        {
+            writer->writeUint(mPart);
+        }
+    }
+    bool readFrom(BinaryReader *reader)
+    {
+        return reader->readBool(&mWildcard) && (mWildcard || reader->readUint(&mPart));
+    }
+
   public:
     uint32_t mPart = 0;
     bool mWildcard = true;
@@ -233,6 +340,33 @@ class ListOf
         VERBOSE("\t\t\t Failed to match list.\n");
         return false;
     }
+    void writeTo(BinaryWriter *writer) const
+    {
+        // addItem() clears mWildcard, so the item count alone reproduces the wildcard state.
+        writer->writeUint(static_cast<uint32_t>(mList.size()));
+        for (const T &it : mList)
+        {
+            it.writeTo(writer);
+        }
+    }
+    bool readFrom(BinaryReader *reader)
+    {
+        uint32_t count = 0;
+        if (!reader->readUint(&count))
+        {
+            return false;
+        }
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            T item;
+            if (!item.readFrom(reader))
+            {
+                return false;
+            }
+            addItem(std::move(item));
+        }
+        return true;
+    }
     void logListOf(const std::string prefix, const std::string name) const
     {
         if (mWildcard)
@@ -310,6 +444,19 @@ class Version
                  mSubminor.match(toCheck.mSubminor) && mPatch.match(toCheck.mPatch)));
     }
 
+    void writeTo(BinaryWriter *writer) const
+    {
+        mMajor.writeTo(writer);
+        mMinor.writeTo(writer);
+        mSubminor.writeTo(writer);
+        mPatch.writeTo(writer);
+    }
+    bool readFrom(BinaryReader *reader)
+    {
+        return mMajor.readFrom(reader) && mMinor.readFrom(reader) && mSubminor.readFrom(reader) &&
+               mPatch.readFrom(reader);
+    }
+
     std::string getString() const
     {
         if (mMajor.mWildcard)
@@ -380,6 +527,20 @@ class Application
         return (mWildcard || toCheck.mWildcard ||
                 (toCheck.mName.match(mName) && toCheck.mVersion.match(mVersion)));
     }
+    void writeTo(BinaryWriter *writer) const
+    {
+        writer->writeBool(mWildcard);
+        if (!mWildcard)
+        {
+            mName.writeTo(writer);
+            mVersion.writeTo(writer);
+        }
+    }
+    bool readFrom(BinaryReader *reader)
+    {
+        return reader->readBool(&mWildcard) &&
+               (mWildcard || (mName.readFrom(reader) && mVersion.readFrom(reader)));
+    }
     void logItem() const
     {
         if (mWildcard)
@@ -446,6 +607,23 @@ class GPU
         return true;
     }
 
+    void writeTo(BinaryWriter *writer) const
+    {
+        writer->writeBool(mWildcard);
+        if (!mWildcard)
+        {
+            mVendor.writeTo(writer);
+            mDeviceId.writeTo(writer);
+            mVersion.writeTo(writer);
+        }
+    }
+    bool readFrom(BinaryReader *reader)
+    {
+        return reader->readBool(&mWildcard) &&
+               (mWildcard || (mVendor.readFrom(reader) && mDeviceId.readFrom(reader) &&
+                              mVersion.readFrom(reader)));
+    }
+
     std::string toString() const
     {
         if (mWildcard)
@@ -525,6 +703,28 @@ class Device
         }
         return false;
     }
+    void writeTo(BinaryWriter *writer) const
+    {
+        writer->writeBool(mWildcard);
+        if (!mWildcard)
+        {
+            mManufacturer.writeTo(writer);
+            mModel.writeTo(writer);
+        }
+        mGpuList.writeTo(writer);
+    }
+    bool readFrom(BinaryReader *reader)
+    {
+        if (!reader->readBool(&mWildcard))
+        {
+            return false;
+        }
+        if (!mWildcard && (!mManufacturer.readFrom(reader) || !mModel.readFrom(reader)))
+        {
+            return false;
+        }
+        return mGpuList.readFrom(reader);
+    }
     void logItem() const
     {
         if (mWildcard)
@@ -626,6 +826,18 @@ class Rule
         return true;
     }
     bool getUseANGLE() const { return mUseANGLE; }
+    void writeTo(BinaryWriter *writer) const
+    {
+        writer->writeString(mDescription);
+        writer->writeBool(mUseANGLE);
+        mAppList.writeTo(writer);
+        mDevList.writeTo(writer);
+    }
+    bool readFrom(BinaryReader *reader)
+    {
+        return reader->readString(&mDescription) && reader->readBool(&mUseANGLE) &&
+               mAppList.readFrom(reader) && mDevList.readFrom(reader);
+    }
     void logRule() const
     {
         VERBOSE("  Rule: \"%s\" %s ANGLE\n", mDescription.c_str(),
@@ -709,6 +921,61 @@ class RuleList
         return rules;
     }
 
+    // Serializes the parsed rules into the binary encoding described above BinaryWriter.
+    std::vector<uint8_t> toBinary() const
+    {
+        BinaryWriter writer;
+        writer.writeUint(kBinaryRulesMagic);
+        writer.writeUint(kBinaryRulesVersion);
+        writer.writeUint(static_cast<uint32_t>(mRuleList.size()));
+        for (const Rule &rule : mRuleList)
+        {
+            rule.writeTo(&writer);
+        }
+        return writer.getBytes();
+    }
+
+    // Recreates a RuleList from the binary encoding, without any JSON parsing.  Returns nullptr
+    // for a blob with an unknown magic/version or with truncated/corrupt contents, in which case
+    // the caller should fall back to ANGLEAndroidParseRulesString().
+    static RuleList *ReadRulesFromBinary(const uint8_t *bytes, size_t size)
+    {
+        BinaryReader reader(bytes, size);
+        uint32_t magic   = 0;
+        uint32_t version = 0;
+        if (!reader.readUint(&magic) || magic != kBinaryRulesMagic ||
+            !reader.readUint(&version) || version != kBinaryRulesVersion)
+        {
+            VERBOSE("Rejecting binary rules with unknown magic/version.\n");
+            return nullptr;
+        }
+
+        uint32_t ruleCount = 0;
+        if (!reader.readUint(&ruleCount))
+        {
+            return nullptr;
+        }
+        std::unique_ptr<RuleList> rules(new RuleList);
+        for (uint32_t i = 0; i < ruleCount; ++i)
+        {
+            Rule newRule("", false);
+            if (!newRule.readFrom(&reader))
+            {
+                VERBOSE("Failed to parse binary rules; the blob is truncated or corrupt.\n");
+                return nullptr;
+            }
+            rules->addRule(std::move(newRule));
+        }
+
+        // Make sure there is at least one, default rule.  If not, add it here:
+        if (rules->mRuleList.empty())
+        {
+            Rule defaultRule("Default Rule", false);
+            rules->addRule(std::move(defaultRule));
+        }
+        return rules.release();
+    }
+
     void addRule(Rule &&rule) { mRuleList.push_back(std::move(rule)); }
     bool getUseANGLE(const Scenario &toCheck)
     {
@@ -799,6 +1066,56 @@ ANGLE_EXPORT bool ANGLEAndroidParseRulesString(const char *rulesString,
     return true;
 }
 
+// This function is part of the version-3 API:
+ANGLE_EXPORT bool ANGLERulesToBinary(const RulesHandle rulesHandle,
+                                     unsigned char **binaryData,
+                                     unsigned int *binarySize)
+{
+    RuleList *rules = static_cast<RuleList *>(rulesHandle);
+    if (!rules || !binaryData || !binarySize)
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> binary = rules->toBinary();
+    unsigned char *data         = new unsigned char[binary.size()];
+    memcpy(data, binary.data(), binary.size());
+
+    *binaryData = data;
+    *binarySize = static_cast<unsigned int>(binary.size());
+    return true;
+}
+
+// This function is part of the version-3 API:
+ANGLE_EXPORT bool ANGLEAndroidParseRulesBinary(const unsigned char *binaryData,
+                                               unsigned int binarySize,
+                                               RulesHandle *rulesHandle,
+                                               int *rulesVersion)
+{
+    if (!binaryData || (binarySize == 0) || !rulesHandle || !rulesVersion)
+    {
+        return false;
+    }
+
+    RuleList *rules = RuleList::ReadRulesFromBinary(binaryData, binarySize);
+    if (!rules)
+    {
+        return false;
+    }
+
+    rules->logRules();
+
+    *rulesHandle  = rules;
+    *rulesVersion = 0;
+    return true;
+}
+
+// This function is part of the version-3 API:
+ANGLE_EXPORT void ANGLEFreeRulesBinary(unsigned char *binaryData)
+{
+    delete[] binaryData;
+}
+
 // This function is part of the version-2 API:
 ANGLE_EXPORT bool ANGLEGetSystemInfo(SystemInfoHandle *systemInfoHandle)
 {
@@ -866,6 +1183,50 @@ ANGLE_EXPORT bool ANGLEShouldBeUsedForApplication(const RulesHandle rulesHandle,
     return rtn;
 }
 
+// This function is part of the version-3 API:
+ANGLE_EXPORT bool ANGLEShouldBeUsedForApplications(const RulesHandle rulesHandle,
+                                                   int rulesVersion,
+                                                   const SystemInfoHandle systemInfoHandle,
+                                                   const char *const *appNames,
+                                                   bool *useANGLE,
+                                                   unsigned int appCount)
+{
+    RuleList *rules               = static_cast<RuleList *>(rulesHandle);
+    angle::SystemInfo *systemInfo = static_cast<angle::SystemInfo *>(systemInfoHandle);
+    if (!rules || !systemInfo || !appNames || !useANGLE || (systemInfo->gpus.size() != 1))
+    {
+        return false;
+    }
+
+    // The device half of the scenario is the same for every application, so build it once and
+    // only swap out the application between queries:
+    Scenario scenario("", systemInfo->machineManufacturer.c_str(),
+                      systemInfo->machineModelName.c_str());
+    Version gpuDriverVersion(systemInfo->gpus[0].detailedDriverVersion.major,
+                             systemInfo->gpus[0].detailedDriverVersion.minor,
+                             systemInfo->gpus[0].detailedDriverVersion.subMinor,
+                             systemInfo->gpus[0].detailedDriverVersion.patch);
+    GPU gpuDriver(systemInfo->gpus[0].driverVendor, systemInfo->gpus[0].deviceId,
+                  std::move(gpuDriverVersion));
+    scenario.mDevice.addGPU(std::move(gpuDriver));
+
+    for (unsigned int i = 0; i < appCount; ++i)
+    {
+        if (!appNames[i])
+        {
+            return false;
+        }
+        scenario.mApplication = Application(StringPart(appNames[i]));
+        scenario.logScenario();
+
+        useANGLE[i] = rules->getUseANGLE(scenario);
+        VERBOSE("Application \"%s\" should %s ANGLE.\n", appNames[i],
+                useANGLE[i] ? "use" : "NOT use");
+    }
+
+    return true;
+}
+
 // This function is part of the version-2 API:
 ANGLE_EXPORT void ANGLEFreeRulesHandle(const RulesHandle rulesHandle)
 {
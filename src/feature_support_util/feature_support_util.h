@@ -17,7 +17,9 @@ extern "C" {
 
 /**************************************************************************************************
  *
- * The following is the "version 2" private API for the Android EGL loader:
+ * The following is the private API for the Android EGL loader.  The API version that introduced
+ * each function is noted at the function's definition (see also kFeatureVersion_* at the bottom
+ * of this file):
  *
  **************************************************************************************************/
 
@@ -60,6 +62,52 @@ ANGLE_EXPORT bool ANGLEAndroidParseRulesString(const char *rulesString,
                                                RulesHandle *rulesHandle,
                                                int *rulesVersion);
 
+// The Android EGL loader may call this function in order to serialize a set of parsed rules into
+// a compact binary form that it can cache (e.g. on disk).  On later launches, the cached bytes
+// can be turned back into a rules handle with ANGLEAndroidParseRulesBinary() without paying for
+// JSON parsing again.  The returned buffer is owned by the caller and must be freed with
+// ANGLEFreeRulesBinary().
+//
+// Parameters:
+// - rulesHandle  (IN) - Handle to the rules data structure
+// - binaryData  (OUT) - Serialized rules; valid until passed to ANGLEFreeRulesBinary()
+// - binarySize  (OUT) - Size of binaryData in bytes
+//
+// Return value:
+// - bool - true if no errors, otherwise false
+//
+ANGLE_EXPORT bool ANGLERulesToBinary(const RulesHandle rulesHandle,
+                                     unsigned char **binaryData,
+                                     unsigned int *binarySize);
+
+// The Android EGL loader will call this function in order to create a set of rules from a binary
+// blob previously produced by ANGLERulesToBinary().  The blob is validated; if it was produced by
+// an incompatible library version or is corrupt, false is returned and the caller should fall
+// back to ANGLEAndroidParseRulesString() with the original rules file.
+//
+// Parameters:
+// - binaryData   (IN) - Serialized rules, as produced by ANGLERulesToBinary()
+// - binarySize   (IN) - Size of binaryData in bytes
+// - rulesHandle (OUT) - Handle to the rules data structure
+// - rulesVersion (OUT) - Version of the rules data structure (potentially because of schema
+//                        changes) that should be passed to ANGLEShouldBeUsedForApplication()
+//
+// Return value:
+// - bool - true if no errors, otherwise false
+//
+ANGLE_EXPORT bool ANGLEAndroidParseRulesBinary(const unsigned char *binaryData,
+                                               unsigned int binarySize,
+                                               RulesHandle *rulesHandle,
+                                               int *rulesVersion);
+
+// The Android EGL loader will call this function in order to free a buffer returned by
+// ANGLERulesToBinary().
+//
+// Parameters:
+// - binaryData (IN) - Buffer returned by ANGLERulesToBinary()
+//
+ANGLE_EXPORT void ANGLEFreeRulesBinary(unsigned char *binaryData);
+
 // The Android EGL loader will call this function in order to obtain a handle to
 // the SystemInfo struct.
 //
@@ -106,6 +154,29 @@ ANGLE_EXPORT bool ANGLEShouldBeUsedForApplication(const RulesHandle rulesHandle,
                                                   const SystemInfoHandle systemInfoHandle,
                                                   const char *appName);
 
+// The Android EGL loader may call this function to answer the ANGLE-or-native question for
+// several applications in one call, amortizing the per-query setup over the batch.
+//
+// Parameters:
+// - rulesHandle      (IN) - Handle to the rules data structure
+// - rulesVersion     (IN) - Version of the rules data structure (potentially because of schema
+//                           changes) that was passed from AndroidParseRulesFile()
+// - systemInfoHandle (IN) - Handle to the SystemInfo structure
+// - appNames         (IN) - Array of appCount Java application names
+// - useANGLE        (OUT) - Array of appCount answers, one per application; only valid when true
+//                           is returned
+// - appCount         (IN) - Number of entries in appNames and useANGLE
+//
+// Return value:
+// - bool - true if no errors, otherwise false
+//
+ANGLE_EXPORT bool ANGLEShouldBeUsedForApplications(const RulesHandle rulesHandle,
+                                                   int rulesVersion,
+                                                   const SystemInfoHandle systemInfoHandle,
+                                                   const char *const *appNames,
+                                                   bool *useANGLE,
+                                                   unsigned int appCount);
+
 // The Android EGL loader will call this function in order to free a rules handle.
 //
 // Parameters:
@@ -123,7 +194,7 @@ ANGLE_EXPORT void ANGLEFreeSystemInfoHandle(const SystemInfoHandle systemInfoHan
 // The following are internal versions supported by the current  feature-support-utility API.
 
 constexpr unsigned int kFeatureVersion_LowestSupported  = 2;
-constexpr unsigned int kFeatureVersion_HighestSupported = 2;
+constexpr unsigned int kFeatureVersion_HighestSupported = 3;
 
 #ifdef __cplusplus
 }  // extern "C"
@@ -157,6 +157,40 @@ TEST_F(FeatureSupportUtilTest, TestRuleProcessing)
     constexpr char kApp2[] = "com.isvB.app2";
     EXPECT_FALSE(ANGLEShouldBeUsedForApplication(rulesHandle, rulesVersion, &systemInfo, kApp2));
 
+    // Test both apps in one batch query--should match the individual answers:
+    const char *appNames[] = {kApp1, kApp2};
+    bool useANGLE[2]       = {false, true};
+    EXPECT_TRUE(ANGLEShouldBeUsedForApplications(rulesHandle, rulesVersion, &systemInfo, appNames,
+                                                 useANGLE, 2));
+    EXPECT_TRUE(useANGLE[0]);
+    EXPECT_FALSE(useANGLE[1]);
+
+    // Serialize the parsed rules, recreate them from the binary form, and check that the
+    // recreated rules give the same answers:
+    unsigned char *binaryData = nullptr;
+    unsigned int binarySize   = 0;
+    EXPECT_TRUE(ANGLERulesToBinary(rulesHandle, &binaryData, &binarySize));
+    EXPECT_NE(nullptr, binaryData);
+    EXPECT_NE(0u, binarySize);
+
+    RulesHandle binaryRulesHandle = nullptr;
+    int binaryRulesVersion        = 0;
+    EXPECT_TRUE(ANGLEAndroidParseRulesBinary(binaryData, binarySize, &binaryRulesHandle,
+                                             &binaryRulesVersion));
+    EXPECT_NE(nullptr, binaryRulesHandle);
+    EXPECT_TRUE(
+        ANGLEShouldBeUsedForApplication(binaryRulesHandle, binaryRulesVersion, &systemInfo, kApp1));
+    EXPECT_FALSE(
+        ANGLEShouldBeUsedForApplication(binaryRulesHandle, binaryRulesVersion, &systemInfo, kApp2));
+
+    // A truncated blob must be rejected:
+    RulesHandle truncatedRulesHandle = nullptr;
+    EXPECT_FALSE(ANGLEAndroidParseRulesBinary(binaryData, binarySize / 2, &truncatedRulesHandle,
+                                              &binaryRulesVersion));
+    EXPECT_EQ(nullptr, truncatedRulesHandle);
+
     // Free the rules data structures:
+    ANGLEFreeRulesBinary(binaryData);
+    ANGLEFreeRulesHandle(binaryRulesHandle);
     ANGLEFreeRulesHandle(rulesHandle);
 }
@@ -7,6 +7,7 @@
 // SystemInfo.cpp: implementation of the system-agnostic parts of SystemInfo.h
 
 #include "gpu_info_util/SystemInfo.h"
+#include "gpu_info_util/SystemInfo_internal.h"
 
 #include <cstring>
 #include <iostream>
@@ -319,6 +320,19 @@ void GetDualGPUInfo(SystemInfo *info)
     info->isAMDSwitchable = hasIntel && IsAMD(info->gpus[active].vendorId);
 }
 
+bool GetSystemInfo(SystemInfo *info)
+{
+    // Gathering system info is expensive: it enumerates PCI devices, stats and parses driver
+    // files, and on Linux may spawn subprocesses.  The result cannot change for the lifetime of
+    // the process, and multiple components query it (display initialization, crash reporting), so
+    // gather it once and hand out copies.
+    static angle::base::NoDestructor<SystemInfo> sCachedInfo;
+    static bool sCachedResult = GetSystemInfoInternal(sCachedInfo.get());
+
+    *info = *sCachedInfo;
+    return sCachedResult;
+}
+
 void PrintSystemInfo(const SystemInfo &info)
 {
     std::cout << info.gpus.size() << " GPUs:\n";
@@ -94,7 +94,8 @@ struct SystemInfo
 
 // Gathers information about the system without starting a GPU driver and returns them in `info`.
 // Returns true if all info was gathered, false otherwise. Even when false is returned, `info` will
-// be filled with partial information.
+// be filled with partial information.  The information is gathered once per process; subsequent
+// calls return a copy of the cached result.
 bool GetSystemInfo(SystemInfo *info);
 
 // Vulkan-specific info collection.
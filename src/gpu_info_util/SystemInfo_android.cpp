@@ -34,7 +34,7 @@ bool GetAndroidSystemProperty(const std::string &propertyName, std::string *valu
 }
 }  // namespace
 
-bool GetSystemInfo(SystemInfo *info)
+bool GetSystemInfoInternal(SystemInfo *info)
 {
     bool isFullyPopulated = true;
 
@@ -17,7 +17,7 @@
 namespace angle
 {
 
-bool GetSystemInfo(SystemInfo *info)
+bool GetSystemInfoInternal(SystemInfo *info)
 {
 #    if defined(ANGLE_PLATFORM_MACOS) || defined(ANGLE_PLATFORM_MACCATALYST)
     return GetSystemInfo_mac(info);
@@ -6,12 +6,13 @@
 
 // SystemInfo_fuchsia.cpp: implementation of the Fuchsia-specific parts of SystemInfo.h
 
+#include "gpu_info_util/SystemInfo_internal.h"
 #include "gpu_info_util/SystemInfo_vulkan.h"
 
 namespace angle
 {
 
-bool GetSystemInfo(SystemInfo *info)
+bool GetSystemInfoInternal(SystemInfo *info)
 {
     return GetSystemInfoVulkan(info);
 }
@@ -14,6 +14,10 @@
 namespace angle
 {
 
+// Platform-specific implementation backing GetSystemInfo(), which memoizes the result for the
+// lifetime of the process.
+bool GetSystemInfoInternal(SystemInfo *info);
+
 // Defined in SystemInfo_libpci when GPU_INFO_USE_LIBPCI is defined.
 bool GetPCIDevicesWithLibPCI(std::vector<GPUDeviceInfo> *devices);
 // Defined in SystemInfo_x11 when GPU_INFO_USE_X11 is defined.
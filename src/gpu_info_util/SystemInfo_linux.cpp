@@ -69,7 +69,7 @@ bool GetPCIDevicesWithLibPCI(std::vector<GPUDeviceInfo> *devices)
 }
 #endif
 
-bool GetSystemInfo(SystemInfo *info)
+bool GetSystemInfoInternal(SystemInfo *info)
 {
     if (!GetPCIDevicesWithLibPCI(&(info->gpus)))
     {
@@ -86,7 +86,7 @@ bool GetDevicesFromDXGI(std::vector<GPUDeviceInfo> *devices)
 
 }  // anonymous namespace
 
-bool GetSystemInfo(SystemInfo *info)
+bool GetSystemInfoInternal(SystemInfo *info)
 {
     if (!GetDevicesFromDXGI(&info->gpus))
     {
@@ -88,21 +88,33 @@ bool IsAstcDecompressorAvailable()
 // Currently, there is no eviction strategy. Each cache could grow to a maximum of ~400 MB in size
 // since they are 13 possible ASTC block sizes.
 //
-// Thread-safety: not thread safe.
+// Thread-safety: get() is thread safe; callers must hold a given entry's decodeMutex while
+// decompressing with its context.
 class AstcDecompressorContextCache
 {
   public:
-    // Returns a context object for a given ASTC block size, along with the error code if the
-    // context initialization failed.
-    // In this case, the context will be null, and the status code will be non-zero.
-    std::pair<astcenc_context *, astcenc_error> get(uint32_t blockWidth, uint32_t blockHeight)
+    struct Value
     {
+        AstcencContextUniquePtr context = nullptr;
+        astcenc_error error             = ASTCENC_SUCCESS;
+
+        // A given astcenc context can only decompress one image at a time; this serializes its
+        // users without serializing decompression of images with other block sizes.
+        std::mutex decodeMutex;
+    };
+
+    // Returns the cache entry for a given ASTC block size. If the context initialization failed,
+    // the entry's context will be null, and its status code will be non-zero.
+    // Entries are stable: the returned reference stays valid as the cache grows.
+    Value &get(uint32_t blockWidth, uint32_t blockHeight)
+    {
+        std::lock_guard lock(mCacheMutex);
         Value &value = mContexts[{blockWidth, blockHeight}];
         if (value.context == nullptr)
         {
             value.context = MakeDecoderContext(blockWidth, blockHeight, &value.error);
         }
-        return {value.context.get(), value.error};
+        return value;
     }
 
   private:
@@ -118,12 +130,6 @@ class AstcDecompressorContextCache
         }
     };
 
-    struct Value
-    {
-        AstcencContextUniquePtr context = nullptr;
-        astcenc_error error             = ASTCENC_SUCCESS;
-    };
-
     // Computes the hash of a Key
     struct KeyHash
     {
@@ -135,6 +141,7 @@ class AstcDecompressorContextCache
     };
 
     std::unordered_map<Key, Value, KeyHash> mContexts;
+    std::mutex mCacheMutex;
 };
 
 struct DecompressTask : public Closure
@@ -170,10 +177,7 @@ class AstcDecompressorImpl : public AstcDecompressor
   public:
     AstcDecompressorImpl()
         : AstcDecompressor(), mContextCache(std::make_unique<AstcDecompressorContextCache>())
-    {
-        mTasks.reserve(MaxThreads());
-        mWaitEvents.reserve(MaxThreads());
-    }
+    {}
 
     ~AstcDecompressorImpl() override = default;
 
@@ -193,13 +197,16 @@ class AstcDecompressorImpl : public AstcDecompressor
                        size_t inputLength,
                        uint8_t *output) override
     {
-        // A given astcenc context can only decompress one image at a time, which we why we keep
-        // this mutex locked the whole time.
-        std::lock_guard global_lock(mMutex);
+        AstcDecompressorContextCache::Value &entry = mContextCache->get(blockWidth, blockHeight);
+        if (entry.error != ASTCENC_SUCCESS)
+            return entry.error;
+
+        astcenc_context *context = entry.context.get();
 
-        auto [context, context_status] = mContextCache->get(blockWidth, blockHeight);
-        if (context_status != ASTCENC_SUCCESS)
-            return context_status;
+        // A given astcenc context can only decompress one image at a time, which is why we keep
+        // this mutex locked the whole time.  Images with a different block footprint use other
+        // contexts and decompress concurrently.
+        std::lock_guard decode_lock(entry.decodeMutex);
 
         astcenc_image image;
         image.dim_x     = imgWidth;
@@ -215,19 +222,21 @@ class AstcDecompressorImpl : public AstcDecompressor
             singleThreaded ? singleThreadPool : multiThreadPool;
         const uint32_t threadCount = singleThreaded ? 1 : MaxThreads();
 
-        mTasks.clear();
-        mWaitEvents.clear();
+        std::vector<std::shared_ptr<DecompressTask>> tasks;
+        std::vector<std::shared_ptr<WaitableEvent>> waitEvents;
+        tasks.reserve(threadCount);
+        waitEvents.reserve(threadCount);
 
         for (uint32_t i = 0; i < threadCount; ++i)
         {
-            mTasks.push_back(
+            tasks.push_back(
                 std::make_shared<DecompressTask>(context, i, input, inputLength, &image));
-            mWaitEvents.push_back(threadPool->postWorkerTask(mTasks[i]));
+            waitEvents.push_back(threadPool->postWorkerTask(tasks[i]));
         }
-        WaitableEvent::WaitMany(&mWaitEvents);
+        WaitableEvent::WaitMany(&waitEvents);
         astcenc_decompress_reset(context);
 
-        for (auto &task : mTasks)
+        for (auto &task : tasks)
         {
             if (task->result != ASTCENC_SUCCESS)
                 return task->result;
@@ -243,9 +252,6 @@ class AstcDecompressorImpl : public AstcDecompressor
 
   private:
     std::unique_ptr<AstcDecompressorContextCache> mContextCache;
-    std::mutex mMutex;  // Locked while calling `decode()`
-    std::vector<std::shared_ptr<DecompressTask>> mTasks;
-    std::vector<std::shared_ptr<WaitableEvent>> mWaitEvents;
 };
 
 }  // namespace
@@ -8,6 +8,9 @@
 
 #include "image_util/copyimage.h"
 
+#include "common/mathutil.h"
+#include "common/platform.h"
+
 namespace angle
 {
 
@@ -38,6 +41,52 @@ void CopyBGRA8ToRGBA8Fast(const uint8_t *source,
         }
     }
 }
+
+void CopyRGBA8ToRGB8Fast(const uint8_t *source,
+                         int srcYAxisPitch,
+                         uint8_t *dest,
+                         int destYAxisPitch,
+                         int destWidth,
+                         int destHeight)
+{
+    for (int y = 0; y < destHeight; ++y)
+    {
+        const uint8_t *src = source + y * srcYAxisPitch;
+        uint8_t *dst       = dest + y * destYAxisPitch;
+        int x              = 0;
+
+#if defined(ANGLE_USE_SSE)
+        if (gl::supportsSSSE3())
+        {
+            // Gather the RGB bytes of four texels into the low 12 bytes of the register.  The
+            // store writes 16 bytes, so stop early enough that the 4 bytes of garbage past the
+            // packed texels stay within the row; they are overwritten by the next iteration or
+            // the scalar tail.
+            const __m128i contractMask =
+                _mm_set_epi8(-1, -1, -1, -1, 14, 13, 12, 10, 9, 8, 6, 5, 4, 2, 1, 0);
+
+            for (; x + 6 <= destWidth; x += 4)
+            {
+                __m128i texels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + x * 4));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + x * 3),
+                                 _mm_shuffle_epi8(texels, contractMask));
+            }
+        }
+#elif defined(ANGLE_USE_NEON)
+        for (; x + 16 <= destWidth; x += 16)
+        {
+            const uint8x16x4_t texels = vld4q_u8(src + x * 4);
+            const uint8x16x3_t rgb    = {{texels.val[0], texels.val[1], texels.val[2]}};
+            vst3q_u8(dst + x * 3, rgb);
+        }
+#endif
+
+        for (; x < destWidth; ++x)
+        {
+            memcpy(dst + x * 3, src + x * 4, 3);
+        }
+    }
+}
 }  // namespace
 
 void CopyBGRA8ToRGBA8(const uint8_t *source,
@@ -71,4 +120,34 @@ void CopyBGRA8ToRGBA8(const uint8_t *source,
     }
 }
 
+void CopyRGBA8ToRGB8(const uint8_t *source,
+                     int srcXAxisPitch,
+                     int srcYAxisPitch,
+                     uint8_t *dest,
+                     int destXAxisPitch,
+                     int destYAxisPitch,
+                     int destWidth,
+                     int destHeight)
+{
+    if (srcXAxisPitch == 4 && destXAxisPitch == 3)
+    {
+        CopyRGBA8ToRGB8Fast(source, srcYAxisPitch, dest, destYAxisPitch, destWidth, destHeight);
+        return;
+    }
+
+    for (int y = 0; y < destHeight; ++y)
+    {
+        uint8_t *dst       = dest + y * destYAxisPitch;
+        const uint8_t *src = source + y * srcYAxisPitch;
+        const uint8_t *end = src + destWidth * srcXAxisPitch;
+
+        while (src != end)
+        {
+            memcpy(dst, src, 3);
+            src += srcXAxisPitch;
+            dst += destXAxisPitch;
+        }
+    }
+}
+
 }  // namespace angle
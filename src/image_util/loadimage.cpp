@@ -667,6 +667,38 @@ void LoadRGBA8ToBGRA8(const ImageLoadContext &context,
 
         return;
     }
+#elif defined(ANGLE_USE_NEON)
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t y = 0; y < height; y++)
+        {
+            const uint32_t *source =
+                priv::OffsetDataPointer<uint32_t>(input, y, z, inputRowPitch, inputDepthPitch);
+            uint32_t *dest =
+                priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
+
+            size_t x = 0;
+
+            // Swap red and blue of sixteen texels per iteration with de-interleaving loads.
+            for (; x + 16 <= width; x += 16)
+            {
+                uint8x16x4_t texels = vld4q_u8(reinterpret_cast<const uint8_t *>(&source[x]));
+                const uint8x16_t red = texels.val[0];
+                texels.val[0]        = texels.val[2];
+                texels.val[2]        = red;
+                vst4q_u8(reinterpret_cast<uint8_t *>(&dest[x]), texels);
+            }
+
+            // Perform leftover writes
+            for (; x < width; x++)
+            {
+                uint32_t rgba = source[x];
+                dest[x]       = (ANGLE_ROTL(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
+            }
+        }
+    }
+
+    return;
 #endif
 
     for (size_t z = 0; z < depth; z++)
@@ -8,7 +8,11 @@
 
 #include "image_util/loadimage.h"
 
+#include <functional>
 #include <type_traits>
+#include <vector>
+
+#include "common/WorkerThread.h"
 #include "common/mathutil.h"
 
 #include "image_util/imageformats.h"
@@ -1413,6 +1417,65 @@ static const uint8_t DefaultETCAlphaValues[4][4] =
 };
 
 // clang-format on
+// Wraps a band decode for the worker pool.
+class DecodeBandTask : public Closure
+{
+  public:
+    DecodeBandTask(std::function<void()> &&decodeBand) : mDecodeBand(std::move(decodeBand)) {}
+
+    void operator()() override { mDecodeBand(); }
+
+  private:
+    std::function<void()> mDecodeBand;
+};
+
+// Runs |decodeBand| over bands of whole 4-pixel block rows, [yBegin, yEnd) of slice z, splitting
+// large slices across the worker pool.  Blocks decode independently, so bands only need to be cut
+// on block boundaries.  Small images decode on the calling thread.
+void ForEachBlockRowBand(const ImageLoadContext &context,
+                         size_t height,
+                         size_t depth,
+                         const std::function<void(size_t z, size_t yBegin, size_t yEnd)> &decodeBand)
+{
+    constexpr size_t kBlockDim = 4;
+    // Bands below this many pixel rows aren't worth a worker thread wakeup.
+    constexpr size_t kMinRowsPerBand = 64;
+    constexpr size_t kMaxBands       = 8;
+
+    const size_t bandCount = std::min(height / kMinRowsPerBand, kMaxBands);
+    if (bandCount < 2 || !context.multiThreadPool || !context.multiThreadPool->isAsync())
+    {
+        for (size_t z = 0; z < depth; z++)
+        {
+            decodeBand(z, 0, height);
+        }
+        return;
+    }
+
+    const size_t blockRows        = (height + kBlockDim - 1) / kBlockDim;
+    const size_t blockRowsPerBand = blockRows / bandCount;
+
+    std::vector<std::shared_ptr<WaitableEvent>> waitEvents;
+    waitEvents.reserve(depth * bandCount);
+
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t band = 0; band < bandCount; band++)
+        {
+            const size_t yBegin = band * blockRowsPerBand * kBlockDim;
+            const size_t yEnd =
+                (band + 1 == bandCount) ? height : (band + 1) * blockRowsPerBand * kBlockDim;
+
+            waitEvents.push_back(context.multiThreadPool->postWorkerTask(
+                std::make_shared<DecodeBandTask>([&decodeBand, z, yBegin, yEnd]() {
+                    decodeBand(z, yBegin, yEnd);
+                })));
+        }
+    }
+
+    WaitableEvent::WaitMany(&waitEvents);
+}
+
 void LoadR11EACToR8(const ImageLoadContext &context,
                     size_t width,
                     size_t height,
@@ -1425,9 +1488,8 @@ void LoadR11EACToR8(const ImageLoadContext &context,
                     size_t outputDepthPitch,
                     bool isSigned)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
+    ForEachBlockRowBand(context, height, depth, [&](size_t z, size_t yBegin, size_t yEnd) {
+        for (size_t y = yBegin; y < yEnd; y += 4)
         {
             const ETC2Block *sourceRow =
                 priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
@@ -1443,7 +1505,7 @@ void LoadR11EACToR8(const ImageLoadContext &context,
                                                        outputRowPitch, isSigned);
             }
         }
-    }
+    });
 }
 
 void LoadRG11EACToRG8(const ImageLoadContext &context,
@@ -1458,9 +1520,8 @@ void LoadRG11EACToRG8(const ImageLoadContext &context,
                       size_t outputDepthPitch,
                       bool isSigned)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
+    ForEachBlockRowBand(context, height, depth, [&](size_t z, size_t yBegin, size_t yEnd) {
+        for (size_t y = yBegin; y < yEnd; y += 4)
         {
             const ETC2Block *sourceRow =
                 priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
@@ -1480,7 +1541,7 @@ void LoadRG11EACToRG8(const ImageLoadContext &context,
                                                             outputRowPitch, isSigned);
             }
         }
-    }
+    });
 }
 
 void LoadR11EACToR16(const ImageLoadContext &context,
@@ -1496,9 +1557,8 @@ void LoadR11EACToR16(const ImageLoadContext &context,
                      bool isSigned,
                      bool isFloat)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
+    ForEachBlockRowBand(context, height, depth, [&](size_t z, size_t yBegin, size_t yEnd) {
+        for (size_t y = yBegin; y < yEnd; y += 4)
         {
             const ETC2Block *sourceRow =
                 priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
@@ -1514,7 +1574,7 @@ void LoadR11EACToR16(const ImageLoadContext &context,
                                                       outputRowPitch, isSigned, isFloat);
             }
         }
-    }
+    });
 }
 
 void LoadRG11EACToRG16(const ImageLoadContext &context,
@@ -1530,9 +1590,8 @@ void LoadRG11EACToRG16(const ImageLoadContext &context,
                        bool isSigned,
                        bool isFloat)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
+    ForEachBlockRowBand(context, height, depth, [&](size_t z, size_t yBegin, size_t yEnd) {
+        for (size_t y = yBegin; y < yEnd; y += 4)
         {
             const ETC2Block *sourceRow =
                 priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
@@ -1552,7 +1611,7 @@ void LoadRG11EACToRG16(const ImageLoadContext &context,
                                                            outputRowPitch, isSigned, isFloat);
             }
         }
-    }
+    });
 }
 
 void LoadETC2RGB8ToRGBA8(const ImageLoadContext &context,
@@ -1567,9 +1626,8 @@ void LoadETC2RGB8ToRGBA8(const ImageLoadContext &context,
                          size_t outputDepthPitch,
                          bool punchthroughAlpha)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
+    ForEachBlockRowBand(context, height, depth, [&](size_t z, size_t yBegin, size_t yEnd) {
+        for (size_t y = yBegin; y < yEnd; y += 4)
         {
             const ETC2Block *sourceRow =
                 priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
@@ -1585,7 +1643,7 @@ void LoadETC2RGB8ToRGBA8(const ImageLoadContext &context,
                                          DefaultETCAlphaValues, punchthroughAlpha);
             }
         }
-    }
+    });
 }
 
 void LoadETC2RGB8ToBC1(const ImageLoadContext &context,
@@ -1600,9 +1658,8 @@ void LoadETC2RGB8ToBC1(const ImageLoadContext &context,
                        size_t outputDepthPitch,
                        bool punchthroughAlpha)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
+    ForEachBlockRowBand(context, height, depth, [&](size_t z, size_t yBegin, size_t yEnd) {
+        for (size_t y = yBegin; y < yEnd; y += 4)
         {
             const ETC2Block *sourceRow =
                 priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
@@ -1618,7 +1675,7 @@ void LoadETC2RGB8ToBC1(const ImageLoadContext &context,
                                             punchthroughAlpha);
             }
         }
-    }
+    });
 }
 
 void LoadETC2RGBA8ToRGBA8(const ImageLoadContext &context,
@@ -1633,11 +1690,11 @@ void LoadETC2RGBA8ToRGBA8(const ImageLoadContext &context,
                           size_t outputDepthPitch,
                           bool srgb)
 {
-    uint8_t decodedAlphaValues[4][4];
+    ForEachBlockRowBand(context, height, depth, [&](size_t z, size_t yBegin, size_t yEnd) {
+        // Per-band scratch so that concurrent bands don't share it.
+        uint8_t decodedAlphaValues[4][4];
 
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
+        for (size_t y = yBegin; y < yEnd; y += 4)
         {
             const ETC2Block *sourceRow =
                 priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
@@ -1657,7 +1714,7 @@ void LoadETC2RGBA8ToRGBA8(const ImageLoadContext &context,
                                             decodedAlphaValues, false);
             }
         }
-    }
+    });
 }
 
 }  // anonymous namespace
@@ -11,6 +11,7 @@
 
 #include <stdint.h>
 #include <cstddef>
+#include <cstring>
 #include <string>
 #include <vector>
 
@@ -67,6 +68,34 @@ class BinaryInputStream : angle::NonCopyable
         }
     }
 
+    // Bulk read of a vector of trivially copyable elements, as written by writePodVector: a
+    // single bounds check followed by one memcpy, avoiding the per-element checks of
+    // readIntVector.
+    template <class T>
+    void readPodVector(std::vector<T> *param)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable.");
+
+        size_t size = readInt<size_t>();
+        if (mError)
+        {
+            return;
+        }
+
+        if (size > remainingSize() / sizeof(T))
+        {
+            mError = true;
+            return;
+        }
+
+        param->resize(size);
+        if (size > 0)
+        {
+            memcpy(param->data(), mData + mOffset, size * sizeof(T));
+            mOffset += size * sizeof(T);
+        }
+    }
+
     template <class EnumT>
     EnumT readEnum()
     {
@@ -236,6 +265,21 @@ class BinaryOutputStream : angle::NonCopyable
         }
     }
 
+    // Bulk write counterpart of BinaryInputStream::readPodVector.  Unlike writeIntVector, the
+    // elements are stored verbatim, with no integer promotion.
+    template <class T>
+    void writePodVector(const std::vector<T> &param)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable.");
+
+        writeInt(param.size());
+        if (!param.empty())
+        {
+            const uint8_t *asBytes = reinterpret_cast<const uint8_t *>(param.data());
+            mData.insert(mData.end(), asBytes, asBytes + param.size() * sizeof(T));
+        }
+    }
+
     template <class EnumT>
     void writeEnum(EnumT param)
     {
@@ -85,4 +85,58 @@ TEST(BinaryStream, IntVector)
         ASSERT_EQ(writeData[i], readData[i]);
     }
 }
+
+// Test that readPodVector and writePodVector match, including for struct elements.
+TEST(BinaryStream, PodVector)
+{
+    struct PodStruct
+    {
+        uint32_t index;
+        float weight;
+        bool flag;
+    };
+
+    std::vector<PodStruct> writeData = {{1, 0.5f, false}, {2, 0.25f, true}, {3, 0.125f, false}};
+    std::vector<PodStruct> readData;
+    std::vector<unsigned int> writeInts = {1, 2, 3, 4, 5};
+    std::vector<unsigned int> readInts;
+
+    gl::BinaryOutputStream out;
+    out.writePodVector(writeData);
+    out.writePodVector(writeInts);
+
+    gl::BinaryInputStream in(out.data(), out.length());
+    in.readPodVector(&readData);
+    in.readPodVector(&readInts);
+
+    ASSERT_FALSE(in.error());
+    ASSERT_TRUE(in.endOfStream());
+
+    ASSERT_EQ(writeData.size(), readData.size());
+    for (size_t i = 0; i < writeData.size(); ++i)
+    {
+        ASSERT_EQ(writeData[i].index, readData[i].index);
+        ASSERT_EQ(writeData[i].weight, readData[i].weight);
+        ASSERT_EQ(writeData[i].flag, readData[i].flag);
+    }
+
+    ASSERT_EQ(writeInts, readInts);
+}
+
+// Test that a truncated stream fails a bulk read without resizing the output to a bogus size.
+TEST(BinaryInputStream, PodVectorTruncated)
+{
+    std::vector<unsigned int> writeData = {1, 2, 3, 4, 5};
+
+    gl::BinaryOutputStream out;
+    out.writePodVector(writeData);
+
+    // Drop the last element's bytes from the stream.
+    gl::BinaryInputStream in(out.data(), out.length() - sizeof(unsigned int));
+
+    std::vector<unsigned int> readData;
+    in.readPodVector(&readData);
+    ASSERT_TRUE(in.error());
+    ASSERT_TRUE(readData.empty());
+}
 }  // namespace angle
@@ -11,6 +11,7 @@
 #include "libANGLE/Buffer.h"
 
 #include "libANGLE/Context.h"
+#include "libANGLE/formatutils.h"
 #include "libANGLE/renderer/BufferImpl.h"
 #include "libANGLE/renderer/GLImplFactory.h"
 
@@ -20,6 +21,11 @@ namespace
 {
 constexpr angle::SubjectIndex kImplementationSubjectIndex = 0;
 constexpr size_t kInvalidContentsObserverIndex            = std::numeric_limits<size_t>::max();
+
+// Granularity at which index ranges of large element array draws are cached.  Resolving a large
+// range chunk by chunk means a partial buffer update only invalidates the cached chunks it
+// overlaps, so the following draw rescans those chunks instead of the whole range.
+constexpr size_t kIndexRangeChunkIndexCount = 64 * 1024;
 }  // anonymous namespace
 
 BufferState::BufferState()
@@ -350,14 +356,82 @@ angle::Result Buffer::getIndexRange(const gl::Context *context,
         return angle::Result::Continue;
     }
 
-    ANGLE_TRY(
-        mImpl->getIndexRange(context, type, offset, count, primitiveRestartEnabled, outRange));
+    if (count >= kIndexRangeChunkIndexCount * 2 && offset % GetDrawElementsTypeSize(type) == 0)
+    {
+        ANGLE_TRY(getChunkedIndexRange(context, type, offset, count, primitiveRestartEnabled,
+                                       outRange));
+    }
+    else
+    {
+        ANGLE_TRY(
+            mImpl->getIndexRange(context, type, offset, count, primitiveRestartEnabled, outRange));
+    }
 
     mIndexRangeCache.addRange(type, offset, count, primitiveRestartEnabled, *outRange);
 
     return angle::Result::Continue;
 }
 
+angle::Result Buffer::getChunkedIndexRange(const gl::Context *context,
+                                           DrawElementsType type,
+                                           size_t offset,
+                                           size_t count,
+                                           bool primitiveRestartEnabled,
+                                           IndexRange *outRange) const
+{
+    // Chunk boundaries are aligned to multiples of kIndexRangeChunkIndexCount elements from the
+    // start of the buffer, so draws with different offsets or counts over the same data share the
+    // cached chunks.
+    const size_t typeSize     = GetDrawElementsTypeSize(type);
+    const size_t firstElement = offset / typeSize;
+    const size_t lastElement  = firstElement + count;
+
+    IndexRange combinedRange;
+    bool hasVertexIndices = false;
+
+    for (size_t element = firstElement; element < lastElement;)
+    {
+        const size_t chunkEnd =
+            std::min((element / kIndexRangeChunkIndexCount + 1) * kIndexRangeChunkIndexCount,
+                     lastElement);
+        const size_t chunkOffset = element * typeSize;
+        const size_t chunkCount  = chunkEnd - element;
+
+        IndexRange chunkRange;
+        if (!mIndexRangeCache.findRange(type, chunkOffset, chunkCount, primitiveRestartEnabled,
+                                        &chunkRange))
+        {
+            ANGLE_TRY(mImpl->getIndexRange(context, type, chunkOffset, chunkCount,
+                                           primitiveRestartEnabled, &chunkRange));
+            mIndexRangeCache.addRange(type, chunkOffset, chunkCount, primitiveRestartEnabled,
+                                      chunkRange);
+        }
+
+        // A chunk consisting of nothing but primitive restart indices contributes no vertices.
+        if (chunkRange.vertexIndexCount > 0)
+        {
+            if (!hasVertexIndices)
+            {
+                combinedRange    = chunkRange;
+                hasVertexIndices = true;
+            }
+            else
+            {
+                combinedRange.start = std::min(combinedRange.start, chunkRange.start);
+                combinedRange.end   = std::max(combinedRange.end, chunkRange.end);
+                combinedRange.vertexIndexCount += chunkRange.vertexIndexCount;
+            }
+        }
+
+        element = chunkEnd;
+    }
+
+    // If every index in the range was a primitive restart index, combinedRange is left
+    // default-constructed, which matches what a full scan returns for such data.
+    *outRange = combinedRange;
+    return angle::Result::Continue;
+}
+
 GLint64 Buffer::getMemorySize() const
 {
     GLint64 implSize = mImpl->getMemorySize();
@@ -201,6 +201,12 @@ class Buffer final : public RefCountObject<BufferID>,
                                          GLeglClientBufferEXT clientBuffer,
                                          GLsizeiptr size,
                                          GLbitfield flags);
+    angle::Result getChunkedIndexRange(const gl::Context *context,
+                                       DrawElementsType type,
+                                       size_t offset,
+                                       size_t count,
+                                       bool primitiveRestartEnabled,
+                                       IndexRange *outRange) const;
 
     void onContentsChange();
     size_t getContentsObserverIndex(VertexArray *vertexArray, uint32_t bufferIndex) const;
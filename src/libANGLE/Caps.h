@@ -439,12 +439,21 @@ struct DisplayExtensions
     // EGL_ANGLE_query_surface_pointer
     bool querySurfacePointer = false;
 
+    // EGL_ANGLE_frame_profile
+    bool frameProfileANGLE = false;
+
+    // EGL_ANGLE_display_telemetry
+    bool displayTelemetryANGLE = false;
+
     // EGL_ANGLE_window_fixed_size
     bool windowFixedSize = false;
 
     // EGL_ANGLE_keyed_mutex
     bool keyedMutex = false;
 
+    // EGL_ANGLE_d3d11_frame_latency
+    bool d3d11FrameLatency = false;
+
     // EGL_ANGLE_surface_orientation
     bool surfaceOrientation = false;
 
@@ -664,6 +673,9 @@ struct DisplayExtensions
     // EGL_ANGLE_vulkan_image
     bool vulkanImageANGLE = false;
 
+    // EGL_ANGLE_surface_memory_fd
+    bool surfaceMemoryFdANGLE = false;
+
     // EGL_ANGLE_metal_create_context_ownership_identity
     bool metalCreateContextOwnershipIdentityANGLE = false;
 
@@ -777,6 +789,9 @@ struct ClientExtensions
     // EGL_ANGLE_feature_control
     bool featureControlANGLE = false;
 
+    // EGL_ANGLE_memory_pressure_callback
+    bool memoryPressureCallbackANGLE = false;
+
     // EGL_ANGLE_platform_angle_device_type_swiftshader
     bool platformANGLEDeviceTypeSwiftShader = false;
 
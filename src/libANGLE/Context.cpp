@@ -441,7 +441,7 @@ void SetCurrentValidContextTLS(Context *context)
     SetTLSValue(CurrentValidContextIndex, context);
 }
 #else
-thread_local Context *gCurrentValidContext = nullptr;
+thread_local Context *gCurrentValidContext ANGLE_HOT_TLS_MODEL = nullptr;
 #endif
 
 Context::Context(egl::Display *display,
@@ -475,6 +475,8 @@ Context::Context(egl::Display *display,
       mSkipValidation(GetNoError(attribs)),
       mDisplayTextureShareGroup(shareTextures != nullptr),
       mDisplaySemaphoreShareGroup(shareSemaphores != nullptr),
+      mDrawLockActive(false),
+      mDrawLockPrimed(false),
       mErrors(this),
       mImplementation(display->getImplementation()
                           ->createContext(mState, &mErrors, config, shareContext, attribs)),
@@ -1368,6 +1370,15 @@ void Context::bindVertexArray(VertexArrayID vertexArrayHandle)
     mState.setVertexArrayBinding(this, vertexArray);
     mVertexArrayObserverBinding.bind(vertexArray);
     mStateCache.onVertexArrayBindingChange(this);
+
+    // Applications tend to bind vertex arrays well before drawing with them.  Syncing the vertex
+    // array eagerly moves attribute translation and vertex format conversion off the draw call's
+    // critical path; anything that changes before the draw simply re-dirties the object and gets
+    // synced again then.
+    if (vertexArray != nullptr && vertexArray->hasAnyDirtyBit())
+    {
+        ANGLE_CONTEXT_TRY(mState.syncDirtyObject(this, GL_VERTEX_ARRAY));
+    }
 }
 
 void Context::bindVertexBuffer(GLuint bindingIndex,
@@ -2809,6 +2820,10 @@ void Context::flush()
 void Context::finish()
 {
     ANGLE_CONTEXT_TRY(mImplementation->finish(this));
+
+    // Finish is the frame boundary for contexts that never swap (offscreen rendering); recycle
+    // the frame arena here too so it cannot grow without bound.
+    mState.resetFrameArena();
 }
 
 void Context::insertEventMarker(GLsizei length, const char *marker)
@@ -2986,6 +3001,10 @@ void Context::setContextLost()
     // be called when lost, or with null object arguments, etc.
     mSkipValidation = false;
 
+    // Any active locked draw batch dies with the context for the same reason.
+    mDrawLockActive = false;
+    mDrawLockPrimed = false;
+
     // Make sure we update TLS.
 #if defined(ANGLE_PLATFORM_APPLE)
     SetCurrentValidContextTLS(nullptr);
@@ -3573,6 +3592,9 @@ void Context::reinitializeAfterExtensionsChanged()
     updateCaps();
     initExtensionStrings();
 
+    // Extension toggles change which pnames are queryable.
+    mQueryParameterInfoCache.clear();
+
     // Release the shader compiler so it will be re-created with the requested extensions enabled.
     releaseShaderCompiler();
 
@@ -3781,6 +3803,9 @@ Extensions Context::generateSupportedExtensions() const
     // Enable the no error extension if the context was created with the flag.
     supportedExtensions.noErrorKHR = mSkipValidation;
 
+    // GL_ANGLE_lock_draws is implemented in the frontend.
+    supportedExtensions.lockDrawsANGLE = true;
+
     // Enable surfaceless to advertise we'll have the correct behavior when there is no default FBO
     supportedExtensions.surfacelessContextOES = mSurfacelessSupported;
 
@@ -5765,9 +5790,10 @@ void Context::blendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha
 
 void Context::blendEquation(GLenum mode)
 {
-    mState.setBlendEquation(mode, mode);
-
-    mStateCache.onBlendEquationChange(this);
+    if (mState.setBlendEquation(mode, mode))
+    {
+        mStateCache.onBlendEquationChange(this);
+    }
 }
 
 void Context::blendEquationi(GLuint buf, GLenum mode)
@@ -5838,9 +5864,11 @@ void Context::clearStencil(GLint s)
 
 void Context::colorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
 {
-    mState.setColorMask(ConvertToBool(red), ConvertToBool(green), ConvertToBool(blue),
-                        ConvertToBool(alpha));
-    mStateCache.onColorMaskChange(this);
+    if (mState.setColorMask(ConvertToBool(red), ConvertToBool(green), ConvertToBool(blue),
+                            ConvertToBool(alpha)))
+    {
+        mStateCache.onColorMaskChange(this);
+    }
 }
 
 void Context::colorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
@@ -5877,12 +5905,25 @@ void Context::clipControl(GLenum origin, GLenum depth)
 
 void Context::disable(GLenum cap)
 {
+    // Redundant glEnable/glDisable calls are common and invalidate the cached draw validation
+    // state, so filter them out here.  GL_BLEND is excluded: after indexed glEnablei/glDisablei
+    // calls the non-indexed setter must reapply the common value to every draw buffer.
+    if (cap != GL_BLEND && mState.getEnableFeature(cap) == false)
+    {
+        return;
+    }
+
     mState.setEnableFeature(cap, false);
     mStateCache.onContextCapChange(this);
 }
 
 void Context::disablei(GLenum target, GLuint index)
 {
+    if (mState.getEnableFeatureIndexed(target, index) == false)
+    {
+        return;
+    }
+
     mState.setEnableFeatureIndexed(target, false, index);
     mStateCache.onContextCapChange(this);
 }
@@ -5895,12 +5936,23 @@ void Context::disableVertexAttribArray(GLuint index)
 
 void Context::enable(GLenum cap)
 {
+    // See the note on redundant calls in Context::disable.
+    if (cap != GL_BLEND && mState.getEnableFeature(cap) == true)
+    {
+        return;
+    }
+
     mState.setEnableFeature(cap, true);
     mStateCache.onContextCapChange(this);
 }
 
 void Context::enablei(GLenum target, GLuint index)
 {
+    if (mState.getEnableFeatureIndexed(target, index) == true)
+    {
+        return;
+    }
+
     mState.setEnableFeatureIndexed(target, true, index);
     mStateCache.onContextCapChange(this);
 }
@@ -6038,32 +6090,40 @@ void Context::shadingRateQCOM(GLenum rate)
 void Context::stencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask)
 {
     GLint clampedRef = gl::clamp(ref, 0, std::numeric_limits<uint8_t>::max());
+    bool changed     = false;
     if (face == GL_FRONT || face == GL_FRONT_AND_BACK)
     {
-        mState.setStencilParams(func, clampedRef, mask);
+        changed = mState.setStencilParams(func, clampedRef, mask);
     }
 
     if (face == GL_BACK || face == GL_FRONT_AND_BACK)
     {
-        mState.setStencilBackParams(func, clampedRef, mask);
+        changed = mState.setStencilBackParams(func, clampedRef, mask) || changed;
     }
 
-    mStateCache.onStencilStateChange(this);
+    if (changed)
+    {
+        mStateCache.onStencilStateChange(this);
+    }
 }
 
 void Context::stencilMaskSeparate(GLenum face, GLuint mask)
 {
+    bool changed = false;
     if (face == GL_FRONT || face == GL_FRONT_AND_BACK)
     {
-        mState.setStencilWritemask(mask);
+        changed = mState.setStencilWritemask(mask);
     }
 
     if (face == GL_BACK || face == GL_FRONT_AND_BACK)
     {
-        mState.setStencilBackWritemask(mask);
+        changed = mState.setStencilBackWritemask(mask) || changed;
     }
 
-    mStateCache.onStencilStateChange(this);
+    if (changed)
+    {
+        mStateCache.onStencilStateChange(this);
+    }
 }
 
 void Context::stencilOpSeparate(GLenum face, GLenum fail, GLenum zfail, GLenum zpass)
@@ -7024,10 +7084,17 @@ void Context::compileShader(ShaderProgramID shader)
 
 void Context::deleteBuffers(GLsizei n, const BufferID *buffers)
 {
+    // Detach per handle, then hand the whole array to the manager so the map walk and handle
+    // release are batched; large teardowns delete tens of thousands of objects in one call.
     for (int i = 0; i < n; i++)
     {
-        deleteBuffer(buffers[i]);
+        Buffer *buffer = mState.mBufferManager->getBuffer(buffers[i]);
+        if (buffer)
+        {
+            detachBuffer(buffer);
+        }
     }
+    mState.mBufferManager->deleteObjects(this, buffers, n);
 }
 
 void Context::deleteFramebuffers(GLsizei n, const FramebufferID *framebuffers)
@@ -7045,19 +7112,24 @@ void Context::deleteRenderbuffers(GLsizei n, const RenderbufferID *renderbuffers
 {
     for (int i = 0; i < n; i++)
     {
-        deleteRenderbuffer(renderbuffers[i]);
+        if (mState.mRenderbufferManager->getRenderbuffer(renderbuffers[i]))
+        {
+            detachRenderbuffer(renderbuffers[i]);
+        }
     }
+    mState.mRenderbufferManager->deleteObjects(this, renderbuffers, n);
 }
 
 void Context::deleteTextures(GLsizei n, const TextureID *textures)
 {
     for (int i = 0; i < n; i++)
     {
-        if (textures[i].value != 0)
+        if (textures[i].value != 0 && mState.mTextureManager->getTexture(textures[i]))
         {
-            deleteTexture(textures[i]);
+            detachTexture(textures[i]);
         }
     }
+    mState.mTextureManager->deleteObjects(this, textures, n);
 }
 
 void Context::detachShader(ShaderProgramID program, ShaderProgramID shader)
@@ -9261,7 +9333,20 @@ void Context::texStorage1D(GLenum target, GLsizei levels, GLenum internalformat,
 
 bool Context::getQueryParameterInfo(GLenum pname, GLenum *type, unsigned int *numParams) const
 {
-    return GetQueryParameterInfo(mState, pname, type, numParams);
+    // This runs at least twice per glGet* call (once for validation, once for the query itself)
+    // and the underlying classification is a large switch over every queryable pname, so memoize
+    // the result.  The cache is reset when an extension request changes the extension set.
+    auto iter = mQueryParameterInfoCache.find(pname);
+    if (iter == mQueryParameterInfoCache.end())
+    {
+        QueryParameterInfo info = {GL_NONE, 0, false};
+        info.queryable = GetQueryParameterInfo(mState, pname, &info.nativeType, &info.numParams);
+        iter           = mQueryParameterInfoCache.insert({pname, info}).first;
+    }
+
+    *type      = iter->second.nativeType;
+    *numParams = iter->second.numParams;
+    return iter->second.queryable;
 }
 
 bool Context::getIndexedQueryParameterInfo(GLenum target,
@@ -9456,7 +9541,12 @@ bool Context::isGLES1() const
 
 std::shared_ptr<angle::WorkerThreadPool> Context::getShaderCompileThreadPool() const
 {
-    if (mState.mExtensions.parallelShaderCompileKHR && mState.getMaxShaderCompilerThreads() > 0)
+    // Each translation session is self-contained: the pool allocator is thread-local and the
+    // built-in symbol tables are immutable, so compiles can always go to the shared worker pool,
+    // not just when the application opts in through KHR_parallel_shader_compile.  Results are
+    // resolved (blocking if necessary) whenever the compile status or the translated code is
+    // needed.  An explicit glMaxShaderCompilerThreadsKHR(0) request still forces serial compiles.
+    if (mState.getMaxShaderCompilerThreads() > 0)
     {
         return mDisplay->getMultiThreadPool();
     }
@@ -9684,6 +9774,12 @@ void Context::onPreSwap()
     getShareGroup()->getFrameCaptureShared()->onEndFrame(this);
 }
 
+void Context::onPostSwap() const
+{
+    // The frame's transient allocations are dead now; recycle their pages for the next frame.
+    mState.resetFrameArena();
+}
+
 void Context::getTexImage(TextureTarget target,
                           GLint level,
                           GLenum format,
@@ -9717,6 +9813,20 @@ void Context::logicOpANGLE(LogicalOperation opcodePacked)
     mState.setLogicOp(opcodePacked);
 }
 
+void Context::beginLockedDraws()
+{
+    // The first draw of the batch performs a normal full sync and then primes the lock; see
+    // prepareForDraw().
+    mDrawLockActive = true;
+    mDrawLockPrimed = false;
+}
+
+void Context::endLockedDraws()
+{
+    mDrawLockActive = false;
+    mDrawLockPrimed = false;
+}
+
 egl::Error Context::releaseHighPowerGPU()
 {
     return mImplementation->releaseHighPowerGPU(this);
@@ -10004,9 +10114,12 @@ GLenum ErrorSet::popError()
 
 // StateCache implementation.
 StateCache::StateCache()
-    : mCachedHasAnyEnabledClientAttrib(false),
+    : mContext(nullptr),
+      mCachedHasAnyEnabledClientAttrib(false),
+      mCachedActiveAttribsMaskValid(false),
       mCachedNonInstancedVertexElementLimit(0),
       mCachedInstancedVertexElementLimit(0),
+      mCachedVertexElementLimitsValid(false),
       mCachedBasicDrawStatesError(kInvalidPointer),
       mCachedBasicDrawElementsError(kInvalidPointer),
       mCachedProgramPipelineError(kInvalidPointer),
@@ -10018,16 +10131,19 @@ StateCache::StateCache()
 
 StateCache::~StateCache() = default;
 
-ANGLE_INLINE void StateCache::updateVertexElementLimits(Context *context)
+void StateCache::updateVertexElementLimits() const
 {
-    if (context->isBufferAccessValidationEnabled())
+    mCachedVertexElementLimitsValid = true;
+
+    if (mContext->isBufferAccessValidationEnabled())
     {
-        updateVertexElementLimitsImpl(context);
+        updateVertexElementLimitsImpl();
     }
 }
 
 void StateCache::initialize(Context *context)
 {
+    mContext = context;
     updateValidDrawModes(context);
     updateValidBindTextureTypes(context);
     updateValidDrawElementsTypes(context);
@@ -10037,10 +10153,12 @@ void StateCache::initialize(Context *context)
     updateCanDraw(context);
 }
 
-void StateCache::updateActiveAttribsMask(Context *context)
+void StateCache::updateActiveAttribsMask() const
 {
-    bool isGLES1         = context->isGLES1();
-    const State &glState = context->getState();
+    mCachedActiveAttribsMaskValid = true;
+
+    bool isGLES1         = mContext->isGLES1();
+    const State &glState = mContext->getState();
 
     if (!isGLES1 && !glState.getProgramExecutable())
     {
@@ -10067,11 +10185,15 @@ void StateCache::updateActiveAttribsMask(Context *context)
     mCachedHasAnyEnabledClientAttrib = (clientAttribs & enabledAttribs).any();
 }
 
-void StateCache::updateVertexElementLimitsImpl(Context *context)
+void StateCache::updateVertexElementLimitsImpl() const
 {
-    ASSERT(context->isBufferAccessValidationEnabled());
+    ASSERT(mContext->isBufferAccessValidationEnabled());
+
+    // The limits are computed from the buffered attribs mask, which may itself be pending
+    // recomputation.
+    ensureActiveAttribsMaskValid();
 
-    const VertexArray *vao = context->getState().getVertexArray();
+    const VertexArray *vao = mContext->getState().getVertexArray();
 
     mCachedNonInstancedVertexElementLimit = std::numeric_limits<GLint64>::max();
     mCachedInstancedVertexElementLimit    = std::numeric_limits<GLint64>::max();
@@ -10091,8 +10213,8 @@ void StateCache::updateVertexElementLimitsImpl(Context *context)
         const VertexAttribute &attrib = vertexAttribs[attributeIndex];
 
         const VertexBinding &binding = vertexBindings[attrib.bindingIndex];
-        ASSERT(context->isGLES1() ||
-               context->getState().getProgramExecutable()->isAttribLocationActive(attributeIndex));
+        ASSERT(mContext->isGLES1() ||
+               mContext->getState().getProgramExecutable()->isAttribLocationActive(attributeIndex));
 
         GLint64 limit = attrib.getCachedElementLimit();
         if (binding.getDivisor() > 0)
@@ -10144,18 +10266,24 @@ intptr_t StateCache::getBasicDrawElementsErrorImpl(const Context *context) const
     return mCachedBasicDrawElementsError;
 }
 
+void StateCache::invalidateValidatedDrawCalls()
+{
+    mValidatedDrawArraysCall.valid   = false;
+    mValidatedDrawElementsCall.valid = false;
+}
+
 void StateCache::onVertexArrayBindingChange(Context *context)
 {
-    updateActiveAttribsMask(context);
-    updateVertexElementLimits(context);
+    invalidateValidatedDrawCalls();
+    invalidateActiveAttribsMask();
     updateBasicDrawStatesError();
     updateBasicDrawElementsError();
 }
 
 void StateCache::onProgramExecutableChange(Context *context)
 {
-    updateActiveAttribsMask(context);
-    updateVertexElementLimits(context);
+    invalidateValidatedDrawCalls();
+    invalidateActiveAttribsMask();
     updateBasicDrawStatesError();
     updateProgramPipelineError();
     updateValidDrawModes(context);
@@ -10166,66 +10294,77 @@ void StateCache::onProgramExecutableChange(Context *context)
 
 void StateCache::onVertexArrayFormatChange(Context *context)
 {
-    updateVertexElementLimits(context);
+    invalidateValidatedDrawCalls();
+    invalidateVertexElementLimits();
 }
 
 void StateCache::onVertexArrayBufferContentsChange(Context *context)
 {
-    updateVertexElementLimits(context);
+    invalidateValidatedDrawCalls();
+    invalidateVertexElementLimits();
     updateBasicDrawStatesError();
 }
 
 void StateCache::onVertexArrayStateChange(Context *context)
 {
-    updateActiveAttribsMask(context);
-    updateVertexElementLimits(context);
+    invalidateValidatedDrawCalls();
+    invalidateActiveAttribsMask();
     updateBasicDrawStatesError();
     updateBasicDrawElementsError();
 }
 
 void StateCache::onVertexArrayBufferStateChange(Context *context)
 {
+    invalidateValidatedDrawCalls();
     updateBasicDrawStatesError();
     updateBasicDrawElementsError();
 }
 
 void StateCache::onGLES1ClientStateChange(Context *context)
 {
-    updateActiveAttribsMask(context);
+    invalidateValidatedDrawCalls();
+    invalidateActiveAttribsMask();
 }
 
 void StateCache::onDrawFramebufferChange(Context *context)
 {
+    invalidateValidatedDrawCalls();
     updateBasicDrawStatesError();
 }
 
 void StateCache::onContextCapChange(Context *context)
 {
+    invalidateValidatedDrawCalls();
     updateBasicDrawStatesError();
 }
 
 void StateCache::onStencilStateChange(Context *context)
 {
+    invalidateValidatedDrawCalls();
     updateBasicDrawStatesError();
 }
 
 void StateCache::onDefaultVertexAttributeChange(Context *context)
 {
+    invalidateValidatedDrawCalls();
     updateBasicDrawStatesError();
 }
 
 void StateCache::onActiveTextureChange(Context *context)
 {
+    invalidateValidatedDrawCalls();
     updateBasicDrawStatesError();
 }
 
 void StateCache::onQueryChange(Context *context)
 {
+    invalidateValidatedDrawCalls();
     updateBasicDrawStatesError();
 }
 
 void StateCache::onActiveTransformFeedbackChange(Context *context)
 {
+    invalidateValidatedDrawCalls();
     updateTransformFeedbackActiveUnpaused(context);
     updateBasicDrawStatesError();
     updateBasicDrawElementsError();
@@ -10234,31 +10373,37 @@ void StateCache::onActiveTransformFeedbackChange(Context *context)
 
 void StateCache::onUniformBufferStateChange(Context *context)
 {
+    invalidateValidatedDrawCalls();
     updateBasicDrawStatesError();
 }
 
 void StateCache::onAtomicCounterBufferStateChange(Context *context)
 {
+    invalidateValidatedDrawCalls();
     updateBasicDrawStatesError();
 }
 
 void StateCache::onShaderStorageBufferStateChange(Context *context)
 {
+    invalidateValidatedDrawCalls();
     updateBasicDrawStatesError();
 }
 
 void StateCache::onColorMaskChange(Context *context)
 {
+    invalidateValidatedDrawCalls();
     updateBasicDrawStatesError();
 }
 
 void StateCache::onBlendFuncIndexedChange(Context *context)
 {
+    invalidateValidatedDrawCalls();
     updateBasicDrawStatesError();
 }
 
 void StateCache::onBlendEquationChange(Context *context)
 {
+    invalidateValidatedDrawCalls();
     updateBasicDrawStatesError();
 }
 
@@ -122,18 +122,38 @@ class StateCache final : angle::NonCopyable
 
     void initialize(Context *context);
 
-    // Places that can trigger updateActiveAttribsMask:
+    // The active attribs mask and vertex element limits are recomputed lazily on first use, so a
+    // burst of notifications - binding a vertex array mutates every attribute - costs one
+    // recompute instead of one per mutation.
+    //
+    // Places that can invalidate the active attribs mask:
     // 1. onVertexArrayBindingChange.
     // 2. onProgramExecutableChange.
     // 3. onVertexArrayStateChange.
     // 4. onGLES1ClientStateChange.
-    AttributesMask getActiveBufferedAttribsMask() const { return mCachedActiveBufferedAttribsMask; }
-    AttributesMask getActiveClientAttribsMask() const { return mCachedActiveClientAttribsMask; }
-    AttributesMask getActiveDefaultAttribsMask() const { return mCachedActiveDefaultAttribsMask; }
-    bool hasAnyEnabledClientAttrib() const { return mCachedHasAnyEnabledClientAttrib; }
-    bool hasAnyActiveClientAttrib() const { return mCachedActiveClientAttribsMask.any(); }
+    AttributesMask getActiveBufferedAttribsMask() const
+    {
+        ensureActiveAttribsMaskValid();
+        return mCachedActiveBufferedAttribsMask;
+    }
+    AttributesMask getActiveClientAttribsMask() const
+    {
+        ensureActiveAttribsMaskValid();
+        return mCachedActiveClientAttribsMask;
+    }
+    AttributesMask getActiveDefaultAttribsMask() const
+    {
+        ensureActiveAttribsMaskValid();
+        return mCachedActiveDefaultAttribsMask;
+    }
+    bool hasAnyEnabledClientAttrib() const
+    {
+        ensureActiveAttribsMaskValid();
+        return mCachedHasAnyEnabledClientAttrib;
+    }
+    bool hasAnyActiveClientAttrib() const { return getActiveClientAttribsMask().any(); }
 
-    // Places that can trigger updateVertexElementLimits:
+    // Places that can invalidate the vertex element limits:
     // 1. onVertexArrayBindingChange.
     // 2. onProgramExecutableChange.
     // 3. onVertexArrayFormatChange.
@@ -141,9 +161,14 @@ class StateCache final : angle::NonCopyable
     // 5. onVertexArrayStateChange.
     GLint64 getNonInstancedVertexElementLimit() const
     {
+        ensureVertexElementLimitsValid();
         return mCachedNonInstancedVertexElementLimit;
     }
-    GLint64 getInstancedVertexElementLimit() const { return mCachedInstancedVertexElementLimit; }
+    GLint64 getInstancedVertexElementLimit() const
+    {
+        ensureVertexElementLimitsValid();
+        return mCachedInstancedVertexElementLimit;
+    }
 
     // Places that can trigger updateBasicDrawStatesError:
     // 1. onVertexArrayBindingChange.
@@ -266,6 +291,52 @@ class StateCache final : angle::NonCopyable
     // 1. onProgramExecutableChange.
     bool getCanDraw() const { return mCachedCanDraw; }
 
+    // A memo of the arguments of the last successfully validated draw call.  Every state change
+    // notification invalidates it, so a repeat draw whose memo is still intact is known to be
+    // valid without re-running the per-argument checks.  Transform feedback consumes buffer space
+    // as draws are issued without any notification, so the memo is not used while it is active.
+    bool isValidatedDrawArraysCall(PrimitiveMode mode,
+                                   GLint first,
+                                   GLsizei count,
+                                   GLsizei primcount) const
+    {
+        return mValidatedDrawArraysCall.valid && !mCachedTransformFeedbackActiveUnpaused &&
+               mValidatedDrawArraysCall.mode == mode && mValidatedDrawArraysCall.first == first &&
+               mValidatedDrawArraysCall.count == count &&
+               mValidatedDrawArraysCall.primcount == primcount;
+    }
+
+    void setValidatedDrawArraysCall(PrimitiveMode mode,
+                                    GLint first,
+                                    GLsizei count,
+                                    GLsizei primcount) const
+    {
+        mValidatedDrawArraysCall = {mode, first, count, primcount, true};
+    }
+
+    bool isValidatedDrawElementsCall(PrimitiveMode mode,
+                                     GLsizei count,
+                                     DrawElementsType type,
+                                     const void *indices,
+                                     GLsizei primcount) const
+    {
+        return mValidatedDrawElementsCall.valid && !mCachedTransformFeedbackActiveUnpaused &&
+               mValidatedDrawElementsCall.mode == mode &&
+               mValidatedDrawElementsCall.count == count &&
+               mValidatedDrawElementsCall.type == type &&
+               mValidatedDrawElementsCall.indices == indices &&
+               mValidatedDrawElementsCall.primcount == primcount;
+    }
+
+    void setValidatedDrawElementsCall(PrimitiveMode mode,
+                                      GLsizei count,
+                                      DrawElementsType type,
+                                      const void *indices,
+                                      GLsizei primcount) const
+    {
+        mValidatedDrawElementsCall = {mode, count, type, indices, primcount, true};
+    }
+
     // State change notifications.
     void onVertexArrayBindingChange(Context *context);
     void onProgramExecutableChange(Context *context);
@@ -291,9 +362,9 @@ class StateCache final : angle::NonCopyable
 
   private:
     // Cache update functions.
-    void updateActiveAttribsMask(Context *context);
-    void updateVertexElementLimits(Context *context);
-    void updateVertexElementLimitsImpl(Context *context);
+    void updateActiveAttribsMask() const;
+    void updateVertexElementLimits() const;
+    void updateVertexElementLimitsImpl() const;
     void updateValidDrawModes(Context *context);
     void updateValidBindTextureTypes(Context *context);
     void updateValidDrawElementsTypes(Context *context);
@@ -305,6 +376,31 @@ class StateCache final : angle::NonCopyable
     void updateActiveShaderStorageBufferIndices(Context *context);
     void updateActiveImageUnitIndices(Context *context);
     void updateCanDraw(Context *context);
+    void invalidateValidatedDrawCalls();
+
+    // Invalidating the active attribs mask also invalidates the vertex element limits, which are
+    // computed from it.
+    void invalidateActiveAttribsMask()
+    {
+        mCachedActiveAttribsMaskValid   = false;
+        mCachedVertexElementLimitsValid = false;
+    }
+    void invalidateVertexElementLimits() { mCachedVertexElementLimitsValid = false; }
+
+    void ensureActiveAttribsMaskValid() const
+    {
+        if (!mCachedActiveAttribsMaskValid)
+        {
+            updateActiveAttribsMask();
+        }
+    }
+    void ensureVertexElementLimitsValid() const
+    {
+        if (!mCachedVertexElementLimitsValid)
+        {
+            updateVertexElementLimits();
+        }
+    }
 
     void setValidDrawModes(bool pointsOK,
                            bool linesOK,
@@ -319,12 +415,15 @@ class StateCache final : angle::NonCopyable
 
     static constexpr intptr_t kInvalidPointer = 1;
 
-    AttributesMask mCachedActiveBufferedAttribsMask;
-    AttributesMask mCachedActiveClientAttribsMask;
-    AttributesMask mCachedActiveDefaultAttribsMask;
-    bool mCachedHasAnyEnabledClientAttrib;
-    GLint64 mCachedNonInstancedVertexElementLimit;
-    GLint64 mCachedInstancedVertexElementLimit;
+    Context *mContext;
+    mutable AttributesMask mCachedActiveBufferedAttribsMask;
+    mutable AttributesMask mCachedActiveClientAttribsMask;
+    mutable AttributesMask mCachedActiveDefaultAttribsMask;
+    mutable bool mCachedHasAnyEnabledClientAttrib;
+    mutable bool mCachedActiveAttribsMaskValid;
+    mutable GLint64 mCachedNonInstancedVertexElementLimit;
+    mutable GLint64 mCachedInstancedVertexElementLimit;
+    mutable bool mCachedVertexElementLimitsValid;
     mutable intptr_t mCachedBasicDrawStatesError;
     mutable intptr_t mCachedBasicDrawElementsError;
     // mCachedProgramPipelineError checks only the
@@ -357,6 +456,26 @@ class StateCache final : angle::NonCopyable
         mCachedIntegerVertexAttribTypesValidation;
 
     bool mCachedCanDraw;
+
+    struct ValidatedDrawArraysCall
+    {
+        PrimitiveMode mode;
+        GLint first;
+        GLsizei count;
+        GLsizei primcount;
+        bool valid = false;
+    };
+    struct ValidatedDrawElementsCall
+    {
+        PrimitiveMode mode;
+        GLsizei count;
+        DrawElementsType type;
+        const void *indices;
+        GLsizei primcount;
+        bool valid = false;
+    };
+    mutable ValidatedDrawArraysCall mValidatedDrawArraysCall;
+    mutable ValidatedDrawElementsCall mValidatedDrawElementsCall;
 };
 
 using VertexArrayMap       = ResourceMap<VertexArray, VertexArrayID>;
@@ -562,9 +681,18 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
         // Ensure we don't skip validation when context becomes lost, since implementations
         // generally assume a non-lost context, non-null objects, etc.
         ASSERT(!isContextLost() || !mSkipValidation);
+#if !defined(ANGLE_ENABLE_ASSERTS)
+        // After the first draw of a GL_ANGLE_lock_draws batch, validation is skipped entirely.
+        // Debug builds keep validating so applications that break the batch's immutability
+        // promise are caught instead of silently rendering incorrectly.
+        return mSkipValidation || mDrawLockPrimed;
+#else
         return mSkipValidation;
+#endif
     }
 
+    bool isLockedDrawsActive() const { return mDrawLockActive; }
+
     // Specific methods needed for validation.
     bool getQueryParameterInfo(GLenum pname, GLenum *type, unsigned int *numParams) const;
     bool getIndexedQueryParameterInfo(GLenum target, GLenum *type, unsigned int *numParams) const;
@@ -639,6 +767,7 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     }
 
     void onPreSwap();
+    void onPostSwap() const;
 
     Program *getActiveLinkedProgram() const;
 
@@ -736,6 +865,13 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     bool mDisplayTextureShareGroup;
     bool mDisplaySemaphoreShareGroup;
 
+    // GL_ANGLE_lock_draws state.  |mDrawLockActive| is set between Begin/EndLockedDrawsANGLE;
+    // |mDrawLockPrimed| is additionally set once the first draw of the batch has performed a full
+    // state sync, after which subsequent draws skip validation, state sync and dirty bit
+    // processing until the lock ends.
+    bool mDrawLockActive;
+    bool mDrawLockPrimed;
+
     // Recorded errors
     ErrorSet mErrors;
 
@@ -837,6 +973,17 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     // Cache representation of the serialized context string.
     mutable std::string mCachedSerializedStateString;
 
+    // Memoized glGet* reflection info (native type and component count per pname).  The
+    // classification depends only on the client version and the enabled extensions, so entries
+    // stay valid until an extension request changes the extension set.
+    struct QueryParameterInfo
+    {
+        GLenum nativeType;
+        unsigned int numParams;
+        bool queryable;
+    };
+    mutable angle::HashMap<GLenum, QueryParameterInfo> mQueryParameterInfoCache;
+
     mutable size_t mRefCount;
 
     OverlayType mOverlay;
@@ -876,7 +1023,7 @@ class [[nodiscard]] ScopedContextRef
 extern Context *GetCurrentValidContextTLS();
 extern void SetCurrentValidContextTLS(Context *context);
 #else
-extern thread_local Context *gCurrentValidContext;
+extern thread_local Context *gCurrentValidContext ANGLE_HOT_TLS_MODEL;
 #endif
 
 }  // namespace gl
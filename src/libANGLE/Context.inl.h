@@ -114,10 +114,25 @@ ANGLE_INLINE angle::Result Context::prepareForDraw(PrimitiveMode mode)
         ANGLE_TRY(mGLES1Renderer->prepareForDraw(mode, this, &mState));
     }
 
+    if (mDrawLockPrimed)
+    {
+        // GL_ANGLE_lock_draws: the application promised that no state changes between the draws
+        // of a locked batch, and the first draw of the batch performed a full sync.  Catch broken
+        // promises in debug builds; GL state changed mid-batch has undefined results.
+        ASSERT(mState.getDirtyBits().none());
+        return angle::Result::Continue;
+    }
+
     ANGLE_TRY(syncDirtyObjects(mDrawDirtyObjects, Command::Draw));
     ASSERT(!isRobustResourceInitEnabled() ||
            !mState.getDrawFramebuffer()->hasResourceThatNeedsInit());
-    return syncDirtyBits(Command::Draw);
+    ANGLE_TRY(syncDirtyBits(Command::Draw));
+
+    // The first draw after glBeginLockedDrawsANGLE primes the lock; later draws in the batch
+    // take the early-out above.
+    mDrawLockPrimed = mDrawLockActive;
+
+    return angle::Result::Continue;
 }
 
 ANGLE_INLINE void Context::drawArrays(PrimitiveMode mode, GLint first, GLsizei count)
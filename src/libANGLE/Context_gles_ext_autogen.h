@@ -371,6 +371,9 @@
     void getRenderbufferImage(GLenum target, GLenum format, GLenum type, void *pixels);            \
     /* GL_ANGLE_get_serialized_context_string */                                                   \
     /* GL_ANGLE_get_tex_level_parameter */                                                         \
+    /* GL_ANGLE_lock_draws */                                                                      \
+    void beginLockedDraws();                                                                       \
+    void endLockedDraws();                                                                         \
     /* GL_ANGLE_logic_op */                                                                        \
     void logicOpANGLE(LogicalOperation opcodePacked);                                              \
     /* GL_ANGLE_lossy_etc_decode */                                                                \
@@ -34,6 +34,7 @@
 #include "libANGLE/EGLSync.h"
 #include "libANGLE/Image.h"
 #include "libANGLE/ResourceManager.h"
+#include "libANGLE/SharedBlobCache.h"
 #include "libANGLE/Stream.h"
 #include "libANGLE/Surface.h"
 #include "libANGLE/Thread.h"
@@ -99,6 +100,13 @@ T GetResourceFromHashSet(IDType id, SetT &hashSet)
 namespace egl
 {
 
+// The telemetry counter block is handed to applications as ANGLETelemetryCounters; the internal
+// atomic representation must mirror its layout and be safe to sample from another thread.
+static_assert(sizeof(TelemetryCounters) == sizeof(ANGLETelemetryCounters),
+              "TelemetryCounters must mirror ANGLETelemetryCounters");
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "Telemetry counters must be lock-free for out-of-thread sampling");
+
 namespace
 {
 
@@ -995,6 +1003,16 @@ Error Display::initialize()
     ASSERT(mImplementation != nullptr);
     mImplementation->setBlobCache(&mBlobCache);
 
+    // Register the memory pressure callback before the backend initializes so allocations made
+    // during initialization are already accounted against the budget.
+    EGLAttrib memoryPressureCallback = mAttributeMap.get(EGL_MEMORY_PRESSURE_CALLBACK_ANGLE, 0);
+    if (memoryPressureCallback != 0)
+    {
+        mImplementation->getMemoryBudgetTracker()->setPressureCallback(
+            reinterpret_cast<rx::MemoryBudgetTracker::PressureCallback>(memoryPressureCallback),
+            reinterpret_cast<void *>(mAttributeMap.get(EGL_MEMORY_PRESSURE_USER_PARAM_ANGLE, 0)));
+    }
+
     // Enable shader caching if debug layers are turned on. This allows us to test that shaders are
     // properly saved & restored on all platforms. The cache won't allocate space until it's used
     // and will be ignored entirely if the application / system sets it's own cache functions.
@@ -1003,6 +1021,24 @@ Error Display::initialize()
         mBlobCache.resize(1024 * 1024);
     }
 
+    // Optionally share the blob cache with other ANGLE processes on the device through a named
+    // shared-memory segment, so only one process pays for warming the cache at boot.
+    // Application-provided callbacks take precedence if the application sets them later.
+    if (!mBlobCache.areBlobCacheFuncsSet())
+    {
+        std::string sharedCacheName = angle::GetEnvironmentVar("ANGLE_SHARED_BLOB_CACHE");
+        if (!sharedCacheName.empty())
+        {
+            constexpr size_t kSharedBlobCacheSize = 16 * 1024 * 1024;
+            SharedBlobCache *sharedCache          = SharedBlobCache::GetProcessCache();
+            if (sharedCache->valid() ||
+                sharedCache->attach(sharedCacheName.c_str(), kSharedBlobCacheSize))
+            {
+                setBlobCacheFuncs(SharedBlobCache::SetBlob, SharedBlobCache::GetBlob);
+            }
+        }
+    }
+
     setGlobalDebugAnnotator();
 
     gl::InitializeDebugMutexIfNeeded();
@@ -1014,20 +1050,40 @@ Error Display::initialize()
         return NoError();
     }
 
-    Error error = mImplementation->initialize(this);
-    if (error.isError())
+    // Create the worker thread pools before backend initialization so the backend can
+    // parallelize its own probe stages (e.g. format capability queries) during bring-up.
+    mSingleThreadPool = angle::WorkerThreadPool::Create(1, ANGLEPlatformCurrent());
+    mMultiThreadPool  = angle::WorkerThreadPool::Create(0, ANGLEPlatformCurrent());
+
+    // Startup timeline markers: each initialization stage reports its duration through the
+    // platform histogram surface, so cold-start regressions can be attributed to a stage.
+    SCOPED_ANGLE_HISTOGRAM_TIMER("GPU.ANGLE.DisplayInitializeMS");
+
     {
-        // Log extended error message here
-        ERR() << "ANGLE Display::initialize error " << error.getID() << ": " << error.getMessage();
-        return error;
+        SCOPED_ANGLE_HISTOGRAM_TIMER("GPU.ANGLE.DisplayInitializeBackendMS");
+        Error error = mImplementation->initialize(this);
+        if (error.isError())
+        {
+            // Log extended error message here
+            ERR() << "ANGLE Display::initialize error " << error.getID() << ": "
+                  << error.getMessage();
+            mSingleThreadPool.reset();
+            mMultiThreadPool.reset();
+            return error;
+        }
     }
 
-    mCaps = mImplementation->getCaps();
+    {
+        SCOPED_ANGLE_HISTOGRAM_TIMER("GPU.ANGLE.DisplayCapsGenerationMS");
+        mCaps      = mImplementation->getCaps();
+        mConfigSet = mImplementation->generateConfigs();
+    }
 
-    mConfigSet = mImplementation->generateConfigs();
     if (mConfigSet.size() == 0)
     {
         mImplementation->terminate();
+        mSingleThreadPool.reset();
+        mMultiThreadPool.reset();
         return EglNotInitialized() << "No configs were generated.";
     }
 
@@ -1070,7 +1126,7 @@ Error Display::initialize()
     {
         std::unique_ptr<rx::DeviceImpl> impl(mImplementation->createDevice());
         ASSERT(impl);
-        error = impl->initialize();
+        Error error = impl->initialize();
         if (error.isError())
         {
             ERR() << "Failed to initialize display because device creation failed: "
@@ -1087,9 +1143,6 @@ Error Display::initialize()
         mDevice = nullptr;
     }
 
-    mSingleThreadPool = angle::WorkerThreadPool::Create(1, ANGLEPlatformCurrent());
-    mMultiThreadPool  = angle::WorkerThreadPool::Create(0, ANGLEPlatformCurrent());
-
     mInitialized = true;
 
     return NoError();
@@ -2059,10 +2112,11 @@ static ClientExtensions GenerateClientExtensions()
     extensions.displayPowerPreferenceANGLE = true;
 #endif
 
-    extensions.clientGetAllProcAddresses = true;
-    extensions.debug                     = true;
-    extensions.featureControlANGLE       = true;
-    extensions.deviceQueryEXT            = true;
+    extensions.clientGetAllProcAddresses   = true;
+    extensions.debug                       = true;
+    extensions.featureControlANGLE         = true;
+    extensions.memoryPressureCallbackANGLE = true;
+    extensions.deviceQueryEXT              = true;
 
     return extensions;
 }
@@ -2451,12 +2505,36 @@ EGLAttrib Display::queryAttrib(const EGLint attribute)
             value = mFeatures.size();
             break;
 
+        case EGL_TELEMETRY_COUNTERS_ANGLE:
+            // Handing the block out arms the per-frame counter update.
+            mTelemetryActive.store(true, std::memory_order_relaxed);
+            value = reinterpret_cast<EGLAttrib>(&mTelemetryCounters);
+            break;
+
         default:
             UNREACHABLE();
     }
     return value;
 }
 
+void Display::onFramePresented()
+{
+    if (!isTelemetryActive())
+    {
+        return;
+    }
+
+    const double now = angle::GetCurrentSystemTime();
+    if (mLastPresentTime != 0.0)
+    {
+        mTelemetryCounters.lastSwapIntervalNs.store(
+            static_cast<uint64_t>((now - mLastPresentTime) * 1e9), std::memory_order_relaxed);
+    }
+    mLastPresentTime = now;
+
+    mTelemetryCounters.frameCount.fetch_add(1, std::memory_order_relaxed);
+}
+
 angle::ScratchBuffer Display::requestScratchBuffer()
 {
     return requestScratchBufferImpl(&mScratchBuffers);
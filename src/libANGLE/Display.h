@@ -11,6 +11,7 @@
 #ifndef LIBANGLE_DISPLAY_H_
 #define LIBANGLE_DISPLAY_H_
 
+#include <atomic>
 #include <mutex>
 #include <set>
 #include <vector>
@@ -63,6 +64,22 @@ using ContextSet = angle::HashSet<gl::Context *>;
 using SurfaceSet = angle::HashSet<Surface *>;
 using ThreadSet  = angle::HashSet<Thread *>;
 
+// EGL_ANGLE_display_telemetry: internal mirror of ANGLETelemetryCounters (eglext_angle.h).  The
+// fields are atomics so an out-of-thread telemetry agent can sample the block that queryAttrib
+// hands out without synchronizing with the GL thread; all accesses are relaxed.
+struct TelemetryCounters final : private angle::NonCopyable
+{
+    std::atomic<uint64_t> version{1};
+    std::atomic<uint64_t> frameCount{0};
+    std::atomic<uint64_t> lastSwapIntervalNs{0};
+    std::atomic<uint64_t> commandBuffersSubmitted{0};
+    std::atomic<uint64_t> pipelineCompiles{0};
+    std::atomic<uint64_t> pipelineCacheSizeBytes{0};
+    std::atomic<uint64_t> descriptorSetCacheSize{0};
+    std::atomic<uint64_t> framebufferCacheSize{0};
+    std::atomic<uint64_t> descriptorPoolGrowthEvents{0};
+};
+
 struct DisplayState final : private angle::NonCopyable
 {
     DisplayState(EGLNativeDisplayType nativeDisplayId);
@@ -304,6 +321,12 @@ class Display final : public LabeledObject,
 
     EGLAttrib queryAttrib(const EGLint attribute);
 
+    // EGL_ANGLE_display_telemetry.  The per-frame update is skipped until the counter block has
+    // been queried at least once, so unqueried displays pay nothing for it.
+    TelemetryCounters &getTelemetryCounters() { return mTelemetryCounters; }
+    bool isTelemetryActive() const { return mTelemetryActive.load(std::memory_order_relaxed); }
+    void onFramePresented();
+
     angle::ScratchBuffer requestScratchBuffer();
     void returnScratchBuffer(angle::ScratchBuffer scratchBuffer);
 
@@ -412,6 +435,11 @@ class Display final : public LabeledObject,
     EGLenum mPlatform;
     angle::LoggingAnnotator mAnnotator;
 
+    // EGL_ANGLE_display_telemetry
+    TelemetryCounters mTelemetryCounters;
+    std::atomic<bool> mTelemetryActive{false};
+    double mLastPresentTime = 0.0;
+
     gl::TextureManager *mTextureManager;
     gl::SemaphoreManager *mSemaphoreManager;
     BlobCache mBlobCache;
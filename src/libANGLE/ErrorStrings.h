@@ -411,6 +411,8 @@ MSG kInvalidZOffset = "zoffset is larger than MAX_3D_TEXTURE_SIZE-1";
 MSG kLengthZero = "Length must not be zero.";
 MSG kLevelNotZero = "Texture level must be zero.";
 MSG kLightParameterOutOfRange = "Light parameter out of range.";
+MSG kLockedDrawsActive = "A locked draw batch is already active.";
+MSG kLockedDrawsNotActive = "No locked draw batch is active.";
 MSG kMapOutOfRange = "Mapped range does not fit into buffer dimensions.";
 MSG kMaterialParameterOutOfRange = "Material parameter out of range.";
 MSG kMatrixStackOverflow = "Current matrix stack is full.";
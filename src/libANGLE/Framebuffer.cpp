@@ -324,6 +324,37 @@ bool AttachmentOverlapsWithTexture(const FramebufferAttachment &attachment,
     return attachmentLevel >= textureEffectiveBaseLevel && attachmentLevel <= textureMaxLevel;
 }
 
+// Appends a change-aware description of |attachment| to a completeness cache signature.  The
+// attached object is identified by its process-unique serial -- not its GL id, which can be
+// reused after deletion and would let two different attachment sets collide -- and its Subject
+// generation is included so that any modification to the object (such as a redefinition or a
+// storage change) makes the signature unique.
+void AppendAttachmentSignature(const FramebufferAttachment &attachment,
+                               std::vector<uint64_t> *signature)
+{
+    if (!attachment.isAttached())
+    {
+        signature->push_back(0);
+        return;
+    }
+
+    signature->push_back(attachment.getResource()->attachmentObjectSerial().getValue());
+    if (attachment.type() == GL_TEXTURE)
+    {
+        const ImageIndex &imageIndex = attachment.getTextureImageIndex();
+        signature->push_back((static_cast<uint64_t>(imageIndex.getType()) << 32) |
+                             static_cast<uint32_t>(imageIndex.getLevelIndex()));
+        signature->push_back(
+            (static_cast<uint64_t>(static_cast<uint32_t>(imageIndex.getLayerIndex())) << 32) |
+            static_cast<uint32_t>(imageIndex.getLayerCount()));
+    }
+    signature->push_back((static_cast<uint64_t>(attachment.getNumViews()) << 32) |
+                         static_cast<uint32_t>(attachment.getBaseViewIndex()));
+    signature->push_back((static_cast<uint64_t>(attachment.getRenderToTextureSamples()) << 1) |
+                         (attachment.isMultiview() ? 1u : 0u));
+    signature->push_back(attachment.getResource()->getGeneration());
+}
+
 }  // anonymous namespace
 
 bool FramebufferStatus::isComplete() const
@@ -1277,6 +1308,20 @@ const FramebufferStatus &Framebuffer::checkStatusImpl(const Context *context) co
     ASSERT(!isDefault());
     ASSERT(hasAnyDirtyBit() || !mCachedStatus.valid());
 
+    // Re-attaching a previously validated attachment combination is common (e.g. ping-ponging
+    // textures between framebuffers), so look the combination up before re-walking every
+    // attachment.
+    std::vector<uint64_t> signature;
+    getCompletenessSignature(&signature);
+    for (const CompletenessCacheEntry &entry : mCompletenessCache)
+    {
+        if (entry.signature == signature)
+        {
+            mCachedStatus = entry.status;
+            return mCachedStatus.value();
+        }
+    }
+
     mCachedStatus = checkStatusWithGLFrontEnd(context);
 
     if (mCachedStatus.value().isComplete())
@@ -1298,9 +1343,36 @@ const FramebufferStatus &Framebuffer::checkStatusImpl(const Context *context) co
         mCachedStatus = mImpl->checkStatus(context);
     }
 
+    CompletenessCacheEntry &entry = mCompletenessCache[mCompletenessCacheNextEntry];
+    entry.signature               = std::move(signature);
+    entry.status                  = mCachedStatus.value();
+    mCompletenessCacheNextEntry   = (mCompletenessCacheNextEntry + 1) % kCompletenessCacheSize;
+
     return mCachedStatus.value();
 }
 
+void Framebuffer::getCompletenessSignature(std::vector<uint64_t> *signatureOut) const
+{
+    signatureOut->reserve(6 * (mState.mColorAttachments.size() + 2) + 3);
+    for (const FramebufferAttachment &colorAttachment : mState.mColorAttachments)
+    {
+        AppendAttachmentSignature(colorAttachment, signatureOut);
+    }
+    AppendAttachmentSignature(mState.mDepthAttachment, signatureOut);
+    AppendAttachmentSignature(mState.mStencilAttachment, signatureOut);
+
+    // Default framebuffer parameters participate in completeness when no attachments are present,
+    // and WebGL 1 depth/stencil consistency is tracked outside the attachment points.
+    signatureOut->push_back(
+        (static_cast<uint64_t>(static_cast<uint32_t>(mState.mDefaultWidth)) << 32) |
+        static_cast<uint32_t>(mState.mDefaultHeight));
+    signatureOut->push_back(
+        (static_cast<uint64_t>(static_cast<uint32_t>(mState.mDefaultSamples)) << 32) |
+        static_cast<uint32_t>(mState.mDefaultLayers));
+    signatureOut->push_back((mState.mDefaultFixedSampleLocations ? 2u : 0u) |
+                            (mState.mWebGLDepthStencilConsistent ? 1u : 0u));
+}
+
 FramebufferStatus Framebuffer::checkStatusWithGLFrontEnd(const Context *context) const
 {
     const State &state = context->getState();
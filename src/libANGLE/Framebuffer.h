@@ -10,6 +10,7 @@
 #ifndef LIBANGLE_FRAMEBUFFER_H_
 #define LIBANGLE_FRAMEBUFFER_H_
 
+#include <array>
 #include <vector>
 
 #include "common/FixedVector.h"
@@ -507,6 +508,8 @@ class Framebuffer final : public angle::ObserverInterface,
 
     FramebufferAttachment *getAttachmentFromSubjectIndex(angle::SubjectIndex index);
 
+    void getCompletenessSignature(std::vector<uint64_t> *signatureOut) const;
+
     ANGLE_INLINE void updateFloat32ColorAttachmentBits(size_t index, const InternalFormat *format)
     {
         mFloat32ColorAttachmentBits.set(index, format->type == GL_FLOAT);
@@ -527,6 +530,20 @@ class Framebuffer final : public angle::ObserverInterface,
     // we don't set a dirty bit that isn't already set, when inside the dirty bits syncState.
     mutable Optional<DirtyBits> mDirtyBitsGuard;
 
+    // Small ring of completeness results keyed by an attachment-combination signature, so that
+    // re-attaching a previously validated combination (e.g. ping-ponging textures between
+    // framebuffers) skips the full completeness walk.  Entries are matched by exact signature
+    // equality; stale entries never match because each attached object's Subject generation is
+    // part of the signature.  An empty signature marks an unused slot.
+    struct CompletenessCacheEntry
+    {
+        std::vector<uint64_t> signature;
+        FramebufferStatus status;
+    };
+    static constexpr size_t kCompletenessCacheSize = 4;
+    mutable std::array<CompletenessCacheEntry, kCompletenessCacheSize> mCompletenessCache;
+    mutable size_t mCompletenessCacheNextEntry = 0;
+
     // ANGLE_shader_pixel_local_storage
     std::unique_ptr<PixelLocalStorage> mPixelLocalStorage;
 };
@@ -309,7 +309,16 @@ void FramebufferAttachment::setInitState(InitState initState) const
 
 ////// FramebufferAttachmentObject Implementation //////
 
-FramebufferAttachmentObject::FramebufferAttachmentObject() {}
+namespace
+{
+// Serials for attachable objects.  Process-global so a serial is never reused, even across share
+// groups; the framebuffer completeness cache relies on this to never alias a destroyed object.
+rx::AtomicSerialFactory sAttachmentObjectSerialFactory;
+}  // namespace
+
+FramebufferAttachmentObject::FramebufferAttachmentObject()
+    : mAttachmentObjectSerial(sAttachmentObjectSerialFactory.generate())
+{}
 
 FramebufferAttachmentObject::~FramebufferAttachmentObject() {}
 
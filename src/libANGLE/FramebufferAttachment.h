@@ -225,6 +225,10 @@ class FramebufferAttachmentObject : public angle::Subject, public angle::Observe
     virtual void onDetach(const Context *context, rx::Serial framebufferSerial) = 0;
     virtual GLuint getId() const                                                = 0;
 
+    // A process-unique serial for this object.  Unlike the GL id, it is never reused after the
+    // object is destroyed, so it can safely key caches that outlive the object.
+    rx::Serial attachmentObjectSerial() const { return mAttachmentObjectSerial; }
+
     // These are used for robust resource initialization.
     virtual InitState initState(GLenum binding, const ImageIndex &imageIndex) const = 0;
     virtual void setInitState(GLenum binding,
@@ -243,6 +247,9 @@ class FramebufferAttachmentObject : public angle::Subject, public angle::Observe
 
   protected:
     virtual rx::FramebufferAttachmentObjectImpl *getAttachmentImpl() const = 0;
+
+  private:
+    const rx::Serial mAttachmentObjectSerial;
 };
 
 inline const ImageIndex &FramebufferAttachment::getTextureImageIndex() const
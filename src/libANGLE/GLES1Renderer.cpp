@@ -47,6 +47,11 @@ GLES1ShaderState::GLES1ShaderState(const GLES1ShaderState &other)
 {
     memcpy(this, &other, sizeof(GLES1ShaderState));
 }
+GLES1ShaderState &GLES1ShaderState::operator=(const GLES1ShaderState &other)
+{
+    memcpy(this, &other, sizeof(GLES1ShaderState));
+    return *this;
+}
 
 bool operator==(const GLES1ShaderState &a, const GLES1ShaderState &b)
 {
@@ -78,6 +83,10 @@ void GLES1Renderer::onDestroy(Context *context, State *state)
         mShaderPrograms->release(context);
         mShaderPrograms             = nullptr;
         mRendererProgramInitialized = false;
+
+        mPreparedUberShaderState = nullptr;
+        mPreparedProgramObject   = nullptr;
+        mPreparedStateValid      = false;
     }
 }
 
@@ -91,6 +100,15 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
     GLES1ShaderState::BoolTexArray &texCubeEnables = mShaderState.texCubeEnables;
     GLES1ShaderState::IntTexArray &tex2DFormats    = mShaderState.tex2DFormats;
 
+    // Bound-texture state carries no GLES1 dirty bit, so it is re-derived every draw; track
+    // whether the result differs from the previous draw for the fast path below.
+    GLES1ShaderState::BoolTexArray prevTex2DEnables;
+    GLES1ShaderState::BoolTexArray prevTexCubeEnables;
+    GLES1ShaderState::IntTexArray prevTex2DFormats;
+    memcpy(prevTex2DEnables, tex2DEnables, sizeof(prevTex2DEnables));
+    memcpy(prevTexCubeEnables, texCubeEnables, sizeof(prevTexCubeEnables));
+    memcpy(prevTex2DFormats, tex2DFormats, sizeof(prevTex2DFormats));
+
     for (int i = 0; i < kTexUnitCount; i++)
     {
         // GL_OES_cube_map allows only one of TEXTURE_2D / TEXTURE_CUBE_MAP
@@ -143,6 +161,64 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
         }
     }
 
+    const bool texStateChanged =
+        memcmp(prevTex2DEnables, tex2DEnables, sizeof(prevTex2DEnables)) != 0 ||
+        memcmp(prevTexCubeEnables, texCubeEnables, sizeof(prevTexCubeEnables)) != 0 ||
+        memcmp(prevTex2DFormats, tex2DFormats, sizeof(prevTex2DFormats)) != 0;
+
+    // Texture crop rectangles similarly depend on bound-texture state; derive them up front and
+    // compare against the values last uploaded to the current program.
+    std::array<Vec4Uniform, kTexUnitCount> texCropRects = {};
+    Vec4Uniform *cropRectBuffer                         = texCropRects.data();
+    for (int i = 0; i < kTexUnitCount; i++)
+    {
+        Texture *curr2DTexture = glState->getSamplerTexture(i, TextureType::_2D);
+        if (curr2DTexture)
+        {
+            const gl::Rectangle &cropRect = curr2DTexture->getCrop();
+
+            GLfloat textureWidth =
+                static_cast<GLfloat>(curr2DTexture->getWidth(TextureTarget::_2D, 0));
+            GLfloat textureHeight =
+                static_cast<GLfloat>(curr2DTexture->getHeight(TextureTarget::_2D, 0));
+
+            if (textureWidth > 0.0f && textureHeight > 0.0f)
+            {
+                cropRectBuffer[i][0] = cropRect.x / textureWidth;
+                cropRectBuffer[i][1] = cropRect.y / textureHeight;
+                cropRectBuffer[i][2] = cropRect.width / textureWidth;
+                cropRectBuffer[i][3] = cropRect.height / textureHeight;
+            }
+        }
+    }
+
+    const bool hasLogicOpANGLE     = context->getExtensions().logicOpANGLE;
+    const bool hasFramebufferFetch = context->getExtensions().shaderFramebufferFetchEXT ||
+                                     context->getExtensions().shaderFramebufferFetchNonCoherentEXT;
+
+    // Generation-stamped fast path: when no tracked GLES1 state changed since the last prepared
+    // draw and the per-draw inputs that carry no dirty bit (bound textures, primitive mode,
+    // glDrawTex parameters) are also unchanged, the previous translation is still valid and both
+    // the program lookup and every uniform upload can be skipped.
+    if (mPreparedStateValid && !texStateChanged &&
+        gles1State.getGeneration() == mPreparedGeneration &&
+        glState->getProgram() == mPreparedProgramObject && !mDrawTextureUniformsDirty &&
+        mShaderState.mGLES1StateEnabled.test(GLES1StateEnables::DrawTexture) ==
+            mDrawTextureEnabled &&
+        mShaderState.mGLES1StateEnabled.test(GLES1StateEnables::PointRasterization) ==
+            (mode == PrimitiveMode::Points) &&
+        memcmp(&texCropRects, &mPreparedUberShaderState->uniformBuffers.texCropRects,
+               sizeof(texCropRects)) == 0)
+    {
+        // Non-coherent framebuffer-fetch logic op still needs its barrier between draws.
+        if (hasFramebufferFetch && gles1State.mLogicOpEnabled &&
+            !context->getExtensions().shaderFramebufferFetchEXT)
+        {
+            context->framebufferFetchBarrier();
+        }
+        return angle::Result::Continue;
+    }
+
     GLES1ShaderState::IntTexArray &texEnvModes          = mShaderState.texEnvModes;
     GLES1ShaderState::IntTexArray &texCombineRgbs       = mShaderState.texCombineRgbs;
     GLES1ShaderState::IntTexArray &texCombineAlphas     = mShaderState.texCombineAlphas;
@@ -231,10 +307,6 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
     mShaderState.alphaTestFunc = gles1State.mAlphaTestFunc;
     mShaderState.fogMode       = gles1State.fogParameters().mode;
 
-    const bool hasLogicOpANGLE     = context->getExtensions().logicOpANGLE;
-    const bool hasFramebufferFetch = context->getExtensions().shaderFramebufferFetchEXT ||
-                                     context->getExtensions().shaderFramebufferFetchNonCoherentEXT;
-
     if (!hasLogicOpANGLE && hasFramebufferFetch)
     {
         mShaderState.mGLES1StateEnabled[GLES1StateEnables::LogicOpThroughFramebufferFetch] =
@@ -245,12 +317,14 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
 
     ANGLE_TRY(initializeRendererProgram(context, glState));
 
-    GLES1UberShaderState UberShaderState = getUberShaderState();
+    GLES1UberShaderState &UberShaderState = *mPreparedUberShaderState;
 
     const GLES1ProgramState &programState = UberShaderState.programState;
     GLES1UniformBuffers &uniformBuffers   = UberShaderState.uniformBuffers;
 
-    Program *programObject = getProgram(programState.program);
+    Program *programObject    = getProgram(programState.program);
+    const bool programChanged = programObject != mPreparedProgramObject;
+    mPreparedProgramObject    = programObject;
 
     // If anything is dirty in gles1 or the common parts of gles1/2, just redo these parts
     // completely for now.
@@ -258,31 +332,13 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
     // Feature enables
 
     // Texture unit enables and format info
-    std::array<Vec4Uniform, kTexUnitCount> texCropRects;
-    Vec4Uniform *cropRectBuffer = texCropRects.data();
-    for (int i = 0; i < kTexUnitCount; i++)
+    if (programChanged || memcmp(&texCropRects, &uniformBuffers.texCropRects,
+                                 sizeof(uniformBuffers.texCropRects)) != 0)
     {
-        Texture *curr2DTexture = glState->getSamplerTexture(i, TextureType::_2D);
-        if (curr2DTexture)
-        {
-            const gl::Rectangle &cropRect = curr2DTexture->getCrop();
-
-            GLfloat textureWidth =
-                static_cast<GLfloat>(curr2DTexture->getWidth(TextureTarget::_2D, 0));
-            GLfloat textureHeight =
-                static_cast<GLfloat>(curr2DTexture->getHeight(TextureTarget::_2D, 0));
-
-            if (textureWidth > 0.0f && textureHeight > 0.0f)
-            {
-                cropRectBuffer[i][0] = cropRect.x / textureWidth;
-                cropRectBuffer[i][1] = cropRect.y / textureHeight;
-                cropRectBuffer[i][2] = cropRect.width / textureWidth;
-                cropRectBuffer[i][3] = cropRect.height / textureHeight;
-            }
-        }
+        memcpy(&uniformBuffers.texCropRects, &texCropRects, sizeof(uniformBuffers.texCropRects));
+        setUniform4fv(programObject, programState.drawTextureNormalizedCropRectLoc, kTexUnitCount,
+                      reinterpret_cast<GLfloat *>(uniformBuffers.texCropRects.data()));
     }
-    setUniform4fv(programObject, programState.drawTextureNormalizedCropRectLoc, kTexUnitCount,
-                  reinterpret_cast<GLfloat *>(cropRectBuffer));
 
     if (gles1State.isDirty(GLES1State::DIRTY_GLES1_LOGIC_OP) && hasLogicOpANGLE)
     {
@@ -485,6 +541,7 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
     }
 
     // Point rasterization
+    if (programChanged || gles1State.isDirty(GLES1State::DIRTY_GLES1_POINT_PARAMETERS))
     {
         const PointParameters &pointParams = gles1State.mPointParameters;
 
@@ -495,12 +552,16 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
     }
 
     // Draw texture
+    if (programChanged || mDrawTextureUniformsDirty)
     {
         setUniform4fv(programObject, programState.drawTextureCoordsLoc, 1, mDrawTextureCoords);
         setUniform2fv(programObject, programState.drawTextureDimsLoc, 1, mDrawTextureDims);
+        mDrawTextureUniformsDirty = false;
     }
 
     gles1State.clearDirty();
+    mPreparedGeneration = gles1State.getGeneration();
+    mPreparedStateValid = true;
 
     // None of those are changes in sampler, so there is no need to set the GL_PROGRAM dirty.
     // Otherwise, put the dirtying here.
@@ -586,6 +647,8 @@ void GLES1Renderer::drawTexture(Context *context,
     mDrawTextureDims[0] = wNdc;
     mDrawTextureDims[1] = hNdc;
 
+    mDrawTextureUniformsDirty = true;
+
     mDrawTextureEnabled = true;
 
     AttributesMask prevAttributesMask = glState->gles1().getVertexArraysAttributeMask();
@@ -880,10 +943,28 @@ void GLES1Renderer::addFragmentShaderDefs(std::stringstream &outStream)
 
 angle::Result GLES1Renderer::initializeRendererProgram(Context *context, State *glState)
 {
-    // See if we have the shader for this combination of states
-    if (mUberShaderState.find(mShaderState) != mUberShaderState.end())
+    // See if we have the shader for this combination of states.  The entry used by the previous
+    // draw is cached, so repeat draws skip hashing the full shader state vector.
+    GLES1UberShaderState *uberShaderState = nullptr;
+    if (mPreparedUberShaderState != nullptr && mPreparedShaderState == mShaderState)
+    {
+        uberShaderState = mPreparedUberShaderState;
+    }
+    else
     {
-        Program *programObject = getProgram(getUberShaderState().programState.program);
+        auto iter = mUberShaderState.find(mShaderState);
+        if (iter != mUberShaderState.end())
+        {
+            uberShaderState = &iter->second;
+        }
+    }
+
+    if (uberShaderState != nullptr)
+    {
+        mPreparedShaderState     = mShaderState;
+        mPreparedUberShaderState = uberShaderState;
+
+        Program *programObject = getProgram(uberShaderState->programState.program);
 
         // If this is different than the current program, we need to sync everything
         // TODO: This could be optimized to only dirty state that differs between the two programs
@@ -1064,6 +1145,10 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context, State *
     // We just created a new program, we need to sync everything
     glState->gles1().setAllDirty();
 
+    // The insert above may have rehashed the table, so re-resolve the cached entry.
+    mPreparedShaderState     = mShaderState;
+    mPreparedUberShaderState = &getUberShaderState();
+
     mRendererProgramInitialized = true;
     return angle::Result::Continue;
 }
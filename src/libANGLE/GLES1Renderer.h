@@ -59,6 +59,7 @@ struct GLES1ShaderState
     GLES1ShaderState();
     ~GLES1ShaderState();
     GLES1ShaderState(const GLES1ShaderState &other);
+    GLES1ShaderState &operator=(const GLES1ShaderState &other);
 
     size_t hash() const;
 
@@ -330,6 +331,18 @@ class GLES1Renderer final : angle::NonCopyable
 
     angle::HashMap<GLES1ShaderState, GLES1UberShaderState> mUberShaderState;
 
+    // Generation-stamped cache of the last prepared draw.  mPreparedUberShaderState remembers the
+    // map entry matching mPreparedShaderState so repeat draws skip hashing the full shader state
+    // vector; inserting into mUberShaderState can move entries, so the pointer is re-resolved
+    // whenever a new program is created.  The GLES1State generation stamp and program pointer let
+    // prepareForDraw skip state translation outright when nothing changed since the last draw.
+    GLES1ShaderState mPreparedShaderState          = {};
+    GLES1UberShaderState *mPreparedUberShaderState = nullptr;
+    Program *mPreparedProgramObject                = nullptr;
+    uint64_t mPreparedGeneration                   = 0;
+    bool mPreparedStateValid                       = false;
+    bool mDrawTextureUniformsDirty                 = true;
+
     bool mDrawTextureEnabled      = false;
     GLfloat mDrawTextureCoords[4] = {0.0f, 0.0f, 0.0f, 0.0f};
     GLfloat mDrawTextureDims[2]   = {0.0f, 0.0f};
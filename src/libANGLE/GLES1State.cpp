@@ -343,8 +343,8 @@ void GLES1State::loadMatrix(const angle::Mat4 &m)
 void GLES1State::multMatrix(const angle::Mat4 &m)
 {
     setDirty(DIRTY_GLES1_MATRICES);
-    angle::Mat4 currentMatrix   = currentMatrixStack().back();
-    currentMatrixStack().back() = currentMatrix.product(m);
+    angle::Mat4 &currentMatrix = currentMatrixStack().back();
+    currentMatrix              = currentMatrix.product(m);
 }
 
 void GLES1State::setLogicOpEnabled(bool enabled)
@@ -257,7 +257,11 @@ class GLES1State final : angle::NonCopyable
         DIRTY_GLES1_MAX,
     };
 
-    void setAllDirty() { mDirtyBits.set(); }
+    void setAllDirty()
+    {
+        mDirtyBits.set();
+        ++mGeneration;
+    }
 
   private:
     friend class State;
@@ -269,10 +273,19 @@ class GLES1State final : angle::NonCopyable
     using DirtyBits = angle::BitSet<DIRTY_GLES1_MAX>;
     DirtyBits mDirtyBits;
 
-    void setDirty(DirtyGles1Type type) { mDirtyBits.set(type); }
+    // Monotonic stamp bumped whenever a dirty bit is set.  GLES1Renderer compares it against the
+    // stamp of the last draw it prepared to tell whether any tracked state changed since.
+    uint64_t mGeneration = 0;
+
+    void setDirty(DirtyGles1Type type)
+    {
+        mDirtyBits.set(type);
+        ++mGeneration;
+    }
     void clearDirty() { mDirtyBits.reset(); }
     void clearDirtyBits(const DirtyGles1Type &bitset) { mDirtyBits &= ~bitset; }
     bool isDirty(DirtyGles1Type type) const { return mDirtyBits.test(type); }
+    uint64_t getGeneration() const { return mGeneration; }
 
     // All initial state values come from the
     // OpenGL ES 1.1 spec.
@@ -47,10 +47,10 @@ GLuint HandleAllocator::allocate()
 {
     ASSERT(!mUnallocatedList.empty() || !mReleasedList.empty());
 
-    // Allocate from released list, logarithmic time for pop_heap.
+    // Allocate from released list, constant time.  The most recently released handle is reused
+    // first; which released handle gets reused is not observable by the application.
     if (!mReleasedList.empty())
     {
-        std::pop_heap(mReleasedList.begin(), mReleasedList.end(), std::greater<GLuint>());
         GLuint reusedHandle = mReleasedList.back();
         mReleasedList.pop_back();
 
@@ -108,9 +108,18 @@ void HandleAllocator::release(GLuint handle)
         }
     }
 
-    // Add to released list, logarithmic time for push_heap.
+    // Add to released list, constant time.
     mReleasedList.push_back(handle);
-    std::push_heap(mReleasedList.begin(), mReleasedList.end(), std::greater<GLuint>());
+}
+
+void HandleAllocator::releaseBatch(const GLuint *handles, size_t count)
+{
+    if (mLoggingEnabled)
+    {
+        WARN() << "HandleAllocator::releaseBatch releasing " << count << " handles" << std::endl;
+    }
+
+    mReleasedList.insert(mReleasedList.end(), handles, handles + count);
 }
 
 void HandleAllocator::reserve(GLuint handle)
@@ -126,8 +135,9 @@ void HandleAllocator::reserve(GLuint handle)
         auto releasedIt = std::find(mReleasedList.begin(), mReleasedList.end(), handle);
         if (releasedIt != mReleasedList.end())
         {
-            mReleasedList.erase(releasedIt);
-            std::make_heap(mReleasedList.begin(), mReleasedList.end(), std::greater<GLuint>());
+            // Order is not significant, so swap with the last element instead of shifting.
+            *releasedIt = mReleasedList.back();
+            mReleasedList.pop_back();
             return;
         }
     }
@@ -31,6 +31,9 @@ class HandleAllocator final : angle::NonCopyable
 
     GLuint allocate();
     void release(GLuint handle);
+    // Releases many handles at once, skipping the per-handle range-consolidation scan that
+    // release() performs; the handles go straight to the constant-time reuse stack.
+    void releaseBatch(const GLuint *handles, size_t count);
     void reserve(GLuint handle);
     void reset();
 
@@ -53,7 +56,7 @@ class HandleAllocator final : angle::NonCopyable
 
     // The freelist consists of never-allocated handles, stored
     // as ranges, and handles that were previously allocated and
-    // released, stored in a heap.
+    // released, stored in a stack for constant time reuse.
     std::vector<HandleRange> mUnallocatedList;
     std::vector<GLuint> mReleasedList;
 
@@ -116,8 +116,19 @@ void MemoryProgramCache::ComputeHash(const Context *context,
     hashStream << angle::GetANGLECommitHash() << context->getClientMajorVersion()
                << context->getClientMinorVersion() << context->getString(GL_RENDERER);
 
-    // Hash pre-link program properties.
-    hashStream << program->getAttributeBindings() << program->getUniformLocationBindings()
+    // Hash pre-link program properties.  Attribute bindings only participate for names the
+    // vertex shader actually declares: applications commonly bind one fixed set of attribute
+    // names for every program, and bindings for inactive names can't affect the link result, so
+    // they shouldn't defeat the cache on a relink.
+    Shader *vertexShader = program->getAttachedShader(ShaderType::Vertex);
+    if (vertexShader != nullptr)
+    {
+        for (const sh::ShaderVariable &attribute : vertexShader->getActiveAttributes(context))
+        {
+            hashStream << attribute.name << program->getAttributeBindings().getBinding(attribute);
+        }
+    }
+    hashStream << program->getUniformLocationBindings()
                << program->getFragmentOutputLocations() << program->getFragmentOutputIndexes()
                << program->getState().getTransformFeedbackVaryingNames()
                << program->getState().getTransformFeedbackBufferMode()
@@ -157,9 +168,8 @@ angle::Result MemoryProgramCache::getProgram(const Context *context,
             return angle::Result::Incomplete;
 
         case egl::BlobCache::GetAndDecompressResult::GetSuccess:
-            angle::Result result =
-                program->loadBinary(context, GL_PROGRAM_BINARY_ANGLE, uncompressedData.data(),
-                                    static_cast<int>(uncompressedData.size()));
+            angle::Result result = program->loadSerializedBinary(
+                context, uncompressedData.data(), static_cast<int>(uncompressedData.size()));
             ANGLE_TRY(result);
 
             if (result == angle::Result::Continue)
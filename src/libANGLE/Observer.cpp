@@ -39,6 +39,10 @@ bool Subject::hasObservers() const
 
 void Subject::onStateChange(SubjectMessage message) const
 {
+    // Bump the generation before the empty-list early-out so that signature-based caches notice
+    // changes made while the subject had no observers attached.
+    ++mGeneration;
+
     if (mObservers.empty())
         return;
 
@@ -120,6 +120,11 @@ class Subject : NonCopyable
     void resetObservers();
     ANGLE_INLINE size_t getObserversCount() const { return mObservers.size(); }
 
+    // Monotonic stamp bumped on every state change notification, including while the subject has
+    // no observers.  Lets callers build cheap change-detection signatures for subjects they are
+    // not bound to, such as the framebuffer completeness cache.
+    ANGLE_INLINE uint64_t getGeneration() const { return mGeneration; }
+
     ANGLE_INLINE void addObserver(ObserverBindingBase *observer)
     {
         ASSERT(!IsInContainer(mObservers, observer));
@@ -135,6 +140,7 @@ class Subject : NonCopyable
     // Keep a short list of observers so we can allocate/free them quickly. But since we support
     // unlimited bindings, have a spill-over list of that uses dynamic allocation.
     angle::FastVector<ObserverBindingBase *, kMaxFixedObservers> mObservers;
+    mutable uint64_t mGeneration = 0;
 };
 
 // Keeps a binding between a Subject and Observer, with a specific subject index.
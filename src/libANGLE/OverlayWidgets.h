@@ -55,6 +55,10 @@ class Widget
 
     virtual const Text *getDescriptionWidget() const;
 
+    // Whether the widget was enabled through the environment.  Lets backends skip expensive data
+    // collection (such as GPU queries) that only serves disabled widgets.
+    bool isEnabled() const { return enabled; }
+
   protected:
     WidgetType type;
     // Whether this item should be drawn.
@@ -184,6 +188,7 @@ class RunningHistogram : public RunningGraph
 class Mock
 {
   public:
+    bool isEnabled() const { return false; }
     void reset() const {}
     template <typename T>
     void set(T) const
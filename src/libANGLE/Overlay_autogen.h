@@ -40,6 +40,12 @@ enum class WidgetId
     VulkanUniformDescriptorCacheSize,
     // Total size of all keys in the descriptor set caches
     VulkanDescriptorCacheKeySize,
+    // Number of vertex shader invocations in a frame (pipeline statistics).
+    VulkanVertexShaderInvocations,
+    // Number of fragment shader invocations in a frame (pipeline statistics).
+    VulkanFragmentShaderInvocations,
+    // Estimated render pass attachment memory traffic in a frame (MB).
+    VulkanAttachmentBandwidthMB,
     // Number of times the Vulkan backend attempted to submit commands
     VulkanAttemptedSubmissions,
     // Number of times the Vulkan backend actually submitted commands
@@ -52,6 +58,12 @@ enum class WidgetId
     VulkanTotalPipelineCacheMissTimeMs,
     // Total time spent creating pipelines that hit the cache.
     VulkanTotalPipelineCacheHitTimeMs,
+    // Number of VSSetShaderResources calls (Count).
+    D3D11SetShaderResourcesVertex,
+    // Number of PSSetShaderResources calls (Count).
+    D3D11SetShaderResourcesFragment,
+    // Number of CSSetShaderResources calls (Count).
+    D3D11SetShaderResourcesCompute,
 
     InvalidEnum,
     EnumCount = InvalidEnum,
@@ -73,11 +85,17 @@ enum class WidgetId
     PROC(VulkanTextureDescriptorCacheSize)      \
     PROC(VulkanUniformDescriptorCacheSize)      \
     PROC(VulkanDescriptorCacheKeySize)          \
+    PROC(VulkanVertexShaderInvocations)         \
+    PROC(VulkanFragmentShaderInvocations)       \
+    PROC(VulkanAttachmentBandwidthMB)           \
     PROC(VulkanAttemptedSubmissions)            \
     PROC(VulkanActualSubmissions)               \
     PROC(VulkanPipelineCacheLookups)            \
     PROC(VulkanPipelineCacheMisses)             \
     PROC(VulkanTotalPipelineCacheMissTimeMs)    \
-    PROC(VulkanTotalPipelineCacheHitTimeMs)
+    PROC(VulkanTotalPipelineCacheHitTimeMs)     \
+    PROC(D3D11SetShaderResourcesVertex)         \
+    PROC(D3D11SetShaderResourcesFragment)       \
+    PROC(D3D11SetShaderResourcesCompute)
 
 }  // namespace gl
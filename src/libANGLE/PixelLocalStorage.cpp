@@ -580,7 +580,9 @@ class PixelLocalStorageImageLoadStore : public PixelLocalStorage
 
     void onBarrier(Context *context) override
     {
-        context->memoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+        // PLS accesses are always to the fragment's own pixel, so the region-local form of the
+        // barrier is sufficient and lets backends use a lighter synchronization where available.
+        context->memoryBarrierByRegion(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
     }
 
   private:
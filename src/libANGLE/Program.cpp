@@ -307,6 +307,41 @@ void InitShaderStorageBlockLinker(const Context *context,
         }
     }
 }
+
+// Returns true when the fragment shader can neither observe nor influence the results of the
+// depth and stencil tests, so a back-end is free to run those tests before shading.
+bool CanUseEarlyFragmentTestsOptimization(const Context *context, Shader *fragmentShader)
+{
+    if (fragmentShader->hasDiscard())
+    {
+        return false;
+    }
+
+    // Writing to gl_FragDepth or gl_SampleMask influences the tests.
+    for (const sh::ShaderVariable &output : fragmentShader->getActiveOutputVariables(context))
+    {
+        if (output.name == "gl_FragDepth" || output.name == "gl_SampleMask")
+        {
+            return false;
+        }
+    }
+
+    // Buffer stores, image stores and atomics make it observable whether a fragment was shaded
+    // before or after the tests.
+    if (!fragmentShader->getShaderStorageBlocks(context).empty())
+    {
+        return false;
+    }
+    for (const sh::ShaderVariable &uniform : fragmentShader->getUniforms(context))
+    {
+        if (IsImageType(uniform.type) || IsAtomicCounterType(uniform.type))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
 }  // anonymous namespace
 
 const char *GetLinkMismatchErrorString(LinkMismatchError linkError)
@@ -414,11 +449,7 @@ void WriteShaderVariableBuffer(BinaryOutputStream *stream, const ShaderVariableB
         stream->writeBool(var.isActive(shaderType));
     }
 
-    stream->writeInt(var.memberIndexes.size());
-    for (unsigned int memberCounterIndex : var.memberIndexes)
-    {
-        stream->writeInt(memberCounterIndex);
-    }
+    stream->writePodVector(var.memberIndexes);
 }
 
 void LoadShaderVariableBuffer(BinaryInputStream *stream, ShaderVariableBuffer *var)
@@ -431,11 +462,7 @@ void LoadShaderVariableBuffer(BinaryInputStream *stream, ShaderVariableBuffer *v
         var->setActive(shaderType, stream->readBool());
     }
 
-    size_t numMembers = stream->readInt<size_t>();
-    for (size_t blockMemberIndex = 0; blockMemberIndex < numMembers; blockMemberIndex++)
-    {
-        var->memberIndexes.push_back(stream->readInt<unsigned int>());
-    }
+    stream->readPodVector(&var->memberIndexes);
 }
 
 void WriteBufferVariable(BinaryOutputStream *stream, const BufferVariable &var)
@@ -673,7 +700,7 @@ void WriteShaderVar(BinaryOutputStream *stream, const sh::ShaderVariable &var)
     stream->writeInt(var.precision);
     stream->writeString(var.name);
     stream->writeString(var.mappedName);
-    stream->writeIntVector(var.arraySizes);
+    stream->writePodVector(var.arraySizes);
     stream->writeBool(var.staticUse);
     stream->writeBool(var.active);
     stream->writeInt<size_t>(var.fields.size());
@@ -709,7 +736,7 @@ void LoadShaderVar(gl::BinaryInputStream *stream, sh::ShaderVariable *var)
     var->precision = stream->readInt<GLenum>();
     stream->readString(&var->name);
     stream->readString(&var->mappedName);
-    stream->readIntVector<unsigned int>(&var->arraySizes);
+    stream->readPodVector(&var->arraySizes);
     var->staticUse      = stream->readBool();
     var->active         = stream->readBool();
     size_t elementCount = stream->readInt<size_t>();
@@ -1068,6 +1095,7 @@ Program::Program(rx::GLImplFactory *factory, ShaderProgramManager *manager, Shad
       mProgram(factory->createProgram(mState)),
       mValidated(false),
       mLinked(false),
+      mLinkVersion(0),
       mDeleteStatus(false),
       mRefCount(0),
       mResourceManager(manager),
@@ -1356,6 +1384,9 @@ angle::Result Program::linkImpl(const Context *context)
             }
 
             mState.mExecutable->mHasDiscard = fragmentShader->hasDiscard();
+            mState.mExecutable->mHasEarlyFragmentTestsOptimization =
+                mState.mExecutable->mFragmentInoutRange.empty() &&
+                CanUseEarlyFragmentTestsOptimization(context, fragmentShader);
             mState.mExecutable->mEnablesPerSampleShading =
                 fragmentShader->enablesPerSampleShading();
             mState.mExecutable->mAdvancedBlendEquations =
@@ -1411,6 +1442,8 @@ void Program::resolveLinkImpl(const Context *context)
         return;
     }
 
+    ++mLinkVersion;
+
     if (linkingState->linkingFromBinary)
     {
         // All internal Program state is already loaded from the binary.
@@ -1579,6 +1612,27 @@ angle::Result Program::loadBinary(const Context *context,
         return angle::Result::Incomplete;
     }
 
+    // The binary is wrapped in a compressed container; see saveBinary.
+    angle::MemoryBuffer uncompressedData;
+    if (!egl::DecompressBlobCacheData(reinterpret_cast<const uint8_t *>(binary),
+                                      static_cast<size_t>(length), &uncompressedData))
+    {
+        infoLog << "Invalid program binary data.";
+        return angle::Result::Incomplete;
+    }
+
+    return loadSerializedBinary(context, uncompressedData.data(),
+                                static_cast<GLsizei>(uncompressedData.size()));
+}
+
+angle::Result Program::loadSerializedBinary(const Context *context,
+                                            const void *binary,
+                                            GLsizei length)
+{
+    ASSERT(!mLinkingState);
+    unlink();
+    InfoLog &infoLog = mState.mExecutable->getInfoLog();
+
     BinaryInputStream stream(binary, length);
     ANGLE_TRY(deserialize(context, stream, infoLog));
     // Currently we require the full shader text to compute the program hash.
@@ -1640,8 +1694,16 @@ angle::Result Program::saveBinary(Context *context,
     angle::MemoryBuffer memoryBuf;
     ANGLE_TRY(serialize(context, &memoryBuf));
 
-    GLsizei streamLength       = static_cast<GLsizei>(memoryBuf.size());
-    const uint8_t *streamState = memoryBuf.data();
+    // Wrap the binary in a compressed container.  Program binaries compress several-fold and
+    // applications store them on disk, so the one-time CPU cost is well spent.
+    angle::MemoryBuffer compressedData;
+    if (!egl::CompressBlobCacheData(memoryBuf.size(), memoryBuf.data(), &compressedData))
+    {
+        ANGLE_CHECK(context, false, "Failed to compress program binary.", GL_OUT_OF_MEMORY);
+    }
+
+    GLsizei streamLength       = static_cast<GLsizei>(compressedData.size());
+    const uint8_t *streamState = compressedData.data();
 
     if (streamLength > bufSize)
     {
@@ -3631,13 +3693,7 @@ angle::Result Program::serialize(const Context *context, angle::MemoryBuffer *bi
     stream.writeInt(mState.mNumViews);
     stream.writeInt(mState.mSpecConstUsageBits.bits());
 
-    stream.writeInt(mState.getUniformLocations().size());
-    for (const auto &variable : mState.getUniformLocations())
-    {
-        stream.writeInt(variable.arrayIndex);
-        stream.writeIntOrNegOne(variable.index);
-        stream.writeBool(variable.ignored);
-    }
+    stream.writePodVector(mState.getUniformLocations());
 
     stream.writeInt(mState.getBufferVariables().size());
     for (const BufferVariable &bufferVariable : mState.getBufferVariables())
@@ -3728,17 +3784,10 @@ angle::Result Program::deserialize(const Context *context,
     static_assert(sizeof(mState.mSpecConstUsageBits.bits()) == sizeof(uint32_t));
     mState.mSpecConstUsageBits = rx::SpecConstUsageBits(stream.readInt<uint32_t>());
 
-    const size_t uniformIndexCount = stream.readInt<size_t>();
     ASSERT(mState.mUniformLocations.empty());
-    for (size_t uniformIndexIndex = 0; uniformIndexIndex < uniformIndexCount; ++uniformIndexIndex)
-    {
-        VariableLocation variable;
-        stream.readInt(&variable.arrayIndex);
-        stream.readInt(&variable.index);
-        stream.readBool(&variable.ignored);
-
-        mState.mUniformLocations.push_back(variable);
-    }
+    static_assert(std::is_trivially_copyable<VariableLocation>::value,
+                  "mUniformLocations is serialized with memcpy");
+    stream.readPodVector(&mState.mUniformLocations);
 
     size_t bufferVariableCount = stream.readInt<size_t>();
     ASSERT(mState.mBufferVariables.empty());
@@ -778,18 +778,25 @@ class Program final : public LabeledObject, public angle::Subject
     angle::Result serialize(const Context *context, angle::MemoryBuffer *binaryOut) const;
 
     rx::Serial serial() const { return mSerial; }
+    unsigned int linkVersion() const { return mLinkVersion; }
 
     const ProgramExecutable &getExecutable() const { return mState.getExecutable(); }
     ProgramExecutable &getExecutable() { return mState.getExecutable(); }
 
   private:
     struct LinkingState;
+    // The program cache loads entries that the blob cache layer has already decompressed, so it
+    // skips the compressed container that loadBinary strips.
+    friend class MemoryProgramCache;
 
     ~Program() override;
 
     // Loads program state according to the specified binary blob.
     angle::Result deserialize(const Context *context, BinaryInputStream &stream, InfoLog &infoLog);
 
+    // Loads a binary blob in the format produced by serialize(), without a compressed container.
+    angle::Result loadSerializedBinary(const Context *context, const void *binary, GLsizei length);
+
     void unlink();
     void deleteSelf(const Context *context);
 
@@ -880,6 +887,9 @@ class Program final : public LabeledObject, public angle::Subject
     ProgramAliasedBindings mFragmentOutputIndexes;
 
     bool mLinked;
+    // Incremented on every successful link, so caches keyed on this program's linked state (such
+    // as ProgramPipeline's executable cache) never reuse state from a previous link.
+    unsigned int mLinkVersion;
     std::unique_ptr<LinkingState> mLinkingState;
     bool mDeleteStatus;  // Flag to indicate that the program can be deleted when no longer in use
 
@@ -197,6 +197,7 @@ ProgramExecutable::ProgramExecutable()
       mAtomicCounterUniformRange(0, 0),
       mFragmentInoutRange(0, 0),
       mHasDiscard(false),
+      mHasEarlyFragmentTestsOptimization(false),
       mEnablesPerSampleShading(false),
       // [GL_EXT_geometry_shader] Table 20.22
       mGeometryShaderInputPrimitiveType(PrimitiveMode::Triangles),
@@ -246,6 +247,7 @@ ProgramExecutable::ProgramExecutable(const ProgramExecutable &other)
       mShaderStorageBlocks(other.mShaderStorageBlocks),
       mFragmentInoutRange(other.mFragmentInoutRange),
       mHasDiscard(other.mHasDiscard),
+      mHasEarlyFragmentTestsOptimization(other.mHasEarlyFragmentTestsOptimization),
       mEnablesPerSampleShading(other.mEnablesPerSampleShading),
       mAdvancedBlendEquations(other.mAdvancedBlendEquations)
 {
@@ -295,8 +297,9 @@ void ProgramExecutable::reset(bool clearInfoLog)
     mAtomicCounterUniformRange = RangeUI(0, 0);
 
     mFragmentInoutRange      = RangeUI(0, 0);
-    mHasDiscard              = false;
-    mEnablesPerSampleShading = false;
+    mHasDiscard                        = false;
+    mHasEarlyFragmentTestsOptimization = false;
+    mEnablesPerSampleShading           = false;
     mAdvancedBlendEquations.reset();
 
     mGeometryShaderInputPrimitiveType  = PrimitiveMode::Triangles;
@@ -328,8 +331,9 @@ void ProgramExecutable::load(bool isSeparable, gl::BinaryInputStream *stream)
     unsigned int fragmentInoutRangeHigh = stream->readInt<uint32_t>();
     mFragmentInoutRange                 = RangeUI(fragmentInoutRangeLow, fragmentInoutRangeHigh);
 
-    mHasDiscard              = stream->readBool();
-    mEnablesPerSampleShading = stream->readBool();
+    mHasDiscard                        = stream->readBool();
+    mHasEarlyFragmentTestsOptimization = stream->readBool();
+    mEnablesPerSampleShading           = stream->readBool();
 
     static_assert(sizeof(mAdvancedBlendEquations.bits()) == sizeof(uint32_t));
     mAdvancedBlendEquations = BlendEquationBitSet(stream->readInt<uint32_t>());
@@ -367,7 +371,7 @@ void ProgramExecutable::load(bool isSeparable, gl::BinaryInputStream *stream)
         uniform.bufferIndex = stream->readInt<int>();
         LoadBlockMemberInfo(stream, &uniform.blockInfo);
 
-        stream->readIntVector<unsigned int>(&uniform.outerArraySizes);
+        stream->readPodVector(&uniform.outerArraySizes);
         uniform.outerArrayOffset = stream->readInt<unsigned int>();
 
         uniform.typeInfo = &GetUniformTypeInfo(uniform.type);
@@ -419,7 +423,7 @@ void ProgramExecutable::load(bool isSeparable, gl::BinaryInputStream *stream)
          ++transformFeedbackVaryingIndex)
     {
         sh::ShaderVariable varying;
-        stream->readIntVector<unsigned int>(&varying.arraySizes);
+        stream->readPodVector(&varying.arraySizes);
         stream->readInt(&varying.type);
         stream->readString(&varying.name);
 
@@ -562,6 +566,7 @@ void ProgramExecutable::save(bool isSeparable, gl::BinaryOutputStream *stream) c
     stream->writeInt(mFragmentInoutRange.high());
 
     stream->writeBool(mHasDiscard);
+    stream->writeBool(mHasEarlyFragmentTestsOptimization);
     stream->writeBool(mEnablesPerSampleShading);
     stream->writeInt(mAdvancedBlendEquations.bits());
 
@@ -594,7 +599,7 @@ void ProgramExecutable::save(bool isSeparable, gl::BinaryOutputStream *stream) c
         stream->writeInt(uniform.bufferIndex);
         WriteBlockMemberInfo(stream, uniform.blockInfo);
 
-        stream->writeIntVector(uniform.outerArraySizes);
+        stream->writePodVector(uniform.outerArraySizes);
         stream->writeInt(uniform.outerArrayOffset);
 
         // Active shader info
@@ -625,7 +630,7 @@ void ProgramExecutable::save(bool isSeparable, gl::BinaryOutputStream *stream) c
     stream->writeInt(getLinkedTransformFeedbackVaryings().size());
     for (const auto &var : getLinkedTransformFeedbackVaryings())
     {
-        stream->writeIntVector(var.arraySizes);
+        stream->writePodVector(var.arraySizes);
         stream->writeInt(var.type);
         stream->writeString(var.name);
 
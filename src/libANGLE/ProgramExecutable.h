@@ -232,6 +232,7 @@ class ProgramExecutable final : public angle::Subject
     const RangeUI &getAtomicCounterUniformRange() const { return mAtomicCounterUniformRange; }
     const RangeUI &getFragmentInoutRange() const { return mFragmentInoutRange; }
     bool hasDiscard() const { return mHasDiscard; }
+    bool hasEarlyFragmentTestsOptimization() const { return mHasEarlyFragmentTestsOptimization; }
     bool enablesPerSampleShading() const { return mEnablesPerSampleShading; }
     BlendEquationBitSet getAdvancedBlendEquations() const { return mAdvancedBlendEquations; }
     const std::vector<TransformFeedbackVarying> &getLinkedTransformFeedbackVaryings() const
@@ -474,6 +475,10 @@ class ProgramExecutable final : public angle::Subject
 
     RangeUI mFragmentInoutRange;
     bool mHasDiscard;
+    // True when static analysis of the fragment shader shows that forcing early fragment tests
+    // has no observable effect: no discard, no depth or sample mask write, no framebuffer fetch
+    // and no stores or atomics.  Back-ends may then run depth/stencil tests before shading.
+    bool mHasEarlyFragmentTestsOptimization;
     bool mEnablesPerSampleShading;
 
     // KHR_blend_equation_advanced supported equation list
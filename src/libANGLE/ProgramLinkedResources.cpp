@@ -10,6 +10,10 @@
 
 #include "libANGLE/ProgramLinkedResources.h"
 
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
 #include "common/string_utils.h"
 #include "common/utilities.h"
 #include "libANGLE/Caps.h"
@@ -556,6 +560,94 @@ class FlattenUniformVisitor : public sh::VariableNameVisitor
     unsigned int mStructStackSize = 0;
 };
 
+// The std140 and std430 layouts of an interface block are fully determined by the block's layout
+// qualifier, field prefix and field list.  Autogenerated shaders commonly declare the exact same
+// blocks in hundreds of programs, so identical blocks share one immutable layout object through a
+// process-wide cache instead of each program recomputing and storing its own copy.  Custom
+// (backend-specific) encoders bypass the cache as their layouts are not API-defined.
+struct CachedBlockLayout : angle::NonCopyable
+{
+    size_t dataSize = 0;
+    sh::BlockLayoutMap blockLayout;
+};
+
+void AppendFieldSignature(const sh::ShaderVariable &field, std::ostringstream *signature)
+{
+    // Only properties that affect the layout (or the member names the layout map is keyed by)
+    // participate in the signature.
+    *signature << field.name << ':' << field.type << (field.isRowMajorLayout ? ":r" : ":c");
+    for (unsigned int arraySize : field.arraySizes)
+    {
+        *signature << '[' << arraySize << ']';
+    }
+    *signature << '{';
+    for (const sh::ShaderVariable &member : field.fields)
+    {
+        AppendFieldSignature(member, signature);
+    }
+    *signature << '}';
+}
+
+std::string GetBlockSignature(const sh::InterfaceBlock &interfaceBlock)
+{
+    std::ostringstream signature;
+    signature << static_cast<int>(interfaceBlock.layout) << ':' << interfaceBlock.fieldPrefix()
+              << ';';
+    for (const sh::ShaderVariable &field : interfaceBlock.fields)
+    {
+        AppendFieldSignature(field, &signature);
+    }
+    return signature.str();
+}
+
+class BlockLayoutCache final : angle::NonCopyable
+{
+  public:
+    std::shared_ptr<const CachedBlockLayout> getOrCreate(const sh::InterfaceBlock &interfaceBlock)
+    {
+        ASSERT(interfaceBlock.layout == sh::BLOCKLAYOUT_STD140 ||
+               interfaceBlock.layout == sh::BLOCKLAYOUT_STD430);
+
+        const std::string signature = GetBlockSignature(interfaceBlock);
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            auto iter = mCache.find(signature);
+            if (iter != mCache.end())
+            {
+                return iter->second;
+            }
+        }
+
+        // Compute the layout outside the lock; losing a race only computes it twice.
+        std::shared_ptr<CachedBlockLayout> layout = std::make_shared<CachedBlockLayout>();
+
+        sh::Std140BlockEncoder std140Encoder;
+        sh::Std430BlockEncoder std430Encoder;
+        sh::BlockLayoutEncoder *encoder = interfaceBlock.layout == sh::BLOCKLAYOUT_STD140
+                                              ? static_cast<sh::BlockLayoutEncoder *>(&std140Encoder)
+                                              : &std430Encoder;
+
+        sh::GetInterfaceBlockInfo(interfaceBlock.fields, interfaceBlock.fieldPrefix(), encoder,
+                                  &layout->blockLayout);
+        layout->dataSize = encoder->getCurrentOffset();
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mCache.emplace(signature, std::move(layout)).first->second;
+    }
+
+  private:
+    std::mutex mMutex;
+    std::unordered_map<std::string, std::shared_ptr<const CachedBlockLayout>> mCache;
+};
+
+BlockLayoutCache *GetBlockLayoutCache()
+{
+    // Deliberately leaked: layouts remain shareable for the lifetime of the process.
+    static BlockLayoutCache *cache = new BlockLayoutCache();
+    return cache;
+}
+
 class InterfaceBlockInfo final : angle::NonCopyable
 {
   public:
@@ -575,6 +667,9 @@ class InterfaceBlockInfo final : angle::NonCopyable
 
     std::map<std::string, size_t> mBlockSizes;
     sh::BlockLayoutMap mBlockLayout;
+    // Layouts of std140/std430 blocks are shared through the process-wide cache; member lookups
+    // fall back to these when the member is not in |mBlockLayout|.
+    std::vector<std::shared_ptr<const CachedBlockLayout>> mSharedLayouts;
     // Based on the interface block layout, the std140 or std430 encoders are used.  On some
     // platforms (currently only D3D), there could be another non-standard encoder used.
     CustomBlockLayoutEncoderFactory *mCustomEncoderFactory;
@@ -599,36 +694,32 @@ size_t InterfaceBlockInfo::getBlockInfo(const sh::InterfaceBlock &interfaceBlock
 {
     ASSERT(IsActiveInterfaceBlock(interfaceBlock));
 
-    // define member uniforms
-    sh::Std140BlockEncoder std140Encoder;
-    sh::Std430BlockEncoder std430Encoder;
-    sh::BlockLayoutEncoder *customEncoder = nullptr;
-    sh::BlockLayoutEncoder *encoder       = nullptr;
-
-    if (interfaceBlock.layout == sh::BLOCKLAYOUT_STD140)
-    {
-        encoder = &std140Encoder;
-    }
-    else if (interfaceBlock.layout == sh::BLOCKLAYOUT_STD430)
-    {
-        encoder = &std430Encoder;
-    }
-    else if (mCustomEncoderFactory)
+    // std140 and std430 layouts are API-defined, so identical blocks from different programs can
+    // share one immutable layout through the process-wide cache.
+    if (interfaceBlock.layout == sh::BLOCKLAYOUT_STD140 ||
+        interfaceBlock.layout == sh::BLOCKLAYOUT_STD430)
     {
-        encoder = customEncoder = mCustomEncoderFactory->makeEncoder();
+        std::shared_ptr<const CachedBlockLayout> layout =
+            GetBlockLayoutCache()->getOrCreate(interfaceBlock);
+        mSharedLayouts.push_back(layout);
+        return layout->dataSize;
     }
-    else
+
+    if (!mCustomEncoderFactory)
     {
         UNREACHABLE();
         return 0;
     }
 
+    // define member uniforms
+    sh::BlockLayoutEncoder *encoder = mCustomEncoderFactory->makeEncoder();
+
     sh::GetInterfaceBlockInfo(interfaceBlock.fields, interfaceBlock.fieldPrefix(), encoder,
                               &mBlockLayout);
 
     size_t offset = encoder->getCurrentOffset();
 
-    SafeDelete(customEncoder);
+    SafeDelete(encoder);
 
     return offset;
 }
@@ -656,14 +747,24 @@ bool InterfaceBlockInfo::getBlockMemberInfo(const std::string &name,
                                             sh::BlockMemberInfo *infoOut)
 {
     auto infoIter = mBlockLayout.find(name);
-    if (infoIter == mBlockLayout.end())
+    if (infoIter != mBlockLayout.end())
     {
-        *infoOut = sh::kDefaultBlockMemberInfo;
-        return false;
+        *infoOut = infoIter->second;
+        return true;
     }
 
-    *infoOut = infoIter->second;
-    return true;
+    for (const std::shared_ptr<const CachedBlockLayout> &layout : mSharedLayouts)
+    {
+        auto sharedIter = layout->blockLayout.find(name);
+        if (sharedIter != layout->blockLayout.end())
+        {
+            *infoOut = sharedIter->second;
+            return true;
+        }
+    }
+
+    *infoOut = sh::kDefaultBlockMemberInfo;
+    return false;
 }
 
 void GetFilteredVaryings(const std::vector<sh::ShaderVariable> &varyings,
@@ -41,7 +41,7 @@ ProgramPipelineState::ProgramPipelineState()
 
 ProgramPipelineState::~ProgramPipelineState()
 {
-    SafeDelete(mExecutable);
+    // mExecutable is owned by the pipeline's executable cache.
 }
 
 const std::string &ProgramPipelineState::getLabel() const
@@ -139,9 +139,13 @@ rx::SpecConstUsageBits ProgramPipelineState::getSpecConstUsageBits() const
     return specConstUsageBits;
 }
 
+ProgramPipeline::CachedExecutable::CachedExecutable()  = default;
+ProgramPipeline::CachedExecutable::~CachedExecutable() = default;
+
 ProgramPipeline::ProgramPipeline(rx::GLImplFactory *factory, ProgramPipelineID handle)
     : RefCountObject(factory->generateSerial(), handle),
       mProgramPipelineImpl(factory->createProgramPipeline(mState)),
+      mCurrentCachedExecutable(nullptr),
       mExecutableObserverBinding(this, kExecutableSubjectIndex)
 {
     ASSERT(mProgramPipelineImpl);
@@ -150,6 +154,13 @@ ProgramPipeline::ProgramPipeline(rx::GLImplFactory *factory, ProgramPipelineID h
     {
         mProgramObserverBindings.emplace_back(this, static_cast<angle::SubjectIndex>(shaderType));
     }
+
+    // Adopt the executable created by ProgramPipelineState as the cache entry for the empty
+    // program combination.
+    mCurrentExecutableKey    = makeExecutableCacheKey();
+    mCurrentCachedExecutable = &mExecutableCache[mCurrentExecutableKey];
+    mCurrentCachedExecutable->executable.reset(mState.mExecutable);
+
     mExecutableObserverBinding.bind(mState.mExecutable);
 }
 
@@ -237,6 +248,7 @@ angle::Result ProgramPipeline::useProgramStages(const Context *context,
     }
 
     mState.useProgramStages(context, shaderTypes, shaderProgram, &mProgramObserverBindings);
+    installExecutable();
     updateLinkedShaderStages();
 
     mState.mIsLinked = false;
@@ -245,6 +257,79 @@ angle::Result ProgramPipeline::useProgramStages(const Context *context,
     return angle::Result::Continue;
 }
 
+ProgramPipeline::ExecutableCacheKey ProgramPipeline::makeExecutableCacheKey() const
+{
+    ExecutableCacheKey key = {};
+    for (const ShaderType shaderType : gl::AllShaderTypes())
+    {
+        const Program *program = mState.mPrograms[shaderType];
+        if (program)
+        {
+            key[static_cast<size_t>(shaderType)] = {program->serial().getValue(),
+                                                   program->linkVersion()};
+        }
+    }
+    return key;
+}
+
+// Makes mState.mExecutable point at the cache entry for the current program combination,
+// creating a fresh entry on first sight.  Rebinding a previously seen combination thus restores
+// its merged executable instead of recomputing it.
+void ProgramPipeline::installExecutable()
+{
+    ExecutableCacheKey key = makeExecutableCacheKey();
+    if (mCurrentCachedExecutable != nullptr && key == mCurrentExecutableKey)
+    {
+        return;
+    }
+
+    auto iter = mExecutableCache.find(key);
+    if (iter == mExecutableCache.end())
+    {
+        iter = mExecutableCache.emplace(std::piecewise_construct, std::forward_as_tuple(key),
+                                        std::forward_as_tuple())
+                   .first;
+        iter->second.executable.reset(new ProgramExecutable());
+    }
+
+    mCurrentExecutableKey    = key;
+    mCurrentCachedExecutable = &iter->second;
+    mState.mExecutable       = mCurrentCachedExecutable->executable.get();
+    mExecutableObserverBinding.bind(mState.mExecutable);
+}
+
+// Drops cache entries made stale by a relink of |program|: any combination containing it under an
+// older link version.  The current combination is kept alive even if stale; installExecutable()
+// abandons it once the new link version produces a new key, and a later purge collects it.
+void ProgramPipeline::purgeStaleCachedExecutables(const Program *program)
+{
+    const uint64_t serial          = program->serial().getValue();
+    const unsigned int linkVersion = program->linkVersion();
+
+    auto iter = mExecutableCache.begin();
+    while (iter != mExecutableCache.end())
+    {
+        bool stale = false;
+        for (const std::pair<uint64_t, unsigned int> &stageKey : iter->first)
+        {
+            if (stageKey.first == serial && stageKey.second != linkVersion)
+            {
+                stale = true;
+                break;
+            }
+        }
+
+        if (stale && &iter->second != mCurrentCachedExecutable)
+        {
+            iter = mExecutableCache.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+}
+
 void ProgramPipeline::updateLinkedShaderStages()
 {
     mState.mExecutable->resetLinkedShaderStages();
@@ -401,6 +486,8 @@ void ProgramPipeline::updateFragmentInoutRangeAndEnablesPerSampleShading()
     const ProgramExecutable &fragmentExecutable  = fragmentProgram->getExecutable();
     mState.mExecutable->mFragmentInoutRange      = fragmentExecutable.mFragmentInoutRange;
     mState.mExecutable->mHasDiscard              = fragmentExecutable.mHasDiscard;
+    mState.mExecutable->mHasEarlyFragmentTestsOptimization =
+        fragmentExecutable.mHasEarlyFragmentTestsOptimization;
     mState.mExecutable->mEnablesPerSampleShading = fragmentExecutable.mEnablesPerSampleShading;
 }
 
@@ -460,8 +547,38 @@ angle::Result ProgramPipeline::link(const Context *context)
 {
     ASSERT(!mState.mIsLinked);
 
-    ProgramMergedVaryings mergedVaryings;
-    ProgramVaryingPacking varyingPacking;
+    // Re-resolve the cached executable: link() can be reached without a stage rebind, for example
+    // when a bound program is relinked, in which case the combination key has changed.
+    installExecutable();
+    updateLinkedShaderStages();
+
+    CachedExecutable &cachedExecutable = *mCurrentCachedExecutable;
+
+    if (cachedExecutable.isLinked)
+    {
+        // The merged front-end state for this combination was computed by a previous link; only
+        // the back end needs to observe the switch.
+        if (mState.mExecutable->hasLinkedShaderStage(gl::ShaderType::Vertex) ||
+            mState.mExecutable->hasLinkedShaderStage(gl::ShaderType::Compute))
+        {
+            ANGLE_TRY(getImplementation()->link(context, cachedExecutable.mergedVaryings,
+                                                *cachedExecutable.varyingPacking));
+        }
+
+        mState.mExecutable->mActiveSamplerRefCounts.fill(0);
+        mState.updateExecutableTextures();
+
+        mState.mIsLinked = true;
+        onStateChange(angle::SubjectMessage::SubjectChanged);
+
+        return angle::Result::Continue;
+    }
+
+    // Link into the cache entry, so the merged state survives a switch to another combination.
+    ProgramMergedVaryings &mergedVaryings = cachedExecutable.mergedVaryings;
+    mergedVaryings.clear();
+    cachedExecutable.varyingPacking.reset(new ProgramVaryingPacking());
+    ProgramVaryingPacking &varyingPacking = *cachedExecutable.varyingPacking;
     LinkingVariables linkingVariables(mState);
 
     mState.mExecutable->reset(true);
@@ -574,7 +691,8 @@ angle::Result ProgramPipeline::link(const Context *context)
     mState.mExecutable->mActiveSamplerRefCounts.fill(0);
     updateExecutable();
 
-    mState.mIsLinked = true;
+    cachedExecutable.isLinked = true;
+    mState.mIsLinked          = true;
     onStateChange(angle::SubjectMessage::SubjectChanged);
 
     return angle::Result::Continue;
@@ -697,9 +815,16 @@ void ProgramPipeline::onSubjectStateChange(angle::SubjectIndex index, angle::Sub
             break;
 
         case angle::SubjectMessage::ProgramRelinked:
+        {
             mState.mIsLinked = false;
+            Program *program = mState.mPrograms[static_cast<ShaderType>(index)];
+            if (program)
+            {
+                purgeStaleCachedExecutables(program);
+            }
             onStateChange(angle::SubjectMessage::ProgramRelinked);
             break;
+        }
         case angle::SubjectMessage::SamplerUniformsUpdated:
             mState.mExecutable->clearSamplerBindings();
             for (ShaderType shaderType : mState.mExecutable->getLinkedShaderStages())
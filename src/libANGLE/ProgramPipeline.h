@@ -11,6 +11,7 @@
 #ifndef LIBANGLE_PROGRAMPIPELINE_H_
 #define LIBANGLE_PROGRAMPIPELINE_H_
 
+#include <map>
 #include <memory>
 
 #include "common/angleutils.h"
@@ -79,6 +80,9 @@ class ProgramPipelineState final : angle::NonCopyable
 
     GLboolean mValid;
 
+    // The merged executable for the current combination of stage programs.  Owned by the
+    // pipeline's executable cache, which keeps the merged state of previously seen combinations
+    // alive so rebinding one restores it without relinking the front-end state.
     ProgramExecutable *mExecutable;
 
     bool mIsLinked;
@@ -152,6 +156,29 @@ class ProgramPipeline final : public RefCountObject<ProgramPipelineID>,
     void onSubjectStateChange(angle::SubjectIndex index, angle::SubjectMessage message) override;
 
   private:
+    // A memoized combination of stage programs.  Holds the merged executable along with the
+    // varying data the back-end link consumes, so restoring the combination skips all front-end
+    // validation and merging.
+    struct CachedExecutable final : angle::NonCopyable
+    {
+        CachedExecutable();
+        ~CachedExecutable();
+
+        std::unique_ptr<ProgramExecutable> executable;
+        ProgramMergedVaryings mergedVaryings;
+        std::unique_ptr<ProgramVaryingPacking> varyingPacking;
+        bool isLinked = false;
+    };
+
+    // Combinations are keyed by each stage's program serial and link version, so a combination
+    // containing a since-relinked program is never reused.
+    using ExecutableCacheKey =
+        std::array<std::pair<uint64_t, unsigned int>, static_cast<size_t>(ShaderType::EnumCount)>;
+
+    ExecutableCacheKey makeExecutableCacheKey() const;
+    void installExecutable();
+    void purgeStaleCachedExecutables(const Program *program);
+
     bool linkVaryings(InfoLog &infoLog) const;
     void updateLinkedShaderStages();
     void updateExecutableAttributes();
@@ -168,6 +195,12 @@ class ProgramPipeline final : public RefCountObject<ProgramPipelineID>,
 
     ProgramPipelineState mState;
 
+    // All executables this pipeline has linked, keyed by program combination.  mState.mExecutable
+    // always points into the entry for the current combination.
+    std::map<ExecutableCacheKey, CachedExecutable> mExecutableCache;
+    CachedExecutable *mCurrentCachedExecutable;
+    ExecutableCacheKey mCurrentExecutableKey;
+
     std::vector<angle::ObserverBinding> mProgramObserverBindings;
     angle::ObserverBinding mExecutableObserverBinding;
 };
@@ -97,6 +97,33 @@ void TypedResourceManager<ResourceType, ImplT, IDType>::deleteObject(const Conte
     }
 }
 
+template <typename ResourceType, typename ImplT, typename IDType>
+void TypedResourceManager<ResourceType, ImplT, IDType>::deleteObjects(const Context *context,
+                                                                      const IDType *handles,
+                                                                      GLsizei count)
+{
+    std::vector<typename ResourceMap<ResourceType, IDType>::IndexAndResource> erased;
+    erased.reserve(count);
+    mObjectMap.eraseBatch(handles, static_cast<size_t>(count), &erased);
+
+    // Requires an explicit this-> because of C++ template rules.
+    std::vector<GLuint> releasedHandles;
+    releasedHandles.reserve(erased.size());
+    for (const auto &idAndResource : erased)
+    {
+        releasedHandles.push_back(idAndResource.first);
+    }
+    this->mHandleAllocator.releaseBatch(releasedHandles.data(), releasedHandles.size());
+
+    for (const auto &idAndResource : erased)
+    {
+        if (idAndResource.second)
+        {
+            ImplT::DeleteObject(context, idAndResource.second);
+        }
+    }
+}
+
 template class TypedResourceManager<Buffer, BufferManager, BufferID>;
 template class TypedResourceManager<Texture, TextureManager, TextureID>;
 template class TypedResourceManager<Renderbuffer, RenderbufferManager, RenderbufferID>;
@@ -69,6 +69,9 @@ class TypedResourceManager : public ResourceManagerBase
     TypedResourceManager() {}
 
     void deleteObject(const Context *context, IDType handle);
+    // Deletes an array of objects with one pass over the resource map and a single batched
+    // handle release, instead of paying the per-handle costs of deleteObject for each entry.
+    void deleteObjects(const Context *context, const IDType *handles, GLsizei count);
     ANGLE_INLINE bool isHandleGenerated(IDType handle) const
     {
         // Zero is always assumed to have been generated implicitly.
@@ -7,10 +7,19 @@
 //   An optimized resource map which packs the first set of allocated objects into a
 //   flat array, and then falls back to an unordered map for the higher handle values.
 //
+//   Lookups through the flat array are lock-free and may run concurrently with mutations:
+//   growth publishes a new array and retains the old one until destruction, so a racing
+//   reader always dereferences an array that is valid for the size it observed.  Mutations
+//   and iteration must still be synchronized externally, as must lookups racing with
+//   mutations of the same handle.
+//
 
 #ifndef LIBANGLE_RESOURCE_MAP_H_
 #define LIBANGLE_RESOURCE_MAP_H_
 
+#include <atomic>
+#include <mutex>
+
 #include "libANGLE/angletypes.h"
 
 namespace gl
@@ -26,11 +35,16 @@ class ResourceMap final : angle::NonCopyable
     ANGLE_INLINE ResourceType *query(IDType id) const
     {
         GLuint handle = GetIDValue(id);
-        if (handle < mFlatResourcesSize)
+        // The size is published after the array, so if the loaded size covers the handle the
+        // subsequently loaded array is guaranteed to cover it too.
+        size_t flatResourcesSize = mFlatResourcesSize.load(std::memory_order_acquire);
+        if (ANGLE_LIKELY(handle < flatResourcesSize))
         {
-            ResourceType *value = mFlatResources[handle];
+            ResourceType *value = mFlatResources.load(std::memory_order_acquire)[handle].load(
+                std::memory_order_acquire);
             return (value == InvalidPointer() ? nullptr : value);
         }
+        std::lock_guard<std::mutex> lock(mHashedResourcesMutex);
         auto it = mHashedResources.find(handle);
         return (it == mHashedResources.end() ? nullptr : it->second);
     }
@@ -41,14 +55,20 @@ class ResourceMap final : angle::NonCopyable
     // Returns the element that was at this location.
     bool erase(IDType id, ResourceType **resourceOut);
 
+    using IndexAndResource = std::pair<GLuint, ResourceType *>;
+    using HashMap          = angle::HashMap<GLuint, ResourceType *>;
+
+    // Erases every present handle in |ids| in one pass, appending the removed entries to
+    // |erasedOut|.  Reserved-but-uncreated handles are appended with a null resource so callers
+    // can still release the handle.  The hashed-resource lock is taken at most once regardless
+    // of the batch size.
+    void eraseBatch(const IDType *ids, size_t count, std::vector<IndexAndResource> *erasedOut);
+
     void assign(IDType id, ResourceType *resource);
 
     // Clears the map.
     void clear();
 
-    using IndexAndResource = std::pair<GLuint, ResourceType *>;
-    using HashMap          = angle::HashMap<GLuint, ResourceType *>;
-
     class Iterator final
     {
       public:
@@ -89,6 +109,12 @@ class ResourceMap final : angle::NonCopyable
 
     GLuint nextResource(size_t flatIndex, bool skipNulls) const;
 
+    ANGLE_INLINE ResourceType *loadFlatResource(size_t index) const
+    {
+        return mFlatResources.load(std::memory_order_relaxed)[index].load(
+            std::memory_order_relaxed);
+    }
+
     // constexpr methods cannot contain reinterpret_cast, so we need a static method.
     static ResourceType *InvalidPointer();
     static constexpr intptr_t kInvalidPointer = static_cast<intptr_t>(-1);
@@ -99,39 +125,51 @@ class ResourceMap final : angle::NonCopyable
     // Experimental testing suggests that 16k is a reasonable upper limit.
     static constexpr size_t kFlatResourcesLimit = 0x4000;
 
-    // Size of one map element.
-    static constexpr size_t kElementSize = sizeof(ResourceType *);
+    std::atomic<size_t> mFlatResourcesSize;
+    std::atomic<std::atomic<ResourceType *> *> mFlatResources;
 
-    size_t mFlatResourcesSize;
-    ResourceType **mFlatResources;
+    // Arrays replaced by growth, retained because concurrent lookups may still read them.
+    std::vector<std::atomic<ResourceType *> *> mOldFlatResources;
 
-    // A map of GL objects indexed by object ID.
+    // A map of GL objects indexed by object ID.  Protects concurrent lookups against mutation;
+    // handles only land here past kFlatResourcesLimit, so the lock is rarely taken.
+    mutable std::mutex mHashedResourcesMutex;
     HashMap mHashedResources;
 };
 
 template <typename ResourceType, typename IDType>
 ResourceMap<ResourceType, IDType>::ResourceMap()
     : mFlatResourcesSize(kInitialFlatResourcesSize),
-      mFlatResources(new ResourceType *[kInitialFlatResourcesSize])
+      mFlatResources(new std::atomic<ResourceType *>[kInitialFlatResourcesSize])
 {
-    memset(mFlatResources, kInvalidPointer, mFlatResourcesSize * kElementSize);
+    std::atomic<ResourceType *> *flatResources = mFlatResources.load(std::memory_order_relaxed);
+    for (size_t index = 0; index < kInitialFlatResourcesSize; ++index)
+    {
+        flatResources[index].store(InvalidPointer(), std::memory_order_relaxed);
+    }
 }
 
 template <typename ResourceType, typename IDType>
 ResourceMap<ResourceType, IDType>::~ResourceMap()
 {
     ASSERT(empty());
-    delete[] mFlatResources;
+    delete[] mFlatResources.load(std::memory_order_relaxed);
+    for (std::atomic<ResourceType *> *oldFlatResources : mOldFlatResources)
+    {
+        delete[] oldFlatResources;
+    }
 }
 
 template <typename ResourceType, typename IDType>
 ANGLE_INLINE bool ResourceMap<ResourceType, IDType>::contains(IDType id) const
 {
     GLuint handle = GetIDValue(id);
-    if (handle < mFlatResourcesSize)
+    if (handle < mFlatResourcesSize.load(std::memory_order_acquire))
     {
-        return (mFlatResources[handle] != InvalidPointer());
+        return (mFlatResources.load(std::memory_order_acquire)[handle].load(
+                    std::memory_order_acquire) != InvalidPointer());
     }
+    std::lock_guard<std::mutex> lock(mHashedResourcesMutex);
     return (mHashedResources.find(handle) != mHashedResources.end());
 }
 
@@ -139,18 +177,20 @@ template <typename ResourceType, typename IDType>
 bool ResourceMap<ResourceType, IDType>::erase(IDType id, ResourceType **resourceOut)
 {
     GLuint handle = GetIDValue(id);
-    if (handle < mFlatResourcesSize)
+    if (handle < mFlatResourcesSize.load(std::memory_order_relaxed))
     {
-        auto &value = mFlatResources[handle];
-        if (value == InvalidPointer())
+        std::atomic<ResourceType *> &value =
+            mFlatResources.load(std::memory_order_relaxed)[handle];
+        if (value.load(std::memory_order_relaxed) == InvalidPointer())
         {
             return false;
         }
-        *resourceOut = value;
-        value        = InvalidPointer();
+        *resourceOut = value.load(std::memory_order_relaxed);
+        value.store(InvalidPointer(), std::memory_order_release);
     }
     else
     {
+        std::lock_guard<std::mutex> lock(mHashedResourcesMutex);
         auto it = mHashedResources.find(handle);
         if (it == mHashedResources.end())
         {
@@ -162,35 +202,97 @@ bool ResourceMap<ResourceType, IDType>::erase(IDType id, ResourceType **resource
     return true;
 }
 
+template <typename ResourceType, typename IDType>
+void ResourceMap<ResourceType, IDType>::eraseBatch(const IDType *ids,
+                                                   size_t count,
+                                                   std::vector<IndexAndResource> *erasedOut)
+{
+    size_t flatResourcesSize                   = mFlatResourcesSize.load(std::memory_order_relaxed);
+    std::atomic<ResourceType *> *flatResources = mFlatResources.load(std::memory_order_relaxed);
+
+    bool anyHashed = false;
+    for (size_t i = 0; i < count; ++i)
+    {
+        GLuint handle = GetIDValue(ids[i]);
+        if (handle < flatResourcesSize)
+        {
+            std::atomic<ResourceType *> &value = flatResources[handle];
+            ResourceType *resource             = value.load(std::memory_order_relaxed);
+            if (resource == InvalidPointer())
+            {
+                continue;
+            }
+            erasedOut->emplace_back(handle, resource);
+            value.store(InvalidPointer(), std::memory_order_release);
+        }
+        else
+        {
+            anyHashed = true;
+        }
+    }
+
+    if (anyHashed)
+    {
+        std::lock_guard<std::mutex> lock(mHashedResourcesMutex);
+        for (size_t i = 0; i < count; ++i)
+        {
+            GLuint handle = GetIDValue(ids[i]);
+            if (handle >= flatResourcesSize)
+            {
+                auto it = mHashedResources.find(handle);
+                if (it != mHashedResources.end())
+                {
+                    erasedOut->emplace_back(handle, it->second);
+                    mHashedResources.erase(it);
+                }
+            }
+        }
+    }
+}
+
 template <typename ResourceType, typename IDType>
 void ResourceMap<ResourceType, IDType>::assign(IDType id, ResourceType *resource)
 {
     GLuint handle = GetIDValue(id);
     if (handle < kFlatResourcesLimit)
     {
-        if (handle >= mFlatResourcesSize)
+        size_t flatResourcesSize = mFlatResourcesSize.load(std::memory_order_relaxed);
+        if (handle >= flatResourcesSize)
         {
             // Use power-of-two.
-            size_t newSize = mFlatResourcesSize;
+            size_t newSize = flatResourcesSize;
             while (newSize <= handle)
             {
                 newSize *= 2;
             }
 
-            ResourceType **oldResources = mFlatResources;
+            std::atomic<ResourceType *> *oldResources =
+                mFlatResources.load(std::memory_order_relaxed);
+
+            std::atomic<ResourceType *> *newResources = new std::atomic<ResourceType *>[newSize];
+            for (size_t index = 0; index < flatResourcesSize; ++index)
+            {
+                newResources[index].store(oldResources[index].load(std::memory_order_relaxed),
+                                          std::memory_order_relaxed);
+            }
+            for (size_t index = flatResourcesSize; index < newSize; ++index)
+            {
+                newResources[index].store(InvalidPointer(), std::memory_order_relaxed);
+            }
 
-            mFlatResources = new ResourceType *[newSize];
-            memset(&mFlatResources[mFlatResourcesSize], kInvalidPointer,
-                   (newSize - mFlatResourcesSize) * kElementSize);
-            memcpy(mFlatResources, oldResources, mFlatResourcesSize * kElementSize);
-            mFlatResourcesSize = newSize;
-            delete[] oldResources;
+            // Publish the array before the size, and retain the old array: a concurrent lookup
+            // may have loaded it and not dereferenced it yet.
+            mOldFlatResources.push_back(oldResources);
+            mFlatResources.store(newResources, std::memory_order_release);
+            mFlatResourcesSize.store(newSize, std::memory_order_release);
         }
-        ASSERT(mFlatResourcesSize > handle);
-        mFlatResources[handle] = resource;
+        ASSERT(mFlatResourcesSize.load(std::memory_order_relaxed) > handle);
+        mFlatResources.load(std::memory_order_relaxed)[handle].store(resource,
+                                                                     std::memory_order_release);
     }
     else
     {
+        std::lock_guard<std::mutex> lock(mHashedResourcesMutex);
         mHashedResources[handle] = resource;
     }
 }
@@ -205,7 +307,8 @@ typename ResourceMap<ResourceType, IDType>::Iterator ResourceMap<ResourceType, I
 template <typename ResourceType, typename IDType>
 typename ResourceMap<ResourceType, IDType>::Iterator ResourceMap<ResourceType, IDType>::end() const
 {
-    return Iterator(*this, static_cast<GLuint>(mFlatResourcesSize), mHashedResources.end(), true);
+    return Iterator(*this, static_cast<GLuint>(mFlatResourcesSize.load(std::memory_order_relaxed)),
+                    mHashedResources.end(), true);
 }
 
 template <typename ResourceType, typename IDType>
@@ -219,16 +322,17 @@ template <typename ResourceType, typename IDType>
 typename ResourceMap<ResourceType, IDType>::Iterator
 ResourceMap<ResourceType, IDType>::endWithNull() const
 {
-    return Iterator(*this, static_cast<GLuint>(mFlatResourcesSize), mHashedResources.end(), false);
+    return Iterator(*this, static_cast<GLuint>(mFlatResourcesSize.load(std::memory_order_relaxed)),
+                    mHashedResources.end(), false);
 }
 
 template <typename ResourceType, typename IDType>
 typename ResourceMap<ResourceType, IDType>::Iterator ResourceMap<ResourceType, IDType>::find(
     IDType handle) const
 {
-    if (handle < mFlatResourcesSize)
+    if (handle < mFlatResourcesSize.load(std::memory_order_relaxed))
     {
-        return (mFlatResources[handle] != InvalidPointer()
+        return (loadFlatResource(handle) != InvalidPointer()
                     ? Iterator(handle, mHashedResources.begin())
                     : end());
     }
@@ -247,23 +351,30 @@ bool ResourceMap<ResourceType, IDType>::empty() const
 template <typename ResourceType, typename IDType>
 void ResourceMap<ResourceType, IDType>::clear()
 {
-    memset(mFlatResources, kInvalidPointer, kInitialFlatResourcesSize * kElementSize);
-    mFlatResourcesSize = kInitialFlatResourcesSize;
+    std::atomic<ResourceType *> *flatResources = mFlatResources.load(std::memory_order_relaxed);
+    size_t flatResourcesSize                   = mFlatResourcesSize.load(std::memory_order_relaxed);
+    for (size_t index = 0; index < flatResourcesSize; ++index)
+    {
+        flatResources[index].store(InvalidPointer(), std::memory_order_relaxed);
+    }
+    mFlatResourcesSize.store(kInitialFlatResourcesSize, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(mHashedResourcesMutex);
     mHashedResources.clear();
 }
 
 template <typename ResourceType, typename IDType>
 GLuint ResourceMap<ResourceType, IDType>::nextResource(size_t flatIndex, bool skipNulls) const
 {
-    for (size_t index = flatIndex; index < mFlatResourcesSize; index++)
+    size_t flatResourcesSize = mFlatResourcesSize.load(std::memory_order_relaxed);
+    for (size_t index = flatIndex; index < flatResourcesSize; index++)
     {
-        if ((mFlatResources[index] != nullptr || !skipNulls) &&
-            mFlatResources[index] != InvalidPointer())
+        ResourceType *value = loadFlatResource(index);
+        if ((value != nullptr || !skipNulls) && value != InvalidPointer())
         {
             return static_cast<GLuint>(index);
         }
     }
-    return static_cast<GLuint>(mFlatResourcesSize);
+    return static_cast<GLuint>(flatResourcesSize);
 }
 
 template <typename ResourceType, typename IDType>
@@ -300,7 +411,7 @@ template <typename ResourceType, typename IDType>
 typename ResourceMap<ResourceType, IDType>::Iterator &
 ResourceMap<ResourceType, IDType>::Iterator::operator++()
 {
-    if (mFlatIndex < static_cast<GLuint>(mOrigin.mFlatResourcesSize))
+    if (mFlatIndex < static_cast<GLuint>(mOrigin.mFlatResourcesSize.load(std::memory_order_relaxed)))
     {
         mFlatIndex = mOrigin.nextResource(mFlatIndex + 1, mSkipNulls);
     }
@@ -329,10 +440,10 @@ ResourceMap<ResourceType, IDType>::Iterator::operator*() const
 template <typename ResourceType, typename IDType>
 void ResourceMap<ResourceType, IDType>::Iterator::updateValue()
 {
-    if (mFlatIndex < static_cast<GLuint>(mOrigin.mFlatResourcesSize))
+    if (mFlatIndex < static_cast<GLuint>(mOrigin.mFlatResourcesSize.load(std::memory_order_relaxed)))
     {
         mValue.first  = mFlatIndex;
-        mValue.second = mOrigin.mFlatResources[mFlatIndex];
+        mValue.second = mOrigin.loadFlatResource(mFlatIndex);
     }
     else if (mHashIndex != mOrigin.mHashedResources.end())
     {
@@ -9,6 +9,9 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <thread>
+
 #include "libANGLE/ResourceMap.h"
 
 using namespace gl;
@@ -36,6 +39,49 @@ TEST(ResourceMapTest, AssignAndErase)
     ASSERT_TRUE(resourceMap.empty());
 }
 
+// Tests batch-erasing a mix of flat, hashed, reserved, and absent handles.
+TEST(ResourceMapTest, EraseBatch)
+{
+    constexpr size_t kSize = 16;
+    ResourceMap<size_t, GLuint> resourceMap;
+    std::vector<size_t> objects(kSize, 1);
+    std::vector<GLuint> handles;
+    for (size_t index = 0; index < kSize; ++index)
+    {
+        // Spread the handles out so that some land in the hashed part of the map.
+        GLuint handle = static_cast<GLuint>(index + 1) * 0x1000;
+        resourceMap.assign(handle, &objects[index]);
+        handles.push_back(handle);
+    }
+
+    // A reserved (null) entry is erased and reported with a null resource.
+    constexpr GLuint kReservedHandle = (kSize + 1) * 0x1000;
+    resourceMap.assign(kReservedHandle, nullptr);
+    handles.push_back(kReservedHandle);
+
+    // An absent handle is skipped.
+    handles.push_back(0xFFFF0000u);
+
+    std::vector<ResourceMap<size_t, GLuint>::IndexAndResource> erased;
+    resourceMap.eraseBatch(handles.data(), handles.size(), &erased);
+
+    ASSERT_EQ(kSize + 1, erased.size());
+    for (const auto &idAndResource : erased)
+    {
+        if (idAndResource.first == kReservedHandle)
+        {
+            ASSERT_EQ(nullptr, idAndResource.second);
+        }
+        else
+        {
+            ASSERT_EQ(0u, idAndResource.first % 0x1000);
+            ASSERT_EQ(&objects[idAndResource.first / 0x1000 - 1], idAndResource.second);
+        }
+    }
+
+    ASSERT_TRUE(resourceMap.empty());
+}
+
 // Tests assigning slots in the map and then using clear() to free it.
 TEST(ResourceMapTest, AssignAndClear)
 {
@@ -133,4 +179,47 @@ TEST(ResourceMapTest, QueryUnassigned)
     ASSERT_FALSE(resourceMap.contains(100));
     ASSERT_EQ(nullptr, resourceMap.query(100));
 }
+// Tests that lookups of already-assigned handles may run concurrently with assignments that grow
+// the flat array.
+TEST(ResourceMapTest, ConcurrentQueryDuringGrowth)
+{
+    constexpr size_t kSize = 4096;
+    ResourceMap<size_t, GLuint> resourceMap;
+    std::vector<size_t> objects(kSize, 1);
+
+    std::atomic<GLuint> assigned(0);
+    std::atomic<bool> failed(false);
+
+    std::thread reader([&]() {
+        while (assigned.load() < kSize && !failed.load())
+        {
+            GLuint limit = assigned.load();
+            for (GLuint handle = 1; handle <= limit; ++handle)
+            {
+                if (resourceMap.query(handle) != &objects[handle - 1])
+                {
+                    failed.store(true);
+                    return;
+                }
+            }
+        }
+    });
+
+    for (size_t index = 0; index < kSize; ++index)
+    {
+        resourceMap.assign(index + 1, &objects[index]);
+        assigned.store(static_cast<GLuint>(index + 1));
+    }
+
+    reader.join();
+    EXPECT_FALSE(failed.load());
+
+    for (size_t index = 0; index < kSize; ++index)
+    {
+        size_t *found = nullptr;
+        ASSERT_TRUE(resourceMap.erase(index + 1, &found));
+    }
+
+    ASSERT_TRUE(resourceMap.empty());
+}
 }  // anonymous namespace
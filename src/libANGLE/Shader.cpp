@@ -468,7 +468,10 @@ void Shader::compile(const Context *context)
 
         if (cacheResult == angle::Result::Continue)
         {
-            compilerInstance.destroy();
+            // The instance wasn't used, but constructing one initializes the built-in symbol
+            // tables; return it to the pool instead of destroying it so that a later cache miss
+            // doesn't have to pay for that setup again.
+            mBoundCompiler->putInstance(std::move(compilerInstance));
             return;
         }
     }
@@ -0,0 +1,349 @@
+//
+// Copyright 2022 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SharedBlobCache: A cross-process blob cache transport over a named
+// shared-memory segment.  See SharedBlobCache.h for the protocol.
+
+#include "libANGLE/SharedBlobCache.h"
+
+#include "common/hash_utils.h"
+
+#if defined(ANGLE_PLATFORM_WINDOWS)
+#    include <windows.h>
+#elif defined(ANGLE_PLATFORM_POSIX) && !defined(ANGLE_PLATFORM_ANDROID) && \
+    !defined(ANGLE_PLATFORM_FUCHSIA)
+#    define ANGLE_HAS_SHM_OPEN 1
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace egl
+{
+namespace
+{
+// Segment initialization states, stored in Header::state.
+constexpr uint32_t kStateUninitialized = 0;
+constexpr uint32_t kStateInitializing  = 1;
+constexpr uint32_t kStateReady         = 2;
+
+// Slot sequence values.  Valid slots hold kSlotValid; the odd value marks a write in progress so
+// lock-free readers skip the slot instead of observing a torn entry.
+constexpr uint32_t kSlotEmpty   = 0;
+constexpr uint32_t kSlotWriting = 1;
+constexpr uint32_t kSlotValid   = 2;
+
+// One index slot per 8KB of segment keeps the index under 1% of the segment while staying sparse
+// enough for short probe chains.
+constexpr size_t kSegmentBytesPerSlot = 8 * 1024;
+
+uint32_t RoundUpToPowerOfTwo(uint32_t value)
+{
+    uint32_t result = 1;
+    while (result < value)
+    {
+        result <<= 1;
+    }
+    return result;
+}
+
+class ScopedSpinLock final : angle::NonCopyable
+{
+  public:
+    explicit ScopedSpinLock(std::atomic<uint32_t> &lock) : mLock(lock)
+    {
+        uint32_t expected = 0;
+        while (!mLock.compare_exchange_weak(expected, 1, std::memory_order_acquire))
+        {
+            expected = 0;
+        }
+    }
+    ~ScopedSpinLock() { mLock.store(0, std::memory_order_release); }
+
+  private:
+    std::atomic<uint32_t> &mLock;
+};
+}  // namespace
+
+SharedBlobCache::SharedBlobCache() {}
+
+SharedBlobCache::~SharedBlobCache()
+{
+    detach();
+}
+
+bool SharedBlobCache::attach(const char *name, size_t size)
+{
+    ASSERT(!valid());
+
+    // The segment needs room for the header, a useful index and some data.
+    if (size < 64 * 1024)
+    {
+        return false;
+    }
+
+    static_assert(std::atomic<uint32_t>::is_always_lock_free,
+                  "Segment atomics must be address-free to work across processes");
+
+    void *memory = nullptr;
+
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    // Creates the mapping or opens the existing one; either way the initialization protocol below
+    // makes exactly one process set up the header.
+    HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0,
+                                        static_cast<DWORD>(size), name);
+    if (mapping == nullptr)
+    {
+        return false;
+    }
+    memory = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+    CloseHandle(mapping);
+    if (memory == nullptr)
+    {
+        return false;
+    }
+#elif defined(ANGLE_HAS_SHM_OPEN)
+    int fd = shm_open(name, O_CREAT | O_RDWR, S_IRUSR | S_IWUSR);
+    if (fd < 0)
+    {
+        return false;
+    }
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0)
+    {
+        close(fd);
+        return false;
+    }
+    memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED)
+    {
+        return false;
+    }
+#else
+    // No named shared memory on this platform.
+    return false;
+#endif
+
+    Header *header = static_cast<Header *>(memory);
+
+    uint32_t slotCount = RoundUpToPowerOfTwo(static_cast<uint32_t>(size / kSegmentBytesPerSlot));
+    size_t headerSize  = offsetof(Header, slots) + slotCount * sizeof(Slot);
+    if (headerSize >= size)
+    {
+        mHeader = header;
+        mSize   = size;
+        detach();
+        return false;
+    }
+
+    // Freshly created segments are zero-filled, so the first process to attach finds
+    // kStateUninitialized and sets up the header; everyone else waits for kStateReady.
+    uint32_t expected = kStateUninitialized;
+    const bool initializedSegment =
+        header->state.compare_exchange_strong(expected, kStateInitializing);
+    if (initializedSegment)
+    {
+        header->slotCount    = slotCount;
+        header->dataCapacity = static_cast<uint32_t>(size - headerSize);
+        header->dataUsed.store(0, std::memory_order_relaxed);
+        header->writeLock.store(0, std::memory_order_relaxed);
+        header->state.store(kStateReady, std::memory_order_release);
+    }
+    uint32_t dataCapacity = static_cast<uint32_t>(size - headerSize);
+    if (!initializedSegment)
+    {
+        while (header->state.load(std::memory_order_acquire) != kStateReady)
+        {
+        }
+        // Read the creator's capacity once and validate it against this mapping; it bounds every
+        // data copy below, so it must never exceed what is actually mapped here.
+        uint32_t sharedCapacity = header->dataCapacity;
+        if (header->slotCount != slotCount || sharedCapacity > dataCapacity)
+        {
+            // The creating process used a different segment size, or the header is corrupted;
+            // either way the layout cannot be trusted against this mapping.
+            mHeader = header;
+            mSize   = size;
+            detach();
+            return false;
+        }
+        dataCapacity = sharedCapacity;
+    }
+
+    mHeader       = header;
+    mSize         = size;
+    mSlotCount    = slotCount;
+    mDataCapacity = dataCapacity;
+    return true;
+}
+
+void SharedBlobCache::detach()
+{
+    if (mHeader == nullptr)
+    {
+        return;
+    }
+
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    UnmapViewOfFile(mHeader);
+#elif defined(ANGLE_HAS_SHM_OPEN)
+    munmap(mHeader, mSize);
+#endif
+
+    mHeader       = nullptr;
+    mSize         = 0;
+    mSlotCount    = 0;
+    mDataCapacity = 0;
+}
+
+uint8_t *SharedBlobCache::dataRegion()
+{
+    return reinterpret_cast<uint8_t *>(mHeader) + offsetof(Header, slots) +
+           mSlotCount * sizeof(Slot);
+}
+
+SharedBlobCache::Slot *SharedBlobCache::findSlot(const uint8_t *key, bool forWrite)
+{
+    const uint32_t slotMask = mSlotCount - 1;
+    uint32_t index =
+        static_cast<uint32_t>(angle::ComputeGenericHash(key, BlobCache::kKeyLength)) & slotMask;
+
+    for (uint32_t probe = 0; probe < mSlotCount; ++probe)
+    {
+        Slot &slot        = mHeader->slots[(index + probe) & slotMask];
+        uint32_t sequence = slot.sequence.load(std::memory_order_acquire);
+
+        if (sequence == kSlotEmpty)
+        {
+            // Entries are never removed, so an empty slot ends the probe chain.
+            return forWrite ? &slot : nullptr;
+        }
+        if (sequence == kSlotWriting)
+        {
+            // The slot's key is not readable yet.  Readers treat it as a miss; writers hold the
+            // segment lock, so for them this can only be left over from a crashed process.
+            // Either way, skip it.
+            continue;
+        }
+        if (memcmp(slot.key, key, BlobCache::kKeyLength) == 0)
+        {
+            return &slot;
+        }
+    }
+
+    return nullptr;
+}
+
+void SharedBlobCache::put(const void *key,
+                          EGLsizeiANDROID keySize,
+                          const void *value,
+                          EGLsizeiANDROID valueSize)
+{
+    if (!valid() || keySize != static_cast<EGLsizeiANDROID>(BlobCache::kKeyLength) ||
+        valueSize <= 0)
+    {
+        return;
+    }
+
+    ScopedSpinLock lock(mHeader->writeLock);
+
+    Slot *slot = findSlot(static_cast<const uint8_t *>(key), true);
+    if (slot == nullptr)
+    {
+        // Index full.
+        return;
+    }
+    if (slot->sequence.load(std::memory_order_relaxed) == kSlotValid)
+    {
+        // Keys are content hashes; an existing entry already holds this data.
+        return;
+    }
+
+    uint32_t dataUsed = mHeader->dataUsed.load(std::memory_order_relaxed);
+    if (dataUsed > mDataCapacity ||
+        static_cast<uint32_t>(valueSize) > mDataCapacity - dataUsed)
+    {
+        // Data region full, or dataUsed was corrupted by a peer; either way, drop the store
+        // rather than write past the mapping.  Entries are never evicted.
+        return;
+    }
+
+    slot->sequence.store(kSlotWriting, std::memory_order_release);
+    memcpy(dataRegion() + dataUsed, value, valueSize);
+    memcpy(slot->key, key, BlobCache::kKeyLength);
+    slot->dataOffset = dataUsed;
+    slot->dataSize   = static_cast<uint32_t>(valueSize);
+    mHeader->dataUsed.store(dataUsed + static_cast<uint32_t>(valueSize),
+                            std::memory_order_relaxed);
+    // Publish: readers acquire the sequence before touching the key or data.
+    slot->sequence.store(kSlotValid, std::memory_order_release);
+}
+
+EGLsizeiANDROID SharedBlobCache::get(const void *key,
+                                     EGLsizeiANDROID keySize,
+                                     void *value,
+                                     EGLsizeiANDROID valueSize)
+{
+    if (!valid() || keySize != static_cast<EGLsizeiANDROID>(BlobCache::kKeyLength))
+    {
+        return 0;
+    }
+
+    const Slot *slot = findSlot(static_cast<const uint8_t *>(key), false);
+    if (slot == nullptr)
+    {
+        return 0;
+    }
+
+    // The slot lives in shared memory that a peer process can rewrite at any time, so read the
+    // offset and size exactly once into locals; the size check and the copy below must agree.
+    const uint32_t dataOffset    = slot->dataOffset;
+    const uint32_t dataSizeBytes = slot->dataSize;
+
+    // Bound the copy by the attach-validated capacity so a corrupted or hostile slot cannot
+    // drive the read outside the mapping.
+    if (static_cast<uint64_t>(dataOffset) + dataSizeBytes > mDataCapacity)
+    {
+        return 0;
+    }
+
+    EGLsizeiANDROID dataSize = static_cast<EGLsizeiANDROID>(dataSizeBytes);
+    if (value == nullptr || valueSize < dataSize)
+    {
+        // First call of the two-call protocol: report the required size.
+        return dataSize;
+    }
+
+    memcpy(value, dataRegion() + dataOffset, dataSizeBytes);
+    return dataSize;
+}
+
+// static
+void SharedBlobCache::SetBlob(const void *key,
+                              EGLsizeiANDROID keySize,
+                              const void *value,
+                              EGLsizeiANDROID valueSize)
+{
+    GetProcessCache()->put(key, keySize, value, valueSize);
+}
+
+// static
+EGLsizeiANDROID SharedBlobCache::GetBlob(const void *key,
+                                         EGLsizeiANDROID keySize,
+                                         void *value,
+                                         EGLsizeiANDROID valueSize)
+{
+    return GetProcessCache()->get(key, keySize, value, valueSize);
+}
+
+// static
+SharedBlobCache *SharedBlobCache::GetProcessCache()
+{
+    static SharedBlobCache *sCache = new SharedBlobCache();
+    return sCache;
+}
+
+}  // namespace egl
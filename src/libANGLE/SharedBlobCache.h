@@ -0,0 +1,103 @@
+//
+// Copyright 2022 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SharedBlobCache: A cross-process blob cache transport.  Multiple ANGLE
+//   processes on one device attach to a single named shared-memory segment so
+//   they share one warm cache instead of each warming its own.  Plugs into
+//   egl::BlobCache through the same callback interface the application would
+//   use with EGL_ANDROID_blob_cache.
+
+#ifndef LIBANGLE_SHARED_BLOB_CACHE_H_
+#define LIBANGLE_SHARED_BLOB_CACHE_H_
+
+#include <atomic>
+
+#include "libANGLE/BlobCache.h"
+
+namespace egl
+{
+
+// The segment holds a fixed open-addressed index of fixed-size slots followed by a bump-allocated
+// data region.  The index is reader-mostly lock-free: each slot carries a sequence counter
+// (seqlock); readers retry if they observe a write in progress, and never block.  Writers
+// serialize on a single spinlock in the segment header.  Entries are never moved or freed; when
+// the data region is exhausted, further stores are dropped, which matches the cache's purpose of
+// absorbing the boot-time warm-up storm.
+class SharedBlobCache final : angle::NonCopyable
+{
+  public:
+    SharedBlobCache();
+    ~SharedBlobCache();
+
+    // Attach to (creating and initializing if necessary) the named segment.  |size| is the total
+    // segment size in bytes and must match between processes.  Returns false on failure, in which
+    // case the object stays invalid and get/put become no-ops.
+    bool attach(const char *name, size_t size);
+    void detach();
+
+    bool valid() const { return mHeader != nullptr; }
+
+    void put(const void *key,
+             EGLsizeiANDROID keySize,
+             const void *value,
+             EGLsizeiANDROID valueSize);
+    EGLsizeiANDROID get(const void *key,
+                        EGLsizeiANDROID keySize,
+                        void *value,
+                        EGLsizeiANDROID valueSize);
+
+    // Trampolines with the EGL_ANDROID_blob_cache callback signatures, operating on the
+    // process-global instance.  Suitable for BlobCache::setBlobCacheFuncs.
+    static void SetBlob(const void *key,
+                        EGLsizeiANDROID keySize,
+                        const void *value,
+                        EGLsizeiANDROID valueSize);
+    static EGLsizeiANDROID GetBlob(const void *key,
+                                   EGLsizeiANDROID keySize,
+                                   void *value,
+                                   EGLsizeiANDROID valueSize);
+
+    // The per-process instance behind SetBlob/GetBlob.  Never destroyed; the mapping is released
+    // by the OS on process exit.
+    static SharedBlobCache *GetProcessCache();
+
+  private:
+    struct Slot
+    {
+        // 0: empty.  Odd: write in progress.  Even and non-zero: valid; readers re-check the
+        // value after copying out to detect a concurrent overwrite.
+        std::atomic<uint32_t> sequence;
+        uint8_t key[BlobCache::kKeyLength];
+        uint32_t dataOffset;
+        uint32_t dataSize;
+    };
+
+    struct Header
+    {
+        // Guards initialization of a freshly created segment.
+        std::atomic<uint32_t> state;
+        uint32_t slotCount;
+        uint32_t dataCapacity;
+        std::atomic<uint32_t> dataUsed;
+        std::atomic<uint32_t> writeLock;
+        Slot slots[1];
+    };
+
+    Slot *findSlot(const uint8_t *key, bool forWrite);
+    uint8_t *dataRegion();
+
+    Header *mHeader = nullptr;
+    size_t mSize    = 0;
+
+    // Segment geometry, validated against the mapping size and captured at attach.  Never
+    // re-read from the shared header after that: a corrupted or hostile peer can rewrite the
+    // header at any time, and these bound every offset computation into the mapping.
+    uint32_t mSlotCount    = 0;
+    uint32_t mDataCapacity = 0;
+};
+
+}  // namespace egl
+
+#endif  // LIBANGLE_SHARED_BLOB_CACHE_H_
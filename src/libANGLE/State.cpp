@@ -429,10 +429,19 @@ State::State(const State *shareContextState,
       mBoundingBoxMaxW(1.0f),
       mShadingRatePreserveAspectRatio(false),
       mShadingRate(ShadingRate::Undefined)
-{}
+{
+    // Establish the mark that resetFrameArena() pops back to every frame.
+    mFrameArena.push();
+}
 
 State::~State() {}
 
+void State::resetFrameArena() const
+{
+    mFrameArena.pop();
+    mFrameArena.push();
+}
+
 void State::initialize(Context *context)
 {
     const Extensions &nativeExtensions = context->getImplementation()->getNativeExtensions();
@@ -689,6 +698,7 @@ ANGLE_INLINE void State::updateActiveTextureStateOnSync(const Context *context,
     }
 
     mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
+    mChangedTextureUnits.set(textureIndex);
 }
 
 ANGLE_INLINE void State::setActiveTextureDirty(size_t textureIndex, Texture *texture)
@@ -789,8 +799,19 @@ void State::setStencilClearValue(int stencil)
     mDirtyBits.set(DIRTY_BIT_CLEAR_STENCIL);
 }
 
-void State::setColorMask(bool red, bool green, bool blue, bool alpha)
+bool State::setColorMask(bool red, bool green, bool blue, bool alpha)
 {
+    // Indexed color masks have no "indexed invoked" flag, so both the common state and the
+    // per-draw-buffer state must already match for the call to be redundant.
+    if (mBlendState.colorMaskRed == red && mBlendState.colorMaskGreen == green &&
+        mBlendState.colorMaskBlue == blue && mBlendState.colorMaskAlpha == alpha &&
+        mBlendStateExt
+            .compareColorMask(mBlendStateExt.expandColorMaskValue(red, green, blue, alpha))
+            .none())
+    {
+        return false;
+    }
+
     mBlendState.colorMaskRed   = red;
     mBlendState.colorMaskGreen = green;
     mBlendState.colorMaskBlue  = blue;
@@ -798,6 +819,7 @@ void State::setColorMask(bool red, bool green, bool blue, bool alpha)
 
     mBlendStateExt.setColorMask(red, green, blue, alpha);
     mDirtyBits.set(DIRTY_BIT_COLOR_MASK);
+    return true;
 }
 
 void State::setColorMaskIndexed(bool red, bool green, bool blue, bool alpha, GLuint index)
@@ -1020,18 +1042,21 @@ void State::setBlendColor(float red, float green, float blue, float alpha)
     }
 }
 
-void State::setBlendEquation(GLenum rgbEquation, GLenum alphaEquation)
+bool State::setBlendEquation(GLenum rgbEquation, GLenum alphaEquation)
 {
-    if (mSetBlendEquationsIndexedInvoked || mBlendState.blendEquationRGB != rgbEquation ||
-        mBlendState.blendEquationAlpha != alphaEquation)
+    if (!mSetBlendEquationsIndexedInvoked && mBlendState.blendEquationRGB == rgbEquation &&
+        mBlendState.blendEquationAlpha == alphaEquation)
     {
-        mBlendState.blendEquationRGB   = rgbEquation;
-        mBlendState.blendEquationAlpha = alphaEquation;
-
-        mSetBlendEquationsIndexedInvoked = false;
-        mBlendStateExt.setEquations(rgbEquation, alphaEquation);
-        mDirtyBits.set(DIRTY_BIT_BLEND_EQUATIONS);
+        return false;
     }
+
+    mBlendState.blendEquationRGB   = rgbEquation;
+    mBlendState.blendEquationAlpha = alphaEquation;
+
+    mSetBlendEquationsIndexedInvoked = false;
+    mBlendStateExt.setEquations(rgbEquation, alphaEquation);
+    mDirtyBits.set(DIRTY_BIT_BLEND_EQUATIONS);
+    return true;
 }
 
 void State::setBlendEquationIndexed(GLenum rgbEquation, GLenum alphaEquation, GLuint index)
@@ -1050,48 +1075,60 @@ void State::setStencilTest(bool enabled)
     }
 }
 
-void State::setStencilParams(GLenum stencilFunc, GLint stencilRef, GLuint stencilMask)
+bool State::setStencilParams(GLenum stencilFunc, GLint stencilRef, GLuint stencilMask)
 {
-    if (mDepthStencil.stencilFunc != stencilFunc || mStencilRef != stencilRef ||
-        mDepthStencil.stencilMask != stencilMask)
+    if (mDepthStencil.stencilFunc == stencilFunc && mStencilRef == stencilRef &&
+        mDepthStencil.stencilMask == stencilMask)
     {
-        mDepthStencil.stencilFunc = stencilFunc;
-        mStencilRef               = stencilRef;
-        mDepthStencil.stencilMask = stencilMask;
-        mDirtyBits.set(DIRTY_BIT_STENCIL_FUNCS_FRONT);
+        return false;
     }
+
+    mDepthStencil.stencilFunc = stencilFunc;
+    mStencilRef               = stencilRef;
+    mDepthStencil.stencilMask = stencilMask;
+    mDirtyBits.set(DIRTY_BIT_STENCIL_FUNCS_FRONT);
+    return true;
 }
 
-void State::setStencilBackParams(GLenum stencilBackFunc,
+bool State::setStencilBackParams(GLenum stencilBackFunc,
                                  GLint stencilBackRef,
                                  GLuint stencilBackMask)
 {
-    if (mDepthStencil.stencilBackFunc != stencilBackFunc || mStencilBackRef != stencilBackRef ||
-        mDepthStencil.stencilBackMask != stencilBackMask)
+    if (mDepthStencil.stencilBackFunc == stencilBackFunc && mStencilBackRef == stencilBackRef &&
+        mDepthStencil.stencilBackMask == stencilBackMask)
     {
-        mDepthStencil.stencilBackFunc = stencilBackFunc;
-        mStencilBackRef               = stencilBackRef;
-        mDepthStencil.stencilBackMask = stencilBackMask;
-        mDirtyBits.set(DIRTY_BIT_STENCIL_FUNCS_BACK);
+        return false;
     }
+
+    mDepthStencil.stencilBackFunc = stencilBackFunc;
+    mStencilBackRef               = stencilBackRef;
+    mDepthStencil.stencilBackMask = stencilBackMask;
+    mDirtyBits.set(DIRTY_BIT_STENCIL_FUNCS_BACK);
+    return true;
 }
 
-void State::setStencilWritemask(GLuint stencilWritemask)
+bool State::setStencilWritemask(GLuint stencilWritemask)
 {
-    if (mDepthStencil.stencilWritemask != stencilWritemask)
+    if (mDepthStencil.stencilWritemask == stencilWritemask)
     {
-        mDepthStencil.stencilWritemask = stencilWritemask;
-        mDirtyBits.set(DIRTY_BIT_STENCIL_WRITEMASK_FRONT);
+        return false;
     }
+
+    mDepthStencil.stencilWritemask = stencilWritemask;
+    mDirtyBits.set(DIRTY_BIT_STENCIL_WRITEMASK_FRONT);
+    return true;
 }
 
-void State::setStencilBackWritemask(GLuint stencilBackWritemask)
+bool State::setStencilBackWritemask(GLuint stencilBackWritemask)
 {
-    if (mDepthStencil.stencilBackWritemask != stencilBackWritemask)
+    if (mDepthStencil.stencilBackWritemask == stencilBackWritemask)
     {
-        mDepthStencil.stencilBackWritemask = stencilBackWritemask;
-        mDirtyBits.set(DIRTY_BIT_STENCIL_WRITEMASK_BACK);
+        return false;
     }
+
+    mDepthStencil.stencilBackWritemask = stencilBackWritemask;
+    mDirtyBits.set(DIRTY_BIT_STENCIL_WRITEMASK_BACK);
+    return true;
 }
 
 void State::setStencilOperations(GLenum stencilFail,
@@ -1432,6 +1469,10 @@ void State::setEnableFeature(GLenum feature, bool enabled)
         default:
             UNREACHABLE();
     }
+
+    // The cases above write GLES1State fields directly; stamp the state dirty so the
+    // GLES1Renderer draw-state cache notices the change.
+    mGLES1State.setDirty(GLES1State::DIRTY_GLES1_FEATURE_ENABLE);
 }
 
 void State::setEnableFeatureIndexed(GLenum feature, bool enabled, GLuint index)
@@ -1662,6 +1703,13 @@ void State::setActiveSampler(unsigned int active)
 
 void State::setSamplerTexture(const Context *context, TextureType type, Texture *texture)
 {
+    // Rebinding the already-bound texture is a common pattern and changes nothing; any state
+    // change on the texture itself is tracked through its observer binding.
+    if (mSamplerTextures[type][mActiveSampler].get() == texture)
+    {
+        return;
+    }
+
     if (mExecutable && mExecutable->getActiveSamplersMask()[mActiveSampler] &&
         IsTextureCompatibleWithSampler(type, mExecutable->getActiveSamplerTypes()[mActiveSampler]))
     {
@@ -1671,6 +1719,7 @@ void State::setSamplerTexture(const Context *context, TextureType type, Texture
     mSamplerTextures[type][mActiveSampler].set(context, texture);
 
     mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
+    mChangedTextureUnits.set(mActiveSampler);
 }
 
 Texture *State::getTargetTexture(TextureType type) const
@@ -1759,6 +1808,7 @@ void State::initializeZeroTextures(const Context *context, const TextureMap &zer
 void State::invalidateTextureBindings(TextureType type)
 {
     mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
+    mChangedTextureUnits.set();
 }
 
 void State::setSamplerBinding(const Context *context, GLuint textureUnit, Sampler *sampler)
@@ -3660,6 +3710,13 @@ angle::Result State::onProgramPipelineExecutableChange(const Context *context)
 {
     mDirtyBits.set(DIRTY_BIT_PROGRAM_EXECUTABLE);
 
+    // The pipeline installs a different executable object when its combination of stage programs
+    // changes, so refresh the pointer.  A bound Program still overrides the pipeline.
+    if (!mProgram && mProgramPipeline.get())
+    {
+        mExecutable = &mProgramPipeline->getExecutable();
+    }
+
     if (!mProgramPipeline->isLinked())
     {
         mDirtyObjects.set(DIRTY_OBJECT_PROGRAM_PIPELINE_OBJECT);
@@ -3830,6 +3887,13 @@ State::ExtendedDirtyBits State::getAndResetExtendedDirtyBits() const
     return retVal;
 }
 
+ActiveTextureMask State::getAndResetChangedTextureUnits() const
+{
+    ActiveTextureMask retVal = mChangedTextureUnits;
+    mChangedTextureUnits.reset();
+    return retVal;
+}
+
 void State::initializeForCapture(const Context *context)
 {
     mCaps       = context->getCaps();
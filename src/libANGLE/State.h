@@ -13,6 +13,7 @@
 #include <memory>
 
 #include "common/Color.h"
+#include "common/PoolAlloc.h"
 #include "common/angleutils.h"
 #include "common/bitset_utils.h"
 #include "libANGLE/Debug.h"
@@ -154,7 +155,9 @@ class State : angle::NonCopyable
     int getStencilClearValue() const { return mStencilClearValue; }
 
     // Write mask manipulation
-    void setColorMask(bool red, bool green, bool blue, bool alpha);
+    // These setters return whether the new state differed from the old; fully redundant calls
+    // are common and the caller can skip state change notifications for them.
+    bool setColorMask(bool red, bool green, bool blue, bool alpha);
     void setColorMaskIndexed(bool red, bool green, bool blue, bool alpha, GLuint index);
     void setDepthMask(bool mask);
 
@@ -207,17 +210,17 @@ class State : angle::NonCopyable
                                 GLenum destAlpha,
                                 GLuint index);
     void setBlendColor(float red, float green, float blue, float alpha);
-    void setBlendEquation(GLenum rgbEquation, GLenum alphaEquation);
+    bool setBlendEquation(GLenum rgbEquation, GLenum alphaEquation);
     void setBlendEquationIndexed(GLenum rgbEquation, GLenum alphaEquation, GLuint index);
     const ColorF &getBlendColor() const { return mBlendColor; }
 
     // Stencil state maniupulation
     bool isStencilTestEnabled() const { return mDepthStencil.stencilTest; }
     void setStencilTest(bool enabled);
-    void setStencilParams(GLenum stencilFunc, GLint stencilRef, GLuint stencilMask);
-    void setStencilBackParams(GLenum stencilBackFunc, GLint stencilBackRef, GLuint stencilBackMask);
-    void setStencilWritemask(GLuint stencilWritemask);
-    void setStencilBackWritemask(GLuint stencilBackWritemask);
+    bool setStencilParams(GLenum stencilFunc, GLint stencilRef, GLuint stencilMask);
+    bool setStencilBackParams(GLenum stencilBackFunc, GLint stencilBackRef, GLuint stencilBackMask);
+    bool setStencilWritemask(GLuint stencilWritemask);
+    bool setStencilBackWritemask(GLuint stencilBackWritemask);
     void setStencilOperations(GLenum stencilFail,
                               GLenum stencilPassDepthFail,
                               GLenum stencilPassDepthPass);
@@ -762,8 +765,15 @@ class State : angle::NonCopyable
         mDirtyBits.set();
         mExtendedDirtyBits.set();
         mDirtyCurrentValues.set();
+        mChangedTextureUnits.set();
     }
 
+    // Texture units whose effective texture or sampler binding changed since the last call.
+    // Renderers can use this to limit their active texture walks after
+    // DIRTY_BIT_TEXTURE_BINDINGS to the units that actually changed; coarse invalidations set
+    // every bit.
+    ActiveTextureMask getAndResetChangedTextureUnits() const;
+
     using ExtendedDirtyBits = angle::BitSet32<EXTENDED_DIRTY_BIT_MAX>;
     const ExtendedDirtyBits &getExtendedDirtyBits() const { return mExtendedDirtyBits; }
     // TODO(https://anglebug.com/5631): Handle extended dirty bits on non-vulkan backends
@@ -870,6 +880,12 @@ class State : angle::NonCopyable
 
     const OverlayType *getOverlay() const { return mOverlay; }
 
+    // Per-frame transient arena, shared by the frontend and the backends through the state.  For
+    // scratch containers (via angle::StlPoolAllocator) that never outlive the frame: all of its
+    // memory is reclaimed at once when the frame's swap completes, so hot paths can grow vectors
+    // without hitting the global allocator.
+    angle::PoolAllocator *getFrameArena() const { return &mFrameArena; }
+
     // Not for general use.
     const BufferManager &getBufferManagerForCapture() const { return *mBufferManager; }
     const BoundBufferMap &getBoundBuffersForCapture() const { return mBoundBuffers; }
@@ -957,6 +973,10 @@ class State : angle::NonCopyable
   private:
     friend class Context;
 
+    // Frees everything allocated from the frame arena during the frame.  Called by the context
+    // once the swap has completed; arena-backed containers must not be alive at that point.
+    void resetFrameArena() const;
+
     void unsetActiveTextures(const ActiveTextureMask &textureMask);
     void setActiveTextureDirty(size_t textureIndex, Texture *texture);
     void updateTextureBinding(const Context *context, size_t textureIndex, Texture *texture);
@@ -1207,11 +1227,15 @@ class State : angle::NonCopyable
     ActiveTextureMask mDirtyActiveTextures;
     ActiveTextureMask mDirtyTextures;
     ActiveTextureMask mDirtySamplers;
+    mutable ActiveTextureMask mChangedTextureUnits;
     ImageUnitMask mDirtyImages;
 
     // The Overlay object, used by the backend to render the overlay.
     const OverlayType *mOverlay;
 
+    // See getFrameArena().  Reset by the context when a swap completes.
+    mutable angle::PoolAllocator mFrameArena;
+
     // OES_draw_buffers_indexed
     DrawBufferMask mBlendFuncConstantAlphaDrawBuffers;
     DrawBufferMask mBlendFuncConstantColorDrawBuffers;
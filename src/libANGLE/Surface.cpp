@@ -12,6 +12,7 @@
 
 #include <EGL/eglext.h>
 
+#include "common/system_utils.h"
 #include "libANGLE/Config.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
@@ -103,6 +104,7 @@ Surface::Surface(EGLint surfaceType,
       mLockBufferPitch(0),
       mBufferAgeQueriedSinceLastSwap(false),
       mIsDamageRegionSet(false),
+      mLastSwapTime(0.0),
       mColorInitState(gl::InitState::Initialized),
       mDepthStencilInitState(gl::InitState::Initialized),
       mImplObserverBinding(this, kSurfaceImplSubjectIndex)
@@ -184,6 +186,9 @@ Error Surface::destroyImpl(const Display *display)
 
 void Surface::postSwap(const gl::Context *context)
 {
+    context->onPostSwap();
+    context->getDisplay()->onFramePresented();
+
     if (mRobustResourceInitialization && mState.swapBehavior != EGL_BUFFER_PRESERVED)
     {
         mColorInitState        = gl::InitState::MayNeedInit;
@@ -194,6 +199,16 @@ void Surface::postSwap(const gl::Context *context)
     mBufferAgeQueriedSinceLastSwap = false;
 
     mIsDamageRegionSet = false;
+    mState.damageRegion.clear();
+
+    // Feed the interval between swaps to the worker pool's CPU budget governor, so that
+    // background work such as pipeline warm up backs off when frames hitch.
+    const double now = angle::GetCurrentSystemTime();
+    if (mLastSwapTime != 0.0)
+    {
+        context->getDisplay()->getMultiThreadPool()->reportFrameTime(now - mLastSwapTime);
+    }
+    mLastSwapTime = now;
 }
 
 Error Surface::initialize(const Display *display)
@@ -886,6 +901,22 @@ WindowSurface::WindowSurface(rx::EGLImplFactory *implFactory,
 void Surface::setDamageRegion(const EGLint *rects, EGLint n_rects)
 {
     mIsDamageRegionSet = true;
+
+    mState.damageRegion.clear();
+    mState.damageRegion.reserve(n_rects);
+    for (EGLint i = 0; i < n_rects; ++i)
+    {
+        const EGLint *rect = rects + i * 4;
+        // Rects with no area contribute nothing to the damage region.
+        if (rect[2] <= 0 || rect[3] <= 0)
+        {
+            continue;
+        }
+        mState.damageRegion.push_back(gl::Rectangle(rect[0], rect[1], rect[2], rect[3]));
+    }
+
+    // Let the current framebuffer re-derive its scissored render area from the new region.
+    onStateChange(angle::SubjectMessage::SubjectChanged);
 }
 
 WindowSurface::~WindowSurface() {}
@@ -66,6 +66,11 @@ struct SurfaceState final : private angle::NonCopyable
     SupportedTimestamps supportedTimestamps;
     bool directComposition;
     EGLenum swapBehavior;
+
+    // EGL_KHR_partial_update damage region for the current frame, in surface coordinates.  Empty
+    // when no region is set.  Rendering outside the region is undefined, so backends may clip
+    // rendering to it.
+    std::vector<gl::Rectangle> damageRegion;
 };
 
 class Surface : public LabeledObject, public gl::FramebufferAttachmentObject
@@ -291,6 +296,10 @@ class Surface : public LabeledObject, public gl::FramebufferAttachmentObject
     bool mBufferAgeQueriedSinceLastSwap;
     bool mIsDamageRegionSet;
 
+    // Time of the last swap, used to derive the frame time fed to the worker pool's CPU budget
+    // governor.  Zero until the first swap.
+    double mLastSwapTime;
+
   private:
     Error getBufferAgeImpl(const gl::Context *context, EGLint *age) const;
 
@@ -235,13 +235,14 @@ struct RasterizerState final
     RasterizerState(const RasterizerState &other);
     RasterizerState &operator=(const RasterizerState &other);
 
+    // Fields are stored in narrowed types (GL_CW/GL_CCW fit in 16 bits) and grouped to minimize
+    // padding, so the whole struct stays small and the memcmp-based comparison is a couple of
+    // integer compares.
     bool cullFace;
     CullFaceMode cullMode;
-    GLenum frontFace;
+    uint16_t frontFace;
 
     bool polygonOffsetFill;
-    GLfloat polygonOffsetFactor;
-    GLfloat polygonOffsetUnits;
 
     // pointDrawMode/multiSample are only used in the D3D back-end right now.
     bool pointDrawMode;
@@ -250,8 +251,13 @@ struct RasterizerState final
     bool rasterizerDiscard;
 
     bool dither;
+
+    GLfloat polygonOffsetFactor;
+    GLfloat polygonOffsetUnits;
 };
 
+static_assert(sizeof(RasterizerState) == 20, "Unexpected RasterizerState size");
+
 bool operator==(const RasterizerState &a, const RasterizerState &b);
 bool operator!=(const RasterizerState &a, const RasterizerState &b);
 
@@ -290,25 +296,31 @@ struct DepthStencilState final
     bool isStencilNoOp() const;
     bool isStencilBackNoOp() const;
 
+    // The depth/stencil comparison functions and stencil operations all fit in 16 bits, so they
+    // are stored narrowed; this keeps the struct (and gl::State) compact and the memcmp-based
+    // comparison down to a few integer compares.
     bool depthTest;
-    GLenum depthFunc;
     bool depthMask;
-
     bool stencilTest;
-    GLenum stencilFunc;
+    uint16_t depthFunc;
+
+    uint16_t stencilFunc;
+    uint16_t stencilFail;
+    uint16_t stencilPassDepthFail;
+    uint16_t stencilPassDepthPass;
     GLuint stencilMask;
-    GLenum stencilFail;
-    GLenum stencilPassDepthFail;
-    GLenum stencilPassDepthPass;
     GLuint stencilWritemask;
-    GLenum stencilBackFunc;
+
+    uint16_t stencilBackFunc;
+    uint16_t stencilBackFail;
+    uint16_t stencilBackPassDepthFail;
+    uint16_t stencilBackPassDepthPass;
     GLuint stencilBackMask;
-    GLenum stencilBackFail;
-    GLenum stencilBackPassDepthFail;
-    GLenum stencilBackPassDepthPass;
     GLuint stencilBackWritemask;
 };
 
+static_assert(sizeof(DepthStencilState) == 40, "Unexpected DepthStencilState size");
+
 bool operator==(const DepthStencilState &a, const DepthStencilState &b);
 bool operator!=(const DepthStencilState &a, const DepthStencilState &b);
 
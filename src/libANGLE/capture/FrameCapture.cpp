@@ -9,6 +9,7 @@
 
 #include "libANGLE/capture/FrameCapture.h"
 
+#include <algorithm>
 #include <cerrno>
 #include <cstring>
 #include <fstream>
@@ -79,6 +80,13 @@ constexpr char kSourceSizeVarName[]     = "ANGLE_CAPTURE_SOURCE_SIZE";
 constexpr size_t kBinaryAlignment   = 16;
 constexpr size_t kFunctionSizeLimit = 5000;
 
+// Binary data is buffered into chunks of this size before being handed to the writer thread.
+constexpr size_t kBinaryDataChunkSize = 16 * 1024 * 1024;
+
+// Bound on the number of chunks queued for the writer thread before append() blocks, so a capture
+// that produces data faster than the disk can absorb it does not grow without limit.
+constexpr size_t kMaxPendingBinaryDataChunks = 2;
+
 // Limit based on MSVC Compiler Error C2026
 constexpr size_t kStringLengthLimit = 16380;
 
@@ -585,7 +593,7 @@ void WriteStringParamReplay(ReplayWriter &replayWriter,
                             std::ostream &header,
                             const CallCapture &call,
                             const ParamCapture &param,
-                            std::vector<uint8_t> *binaryData)
+                            FrameCaptureBinaryData *binaryData)
 {
     const std::vector<uint8_t> &data = param.data[0];
     // null terminate C style string
@@ -596,11 +604,8 @@ void WriteStringParamReplay(ReplayWriter &replayWriter,
     if (str.size() > kMaxInlineStringLength)
     {
         // Store in binary file if the string is too long.
-        // Round up to 16-byte boundary for cross ABI safety.
-        size_t offset = rx::roundUpPow2(binaryData->size(), kBinaryAlignment);
-        binaryData->resize(offset + str.size() + 1);
-        memcpy(binaryData->data() + offset, str.data(), str.size() + 1);
-        out << "(const char *)&gBinaryData[" << offset << "]";
+        size_t offset = binaryData->append(str.data(), str.size() + 1);
+        out << "(const char *)GetBinaryData(" << offset << ", " << (str.size() + 1) << ")";
     }
     else if (str.find('\n') != std::string::npos)
     {
@@ -709,7 +714,7 @@ void WriteBinaryParamReplay(ReplayWriter &replayWriter,
                             std::ostream &header,
                             const CallCapture &call,
                             const ParamCapture &param,
-                            std::vector<uint8_t> *binaryData)
+                            FrameCaptureBinaryData *binaryData)
 {
     std::string varName = replayWriter.getInlineVariableName(call.entryPoint, param.name);
 
@@ -734,11 +739,9 @@ void WriteBinaryParamReplay(ReplayWriter &replayWriter,
     else
     {
         // Store in binary file if data are not of type string
-        // Round up to 16-byte boundary for cross ABI safety
-        size_t offset = rx::roundUpPow2(binaryData->size(), kBinaryAlignment);
-        binaryData->resize(offset + data.size());
-        memcpy(binaryData->data() + offset, data.data(), data.size());
-        out << "(" << ParamTypeToString(overrideType) << ")&gBinaryData[" << offset << "]";
+        size_t offset = binaryData->append(data.data(), data.size());
+        out << "(" << ParamTypeToString(overrideType) << ")GetBinaryData(" << offset << ", "
+            << data.size() << ")";
     }
 }
 
@@ -746,7 +749,7 @@ void WriteCppReplayForCall(const CallCapture &call,
                            ReplayWriter &replayWriter,
                            std::ostream &out,
                            std::ostream &header,
-                           std::vector<uint8_t> *binaryData)
+                           FrameCaptureBinaryData *binaryData)
 {
     std::ostringstream callOut;
 
@@ -899,43 +902,6 @@ std::string GetBinaryDataFilePath(bool compression, const std::string &captureLa
     return fnameStream.str();
 }
 
-void SaveBinaryData(bool compression,
-                    const std::string &outDir,
-                    gl::ContextID contextId,
-                    const std::string &captureLabel,
-                    const std::vector<uint8_t> &binaryData)
-{
-    std::string binaryDataFileName = GetBinaryDataFilePath(compression, captureLabel);
-    std::string dataFilepath       = outDir + binaryDataFileName;
-
-    SaveFileHelper saveData(dataFilepath);
-
-    if (compression)
-    {
-        // Save compressed data.
-        uLong uncompressedSize       = static_cast<uLong>(binaryData.size());
-        uLong expectedCompressedSize = zlib_internal::GzipExpectedCompressedSize(uncompressedSize);
-
-        std::vector<uint8_t> compressedData(expectedCompressedSize, 0);
-
-        uLong compressedSize = expectedCompressedSize;
-        int zResult = zlib_internal::GzipCompressHelper(compressedData.data(), &compressedSize,
-                                                        binaryData.data(), uncompressedSize,
-                                                        nullptr, nullptr);
-
-        if (zResult != Z_OK)
-        {
-            FATAL() << "Error compressing binary data: " << zResult;
-        }
-
-        saveData.write(compressedData.data(), compressedSize);
-    }
-    else
-    {
-        saveData.write(binaryData.data(), binaryData.size());
-    }
-}
-
 void WriteInitReplayCall(bool compression,
                          std::ostream &out,
                          gl::ContextID contextID,
@@ -969,7 +935,7 @@ void MaybeResetResources(gl::ContextID contextID,
                          std::stringstream &out,
                          std::stringstream &header,
                          ResourceTracker *resourceTracker,
-                         std::vector<uint8_t> *binaryData,
+                         FrameCaptureBinaryData *binaryData,
                          bool &anyResourceReset)
 {
     // Local helper to get well structured blocks in Delete calls, i.e.
@@ -1394,7 +1360,7 @@ void MaybeResetFenceSyncObjects(std::stringstream &out,
                                 ReplayWriter &replayWriter,
                                 std::stringstream &header,
                                 ResourceTracker *resourceTracker,
-                                std::vector<uint8_t> *binaryData)
+                                FrameCaptureBinaryData *binaryData)
 {
     FenceSyncCalls &fenceSyncRegenCalls = resourceTracker->getFenceSyncRegenCalls();
 
@@ -1436,7 +1402,7 @@ void MaybeResetDefaultUniforms(std::stringstream &out,
                                std::stringstream &header,
                                const gl::State &replayState,
                                ResourceTracker *resourceTracker,
-                               std::vector<uint8_t> *binaryData)
+                               FrameCaptureBinaryData *binaryData)
 {
     DefaultUniformLocationsPerProgramMap &defaultUniformsToReset =
         resourceTracker->getDefaultUniformsToReset();
@@ -1494,7 +1460,7 @@ void MaybeResetOpaqueTypeObjects(ReplayWriter &replayWriter,
                                  std::stringstream &header,
                                  const gl::State &replayState,
                                  ResourceTracker *resourceTracker,
-                                 std::vector<uint8_t> *binaryData)
+                                 FrameCaptureBinaryData *binaryData)
 {
     MaybeResetFenceSyncObjects(out, replayWriter, header, resourceTracker, binaryData);
 
@@ -1506,7 +1472,7 @@ void MaybeResetContextState(ReplayWriter &replayWriter,
                             std::stringstream &header,
                             ResourceTracker *resourceTracker,
                             const gl::Context *context,
-                            std::vector<uint8_t> *binaryData,
+                            FrameCaptureBinaryData *binaryData,
                             StateResetHelper &stateResetHelper)
 {
     // Check dirty states per entrypoint
@@ -1559,7 +1525,7 @@ void WriteCppReplayFunctionWithParts(const gl::ContextID contextID,
                                      ReplayFunc replayFunc,
                                      ReplayWriter &replayWriter,
                                      uint32_t frameIndex,
-                                     std::vector<uint8_t> *binaryData,
+                                     FrameCaptureBinaryData *binaryData,
                                      const std::vector<CallCapture> &calls,
                                      std::stringstream &header,
                                      std::stringstream &out)
@@ -1635,7 +1601,7 @@ void WriteAuxiliaryContextCppSetupReplay(ReplayWriter &replayWriter,
                                          const std::string &captureLabel,
                                          uint32_t frameIndex,
                                          const std::vector<CallCapture> &setupCalls,
-                                         std::vector<uint8_t> *binaryData,
+                                         FrameCaptureBinaryData *binaryData,
                                          bool serializeStateEnabled,
                                          const FrameCaptureShared &frameCaptureShared)
 {
@@ -1685,7 +1651,7 @@ void WriteShareGroupCppSetupReplay(ReplayWriter &replayWriter,
                                    uint32_t frameCount,
                                    const std::vector<CallCapture> &setupCalls,
                                    ResourceTracker *resourceTracker,
-                                   std::vector<uint8_t> *binaryData,
+                                   FrameCaptureBinaryData *binaryData,
                                    bool serializeStateEnabled,
                                    gl::ContextID windowSurfaceContextID)
 {
@@ -5280,6 +5246,192 @@ void FrameCapture::reset()
     mSetupCalls.clear();
 }
 
+FrameCaptureBinaryData::FrameCaptureBinaryData() = default;
+
+FrameCaptureBinaryData::~FrameCaptureBinaryData()
+{
+    if (mOpen)
+    {
+        close();
+    }
+}
+
+void FrameCaptureBinaryData::configure(bool compression,
+                                       const std::string &outDir,
+                                       const std::string &captureLabel)
+{
+    ASSERT(!mOpen);
+    mCompression  = compression;
+    mOutDirectory = outDir;
+    mCaptureLabel = captureLabel;
+}
+
+size_t FrameCaptureBinaryData::append(const void *data, size_t size)
+{
+    if (!mOpen)
+    {
+        open();
+    }
+
+    // Round up to 16-byte boundary for cross ABI safety.
+    size_t offset  = rx::roundUpPow2(mTotalSize, kBinaryAlignment);
+    size_t padding = offset - mTotalSize;
+
+    auto appendBytes = [this](const uint8_t *bytes, size_t count) {
+        while (count > 0)
+        {
+            size_t space = kBinaryDataChunkSize - mActiveChunk.size();
+            size_t copy  = std::min(count, space);
+            if (bytes != nullptr)
+            {
+                mActiveChunk.insert(mActiveChunk.end(), bytes, bytes + copy);
+                bytes += copy;
+            }
+            else
+            {
+                mActiveChunk.resize(mActiveChunk.size() + copy);
+            }
+            count -= copy;
+            if (mActiveChunk.size() == kBinaryDataChunkSize)
+            {
+                flushActiveChunk();
+            }
+        }
+    };
+
+    appendBytes(nullptr, padding);
+    appendBytes(static_cast<const uint8_t *>(data), size);
+
+    mTotalSize = offset + size;
+    return offset;
+}
+
+void FrameCaptureBinaryData::close()
+{
+    if (!mOpen)
+    {
+        // Produce the (possibly empty) data file even if nothing was appended, so loading the
+        // binary data during replay still succeeds.
+        open();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (!mActiveChunk.empty())
+        {
+            mPendingChunks.emplace_back(std::move(mActiveChunk));
+            mActiveChunk.clear();
+        }
+        mFinishing = true;
+    }
+    mCondVar.notify_all();
+    mWriterThread.join();
+
+    mOpen      = false;
+    mFinishing = false;
+    mTotalSize = 0;
+}
+
+void FrameCaptureBinaryData::open()
+{
+    ASSERT(!mOpen);
+    mActiveChunk.reserve(kBinaryDataChunkSize);
+    mWriterThread = std::thread([this]() { writerThreadLoop(); });
+    mOpen         = true;
+}
+
+void FrameCaptureBinaryData::flushActiveChunk()
+{
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondVar.wait(lock,
+                      [this]() { return mPendingChunks.size() < kMaxPendingBinaryDataChunks; });
+        mPendingChunks.emplace_back(std::move(mActiveChunk));
+    }
+    mCondVar.notify_all();
+
+    mActiveChunk.clear();
+    mActiveChunk.reserve(kBinaryDataChunkSize);
+}
+
+void FrameCaptureBinaryData::writerThreadLoop()
+{
+    std::string dataFilepath =
+        mOutDirectory + GetBinaryDataFilePath(mCompression, mCaptureLabel);
+    SaveFileHelper saveData(dataFilepath);
+
+    // A single-member gzip stream is written incrementally, matching the format
+    // GzipCompressHelper produced when the data was compressed in one shot, so existing replay
+    // loaders keep working.
+    z_stream zStream = {};
+    std::vector<uint8_t> compressBuffer;
+    if (mCompression)
+    {
+        // windowBits of MAX_WBITS + 16 selects the gzip wrapper.
+        int zResult = deflateInit2(&zStream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, MAX_WBITS + 16, 8,
+                                   Z_DEFAULT_STRATEGY);
+        if (zResult != Z_OK)
+        {
+            FATAL() << "Error initializing binary data compression: " << zResult;
+        }
+        compressBuffer.resize(kBinaryDataChunkSize);
+    }
+
+    while (true)
+    {
+        std::vector<uint8_t> chunk;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCondVar.wait(lock, [this]() { return !mPendingChunks.empty() || mFinishing; });
+            if (mPendingChunks.empty())
+            {
+                break;
+            }
+            chunk = std::move(mPendingChunks.front());
+            mPendingChunks.pop_front();
+        }
+        mCondVar.notify_all();
+
+        if (mCompression)
+        {
+            zStream.next_in  = chunk.data();
+            zStream.avail_in = static_cast<uInt>(chunk.size());
+            while (zStream.avail_in > 0)
+            {
+                zStream.next_out  = compressBuffer.data();
+                zStream.avail_out = static_cast<uInt>(compressBuffer.size());
+                int zResult       = deflate(&zStream, Z_NO_FLUSH);
+                if (zResult != Z_OK)
+                {
+                    FATAL() << "Error compressing binary data: " << zResult;
+                }
+                saveData.write(compressBuffer.data(), compressBuffer.size() - zStream.avail_out);
+            }
+        }
+        else
+        {
+            saveData.write(chunk.data(), chunk.size());
+        }
+    }
+
+    if (mCompression)
+    {
+        int zResult = Z_OK;
+        do
+        {
+            zStream.next_out  = compressBuffer.data();
+            zStream.avail_out = static_cast<uInt>(compressBuffer.size());
+            zResult           = deflate(&zStream, Z_FINISH);
+            if (zResult != Z_OK && zResult != Z_STREAM_END)
+            {
+                FATAL() << "Error finishing binary data compression: " << zResult;
+            }
+            saveData.write(compressBuffer.data(), compressBuffer.size() - zStream.avail_out);
+        } while (zResult != Z_STREAM_END);
+        deflateEnd(&zStream);
+    }
+}
+
 FrameCaptureShared::FrameCaptureShared()
     : mLastContextId{0},
       mEnabled(true),
@@ -5440,6 +5592,8 @@ FrameCaptureShared::FrameCaptureShared()
         mEnabled = false;
     }
 
+    mBinaryData.configure(mCompression, mOutDirectory, mCaptureLabel);
+
     mReplayWriter.setCaptureLabel(mCaptureLabel);
 }
 
@@ -6083,12 +6237,12 @@ void FrameCaptureShared::overrideProgramBinary(const gl::Context *context,
     //   gShaderProgramMap[42] = glCreateProgram();
     //   === Begin override ===
     //   gShaderProgramMap[43] = glCreateShader(GL_VERTEX_SHADER);
-    //   glShaderSource(gShaderProgramMap[43], 1, string_0, &gBinaryData[100]);
+    //   glShaderSource(gShaderProgramMap[43], 1, string_0, GetBinaryData(100, 4));
     //   glCompileShader(gShaderProgramMap[43]);
     //   glAttachShader(gShaderProgramMap[42], gShaderProgramMap[43]);
     //   glDeleteShader(gShaderProgramMap[43]);
     //   gShaderProgramMap[43] = glCreateShader(GL_FRAGMENT_SHADER);
-    //   glShaderSource(gShaderProgramMap[43], 1, string_1, &gBinaryData[200]);
+    //   glShaderSource(gShaderProgramMap[43], 1, string_1, GetBinaryData(200, 4));
     //   glCompileShader(gShaderProgramMap[43]);
     //   glAttachShader(gShaderProgramMap[42], gShaderProgramMap[43]);
     //   glDeleteShader(gShaderProgramMap[43]);
@@ -6099,8 +6253,8 @@ void FrameCaptureShared::overrideProgramBinary(const gl::Context *context,
     //   UpdateUniformLocation(gShaderProgramMap[42], "bar", 72, 1);
     //   glUseProgram(gShaderProgramMap[42]);
     //   UpdateCurrentProgram(gShaderProgramMap[42]);
-    //   glUniform4fv(gUniformLocations[gCurrentProgram][0], 20, &gBinaryData[300]);
-    //   glUniform1iv(gUniformLocations[gCurrentProgram][72], 1, &gBinaryData[400]);
+    //   glUniform4fv(gUniformLocations[gCurrentProgram][0], 20, GetBinaryData(300, 320));
+    //   glUniform1iv(gUniformLocations[gCurrentProgram][72], 1, GetBinaryData(400, 4));
     //   === End override ===
     //   glGetProgramiv(gShaderProgramMap[42], GL_LINK_STATUS, gReadBuffer);
     //   glGetProgramiv(gShaderProgramMap[42], GL_PROGRAM_BINARY_LENGTH, gReadBuffer);
@@ -7263,7 +7417,7 @@ void FrameCaptureShared::captureMappedBufferSnapshot(const gl::Context *context,
     //   gMappedBufferData[gBufferMap[42]] = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, 65536,
     //                                                        GL_MAP_WRITE_BIT);
     //   ...
-    //   UpdateClientBufferData(42, &gBinaryData[164631024], 65536);
+    //   UpdateClientBufferData(42, GetBinaryData(164631024, 65536), 65536);
     //   glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
     //   ...
 
@@ -7500,8 +7654,7 @@ void FrameCaptureShared::onEndFrame(gl::Context *context)
 
         // Save the index files after the last frame.
         writeCppReplayIndexFiles(context, false);
-        SaveBinaryData(mCompression, mOutDirectory, kSharedContextId, mCaptureLabel, mBinaryData);
-        mBinaryData.clear();
+        mBinaryData.close();
         mWroteIndexFile = true;
     }
 
@@ -7523,8 +7676,7 @@ void FrameCaptureShared::onDestroyContext(const gl::Context *context)
         mFrameIndex -= 1;
         mCaptureEndFrame = mFrameIndex;
         writeCppReplayIndexFiles(context, true);
-        SaveBinaryData(mCompression, mOutDirectory, kSharedContextId, mCaptureLabel, mBinaryData);
-        mBinaryData.clear();
+        mBinaryData.close();
         mWroteIndexFile = true;
     }
 }
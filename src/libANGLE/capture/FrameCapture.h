@@ -10,6 +10,11 @@
 #ifndef LIBANGLE_FRAME_CAPTURE_H_
 #define LIBANGLE_FRAME_CAPTURE_H_
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 #include "common/PackedEnums.h"
 #include "common/frame_capture_utils.h"
 #include "common/system_utils.h"
@@ -497,6 +502,45 @@ class CoherentBufferTracker final : angle::NonCopyable
     size_t mPageSize;
 };
 
+// Accumulates the binary data of a capture and streams it to the .angledata file as it grows.
+// Data is buffered into fixed-size chunks; full chunks are handed to a writer thread which
+// (optionally) compresses them and appends them to the file.  This keeps capture memory usage
+// bounded instead of holding the entire blob in memory until the end of the capture.
+class FrameCaptureBinaryData final : angle::NonCopyable
+{
+  public:
+    FrameCaptureBinaryData();
+    ~FrameCaptureBinaryData();
+
+    void configure(bool compression, const std::string &outDir, const std::string &captureLabel);
+
+    // Appends a block of data at a 16-byte aligned offset and returns that offset into the
+    // overall data file.
+    size_t append(const void *data, size_t size);
+
+    // Flushes buffered data, finalizes the compression stream and joins the writer thread.
+    void close();
+
+  private:
+    void open();
+    void flushActiveChunk();
+    void writerThreadLoop();
+
+    bool mCompression = true;
+    std::string mOutDirectory;
+    std::string mCaptureLabel;
+
+    bool mOpen        = false;
+    size_t mTotalSize = 0;
+    std::vector<uint8_t> mActiveChunk;
+
+    std::mutex mMutex;
+    std::condition_variable mCondVar;
+    std::deque<std::vector<uint8_t>> mPendingChunks;
+    bool mFinishing = false;
+    std::thread mWriterThread;
+};
+
 // Shared class for any items that need to be tracked by FrameCapture across shared contexts
 class FrameCaptureShared final : angle::NonCopyable
 {
@@ -685,9 +729,9 @@ class FrameCaptureShared final : angle::NonCopyable
     std::vector<CallCapture> mFrameCalls;
     gl::ContextID mLastContextId;
 
-    // We save one large buffer of binary data for the whole CPP replay.
+    // We save one large data file for the whole CPP replay, streamed to disk as it is produced.
     // This simplifies a lot of file management.
-    std::vector<uint8_t> mBinaryData;
+    FrameCaptureBinaryData mBinaryData;
 
     bool mEnabled;
     bool mSerializeStateEnabled;
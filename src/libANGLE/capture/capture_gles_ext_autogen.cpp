@@ -1019,6 +1019,20 @@ CallCapture CaptureVertexAttribDivisorANGLE(const State &glState,
     return CallCapture(angle::EntryPoint::GLVertexAttribDivisorANGLE, std::move(paramBuffer));
 }
 
+CallCapture CaptureBeginLockedDrawsANGLE(const State &glState, bool isCallValid)
+{
+    ParamBuffer paramBuffer;
+
+    return CallCapture(angle::EntryPoint::GLBeginLockedDrawsANGLE, std::move(paramBuffer));
+}
+
+CallCapture CaptureEndLockedDrawsANGLE(const State &glState, bool isCallValid)
+{
+    ParamBuffer paramBuffer;
+
+    return CallCapture(angle::EntryPoint::GLEndLockedDrawsANGLE, std::move(paramBuffer));
+}
+
 CallCapture CaptureLogicOpANGLE(const State &glState,
                                 bool isCallValid,
                                 LogicalOperation opcodePacked)
@@ -229,6 +229,10 @@ angle::CallCapture CaptureVertexAttribDivisorANGLE(const State &glState,
                                                    GLuint index,
                                                    GLuint divisor);
 
+// GL_ANGLE_lock_draws
+angle::CallCapture CaptureBeginLockedDrawsANGLE(const State &glState, bool isCallValid);
+angle::CallCapture CaptureEndLockedDrawsANGLE(const State &glState, bool isCallValid);
+
 // GL_ANGLE_logic_op
 angle::CallCapture CaptureLogicOpANGLE(const State &glState,
                                        bool isCallValid,
@@ -1484,6 +1484,65 @@ const InternalFormatInfoMap &GetInternalFormatMap()
     return *formatMap;
 }
 
+// Flat, sorted indices over the internal format map for the single-format queries.  The nested
+// hash maps spread the entries over many small heap allocations, so looking a format up hashes
+// twice and chases cold pointers; a binary search over one contiguous array touches far fewer
+// cache lines.  The map itself stays the canonical table since it's iterated elsewhere.
+struct InternalFormatIndex
+{
+    // Internal formats whose map entry holds exactly one type and is sized; these can be returned
+    // without consulting the type at all.
+    std::vector<std::pair<GLenum, const InternalFormat *>> sized;
+    // Every (internal format, type) pair in the map.
+    std::vector<std::pair<uint64_t, const InternalFormat *>> typed;
+};
+
+static uint64_t PackFormatAndType(GLenum internalFormat, GLenum type)
+{
+    return (static_cast<uint64_t>(internalFormat) << 32) | type;
+}
+
+static InternalFormatIndex BuildInternalFormatIndex()
+{
+    InternalFormatIndex index;
+    for (const auto &internalFormat : GetInternalFormatMap())
+    {
+        const auto &typeMap = internalFormat.second;
+        if (typeMap.size() == 1 && typeMap.begin()->second.sized)
+        {
+            index.sized.emplace_back(internalFormat.first, &typeMap.begin()->second);
+        }
+        for (const auto &type : typeMap)
+        {
+            index.typed.emplace_back(PackFormatAndType(internalFormat.first, type.first),
+                                     &type.second);
+        }
+    }
+    std::sort(index.sized.begin(), index.sized.end());
+    std::sort(index.typed.begin(), index.typed.end());
+    return index;
+}
+
+static const InternalFormatIndex &GetInternalFormatIndex()
+{
+    static const angle::base::NoDestructor<InternalFormatIndex> formatIndex(
+        BuildInternalFormatIndex());
+    return *formatIndex;
+}
+
+template <typename Key, typename Entry>
+static const InternalFormat *FindInFormatIndex(const std::vector<Entry> &index, Key key)
+{
+    auto iter = std::lower_bound(
+        index.begin(), index.end(), key,
+        [](const Entry &entry, Key value) { return entry.first < value; });
+    if (iter == index.end() || iter->first != key)
+    {
+        return nullptr;
+    }
+    return iter->second;
+}
+
 int GetAndroidHardwareBufferFormatFromChannelSizes(const egl::AttributeMap &attribMap)
 {
     // Retrieve channel size from attribute map. The default value should be 0, per spec.
@@ -1648,48 +1707,24 @@ uint32_t GetPackedTypeInfo(GLenum type)
 const InternalFormat &GetSizedInternalFormatInfo(GLenum internalFormat)
 {
     static const InternalFormat defaultInternalFormat;
-    const InternalFormatInfoMap &formatMap = GetInternalFormatMap();
-    auto iter                              = formatMap.find(internalFormat);
 
-    // Sized internal formats only have one type per entry
-    if (iter == formatMap.end() || iter->second.size() != 1)
-    {
-        return defaultInternalFormat;
-    }
-
-    const InternalFormat &internalFormatInfo = iter->second.begin()->second;
-    if (!internalFormatInfo.sized)
-    {
-        return defaultInternalFormat;
-    }
-
-    return internalFormatInfo;
+    // Sized internal formats only have one type per entry; the index only holds such entries.
+    const InternalFormat *info = FindInFormatIndex(GetInternalFormatIndex().sized, internalFormat);
+    return info != nullptr ? *info : defaultInternalFormat;
 }
 
 const InternalFormat &GetInternalFormatInfo(GLenum internalFormat, GLenum type)
 {
     static const InternalFormat defaultInternalFormat;
-    const InternalFormatInfoMap &formatMap = GetInternalFormatMap();
-
-    auto internalFormatIter = formatMap.find(internalFormat);
-    if (internalFormatIter == formatMap.end())
-    {
-        return defaultInternalFormat;
-    }
+    const InternalFormatIndex &index = GetInternalFormatIndex();
 
     // If the internal format is sized, simply return it without the type check.
-    if (internalFormatIter->second.size() == 1 && internalFormatIter->second.begin()->second.sized)
+    const InternalFormat *info = FindInFormatIndex(index.sized, internalFormat);
+    if (info == nullptr)
     {
-        return internalFormatIter->second.begin()->second;
+        info = FindInFormatIndex(index.typed, PackFormatAndType(internalFormat, type));
     }
-
-    auto typeIter = internalFormatIter->second.find(type);
-    if (typeIter == internalFormatIter->second.end())
-    {
-        return defaultInternalFormat;
-    }
-
-    return typeIter->second;
+    return info != nullptr ? *info : defaultInternalFormat;
 }
 
 GLuint InternalFormat::computePixelBytes(GLenum formatType) const
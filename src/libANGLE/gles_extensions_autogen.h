@@ -605,6 +605,9 @@ struct Extensions
     // GL_ANGLE_get_tex_level_parameter
     bool getTexLevelParameterANGLE = false;
 
+    // GL_ANGLE_lock_draws
+    bool lockDrawsANGLE = false;
+
     // GL_ANGLE_logic_op
     bool logicOpANGLE = false;
 
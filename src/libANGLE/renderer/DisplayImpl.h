@@ -18,6 +18,7 @@
 #include "libANGLE/Stream.h"
 #include "libANGLE/Version.h"
 #include "libANGLE/renderer/EGLImplFactory.h"
+#include "libANGLE/renderer/MemoryBudget.h"
 #include "platform/Feature.h"
 
 #include <set>
@@ -131,6 +132,9 @@ class DisplayImpl : public EGLImplFactory, public angle::Subject
 
     const egl::DisplayState &getState() const { return mState; }
 
+    // Shared by the backend renderer to account GPU memory against the API-reported budget.
+    MemoryBudgetTracker *getMemoryBudgetTracker() { return &mMemoryBudgetTracker; }
+
     virtual egl::Error handleGPUSwitch();
     virtual egl::Error forceGPUSwitch(EGLint gpuIDHigh, EGLint gpuIDLow);
 
@@ -160,6 +164,8 @@ class DisplayImpl : public EGLImplFactory, public angle::Subject
     mutable egl::Caps mCaps;
 
     egl::BlobCache *mBlobCache;
+
+    MemoryBudgetTracker mMemoryBudgetTracker;
 };
 
 }  // namespace rx
@@ -0,0 +1,105 @@
+//
+// Copyright 2022 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryBudget.cpp: Renderer-agnostic accounting of GPU memory against a budget.
+
+#include "libANGLE/renderer/MemoryBudget.h"
+
+#include "common/debug.h"
+
+namespace rx
+{
+
+MemoryBudgetTracker::MemoryBudgetTracker()
+    : mBudgetBytes(0),
+      mPressureSignaled(false),
+      mPressureCallback(nullptr),
+      mPressureCallbackUserParam(nullptr)
+{
+    for (std::atomic<uint64_t> &allocated : mAllocatedBytes)
+    {
+        allocated = 0;
+    }
+}
+
+MemoryBudgetTracker::~MemoryBudgetTracker() = default;
+
+void MemoryBudgetTracker::setPressureCallback(PressureCallback callback, void *userParam)
+{
+    std::lock_guard<std::mutex> lock(mCallbackMutex);
+    mPressureCallback          = callback;
+    mPressureCallbackUserParam = userParam;
+}
+
+void MemoryBudgetTracker::onAllocation(GpuMemoryCategory category, uint64_t bytes)
+{
+    mAllocatedBytes[static_cast<size_t>(category)].fetch_add(bytes, std::memory_order_relaxed);
+    updatePressureState();
+}
+
+void MemoryBudgetTracker::onDeallocation(GpuMemoryCategory category, uint64_t bytes)
+{
+    ASSERT(mAllocatedBytes[static_cast<size_t>(category)].load(std::memory_order_relaxed) >= bytes);
+    mAllocatedBytes[static_cast<size_t>(category)].fetch_sub(bytes, std::memory_order_relaxed);
+    updatePressureState();
+}
+
+void MemoryBudgetTracker::setAllocated(GpuMemoryCategory category, uint64_t bytes)
+{
+    mAllocatedBytes[static_cast<size_t>(category)].store(bytes, std::memory_order_relaxed);
+    updatePressureState();
+}
+
+void MemoryBudgetTracker::setBudget(uint64_t budgetBytes)
+{
+    mBudgetBytes.store(budgetBytes, std::memory_order_relaxed);
+    updatePressureState();
+}
+
+uint64_t MemoryBudgetTracker::getAllocated(GpuMemoryCategory category) const
+{
+    return mAllocatedBytes[static_cast<size_t>(category)].load(std::memory_order_relaxed);
+}
+
+uint64_t MemoryBudgetTracker::getTotalAllocated() const
+{
+    uint64_t total = 0;
+    for (const std::atomic<uint64_t> &allocated : mAllocatedBytes)
+    {
+        total += allocated.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void MemoryBudgetTracker::updatePressureState()
+{
+    const uint64_t budget = mBudgetBytes.load(std::memory_order_relaxed);
+    if (budget == 0)
+    {
+        return;
+    }
+
+    const uint64_t allocated = getTotalAllocated();
+
+    // Divide the budget first so large budgets cannot overflow the comparison.
+    if (allocated > budget / 100 * kPressurePercent)
+    {
+        bool expected = false;
+        if (mPressureSignaled.compare_exchange_strong(expected, true, std::memory_order_relaxed))
+        {
+            std::lock_guard<std::mutex> lock(mCallbackMutex);
+            if (mPressureCallback != nullptr)
+            {
+                mPressureCallback(mPressureCallbackUserParam, allocated, budget);
+            }
+        }
+    }
+    else if (allocated < budget / 100 * kPressureClearPercent)
+    {
+        mPressureSignaled.store(false, std::memory_order_relaxed);
+    }
+}
+
+}  // namespace rx
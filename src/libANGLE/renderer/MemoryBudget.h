@@ -0,0 +1,93 @@
+//
+// Copyright 2022 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryBudget.h: Renderer-agnostic accounting of GPU memory against a budget.
+
+#ifndef LIBANGLE_RENDERER_MEMORYBUDGET_H_
+#define LIBANGLE_RENDERER_MEMORYBUDGET_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+#include "common/angleutils.h"
+
+namespace rx
+{
+
+enum class GpuMemoryCategory
+{
+    Buffer,
+    Image,
+    Other,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
+// Aggregates GPU memory allocations reported by the backends and compares them against a
+// budget queried from the underlying API (VK_EXT_memory_budget, DXGI video memory info,
+// MTLDevice working set size).  When allocations cross the pressure threshold, an
+// application callback registered through EGL_ANGLE_memory_pressure_callback is invoked so
+// the application can shed load before the OS starts killing processes.  Backends consult
+// isUnderPressure() to decide when to evict idle staging and suballocation pools.
+//
+// Allocation and deallocation reports may come from any thread (for example from
+// VK_EXT_device_memory_report driver callbacks), so the counters are atomic.
+class MemoryBudgetTracker final : angle::NonCopyable
+{
+  public:
+    MemoryBudgetTracker();
+    ~MemoryBudgetTracker();
+
+    // Called by the application through EGL_MEMORY_PRESSURE_CALLBACK_ANGLE.  The callback
+    // may be invoked from internal threads and must not call back into EGL.
+    using PressureCallback = void (*)(void *userParam,
+                                      uint64_t allocatedBytes,
+                                      uint64_t budgetBytes);
+
+    void setPressureCallback(PressureCallback callback, void *userParam);
+    bool hasPressureCallback() const { return mPressureCallback != nullptr; }
+
+    void onAllocation(GpuMemoryCategory category, uint64_t bytes);
+    void onDeallocation(GpuMemoryCategory category, uint64_t bytes);
+
+    // Replaces the running total of a category with an absolute value, for backends that
+    // already maintain their own aggregate (such as the Vulkan device memory report).
+    void setAllocated(GpuMemoryCategory category, uint64_t bytes);
+
+    // A budget of zero means unknown; pressure is never reported in that case.
+    void setBudget(uint64_t budgetBytes);
+
+    uint64_t getAllocated(GpuMemoryCategory category) const;
+    uint64_t getTotalAllocated() const;
+    uint64_t getBudget() const { return mBudgetBytes.load(std::memory_order_relaxed); }
+
+    bool isUnderPressure() const { return mPressureSignaled.load(std::memory_order_relaxed); }
+
+  private:
+    // Pressure starts when total allocations exceed kPressurePercent of the budget and
+    // clears once they drop below kPressureClearPercent, so the callback does not fire
+    // repeatedly while the application hovers around the threshold.
+    static constexpr uint64_t kPressurePercent      = 90;
+    static constexpr uint64_t kPressureClearPercent = 80;
+
+    void updatePressureState();
+
+    std::array<std::atomic<uint64_t>, static_cast<size_t>(GpuMemoryCategory::EnumCount)>
+        mAllocatedBytes;
+    std::atomic<uint64_t> mBudgetBytes;
+    std::atomic<bool> mPressureSignaled;
+
+    // Serializes callback invocations; the counters themselves stay lock-free.
+    std::mutex mCallbackMutex;
+    PressureCallback mPressureCallback;
+    void *mPressureCallbackUserParam;
+};
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_MEMORYBUDGET_H_
@@ -8,11 +8,53 @@
 //
 
 #include "libANGLE/renderer/ShaderInterfaceVariableInfoMap.h"
+
+#include <algorithm>
+
 namespace rx
 {
+namespace
+{
+bool CompareEntryName(const NameToTypeAndIndexMap::Entry &entry, const std::string &name)
+{
+    return entry.name < name;
+}
+}  // anonymous namespace
 
 ShaderInterfaceVariableInfo::ShaderInterfaceVariableInfo() {}
 
+// NameToTypeAndIndexMap implementation.
+const TypeAndIndex *NameToTypeAndIndexMap::find(const std::string &name) const
+{
+    auto iter = std::lower_bound(mEntries.begin(), mEntries.end(), name, CompareEntryName);
+    if (iter == mEntries.end() || iter->name != name)
+    {
+        return nullptr;
+    }
+    return &iter->typeAndIndex;
+}
+
+TypeAndIndex *NameToTypeAndIndexMap::find(const std::string &name)
+{
+    auto iter = std::lower_bound(mEntries.begin(), mEntries.end(), name, CompareEntryName);
+    if (iter == mEntries.end() || iter->name != name)
+    {
+        return nullptr;
+    }
+    return &iter->typeAndIndex;
+}
+
+void NameToTypeAndIndexMap::insert(const std::string &name, TypeAndIndex typeAndIndex)
+{
+    auto iter = std::lower_bound(mEntries.begin(), mEntries.end(), name, CompareEntryName);
+    if (iter != mEntries.end() && iter->name == name)
+    {
+        iter->typeAndIndex = typeAndIndex;
+        return;
+    }
+    mEntries.insert(iter, {name, typeAndIndex});
+}
+
 // ShaderInterfaceVariableInfoMap implementation.
 ShaderInterfaceVariableInfoMap::ShaderInterfaceVariableInfoMap() = default;
 
@@ -47,7 +89,7 @@ void ShaderInterfaceVariableInfoMap::setActiveStages(gl::ShaderType shaderType,
                                                      gl::ShaderBitSet activeStages)
 {
     ASSERT(hasVariable(shaderType, variableName));
-    uint32_t index = mNameToTypeAndIndexMap[shaderType][variableName].index;
+    uint32_t index = mNameToTypeAndIndexMap[shaderType].find(variableName)->index;
     mData[shaderType][variableType][index].activeStages = activeStages;
 }
 
@@ -57,7 +99,7 @@ ShaderInterfaceVariableInfo &ShaderInterfaceVariableInfoMap::getMutable(
     const std::string &variableName)
 {
     ASSERT(hasVariable(shaderType, variableName));
-    uint32_t index = mNameToTypeAndIndexMap[shaderType][variableName].index;
+    uint32_t index = mNameToTypeAndIndexMap[shaderType].find(variableName)->index;
     return mData[shaderType][variableType][index];
 }
 
@@ -66,7 +108,7 @@ void ShaderInterfaceVariableInfoMap::markAsDuplicate(gl::ShaderType shaderType,
                                                      const std::string &variableName)
 {
     ASSERT(hasVariable(shaderType, variableName));
-    uint32_t index = mNameToTypeAndIndexMap[shaderType][variableName].index;
+    uint32_t index = mNameToTypeAndIndexMap[shaderType].find(variableName)->index;
     mData[shaderType][variableType][index].isDuplicate = true;
 }
 
@@ -76,7 +118,7 @@ ShaderInterfaceVariableInfo &ShaderInterfaceVariableInfoMap::add(gl::ShaderType
 {
     ASSERT(!hasVariable(shaderType, variableName));
     uint32_t index = static_cast<uint32_t>(mData[shaderType][variableType].size());
-    mNameToTypeAndIndexMap[shaderType][variableName] = {variableType, index};
+    mNameToTypeAndIndexMap[shaderType].insert(variableName, {variableType, index});
     mData[shaderType][variableType].resize(index + 1);
     return mData[shaderType][variableType][index];
 }
@@ -92,7 +134,7 @@ ShaderInterfaceVariableInfo &ShaderInterfaceVariableInfoMap::addOrGet(
     }
     else
     {
-        uint32_t index = mNameToTypeAndIndexMap[shaderType][variableName].index;
+        uint32_t index = mNameToTypeAndIndexMap[shaderType].find(variableName)->index;
         return mData[shaderType][variableType][index];
     }
 }
@@ -100,18 +142,16 @@ ShaderInterfaceVariableInfo &ShaderInterfaceVariableInfoMap::addOrGet(
 bool ShaderInterfaceVariableInfoMap::hasVariable(gl::ShaderType shaderType,
                                                  const std::string &variableName) const
 {
-    auto iter = mNameToTypeAndIndexMap[shaderType].find(variableName);
-    return (iter != mNameToTypeAndIndexMap[shaderType].end());
+    return mNameToTypeAndIndexMap[shaderType].find(variableName) != nullptr;
 }
 
 const ShaderInterfaceVariableInfo &ShaderInterfaceVariableInfoMap::getVariableByName(
     gl::ShaderType shaderType,
     const std::string &variableName) const
 {
-    auto iter = mNameToTypeAndIndexMap[shaderType].find(variableName);
-    ASSERT(iter != mNameToTypeAndIndexMap[shaderType].end());
-    TypeAndIndex typeAndIndex = iter->second;
-    return mData[shaderType][typeAndIndex.variableType][typeAndIndex.index];
+    const TypeAndIndex *typeAndIndex = mNameToTypeAndIndexMap[shaderType].find(variableName);
+    ASSERT(typeAndIndex != nullptr);
+    return mData[shaderType][typeAndIndex->variableType][typeAndIndex->index];
 }
 
 bool ShaderInterfaceVariableInfoMap::hasTransformFeedbackInfo(gl::ShaderType shaderType,
@@ -127,10 +167,9 @@ void ShaderInterfaceVariableInfoMap::mapIndexedResourceByName(gl::ShaderType sha
                                                               const std::string &variableName)
 {
     ASSERT(hasVariable(shaderType, variableName));
-    const auto &iter                 = mNameToTypeAndIndexMap[shaderType].find(variableName);
-    const TypeAndIndex &typeAndIndex = iter->second;
-    ASSERT(typeAndIndex.variableType == variableType);
-    mapIndexedResource(shaderType, variableType, resourceIndex, typeAndIndex.index);
+    const TypeAndIndex *typeAndIndex = mNameToTypeAndIndexMap[shaderType].find(variableName);
+    ASSERT(typeAndIndex->variableType == variableType);
+    mapIndexedResource(shaderType, variableType, resourceIndex, typeAndIndex->index);
 }
 
 void ShaderInterfaceVariableInfoMap::mapIndexedResource(gl::ShaderType shaderType,
@@ -153,7 +192,7 @@ const gl::ShaderMap<ShaderInterfaceVariableInfoMap::VariableTypeToInfoMap>
     return mData;
 }
 
-const gl::ShaderMap<ShaderInterfaceVariableInfoMap::NameToTypeAndIndexMap>
+const gl::ShaderMap<NameToTypeAndIndexMap>
     &ShaderInterfaceVariableInfoMap::getNameToTypeAndIndexMap() const
 {
     return mNameToTypeAndIndexMap;
@@ -45,12 +45,39 @@ struct TypeAndIndex
     uint32_t index;
 };
 
+// A flat map from variable name to its type and index in the info arrays.  The entries are kept
+// sorted by name and looked up with binary search; programs have few enough interface variables
+// that the packed array stays cache-resident, and serialization round-trips it in sorted order so
+// program binary loads rebuild it with plain appends instead of hash insertions.
+class NameToTypeAndIndexMap final
+{
+  public:
+    struct Entry
+    {
+        std::string name;
+        TypeAndIndex typeAndIndex;
+    };
+    using ConstIterator = std::vector<Entry>::const_iterator;
+
+    void clear() { mEntries.clear(); }
+    size_t size() const { return mEntries.size(); }
+    ConstIterator begin() const { return mEntries.begin(); }
+    ConstIterator end() const { return mEntries.end(); }
+
+    // Returns nullptr if |name| is not present.
+    const TypeAndIndex *find(const std::string &name) const;
+    TypeAndIndex *find(const std::string &name);
+    void insert(const std::string &name, TypeAndIndex typeAndIndex);
+
+  private:
+    std::vector<Entry> mEntries;
+};
+
 class ShaderInterfaceVariableInfoMap final : angle::NonCopyable
 {
   public:
     using VariableInfoArray     = std::vector<ShaderInterfaceVariableInfo>;
     using VariableTypeToInfoMap = angle::PackedEnumMap<ShaderVariableType, VariableInfoArray>;
-    using NameToTypeAndIndexMap = angle::HashMap<std::string, TypeAndIndex>;
 
     static constexpr size_t kResourceFastMapMax = 32;
     using ResourceIndexMap                      = angle::FastMap<uint32_t, kResourceFastMapMax>;
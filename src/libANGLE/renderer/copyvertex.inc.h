@@ -229,6 +229,86 @@ inline void Copy32FixedTo32FVertexData(const uint8_t *input,
     }
 }
 
+#if defined(ANGLE_USE_SSE) || defined(ANGLE_USE_NEON)
+// Converts four packed normalized 8-bit components to four floats per vertex.  This covers the
+// most common attribute layouts that reach CopyToFloatVertexData (normalized ubyte4/byte4 colors
+// and weights).  Division is used rather than multiplication by a reciprocal so the results match
+// the scalar path bit-for-bit; in particular 255/255 and 127/127 must be exactly 1.0f.
+template <bool isSigned>
+inline void CopyNormalized8To32FVertexDataSimd(const uint8_t *input,
+                                               size_t stride,
+                                               size_t count,
+                                               uint8_t *output)
+{
+#    if defined(ANGLE_USE_SSE)
+    const __m128i zero    = _mm_setzero_si128();
+    const __m128 divisor  = _mm_set1_ps(isSigned ? 127.0f : 255.0f);
+    const __m128 minusOne = _mm_set1_ps(-1.0f);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        // The four components are a single dword; memcpy tolerates any input alignment.
+        uint32_t packed;
+        memcpy(&packed, input + i * stride, sizeof(packed));
+
+        __m128i data = _mm_cvtsi32_si128(static_cast<int>(packed));
+        __m128i components;
+        if (isSigned)
+        {
+            // Widen each byte into the top of a 32-bit lane, then shift arithmetically back down
+            // to sign-extend.
+            __m128i words = _mm_unpacklo_epi8(data, data);
+            components    = _mm_srai_epi32(_mm_unpacklo_epi16(words, words), 24);
+        }
+        else
+        {
+            components = _mm_unpacklo_epi16(_mm_unpacklo_epi8(data, zero), zero);
+        }
+
+        __m128 result = _mm_div_ps(_mm_cvtepi32_ps(components), divisor);
+        if (isSigned)
+        {
+            // -128 would otherwise map slightly below -1.0f.
+            result = _mm_max_ps(result, minusOne);
+        }
+
+        _mm_storeu_ps(reinterpret_cast<float *>(output) + i * 4, result);
+    }
+#    else
+    const float32x4_t divisor  = vdupq_n_f32(isSigned ? 127.0f : 255.0f);
+    const float32x4_t minusOne = vdupq_n_f32(-1.0f);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        // The four components are a single dword; memcpy tolerates any input alignment.
+        uint32_t packed;
+        memcpy(&packed, input + i * stride, sizeof(packed));
+
+        float32x4_t converted;
+        if (isSigned)
+        {
+            int16x8_t words = vmovl_s8(vreinterpret_s8_u32(vdup_n_u32(packed)));
+            converted       = vcvtq_f32_s32(vmovl_s16(vget_low_s16(words)));
+        }
+        else
+        {
+            uint16x8_t words = vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(packed)));
+            converted        = vcvtq_f32_u32(vmovl_u16(vget_low_u16(words)));
+        }
+
+        float32x4_t result = vdivq_f32(converted, divisor);
+        if (isSigned)
+        {
+            // -128 would otherwise map slightly below -1.0f.
+            result = vmaxq_f32(result, minusOne);
+        }
+
+        vst1q_f32(reinterpret_cast<float *>(output) + i * 4, result);
+    }
+#    endif
+}
+#endif  // defined(ANGLE_USE_SSE) || defined(ANGLE_USE_NEON)
+
 template <typename T,
           size_t inputComponentCount,
           size_t outputComponentCount,
@@ -242,6 +322,21 @@ inline void CopyToFloatVertexData(const uint8_t *input,
     typedef std::numeric_limits<T> NL;
     typedef typename std::conditional<toHalf, GLhalf, float>::type outputType;
 
+    if (normalized && !toHalf && sizeof(T) == 1 && inputComponentCount == 4 &&
+        outputComponentCount == 4)
+    {
+#if defined(ANGLE_USE_SSE)
+        if (gl::supportsSSE2())
+        {
+            CopyNormalized8To32FVertexDataSimd<NL::is_signed>(input, stride, count, output);
+            return;
+        }
+#elif defined(ANGLE_USE_NEON)
+        CopyNormalized8To32FVertexDataSimd<NL::is_signed>(input, stride, count, output);
+        return;
+#endif
+    }
+
     for (size_t i = 0; i < count; i++)
     {
         const T *offsetInput = reinterpret_cast<const T *>(input + (stride * i));
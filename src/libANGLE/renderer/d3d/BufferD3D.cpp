@@ -22,6 +22,7 @@ unsigned int BufferD3D::mNextSerial = 1;
 BufferD3D::BufferD3D(const gl::BufferState &state, BufferFactoryD3D *factory)
     : BufferImpl(state),
       mFactory(factory),
+      mContentRevision(0),
       mStaticIndexBuffer(nullptr),
       mStaticBufferCacheTotalSize(0),
       mStaticVertexBufferOutOfDate(false),
@@ -142,6 +143,9 @@ StaticVertexBufferInterface *BufferD3D::getStaticVertexBuffer(const gl::VertexAt
 
 void BufferD3D::invalidateStaticData(const gl::Context *context)
 {
+    // Every path that modifies the buffer contents funnels through here.
+    mContentRevision++;
+
     emptyStaticBufferCache();
 
     if (mStaticIndexBuffer && mStaticIndexBuffer->getBufferSize() != 0)
@@ -41,6 +41,10 @@ class BufferD3D : public BufferImpl
 
     unsigned int getSerial() const { return mSerial; }
 
+    // Revision of the buffer contents, bumped on every data update.  Lets callers check whether
+    // a previous translation of this buffer's data is still current.
+    unsigned int getContentRevision() const { return mContentRevision; }
+
     virtual size_t getSize() const                                                     = 0;
     virtual bool supportsDirectBinding() const                                         = 0;
     virtual angle::Result markTransformFeedbackUsage(const gl::Context *context)       = 0;
@@ -74,6 +78,7 @@ class BufferD3D : public BufferImpl
 
     BufferFactoryD3D *mFactory;
     unsigned int mSerial;
+    unsigned int mContentRevision;
     static unsigned int mNextSerial;
 
     std::vector<std::unique_ptr<StaticVertexBufferInterface>> mStaticVertexBuffers;
@@ -86,6 +86,28 @@ bool IsCompilerFlagSet(UINT mask, UINT flag)
 
 constexpr char kOldCompilerLibrary[] = "d3dcompiler_old.dll";
 
+// Maximum number of compiled binaries kept in the cache.  As with the d3d9 shader cache, the
+// bound mostly guards against pathological apps; ordinary workloads stay well below it.
+constexpr size_t kMaxBinaryCacheSize = 100;
+
+std::string MakeBinaryCacheKey(const std::string &hlsl,
+                               const std::string &profile,
+                               UINT flags,
+                               const D3D_SHADER_MACRO *macros)
+{
+    std::ostringstream key;
+    key << profile << ':' << flags << ':';
+    if (macros != nullptr)
+    {
+        for (const D3D_SHADER_MACRO *mIt = macros; mIt->Name != nullptr; ++mIt)
+        {
+            key << mIt->Name << '=' << mIt->Definition << ';';
+        }
+    }
+    key << ':' << hlsl;
+    return key.str();
+}
+
 enum D3DCompilerLoadLibraryResult
 {
     D3DCompilerDefaultLibrarySuccess,
@@ -194,6 +216,15 @@ angle::Result HLSLCompiler::ensureInitialized(d3d::Context *context)
 
 void HLSLCompiler::release()
 {
+    {
+        std::lock_guard<std::mutex> lock(mBinaryCacheMutex);
+        for (auto &cacheEntry : mBinaryCache)
+        {
+            SafeRelease(cacheEntry.second);
+        }
+        mBinaryCache.clear();
+    }
+
     if (mInitialized)
     {
         FreeLibrary(mD3DCompilerModule);
@@ -232,15 +263,24 @@ angle::Result HLSLCompiler::compileToBinary(d3d::Context *context,
 
     for (size_t i = 0; i < configs.size(); ++i)
     {
+        std::string cacheKey   = MakeBinaryCacheKey(hlsl, profile, configs[i].flags, macros);
         ID3DBlob *errorMessage = nullptr;
-        ID3DBlob *binary       = nullptr;
+        ID3DBlob *binary       = getCachedBinary(cacheKey);
         HRESULT result         = S_OK;
 
+        if (binary == nullptr)
         {
-            ANGLE_TRACE_EVENT1("gpu.angle", "D3DCompile", "source", hlsl);
-            result = mD3DCompileFunc(hlsl.c_str(), hlsl.length(), gl::g_fakepath, macros, nullptr,
-                                     "main", profile.c_str(), configs[i].flags, 0, &binary,
-                                     &errorMessage);
+            {
+                ANGLE_TRACE_EVENT1("gpu.angle", "D3DCompile", "source", hlsl);
+                result = mD3DCompileFunc(hlsl.c_str(), hlsl.length(), gl::g_fakepath, macros,
+                                         nullptr, "main", profile.c_str(), configs[i].flags, 0,
+                                         &binary, &errorMessage);
+            }
+
+            if (SUCCEEDED(result))
+            {
+                cacheBinary(cacheKey, binary);
+            }
         }
 
         if (errorMessage)
@@ -356,6 +396,42 @@ angle::Result HLSLCompiler::compileToBinary(d3d::Context *context,
     return angle::Result::Continue;
 }
 
+ID3DBlob *HLSLCompiler::getCachedBinary(const std::string &key)
+{
+    std::lock_guard<std::mutex> lock(mBinaryCacheMutex);
+
+    auto it = mBinaryCache.find(key);
+    if (it == mBinaryCache.end())
+    {
+        return nullptr;
+    }
+
+    it->second->AddRef();
+    return it->second;
+}
+
+void HLSLCompiler::cacheBinary(const std::string &key, ID3DBlob *binary)
+{
+    std::lock_guard<std::mutex> lock(mBinaryCacheMutex);
+
+    if (mBinaryCache.find(key) != mBinaryCache.end())
+    {
+        // Another thread compiled the same input concurrently; keep the existing entry.
+        return;
+    }
+
+    if (mBinaryCache.size() >= kMaxBinaryCacheSize)
+    {
+        // Random eviction, like the d3d9 shader cache.
+        auto evictIt = mBinaryCache.begin();
+        SafeRelease(evictIt->second);
+        mBinaryCache.erase(evictIt);
+    }
+
+    binary->AddRef();
+    mBinaryCache.insert(std::make_pair(key, binary));
+}
+
 angle::Result HLSLCompiler::disassembleBinary(d3d::Context *context,
                                               ID3DBlob *shaderBinary,
                                               std::string *disassemblyOut)
@@ -14,6 +14,7 @@
 #include "common/angleutils.h"
 #include "common/platform.h"
 
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -63,10 +64,20 @@ class HLSLCompiler : angle::NonCopyable
     angle::Result ensureInitialized(d3d::Context *context);
 
   private:
+    // Returns an AddRef'ed blob for a previously compiled identical input, or nullptr.
+    ID3DBlob *getCachedBinary(const std::string &key);
+    void cacheBinary(const std::string &key, ID3DBlob *binary);
+
     bool mInitialized;
     HMODULE mD3DCompilerModule;
     pD3DCompile mD3DCompileFunc;
     pD3DDisassemble mD3DDisassembleFunc;
+
+    // Compiled binaries keyed by the exact compiler input.  The compiler object lives in the
+    // renderer, so the cache is shared by every program and context of the display, letting
+    // dynamically generated shaders (e.g. geometry shader variants) skip repeat D3DCompile calls.
+    std::mutex mBinaryCacheMutex;
+    angle::HashMap<std::string, ID3DBlob *> mBinaryCache;
 };
 
 }  // namespace rx
@@ -135,7 +135,7 @@ angle::Result IndexBufferInterface::setBufferSize(const gl::Context *context,
 }
 
 StreamingIndexBufferInterface::StreamingIndexBufferInterface(BufferFactoryD3D *factory)
-    : IndexBufferInterface(factory, true)
+    : IndexBufferInterface(factory, true), mDiscardCount(0)
 {}
 
 StreamingIndexBufferInterface::~StreamingIndexBufferInterface() {}
@@ -150,11 +150,13 @@ angle::Result StreamingIndexBufferInterface::reserveBufferSpace(const gl::Contex
     {
         ANGLE_TRY(setBufferSize(context, std::max(size, 2 * curBufferSize), indexType));
         setWritePosition(0);
+        mDiscardCount++;
     }
     else if (writePos + size > curBufferSize || writePos + size < writePos)
     {
         ANGLE_TRY(discard(context));
         setWritePosition(0);
+        mDiscardCount++;
     }
 
     return angle::Result::Continue;
@@ -107,6 +107,13 @@ class StreamingIndexBufferInterface : public IndexBufferInterface
     angle::Result reserveBufferSpace(const gl::Context *context,
                                      unsigned int size,
                                      gl::DrawElementsType indexType) override;
+
+    // Incremented whenever previously streamed data is orphaned by a resize or discard, letting
+    // callers that remember stream offsets detect that they are no longer valid.
+    unsigned int getDiscardCount() const { return mDiscardCount; }
+
+  private:
+    unsigned int mDiscardCount;
 };
 
 class StaticIndexBufferInterface : public IndexBufferInterface
@@ -9,6 +9,7 @@
 
 #include "libANGLE/renderer/d3d/IndexDataManager.h"
 
+#include "common/hash_utils.h"
 #include "common/utilities.h"
 #include "libANGLE/Buffer.h"
 #include "libANGLE/Context.h"
@@ -24,6 +25,28 @@ namespace rx
 namespace
 {
 
+// Bounds for the streamed client-memory index range cache.
+constexpr size_t kMaxStreamedIndexRanges = 16;
+
+// Source ranges are fingerprinted in chunks of this many bytes so that a modified array is
+// detected at the first differing chunk instead of hashing the entire range.
+constexpr size_t kStreamedIndexHashChunkSize = 4096;
+
+// Like angle::ComputeGenericHash but tolerates byte counts that aren't multiples of four, which
+// index ranges commonly are not.
+size_t HashIndexRange(const uint8_t *data, size_t size)
+{
+    size_t alignedSize = size & ~static_cast<size_t>(3);
+    size_t hash        = alignedSize > 0 ? angle::ComputeGenericHash(data, alignedSize) : 0;
+    if (size != alignedSize)
+    {
+        uint32_t tail = 0;
+        memcpy(&tail, data + alignedSize, size - alignedSize);
+        hash = angle::ComputeGenericHash(tail) ^ (hash << 1);
+    }
+    return hash;
+}
+
 template <typename InputT, typename DestT>
 void ConvertIndexArray(const void *input,
                        gl::DrawElementsType sourceType,
@@ -122,6 +145,7 @@ void IndexDataManager::deinitialize()
 {
     mStreamingBufferShort.reset();
     mStreamingBufferInt.reset();
+    mStreamedIndexRangeCache.clear();
 }
 
 // This function translates a GL-style indices into DX-style indices, with their description
@@ -159,9 +183,20 @@ angle::Result IndexDataManager::prepareIndexData(const gl::Context *context,
     // Case 1: the indices are passed by pointer, which forces the streaming of index data
     if (glBuffer == nullptr)
     {
-        translated->storage = nullptr;
-        return streamIndexData(context, indices, count, srcType, dstType,
-                               primitiveRestartFixedIndexEnabled, translated);
+        translated->storage      = nullptr;
+        unsigned int streamCount = static_cast<unsigned int>(count);
+
+        if (findCachedStreamedIndices(indices, streamCount, srcType, dstType,
+                                      primitiveRestartFixedIndexEnabled, translated))
+        {
+            return angle::Result::Continue;
+        }
+
+        ANGLE_TRY(streamIndexData(context, indices, streamCount, srcType, dstType,
+                                  primitiveRestartFixedIndexEnabled, translated));
+        cacheStreamedIndices(indices, streamCount, srcType, dstType,
+                             primitiveRestartFixedIndexEnabled, *translated);
+        return angle::Result::Continue;
     }
 
     // Case 2: the indices are already in a buffer
@@ -256,6 +291,96 @@ angle::Result IndexDataManager::streamIndexData(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+bool IndexDataManager::findCachedStreamedIndices(const void *indices,
+                                                 unsigned int count,
+                                                 gl::DrawElementsType srcType,
+                                                 gl::DrawElementsType dstType,
+                                                 bool usePrimitiveRestartFixedIndex,
+                                                 TranslatedIndexData *translated)
+{
+    auto &streamingBuffer = (dstType == gl::DrawElementsType::UnsignedInt) ? mStreamingBufferInt
+                                                                           : mStreamingBufferShort;
+    if (!streamingBuffer)
+    {
+        return false;
+    }
+
+    for (auto it = mStreamedIndexRangeCache.begin(); it != mStreamedIndexRangeCache.end(); ++it)
+    {
+        if (it->srcIndices != indices || it->count != count || it->srcType != srcType ||
+            it->dstType != dstType ||
+            it->usePrimitiveRestartFixedIndex != usePrimitiveRestartFixedIndex)
+        {
+            continue;
+        }
+
+        if (it->discardCount != streamingBuffer->getDiscardCount())
+        {
+            // The streamed copy was orphaned by a resize or discard.
+            mStreamedIndexRangeCache.erase(it);
+            return false;
+        }
+
+        const uint8_t *src = static_cast<const uint8_t *>(indices);
+        size_t byteCount   = static_cast<size_t>(count) * gl::GetDrawElementsTypeSize(srcType);
+        for (size_t chunk = 0; chunk < it->chunkHashes.size(); ++chunk)
+        {
+            size_t chunkStart = chunk * kStreamedIndexHashChunkSize;
+            size_t chunkSize  = std::min(kStreamedIndexHashChunkSize, byteCount - chunkStart);
+            if (HashIndexRange(src + chunkStart, chunkSize) != it->chunkHashes[chunk])
+            {
+                mStreamedIndexRangeCache.erase(it);
+                return false;
+            }
+        }
+
+        translated->indexBuffer = streamingBuffer->getIndexBuffer();
+        translated->serial      = it->serial;
+        translated->startIndex  = it->streamOffset >> gl::GetDrawElementsTypeShift(dstType);
+        translated->startOffset = it->streamOffset;
+        return true;
+    }
+
+    return false;
+}
+
+void IndexDataManager::cacheStreamedIndices(const void *indices,
+                                            unsigned int count,
+                                            gl::DrawElementsType srcType,
+                                            gl::DrawElementsType dstType,
+                                            bool usePrimitiveRestartFixedIndex,
+                                            const TranslatedIndexData &translated)
+{
+    auto &streamingBuffer = (dstType == gl::DrawElementsType::UnsignedInt) ? mStreamingBufferInt
+                                                                           : mStreamingBufferShort;
+    ASSERT(streamingBuffer);
+
+    if (mStreamedIndexRangeCache.size() >= kMaxStreamedIndexRanges)
+    {
+        mStreamedIndexRangeCache.erase(mStreamedIndexRangeCache.begin());
+    }
+
+    StreamedIndexRange entry;
+    entry.srcIndices                    = indices;
+    entry.count                         = count;
+    entry.srcType                       = srcType;
+    entry.dstType                       = dstType;
+    entry.usePrimitiveRestartFixedIndex = usePrimitiveRestartFixedIndex;
+
+    const uint8_t *src = static_cast<const uint8_t *>(indices);
+    size_t byteCount   = static_cast<size_t>(count) * gl::GetDrawElementsTypeSize(srcType);
+    for (size_t chunkStart = 0; chunkStart < byteCount; chunkStart += kStreamedIndexHashChunkSize)
+    {
+        size_t chunkSize = std::min(kStreamedIndexHashChunkSize, byteCount - chunkStart);
+        entry.chunkHashes.push_back(HashIndexRange(src + chunkStart, chunkSize));
+    }
+
+    entry.discardCount = streamingBuffer->getDiscardCount();
+    entry.streamOffset = translated.startOffset;
+    entry.serial       = translated.serial;
+    mStreamedIndexRangeCache.push_back(std::move(entry));
+}
+
 angle::Result IndexDataManager::getStreamingIndexBuffer(const gl::Context *context,
                                                         gl::DrawElementsType destinationIndexType,
                                                         IndexBufferInterface **outBuffer)
@@ -89,11 +89,42 @@ class IndexDataManager : angle::NonCopyable
                                           gl::DrawElementsType destinationIndexType,
                                           IndexBufferInterface **outBuffer);
 
+    // Reuses converted client-memory indices streamed by an earlier draw. The source range is
+    // fingerprinted with per-chunk hashes, so unchanged arrays convert exactly once while a
+    // modification anywhere in the range is caught at the first differing chunk.
+    bool findCachedStreamedIndices(const void *indices,
+                                   unsigned int count,
+                                   gl::DrawElementsType srcType,
+                                   gl::DrawElementsType dstType,
+                                   bool usePrimitiveRestartFixedIndex,
+                                   TranslatedIndexData *translated);
+
+    void cacheStreamedIndices(const void *indices,
+                              unsigned int count,
+                              gl::DrawElementsType srcType,
+                              gl::DrawElementsType dstType,
+                              bool usePrimitiveRestartFixedIndex,
+                              const TranslatedIndexData &translated);
+
     using StreamingBuffer = std::unique_ptr<StreamingIndexBufferInterface>;
 
+    struct StreamedIndexRange
+    {
+        const void *srcIndices;
+        unsigned int count;
+        gl::DrawElementsType srcType;
+        gl::DrawElementsType dstType;
+        bool usePrimitiveRestartFixedIndex;
+        std::vector<size_t> chunkHashes;
+        unsigned int discardCount;
+        unsigned int streamOffset;
+        unsigned int serial;
+    };
+
     BufferFactoryD3D *const mFactory;
     std::unique_ptr<StreamingIndexBufferInterface> mStreamingBufferShort;
     std::unique_ptr<StreamingIndexBufferInterface> mStreamingBufferInt;
+    std::vector<StreamedIndexRange> mStreamedIndexRangeCache;
 };
 
 angle::Result GetIndexTranslationDestType(const gl::Context *context,
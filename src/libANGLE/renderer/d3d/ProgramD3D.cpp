@@ -1791,12 +1791,28 @@ class ProgramD3D::GetGeometryExecutableTask : public ProgramD3D::GetExecutableTa
     angle::Result run() override
     {
         ANGLE_TRACE_EVENT0("gpu.angle", "ProgramD3D::GetGeometryExecutableTask::run");
-        // Auto-generate the geometry shader here, if we expect to be using point rendering in
-        // D3D11.
-        if (mProgram->usesGeometryShader(mState, gl::PrimitiveMode::Points))
+        // Auto-generate every geometry shader variant the program could need at draw time, so
+        // draw calls find them cached instead of hitching on a mid-frame compile.  The variants
+        // share most of their HLSL, so the extra compiles also hit the compiler's binary cache.
+        constexpr gl::PrimitiveMode kVariants[] = {
+            gl::PrimitiveMode::Lines, gl::PrimitiveMode::Triangles, gl::PrimitiveMode::TriangleStrip,
+            // Points last: its executable doubles as the task result used by the link event.
+            gl::PrimitiveMode::Points};
+
+        for (gl::PrimitiveMode drawMode : kVariants)
         {
-            ANGLE_TRY(mProgram->getGeometryExecutableForPrimitiveType(
-                this, mState, gl::PrimitiveMode::Points, &mExecutable, &mInfoLog));
+            if (!mProgram->usesGeometryShader(mState, drawMode))
+            {
+                continue;
+            }
+
+            ShaderExecutableD3D *executable = nullptr;
+            ANGLE_TRY(mProgram->getGeometryExecutableForPrimitiveType(this, mState, drawMode,
+                                                                      &executable, &mInfoLog));
+            if (drawMode == gl::PrimitiveMode::Points)
+            {
+                mExecutable = executable;
+            }
         }
 
         return angle::Result::Continue;
@@ -69,6 +69,11 @@ class SwapChainD3D : angle::NonCopyable
     HANDLE getShareHandle() { return mShareHandle; }
     virtual void *getKeyedMutex() = 0;
 
+    // Returns the DXGI frame latency waitable object, or null when the swap chain was not
+    // created with EGL_D3D11_MAX_FRAME_LATENCY_ANGLE. The handle stays owned by the swap
+    // chain; the application waits on it to pace frames.
+    virtual HANDLE getFrameLatencyWaitableObject() { return nullptr; }
+
     virtual egl::Error getSyncValues(EGLuint64KHR *ust, EGLuint64KHR *msc, EGLuint64KHR *sbc) = 0;
 
   protected:
@@ -17,6 +17,12 @@
 
 namespace rx
 {
+namespace
+{
+// Upper bound on remembered streaming translations; enough for every attribute of a couple of
+// draws while keeping lookups trivially cheap.
+constexpr size_t kMaxCachedTranslations = 32;
+}  // anonymous namespace
 
 // VertexBuffer Implementation
 unsigned int VertexBuffer::mNextSerial = 1;
@@ -141,6 +147,7 @@ void StreamingVertexBufferInterface::reset()
         mVertexBuffer->release();
         mVertexBuffer = mFactory->createVertexBuffer();
     }
+    mCachedTranslations.clear();
 }
 
 StreamingVertexBufferInterface::~StreamingVertexBufferInterface() {}
@@ -153,11 +160,13 @@ angle::Result StreamingVertexBufferInterface::reserveSpace(const gl::Context *co
     {
         ANGLE_TRY(setBufferSize(context, std::max(size, 3 * curBufferSize / 2)));
         mWritePosition = 0;
+        mCachedTranslations.clear();
     }
     else if (mWritePosition + size > curBufferSize)
     {
         ANGLE_TRY(discard(context));
         mWritePosition = 0;
+        mCachedTranslations.clear();
     }
 
     mReservedSpace = size;
@@ -235,6 +244,95 @@ angle::Result StreamingVertexBufferInterface::reserveVertexSpace(const gl::Conte
     return angle::Result::Continue;
 }
 
+bool StreamingVertexBufferInterface::matchesCachedTranslation(
+    const CachedTranslation &entry,
+    const gl::VertexAttribute &attrib,
+    const gl::VertexBinding &binding,
+    gl::VertexAttribType currentValueType,
+    unsigned int sourceSerial,
+    GLint start,
+    size_t count,
+    GLsizei instances,
+    GLuint baseInstance) const
+{
+    return entry.sourceSerial == sourceSerial && entry.formatID == attrib.format->id &&
+           entry.stride == ComputeVertexAttributeStride(attrib, binding) &&
+           entry.offset == ComputeVertexAttributeOffset(attrib, binding) &&
+           entry.divisor == binding.getDivisor() && entry.currentValueType == currentValueType &&
+           entry.start == start && entry.count == count && entry.instances == instances &&
+           entry.baseInstance == baseInstance;
+}
+
+bool StreamingVertexBufferInterface::getCachedStreamOffset(const gl::VertexAttribute &attrib,
+                                                           const gl::VertexBinding &binding,
+                                                           gl::VertexAttribType currentValueType,
+                                                           unsigned int sourceSerial,
+                                                           unsigned int sourceRevision,
+                                                           GLint start,
+                                                           size_t count,
+                                                           GLsizei instances,
+                                                           GLuint baseInstance,
+                                                           unsigned int *outStreamOffset) const
+{
+    for (const CachedTranslation &entry : mCachedTranslations)
+    {
+        if (entry.sourceRevision == sourceRevision &&
+            matchesCachedTranslation(entry, attrib, binding, currentValueType, sourceSerial, start,
+                                     count, instances, baseInstance))
+        {
+            *outStreamOffset = entry.streamOffset;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void StreamingVertexBufferInterface::cacheStreamOffset(const gl::VertexAttribute &attrib,
+                                                       const gl::VertexBinding &binding,
+                                                       gl::VertexAttribType currentValueType,
+                                                       unsigned int sourceSerial,
+                                                       unsigned int sourceRevision,
+                                                       GLint start,
+                                                       size_t count,
+                                                       GLsizei instances,
+                                                       GLuint baseInstance,
+                                                       unsigned int streamOffset)
+{
+    // Replace an entry for the same source and layout rather than letting stale revisions pile
+    // up; otherwise drop the oldest entry once the cache is full.
+    for (CachedTranslation &entry : mCachedTranslations)
+    {
+        if (matchesCachedTranslation(entry, attrib, binding, currentValueType, sourceSerial, start,
+                                     count, instances, baseInstance))
+        {
+            entry.sourceRevision = sourceRevision;
+            entry.streamOffset   = streamOffset;
+            return;
+        }
+    }
+
+    if (mCachedTranslations.size() >= kMaxCachedTranslations)
+    {
+        mCachedTranslations.erase(mCachedTranslations.begin());
+    }
+
+    CachedTranslation entry;
+    entry.sourceSerial     = sourceSerial;
+    entry.sourceRevision   = sourceRevision;
+    entry.formatID         = attrib.format->id;
+    entry.stride           = static_cast<GLuint>(ComputeVertexAttributeStride(attrib, binding));
+    entry.offset           = ComputeVertexAttributeOffset(attrib, binding);
+    entry.divisor          = binding.getDivisor();
+    entry.currentValueType = currentValueType;
+    entry.start            = start;
+    entry.count            = count;
+    entry.instances        = instances;
+    entry.baseInstance     = baseInstance;
+    entry.streamOffset     = streamOffset;
+    mCachedTranslations.push_back(entry);
+}
+
 // StaticVertexBufferInterface Implementation
 StaticVertexBufferInterface::AttributeSignature::AttributeSignature()
     : formatID(angle::FormatID::NONE), stride(0), offset(0)
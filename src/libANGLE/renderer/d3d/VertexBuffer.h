@@ -136,11 +136,67 @@ class StreamingVertexBufferInterface : public VertexBufferInterface
                                      GLsizei instances,
                                      GLuint baseInstance);
 
+    // Looks up a translation stored by an earlier draw.  Returns false if no translation with
+    // the same source generation and layout is present, or the streaming buffer has cycled
+    // since it was stored.
+    bool getCachedStreamOffset(const gl::VertexAttribute &attrib,
+                               const gl::VertexBinding &binding,
+                               gl::VertexAttribType currentValueType,
+                               unsigned int sourceSerial,
+                               unsigned int sourceRevision,
+                               GLint start,
+                               size_t count,
+                               GLsizei instances,
+                               GLuint baseInstance,
+                               unsigned int *outStreamOffset) const;
+
+    // Remembers where a translation of the given source data was streamed to.
+    void cacheStreamOffset(const gl::VertexAttribute &attrib,
+                           const gl::VertexBinding &binding,
+                           gl::VertexAttribType currentValueType,
+                           unsigned int sourceSerial,
+                           unsigned int sourceRevision,
+                           GLint start,
+                           size_t count,
+                           GLsizei instances,
+                           GLuint baseInstance,
+                           unsigned int streamOffset);
+
   private:
     angle::Result reserveSpace(const gl::Context *context, unsigned int size);
 
+    // Key and result of one translated attribute.  Entries stay valid until the streaming
+    // buffer is discarded or resized, or the source buffer contents change.
+    struct CachedTranslation
+    {
+        unsigned int sourceSerial;
+        unsigned int sourceRevision;
+        angle::FormatID formatID;
+        GLuint stride;
+        GLintptr offset;
+        GLuint divisor;
+        gl::VertexAttribType currentValueType;
+        GLint start;
+        size_t count;
+        GLsizei instances;
+        GLuint baseInstance;
+        unsigned int streamOffset;
+    };
+
+    bool matchesCachedTranslation(const CachedTranslation &entry,
+                                  const gl::VertexAttribute &attrib,
+                                  const gl::VertexBinding &binding,
+                                  gl::VertexAttribType currentValueType,
+                                  unsigned int sourceSerial,
+                                  GLint start,
+                                  size_t count,
+                                  GLsizei instances,
+                                  GLuint baseInstance) const;
+
     unsigned int mWritePosition;
     unsigned int mReservedSpace;
+
+    std::vector<CachedTranslation> mCachedTranslations;
 };
 
 class StaticVertexBufferInterface : public VertexBufferInterface
@@ -439,16 +439,50 @@ angle::Result VertexDataManager::storeDynamicAttribs(
     // Will trigger unmapping on return.
     StreamingBufferUnmapper localUnmapper(&mStreamingBuffer);
 
-    // Reserve the required space for the dynamic buffers.
+    // Reuse translations stored by earlier draws when the source buffer contents have not
+    // changed since; replayed geometry then skips the CPU conversion entirely.
+    gl::AttributesMask uncachedAttribsMask;
     for (auto attribIndex : dynamicAttribsMask)
+    {
+        bool found = false;
+        ANGLE_TRY(findCachedDynamicAttrib(context, &(*translatedAttribs)[attribIndex], start,
+                                          count, instances, baseInstance, &found));
+        if (!found)
+        {
+            uncachedAttribsMask.set(attribIndex);
+        }
+    }
+
+    if (uncachedAttribsMask.none())
+    {
+        return angle::Result::Continue;
+    }
+
+    // Reserve the required space for the dynamic buffers.
+    for (auto attribIndex : uncachedAttribsMask)
     {
         const auto &dynamicAttrib = (*translatedAttribs)[attribIndex];
         ANGLE_TRY(
             reserveSpaceForAttrib(context, dynamicAttrib, start, count, instances, baseInstance));
     }
 
+    // Reserving space may have discarded the streaming buffer, dropping the cached offsets
+    // handed out above; those attributes must then be reserved and translated again too.
+    for (auto attribIndex : (dynamicAttribsMask & ~uncachedAttribsMask))
+    {
+        bool found = false;
+        ANGLE_TRY(findCachedDynamicAttrib(context, &(*translatedAttribs)[attribIndex], start,
+                                          count, instances, baseInstance, &found));
+        if (!found)
+        {
+            uncachedAttribsMask.set(attribIndex);
+            ANGLE_TRY(reserveSpaceForAttrib(context, (*translatedAttribs)[attribIndex], start,
+                                            count, instances, baseInstance));
+        }
+    }
+
     // Store dynamic attributes
-    for (auto attribIndex : dynamicAttribsMask)
+    for (auto attribIndex : uncachedAttribsMask)
     {
         auto *dynamicAttrib = &(*translatedAttribs)[attribIndex];
         ANGLE_TRY(
@@ -523,6 +557,60 @@ angle::Result VertexDataManager::reserveSpaceForAttrib(const gl::Context *contex
                                                baseInstance);
 }
 
+angle::Result VertexDataManager::findCachedDynamicAttrib(const gl::Context *context,
+                                                         TranslatedAttribute *translated,
+                                                         GLint start,
+                                                         size_t count,
+                                                         GLsizei instances,
+                                                         GLuint baseInstance,
+                                                         bool *foundOut)
+{
+    *foundOut = false;
+
+    ASSERT(translated->attribute && translated->binding);
+    const auto &attrib  = *translated->attribute;
+    const auto &binding = *translated->binding;
+
+    gl::Buffer *buffer = binding.getBuffer().get();
+    if (!buffer)
+    {
+        // Client arrays can change without notice; they are never cached.
+        return angle::Result::Continue;
+    }
+
+    BufferD3D *storage = GetImplAs<BufferD3D>(buffer);
+
+    // Instanced vertices do not apply the 'start' offset
+    GLint firstVertexIndex =
+        (binding.getDivisor() > 0 ? UnsignedCeilDivide(baseInstance, binding.getDivisor()) : start);
+
+    size_t totalCount = gl::ComputeVertexBindingElementCount(binding.getDivisor(), count,
+                                                             static_cast<size_t>(instances));
+
+    unsigned int streamOffset = 0;
+    if (!mStreamingBuffer.getCachedStreamOffset(
+            attrib, binding, translated->currentValueType, storage->getSerial(),
+            storage->getContentRevision(), firstVertexIndex, totalCount, instances, baseInstance,
+            &streamOffset))
+    {
+        return angle::Result::Continue;
+    }
+
+    translated->storage = nullptr;
+    ANGLE_TRY(
+        mFactory->getVertexSpaceRequired(context, attrib, binding, 1, 0, 0, &translated->stride));
+
+    VertexBuffer *vertexBuffer = mStreamingBuffer.getVertexBuffer();
+
+    translated->vertexBuffer.set(vertexBuffer);
+    translated->serial                = vertexBuffer->getSerial();
+    translated->baseOffset            = streamOffset;
+    translated->usesFirstVertexOffset = false;
+
+    *foundOut = true;
+    return angle::Result::Continue;
+}
+
 angle::Result VertexDataManager::storeDynamicAttrib(const gl::Context *context,
                                                     TranslatedAttribute *translated,
                                                     GLint start,
@@ -572,6 +660,16 @@ angle::Result VertexDataManager::storeDynamicAttrib(const gl::Context *context,
         context, attrib, binding, translated->currentValueType, firstVertexIndex,
         static_cast<GLsizei>(totalCount), instances, baseInstance, &streamOffset, sourceData));
 
+    if (storage)
+    {
+        // Remember the translation so identical draws can skip it while the source data and the
+        // streamed output remain valid.
+        mStreamingBuffer.cacheStreamOffset(attrib, binding, translated->currentValueType,
+                                           storage->getSerial(), storage->getContentRevision(),
+                                           firstVertexIndex, totalCount, instances, baseInstance,
+                                           streamOffset);
+    }
+
     VertexBuffer *vertexBuffer = mStreamingBuffer.getVertexBuffer();
 
     translated->vertexBuffer.set(vertexBuffer);
@@ -144,6 +144,16 @@ class VertexDataManager : angle::NonCopyable
                                         GLsizei instances,
                                         GLuint baseInstance);
 
+    // Reuses a translation of this attribute cached by an earlier draw, if the source buffer
+    // contents haven't changed since it was streamed.
+    angle::Result findCachedDynamicAttrib(const gl::Context *context,
+                                          TranslatedAttribute *translated,
+                                          GLint start,
+                                          size_t count,
+                                          GLsizei instances,
+                                          GLuint baseInstance,
+                                          bool *foundOut);
+
     angle::Result storeDynamicAttrib(const gl::Context *context,
                                      TranslatedAttribute *translated,
                                      GLint start,
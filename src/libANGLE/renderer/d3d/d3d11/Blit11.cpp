@@ -1275,6 +1275,7 @@ angle::Result Blit11::copyAndConvertImpl(const gl::Context *context,
     deviceContext->Unmap(sourceStaging.get(), 0);
     deviceContext->Unmap(destStaging.get(), 0);
 
+    mRenderer->recycleStagingTexture(&sourceStaging);
     return angle::Result::Continue;
 }
 
@@ -1329,6 +1330,7 @@ angle::Result Blit11::copyAndConvert(const gl::Context *context,
                                              destStaging.get(), 0, nullptr);
     }
 
+    mRenderer->recycleStagingTexture(&destStaging);
     return angle::Result::Continue;
 }
 
@@ -12,6 +12,7 @@
 
 #include "common/MemoryBuffer.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/renderer/MemoryBudget.h"
 #include "libANGLE/renderer/d3d/IndexDataManager.h"
 #include "libANGLE/renderer/d3d/VertexDataManager.h"
 #include "libANGLE/renderer/d3d/d3d11/Context11.h"
@@ -1141,6 +1142,11 @@ Buffer11::NativeStorage::~NativeStorage()
 {
     clearSRVs();
     clearUAVs();
+
+    if (mBufferSize != 0)
+    {
+        mRenderer->getMemoryBudgetTracker()->onDeallocation(GpuMemoryCategory::Buffer, mBufferSize);
+    }
 }
 
 bool Buffer11::NativeStorage::isCPUAccessible(GLbitfield access) const
@@ -1228,9 +1234,15 @@ angle::Result Buffer11::NativeStorage::resize(const gl::Context *context,
                                               size_t size,
                                               bool preserveData)
 {
+    MemoryBudgetTracker *budgetTracker = mRenderer->getMemoryBudgetTracker();
+
     if (size == 0)
     {
         mBuffer.reset();
+        if (mBufferSize != 0)
+        {
+            budgetTracker->onDeallocation(GpuMemoryCategory::Buffer, mBufferSize);
+        }
         mBufferSize = 0;
         return angle::Result::Continue;
     }
@@ -1264,7 +1276,12 @@ angle::Result Buffer11::NativeStorage::resize(const gl::Context *context,
     // No longer need the old buffer
     mBuffer = std::move(newBuffer);
 
+    if (mBufferSize != 0)
+    {
+        budgetTracker->onDeallocation(GpuMemoryCategory::Buffer, mBufferSize);
+    }
     mBufferSize = bufferDesc.ByteWidth;
+    budgetTracker->onAllocation(GpuMemoryCategory::Buffer, mBufferSize);
 
     // Free the SRVs.
     clearSRVs();
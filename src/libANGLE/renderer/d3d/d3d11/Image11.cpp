@@ -112,8 +112,9 @@ angle::Result Image11::CopyImage(const gl::Context *context,
                         destOffset.y * destMapped.RowPitch + destOffset.z * destMapped.DepthPitch;
 
     CopyImageCHROMIUM(sourceData, srcMapped.RowPitch, sourcePixelBytes, srcMapped.DepthPitch,
-                      sourceFormat.pixelReadFunction, destData, destMapped.RowPitch, destPixelBytes,
-                      destMapped.DepthPitch, destFormat.pixelWriteFunction, destUnsizedFormat,
+                      sourceFormat.id, sourceFormat.pixelReadFunction, destData,
+                      destMapped.RowPitch, destPixelBytes, destMapped.DepthPitch, destFormat.id,
+                      destFormat.pixelWriteFunction, destUnsizedFormat,
                       destFormatInfo.componentType, sourceBox.width, sourceBox.height,
                       sourceBox.depth, unpackFlipY, unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
 
@@ -524,7 +525,9 @@ angle::Result Image11::getStagingTexture(const gl::Context *context,
 
 void Image11::releaseStagingTexture()
 {
-    mStagingTexture.reset();
+    // Staging textures churn as images associate and disassociate with storage; hand the
+    // texture to the renderer's pool so the next image of the same shape can reuse it.
+    mRenderer->recycleStagingTexture(&mStagingTexture);
     mStagingTextureSubresourceVerifier.reset();
 }
 
@@ -575,7 +578,9 @@ angle::Result Image11::createStagingTexture(const gl::Context *context)
                 ANGLE_TRY(mRenderer->allocateTexture(context11, desc, formatInfo,
                                                      initialData.data(), &mStagingTexture));
             }
-            else
+            else if (!mRenderer->findPooledStagingTexture(
+                         ResourceType::Texture3D, formatInfo, gl::Extents(width, height, mDepth),
+                         desc.MipLevels, desc.CPUAccessFlags, &mStagingTexture))
             {
                 ANGLE_TRY(
                     mRenderer->allocateTexture(context11, desc, formatInfo, &mStagingTexture));
@@ -614,7 +619,9 @@ angle::Result Image11::createStagingTexture(const gl::Context *context)
                 ANGLE_TRY(mRenderer->allocateTexture(context11, desc, formatInfo,
                                                      initialData.data(), &mStagingTexture));
             }
-            else
+            else if (!mRenderer->findPooledStagingTexture(
+                         ResourceType::Texture2D, formatInfo, gl::Extents(width, height, 1),
+                         desc.MipLevels, desc.CPUAccessFlags, &mStagingTexture))
             {
                 ANGLE_TRY(
                     mRenderer->allocateTexture(context11, desc, formatInfo, &mStagingTexture));
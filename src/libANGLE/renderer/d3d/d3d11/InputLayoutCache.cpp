@@ -65,7 +65,9 @@ struct PackedAttribute
 
 }  // anonymous namespace
 
-PackedAttributeLayout::PackedAttributeLayout() : numAttributes(0), flags(0), attributeData({}) {}
+PackedAttributeLayout::PackedAttributeLayout()
+    : numAttributes(0), flags(0), attributeHash(0), attributeData({})
+{}
 
 PackedAttributeLayout::PackedAttributeLayout(const PackedAttributeLayout &other) = default;
 
@@ -91,7 +93,18 @@ void PackedAttributeLayout::addAttributeData(GLenum glType,
     static_assert(sizeof(uint64_t) == sizeof(PackedAttribute),
                   "PackedAttributes must be 64-bits exactly.");
 
-    attributeData[numAttributes++] = gl::bitCast<uint64_t>(packedAttrib);
+    uint64_t packed                = gl::bitCast<uint64_t>(packedAttrib);
+    attributeData[numAttributes++] = packed;
+
+    // Fold the attribute into the running hash; the combine is order-dependent so layouts with
+    // the same attributes in different slots hash differently.
+    attributeHash ^= packed + 0x9e3779b97f4a7c15ull + (attributeHash << 6) + (attributeHash >> 2);
+}
+
+size_t PackedAttributeLayout::hash() const
+{
+    return static_cast<size_t>(attributeHash ^ (static_cast<uint64_t>(flags) << 32) ^
+                               numAttributes);
 }
 
 bool PackedAttributeLayout::operator==(const PackedAttributeLayout &other) const
@@ -37,6 +37,10 @@ struct PackedAttributeLayout
                           angle::FormatID vertexFormatID,
                           unsigned int divisor);
 
+    // Combines the incrementally maintained attribute hash with the flag bits, so per-draw cache
+    // lookups use a precomputed value instead of re-hashing the whole packed descriptor.
+    size_t hash() const;
+
     bool operator==(const PackedAttributeLayout &other) const;
 
     enum Flags
@@ -48,6 +52,7 @@ struct PackedAttributeLayout
 
     uint32_t numAttributes;
     uint32_t flags;
+    uint64_t attributeHash;
     gl::AttribArray<uint64_t> attributeData;
 };
 }  // namespace rx
@@ -57,10 +62,7 @@ namespace std
 template <>
 struct hash<rx::PackedAttributeLayout>
 {
-    size_t operator()(const rx::PackedAttributeLayout &value) const
-    {
-        return angle::ComputeGenericHash(value);
-    }
+    size_t operator()(const rx::PackedAttributeLayout &value) const { return value.hash(); }
 };
 }  // namespace std
 
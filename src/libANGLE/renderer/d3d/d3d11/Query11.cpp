@@ -57,13 +57,14 @@ Query11::QueryState::QueryState()
 Query11::QueryState::~QueryState() {}
 
 Query11::Query11(Renderer11 *renderer, gl::QueryType type)
-    : QueryImpl(type), mResult(0), mResultSum(0), mRenderer(renderer)
+    : QueryImpl(type), mResult(0), mResultSum(0), mRenderer(renderer), mListedInQuerySweep(false)
 {
     mActiveQuery = std::unique_ptr<QueryState>(new QueryState());
 }
 
 Query11::~Query11()
 {
+    mRenderer->onQueryDeleted(this);
     mRenderer->getStateManager()->onDeleteQueryObject(this);
 }
 
@@ -85,6 +86,7 @@ angle::Result Query11::queryCounter(const gl::Context *context)
     ASSERT(getType() == gl::QueryType::Timestamp);
     mResultSum = 0;
     mPendingQueries.push_back(std::unique_ptr<QueryState>(new QueryState()));
+    mRenderer->onPendingQuery(this);
     return angle::Result::Continue;
 }
 
@@ -92,6 +94,9 @@ template <typename T>
 angle::Result Query11::getResultBase(Context11 *context11, T *params)
 {
     ASSERT(!mActiveQuery->query.valid());
+    // Resolve results for every pending query in submission order first. When many queries are
+    // read back in one frame, this amortizes the polling cost across all of them.
+    ANGLE_TRY(mRenderer->sweepPendingQueries(context11));
     ANGLE_TRY(flush(context11, true));
     ASSERT(mPendingQueries.empty());
     *params = static_cast<T>(mResultSum);
@@ -121,7 +126,11 @@ angle::Result Query11::getResult(const gl::Context *context, GLuint64 *params)
 
 angle::Result Query11::isResultAvailable(const gl::Context *context, bool *available)
 {
-    ANGLE_TRY(flush(GetImplAs<Context11>(context), false));
+    Context11 *context11 = GetImplAs<Context11>(context);
+    // The sweep usually resolves every finished query in one pass; the per-query flush only does
+    // work when the sweep stopped early at a query the GPU hadn't reached yet.
+    ANGLE_TRY(mRenderer->sweepPendingQueries(context11));
+    ANGLE_TRY(flush(context11, false));
 
     *available = mPendingQueries.empty();
     return angle::Result::Continue;
@@ -144,6 +153,7 @@ angle::Result Query11::pause(Context11 *context11)
 
         mPendingQueries.push_back(std::move(mActiveQuery));
         mActiveQuery = std::unique_ptr<QueryState>(new QueryState());
+        mRenderer->onPendingQuery(this);
     }
 
     return flush(context11, false);
@@ -192,7 +202,12 @@ angle::Result Query11::resume(Context11 *context11)
     return angle::Result::Continue;
 }
 
-angle::Result Query11::flush(Context11 *context11, bool force)
+angle::Result Query11::pollPendingResults(d3d::Context *context)
+{
+    return flush(context, false);
+}
+
+angle::Result Query11::flush(d3d::Context *context, bool force)
 {
     while (!mPendingQueries.empty())
     {
@@ -200,7 +215,7 @@ angle::Result Query11::flush(Context11 *context11, bool force)
 
         do
         {
-            ANGLE_TRY(testQuery(context11, query));
+            ANGLE_TRY(testQuery(context, query));
             if (!query->finished && !force)
             {
                 return angle::Result::Continue;
@@ -214,11 +229,11 @@ angle::Result Query11::flush(Context11 *context11, bool force)
     return angle::Result::Continue;
 }
 
-angle::Result Query11::testQuery(Context11 *context11, QueryState *queryState)
+angle::Result Query11::testQuery(d3d::Context *context, QueryState *queryState)
 {
     if (!queryState->finished)
     {
-        ID3D11DeviceContext *context = mRenderer->getDeviceContext();
+        ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
         switch (getType())
         {
             case gl::QueryType::AnySamples:
@@ -227,8 +242,8 @@ angle::Result Query11::testQuery(Context11 *context11, QueryState *queryState)
                 ASSERT(queryState->query.valid());
                 UINT64 numPixels = 0;
                 HRESULT result =
-                    context->GetData(queryState->query.get(), &numPixels, sizeof(numPixels), 0);
-                ANGLE_TRY_HR(context11, result, "Failed to get the data of an internal query");
+                    deviceContext->GetData(queryState->query.get(), &numPixels, sizeof(numPixels), 0);
+                ANGLE_TRY_HR(context, result, "Failed to get the data of an internal query");
 
                 if (result == S_OK)
                 {
@@ -243,8 +258,8 @@ angle::Result Query11::testQuery(Context11 *context11, QueryState *queryState)
                 ASSERT(queryState->query.valid());
                 D3D11_QUERY_DATA_SO_STATISTICS soStats = {};
                 HRESULT result =
-                    context->GetData(queryState->query.get(), &soStats, sizeof(soStats), 0);
-                ANGLE_TRY_HR(context11, result, "Failed to get the data of an internal query");
+                    deviceContext->GetData(queryState->query.get(), &soStats, sizeof(soStats), 0);
+                ANGLE_TRY_HR(context, result, "Failed to get the data of an internal query");
 
                 if (result == S_OK)
                 {
@@ -261,21 +276,21 @@ angle::Result Query11::testQuery(Context11 *context11, QueryState *queryState)
                 ASSERT(queryState->endTimestamp.valid());
                 D3D11_QUERY_DATA_TIMESTAMP_DISJOINT timeStats = {};
                 HRESULT result =
-                    context->GetData(queryState->query.get(), &timeStats, sizeof(timeStats), 0);
-                ANGLE_TRY_HR(context11, result, "Failed to get the data of an internal query");
+                    deviceContext->GetData(queryState->query.get(), &timeStats, sizeof(timeStats), 0);
+                ANGLE_TRY_HR(context, result, "Failed to get the data of an internal query");
 
                 if (result == S_OK)
                 {
                     UINT64 beginTime = 0;
-                    HRESULT beginRes = context->GetData(queryState->beginTimestamp.get(),
+                    HRESULT beginRes = deviceContext->GetData(queryState->beginTimestamp.get(),
                                                         &beginTime, sizeof(UINT64), 0);
-                    ANGLE_TRY_HR(context11, beginRes,
+                    ANGLE_TRY_HR(context, beginRes,
                                  "Failed to get the data of an internal query");
 
                     UINT64 endTime = 0;
-                    HRESULT endRes = context->GetData(queryState->endTimestamp.get(), &endTime,
+                    HRESULT endRes = deviceContext->GetData(queryState->endTimestamp.get(), &endTime,
                                                       sizeof(UINT64), 0);
-                    ANGLE_TRY_HR(context11, endRes, "Failed to get the data of an internal query");
+                    ANGLE_TRY_HR(context, endRes, "Failed to get the data of an internal query");
 
                     if (beginRes == S_OK && endRes == S_OK)
                     {
@@ -323,8 +338,8 @@ angle::Result Query11::testQuery(Context11 *context11, QueryState *queryState)
                 ASSERT(queryState->query.valid());
                 BOOL completed = 0;
                 HRESULT result =
-                    context->GetData(queryState->query.get(), &completed, sizeof(completed), 0);
-                ANGLE_TRY_HR(context11, result, "Failed to get the data of an internal query");
+                    deviceContext->GetData(queryState->query.get(), &completed, sizeof(completed), 0);
+                ANGLE_TRY_HR(context, result, "Failed to get the data of an internal query");
 
                 if (result == S_OK)
                 {
@@ -346,7 +361,7 @@ angle::Result Query11::testQuery(Context11 *context11, QueryState *queryState)
         if (!queryState->finished && checkDeviceLost && mRenderer->testDeviceLost())
         {
             mRenderer->notifyDeviceLost();
-            ANGLE_TRY_HR(context11, E_OUTOFMEMORY,
+            ANGLE_TRY_HR(context, E_OUTOFMEMORY,
                          "Failed to test get query result, device is lost.");
         }
     }
@@ -19,6 +19,11 @@ namespace rx
 class Context11;
 class Renderer11;
 
+namespace d3d
+{
+class Context;
+}  // namespace d3d
+
 class Query11 : public QueryImpl
 {
   public:
@@ -37,6 +42,14 @@ class Query11 : public QueryImpl
     angle::Result pause(Context11 *context11);
     angle::Result resume(Context11 *context11);
 
+    // Whether any submitted queries still have unresolved results. Checking the deque is cheap,
+    // so GL_QUERY_RESULT_AVAILABLE never needs a per-query GetData once this returns false.
+    bool hasPendingResults() const { return !mPendingQueries.empty(); }
+
+    // Polls pending queries without blocking. Used by Renderer11's batched query sweep to
+    // resolve results for many queries in one pass.
+    angle::Result pollPendingResults(d3d::Context *context);
+
   private:
     struct QueryState final : private angle::NonCopyable
     {
@@ -51,8 +64,8 @@ class Query11 : public QueryImpl
         bool finished;
     };
 
-    angle::Result flush(Context11 *context11, bool force);
-    angle::Result testQuery(Context11 *context11, QueryState *queryState);
+    angle::Result flush(d3d::Context *context, bool force);
+    angle::Result testQuery(d3d::Context *context, QueryState *queryState);
 
     template <typename T>
     angle::Result getResultBase(Context11 *context11, T *params);
@@ -64,6 +77,10 @@ class Query11 : public QueryImpl
 
     std::unique_ptr<QueryState> mActiveQuery;
     std::deque<std::unique_ptr<QueryState>> mPendingQueries;
+
+    // Tracks whether this query is registered in the renderer's pending query sweep list.
+    friend class Renderer11;
+    bool mListedInQuerySweep;
 };
 
 }  // namespace rx
@@ -10,6 +10,7 @@
 
 #include <EGL/eglext.h>
 #include <versionhelpers.h>
+#include <algorithm>
 #include <sstream>
 
 #include "anglebase/no_destructor.h"
@@ -25,6 +26,7 @@
 #include "libANGLE/Surface.h"
 #include "libANGLE/formatutils.h"
 #include "libANGLE/histogram_macros.h"
+#include "libANGLE/renderer/MemoryBudget.h"
 #include "libANGLE/renderer/d3d/CompilerD3D.h"
 #include "libANGLE/renderer/d3d/DeviceD3D.h"
 #include "libANGLE/renderer/d3d/DisplayD3D.h"
@@ -351,6 +353,22 @@ GLsizei GetAdjustedInstanceCount(const ProgramD3D *program, GLsizei instanceCoun
 
 const uint32_t ScratchMemoryBufferLifetime = 1000;
 
+// Bounds for the staging texture reuse pool.  Entries beyond either limit are trimmed
+// least-recently-used first.
+constexpr size_t kMaxPooledStagingTextures        = 8;
+constexpr uint64_t kMaxPooledStagingTextureMemory = 32 * 1024 * 1024;
+
+// Upper bound on retained multisample resolve targets for blits.
+constexpr size_t kMaxCachedResolveTextures = 4;
+
+uint64_t EstimateStagingTextureMemory(DXGI_FORMAT format, const gl::Extents &size, UINT mipLevels)
+{
+    uint64_t bytes = static_cast<uint64_t>(d3d11::GetDXGIFormatSizeInfo(format).pixelBytes) *
+                     size.width * size.height * size.depth;
+    // A full mip chain at most doubles the base level size.
+    return mipLevels > 1 ? bytes * 2 : bytes;
+}
+
 void PopulateFormatDeviceCaps(ID3D11Device *device,
                               DXGI_FORMAT format,
                               UINT *outSupport,
@@ -426,16 +444,19 @@ Renderer11::Renderer11(egl::Display *display)
 
     mTrim = nullptr;
 
-    mRenderer11DeviceCaps.supportsClearView                      = false;
-    mRenderer11DeviceCaps.supportsConstantBufferOffsets          = false;
-    mRenderer11DeviceCaps.supportsVpRtIndexWriteFromVertexShader = false;
-    mRenderer11DeviceCaps.supportsDXGI1_2                        = false;
-    mRenderer11DeviceCaps.allowES3OnFL10_0                       = false;
-    mRenderer11DeviceCaps.supportsTypedUAVLoadAdditionalFormats  = false;
-    mRenderer11DeviceCaps.supportsRasterizerOrderViews           = false;
-    mRenderer11DeviceCaps.B5G6R5support                          = 0;
-    mRenderer11DeviceCaps.B4G4R4A4support                        = 0;
-    mRenderer11DeviceCaps.B5G5R5A1support                        = 0;
+    mRenderer11DeviceCaps.supportsClearView                           = false;
+    mRenderer11DeviceCaps.supportsConstantBufferOffsets               = false;
+    mRenderer11DeviceCaps.supportsMapNoOverwriteDynamicConstantBuffer = false;
+    mRenderer11DeviceCaps.supportsDriverCommandLists                  = false;
+    mRenderer11DeviceCaps.supportsConcurrentCreates                   = false;
+    mRenderer11DeviceCaps.supportsVpRtIndexWriteFromVertexShader      = false;
+    mRenderer11DeviceCaps.supportsDXGI1_2                             = false;
+    mRenderer11DeviceCaps.allowES3OnFL10_0                            = false;
+    mRenderer11DeviceCaps.supportsTypedUAVLoadAdditionalFormats       = false;
+    mRenderer11DeviceCaps.supportsRasterizerOrderViews                = false;
+    mRenderer11DeviceCaps.B5G6R5support                               = 0;
+    mRenderer11DeviceCaps.B4G4R4A4support                             = 0;
+    mRenderer11DeviceCaps.B5G5R5A1support                             = 0;
 
     mD3d11Module          = nullptr;
     mD3d12Module          = nullptr;
@@ -451,6 +472,13 @@ Renderer11::Renderer11(egl::Display *display)
     mDxgiAdapter    = nullptr;
     mDxgiFactory    = nullptr;
 
+    mMemoryBudgetTracker = display->getImplementation()->getMemoryBudgetTracker();
+
+    mStagingTexturePoolMemorySize = 0;
+    mStagingTexturePoolSerial     = 0;
+
+    mCachedResolveTextureSerial = 0;
+
     ZeroMemory(&mAdapterDescription, sizeof(mAdapterDescription));
 
     const auto &attributes = mDisplay->getAttributeMap();
@@ -662,6 +690,21 @@ egl::Error Renderer11::initialize()
             return egl::EglNotInitialized(D3D11_INIT_OTHER_ERROR)
                    << "Could not create DXGI factory.";
         }
+
+        // Publish the adapter's local video memory budget so that allocations can be accounted
+        // against it.  Pre-DXGI 1.4 adapters keep a budget of zero, which disables pressure
+        // reporting.
+        IDXGIAdapter3 *dxgiAdapter3 = d3d11::DynamicCastComObject<IDXGIAdapter3>(mDxgiAdapter);
+        if (dxgiAdapter3 != nullptr)
+        {
+            DXGI_QUERY_VIDEO_MEMORY_INFO videoMemoryInfo = {};
+            if (SUCCEEDED(dxgiAdapter3->QueryVideoMemoryInfo(0, DXGI_MEMORY_SEGMENT_GROUP_LOCAL,
+                                                             &videoMemoryInfo)))
+            {
+                mMemoryBudgetTracker->setBudget(videoMemoryInfo.Budget);
+            }
+        }
+        SafeRelease(dxgiAdapter3);
     }
 
     // Disable some spurious D3D11 debug warnings to prevent them from flooding the output log
@@ -1032,6 +1075,11 @@ egl::Error Renderer11::initializeDevice()
     // Gather stats on DXGI and D3D feature level
     ANGLE_HISTOGRAM_BOOLEAN("GPU.ANGLE.SupportsDXGI1_2", mRenderer11DeviceCaps.supportsDXGI1_2);
 
+    // Track how common driver-level command list support is, to gauge whether recording GL
+    // translation on deferred contexts would pay off in the field.
+    ANGLE_HISTOGRAM_BOOLEAN("GPU.ANGLE.D3D11SupportsDriverCommandLists",
+                            mRenderer11DeviceCaps.supportsDriverCommandLists);
+
     ANGLEFeatureLevel angleFeatureLevel = GetANGLEFeatureLevel(mRenderer11DeviceCaps.featureLevel);
 
     // We don't actually request a 11_1 device, because of complications with the platform
@@ -1065,6 +1113,17 @@ void Renderer11::populateRenderer11DeviceCaps()
         mRenderer11DeviceCaps.driverVersion = version;
     }
 
+    D3D11_FEATURE_DATA_THREADING threadingCaps = {};
+    hr = mDevice->CheckFeatureSupport(D3D11_FEATURE_THREADING, &threadingCaps,
+                                      sizeof(threadingCaps));
+    if (SUCCEEDED(hr))
+    {
+        mRenderer11DeviceCaps.supportsDriverCommandLists =
+            (threadingCaps.DriverCommandLists != FALSE);
+        mRenderer11DeviceCaps.supportsConcurrentCreates =
+            (threadingCaps.DriverConcurrentCreates != FALSE);
+    }
+
     if (mDeviceContext1)
     {
         D3D11_FEATURE_DATA_D3D11_OPTIONS d3d11Options;
@@ -1075,6 +1134,8 @@ void Renderer11::populateRenderer11DeviceCaps()
             mRenderer11DeviceCaps.supportsClearView = (d3d11Options.ClearView != FALSE);
             mRenderer11DeviceCaps.supportsConstantBufferOffsets =
                 (d3d11Options.ConstantBufferOffsetting != FALSE);
+            mRenderer11DeviceCaps.supportsMapNoOverwriteDynamicConstantBuffer =
+                (d3d11Options.MapNoOverwriteOnDynamicConstantBuffer != FALSE);
         }
     }
 
@@ -1339,6 +1400,10 @@ void Renderer11::generateDisplayExtensions(egl::DisplayExtensions *outExtensions
     // D3D11 does not support present with dirty rectangles until DXGI 1.2.
     outExtensions->postSubBuffer = mRenderer11DeviceCaps.supportsDXGI1_2;
 
+    // Waitable swap chains require flip-model presentation and DXGI 1.3; gate on the DXGI 1.2
+    // caps query and probe for IDXGISwapChain2 when the swap chain is created.
+    outExtensions->d3d11FrameLatency = mRenderer11DeviceCaps.supportsDXGI1_2;
+
     outExtensions->image                 = true;
     outExtensions->imageBase             = true;
     outExtensions->glTexture2DImage      = true;
@@ -1465,7 +1530,8 @@ NativeWindowD3D *Renderer11::createNativeWindow(EGLNativeWindowType window,
     {
         return new NativeWindow11Win32(
             window, config->alphaSize > 0,
-            attribs.get(EGL_DIRECT_COMPOSITION_ANGLE, EGL_FALSE) == EGL_TRUE);
+            attribs.get(EGL_DIRECT_COMPOSITION_ANGLE, EGL_FALSE) == EGL_TRUE,
+            static_cast<UINT>(attribs.get(EGL_D3D11_MAX_FRAME_LATENCY_ANGLE, 0)));
     }
 #endif
 
@@ -2193,7 +2259,10 @@ void Renderer11::releaseDeviceResources()
 
     mSyncQuery.reset();
 
-    mCachedResolveTexture.reset();
+    mCachedResolveTextures.clear();
+
+    mStagingTexturePool.clear();
+    mStagingTexturePoolMemorySize = 0;
 }
 
 // set notify to true to broadcast a message to all contexts of the device loss
@@ -3575,7 +3644,10 @@ angle::Result Renderer11::readFromAttachment(const gl::Context *context,
     gl::Buffer *packBuffer = context->getState().getTargetBuffer(gl::BufferBinding::PixelPack);
 
     PackPixelsParams packParams(safeArea, angleFormat, outputPitch, reverseRowOrder, packBuffer, 0);
-    return packPixels(context, stagingHelper, packParams, pixelsOut);
+    ANGLE_TRY(packPixels(context, stagingHelper, packParams, pixelsOut));
+
+    recycleStagingTexture(&stagingHelper);
+    return angle::Result::Continue;
 }
 
 angle::Result Renderer11::packPixels(const gl::Context *context,
@@ -3635,9 +3707,10 @@ angle::Result Renderer11::blitRenderbufferRect(const gl::Context *context,
     if (readRenderTarget->isMultisampled())
     {
         ANGLE_TRY(resolveMultisampledTexture(context, readRenderTarget11, depthBlit, stencilBlit,
-                                             &readTexture));
+                                             &readTexture, &readSRV));
 
-        if (!stencilBlit)
+        // Color resolves return a cached SRV; depth resolves need one created here.
+        if (!stencilBlit && !readSRV.valid())
         {
             const auto &readFormatSet = readTexture.getFormatSet();
 
@@ -3930,11 +4003,57 @@ void Renderer11::onBufferDelete(const Buffer11 *deleted)
     mAliveBuffers.erase(deleted);
 }
 
+void Renderer11::onPendingQuery(Query11 *query)
+{
+    if (!query->mListedInQuerySweep)
+    {
+        query->mListedInQuerySweep = true;
+        mPendingQuerySweepList.push_back(query);
+    }
+}
+
+void Renderer11::onQueryDeleted(Query11 *query)
+{
+    if (query->mListedInQuerySweep)
+    {
+        auto it = std::find(mPendingQuerySweepList.begin(), mPendingQuerySweepList.end(), query);
+        ASSERT(it != mPendingQuerySweepList.end());
+        mPendingQuerySweepList.erase(it);
+        query->mListedInQuerySweep = false;
+    }
+}
+
+angle::Result Renderer11::sweepPendingQueries(d3d::Context *context)
+{
+    size_t resolvedCount = 0;
+    for (Query11 *query : mPendingQuerySweepList)
+    {
+        ANGLE_TRY(query->pollPendingResults(context));
+        if (query->hasPendingResults())
+        {
+            // Queries complete in submission order on the immediate context; once the GPU hasn't
+            // reached this one, polling the rest would only burn GetData calls.
+            break;
+        }
+        resolvedCount++;
+    }
+
+    for (size_t i = 0; i < resolvedCount; ++i)
+    {
+        mPendingQuerySweepList[i]->mListedInQuerySweep = false;
+    }
+    mPendingQuerySweepList.erase(mPendingQuerySweepList.begin(),
+                                 mPendingQuerySweepList.begin() + resolvedCount);
+
+    return angle::Result::Continue;
+}
+
 angle::Result Renderer11::resolveMultisampledTexture(const gl::Context *context,
                                                      RenderTarget11 *renderTarget,
                                                      bool depth,
                                                      bool stencil,
-                                                     TextureHelper11 *textureOut)
+                                                     TextureHelper11 *textureOut,
+                                                     d3d11::SharedSRV *srvOut)
 {
     if (depth && !stencil)
     {
@@ -3956,11 +4075,33 @@ angle::Result Renderer11::resolveMultisampledTexture(const gl::Context *context,
     ASSERT(sourceSRVDesc.ViewDimension == D3D_SRV_DIMENSION_TEXTURE2DMS ||
            sourceSRVDesc.ViewDimension == D3D_SRV_DIMENSION_TEXTURE2DMSARRAY);
 
-    if (!mCachedResolveTexture.valid() ||
-        mCachedResolveTexture.getExtents().width != renderTarget->getWidth() ||
-        mCachedResolveTexture.getExtents().height != renderTarget->getHeight() ||
-        mCachedResolveTexture.getFormat() != formatSet.texFormat)
+    CachedResolveTexture *entry = nullptr;
+    for (CachedResolveTexture &candidate : mCachedResolveTextures)
     {
+        if (candidate.texture.getExtents().width == renderTarget->getWidth() &&
+            candidate.texture.getExtents().height == renderTarget->getHeight() &&
+            candidate.texture.getFormat() == formatSet.texFormat)
+        {
+            entry = &candidate;
+            break;
+        }
+    }
+
+    if (!entry)
+    {
+        if (mCachedResolveTextures.size() >= kMaxCachedResolveTextures)
+        {
+            auto oldestIt = mCachedResolveTextures.begin();
+            for (auto it = oldestIt + 1; it != mCachedResolveTextures.end(); ++it)
+            {
+                if (it->lastUsedSerial < oldestIt->lastUsedSerial)
+                {
+                    oldestIt = it;
+                }
+            }
+            mCachedResolveTextures.erase(oldestIt);
+        }
+
         D3D11_TEXTURE2D_DESC resolveDesc;
         resolveDesc.Width              = renderTarget->getWidth();
         resolveDesc.Height             = renderTarget->getHeight();
@@ -3974,14 +4115,31 @@ angle::Result Renderer11::resolveMultisampledTexture(const gl::Context *context,
         resolveDesc.CPUAccessFlags     = 0;
         resolveDesc.MiscFlags          = 0;
 
+        CachedResolveTexture newEntry;
+        newEntry.lastUsedSerial = 0;
         ANGLE_TRY(allocateTexture(GetImplAs<Context11>(context), resolveDesc, formatSet,
-                                  &mCachedResolveTexture));
+                                  &newEntry.texture));
+
+        D3D11_SHADER_RESOURCE_VIEW_DESC viewDesc;
+        viewDesc.Format                    = formatSet.srvFormat;
+        viewDesc.ViewDimension             = D3D11_SRV_DIMENSION_TEXTURE2D;
+        viewDesc.Texture2D.MipLevels       = 1;
+        viewDesc.Texture2D.MostDetailedMip = 0;
+
+        ANGLE_TRY(allocateResource(GetImplAs<Context11>(context), viewDesc, newEntry.texture.get(),
+                                   &newEntry.srv));
+
+        mCachedResolveTextures.push_back(std::move(newEntry));
+        entry = &mCachedResolveTextures.back();
     }
 
-    mDeviceContext->ResolveSubresource(mCachedResolveTexture.get(), 0,
+    entry->lastUsedSerial = ++mCachedResolveTextureSerial;
+
+    mDeviceContext->ResolveSubresource(entry->texture.get(), 0,
                                        renderTarget->getTexture().get(),
                                        renderTarget->getSubresourceIndex(), formatSet.texFormat);
-    *textureOut = mCachedResolveTexture;
+    *textureOut = entry->texture;
+    *srvOut     = entry->srv.makeCopy();
     return angle::Result::Continue;
 }
 
@@ -4205,6 +4363,13 @@ angle::Result Renderer11::createStagingTexture(const gl::Context *context,
             stagingDesc.CPUAccessFlags |= D3D11_CPU_ACCESS_WRITE;
         }
 
+        if (findPooledStagingTexture(textureType, formatSet,
+                                     gl::Extents(size.width, size.height, 1),
+                                     stagingDesc.MipLevels, stagingDesc.CPUAccessFlags, textureOut))
+        {
+            return angle::Result::Continue;
+        }
+
         ANGLE_TRY(allocateTexture(context11, stagingDesc, formatSet, textureOut));
         return angle::Result::Continue;
     }
@@ -4221,10 +4386,99 @@ angle::Result Renderer11::createStagingTexture(const gl::Context *context,
     stagingDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
     stagingDesc.MiscFlags      = 0;
 
+    if (findPooledStagingTexture(textureType, formatSet, gl::Extents(size.width, size.height, 1),
+                                 stagingDesc.MipLevels, stagingDesc.CPUAccessFlags, textureOut))
+    {
+        return angle::Result::Continue;
+    }
+
     ANGLE_TRY(allocateTexture(context11, stagingDesc, formatSet, textureOut));
     return angle::Result::Continue;
 }
 
+bool Renderer11::findPooledStagingTexture(ResourceType textureType,
+                                          const d3d11::Format &formatSet,
+                                          const gl::Extents &size,
+                                          UINT mipLevels,
+                                          UINT cpuAccessFlags,
+                                          TextureHelper11 *textureOut)
+{
+    for (auto it = mStagingTexturePool.begin(); it != mStagingTexturePool.end(); ++it)
+    {
+        if (it->texture.getTextureType() != textureType ||
+            &it->texture.getFormatSet() != &formatSet || it->texture.getExtents() != size ||
+            it->mipLevels != mipLevels || it->cpuAccessFlags != cpuAccessFlags)
+        {
+            continue;
+        }
+
+        *textureOut = std::move(it->texture);
+        mStagingTexturePoolMemorySize -= it->memorySize;
+        mStagingTexturePool.erase(it);
+        return true;
+    }
+
+    return false;
+}
+
+void Renderer11::recycleStagingTexture(TextureHelper11 *texture)
+{
+    if (!texture->valid())
+    {
+        return;
+    }
+
+    UINT mipLevels      = 0;
+    UINT cpuAccessFlags = 0;
+    DXGI_FORMAT format  = DXGI_FORMAT_UNKNOWN;
+
+    if (texture->is2D())
+    {
+        D3D11_TEXTURE2D_DESC desc;
+        texture->getDesc(&desc);
+        ASSERT(desc.Usage == D3D11_USAGE_STAGING);
+        ASSERT(desc.ArraySize == 1);
+        mipLevels      = desc.MipLevels;
+        cpuAccessFlags = desc.CPUAccessFlags;
+        format         = desc.Format;
+    }
+    else
+    {
+        ASSERT(texture->is3D());
+        D3D11_TEXTURE3D_DESC desc;
+        texture->getDesc(&desc);
+        ASSERT(desc.Usage == D3D11_USAGE_STAGING);
+        mipLevels      = desc.MipLevels;
+        cpuAccessFlags = desc.CPUAccessFlags;
+        format         = desc.Format;
+    }
+
+    PooledStagingTexture entry;
+    entry.texture        = std::move(*texture);
+    entry.mipLevels      = mipLevels;
+    entry.cpuAccessFlags = cpuAccessFlags;
+    entry.memorySize = EstimateStagingTextureMemory(format, entry.texture.getExtents(), mipLevels);
+    entry.lastUsedSerial = ++mStagingTexturePoolSerial;
+    mStagingTexturePoolMemorySize += entry.memorySize;
+    mStagingTexturePool.push_back(std::move(entry));
+
+    // Trim least-recently-used entries down to the pool limits.
+    while (mStagingTexturePool.size() > kMaxPooledStagingTextures ||
+           mStagingTexturePoolMemorySize > kMaxPooledStagingTextureMemory)
+    {
+        auto lruIt = mStagingTexturePool.begin();
+        for (auto it = lruIt + 1; it != mStagingTexturePool.end(); ++it)
+        {
+            if (it->lastUsedSerial < lruIt->lastUsedSerial)
+            {
+                lruIt = it;
+            }
+        }
+        mStagingTexturePoolMemorySize -= lruIt->memorySize;
+        mStagingTexturePool.erase(lruIt);
+    }
+}
+
 angle::Result Renderer11::allocateTexture(d3d::Context *context,
                                           const D3D11_TEXTURE2D_DESC &desc,
                                           const d3d11::Format &format,
@@ -36,8 +36,10 @@ class Buffer11;
 class Clear11;
 class Context11;
 class IndexDataManager;
+class MemoryBudgetTracker;
 struct PackPixelsParams;
 class PixelTransfer11;
+class Query11;
 class RenderTarget11;
 class StreamingIndexBufferInterface;
 class Trim11;
@@ -51,6 +53,13 @@ struct Renderer11DeviceCaps
     bool supportsDXGI1_2;                         // Support for DXGI 1.2
     bool supportsClearView;                       // Support for ID3D11DeviceContext1::ClearView
     bool supportsConstantBufferOffsets;           // Support for Constant buffer offset
+    bool supportsMapNoOverwriteDynamicConstantBuffer;  // Support for NO_OVERWRITE maps on dynamic
+                                                       // constant buffers
+    bool supportsDriverCommandLists;   // Driver-level support for deferred context command lists;
+                                       // without it the runtime emulates deferred recording in
+                                       // software and it costs more CPU than it saves
+    bool supportsConcurrentCreates;    // Driver-level support for lock-free resource creation
+                                       // from worker threads
     bool supportsVpRtIndexWriteFromVertexShader;  // VP/RT can be selected in the Vertex Shader
                                                   // stage.
     bool supportsMultisampledDepthStencilSRVs;   // D3D feature level 10.0 no longer allows creation
@@ -305,6 +314,7 @@ class Renderer11 : public RendererD3D
     ID3D11DeviceContext *getDeviceContext() { return mDeviceContext; }
     ID3D11DeviceContext1 *getDeviceContext1IfSupported() { return mDeviceContext1; }
     IDXGIFactory *getDxgiFactory() { return mDxgiFactory; }
+    MemoryBudgetTracker *getMemoryBudgetTracker() const { return mMemoryBudgetTracker; }
 
     angle::Result getBlendState(const gl::Context *context,
                                 const d3d11::BlendStateKey &key,
@@ -387,6 +397,13 @@ class Renderer11 : public RendererD3D
     void onBufferCreate(const Buffer11 *created);
     void onBufferDelete(const Buffer11 *deleted);
 
+    // Batched query resolution. Queries register themselves when they have pending results;
+    // sweepPendingQueries polls them all in submission order so that the first query readback of
+    // a frame resolves every finished query in one pass.
+    void onPendingQuery(Query11 *query);
+    void onQueryDeleted(Query11 *query);
+    angle::Result sweepPendingQueries(d3d::Context *context);
+
     DeviceImpl *createEGLDevice() override;
 
     angle::Result drawArrays(const gl::Context *context,
@@ -432,6 +449,18 @@ class Renderer11 : public RendererD3D
                                        StagingAccess readAndWriteAccess,
                                        TextureHelper11 *textureOut);
 
+    // Takes a matching staging texture out of the reuse pool, if one is available.
+    bool findPooledStagingTexture(ResourceType textureType,
+                                  const d3d11::Format &formatSet,
+                                  const gl::Extents &size,
+                                  UINT mipLevels,
+                                  UINT cpuAccessFlags,
+                                  TextureHelper11 *textureOut);
+
+    // Returns a staging texture to the reuse pool and resets |texture|.  Invalid textures are
+    // ignored, so callers may recycle unconditionally on their success paths.
+    void recycleStagingTexture(TextureHelper11 *texture);
+
     template <typename DescT, typename ResourceT>
     angle::Result allocateResource(d3d::Context *context, const DescT &desc, ResourceT *resourceOut)
     {
@@ -524,11 +553,14 @@ class Renderer11 : public RendererD3D
                                   int baseVertex,
                                   int instances);
 
+    // For color resolves |srvOut| receives a cached blit SRV of the resolved texture; depth and
+    // stencil resolves leave it invalid and the caller creates any view it needs.
     angle::Result resolveMultisampledTexture(const gl::Context *context,
                                              RenderTarget11 *renderTarget,
                                              bool depth,
                                              bool stencil,
-                                             TextureHelper11 *textureOut);
+                                             TextureHelper11 *textureOut,
+                                             d3d11::SharedSRV *srvOut);
 
     void populateRenderer11DeviceCaps();
 
@@ -611,6 +643,7 @@ class Renderer11 : public RendererD3D
     ID3D11DeviceContext1 *mDeviceContext1;
     ID3D11DeviceContext3 *mDeviceContext3;
     IDXGIAdapter *mDxgiAdapter;
+    MemoryBudgetTracker *mMemoryBudgetTracker;
     DXGI_ADAPTER_DESC mAdapterDescription;
     char mDescription[128];
     IDXGIFactory *mDxgiFactory;
@@ -625,7 +658,35 @@ class Renderer11 : public RendererD3D
     mutable Optional<bool> mSupportsShareHandles;
     ResourceManager11 mResourceManager11;
 
-    TextureHelper11 mCachedResolveTexture;
+    // Resolved copies of multisampled color sources used by blitRenderbufferRect, retained with
+    // their blit SRVs.  Keyed by format and size so that blitting between several surface pairs
+    // every frame stays allocation-free; trimmed least-recently-used first.
+    struct CachedResolveTexture
+    {
+        TextureHelper11 texture;
+        d3d11::SharedSRV srv;
+        uint64_t lastUsedSerial;
+    };
+    std::vector<CachedResolveTexture> mCachedResolveTextures;
+    uint64_t mCachedResolveTextureSerial;
+
+    // Staging textures recycled by upload and readback paths.  Steady-state streaming hits the
+    // pool instead of paying for CreateTexture2D on every update.  Trimmed least-recently-used
+    // first when it outgrows its entry or memory budget.
+    struct PooledStagingTexture
+    {
+        TextureHelper11 texture;
+        UINT mipLevels;
+        UINT cpuAccessFlags;
+        uint64_t memorySize;
+        uint64_t lastUsedSerial;
+    };
+    std::vector<PooledStagingTexture> mStagingTexturePool;
+    uint64_t mStagingTexturePoolMemorySize;
+    uint64_t mStagingTexturePoolSerial;
+
+    // Queries with unresolved results, in the order their first pending query was submitted.
+    std::vector<Query11 *> mPendingQuerySweepList;
 };
 
 }  // namespace rx
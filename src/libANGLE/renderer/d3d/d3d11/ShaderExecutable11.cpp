@@ -89,7 +89,11 @@ const d3d11::ComputeShader &ShaderExecutable11::getComputeShader() const
 }
 
 UniformStorage11::UniformStorage11(size_t initialSize)
-    : UniformStorageD3D(initialSize), mConstantBuffer()
+    : UniformStorageD3D(initialSize),
+      mConstantBuffer(),
+      mRingGeneration(0),
+      mRingFirstConstant(0),
+      mRingNumConstants(0)
 {}
 
 UniformStorage11::~UniformStorage11() {}
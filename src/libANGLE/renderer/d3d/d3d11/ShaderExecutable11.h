@@ -60,8 +60,23 @@ class UniformStorage11 : public UniformStorageD3D
                                     Renderer11 *renderer,
                                     const d3d11::Buffer **bufferOut);
 
+    // Tracks where the data was last copied into StateManager11's uniform ring buffer.  The
+    // copy becomes stale once the ring wraps and moves on to the next generation.
+    void setRingCopy(unsigned int generation, unsigned int firstConstant, unsigned int numConstants)
+    {
+        mRingGeneration    = generation;
+        mRingFirstConstant = firstConstant;
+        mRingNumConstants  = numConstants;
+    }
+    bool hasValidRingCopy(unsigned int generation) const { return mRingGeneration == generation; }
+    unsigned int getRingFirstConstant() const { return mRingFirstConstant; }
+    unsigned int getRingNumConstants() const { return mRingNumConstants; }
+
   private:
     d3d11::Buffer mConstantBuffer;
+    unsigned int mRingGeneration;
+    unsigned int mRingFirstConstant;
+    unsigned int mRingNumConstants;
 };
 
 }  // namespace rx
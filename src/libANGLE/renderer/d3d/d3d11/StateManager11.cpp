@@ -13,6 +13,7 @@
 #include "common/mathutil.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/Overlay.h"
 #include "libANGLE/Query.h"
 #include "libANGLE/Surface.h"
 #include "libANGLE/VertexArray.h"
@@ -227,6 +228,11 @@ void UpdateUniformBuffer(ID3D11DeviceContext *deviceContext,
                                      0);
 }
 
+// Size of the shared default-uniform ring buffer.  Large enough that sequential draws rarely wrap
+// within a frame; each slice is aligned to the 256-byte offset granularity of
+// *SetConstantBuffers1.
+constexpr unsigned int kUniformRingBufferSize = 1024 * 1024;
+
 size_t GetReservedBufferCount(bool usesPointSpriteEmulation)
 {
     return usesPointSpriteEmulation ? 1 : 0;
@@ -783,6 +789,16 @@ StateManager11::StateManager11(Renderer11 *renderer)
     mCurrentVertexBuffers.fill(nullptr);
     mCurrentVertexStrides.fill(std::numeric_limits<UINT>::max());
     mCurrentVertexOffsets.fill(std::numeric_limits<UINT>::max());
+
+    for (gl::RangeUI &dirtySRVRange : mDirtySRVRange)
+    {
+        dirtySRVRange.invalidate();
+    }
+    mSetShaderResourcesCalls.fill(0);
+
+    mUniformRingOffset = 0;
+    // Storages start at generation 0, so their initial ring copies are invalid.
+    mUniformRingGeneration = 1;
 }
 
 StateManager11::~StateManager11() {}
@@ -796,41 +812,80 @@ void StateManager11::setShaderResourceInternal(gl::ShaderType shaderType,
     ASSERT(static_cast<size_t>(resourceSlot) < currentSRVs->size());
     const ViewRecord<D3D11_SHADER_RESOURCE_VIEW_DESC> &record = (*currentSRVs)[resourceSlot];
 
-    if (record.view != reinterpret_cast<uintptr_t>(srv))
+    ID3D11ShaderResourceView *srvPtr = srv ? srv->get() : nullptr;
+    if (record.view != reinterpret_cast<uintptr_t>(srvPtr))
     {
-        ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
-        ID3D11ShaderResourceView *srvPtr   = srv ? srv->get() : nullptr;
         if (srvPtr)
         {
             uintptr_t resource = reinterpret_cast<uintptr_t>(GetViewResource(srvPtr));
             unsetConflictingUAVs(gl::PipelineType::GraphicsPipeline, gl::ShaderType::Compute,
                                  resource, nullptr);
-        }
-
-        switch (shaderType)
-        {
-            case gl::ShaderType::Vertex:
-                deviceContext->VSSetShaderResources(resourceSlot, 1, &srvPtr);
-                break;
-            case gl::ShaderType::Fragment:
-                deviceContext->PSSetShaderResources(resourceSlot, 1, &srvPtr);
-                break;
-            case gl::ShaderType::Compute:
+            if (shaderType == gl::ShaderType::Compute)
             {
-                if (srvPtr)
-                {
-                    uintptr_t resource = reinterpret_cast<uintptr_t>(GetViewResource(srvPtr));
-                    unsetConflictingRTVs(resource);
-                }
-                deviceContext->CSSetShaderResources(resourceSlot, 1, &srvPtr);
-                break;
+                unsetConflictingRTVs(resource);
             }
-            default:
-                UNREACHABLE();
         }
 
+        // The view is not applied until applyShaderResourceChanges flushes the dirty slot range
+        // of the stage with a single *SSetShaderResources call.
         currentSRVs->update(resourceSlot, srvPtr);
+        mDirtySRVRange[shaderType].extend(resourceSlot);
+    }
+}
+
+void StateManager11::applyShaderResourceChanges(gl::ShaderType shaderType)
+{
+    gl::RangeUI &dirtyRange = mDirtySRVRange[shaderType];
+    if (dirtyRange.empty())
+    {
+        return;
+    }
+
+    const SRVCache &currentSRVs = mCurShaderSRVs[shaderType];
+    ASSERT(static_cast<size_t>(dirtyRange.high()) <= currentSRVs.size());
+
+    const UINT start = static_cast<UINT>(dirtyRange.low());
+    const UINT count = static_cast<UINT>(dirtyRange.length());
+    ASSERT(count <= mScratchSRVs.size());
+    for (UINT slot = 0; slot < count; ++slot)
+    {
+        mScratchSRVs[slot] =
+            reinterpret_cast<ID3D11ShaderResourceView *>(currentSRVs[start + slot].view);
+    }
+
+    ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
+    switch (shaderType)
+    {
+        case gl::ShaderType::Vertex:
+            deviceContext->VSSetShaderResources(start, count, mScratchSRVs.data());
+            break;
+        case gl::ShaderType::Fragment:
+            deviceContext->PSSetShaderResources(start, count, mScratchSRVs.data());
+            break;
+        case gl::ShaderType::Compute:
+            deviceContext->CSSetShaderResources(start, count, mScratchSRVs.data());
+            break;
+        default:
+            UNREACHABLE();
+    }
+
+    ++mSetShaderResourcesCalls[shaderType];
+    dirtyRange.invalidate();
+}
+
+void StateManager11::updateOverlay(const gl::Context *context)
+{
+    const gl::OverlayType *overlay = context->getState().getOverlay();
+    if (overlay->isEnabled())
+    {
+        overlay->getCountWidget(gl::WidgetId::D3D11SetShaderResourcesVertex)
+            ->add(mSetShaderResourcesCalls[gl::ShaderType::Vertex]);
+        overlay->getCountWidget(gl::WidgetId::D3D11SetShaderResourcesFragment)
+            ->add(mSetShaderResourcesCalls[gl::ShaderType::Fragment]);
+        overlay->getCountWidget(gl::WidgetId::D3D11SetShaderResourcesCompute)
+            ->add(mSetShaderResourcesCalls[gl::ShaderType::Compute]);
     }
+    mSetShaderResourcesCalls.fill(0);
 }
 
 template <typename UAVType>
@@ -961,6 +1016,8 @@ angle::Result StateManager11::updateStateForCompute(const gl::Context *context,
         }
     }
 
+    updateOverlay(context);
+
     return angle::Result::Continue;
 }
 
@@ -1861,6 +1918,9 @@ void StateManager11::unsetConflictingSRVs(gl::PipelineType pipeline,
         }
     }
 
+    // Unbind the conflicting views before the caller touches the resource from the other side.
+    applyShaderResourceChanges(shaderType);
+
     if (foundOne && (pipeline != conflictPipeline || isRenderTarget))
     {
         switch (conflictPipeline)
@@ -1981,6 +2041,9 @@ angle::Result StateManager11::ensureInitialized(const gl::Context *context)
     // Initialize cached NULL SRV block
     mNullSRVs.resize(caps.maxShaderTextureImageUnits[gl::ShaderType::Fragment], nullptr);
 
+    // Large enough for any dirty slot range, no matter which stage's cache it came from.
+    mScratchSRVs.resize(D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT, nullptr);
+
     mNullUAVs.resize(caps.maxImageUnits, nullptr);
 
     mCurrentValueAttribs.resize(caps.maxVertexAttributes);
@@ -2016,6 +2079,11 @@ void StateManager11::deinitialize()
 
     mPointSpriteVertexBuffer.reset();
     mPointSpriteIndexBuffer.reset();
+
+    mUniformRingBuffer.reset();
+    mUniformRingOffset = 0;
+    // Invalidate every storage's ring copy along with the buffer.
+    ++mUniformRingGeneration;
 }
 
 // Applies the render target surface, depth stencil surface, viewport rectangle and
@@ -2402,6 +2470,8 @@ angle::Result StateManager11::updateState(const gl::Context *context,
     // DIRTY_BIT_COMPUTE_SRVUAV_STATE dirty bit.
     ASSERT((mInternalDirtyBits & mGraphicsDirtyBitsMask).none());
 
+    updateOverlay(context);
+
     return angle::Result::Continue;
 }
 
@@ -2410,6 +2480,7 @@ void StateManager11::setShaderResourceShared(gl::ShaderType shaderType,
                                              const d3d11::SharedSRV *srv)
 {
     setShaderResourceInternal(shaderType, resourceSlot, srv);
+    applyShaderResourceChanges(shaderType);
 
     // TODO(jmadill): Narrower dirty region.
     mInternalDirtyBits.set(DIRTY_BIT_TEXTURE_AND_SAMPLER_STATE);
@@ -2420,6 +2491,7 @@ void StateManager11::setShaderResource(gl::ShaderType shaderType,
                                        const d3d11::ShaderResourceView *srv)
 {
     setShaderResourceInternal(shaderType, resourceSlot, srv);
+    applyShaderResourceChanges(shaderType);
 
     // TODO(jmadill): Narrower dirty region.
     mInternalDirtyBits.set(DIRTY_BIT_TEXTURE_AND_SAMPLER_STATE);
@@ -2640,6 +2712,7 @@ void StateManager11::setSimplePixelTextureAndSampler(const d3d11::SharedSRV &srv
     ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
 
     setShaderResourceInternal(gl::ShaderType::Fragment, 0, &srv);
+    applyShaderResourceChanges(gl::ShaderType::Fragment);
     deviceContext->PSSetSamplers(0, 1, samplerState.getPointer());
 
     mInternalDirtyBits.set(DIRTY_BIT_TEXTURE_AND_SAMPLER_STATE);
@@ -2857,6 +2930,9 @@ angle::Result StateManager11::applyTexturesForSRVs(const gl::Context *context,
         ANGLE_TRY(setTextureForImage(context, shaderType, readonlyImageIndex, imageUnit));
     }
 
+    // Commit the accumulated SRV changes of this stage in one call.
+    applyShaderResourceChanges(shaderType);
+
     return angle::Result::Continue;
 }
 
@@ -3398,6 +3474,61 @@ angle::Result StateManager11::generateSwizzles(const gl::Context *context)
     return angle::Result::Continue;
 }
 
+bool StateManager11::canUseUniformRingBuffer() const
+{
+    // Both the offset binding and NO_OVERWRITE maps on constant buffers require the D3D 11.1
+    // runtime, and each is reported by its own feature bit.
+    const Renderer11DeviceCaps &deviceCaps = mRenderer->getRenderer11DeviceCaps();
+    return mRenderer->getDeviceContext1IfSupported() != nullptr &&
+           deviceCaps.supportsConstantBufferOffsets &&
+           deviceCaps.supportsMapNoOverwriteDynamicConstantBuffer;
+}
+
+angle::Result StateManager11::updateUniformRingBuffer(const gl::Context *context,
+                                                      UniformStorage11 *storage)
+{
+    ASSERT(canUseUniformRingBuffer());
+    ASSERT(storage->size() > 0 && storage->size() <= kUniformRingBufferSize);
+
+    if (!mUniformRingBuffer.valid())
+    {
+        D3D11_BUFFER_DESC desc = {};
+        desc.ByteWidth         = kUniformRingBufferSize;
+        desc.Usage             = D3D11_USAGE_DYNAMIC;
+        desc.BindFlags         = D3D11_BIND_CONSTANT_BUFFER;
+        desc.CPUAccessFlags    = D3D11_CPU_ACCESS_WRITE;
+
+        ANGLE_TRY(
+            mRenderer->allocateResource(GetImplAs<Context11>(context), desc, &mUniformRingBuffer));
+        mUniformRingOffset = 0;
+    }
+
+    // firstConstant must be a multiple of 16 constants of 16 bytes each, so slices are aligned
+    // to 256 bytes.
+    const unsigned int alignedSize = roundUpPow2(static_cast<unsigned int>(storage->size()), 256u);
+
+    D3D11_MAP mapType = D3D11_MAP_WRITE_NO_OVERWRITE;
+    if (mUniformRingOffset + alignedSize > kUniformRingBufferSize)
+    {
+        // The ring is full; orphan its contents instead of synchronizing with the GPU.  Copies
+        // from earlier generations become stale and are rewritten on their next use.
+        mUniformRingOffset = 0;
+        ++mUniformRingGeneration;
+        mapType = D3D11_MAP_WRITE_DISCARD;
+    }
+
+    D3D11_MAPPED_SUBRESOURCE mapping = {};
+    ANGLE_TRY(mRenderer->mapResource(context, mUniformRingBuffer.get(), 0, mapType, 0, &mapping));
+    memcpy(static_cast<uint8_t *>(mapping.pData) + mUniformRingOffset,
+           storage->getDataPointer(0, 0), storage->size());
+    mRenderer->getDeviceContext()->Unmap(mUniformRingBuffer.get(), 0);
+
+    storage->setRingCopy(mUniformRingGeneration, mUniformRingOffset / 16, alignedSize / 16);
+    mUniformRingOffset += alignedSize;
+
+    return angle::Result::Continue;
+}
+
 angle::Result StateManager11::applyUniformsForShader(const gl::Context *context,
                                                      gl::ShaderType shaderType)
 {
@@ -3407,6 +3538,53 @@ angle::Result StateManager11::applyUniformsForShader(const gl::Context *context,
 
     ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
 
+    unsigned int slot = d3d11::RESERVED_CONSTANT_BUFFER_SLOT_DEFAULT_UNIFORM_BLOCK;
+
+    if (shaderUniformStorage->size() > 0 && canUseUniformRingBuffer() &&
+        (shaderType == gl::ShaderType::Vertex || shaderType == gl::ShaderType::Fragment))
+    {
+        if (mProgramD3D->areShaderUniformsDirty(shaderType) ||
+            !shaderUniformStorage->hasValidRingCopy(mUniformRingGeneration))
+        {
+            ANGLE_TRY(updateUniformRingBuffer(context, shaderUniformStorage));
+        }
+
+        const UINT firstConstant = shaderUniformStorage->getRingFirstConstant();
+        const UINT numConstants  = shaderUniformStorage->getRingNumConstants();
+        const GLintptr offset    = static_cast<GLintptr>(firstConstant) * 16;
+        const GLsizeiptr size    = static_cast<GLsizeiptr>(numConstants) * 16;
+
+        ID3D11DeviceContext1 *deviceContext1 = mRenderer->getDeviceContext1IfSupported();
+        if (shaderType == gl::ShaderType::Vertex)
+        {
+            if (mCurrentConstantBufferVS[slot] != mUniformRingBuffer.getSerial() ||
+                mCurrentConstantBufferVSOffset[slot] != offset ||
+                mCurrentConstantBufferVSSize[slot] != size)
+            {
+                deviceContext1->VSSetConstantBuffers1(slot, 1, mUniformRingBuffer.getPointer(),
+                                                      &firstConstant, &numConstants);
+                mCurrentConstantBufferVS[slot]       = mUniformRingBuffer.getSerial();
+                mCurrentConstantBufferVSOffset[slot] = offset;
+                mCurrentConstantBufferVSSize[slot]   = size;
+            }
+        }
+        else
+        {
+            if (mCurrentConstantBufferPS[slot] != mUniformRingBuffer.getSerial() ||
+                mCurrentConstantBufferPSOffset[slot] != offset ||
+                mCurrentConstantBufferPSSize[slot] != size)
+            {
+                deviceContext1->PSSetConstantBuffers1(slot, 1, mUniformRingBuffer.getPointer(),
+                                                      &firstConstant, &numConstants);
+                mCurrentConstantBufferPS[slot]       = mUniformRingBuffer.getSerial();
+                mCurrentConstantBufferPSOffset[slot] = offset;
+                mCurrentConstantBufferPSSize[slot]   = size;
+            }
+        }
+
+        return angle::Result::Continue;
+    }
+
     const d3d11::Buffer *shaderConstantBuffer = nullptr;
     ANGLE_TRY(shaderUniformStorage->getConstantBuffer(context, mRenderer, &shaderConstantBuffer));
 
@@ -3415,8 +3593,6 @@ angle::Result StateManager11::applyUniformsForShader(const gl::Context *context,
         UpdateUniformBuffer(deviceContext, shaderUniformStorage, shaderConstantBuffer);
     }
 
-    unsigned int slot = d3d11::RESERVED_CONSTANT_BUFFER_SLOT_DEFAULT_UNIFORM_BLOCK;
-
     switch (shaderType)
     {
         case gl::ShaderType::Vertex:
@@ -3746,6 +3922,8 @@ angle::Result StateManager11::syncUniformBuffersForShader(const gl::Context *con
         setShaderResourceInternal(shaderType, cache.registerIndex, bufferSRV);
     }
 
+    applyShaderResourceChanges(shaderType);
+
     return angle::Result::Continue;
 }
 
@@ -26,6 +26,7 @@ class DisplayD3D;
 class Framebuffer11;
 struct RenderTargetDesc;
 struct Renderer11DeviceCaps;
+class UniformStorage11;
 class VertexArray11;
 
 class ShaderConstants11 : angle::NonCopyable
@@ -320,6 +321,13 @@ class StateManager11 final : angle::NonCopyable
                                    UINT resourceSlot,
                                    const SRVType *srv);
 
+    // Flushes the dirty SRV slots of a shader stage with a single *SSetShaderResources call
+    // covering the smallest contiguous slot range.
+    void applyShaderResourceChanges(gl::ShaderType shaderType);
+
+    // Adds the per-stage *SSetShaderResources call counts to the overlay and resets them.
+    void updateOverlay(const gl::Context *context);
+
     struct UAVList
     {
         UAVList(size_t size) : data(size) {}
@@ -414,6 +422,11 @@ class StateManager11 final : angle::NonCopyable
     angle::Result applyUniforms(const gl::Context *context);
     angle::Result applyUniformsForShader(const gl::Context *context, gl::ShaderType shaderType);
 
+    // Default uniforms can be sub-allocated from a shared ring buffer and bound with
+    // *SetConstantBuffers1 offsets instead of updating a per-program buffer every draw.
+    bool canUseUniformRingBuffer() const;
+    angle::Result updateUniformRingBuffer(const gl::Context *context, UniformStorage11 *storage);
+
     angle::Result getUAVsForShaderStorageBuffers(const gl::Context *context,
                                                  gl::ShaderType shaderType,
                                                  UAVList *uavList);
@@ -597,6 +610,15 @@ class StateManager11 final : angle::NonCopyable
 
     SRVCache *getSRVCache(gl::ShaderType shaderType);
 
+    // SRV slots that have changed since the last flush, and how many *SSetShaderResources calls
+    // each stage has issued since the overlay was last updated.
+    gl::ShaderMap<gl::RangeUI> mDirtySRVRange;
+    gl::ShaderMap<uint32_t> mSetShaderResourcesCalls;
+
+    // Scratch block used to build the contiguous view list for a flush, cached so we don't
+    // re-allocate every draw call
+    std::vector<ID3D11ShaderResourceView *> mScratchSRVs;
+
     // A block of NULL pointers, cached so we don't re-allocate every draw call
     std::vector<ID3D11ShaderResourceView *> mNullSRVs;
     std::vector<ID3D11UnorderedAccessView *> mNullUAVs;
@@ -654,6 +676,13 @@ class StateManager11 final : angle::NonCopyable
     ResourceSerial mCurrentComputeConstantBuffer;
     ResourceSerial mCurrentGeometryConstantBuffer;
 
+    // A large persistent ring of default-uniform data shared by all programs.  Sequential draws
+    // advance an offset into the ring instead of renaming a per-program buffer; the generation
+    // bumps whenever the ring wraps and its previous contents are orphaned.
+    d3d11::Buffer mUniformRingBuffer;
+    unsigned int mUniformRingOffset;
+    unsigned int mUniformRingGeneration;
+
     d3d11::Buffer mPointSpriteVertexBuffer;
     d3d11::Buffer mPointSpriteIndexBuffer;
 
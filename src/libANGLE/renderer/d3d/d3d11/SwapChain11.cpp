@@ -71,6 +71,7 @@ SwapChain11::SwapChain11(Renderer11 *renderer,
       mFirstSwap(true),
       mSwapChain(nullptr),
       mSwapChain1(nullptr),
+      mFrameLatencyWaitableObject(nullptr),
       mKeyedMutex(nullptr),
       mBackBufferTexture(),
       mBackBufferRTView(),
@@ -114,6 +115,11 @@ void SwapChain11::release()
 {
     // TODO(jmadill): Should probably signal that the RenderTarget is dirty.
 
+    if (mFrameLatencyWaitableObject != nullptr)
+    {
+        CloseHandle(mFrameLatencyWaitableObject);
+        mFrameLatencyWaitableObject = nullptr;
+    }
     SafeRelease(mSwapChain1);
     SafeRelease(mSwapChain);
     SafeRelease(mKeyedMutex);
@@ -508,8 +514,10 @@ EGLint SwapChain11::resize(DisplayD3D *displayD3D, EGLint backbufferWidth, EGLin
         return EGL_BAD_ALLOC;
     }
 
+    // Keep the creation flags: dropping DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT
+    // (or any other flag) on resize makes ResizeBuffers fail.
     hr = mSwapChain->ResizeBuffers(desc.BufferCount, backbufferWidth, backbufferHeight,
-                                   getSwapChainNativeFormat(), 0);
+                                   getSwapChainNativeFormat(), desc.Flags);
 
     if (FAILED(hr))
     {
@@ -613,6 +621,11 @@ EGLint SwapChain11::reset(DisplayD3D *displayD3D,
 
     // Release specific resources to free up memory for the new render target, while the
     // old render target still exists for the purpose of preserving its contents.
+    if (mFrameLatencyWaitableObject != nullptr)
+    {
+        CloseHandle(mFrameLatencyWaitableObject);
+        mFrameLatencyWaitableObject = nullptr;
+    }
     SafeRelease(mSwapChain1);
     SafeRelease(mSwapChain);
     mBackBufferTexture.reset();
@@ -655,6 +668,22 @@ EGLint SwapChain11::reset(DisplayD3D *displayD3D,
             mSwapChain1 = d3d11::DynamicCastComObject<IDXGISwapChain1>(mSwapChain);
         }
 
+        // If the native window created a frame latency waitable swap chain, grab the
+        // waitable object so it can be handed to the application through
+        // eglQuerySurfacePointerANGLE.
+        DXGI_SWAP_CHAIN_DESC swapChainDesc;
+        if (SUCCEEDED(mSwapChain->GetDesc(&swapChainDesc)) &&
+            (swapChainDesc.Flags & DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT) != 0)
+        {
+            IDXGISwapChain2 *swapChain2 =
+                d3d11::DynamicCastComObject<IDXGISwapChain2>(mSwapChain);
+            if (swapChain2 != nullptr)
+            {
+                mFrameLatencyWaitableObject = swapChain2->GetFrameLatencyWaitableObject();
+                SafeRelease(swapChain2);
+            }
+        }
+
         ID3D11Texture2D *backbufferTex = nullptr;
         hr                             = mSwapChain->GetBuffer(0, __uuidof(ID3D11Texture2D),
                                                                reinterpret_cast<LPVOID *>(&backbufferTex));
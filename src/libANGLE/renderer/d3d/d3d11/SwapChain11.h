@@ -58,6 +58,7 @@ class SwapChain11 final : public SwapChainD3D
     EGLint getWidth() const { return mWidth; }
     EGLint getHeight() const { return mHeight; }
     void *getKeyedMutex() override;
+    HANDLE getFrameLatencyWaitableObject() override { return mFrameLatencyWaitableObject; }
     EGLint getSamples() const { return mEGLSamples; }
 
     egl::Error getSyncValues(EGLuint64KHR *ust, EGLuint64KHR *msc, EGLuint64KHR *sbc) override;
@@ -99,6 +100,7 @@ class SwapChain11 final : public SwapChainD3D
     bool mFirstSwap;
     IDXGISwapChain *mSwapChain;
     IDXGISwapChain1 *mSwapChain1;
+    HANDLE mFrameLatencyWaitableObject;
     IDXGIKeyedMutex *mKeyedMutex;
 
     TextureHelper11 mBackBufferTexture;
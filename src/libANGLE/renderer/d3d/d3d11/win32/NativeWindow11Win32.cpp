@@ -21,10 +21,12 @@ namespace rx
 
 NativeWindow11Win32::NativeWindow11Win32(EGLNativeWindowType window,
                                          bool hasAlpha,
-                                         bool directComposition)
+                                         bool directComposition,
+                                         UINT maxFrameLatency)
     : NativeWindow11(window),
       mDirectComposition(directComposition),
       mHasAlpha(hasAlpha),
+      mMaxFrameLatency(maxFrameLatency),
       mDevice(nullptr),
       mCompositionTarget(nullptr),
       mVisual(nullptr)
@@ -164,12 +166,38 @@ HRESULT NativeWindow11Win32::createSwapChain(ID3D11Device *device,
         swapChainDesc.SwapEffect    = DXGI_SWAP_EFFECT_SEQUENTIAL;
         swapChainDesc.AlphaMode     = DXGI_ALPHA_MODE_UNSPECIFIED;
         swapChainDesc.Flags         = 0;
+        if (mMaxFrameLatency > 0 && samples <= 1)
+        {
+            // Frame latency control requires a flip-model waitable swap chain (DXGI 1.3).
+            swapChainDesc.BufferCount = 2;
+            swapChainDesc.SwapEffect  = DXGI_SWAP_EFFECT_FLIP_SEQUENTIAL;
+            swapChainDesc.Flags       = DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+        }
         IDXGISwapChain1 *swapChain1 = nullptr;
         HRESULT result = factory2->CreateSwapChainForHwnd(device, getNativeWindow(), &swapChainDesc,
                                                           nullptr, nullptr, &swapChain1);
+        if (FAILED(result) && swapChainDesc.Flags != 0)
+        {
+            // DXGI 1.3 is unavailable; fall back to the regular blit-model swap chain.
+            swapChainDesc.BufferCount = 1;
+            swapChainDesc.SwapEffect  = DXGI_SWAP_EFFECT_SEQUENTIAL;
+            swapChainDesc.Flags       = 0;
+            result = factory2->CreateSwapChainForHwnd(device, getNativeWindow(), &swapChainDesc,
+                                                      nullptr, nullptr, &swapChain1);
+        }
         if (SUCCEEDED(result))
         {
             factory2->MakeWindowAssociation(getNativeWindow(), DXGI_MWA_NO_ALT_ENTER);
+            if ((swapChainDesc.Flags & DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT) != 0)
+            {
+                IDXGISwapChain2 *swapChain2 =
+                    d3d11::DynamicCastComObject<IDXGISwapChain2>(swapChain1);
+                if (swapChain2 != nullptr)
+                {
+                    swapChain2->SetMaximumFrameLatency(mMaxFrameLatency);
+                    SafeRelease(swapChain2);
+                }
+            }
             *swapChain = static_cast<IDXGISwapChain *>(swapChain1);
         }
         SafeRelease(factory2);
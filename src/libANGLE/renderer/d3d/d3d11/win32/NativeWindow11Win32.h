@@ -21,7 +21,10 @@ namespace rx
 class NativeWindow11Win32 : public NativeWindow11
 {
   public:
-    NativeWindow11Win32(EGLNativeWindowType window, bool hasAlpha, bool directComposition);
+    NativeWindow11Win32(EGLNativeWindowType window,
+                        bool hasAlpha,
+                        bool directComposition,
+                        UINT maxFrameLatency);
     ~NativeWindow11Win32() override;
 
     bool initialize() override;
@@ -43,6 +46,9 @@ class NativeWindow11Win32 : public NativeWindow11
   private:
     bool mDirectComposition;
     bool mHasAlpha;
+    // Non-zero requests a DXGI frame latency waitable swap chain limited to this many
+    // queued frames. See EGL_ANGLE_d3d11_frame_latency.
+    UINT mMaxFrameLatency;
     IDCompositionDevice *mDevice;
     IDCompositionTarget *mCompositionTarget;
     IDCompositionVisual *mVisual;
@@ -206,8 +206,9 @@ angle::Result Image9::CopyImage(const gl::Context *context,
     ASSERT(sourceData && destData);
 
     CopyImageCHROMIUM(sourceData, sourceLocked.Pitch, sourceD3DFormatInfo.pixelBytes, 0,
-                      sourceD3DFormatInfo.info().pixelReadFunction, destData, destLocked.Pitch,
-                      destD3DFormatInfo.pixelBytes, 0, destD3DFormatInfo.info().pixelWriteFunction,
+                      sourceD3DFormatInfo.info().id, sourceD3DFormatInfo.info().pixelReadFunction,
+                      destData, destLocked.Pitch, destD3DFormatInfo.pixelBytes, 0,
+                      destD3DFormatInfo.info().id, destD3DFormatInfo.info().pixelWriteFunction,
                       gl::GetUnsizedFormat(dest->getInternalFormat()),
                       destD3DFormatInfo.info().componentType, sourceRect.width, sourceRect.height,
                       1, unpackFlipY, unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
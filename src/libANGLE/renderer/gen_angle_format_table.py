@@ -67,6 +67,11 @@ namespace angle
 static constexpr rx::FastCopyFunctionMap::Entry BGRAEntry = {{angle::FormatID::R8G8B8A8_UNORM,
                                                              CopyBGRA8ToRGBA8}};
 static constexpr rx::FastCopyFunctionMap BGRACopyFunctions = {{&BGRAEntry, 1}};
+// The red/blue swap is symmetric, so the same function also covers RGBA to BGRA.
+static constexpr rx::FastCopyFunctionMap::Entry RGBAEntries[] = {{
+    {{angle::FormatID::B8G8R8A8_UNORM, CopyBGRA8ToRGBA8}},
+    {{angle::FormatID::R8G8B8_UNORM, CopyRGBA8ToRGB8}}}};
+static constexpr rx::FastCopyFunctionMap RGBACopyFunctions = {{RGBAEntries, 2}};
 static constexpr rx::FastCopyFunctionMap NoCopyFunctions;
 
 const Format gFormatInfoTable[] = {{
@@ -322,6 +327,9 @@ def json_to_table_data(format_id, json, angle_to_gl):
     if format_id == "B8G8R8A8_UNORM":
         parsed["fastCopyFunctions"] = "BGRACopyFunctions"
 
+    if format_id == "R8G8B8A8_UNORM":
+        parsed["fastCopyFunctions"] = "RGBACopyFunctions"
+
     is_block = format_id.endswith("_BLOCK")
 
     pixel_bytes = 0
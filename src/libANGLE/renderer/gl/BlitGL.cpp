@@ -795,18 +795,21 @@ angle::Result BlitGL::copySubTextureCPUReadback(const gl::Context *context,
     uint8_t *sourceMemory = buffer->data();
     uint8_t *destMemory   = buffer->data() + sourceBufferSize;
 
-    GLenum readPixelsFormat        = GL_NONE;
-    PixelReadFunction readFunction = nullptr;
+    GLenum readPixelsFormat          = GL_NONE;
+    PixelReadFunction readFunction   = nullptr;
+    angle::FormatID readBackFormatID = angle::FormatID::NONE;
     if (sourceInternalFormatInfo.componentType == GL_UNSIGNED_INT)
     {
         readPixelsFormat = GL_RGBA_INTEGER;
         readFunction     = angle::ReadColor<angle::R8G8B8A8, GLuint>;
+        readBackFormatID = angle::FormatID::R8G8B8A8_UINT;
     }
     else
     {
         ASSERT(sourceInternalFormatInfo.componentType != GL_INT);
         readPixelsFormat = GL_RGBA;
         readFunction     = angle::ReadColor<angle::R8G8B8A8, GLfloat>;
+        readBackFormatID = angle::FormatID::R8G8B8A8_UNORM;
     }
 
     gl::PixelUnpackState unpack;
@@ -821,9 +824,9 @@ angle::Result BlitGL::copySubTextureCPUReadback(const gl::Context *context,
         angle::Format::InternalFormatToID(destInternalFormatInfo.sizedInternalFormat);
     const auto &destFormatInfo = angle::Format::Get(destFormatID);
     CopyImageCHROMIUM(
-        sourceMemory, readPixelsArea.width * sourcePixelSize, sourcePixelSize, 0, readFunction,
-        destMemory, readPixelsArea.width * destInternalFormatInfo.pixelBytes,
-        destInternalFormatInfo.pixelBytes, 0, destFormatInfo.pixelWriteFunction,
+        sourceMemory, readPixelsArea.width * sourcePixelSize, sourcePixelSize, 0, readBackFormatID,
+        readFunction, destMemory, readPixelsArea.width * destInternalFormatInfo.pixelBytes,
+        destInternalFormatInfo.pixelBytes, 0, destFormatID, destFormatInfo.pixelWriteFunction,
         destInternalFormatInfo.format, destInternalFormatInfo.componentType, readPixelsArea.width,
         readPixelsArea.height, 1, unpackFlipY, unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
 
@@ -38,7 +38,10 @@ BufferGL::BufferGL(const gl::BufferState &state, GLuint buffer)
       mMapSize(0),
       mShadowCopy(),
       mBufferSize(0),
-      mBufferID(buffer)
+      mAppliedUsage(gl::BufferUsage::StaticDraw),
+      mBufferID(buffer),
+      mRenameChain(),
+      mRenameChainHead(0)
 {}
 
 BufferGL::~BufferGL()
@@ -48,9 +51,24 @@ BufferGL::~BufferGL()
 
 void BufferGL::destroy(const gl::Context *context)
 {
+    const FunctionsGL *functions = GetFunctionsGL(context);
     StateManagerGL *stateManager = GetStateManagerGL(context);
     stateManager->deleteBuffer(mBufferID);
     mBufferID = 0;
+
+    for (RenameChainEntry &entry : mRenameChain)
+    {
+        if (entry.bufferID != 0)
+        {
+            stateManager->deleteBuffer(entry.bufferID);
+            entry.bufferID = 0;
+        }
+        if (entry.fence != nullptr)
+        {
+            functions->deleteSync(entry.fence);
+            entry.fence = nullptr;
+        }
+    }
 }
 
 angle::Result BufferGL::setData(const gl::Context *context,
@@ -64,6 +82,19 @@ angle::Result BufferGL::setData(const gl::Context *context,
     StateManagerGL *stateManager      = GetStateManagerGL(context);
     const angle::FeaturesGL &features = GetFeaturesGL(context);
 
+    // Re-specifying a buffer with unchanged size and usage is the orphaning pattern. Rotate to
+    // a different backing name instead of re-specifying the current one so drivers with weak
+    // rename heuristics do not serialize against pending draws. Buffers visible to the driver
+    // through indexed or transform feedback bindings keep their name since those attachments
+    // are not re-synced on a rename.
+    if (features.useBufferRenameChainOnOrphan.enabled && !mIsMapped && size > 0 &&
+        size == mBufferSize && usage == mAppliedUsage &&
+        !mState.isBoundForTransformFeedback() &&
+        !stateManager->isBufferBoundToIndexedTarget(mBufferID))
+    {
+        ANGLE_TRY(rotateRenameChain(context));
+    }
+
     stateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
     ANGLE_GL_TRY(context, functions->bufferData(gl::ToGLenum(DestBufferOperationTarget), size, data,
                                                 ToGLenum(usage)));
@@ -78,13 +109,57 @@ angle::Result BufferGL::setData(const gl::Context *context,
         }
     }
 
-    mBufferSize = size;
+    mBufferSize   = size;
+    mAppliedUsage = usage;
 
     contextGL->markWorkSubmitted();
 
     return angle::Result::Continue;
 }
 
+angle::Result BufferGL::rotateRenameChain(const gl::Context *context)
+{
+    const FunctionsGL *functions = GetFunctionsGL(context);
+
+    // Fence the retiring name so it is known when its last use has drained.
+    RenameChainEntry retired;
+    retired.bufferID = mBufferID;
+    ANGLE_GL_TRY(context, retired.fence = functions->fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+    RenameChainEntry &oldest = mRenameChain[mRenameChainHead];
+
+    GLuint incomingBuffer = oldest.bufferID;
+    if (incomingBuffer != 0)
+    {
+        ASSERT(oldest.fence != nullptr);
+        GLenum waitResult = GL_TIMEOUT_EXPIRED;
+        ANGLE_GL_TRY(context, waitResult = functions->clientWaitSync(
+                                  oldest.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0));
+        ANGLE_GL_TRY(context, functions->deleteSync(oldest.fence));
+        oldest.fence = nullptr;
+
+        if (waitResult == GL_TIMEOUT_EXPIRED)
+        {
+            // The GPU is still using the oldest name; never stall, replace it instead.
+            GetStateManagerGL(context)->deleteBuffer(incomingBuffer);
+            incomingBuffer = 0;
+        }
+    }
+    if (incomingBuffer == 0)
+    {
+        ANGLE_GL_TRY(context, functions->genBuffers(1, &incomingBuffer));
+    }
+
+    oldest           = retired;
+    mRenameChainHead = (mRenameChainHead + 1) % kRenameChainLength;
+    mBufferID        = incomingBuffer;
+
+    // Let the front end re-sync vertex array and texture attachments to the new name.
+    onStateChange(angle::SubjectMessage::InternalMemoryAllocationChanged);
+
+    return angle::Result::Continue;
+}
+
 angle::Result BufferGL::setSubData(const gl::Context *context,
                                    gl::BufferBinding target,
                                    const void *data,
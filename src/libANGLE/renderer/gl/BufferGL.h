@@ -12,6 +12,8 @@
 #include "common/MemoryBuffer.h"
 #include "libANGLE/renderer/BufferImpl.h"
 
+#include <array>
+
 namespace rx
 {
 
@@ -59,6 +61,12 @@ class BufferGL : public BufferImpl
     GLuint getBufferID() const;
 
   private:
+    // Retires the current buffer name behind a fence and switches to the oldest name in the
+    // rename chain (or a fresh one while the chain grows or the oldest name is still in use
+    // by the GPU). Used when the useBufferRenameChainOnOrphan feature is active and the
+    // buffer is orphaned with glBufferData.
+    angle::Result rotateRenameChain(const gl::Context *context);
+
     bool mIsMapped;
     size_t mMapOffset;
     size_t mMapSize;
@@ -66,8 +74,20 @@ class BufferGL : public BufferImpl
     angle::MemoryBuffer mShadowCopy;
 
     size_t mBufferSize;
+    gl::BufferUsage mAppliedUsage;
 
     GLuint mBufferID;
+
+    // Previously orphaned buffer names together with the fence covering their last use.
+    // Oldest entry is at mRenameChainHead.
+    struct RenameChainEntry
+    {
+        GLuint bufferID = 0;
+        GLsync fence    = nullptr;
+    };
+    static constexpr size_t kRenameChainLength = 3;
+    std::array<RenameChainEntry, kRenameChainLength> mRenameChain;
+    size_t mRenameChainHead;
 };
 
 }  // namespace rx
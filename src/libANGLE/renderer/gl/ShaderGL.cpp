@@ -130,6 +130,102 @@ class WaitableCompileEventNativeParallel final : public WaitableCompileEvent
     PeekCompletionFunctor mPeekCompletionFunctor;
 };
 
+// Runs only the ANGLE translator; the native compile is issued later on the API thread once the
+// translated source is available.
+class TranslateTaskNativeParallelGL : public angle::Closure
+{
+  public:
+    TranslateTaskNativeParallelGL(ShHandle handle,
+                                  const ShCompileOptions &options,
+                                  const std::string &source)
+        : mHandle(handle), mOptions(options), mSource(source), mResult(false)
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT1("gpu.angle", "TranslateTaskNativeParallelGL::run", "source", mSource);
+        const char *source = mSource.c_str();
+        mResult            = sh::Compile(mHandle, &source, 1, mOptions);
+    }
+
+    bool getResult() { return mResult; }
+
+    ShHandle getHandle() { return mHandle; }
+
+  private:
+    ShHandle mHandle;
+    ShCompileOptions mOptions;
+    std::string mSource;
+    bool mResult;
+};
+
+using CompileShaderFunctor = std::function<void(const char *source)>;
+
+// Combines the worker-pool translation with the driver's parallel compiler: translation happens on
+// a worker thread and the native compile is handed to the driver the first time completion is
+// queried after translation finishes, so the API thread never blocks until the result is resolved.
+class WaitableCompileEventNativeParallelWorker final : public WaitableCompileEvent
+{
+  public:
+    WaitableCompileEventNativeParallelWorker(
+        std::shared_ptr<angle::WaitableEvent> waitableEvent,
+        PostTranslateFunctor &&postTranslateFunctor,
+        CompileShaderFunctor &&compileShaderFunctor,
+        CheckShaderFunctor &&checkShaderFunctor,
+        PeekCompletionFunctor &&peekCompletionFunctor,
+        std::shared_ptr<TranslateTaskNativeParallelGL> translateTask)
+        : WaitableCompileEvent(waitableEvent),
+          mPostTranslateFunctor(std::move(postTranslateFunctor)),
+          mCompileShaderFunctor(std::move(compileShaderFunctor)),
+          mCheckShaderFunctor(std::move(checkShaderFunctor)),
+          mPeekCompletionFunctor(std::move(peekCompletionFunctor)),
+          mTranslateTask(translateTask),
+          mNativeCompileStarted(false)
+    {}
+
+    void wait() override
+    {
+        mWaitableEvent->wait();
+        startNativeCompileIfTranslated();
+        if (mNativeCompileStarted)
+        {
+            mCheckShaderFunctor();
+        }
+    }
+
+    bool isReady() override
+    {
+        if (!mWaitableEvent->isReady())
+        {
+            return false;
+        }
+        startNativeCompileIfTranslated();
+        // A failed translation has no native compile to wait for.
+        return !mNativeCompileStarted || mPeekCompletionFunctor();
+    }
+
+    bool getResult() override { return mTranslateTask->getResult(); }
+
+    bool postTranslate(std::string *infoLog) override { return mPostTranslateFunctor(infoLog); }
+
+  private:
+    void startNativeCompileIfTranslated()
+    {
+        if (!mNativeCompileStarted && mTranslateTask->getResult())
+        {
+            mCompileShaderFunctor(sh::GetObjectCode(mTranslateTask->getHandle()).c_str());
+            mNativeCompileStarted = true;
+        }
+    }
+
+    PostTranslateFunctor mPostTranslateFunctor;
+    CompileShaderFunctor mCompileShaderFunctor;
+    CheckShaderFunctor mCheckShaderFunctor;
+    PeekCompletionFunctor mPeekCompletionFunctor;
+    std::shared_ptr<TranslateTaskNativeParallelGL> mTranslateTask;
+    bool mNativeCompileStarted;
+};
+
 class WaitableCompileEventDone final : public WaitableCompileEvent
 {
   public:
@@ -435,6 +531,23 @@ std::shared_ptr<WaitableCompileEvent> ShaderGL::compile(const gl::Context *conte
     if (mRenderer->hasNativeParallelCompile())
     {
         ShHandle handle = compilerInstance->getHandle();
+        if (workerThreadPool->isAsync())
+        {
+            // Keep the API thread free of the translator as well: translate on the worker pool
+            // and let the driver's parallel compiler pick up the result on the first completion
+            // query.
+            auto translateTask =
+                std::make_shared<TranslateTaskNativeParallelGL>(handle, *options, source);
+
+            auto compileShaderFunctor  = [this](const char *source) { compileShader(source); };
+            auto checkShaderFunctor    = [this]() { checkShader(); };
+            auto peekCompletionFunctor = [this]() { return peekCompletion(); };
+            return std::make_shared<WaitableCompileEventNativeParallelWorker>(
+                workerThreadPool->postWorkerTask(translateTask),
+                std::move(postTranslateFunctor), std::move(compileShaderFunctor),
+                std::move(checkShaderFunctor), std::move(peekCompletionFunctor), translateTask);
+        }
+
         const char *str = source.c_str();
         bool result     = sh::Compile(handle, &str, 1, *options);
         if (result)
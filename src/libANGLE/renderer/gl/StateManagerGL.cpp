@@ -398,12 +398,17 @@ void StateManagerGL::useProgram(GLuint program)
     {
         forceUseProgram(program);
     }
+    else
+    {
+        mBindingCallCounters.elided++;
+    }
 }
 
 void StateManagerGL::forceUseProgram(GLuint program)
 {
     mProgram = program;
     mFunctions->useProgram(mProgram);
+    mBindingCallCounters.issued++;
     mLocalDirtyBits.set(gl::State::DIRTY_BIT_PROGRAM_BINDING);
 }
 
@@ -419,9 +424,14 @@ void StateManagerGL::bindVertexArray(GLuint vao, VertexArrayStateGL *vaoState)
         mBuffers[gl::BufferBinding::ElementArray] = vaoState ? vaoState->elementArrayBuffer : 0;
 
         mFunctions->bindVertexArray(vao);
+        mBindingCallCounters.issued++;
 
         mLocalDirtyBits.set(gl::State::DIRTY_BIT_VERTEX_ARRAY_BINDING);
     }
+    else
+    {
+        mBindingCallCounters.elided++;
+    }
 }
 
 void StateManagerGL::bindBuffer(gl::BufferBinding target, GLuint buffer)
@@ -434,6 +444,11 @@ void StateManagerGL::bindBuffer(gl::BufferBinding target, GLuint buffer)
     {
         mBuffers[target] = buffer;
         mFunctions->bindBuffer(gl::ToGLenum(target), buffer);
+        mBindingCallCounters.issued++;
+    }
+    else
+    {
+        mBindingCallCounters.elided++;
     }
 }
 
@@ -452,6 +467,11 @@ void StateManagerGL::bindBufferBase(gl::BufferBinding target, size_t index, GLui
         binding.size     = static_cast<size_t>(-1);
         mBuffers[target] = buffer;
         mFunctions->bindBufferBase(gl::ToGLenum(target), static_cast<GLuint>(index), buffer);
+        mBindingCallCounters.issued++;
+    }
+    else
+    {
+        mBindingCallCounters.elided++;
     }
 }
 
@@ -473,7 +493,29 @@ void StateManagerGL::bindBufferRange(gl::BufferBinding target,
         mBuffers[target] = buffer;
         mFunctions->bindBufferRange(gl::ToGLenum(target), static_cast<GLuint>(index), buffer,
                                     offset, size);
+        mBindingCallCounters.issued++;
+    }
+    else
+    {
+        mBindingCallCounters.elided++;
+    }
+}
+
+bool StateManagerGL::isBufferBoundToIndexedTarget(GLuint buffer) const
+{
+    // Transform feedback buffer bindings are tracked in TransformFeedbackGL and must be
+    // checked by the caller through the front end state.
+    for (const std::vector<IndexedBufferBinding> &bindings : mIndexedBuffers)
+    {
+        for (const IndexedBufferBinding &binding : bindings)
+        {
+            if (binding.buffer == buffer)
+            {
+                return true;
+            }
+        }
     }
+    return false;
 }
 
 void StateManagerGL::activeTexture(size_t unit)
@@ -482,6 +524,11 @@ void StateManagerGL::activeTexture(size_t unit)
     {
         mTextureUnitIndex = unit;
         mFunctions->activeTexture(GL_TEXTURE0 + static_cast<GLenum>(mTextureUnitIndex));
+        mBindingCallCounters.issued++;
+    }
+    else
+    {
+        mBindingCallCounters.elided++;
     }
 }
 
@@ -492,8 +539,13 @@ void StateManagerGL::bindTexture(gl::TextureType type, GLuint texture)
     {
         mTextures[nativeType][mTextureUnitIndex] = texture;
         mFunctions->bindTexture(nativegl::GetTextureBindingTarget(type), texture);
+        mBindingCallCounters.issued++;
         mLocalDirtyBits.set(gl::State::DIRTY_BIT_TEXTURE_BINDINGS);
     }
+    else
+    {
+        mBindingCallCounters.elided++;
+    }
 }
 
 void StateManagerGL::invalidateTexture(gl::TextureType type)
@@ -511,8 +563,13 @@ void StateManagerGL::bindSampler(size_t unit, GLuint sampler)
     {
         mSamplers[unit] = sampler;
         mFunctions->bindSampler(static_cast<GLuint>(unit), sampler);
+        mBindingCallCounters.issued++;
         mLocalDirtyBits.set(gl::State::DIRTY_BIT_SAMPLER_BINDINGS);
     }
+    else
+    {
+        mBindingCallCounters.elided++;
+    }
 }
 
 void StateManagerGL::bindImageTexture(size_t unit,
@@ -535,6 +592,11 @@ void StateManagerGL::bindImageTexture(size_t unit,
         binding.format  = format;
         mFunctions->bindImageTexture(angle::base::checked_cast<GLuint>(unit), texture, level,
                                      layered, layer, access, format);
+        mBindingCallCounters.issued++;
+    }
+    else
+    {
+        mBindingCallCounters.elided++;
     }
 }
 
@@ -707,6 +769,15 @@ void StateManagerGL::bindFramebuffer(GLenum type, GLuint framebuffer)
             break;
     }
 
+    if (framebufferChanged)
+    {
+        mBindingCallCounters.issued++;
+    }
+    else
+    {
+        mBindingCallCounters.elided++;
+    }
+
     if (framebufferChanged && mFeatures.flushOnFramebufferChange.enabled)
     {
         mFunctions->flush();
@@ -720,6 +791,11 @@ void StateManagerGL::bindRenderbuffer(GLenum type, GLuint renderbuffer)
     {
         mRenderbuffer = renderbuffer;
         mFunctions->bindRenderbuffer(type, mRenderbuffer);
+        mBindingCallCounters.issued++;
+    }
+    else
+    {
+        mBindingCallCounters.elided++;
     }
 }
 
@@ -740,8 +816,13 @@ void StateManagerGL::bindTransformFeedback(GLenum type, GLuint transformFeedback
 
         mTransformFeedback = transformFeedback;
         mFunctions->bindTransformFeedback(type, mTransformFeedback);
+        mBindingCallCounters.issued++;
         onTransformFeedbackStateChange();
     }
+    else
+    {
+        mBindingCallCounters.elided++;
+    }
 }
 
 void StateManagerGL::onTransformFeedbackStateChange()
@@ -2978,17 +3059,32 @@ void StateManagerGL::restoreBlendNativeContext(const gl::Extensions &extensions,
 {
     setBlendEnabled(state->blendEnabled);
 
-    mFunctions->blendFuncSeparate(state->blendSrcRgb, state->blendDestRgb, state->blendSrcAlpha,
+    // Only hit the driver when the shadowed blend state differs from what the external context
+    // expects; restores commonly run with the state unchanged.
+    if (mBlendStateExt.getSrcColorBits() != mBlendStateExt.expandFactorValue(state->blendSrcRgb) ||
+        mBlendStateExt.getDstColorBits() != mBlendStateExt.expandFactorValue(state->blendDestRgb) ||
+        mBlendStateExt.getSrcAlphaBits() !=
+            mBlendStateExt.expandFactorValue(state->blendSrcAlpha) ||
+        mBlendStateExt.getDstAlphaBits() != mBlendStateExt.expandFactorValue(state->blendDestAlpha))
+    {
+        mFunctions->blendFuncSeparate(state->blendSrcRgb, state->blendDestRgb, state->blendSrcAlpha,
+                                      state->blendDestAlpha);
+        mBlendStateExt.setFactors(state->blendSrcRgb, state->blendDestRgb, state->blendSrcAlpha,
                                   state->blendDestAlpha);
-    mBlendStateExt.setFactors(state->blendSrcRgb, state->blendDestRgb, state->blendSrcAlpha,
-                              state->blendDestAlpha);
-    mLocalDirtyBits.set(gl::State::DIRTY_BIT_BLEND_FUNCS);
+        mLocalDirtyBits.set(gl::State::DIRTY_BIT_BLEND_FUNCS);
+    }
 
     setBlendColor(state->blendColor);
 
-    mFunctions->blendEquationSeparate(state->blendEquationRgb, state->blendEquationAlpha);
-    mBlendStateExt.setEquations(state->blendEquationRgb, state->blendEquationAlpha);
-    mLocalDirtyBits.set(gl::State::DIRTY_BIT_BLEND_EQUATIONS);
+    if (mBlendStateExt.getEquationColorBits() !=
+            mBlendStateExt.expandEquationValue(state->blendEquationRgb) ||
+        mBlendStateExt.getEquationAlphaBits() !=
+            mBlendStateExt.expandEquationValue(state->blendEquationAlpha))
+    {
+        mFunctions->blendEquationSeparate(state->blendEquationRgb, state->blendEquationAlpha);
+        mBlendStateExt.setEquations(state->blendEquationRgb, state->blendEquationAlpha);
+        mLocalDirtyBits.set(gl::State::DIRTY_BIT_BLEND_EQUATIONS);
+    }
 }
 
 void StateManagerGL::syncFramebufferFromNativeContext(const gl::Extensions &extensions,
@@ -3213,6 +3309,20 @@ void StateManagerGL::restoreTextureUnitsNativeContext(const gl::Extensions &exte
     for (size_t i = 0; i < state->textureBindings.size(); ++i)
     {
         const auto &bindings = state->textureBindings[i];
+
+        // Skip the glActiveTexture round-trip entirely when the shadowed bindings for this unit
+        // already match what the external context expects.
+        if (mTextures[gl::TextureType::_2D][i] == static_cast<GLuint>(bindings.texture2d) &&
+            mTextures[gl::TextureType::CubeMap][i] ==
+                static_cast<GLuint>(bindings.textureCubeMap) &&
+            mTextures[gl::TextureType::External][i] ==
+                static_cast<GLuint>(bindings.textureExternalOES) &&
+            mSamplers[i] == 0)
+        {
+            mBindingCallCounters.elided++;
+            continue;
+        }
+
         activeTexture(i);
         bindTexture(gl::TextureType::_2D, bindings.texture2d);
         bindTexture(gl::TextureType::CubeMap, bindings.textureCubeMap);
@@ -173,6 +173,7 @@ class StateManagerGL final : angle::NonCopyable
                          GLuint buffer,
                          size_t offset,
                          size_t size);
+    bool isBufferBoundToIndexedTarget(GLuint buffer) const;
     void activeTexture(size_t unit);
     void bindTexture(gl::TextureType type, GLuint texture);
     void invalidateTexture(gl::TextureType type);
@@ -301,6 +302,16 @@ class StateManagerGL final : angle::NonCopyable
 
     void validateState() const;
 
+    // Running audit of binding calls: how many reached the driver versus how many were elided
+    // because the shadowed binding already matched. Useful for confirming that rebind-heavy
+    // paths (external context syncs in particular) are not hitting the driver on GL-on-GL.
+    struct BindingCallCounters
+    {
+        uint64_t issued = 0;
+        uint64_t elided = 0;
+    };
+    const BindingCallCounters &getBindingCallCounters() const { return mBindingCallCounters; }
+
     void syncFromNativeContext(const gl::Extensions &extensions, ExternalContextState *state);
     void restoreNativeContext(const gl::Extensions &extensions, const ExternalContextState *state);
 
@@ -522,6 +533,8 @@ class StateManagerGL final : angle::NonCopyable
     gl::State::DirtyBits mLocalDirtyBits;
     gl::State::ExtendedDirtyBits mLocalExtendedDirtyBits;
     gl::AttributesMask mLocalDirtyCurrentValues;
+
+    BindingCallCounters mBindingCallCounters;
 };
 
 }  // namespace rx
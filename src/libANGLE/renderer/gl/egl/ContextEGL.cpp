@@ -7,6 +7,7 @@
 #include "libANGLE/renderer/gl/egl/ContextEGL.h"
 
 #include "libANGLE/renderer/gl/FramebufferGL.h"
+#include "libANGLE/renderer/gl/FunctionsGL.h"
 #include "libANGLE/renderer/gl/StateManagerGL.h"
 
 namespace rx
@@ -16,15 +17,38 @@ ContextEGL::ContextEGL(const gl::State &state,
                        gl::ErrorSet *errorSet,
                        const std::shared_ptr<RendererEGL> &renderer,
                        RobustnessVideoMemoryPurgeStatus robustnessVideoMemoryPurgeStatus)
-    : ContextGL(state, errorSet, renderer, robustnessVideoMemoryPurgeStatus), mRendererEGL(renderer)
+    : ContextGL(state, errorSet, renderer, robustnessVideoMemoryPurgeStatus),
+      mRendererEGL(renderer),
+      mReleaseFence(nullptr)
 {}
 
 ContextEGL::~ContextEGL() {}
 
+void ContextEGL::onDestroy(const gl::Context *context)
+{
+    if (mReleaseFence != nullptr)
+    {
+        getFunctions()->deleteSync(mReleaseFence);
+        mReleaseFence = nullptr;
+    }
+    ContextGL::onDestroy(context);
+}
+
 angle::Result ContextEGL::onMakeCurrent(const gl::Context *context)
 {
     if (context->isExternal())
     {
+        if (mReleaseFence != nullptr)
+        {
+            // Order our upcoming commands after the work that was in flight when ownership was
+            // last handed back, without stalling the client. On the shared native context this is
+            // a server-side wait and retires immediately once the fence has been reached.
+            const FunctionsGL *functions = getFunctions();
+            functions->waitSync(mReleaseFence, 0, GL_TIMEOUT_IGNORED);
+            functions->deleteSync(mReleaseFence);
+            mReleaseFence = nullptr;
+        }
+
         if (!mExtState)
         {
             mExtState        = std::make_unique<ExternalContextState>();
@@ -49,6 +73,27 @@ angle::Result ContextEGL::onUnMakeCurrent(const gl::Context *context)
         ASSERT(context->isExternal());
         ASSERT(mExtState);
         getStateManager()->restoreNativeContext(getNativeExtensions(), mExtState.get());
+
+        const FunctionsGL *functions = getFunctions();
+        if (functions->fenceSync != nullptr)
+        {
+            // Hand ownership back with a fence instead of a pipeline drain: ANGLE's commands are
+            // already ordered against the embedder's on the shared native context, and the fence
+            // lets the next onMakeCurrent wait server-side for anything still in flight.
+            if (mReleaseFence != nullptr)
+            {
+                functions->deleteSync(mReleaseFence);
+            }
+            mReleaseFence = functions->fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            if (mReleaseFence != nullptr)
+            {
+                if (getFeaturesGL().unbindFBOBeforeSwitchingContext.enabled)
+                {
+                    getStateManager()->bindFramebuffer(GL_FRAMEBUFFER, 0);
+                }
+                return ContextImpl::onUnMakeCurrent(context);
+            }
+        }
     }
 
     return ContextGL::onUnMakeCurrent(context);
@@ -26,6 +26,8 @@ class ContextEGL : public ContextGL
                RobustnessVideoMemoryPurgeStatus robustnessVideoMemoryPurgeStatus);
     ~ContextEGL() override;
 
+    void onDestroy(const gl::Context *context) override;
+
     angle::Result onMakeCurrent(const gl::Context *context) override;
     angle::Result onUnMakeCurrent(const gl::Context *context) override;
 
@@ -34,6 +36,10 @@ class ContextEGL : public ContextGL
   private:
     std::shared_ptr<RendererEGL> mRendererEGL;
     std::unique_ptr<ExternalContextState> mExtState;
+
+    // Fence inserted when an external context hands ownership back to the native context, waited
+    // on server-side the next time it becomes current. Replaces the glFlush pipeline drain.
+    GLsync mReleaseFence;
 };
 }  // namespace rx
 
@@ -2306,6 +2306,13 @@ void InitializeFeatures(const FunctionsGL *functions, angle::FeaturesGL *feature
 
     ANGLE_FEATURE_CONDITION(features, keepBufferShadowCopy, !CanMapBufferForRead(functions));
 
+    // Several mobile drivers serialize glBufferData orphaning against pending draws instead of
+    // renaming the buffer storage. Rotate between client-side buffer names on those drivers.
+    // Fences are required to know when a retired name is safe to reuse.
+    ANGLE_FEATURE_CONDITION(features, useBufferRenameChainOnOrphan,
+                            IsAndroid() && (isQualcomm || isImagination || IsARM(vendor)) &&
+                                functions->fenceSync != nullptr);
+
     ANGLE_FEATURE_CONDITION(features, setZeroLevelBeforeGenerateMipmap, IsApple());
 
     ANGLE_FEATURE_CONDITION(features, promotePackedFormatsTo8BitPerChannel, IsApple() && hasAMD);
@@ -2970,6 +2970,7 @@ class SpirvTransformer final : public SpirvTransformerBase
     TransformationState transformDebugInfo(const uint32_t *instruction, spv::Op op);
     TransformationState transformEmitVertex(const uint32_t *instruction);
     TransformationState transformEntryPoint(const uint32_t *instruction);
+    TransformationState transformExecutionMode(const uint32_t *instruction);
     TransformationState transformDecorate(const uint32_t *instruction);
     TransformationState transformMemberDecorate(const uint32_t *instruction);
     TransformationState transformTypePointer(const uint32_t *instruction);
@@ -3160,6 +3161,9 @@ void SpirvTransformer::transformInstruction()
             case spv::OpEntryPoint:
                 transformationState = transformEntryPoint(instruction);
                 break;
+            case spv::OpExecutionMode:
+                transformationState = transformExecutionMode(instruction);
+                break;
             case spv::OpDecorate:
                 transformationState = transformDecorate(instruction);
                 break;
@@ -3591,9 +3595,34 @@ TransformationState SpirvTransformer::transformEntryPoint(const uint32_t *instru
     // Add an OpExecutionMode Xfb instruction if necessary.
     mXfbCodeGenerator.addExecutionMode(mEntryPointId, mSpirvBlobOut);
 
+    // Add an OpExecutionMode EarlyFragmentTests instruction if the front-end determined the
+    // fragment shader cannot interact with the tests.
+    if (mOptions.addEarlyFragmentTestsOptimization)
+    {
+        spirv::WriteExecutionMode(mSpirvBlobOut, mEntryPointId,
+                                  spv::ExecutionModeEarlyFragmentTests, {});
+    }
+
     return TransformationState::Transformed;
 }
 
+TransformationState SpirvTransformer::transformExecutionMode(const uint32_t *instruction)
+{
+    spirv::IdRef entryPoint;
+    spv::ExecutionMode mode;
+    spirv::LiteralIntegerList operandsList;
+    spirv::ParseExecutionMode(instruction, &entryPoint, &mode, &operandsList);
+
+    // If the shader has explicitly specified early_fragment_tests, drop it in favor of the one
+    // |transformEntryPoint| adds; the execution mode must not be specified twice.
+    if (mode == spv::ExecutionModeEarlyFragmentTests && mOptions.addEarlyFragmentTestsOptimization)
+    {
+        return TransformationState::Transformed;
+    }
+
+    return TransformationState::Unchanged;
+}
+
 TransformationState SpirvTransformer::transformTypePointer(const uint32_t *instruction)
 {
     spirv::IdResult id;
@@ -60,7 +60,10 @@ struct GlslangSpirvOptions
     bool isTransformFeedbackStage       = false;
     bool isTransformFeedbackEmulated    = false;
     bool isMultisampledFramebufferFetch = false;
-    bool validate                       = true;
+    // Add the EarlyFragmentTests execution mode; only valid for fragment shaders whose front-end
+    // analysis proved the tests cannot interact with the shader.
+    bool addEarlyFragmentTestsOptimization = false;
+    bool validate                          = true;
 };
 
 struct UniformBindingInfo final
@@ -1714,6 +1714,7 @@ void ContextMtl::flushCommandBuffer(mtl::CommandBufferFinishOperation operation)
     }
 
     endEncoding(true);
+    mBufferManager.flushPendingStagedBlits(this);
     mCmdBuffer.commit(operation);
     mRenderPassesSinceFlush = 0;
 }
@@ -1745,6 +1746,7 @@ void ContextMtl::present(const gl::Context *context, id<CAMetalDrawable> present
     }
 
     endEncoding(false);
+    mBufferManager.flushPendingStagedBlits(this);
     mCmdBuffer.present(presentationDrawable);
     mCmdBuffer.commit(mtl::NoWait);
     mRenderPassesSinceFlush = 0;
@@ -11,6 +11,7 @@
 #define LIBANGLE_RENDERER_METAL_DISPLAYMTL_H_
 
 #include "common/PackedEnums.h"
+#include "libANGLE/BlobCache.h"
 #include "libANGLE/angletypes.h"
 #include "libANGLE/renderer/DisplayImpl.h"
 #include "libANGLE/renderer/metal/mtl_command_buffer.h"
@@ -166,6 +167,14 @@ class DisplayMtl : public DisplayImpl
     mtl::AutoObjCObj<MTLSharedEventListener> getOrCreateSharedEventListener();
 #endif
 
+#if ANGLE_MTL_BINARY_ARCHIVE_AVAILABLE
+    // Shared archive of compiled pipeline binaries, restored from the EGL blob cache at display
+    // initialization and persisted back on terminate. Attached to render pipeline descriptors so
+    // first-use pipeline creation hits the archive instead of the Metal compiler.
+    id<MTLBinaryArchive> getPipelineBinaryArchive() const { return mPipelineArchive; }
+    void onPipelineAddedToBinaryArchive() { mPipelineArchiveDirty = true; }
+#endif
+
     bool useDirectToMetalCompiler() const;
 
   protected:
@@ -184,6 +193,11 @@ class DisplayMtl : public DisplayImpl
     mtl::AutoObjCPtr<id<MTLDevice>> getMetalDeviceMatchingAttribute(
         const egl::AttributeMap &attribs);
     angle::Result initializeShaderLibrary();
+#if ANGLE_MTL_BINARY_ARCHIVE_AVAILABLE
+    void computePipelineArchiveCacheKey(egl::BlobCache::Key *hashOut) const;
+    void initializePipelineBinaryArchive();
+    void savePipelineBinaryArchive();
+#endif
 
     egl::Display *mDisplay;
 
@@ -201,6 +215,10 @@ class DisplayMtl : public DisplayImpl
 #if ANGLE_MTL_EVENT_AVAILABLE
     mtl::AutoObjCObj<MTLSharedEventListener> mSharedEventListener;
 #endif
+#if ANGLE_MTL_BINARY_ARCHIVE_AVAILABLE
+    mtl::AutoObjCPtr<id<MTLBinaryArchive>> mPipelineArchive;
+    bool mPipelineArchiveDirty = false;
+#endif
 
     mutable bool mCapsInitialized;
     mutable gl::TextureCapsMap mNativeTextureCaps;
@@ -141,6 +141,12 @@ angle::Result DisplayMtl::initializeImpl(egl::Display *display)
 
         mMetalDeviceVendorId = mtl::GetDeviceVendorId(mMetalDevice);
 
+        // Publish the device's working set size as the memory budget for pressure tracking.
+        if (@available(iOS 16.0, macOS 10.12, *))
+        {
+            getMemoryBudgetTracker()->setBudget([mMetalDevice.get() recommendedMaxWorkingSetSize]);
+        }
+
         mCmdQueue.set([[mMetalDevice newCommandQueue] ANGLE_MTL_AUTORELEASE]);
 
         mCapsInitialized = false;
@@ -157,12 +163,21 @@ angle::Result DisplayMtl::initializeImpl(egl::Display *display)
         ANGLE_TRY(mFormatTable.initialize(this));
         ANGLE_TRY(initializeShaderLibrary());
 
+#if ANGLE_MTL_BINARY_ARCHIVE_AVAILABLE
+        initializePipelineBinaryArchive();
+#endif
+
         return mUtils.initialize();
     }
 }
 
 void DisplayMtl::terminate()
 {
+#if ANGLE_MTL_BINARY_ARCHIVE_AVAILABLE
+    savePipelineBinaryArchive();
+    mPipelineArchive      = nil;
+    mPipelineArchiveDirty = false;
+#endif
     mUtils.onDestroy();
     mCmdQueue.reset();
     mDefaultShadersAsyncInfo = nullptr;
@@ -1262,6 +1277,119 @@ angle::Result DisplayMtl::initializeShaderLibrary()
     return angle::Result::Continue;
 }
 
+#if ANGLE_MTL_BINARY_ARCHIVE_AVAILABLE
+void DisplayMtl::computePipelineArchiveCacheKey(egl::BlobCache::Key *hashOut) const
+{
+    // Bump this version to invalidate previously stored archives.
+    constexpr uint32_t kPipelineArchiveCacheVersion = 1;
+
+    std::ostringstream hashStream("ANGLE Metal Pipeline Archive: ", std::ios_base::ate);
+    // Archived binaries are only valid for the device and OS that produced them.
+    hashStream << mMetalDevice.get().name.UTF8String;
+    hashStream << std::hex << mMetalDeviceVendorId;
+    hashStream << std::hex << kPipelineArchiveCacheVersion;
+
+    const std::string &hashString = hashStream.str();
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(hashString.c_str()),
+                               hashString.length(), hashOut->data());
+}
+
+void DisplayMtl::initializePipelineBinaryArchive()
+{
+    if (@available(iOS 14.0, macOS 11.0, *))
+    {
+        ANGLE_MTL_OBJC_SCOPE
+        {
+            auto desc = mtl::adoptObjCObj([[MTLBinaryArchiveDescriptor alloc] init]);
+
+            // MTLBinaryArchive only deserializes from a file URL, so stage a previously stored
+            // blob from the blob cache in a temporary file.
+            egl::BlobCache::Key cacheKey;
+            computePipelineArchiveCacheKey(&cacheKey);
+
+            angle::ScratchBuffer scratchBuffer;
+            egl::BlobCache::Value cacheValue;
+            size_t cacheSize = 0;
+            NSURL *stagedUrl = nil;
+            if (mDisplay->getBlobCache()->get(&scratchBuffer, cacheKey, &cacheValue, &cacheSize) &&
+                cacheSize > 0)
+            {
+                NSString *stagedPath = [NSTemporaryDirectory()
+                    stringByAppendingPathComponent:
+                        [NSString stringWithFormat:@"ANGLEMtlPipelineArchive-%d.bin", getpid()]];
+                NSData *blobData     = [NSData dataWithBytes:cacheValue.data() length:cacheSize];
+                if ([blobData writeToFile:stagedPath atomically:YES])
+                {
+                    stagedUrl      = [NSURL fileURLWithPath:stagedPath];
+                    desc.get().url = stagedUrl;
+                }
+            }
+
+            NSError *err     = nil;
+            mPipelineArchive =
+                mtl::adoptObjCObj([mMetalDevice newBinaryArchiveWithDescriptor:desc error:&err]);
+            if (!mPipelineArchive && stagedUrl)
+            {
+                // The stored blob is stale or corrupt; start over with an empty archive.
+                desc.get().url   = nil;
+                err              = nil;
+                mPipelineArchive = mtl::adoptObjCObj([mMetalDevice
+                    newBinaryArchiveWithDescriptor:desc
+                                             error:&err]);
+            }
+
+            if (stagedUrl)
+            {
+                [[NSFileManager defaultManager] removeItemAtURL:stagedUrl error:nil];
+            }
+        }
+    }
+}
+
+void DisplayMtl::savePipelineBinaryArchive()
+{
+    if (@available(iOS 14.0, macOS 11.0, *))
+    {
+        if (!mPipelineArchive || !mPipelineArchiveDirty)
+        {
+            return;
+        }
+
+        ANGLE_MTL_OBJC_SCOPE
+        {
+            NSString *stagedPath = [NSTemporaryDirectory()
+                stringByAppendingPathComponent:
+                    [NSString stringWithFormat:@"ANGLEMtlPipelineArchive-%d.bin", getpid()]];
+            NSURL *stagedUrl     = [NSURL fileURLWithPath:stagedPath];
+
+            NSError *err = nil;
+            if (![mPipelineArchive serializeToURL:stagedUrl error:&err])
+            {
+                return;
+            }
+
+            NSData *blobData = [NSData dataWithContentsOfURL:stagedUrl];
+            [[NSFileManager defaultManager] removeItemAtURL:stagedUrl error:nil];
+            if (!blobData || blobData.length == 0)
+            {
+                return;
+            }
+
+            angle::MemoryBuffer data;
+            if (!data.resize(blobData.length))
+            {
+                return;
+            }
+            memcpy(data.data(), blobData.bytes, blobData.length);
+
+            egl::BlobCache::Key cacheKey;
+            computePipelineArchiveCacheKey(&cacheKey);
+            mDisplay->getBlobCache()->putApplication(cacheKey, data);
+        }
+    }
+}
+#endif  // ANGLE_MTL_BINARY_ARCHIVE_AVAILABLE
+
 id<MTLLibrary> DisplayMtl::getDefaultShadersLib()
 {
     std::unique_lock<std::mutex> lg(mDefaultShadersAsyncInfo->lock);
@@ -1979,11 +1979,11 @@ angle::Result TextureMtl::convertAndSetPerSliceSubImage(const gl::Context *conte
                     else
                     {
                         CopyImageCHROMIUM(psrc, pixelsRowPitch, pixelsAngleFormat.pixelBytes, 0,
-                                          pixelsAngleFormat.pixelReadFunction, conversionRow.data(),
-                                          dstRowPitch, dstFormat.pixelBytes, 0,
-                                          dstFormat.pixelWriteFunction, internalFormat.format,
-                                          dstFormat.componentType, mtlRow.size.width, 1, 1, false,
-                                          false, false);
+                                          pixelsAngleFormat.id, pixelsAngleFormat.pixelReadFunction,
+                                          conversionRow.data(), dstRowPitch, dstFormat.pixelBytes,
+                                          0, dstFormat.id, dstFormat.pixelWriteFunction,
+                                          internalFormat.format, dstFormat.componentType,
+                                          mtlRow.size.width, 1, 1, false, false, false);
                     }
 
                     // Upload to texture
@@ -2344,11 +2344,11 @@ angle::Result TextureMtl::copySubTextureCPU(const gl::Context *context,
 
     // Convert to destination format
     CopyImageCHROMIUM(conversionSrc.data(), srcRowPitch, sourceAngleFormat.pixelBytes, 0,
-                      sourceAngleFormat.pixelReadFunction, conversionDst.data(), convRowPitch,
-                      dstAngleFormat.pixelBytes, 0, dstAngleFormat.pixelWriteFunction,
-                      internalFormat.format, internalFormat.componentType, sourceBox.width,
-                      sourceBox.height, 1, unpackFlipY, unpackPremultiplyAlpha,
-                      unpackUnmultiplyAlpha);
+                      sourceAngleFormat.id, sourceAngleFormat.pixelReadFunction,
+                      conversionDst.data(), convRowPitch, dstAngleFormat.pixelBytes, 0,
+                      dstAngleFormat.id, dstAngleFormat.pixelWriteFunction, internalFormat.format,
+                      internalFormat.componentType, sourceBox.width, sourceBox.height, 1,
+                      unpackFlipY, unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
 
     // Upload to texture
     ANGLE_TRY(UploadTextureContents(context, dstAngleFormat, mtlDstArea, mtl::kZeroNativeMipLevel,
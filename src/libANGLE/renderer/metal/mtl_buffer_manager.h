@@ -11,6 +11,7 @@
 #define LIBANGLE_RENDERER_METAL_MTL_BUFFER_MANAGER_H_
 
 #include "common/FixedVector.h"
+#include "libANGLE/renderer/metal/mtl_buffer_pool.h"
 #include "libANGLE/renderer/metal/mtl_resources.h"
 
 #include <vector>
@@ -61,12 +62,22 @@ class BufferManager
     static constexpr size_t kMaxStagingBufferSize = 1024 * 1024;
     static constexpr size_t kMaxSizePowerOf2      = 64;
 
+    // Updates at most this size are suballocated from a shared staging ring instead of
+    // getting a dedicated staging buffer each. See queueBlitCopyDataToBuffer().
+    static constexpr size_t kSmallStagedUpdateMaxSize = 64 * 1024;
+
     angle::Result queueBlitCopyDataToBuffer(ContextMtl *contextMtl,
                                             const void *srcPtr,
                                             size_t sizeToCopy,
                                             size_t offset,
                                             mtl::BufferRef &dstMetalBuffer);
 
+    // Flushes the staging ring used for small staged updates. This issues a single
+    // didModifyRange covering every suballocation made since the last flush and recycles
+    // ring buffers the GPU has finished with. Must be called before committing the command
+    // buffer containing the queued blits.
+    void flushPendingStagedBlits(ContextMtl *contextMtl);
+
     angle::Result getBuffer(ContextMtl *contextMtl,
                             size_t size,
                             bool useSharedMem,
@@ -81,6 +92,12 @@ class BufferManager
 
     BufferList mInUseBuffers;
 
+    // Ring of staging buffers shared by small staged updates. Each small update writes to a
+    // previously unused region, so frequent glBufferSubData calls only cost one
+    // didModifyRange per command buffer instead of one per call.
+    BufferPool mStagingBufferRing;
+    bool mStagingBufferRingInitialized = false;
+
     angle::FixedVector<BufferList, kMaxSizePowerOf2> mFreeBuffers[2];
 #ifdef ANGLE_MTL_TRACK_BUFFER_MEM
     angle::FixedVector<size_t, kMaxSizePowerOf2> mAllocations;
@@ -74,6 +74,9 @@ int sharedMemToIndex(bool useSharedMem)
     return useSharedMem ? 1 : 0;
 }
 
+// Blit offsets must be multiples of 4 bytes, so align the staging ring accordingly.
+constexpr size_t kStagingBufferRingAlignment = 4;
+
 }  // namespace
 
 BufferManager::BufferManager()
@@ -95,6 +98,28 @@ void BufferManager::freeUnusedBuffers(ContextMtl *contextMtl)
         addBufferRefToFreeLists(*it);
     }
     mInUseBuffers.erase(mInUseBuffers.begin(), firstInUseIter);
+
+    // Under memory pressure, drop the idle free lists instead of keeping the buffers around
+    // for reuse so their memory is returned to the OS.
+    MemoryBudgetTracker *budgetTracker = contextMtl->getDisplay()->getMemoryBudgetTracker();
+    if (budgetTracker->isUnderPressure())
+    {
+        for (int sharedNdx = 0; sharedNdx < 2; ++sharedNdx)
+        {
+            for (BufferList &freeBuffers : mFreeBuffers[sharedNdx])
+            {
+                for (BufferRef &bufferRef : freeBuffers)
+                {
+                    budgetTracker->onDeallocation(GpuMemoryCategory::Buffer, bufferRef->size());
+#ifdef ANGLE_MTL_TRACK_BUFFER_MEM
+                    mTotalMem -= bufferRef->size();
+                    mAllocations[Log2Ceil(bufferRef->size())]--;
+#endif
+                }
+                freeBuffers.clear();
+            }
+        }
+    }
 }
 
 void BufferManager::addBufferRefToFreeLists(mtl::BufferRef &bufferRef)
@@ -144,6 +169,9 @@ angle::Result BufferManager::getBuffer(ContextMtl *contextMtl,
     ANGLE_TRY(mtl::Buffer::MakeBufferWithSharedMemOpt(contextMtl, useSharedMem, allocSize, nullptr,
                                                       &newBufferRef));
 
+    contextMtl->getDisplay()->getMemoryBudgetTracker()->onAllocation(GpuMemoryCategory::Buffer,
+                                                                     allocSize);
+
 #ifdef ANGLE_MTL_TRACK_BUFFER_MEM
     {
         mTotalMem += allocSize;
@@ -177,6 +205,33 @@ angle::Result BufferManager::queueBlitCopyDataToBuffer(ContextMtl *contextMtl,
     bool useShared =
         !contextMtl->getDisplay()->getFeatures().alwaysUseManagedStorageModeForBuffers.enabled;
 
+    // Small updates share a staging ring so that their managed-memory flushes can be
+    // coalesced into a single didModifyRange in flushPendingStagedBlits().
+    if (sizeToCopy <= kSmallStagedUpdateMaxSize)
+    {
+        if (!mStagingBufferRingInitialized)
+        {
+            mStagingBufferRing.setMemoryPolicy(useShared ? BufferPoolMemPolicy::AlwaysSharedMem
+                                                         : BufferPoolMemPolicy::AlwaysGPUMem);
+            mStagingBufferRing.initialize(contextMtl, kMaxStagingBufferSize,
+                                          kStagingBufferRingAlignment, 0);
+            mStagingBufferRingInitialized = true;
+        }
+
+        uint8_t *ptr = nullptr;
+        mtl::BufferRef stagingBuffer;
+        size_t stagingOffset = 0;
+        ANGLE_TRY(mStagingBufferRing.allocate(contextMtl, sizeToCopy, &ptr, &stagingBuffer,
+                                              &stagingOffset));
+        std::copy(src, src + sizeToCopy, ptr);
+
+        // The flush is deferred until the enclosing command buffer is committed.
+        mtl::BlitCommandEncoder *blitEncoder = contextMtl->getBlitCommandEncoder();
+        blitEncoder->copyBuffer(stagingBuffer, stagingOffset, dstMetalBuffer, offset, sizeToCopy);
+
+        return angle::Result::Continue;
+    }
+
     for (size_t srcOffset = 0; srcOffset < sizeToCopy; srcOffset += kMaxStagingBufferSize)
     {
         size_t subSizeToCopy = std::min(kMaxStagingBufferSize, sizeToCopy - srcOffset);
@@ -198,5 +253,18 @@ angle::Result BufferManager::queueBlitCopyDataToBuffer(ContextMtl *contextMtl,
     return angle::Result::Continue;
 }
 
+void BufferManager::flushPendingStagedBlits(ContextMtl *contextMtl)
+{
+    if (!mStagingBufferRingInitialized)
+    {
+        return;
+    }
+
+    // One didModifyRange covering everything staged since the last command buffer. No-op
+    // for shared memory rings.
+    (void)mStagingBufferRing.commit(contextMtl);
+    mStagingBufferRing.releaseInFlightBuffers(contextMtl);
+}
+
 }  // namespace mtl
 }  // namespace rx
@@ -15,6 +15,7 @@
 #import <QuartzCore/CAMetalLayer.h>
 #include <cstdint>
 
+#include <condition_variable>
 #include <deque>
 #include <memory>
 #include <mutex>
@@ -134,6 +135,14 @@ class CommandBuffer final : public WrappedObject<id<MTLCommandBuffer>>, angle::N
     void setActiveCommandEncoder(CommandEncoder *encoder);
     void invalidateActiveCommandEncoder(CommandEncoder *encoder);
 
+    // Private use only. Tracks a render pass being encoded on a background thread through an
+    // MTLParallelRenderCommandEncoder. Nothing else may be encoded into this command buffer until
+    // the background job finishes, so every other encoding path and commit first calls
+    // flushPendingParallelEncoding().
+    void onParallelEncodingStarted();
+    void onParallelEncodingFinished();
+    void flushPendingParallelEncoding();
+
     bool needsFlushForDrawCallLimits() const;
 
   private:
@@ -171,6 +180,10 @@ class CommandBuffer final : public WrappedObject<id<MTLCommandBuffer>>, angle::N
     std::unordered_set<id> mResourceList;
     size_t mWorkingResourceSize = 0;
     bool mCommitted             = false;
+
+    std::mutex mParallelEncodingMutex;
+    std::condition_variable mParallelEncodingCv;
+    bool mParallelEncodingPending = false;
 };
 
 class CommandEncoder : public WrappedObject<id<MTLCommandEncoder>>, angle::NonCopyable
@@ -273,6 +286,8 @@ class IntermediateCommandStream
 
     inline bool good() const { return mReadPtr < mBuffer.size(); }
 
+    inline size_t size() const { return mBuffer.size(); }
+
   private:
     std::vector<uint8_t> mBuffer;
     size_t mReadPtr = 0;
@@ -516,6 +531,7 @@ class RenderCommandEncoder final : public CommandEncoder
     void finalizeLoadStoreAction(MTLRenderPassAttachmentDescriptor *objCRenderPassAttachment);
 
     void encodeMetalEncoder();
+    void encodeMetalEncoderParallel();
     void simulateDiscardFramebuffer();
     void endEncodingImpl(bool considerDiscardSimulation);
 
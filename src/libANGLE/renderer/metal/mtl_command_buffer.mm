@@ -82,6 +82,11 @@ enum class CmdType : uint8_t
     ANGLE_MTL_CMD_X(ANGLE_MTL_TYPE_DECL)
 };
 
+// Minimum size of a recorded command stream before replaying it through an
+// MTLParallelRenderCommandEncoder on a background thread. Small passes are cheaper to encode
+// inline than to hand off.
+constexpr size_t kMinCommandStreamSizeForParallelEncoding = 16 * 1024;
+
 // Commands decoder
 inline void InvalidCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandStream *stream)
 {
@@ -793,6 +798,28 @@ void CommandBuffer::set(id<MTLCommandBuffer> metalBuffer)
     ParentClass::set(metalBuffer);
 }
 
+void CommandBuffer::onParallelEncodingStarted()
+{
+    std::lock_guard<std::mutex> lg(mParallelEncodingMutex);
+    // Only one background encoding job can be in flight: starting a new one requires ending the
+    // previous pass's parallel encoder first, which goes through flushPendingParallelEncoding().
+    ASSERT(!mParallelEncodingPending);
+    mParallelEncodingPending = true;
+}
+
+void CommandBuffer::onParallelEncodingFinished()
+{
+    std::lock_guard<std::mutex> lg(mParallelEncodingMutex);
+    mParallelEncodingPending = false;
+    mParallelEncodingCv.notify_all();
+}
+
+void CommandBuffer::flushPendingParallelEncoding()
+{
+    std::unique_lock<std::mutex> lg(mParallelEncodingMutex);
+    mParallelEncodingCv.wait(lg, [this] { return !mParallelEncodingPending; });
+}
+
 void CommandBuffer::setActiveCommandEncoder(CommandEncoder *encoder)
 {
     mActiveCommandEncoder = encoder;
@@ -845,6 +872,10 @@ bool CommandBuffer::commitImpl()
     // End the current encoder
     forceEndingCurrentEncoder();
 
+    // Ending a render encoder may have kicked off a background encoding job; it must finish
+    // before the command buffer can be committed.
+    flushPendingParallelEncoding();
+
     // Encoding any pending event's signalling.
     setPendingEvents();
 
@@ -887,6 +918,7 @@ void CommandBuffer::setEventImpl(const mtl::SharedEventRef &event, uint64_t valu
     // For non-render command encoder, we can safely end it, so that we can encode a signal
     // event.
     forceEndingCurrentEncoder();
+    flushPendingParallelEncoding();
 
     [get() encodeSignalEvent:event value:value];
 #else
@@ -901,6 +933,7 @@ void CommandBuffer::waitEventImpl(const mtl::SharedEventRef &event, uint64_t val
     ASSERT(!mActiveCommandEncoder || mActiveCommandEncoder->getType() != CommandEncoder::RENDER);
 
     forceEndingCurrentEncoder();
+    flushPendingParallelEncoding();
 
     // Encoding any pending event's signalling.
     setPendingEvents();
@@ -1294,6 +1327,16 @@ void RenderCommandEncoder::encodeMetalEncoder()
 {
     ANGLE_MTL_OBJC_SCOPE
     {
+        // The previous pass may still be encoding on a background thread; only one pass can be
+        // encoded into the command buffer at a time.
+        cmdBuffer().flushPendingParallelEncoding();
+
+        if (mCommands.size() >= kMinCommandStreamSizeForParallelEncoding)
+        {
+            encodeMetalEncoderParallel();
+            return;
+        }
+
         ANGLE_MTL_LOG("Creating new render command encoder with desc: %@",
                       [mCachedRenderPassDescObjC description]);
 
@@ -1332,6 +1375,63 @@ void RenderCommandEncoder::encodeMetalEncoder()
     }
 }
 
+void RenderCommandEncoder::encodeMetalEncoderParallel()
+{
+    ANGLE_MTL_LOG("Creating new parallel render command encoder with desc: %@",
+                  [mCachedRenderPassDescObjC description]);
+
+    id<MTLParallelRenderCommandEncoder> parallelEncoder =
+        [cmdBuffer().get() parallelRenderCommandEncoderWithDescriptor:mCachedRenderPassDescObjC];
+    id<MTLRenderCommandEncoder> metalCmdEncoder = [parallelEncoder renderCommandEncoder];
+
+    // Verify that they were created successfully
+    ASSERT(parallelEncoder);
+    ASSERT(metalCmdEncoder);
+
+    // Work-around driver bug on iOS devices: stencil must be explicitly set to zero
+    // even if the doc says the default value is already zero.
+    [metalCmdEncoder setStencilReferenceValue:0];
+
+    if (mLabel)
+    {
+        parallelEncoder.label = mLabel;
+        metalCmdEncoder.label = mLabel;
+    }
+
+    // Hand the recorded stream to a background thread; the command buffer blocks any further
+    // encoding until the job signals completion. This overlaps replaying this pass with the GL
+    // thread recording the next one.
+    auto commands = std::make_shared<IntermediateCommandStream>(std::move(mCommands));
+    mCommands.clear();
+
+    CommandBuffer *commandBufferPtr = &cmdBuffer();
+    commandBufferPtr->onParallelEncodingStarted();
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INTERACTIVE, 0), ^{
+      ANGLE_MTL_OBJC_SCOPE
+      {
+          while (commands->good())
+          {
+              CmdType cmdType = commands->fetch<CmdType>();
+              switch (cmdType)
+              {
+#define ANGLE_MTL_CMD_MAP(CMD)                     \
+    case CmdType::CMD:                             \
+        CMD##Cmd(metalCmdEncoder, commands.get()); \
+        break;
+                  ANGLE_MTL_CMD_X(ANGLE_MTL_CMD_MAP)
+#undef ANGLE_MTL_CMD_MAP
+              }
+          }
+          commands->clear();
+
+          [metalCmdEncoder endEncoding];
+          [parallelEncoder endEncoding];
+
+          commandBufferPtr->onParallelEncodingFinished();
+      }
+    });
+}
+
 RenderCommandEncoder &RenderCommandEncoder::restart(const RenderPassDesc &desc,
                                                     uint32_t deviceMaxRenderTargets)
 {
@@ -2016,6 +2116,7 @@ BlitCommandEncoder &BlitCommandEncoder::restart()
         }
 
         // Create objective C object
+        cmdBuffer().flushPendingParallelEncoding();
         set([cmdBuffer().get() blitCommandEncoder]);
 
         // Verify that it was created successfully
@@ -2249,6 +2350,7 @@ ComputeCommandEncoder &ComputeCommandEncoder::restart()
         }
 
         // Create objective C object
+        cmdBuffer().flushPendingParallelEncoding();
         set([cmdBuffer().get() computeCommandEncoder]);
 
         // Verify that it was created successfully
@@ -15,6 +15,7 @@
 #include "common/debug.h"
 #include "common/hash_utils.h"
 #include "libANGLE/renderer/metal/ContextMtl.h"
+#include "libANGLE/renderer/metal/DisplayMtl.h"
 #include "libANGLE/renderer/metal/mtl_resources.h"
 #include "libANGLE/renderer/metal/mtl_utils.h"
 #include "platform/FeaturesMtl_autogen.h"
@@ -1039,6 +1040,27 @@ AutoObjCPtr<id<MTLRenderPipelineState>> RenderPipelineCache::createRenderPipelin
             [objCDesc.get().vertexDescriptor.layouts setObject:defaultAttribLayoutObjCDesc
                                             atIndexedSubscript:kDefaultAttribsBindingIndex];
         }
+
+#if ANGLE_MTL_BINARY_ARCHIVE_AVAILABLE
+        if (@available(iOS 14.0, macOS 11.0, *))
+        {
+            DisplayMtl *display          = context->getDisplay();
+            id<MTLBinaryArchive> archive = display->getPipelineBinaryArchive();
+            if (archive)
+            {
+                // Record the functions into the shared archive and let pipeline creation look the
+                // compiled binary up there, so repeat runs skip the Metal compiler entirely.
+                NSError *archiveErr = nil;
+                if ([archive addRenderPipelineFunctionsWithDescriptor:objCDesc.get()
+                                                                error:&archiveErr])
+                {
+                    display->onPipelineAddedToBinaryArchive();
+                }
+                objCDesc.get().binaryArchives = @[ archive ];
+            }
+        }
+#endif
+
         // Create pipeline state
         NSError *err  = nil;
         auto newState = metalDevice.newRenderPipelineStateWithDescriptor(objCDesc, &err);
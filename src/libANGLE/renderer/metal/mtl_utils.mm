@@ -406,9 +406,9 @@ angle::Result InitializeTextureContents(const gl::Context *context,
             ANGLE_CHECK_GL_ALLOC(contextMtl, srcRow.resize(srcRowPitch));
             memset(srcRow.data(), 0, srcRowPitch);
 
-            CopyImageCHROMIUM(srcRow.data(), srcRowPitch, srcFormat.pixelBytes, 0,
+            CopyImageCHROMIUM(srcRow.data(), srcRowPitch, srcFormat.pixelBytes, 0, srcFormat.id,
                               srcFormat.pixelReadFunction, conversionRow.data(), dstRowPitch,
-                              dstFormat.pixelBytes, 0, dstFormat.pixelWriteFunction,
+                              dstFormat.pixelBytes, 0, dstFormat.id, dstFormat.pixelWriteFunction,
                               intendedInternalFormat.format, dstFormat.componentType, size.width, 1,
                               1, false, false, false);
         }
@@ -9,7 +9,11 @@
 
 #include "libANGLE/renderer/null/ContextNULL.h"
 
+#include <chrono>
+#include <cstdlib>
+
 #include "common/debug.h"
+#include "common/system_utils.h"
 
 #include "libANGLE/Context.h"
 #include "libANGLE/renderer/OverlayImpl.h"
@@ -33,6 +37,21 @@
 namespace rx
 {
 
+namespace
+{
+
+int64_t GetSimulatedTimeNs(const char *environmentVariable)
+{
+    const std::string value = angle::GetEnvironmentVar(environmentVariable);
+    if (value.empty())
+    {
+        return 0;
+    }
+    return strtoll(value.c_str(), nullptr, 10);
+}
+
+}  // anonymous namespace
+
 AllocationTrackerNULL::AllocationTrackerNULL(size_t maxTotalAllocationSize)
     : mAllocatedBytes(0), mMaxBytes(maxTotalAllocationSize)
 {}
@@ -62,7 +81,10 @@ bool AllocationTrackerNULL::updateMemoryAllocation(size_t oldSize, size_t newSiz
 ContextNULL::ContextNULL(const gl::State &state,
                          gl::ErrorSet *errorSet,
                          AllocationTrackerNULL *allocationTracker)
-    : ContextImpl(state, errorSet), mAllocationTracker(allocationTracker)
+    : ContextImpl(state, errorSet),
+      mAllocationTracker(allocationTracker),
+      mSimulatedDrawTimeNs(GetSimulatedTimeNs("ANGLE_NULL_SIMULATED_DRAW_TIME_NS")),
+      mSimulatedFlushTimeNs(GetSimulatedTimeNs("ANGLE_NULL_SIMULATED_FLUSH_TIME_NS"))
 {
     ASSERT(mAllocationTracker != nullptr);
 
@@ -115,6 +137,21 @@ ContextNULL::ContextNULL(const gl::State &state,
 
 ContextNULL::~ContextNULL() {}
 
+void ContextNULL::simulateBackendWork(int64_t durationNs) const
+{
+    if (ANGLE_LIKELY(durationNs <= 0))
+    {
+        return;
+    }
+
+    // Busy-wait instead of sleeping: scheduler wake-up jitter would dwarf the calibrated
+    // durations this is meant to model.
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::nanoseconds(durationNs);
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+    }
+}
+
 angle::Result ContextNULL::initialize()
 {
     return angle::Result::Continue;
@@ -122,11 +159,13 @@ angle::Result ContextNULL::initialize()
 
 angle::Result ContextNULL::flush(const gl::Context *context)
 {
+    simulateBackendWork(mSimulatedFlushTimeNs);
     return angle::Result::Continue;
 }
 
 angle::Result ContextNULL::finish(const gl::Context *context)
 {
+    simulateBackendWork(mSimulatedFlushTimeNs);
     return angle::Result::Continue;
 }
 
@@ -135,6 +174,7 @@ angle::Result ContextNULL::drawArrays(const gl::Context *context,
                                       GLint first,
                                       GLsizei count)
 {
+    simulateBackendWork(mSimulatedDrawTimeNs);
     return angle::Result::Continue;
 }
 
@@ -144,6 +184,7 @@ angle::Result ContextNULL::drawArraysInstanced(const gl::Context *context,
                                                GLsizei count,
                                                GLsizei instanceCount)
 {
+    simulateBackendWork(mSimulatedDrawTimeNs);
     return angle::Result::Continue;
 }
 
@@ -154,6 +195,7 @@ angle::Result ContextNULL::drawArraysInstancedBaseInstance(const gl::Context *co
                                                            GLsizei instanceCount,
                                                            GLuint baseInstance)
 {
+    simulateBackendWork(mSimulatedDrawTimeNs);
     return angle::Result::Continue;
 }
 
@@ -163,6 +205,7 @@ angle::Result ContextNULL::drawElements(const gl::Context *context,
                                         gl::DrawElementsType type,
                                         const void *indices)
 {
+    simulateBackendWork(mSimulatedDrawTimeNs);
     return angle::Result::Continue;
 }
 
@@ -173,6 +216,7 @@ angle::Result ContextNULL::drawElementsBaseVertex(const gl::Context *context,
                                                   const void *indices,
                                                   GLint baseVertex)
 {
+    simulateBackendWork(mSimulatedDrawTimeNs);
     return angle::Result::Continue;
 }
 
@@ -183,6 +227,7 @@ angle::Result ContextNULL::drawElementsInstanced(const gl::Context *context,
                                                  const void *indices,
                                                  GLsizei instances)
 {
+    simulateBackendWork(mSimulatedDrawTimeNs);
     return angle::Result::Continue;
 }
 
@@ -194,6 +239,7 @@ angle::Result ContextNULL::drawElementsInstancedBaseVertex(const gl::Context *co
                                                            GLsizei instances,
                                                            GLint baseVertex)
 {
+    simulateBackendWork(mSimulatedDrawTimeNs);
     return angle::Result::Continue;
 }
 
@@ -206,6 +252,7 @@ angle::Result ContextNULL::drawElementsInstancedBaseVertexBaseInstance(const gl:
                                                                        GLint baseVertex,
                                                                        GLuint baseInstance)
 {
+    simulateBackendWork(mSimulatedDrawTimeNs);
     return angle::Result::Continue;
 }
 
@@ -217,6 +264,7 @@ angle::Result ContextNULL::drawRangeElements(const gl::Context *context,
                                              gl::DrawElementsType type,
                                              const void *indices)
 {
+    simulateBackendWork(mSimulatedDrawTimeNs);
     return angle::Result::Continue;
 }
 
@@ -229,6 +277,7 @@ angle::Result ContextNULL::drawRangeElementsBaseVertex(const gl::Context *contex
                                                        const void *indices,
                                                        GLint baseVertex)
 {
+    simulateBackendWork(mSimulatedDrawTimeNs);
     return angle::Result::Continue;
 }
 
@@ -236,6 +285,7 @@ angle::Result ContextNULL::drawArraysIndirect(const gl::Context *context,
                                               gl::PrimitiveMode mode,
                                               const void *indirect)
 {
+    simulateBackendWork(mSimulatedDrawTimeNs);
     return angle::Result::Continue;
 }
 
@@ -244,6 +294,7 @@ angle::Result ContextNULL::drawElementsIndirect(const gl::Context *context,
                                                 gl::DrawElementsType type,
                                                 const void *indirect)
 {
+    simulateBackendWork(mSimulatedDrawTimeNs);
     return angle::Result::Continue;
 }
 
@@ -253,6 +304,7 @@ angle::Result ContextNULL::multiDrawArrays(const gl::Context *context,
                                            const GLsizei *counts,
                                            GLsizei drawcount)
 {
+    simulateBackendWork(mSimulatedDrawTimeNs);
     return angle::Result::Continue;
 }
 
@@ -263,6 +315,7 @@ angle::Result ContextNULL::multiDrawArraysInstanced(const gl::Context *context,
                                                     const GLsizei *instanceCounts,
                                                     GLsizei drawcount)
 {
+    simulateBackendWork(mSimulatedDrawTimeNs);
     return angle::Result::Continue;
 }
 
@@ -272,6 +325,7 @@ angle::Result ContextNULL::multiDrawArraysIndirect(const gl::Context *context,
                                                    GLsizei drawcount,
                                                    GLsizei stride)
 {
+    simulateBackendWork(mSimulatedDrawTimeNs);
     return angle::Result::Continue;
 }
 
@@ -282,6 +336,7 @@ angle::Result ContextNULL::multiDrawElements(const gl::Context *context,
                                              const GLvoid *const *indices,
                                              GLsizei drawcount)
 {
+    simulateBackendWork(mSimulatedDrawTimeNs);
     return angle::Result::Continue;
 }
 
@@ -293,6 +348,7 @@ angle::Result ContextNULL::multiDrawElementsInstanced(const gl::Context *context
                                                       const GLsizei *instanceCounts,
                                                       GLsizei drawcount)
 {
+    simulateBackendWork(mSimulatedDrawTimeNs);
     return angle::Result::Continue;
 }
 
@@ -303,6 +359,7 @@ angle::Result ContextNULL::multiDrawElementsIndirect(const gl::Context *context,
                                                      GLsizei drawcount,
                                                      GLsizei stride)
 {
+    simulateBackendWork(mSimulatedDrawTimeNs);
     return angle::Result::Continue;
 }
 
@@ -314,6 +371,7 @@ angle::Result ContextNULL::multiDrawArraysInstancedBaseInstance(const gl::Contex
                                                                 const GLuint *baseInstances,
                                                                 GLsizei drawcount)
 {
+    simulateBackendWork(mSimulatedDrawTimeNs);
     return angle::Result::Continue;
 }
 
@@ -328,6 +386,7 @@ angle::Result ContextNULL::multiDrawElementsInstancedBaseVertexBaseInstance(
     const GLuint *baseInstances,
     GLsizei drawcount)
 {
+    simulateBackendWork(mSimulatedDrawTimeNs);
     return angle::Result::Continue;
 }
 
@@ -506,11 +565,13 @@ angle::Result ContextNULL::dispatchCompute(const gl::Context *context,
                                            GLuint numGroupsY,
                                            GLuint numGroupsZ)
 {
+    simulateBackendWork(mSimulatedDrawTimeNs);
     return angle::Result::Continue;
 }
 
 angle::Result ContextNULL::dispatchComputeIndirect(const gl::Context *context, GLintptr indirect)
 {
+    simulateBackendWork(mSimulatedDrawTimeNs);
     return angle::Result::Continue;
 }
 
@@ -263,12 +263,23 @@ class ContextNULL : public ContextImpl
                      unsigned int line);
 
   private:
+    // Busy-waits for the given duration to model backend cost. Used for CPU load testing:
+    // with the ANGLE_NULL_SIMULATED_DRAW_TIME_NS and ANGLE_NULL_SIMULATED_FLUSH_TIME_NS
+    // environment variables set, the full frontend path (validation, state sync, dirty
+    // bits) executes against a deterministic per-command backend cost with no GPU variance.
+    void simulateBackendWork(int64_t durationNs) const;
+
     gl::Caps mCaps;
     gl::TextureCapsMap mTextureCaps;
     gl::Extensions mExtensions;
     gl::Limitations mLimitations;
 
     AllocationTrackerNULL *mAllocationTracker;
+
+    // Simulated backend cost per draw/dispatch and per flush/finish, in nanoseconds.
+    // Zero (the default) disables the simulation.
+    int64_t mSimulatedDrawTimeNs;
+    int64_t mSimulatedFlushTimeNs;
 };
 
 }  // namespace rx
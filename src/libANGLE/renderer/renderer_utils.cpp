@@ -9,6 +9,7 @@
 
 #include "libANGLE/renderer/renderer_utils.h"
 
+#include "common/WorkerThread.h"
 #include "common/string_utils.h"
 #include "common/system_utils.h"
 #include "common/utilities.h"
@@ -199,6 +200,33 @@ void ClipChannelsAlpha(gl::ColorF *color)
 
 void ClipChannelsNoOp(gl::ColorF *color) {}
 
+// Returns whether clipping the channels absent from destUnsizedFormat can change bytes actually
+// stored by the destination format.  When the destination doesn't store the clipped channels
+// (e.g. a GL_RG destination backed by R8G8), the clip is a no-op on storage and bitwise copies
+// are safe.  An emulated destination (e.g. GL_RGB backed by R8G8B8A8) does store a clipped
+// channel, so it must stay on the per-pixel path that forces alpha to 1.
+bool ClipChannelsCanAffectStorage(GLenum destUnsizedFormat, angle::FormatID destFormatID)
+{
+    const angle::Format &destFormat = angle::Format::Get(destFormatID);
+    switch (destUnsizedFormat)
+    {
+        case GL_RED:
+            return destFormat.greenBits != 0 || destFormat.blueBits != 0 ||
+                   destFormat.alphaBits != 0;
+        case GL_RG:
+            return destFormat.blueBits != 0 || destFormat.alphaBits != 0;
+        case GL_RGB:
+            return destFormat.alphaBits != 0;
+        case GL_LUMINANCE:
+        case GL_ALPHA:
+            // Luminance and alpha destinations are emulated with color formats whose channels
+            // don't line up with the original format; stay on the per-pixel path for them.
+            return true;
+        default:
+            return false;
+    }
+}
+
 void WriteUintColor(const gl::ColorF &color,
                     PixelWriteFunction colorWriteFunction,
                     uint8_t *destPixelData)
@@ -301,6 +329,52 @@ void SetFloatUniformMatrixFast(unsigned int arrayElementOffset,
 
     memcpy(targetData, valueData, matrixSize * count);
 }
+
+// Generates one band of destination rows of a mip level.
+class GenerateMipBandTask : public angle::Closure
+{
+  public:
+    GenerateMipBandTask(MipGenerationFunction generationFunction,
+                        size_t sourceWidth,
+                        size_t sourceHeight,
+                        const uint8_t *sourceData,
+                        size_t sourceRowPitch,
+                        size_t sourceDepthPitch,
+                        uint8_t *destData,
+                        size_t destRowPitch,
+                        size_t destDepthPitch)
+        : mGenerationFunction(generationFunction),
+          mSourceWidth(sourceWidth),
+          mSourceHeight(sourceHeight),
+          mSourceData(sourceData),
+          mSourceRowPitch(sourceRowPitch),
+          mSourceDepthPitch(sourceDepthPitch),
+          mDestData(destData),
+          mDestRowPitch(destRowPitch),
+          mDestDepthPitch(destDepthPitch)
+    {}
+
+    void operator()() override
+    {
+        mGenerationFunction(mSourceWidth, mSourceHeight, 1, mSourceData, mSourceRowPitch,
+                            mSourceDepthPitch, mDestData, mDestRowPitch, mDestDepthPitch);
+    }
+
+  private:
+    MipGenerationFunction mGenerationFunction;
+    size_t mSourceWidth;
+    size_t mSourceHeight;
+    const uint8_t *mSourceData;
+    size_t mSourceRowPitch;
+    size_t mSourceDepthPitch;
+    uint8_t *mDestData;
+    size_t mDestRowPitch;
+    size_t mDestDepthPitch;
+};
+
+// Bands below this many destination rows aren't worth a worker thread wakeup.
+constexpr size_t kMinMipRowsPerBand = 64;
+constexpr size_t kMaxMipBands       = 8;
 }  // anonymous namespace
 
 bool IsRotatedAspectRatio(SurfaceRotation rotation)
@@ -361,6 +435,51 @@ void RotateRectangle(const SurfaceRotation rotation,
     }
 }
 
+void GenerateMipWithWorkerPool(MipGenerationFunction generationFunction,
+                               const std::shared_ptr<angle::WorkerThreadPool> &workerPool,
+                               size_t sourceWidth,
+                               size_t sourceHeight,
+                               size_t sourceDepth,
+                               const uint8_t *sourceData,
+                               size_t sourceRowPitch,
+                               size_t sourceDepthPitch,
+                               uint8_t *destData,
+                               size_t destRowPitch,
+                               size_t destDepthPitch)
+{
+    const size_t destHeight = std::max<size_t>(1, sourceHeight >> 1);
+    const size_t bandCount  = std::min(destHeight / kMinMipRowsPerBand, kMaxMipBands);
+
+    if (sourceDepth > 1 || sourceHeight <= 1 || bandCount < 2 || !workerPool ||
+        !workerPool->isAsync())
+    {
+        generationFunction(sourceWidth, sourceHeight, sourceDepth, sourceData, sourceRowPitch,
+                           sourceDepthPitch, destData, destRowPitch, destDepthPitch);
+        return;
+    }
+
+    std::vector<std::shared_ptr<angle::WaitableEvent>> waitableEvents;
+    waitableEvents.reserve(bandCount);
+
+    const size_t rowsPerBand = destHeight / bandCount;
+    for (size_t band = 0; band < bandCount; ++band)
+    {
+        const size_t firstDestRow = band * rowsPerBand;
+        const size_t bandDestRows =
+            (band + 1 == bandCount) ? destHeight - firstDestRow : rowsPerBand;
+
+        // Each destination row is filtered from source rows 2y and 2y+1, so a band of destination
+        // rows maps to twice as many source rows starting at twice the row offset.
+        std::shared_ptr<GenerateMipBandTask> task = std::make_shared<GenerateMipBandTask>(
+            generationFunction, sourceWidth, bandDestRows * 2,
+            sourceData + firstDestRow * 2 * sourceRowPitch, sourceRowPitch, sourceDepthPitch,
+            destData + firstDestRow * destRowPitch, destRowPitch, destDepthPitch);
+        waitableEvents.push_back(workerPool->postWorkerTask(std::move(task)));
+    }
+
+    angle::WaitableEvent::WaitMany(&waitableEvents);
+}
+
 PackPixelsParams::PackPixelsParams()
     : destFormat(nullptr),
       outputPitch(0),
@@ -560,11 +679,13 @@ void CopyImageCHROMIUM(const uint8_t *sourceData,
                        size_t sourceRowPitch,
                        size_t sourcePixelBytes,
                        size_t sourceDepthPitch,
+                       angle::FormatID sourceFormatID,
                        PixelReadFunction pixelReadFunction,
                        uint8_t *destData,
                        size_t destRowPitch,
                        size_t destPixelBytes,
                        size_t destDepthPitch,
+                       angle::FormatID destFormatID,
                        PixelWriteFunction pixelWriteFunction,
                        GLenum destUnsizedFormat,
                        GLenum destComponentType,
@@ -575,6 +696,54 @@ void CopyImageCHROMIUM(const uint8_t *sourceData,
                        bool unpackPremultiplyAlpha,
                        bool unpackUnmultiplyAlpha)
 {
+    // Fast paths for copies that don't change pixel values: same-format copies collapse to row
+    // memcpys, and the BGRA8<->RGBA8 pair uses the packed swizzle kernel.  Atlas packers hit these
+    // with thousands of small CopySubImage calls, where the per-pixel ColorF round-trip below
+    // dominates.  Neither path applies when an alpha conversion is requested or when channel
+    // clipping would alter stored bytes.
+    const bool canCopyBitwise = unpackPremultiplyAlpha == unpackUnmultiplyAlpha &&
+                                !ClipChannelsCanAffectStorage(destUnsizedFormat, destFormatID);
+
+    if (canCopyBitwise && sourceFormatID == destFormatID)
+    {
+        ASSERT(sourcePixelBytes == destPixelBytes);
+        const size_t rowSize = width * sourcePixelBytes;
+        for (size_t z = 0; z < depth; z++)
+        {
+            for (size_t y = 0; y < height; y++)
+            {
+                const size_t destY = unpackFlipY ? height - 1 - y : y;
+                memcpy(destData + destY * destRowPitch + z * destDepthPitch,
+                       sourceData + y * sourceRowPitch + z * sourceDepthPitch, rowSize);
+            }
+        }
+        return;
+    }
+
+    const bool isBGRASwizzle = (sourceFormatID == angle::FormatID::B8G8R8A8_UNORM &&
+                                destFormatID == angle::FormatID::R8G8B8A8_UNORM) ||
+                               (sourceFormatID == angle::FormatID::R8G8B8A8_UNORM &&
+                                destFormatID == angle::FormatID::B8G8R8A8_UNORM);
+    if (canCopyBitwise && isBGRASwizzle)
+    {
+        // Swapping red and blue is symmetric, so the same kernel serves both directions.  A
+        // y-flip is a negative destination pitch starting at the last row.
+        for (size_t z = 0; z < depth; z++)
+        {
+            const uint8_t *src = sourceData + z * sourceDepthPitch;
+            uint8_t *dest      = destData + z * destDepthPitch;
+            int destPitch      = static_cast<int>(destRowPitch);
+            if (unpackFlipY)
+            {
+                dest += (height - 1) * destRowPitch;
+                destPitch = -destPitch;
+            }
+            angle::CopyBGRA8ToRGBA8(src, 4, static_cast<int>(sourceRowPitch), dest, 4, destPitch,
+                                    static_cast<int>(width), static_cast<int>(height));
+        }
+        return;
+    }
+
     using ConversionFunction              = void (*)(gl::ColorF *);
     ConversionFunction conversionFunction = CopyColor;
     if (unpackPremultiplyAlpha != unpackUnmultiplyAlpha)
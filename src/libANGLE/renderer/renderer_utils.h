@@ -14,6 +14,7 @@
 
 #include <limits>
 #include <map>
+#include <memory>
 
 #include "GLSLANG/ShaderLang.h"
 #include "common/angleutils.h"
@@ -25,6 +26,7 @@ namespace angle
 struct FeatureSetBase;
 struct Format;
 struct ImageLoadContext;
+class WorkerThreadPool;
 enum class FormatID;
 }  // namespace angle
 
@@ -83,6 +85,22 @@ using MipGenerationFunction = void (*)(size_t sourceWidth,
                                        size_t destRowPitch,
                                        size_t destDepthPitch);
 
+// Generates a mip level with |generationFunction|, splitting the destination rows of large 2D
+// levels into bands dispatched on the worker pool.  The box filter only reads the source rows
+// feeding each destination row, so bands are independent.  Small levels, 1D/3D images and
+// synchronous pools take a single call on the current thread.
+void GenerateMipWithWorkerPool(MipGenerationFunction generationFunction,
+                               const std::shared_ptr<angle::WorkerThreadPool> &workerPool,
+                               size_t sourceWidth,
+                               size_t sourceHeight,
+                               size_t sourceDepth,
+                               const uint8_t *sourceData,
+                               size_t sourceRowPitch,
+                               size_t sourceDepthPitch,
+                               uint8_t *destData,
+                               size_t destRowPitch,
+                               size_t destDepthPitch);
+
 typedef void (*PixelReadFunction)(const uint8_t *source, uint8_t *dest);
 typedef void (*PixelWriteFunction)(const uint8_t *source, uint8_t *dest);
 typedef void (*FastCopyFunction)(const uint8_t *source,
@@ -177,11 +195,13 @@ void CopyImageCHROMIUM(const uint8_t *sourceData,
                        size_t sourceRowPitch,
                        size_t sourcePixelBytes,
                        size_t sourceDepthPitch,
+                       angle::FormatID sourceFormatID,
                        PixelReadFunction pixelReadFunction,
                        uint8_t *destData,
                        size_t destRowPitch,
                        size_t destPixelBytes,
                        size_t destDepthPitch,
+                       angle::FormatID destFormatID,
                        PixelWriteFunction pixelWriteFunction,
                        GLenum destUnsizedFormat,
                        GLenum destComponentType,
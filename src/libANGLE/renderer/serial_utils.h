@@ -81,6 +81,12 @@ class Serial final
 };
 
 // Defines class to track the queue serial that can be load/store from multiple threads atomically.
+//
+// Memory-ordering contract: the owning thread publishes a new serial with a release store, and
+// readers observe it with an acquire load, so everything written before the serial was advanced
+// (fence signals, completed-batch state) is visible to a thread that reads the new value.  The
+// value only grows; readers may observe a stale (smaller) serial but never a torn or decreasing
+// one.
 class AtomicQueueSerial final
 {
   public:
@@ -90,7 +96,7 @@ class AtomicQueueSerial final
         mValue.store(other.mValue, std::memory_order_release);
         return *this;
     }
-    Serial getSerial() const { return Serial(mValue.load(std::memory_order_consume)); }
+    Serial getSerial() const { return Serial(mValue.load(std::memory_order_acquire)); }
 
   private:
     std::atomic<uint64_t> mValue;
@@ -108,12 +114,21 @@ class SerialFactoryBase final : angle::NonCopyable
 
     Serial generate()
     {
-        uint64_t current = mSerial++;
-        ASSERT(mSerial > current);  // Integer overflow
+        uint64_t current = next(mSerial);
+        ASSERT(current < std::numeric_limits<uint64_t>::max());  // Integer overflow
         return Serial(current);
     }
 
   private:
+    static uint64_t next(uint64_t &serial) { return serial++; }
+    static uint64_t next(std::atomic<uint64_t> &serial)
+    {
+        // A single wait-free RMW.  Relaxed ordering suffices: monotonicity and uniqueness come
+        // from the RMW itself, and generated serials are only made visible to other threads
+        // through AtomicQueueSerial's release store (see above).
+        return serial.fetch_add(1, std::memory_order_relaxed);
+    }
+
     SerialBaseType mSerial;
 };
 
@@ -9,12 +9,15 @@
 
 #include "libANGLE/renderer/vulkan/BufferVk.h"
 
+#include <algorithm>
+
 #include "common/FixedVector.h"
 #include "common/debug.h"
 #include "common/mathutil.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/renderer/vulkan/ContextVk.h"
+#include "libANGLE/renderer/vulkan/DisplayVk.h"
 #include "libANGLE/renderer/vulkan/RendererVk.h"
 
 namespace rx
@@ -59,6 +62,14 @@ static_assert(gl::isPow2(kBufferSizeGranularity), "use as alignment, must be pow
 // Start with a fairly small buffer size. We can increase this dynamically as we convert more data.
 constexpr size_t kConvertedArrayBufferInitialSize = 1024 * 8;
 
+// Upper bound on the CPU shadow used to coalesce small glBufferSubData updates
+// (coalesceSmallBufferUpdates); once exceeded, the pending updates are flushed immediately.
+constexpr size_t kMaxPendingSubDataBytes = 1024 * 1024;
+
+// Number of staged CPU writes to device-local storage after which the storage is migrated to
+// DEVICE_LOCAL|HOST_VISIBLE memory (adaptiveBufferMemoryType).
+constexpr uint32_t kPromoteToHostVisibleEvidence = 16;
+
 // Buffers that have a static usage pattern will be allocated in
 // device local memory to speed up access to and from the GPU.
 // Dynamic usage patterns or that are frequently mapped
@@ -105,6 +116,14 @@ VkMemoryPropertyFlags GetStorageMemoryType(RendererVk *renderer,
     const bool hasMapAccess =
         (storageFlags & (GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT_EXT)) != 0;
 
+    // Persistent-mapped buffer storage is written through the mapping while the GPU reads it; with
+    // resizable BAR or UMA the DEVICE_LOCAL|HOST_VISIBLE heap serves both sides without staging.
+    if (renderer->getFeatures().adaptiveBufferMemoryType.enabled &&
+        (storageFlags & GL_MAP_PERSISTENT_BIT_EXT) != 0)
+    {
+        return kDeviceLocalHostCoherentFlags;
+    }
+
     if (renderer->getFeatures().preferDeviceLocalMemoryHostVisible.enabled)
     {
         const bool canUpdate = (storageFlags & GL_DYNAMIC_STORAGE_BIT_EXT) != 0;
@@ -266,6 +285,9 @@ BufferVk::BufferVk(const gl::BufferState &state)
       mMemoryPropertyFlags(0),
       mIsStagingBufferMapped(false),
       mHasValidData(false),
+      mStagedCPUWriteCount(0),
+      mCPUWritesOnPromotedStorage(0),
+      mPromotedToHostVisible(false),
       mIsMappedForWrite(false),
       mMappedOffset(0),
       mMappedLength(0)
@@ -283,10 +305,17 @@ void BufferVk::destroy(const gl::Context *context)
 void BufferVk::release(ContextVk *contextVk)
 {
     RendererVk *renderer = contextVk->getRenderer();
+    // The storage is going away, so any coalesced updates aimed at it are obsolete.
+    dropPendingSubData(contextVk);
     if (mBuffer.valid())
     {
         mBuffer.releaseBufferAndDescriptorSetCache(contextVk);
     }
+    for (vk::BufferHelper &buffer : mBufferRing)
+    {
+        buffer.releaseBufferAndDescriptorSetCache(contextVk);
+    }
+    mBufferRing.clear();
     if (mStagingBuffer.valid())
     {
         mStagingBuffer.release(renderer);
@@ -394,6 +423,26 @@ angle::Result BufferVk::setDataWithMemoryType(const gl::Context *context,
 {
     ContextVk *contextVk = vk::GetImpl(context);
 
+    // The entire buffer is being respecified; any coalesced small updates are superseded either by
+    // the incoming data or by undefined contents.
+    dropPendingSubData(contextVk);
+
+    // Keep an adaptive promotion to DEVICE_LOCAL|HOST_VISIBLE across respecifications as long as
+    // the promoted storage actually saw CPU writes; otherwise the promotion was wrong, revert it.
+    if (mPromotedToHostVisible)
+    {
+        if (mCPUWritesOnPromotedStorage > 0)
+        {
+            memoryPropertyFlags = kDeviceLocalHostCoherentFlags;
+        }
+        else
+        {
+            mPromotedToHostVisible = false;
+        }
+        mCPUWritesOnPromotedStorage = 0;
+    }
+    mStagedCPUWriteCount = 0;
+
     // Reset the flag since the buffer contents are being reinitialized. If the caller passed in
     // data to fill the buffer, the flag will be updated when the data is copied to the buffer.
     mHasValidData = false;
@@ -411,11 +460,21 @@ angle::Result BufferVk::setDataWithMemoryType(const gl::Context *context,
     // Release and init a new mBuffer with requested size.
     if (bufferSizeChanged || inUseAndRespecifiedWithoutData)
     {
-        // Release and re-create the memory and buffer.
-        release(contextVk);
+        uint32_t memoryTypeIndex = 0;
+        ANGLE_TRY(GetMemoryTypeIndex(contextVk, size, memoryPropertyFlags, &memoryTypeIndex));
+
+        // If the buffer is only respecified without data (the classic orphaning pattern) and the
+        // storage parameters are unchanged, skip release() so that acquireBufferHelper can recycle
+        // the current storage through the buffer ring.
+        if (bufferSizeChanged || memoryTypeIndex != mMemoryTypeIndex ||
+            memoryPropertyFlags != mMemoryPropertyFlags)
+        {
+            // Release and re-create the memory and buffer.
+            release(contextVk);
+        }
 
         mMemoryPropertyFlags = memoryPropertyFlags;
-        ANGLE_TRY(GetMemoryTypeIndex(contextVk, size, memoryPropertyFlags, &mMemoryTypeIndex));
+        mMemoryTypeIndex     = memoryTypeIndex;
 
         ANGLE_TRY(acquireBufferHelper(contextVk, size));
     }
@@ -455,8 +514,13 @@ angle::Result BufferVk::copySubData(const gl::Context *context,
 {
     ASSERT(mBuffer.valid());
 
-    ContextVk *contextVk           = vk::GetImpl(context);
-    BufferVk *sourceVk             = GetAs<BufferVk>(source);
+    ContextVk *contextVk = vk::GetImpl(context);
+    BufferVk *sourceVk   = GetAs<BufferVk>(source);
+
+    // Both buffers are consumed by the GPU copy below.
+    ANGLE_TRY(flushPendingSubData(contextVk));
+    ANGLE_TRY(sourceVk->flushPendingSubData(contextVk));
+
     vk::BufferHelper &sourceBuffer = sourceVk->getBuffer();
     ASSERT(sourceBuffer.valid());
     VkDeviceSize sourceBufferOffset = sourceBuffer.getOffset();
@@ -643,6 +707,11 @@ angle::Result BufferVk::mapRangeImpl(ContextVk *contextVk,
 {
     ASSERT(mBuffer.valid());
 
+    // Any coalesced small updates must land before the contents are observed or overwritten.
+    ANGLE_TRY(flushPendingSubData(contextVk));
+
+    ANGLE_TRY(migrateToDeviceLocalHostVisibleIfNeeded(contextVk));
+
     // Record map call parameters in case this call is from angle internal (the access/offset/length
     // will be inconsistent from mState).
     mIsMappedForWrite = (access & GL_MAP_WRITE_BIT) != 0;
@@ -757,6 +826,7 @@ angle::Result BufferVk::unmapImpl(ContextVk *contextVk)
         if (mIsMappedForWrite)
         {
             ANGLE_TRY(flushStagingBuffer(contextVk, mMappedOffset, mMappedLength));
+            ++mStagedCPUWriteCount;
         }
 
         mIsStagingBufferMapped = false;
@@ -769,6 +839,10 @@ angle::Result BufferVk::unmapImpl(ContextVk *contextVk)
 
     if (mIsMappedForWrite)
     {
+        if (mPromotedToHostVisible)
+        {
+            ++mCPUWritesOnPromotedStorage;
+        }
         dataUpdated();
     }
 
@@ -860,6 +934,11 @@ angle::Result BufferVk::directUpdate(ContextVk *contextVk,
     }
     ASSERT(mBuffer.isCoherent());
 
+    if (mPromotedToHostVisible)
+    {
+        ++mCPUWritesOnPromotedStorage;
+    }
+
     return angle::Result::Continue;
 }
 
@@ -874,6 +953,189 @@ angle::Result BufferVk::stagedUpdate(ContextVk *contextVk,
     memcpy(mapPointer, data, size);
     ANGLE_TRY(flushStagingBuffer(contextVk, offset, size));
     mIsStagingBufferMapped = false;
+    ++mStagedCPUWriteCount;
+
+    return angle::Result::Continue;
+}
+
+bool BufferVk::shouldCoalesceSubData(ContextVk *contextVk,
+                                     size_t size,
+                                     BufferUpdateType updateType) const
+{
+    // Only small contents updates to non-external device-local buffers with valid data are
+    // coalesced; these would otherwise each stage one copy region through stagedUpdate.
+    return contextVk->getFeatures().coalesceSmallBufferUpdates.enabled &&
+           updateType == BufferUpdateType::ContentsUpdate && !isExternalBuffer() &&
+           mBuffer.valid() && !mBuffer.isHostVisible() && mHasValidData && size > 0 &&
+           size <= contextVk->getRenderer()->getSmallBufferUpdateThreshold();
+}
+
+angle::Result BufferVk::appendPendingSubData(ContextVk *contextVk,
+                                             const uint8_t *data,
+                                             size_t size,
+                                             size_t offset)
+{
+    if (mPendingSubDataUpdates.empty())
+    {
+        contextVk->getShareGroup()->addBufferWithPendingSubData(this);
+    }
+
+    const size_t storageOffset = mPendingSubDataStorage.size();
+    mPendingSubDataStorage.insert(mPendingSubDataStorage.end(), data, data + size);
+    mPendingSubDataUpdates.push_back(
+        {static_cast<VkDeviceSize>(offset), static_cast<VkDeviceSize>(size), storageOffset});
+
+    // Update conversions
+    dataUpdated();
+
+    // Keep the shadow bounded; an application that exceeds this is no longer in the many-tiny-
+    // updates pattern this path is meant for.
+    if (mPendingSubDataStorage.size() > kMaxPendingSubDataBytes)
+    {
+        ANGLE_TRY(flushPendingSubData(contextVk));
+    }
+
+    return angle::Result::Continue;
+}
+
+void BufferVk::dropPendingSubData(ContextVk *contextVk)
+{
+    if (!mPendingSubDataUpdates.empty())
+    {
+        mPendingSubDataUpdates.clear();
+        mPendingSubDataStorage.clear();
+        contextVk->getShareGroup()->removeBufferWithPendingSubData(this);
+    }
+}
+
+angle::Result BufferVk::flushPendingSubData(ContextVk *contextVk)
+{
+    if (mPendingSubDataUpdates.empty())
+    {
+        return angle::Result::Continue;
+    }
+
+    // Detach the pending state first: emitting the copy below re-enters the context's resource
+    // access path, which in turn flushes buffers with pending sub data.
+    std::vector<PendingSubDataUpdate> updates = std::move(mPendingSubDataUpdates);
+    std::vector<uint8_t> storage              = std::move(mPendingSubDataStorage);
+    mPendingSubDataUpdates.clear();
+    mPendingSubDataStorage.clear();
+    contextVk->getShareGroup()->removeBufferWithPendingSubData(this);
+
+    // Merge overlapping and adjacent destination ranges into as few copy regions as possible.
+    std::vector<PendingSubDataUpdate> sortedUpdates = updates;
+    std::sort(sortedUpdates.begin(), sortedUpdates.end(),
+              [](const PendingSubDataUpdate &a, const PendingSubDataUpdate &b) {
+                  return a.offset < b.offset;
+              });
+
+    struct MergedRegion
+    {
+        VkDeviceSize start;
+        VkDeviceSize end;
+        VkDeviceSize stagingOffset;
+    };
+    std::vector<MergedRegion> regions;
+    for (const PendingSubDataUpdate &update : sortedUpdates)
+    {
+        if (!regions.empty() && update.offset <= regions.back().end)
+        {
+            regions.back().end = std::max(regions.back().end, update.offset + update.size);
+        }
+        else
+        {
+            regions.push_back({update.offset, update.offset + update.size, 0});
+        }
+    }
+
+    VkDeviceSize totalSize = 0;
+    for (MergedRegion &region : regions)
+    {
+        region.stagingOffset = totalSize;
+        totalSize += region.end - region.start;
+    }
+
+    uint8_t *stagingPointer = nullptr;
+    ANGLE_TRY(
+        allocStagingBuffer(contextVk, vk::MemoryCoherency::NonCoherent, totalSize, &stagingPointer));
+
+    // Replay the updates in submission order so that overlapping writes keep last-writer-wins
+    // semantics.  Every update lies entirely within exactly one merged region.
+    for (const PendingSubDataUpdate &update : updates)
+    {
+        auto regionIter = std::upper_bound(regions.begin(), regions.end(), update.offset,
+                                           [](VkDeviceSize offset, const MergedRegion &region) {
+                                               return offset < region.start;
+                                           });
+        ASSERT(regionIter != regions.begin());
+        const MergedRegion &region = *(regionIter - 1);
+        ASSERT(update.offset >= region.start && update.offset + update.size <= region.end);
+        memcpy(stagingPointer + region.stagingOffset + (update.offset - region.start),
+               storage.data() + update.storageOffset, static_cast<size_t>(update.size));
+    }
+
+    if (!mStagingBuffer.isCoherent())
+    {
+        ANGLE_TRY(mStagingBuffer.flush(contextVk->getRenderer()));
+    }
+
+    std::vector<VkBufferCopy> copyRegions;
+    copyRegions.reserve(regions.size());
+    for (const MergedRegion &region : regions)
+    {
+        copyRegions.push_back({mStagingBuffer.getOffset() + region.stagingOffset,
+                               mBuffer.getOffset() + region.start, region.end - region.start});
+    }
+
+    ANGLE_TRY(mBuffer.copyFromBuffer(contextVk, &mStagingBuffer,
+                                     static_cast<uint32_t>(copyRegions.size()),
+                                     copyRegions.data()));
+    mIsStagingBufferMapped = false;
+    ++mStagedCPUWriteCount;
+
+    return angle::Result::Continue;
+}
+
+angle::Result BufferVk::migrateToDeviceLocalHostVisibleIfNeeded(ContextVk *contextVk)
+{
+    if (!contextVk->getFeatures().adaptiveBufferMemoryType.enabled || mPromotedToHostVisible ||
+        isExternalBuffer() || !mBuffer.valid() || mBuffer.isHostVisible() ||
+        mStagedCPUWriteCount < kPromoteToHostVisibleEvidence)
+    {
+        return angle::Result::Continue;
+    }
+
+    const size_t bufferSize = static_cast<size_t>(mState.getSize());
+
+    uint32_t memoryTypeIndex = 0;
+    ANGLE_TRY(GetMemoryTypeIndex(contextVk, bufferSize, kDeviceLocalHostCoherentFlags,
+                                 &memoryTypeIndex));
+
+    // Replace the storage.  The ring entries were suballocated from the old memory type and
+    // cannot be recycled.
+    vk::BufferHelper src = std::move(mBuffer);
+    for (vk::BufferHelper &buffer : mBufferRing)
+    {
+        buffer.releaseBufferAndDescriptorSetCache(contextVk);
+    }
+    mBufferRing.clear();
+
+    mMemoryPropertyFlags = kDeviceLocalHostCoherentFlags;
+    mMemoryTypeIndex     = memoryTypeIndex;
+
+    ANGLE_TRY(acquireBufferHelper(contextVk, bufferSize));
+
+    if (mHasValidData)
+    {
+        const VkBufferCopy copyRegion = {src.getOffset(), mBuffer.getOffset(), bufferSize};
+        ANGLE_TRY(mBuffer.copyFromBuffer(contextVk, &src, 1, &copyRegion));
+    }
+    src.releaseBufferAndDescriptorSetCache(contextVk);
+
+    mPromotedToHostVisible      = true;
+    mCPUWritesOnPromotedStorage = 0;
+    mStagedCPUWriteCount        = 0;
 
     return angle::Result::Continue;
 }
@@ -976,6 +1238,20 @@ angle::Result BufferVk::setDataImpl(ContextVk *contextVk,
                                     size_t offset,
                                     BufferUpdateType updateType)
 {
+    // Device-local storage that keeps taking staged CPU writes is migrated to
+    // DEVICE_LOCAL|HOST_VISIBLE memory so that subsequent updates can be written directly.
+    ANGLE_TRY(migrateToDeviceLocalHostVisibleIfNeeded(contextVk));
+
+    // Small updates to device-local buffers are accumulated in a CPU shadow and emitted as merged
+    // copy regions when the buffer is next consumed, instead of staging one copy each.
+    if (shouldCoalesceSubData(contextVk, size, updateType))
+    {
+        return appendPendingSubData(contextVk, data, size, offset);
+    }
+
+    // A non-coalesced update must land after any pending small updates it may overlap.
+    ANGLE_TRY(flushPendingSubData(contextVk));
+
     // if the buffer is currently in use
     //     if it isn't an external buffer and sub data size meets threshold
     //          acquire a new BufferHelper from the pool
@@ -1071,11 +1347,46 @@ angle::Result BufferVk::acquireBufferHelper(ContextVk *contextVk, size_t sizeInB
 
     if (mBuffer.valid())
     {
-        mBuffer.releaseBufferAndDescriptorSetCache(contextVk);
+        // For dynamic usage the app is expected to orphan the buffer over and over; park the
+        // current storage in the ring instead of releasing it, so it can be reused below once the
+        // GPU is done with it.
+        if (!isExternalBuffer() && IsUsageDynamic(mState.getUsage()))
+        {
+            mBufferRing.push_back(std::move(mBuffer));
+        }
+        else
+        {
+            mBuffer.releaseBufferAndDescriptorSetCache(contextVk);
+        }
+    }
+
+    if (!mBufferRing.empty())
+    {
+        // Reuse the oldest ring entry if the GPU has finished with it.  The entry keeps its
+        // mapping and descriptor set caches, so the orphan-and-fill pattern becomes a plain
+        // pointer swap with no new suballocation and no ghost copy.  Any buffer size change goes
+        // through release() and empties the ring, so entries always match the requested size.
+        vk::BufferHelper &oldest = mBufferRing.front();
+        ASSERT(oldest.getSize() >= size);
+        if (!oldest.isCurrentlyInUse(contextVk->getLastCompletedQueueSerial()))
+        {
+            mBuffer = std::move(oldest);
+            mBufferRing.erase(mBufferRing.begin());
+        }
+        else if (mBufferRing.size() > kBufferRingDepth)
+        {
+            // The GPU is more than kBufferRingDepth updates behind; release the oldest entry to
+            // cap the memory held by the ring and fall back to a new suballocation.
+            oldest.releaseBufferAndDescriptorSetCache(contextVk);
+            mBufferRing.erase(mBufferRing.begin());
+        }
     }
 
-    // Allocate the buffer directly
-    ANGLE_TRY(mBuffer.initSuballocation(contextVk, mMemoryTypeIndex, size, alignment));
+    if (!mBuffer.valid())
+    {
+        // Allocate the buffer directly
+        ANGLE_TRY(mBuffer.initSuballocation(contextVk, mMemoryTypeIndex, size, alignment));
+    }
 
     // Tell the observers (front end) that a new buffer was created, so the necessary
     // dirty bits can be set. This allows the buffer views pointing to the old buffer to
@@ -112,6 +112,12 @@ class BufferVk : public BufferImpl
     bool isBufferValid() const { return mBuffer.valid(); }
     bool isCurrentlyInUse(ContextVk *contextVk) const;
 
+    // Small glBufferSubData updates accumulated in the CPU shadow are turned into merged copy
+    // regions here.  Called before any GPU or CPU consumption of the buffer contents
+    // (coalesceSmallBufferUpdates).
+    angle::Result flushPendingSubData(ContextVk *contextVk);
+    bool hasPendingSubData() const { return !mPendingSubDataUpdates.empty(); }
+
     angle::Result mapImpl(ContextVk *contextVk, GLbitfield access, void **mapPtr);
     angle::Result mapRangeImpl(ContextVk *contextVk,
                                VkDeviceSize offset,
@@ -173,6 +179,15 @@ class BufferVk : public BufferImpl
     void release(ContextVk *context);
     void dataUpdated();
 
+    angle::Result migrateToDeviceLocalHostVisibleIfNeeded(ContextVk *contextVk);
+
+    bool shouldCoalesceSubData(ContextVk *contextVk, size_t size, BufferUpdateType updateType) const;
+    angle::Result appendPendingSubData(ContextVk *contextVk,
+                                       const uint8_t *data,
+                                       size_t size,
+                                       size_t offset);
+    void dropPendingSubData(ContextVk *contextVk);
+
     angle::Result acquireBufferHelper(ContextVk *contextVk, size_t sizeInBytes);
 
     bool isExternalBuffer() const { return mClientBuffer != nullptr; }
@@ -196,6 +211,14 @@ class BufferVk : public BufferImpl
 
     vk::BufferHelper mBuffer;
 
+    // Ring of orphaned backing storages for buffers with dynamic usage.  When the app orphans the
+    // buffer while the GPU is still using it (glBufferData or glMapBufferRange with
+    // GL_MAP_INVALIDATE_BUFFER_BIT), the current storage is parked here instead of being released,
+    // and reused once the GPU is done with it.  This makes the per-frame orphan-and-fill pattern
+    // free of new suballocations and ghost copies.
+    static constexpr size_t kBufferRingDepth = 4;
+    std::vector<vk::BufferHelper> mBufferRing;
+
     // If not null, this is the external memory pointer passed from client API.
     void *mClientBuffer;
 
@@ -210,12 +233,33 @@ class BufferVk : public BufferImpl
     // A cache of converted vertex data.
     std::vector<VertexConversionBuffer> mVertexConversionBuffers;
 
+    // Small glBufferSubData updates coalesced in a CPU shadow (coalesceSmallBufferUpdates).  Each
+    // entry records the destination range and where its bytes live in mPendingSubDataStorage; at
+    // flush, overlapping and adjacent ranges are merged into one staging allocation and a single
+    // vkCmdCopyBuffer with merged regions.
+    struct PendingSubDataUpdate
+    {
+        VkDeviceSize offset;
+        VkDeviceSize size;
+        size_t storageOffset;
+    };
+    std::vector<PendingSubDataUpdate> mPendingSubDataUpdates;
+    std::vector<uint8_t> mPendingSubDataStorage;
+
     // Tracks whether mStagingBuffer has been mapped to user or not
     bool mIsStagingBufferMapped;
 
     // Tracks if BufferVk object has valid data or not.
     bool mHasValidData;
 
+    // Observed access-pattern evidence for adaptiveBufferMemoryType.  Staged CPU writes to
+    // device-local storage are counted; once enough accumulate, the storage is migrated to
+    // DEVICE_LOCAL|HOST_VISIBLE memory so subsequent writes skip staging.  A promotion that sees
+    // no CPU writes is reverted at the next respecification.
+    uint32_t mStagedCPUWriteCount;
+    uint32_t mCPUWritesOnPromotedStorage;
+    bool mPromotedToHostVisible;
+
     // True if the buffer is currently mapped for CPU write access. If the map call is originated
     // from OpenGLES API call, then this should be consistent with mState.getAccessFlags() bits.
     // Otherwise it is mapped from ANGLE internal and will not be consistent with mState access
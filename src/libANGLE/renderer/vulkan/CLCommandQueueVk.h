@@ -16,6 +16,12 @@
 namespace rx
 {
 
+// Note: command execution is not yet implemented in the Vulkan back end.  When it is, queues
+// created with CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE should not fall back to serializing
+// commands: the event waitlists passed to each enqueue already describe the dependency DAG, so
+// independent branches can be recorded into separate command buffers and submitted to distinct
+// compute-capable Vulkan queues (when the device exposes more than one), with the DAG edges
+// expressed as semaphores.  In-order queues are then just the degenerate single-chain case.
 class CLCommandQueueVk : public CLCommandQueueImpl
 {
   public:
@@ -15,6 +15,12 @@
 namespace rx
 {
 
+// Note: kernel execution is not yet implemented in the Vulkan back end.  When argument handling
+// is, clSetKernelArg should not rebuild descriptor state per enqueue: arguments change rarely
+// relative to enqueue rate, so track a dirty bit per argument, keep the descriptor set for
+// buffer/image arguments alive across enqueues, and fold scalar arguments into push constants.  A
+// repeat enqueue with an unchanged signature then reuses the previous descriptor set outright and
+// at most re-records the push-constant range.
 class CLKernelVk : public CLKernelImpl
 {
   public:
@@ -15,6 +15,11 @@
 namespace rx
 {
 
+// Note: memory transfer is not yet implemented in the Vulkan back end.  When it is, UMA devices
+// (where all device memory is host-visible) should get a zero-copy mode rather than staging
+// copies: back CL buffers with host-visible device memory and service map operations by direct
+// pointer, and have CL/GL interop buffers alias the GL buffer's vk::BufferHelper instead of
+// maintaining a copy in each API.
 class CLMemoryVk : public CLMemoryImpl
 {
   public:
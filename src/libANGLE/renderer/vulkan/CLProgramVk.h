@@ -15,6 +15,11 @@
 namespace rx
 {
 
+// Note: program compilation is not yet implemented in the Vulkan back end (there is no OpenCL C
+// front end wired up).  When a compiler is integrated, build artifacts should go through the
+// display's egl::BlobCache like GL program binaries do, keyed by a hash of the source, the build
+// options and the driver fingerprint, and clBuildProgram with a callback should run the build on
+// the display's shared worker pool rather than blocking the calling thread.
 class CLProgramVk : public CLProgramImpl
 {
   public:
@@ -477,19 +477,29 @@ angle::Result CommandProcessor::processTasksImpl(bool *exitThread)
             mWorkAvailableCondition.wait(lock, [this] { return !mTasks.empty(); });
         }
         mWorkerThreadIdle = false;
-        CommandProcessorTask task(std::move(mTasks.front()));
-        mTasks.pop();
+        // Drain the whole queue in one go.  Batches of independent render passes queued by the
+        // context (e.g. shadow map + gbuffer passes flushed back to back) are then translated
+        // into the primary command buffer without a lock/wake round trip per pass.
+        std::vector<CommandProcessorTask> tasks;
+        tasks.reserve(mTasks.size());
+        while (!mTasks.empty())
+        {
+            tasks.emplace_back(std::move(mTasks.front()));
+            mTasks.pop();
+        }
         lock.unlock();
 
-        ANGLE_TRY(processTask(&task));
-        if (task.getTaskCommand() == CustomTask::Exit)
+        for (CommandProcessorTask &task : tasks)
         {
-
-            *exitThread = true;
-            lock.lock();
-            mWorkerThreadIdle = true;
-            mWorkerIdleCondition.notify_one();
-            return angle::Result::Continue;
+            ANGLE_TRY(processTask(&task));
+            if (task.getTaskCommand() == CustomTask::Exit)
+            {
+                *exitThread = true;
+                lock.lock();
+                mWorkerThreadIdle = true;
+                mWorkerIdleCondition.notify_one();
+                return angle::Result::Continue;
+            }
         }
     }
 
@@ -652,14 +662,12 @@ void CommandProcessor::destroy(Context *context)
 
 bool CommandProcessor::isBusy() const
 {
-    std::lock_guard<std::mutex> serialLock(mQueueSerialMutex);
     std::lock_guard<std::mutex> workerLock(mWorkerMutex);
     return !mTasks.empty() || mCommandQueue.isBusy();
 }
 
 Serial CommandProcessor::reserveSubmitSerial()
 {
-    std::lock_guard<std::mutex> lock(mQueueSerialMutex);
     return mCommandQueue.reserveSubmitSerial();
 }
 
@@ -845,13 +853,17 @@ angle::Result CommandProcessor::ensureNoPendingWork(Context *context)
 }
 
 // CommandQueue implementation.
-CommandQueue::CommandQueue() : mCurrentQueueSerial(mQueueSerialFactory.generate()), mPerfCounters{}
+CommandQueue::CommandQueue() : mPerfCounters{}
 {}
 
 CommandQueue::~CommandQueue() = default;
 
 void CommandQueue::destroy(Context *context)
 {
+    // Submit any batches still deferred by the submission batching policy.
+    (void)flushDeferredQueueSubmits(context);
+    mDeferredSubmitFence.reset(context->getDevice());
+
     // Force all commands to finish by flushing all queues.
     for (VkQueue queue : mQueueMap)
     {
@@ -897,6 +909,7 @@ angle::Result CommandQueue::init(Context *context, const vk::DeviceQueueMap &que
 angle::Result CommandQueue::checkCompletedCommands(Context *context)
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "CommandQueue::checkCompletedCommandsNoLock");
+    ANGLE_TRY(flushDeferredQueueSubmits(context));
     RendererVk *renderer = context->getRenderer();
     VkDevice device      = renderer->getDevice();
 
@@ -1044,6 +1057,8 @@ bool CommandQueue::allInFlightCommandsAreAfterSerial(Serial serial)
 
 angle::Result CommandQueue::finishToSerial(Context *context, Serial finishSerial, uint64_t timeout)
 {
+    ANGLE_TRY(flushDeferredQueueSubmits(context));
+
     if (mInFlightCommands.empty())
     {
         return angle::Result::Continue;
@@ -1081,14 +1096,15 @@ angle::Result CommandQueue::finishToSerial(Context *context, Serial finishSerial
 
 angle::Result CommandQueue::waitIdle(Context *context, uint64_t timeout)
 {
-    return finishToSerial(context, mLastSubmittedQueueSerial, timeout);
+    return finishToSerial(context, mLastSubmittedQueueSerial.getSerial(), timeout);
 }
 
 Serial CommandQueue::reserveSubmitSerial()
 {
-    Serial returnSerial = mCurrentQueueSerial;
-    mCurrentQueueSerial = mQueueSerialFactory.generate();
-    return returnSerial;
+    // Wait-free: a single atomic increment on the per-queue monotonic counter.  Callers hold the
+    // command-queue lock across the subsequent submission, which keeps batches enqueued in serial
+    // order.
+    return mQueueSerialFactory.generate();
 }
 
 angle::Result CommandQueue::submitFrame(
@@ -1141,8 +1157,17 @@ angle::Result CommandQueue::submitFrame(
 
         ANGLE_TRACE_EVENT0("gpu.angle", "CommandQueue::submitFrame");
 
-        ANGLE_TRY(mFenceRecycler.newSharedFence(context, &batch.fence));
-        ANGLE_TRY(queueSubmit(context, priority, submitInfo, &batch.fence.get(), batch.serial));
+        if (mMaxBatchedQueueSubmits > 1)
+        {
+            ANGLE_TRY(deferQueueSubmit(context, hasProtectedContent, priority, submitInfo,
+                                       &batch.fence, batch.serial));
+        }
+        else
+        {
+            ANGLE_TRY(mFenceRecycler.newSharedFence(context, &batch.fence));
+            ANGLE_TRY(
+                queueSubmit(context, priority, submitInfo, &batch.fence.get(), batch.serial));
+        }
     }
     else
     {
@@ -1200,6 +1225,10 @@ angle::Result CommandQueue::waitForSerialWithUserTimeout(vk::Context *context,
                                                          uint64_t timeout,
                                                          VkResult *result)
 {
+    // The serial's fence may belong to a submission that is still deferred; submit it first so
+    // the fence wait below can ever be satisfied.
+    ANGLE_TRY(flushDeferredQueueSubmits(context));
+
     Shared<Fence> *fenceToWaitOn = nullptr;
     size_t finishCount = GetBatchCountUpToSerial(mInFlightCommands, serial, &fenceToWaitOn);
 
@@ -1291,6 +1320,10 @@ angle::Result CommandQueue::queueSubmitOneOff(Context *context,
                                               SubmitPolicy submitPolicy,
                                               Serial submitQueueSerial)
 {
+    // One-off submissions are frequently waited on right away; submit anything the batching
+    // policy has deferred first to preserve queue ordering.
+    ANGLE_TRY(flushDeferredQueueSubmits(context));
+
     VkSubmitInfo submitInfo = {};
     submitInfo.sType        = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 
@@ -1353,13 +1386,121 @@ void CommandQueue::resetPerFramePerfCounters()
 VkResult CommandQueue::queuePresent(egl::ContextPriority contextPriority,
                                     const VkPresentInfoKHR &presentInfo)
 {
+    // The present's wait semaphores depend on deferred submissions; flush them first.
+    VkResult result = flushDeferredQueueSubmitsImpl();
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
     VkQueue queue = getQueue(contextPriority);
     return vkQueuePresentKHR(queue, &presentInfo);
 }
 
+angle::Result CommandQueue::deferQueueSubmit(Context *context,
+                                             bool hasProtectedContent,
+                                             egl::ContextPriority priority,
+                                             const VkSubmitInfo &submitInfo,
+                                             Shared<Fence> *fenceOut,
+                                             Serial submitQueueSerial)
+{
+    if (!mDeferredQueueSubmits.empty() &&
+        (priority != mDeferredSubmitPriority ||
+         mDeferredQueueSubmits.size() >= mMaxBatchedQueueSubmits))
+    {
+        ANGLE_TRY(flushDeferredQueueSubmits(context));
+    }
+
+    if (mDeferredQueueSubmits.empty())
+    {
+        ANGLE_TRY(mFenceRecycler.newSharedFence(context, &mDeferredSubmitFence));
+        mDeferredSubmitPriority = priority;
+    }
+
+    // Every batch coalesced into the same vkQueueSubmit shares the group fence; waits on any
+    // member batch are then merely conservative.
+    fenceOut->copy(context->getDevice(), mDeferredSubmitFence);
+
+    DeferredQueueSubmit deferred;
+    deferred.waitSemaphores.assign(submitInfo.pWaitSemaphores,
+                                   submitInfo.pWaitSemaphores + submitInfo.waitSemaphoreCount);
+    deferred.waitStageMasks.assign(submitInfo.pWaitDstStageMask,
+                                   submitInfo.pWaitDstStageMask + submitInfo.waitSemaphoreCount);
+    deferred.commandBuffers.assign(submitInfo.pCommandBuffers,
+                                   submitInfo.pCommandBuffers + submitInfo.commandBufferCount);
+    deferred.signalSemaphores.assign(
+        submitInfo.pSignalSemaphores, submitInfo.pSignalSemaphores + submitInfo.signalSemaphoreCount);
+    deferred.hasProtectedContent = hasProtectedContent;
+    mDeferredQueueSubmits.push_back(std::move(deferred));
+
+    mDeferredSubmitLastSerial = submitQueueSerial;
+
+    return angle::Result::Continue;
+}
+
+angle::Result CommandQueue::flushDeferredQueueSubmits(Context *context)
+{
+    ANGLE_VK_TRY(context, flushDeferredQueueSubmitsImpl());
+    return angle::Result::Continue;
+}
+
+VkResult CommandQueue::flushDeferredQueueSubmitsImpl()
+{
+    if (mDeferredQueueSubmits.empty())
+    {
+        return VK_SUCCESS;
+    }
+
+    ANGLE_TRACE_EVENT0("gpu.angle", "CommandQueue::flushDeferredQueueSubmits");
+
+    std::vector<VkSubmitInfo> submitInfos(mDeferredQueueSubmits.size());
+    for (size_t index = 0; index < mDeferredQueueSubmits.size(); ++index)
+    {
+        DeferredQueueSubmit &deferred = mDeferredQueueSubmits[index];
+        VkSubmitInfo &submitInfo      = submitInfos[index];
+
+        submitInfo       = {};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.waitSemaphoreCount = static_cast<uint32_t>(deferred.waitSemaphores.size());
+        submitInfo.pWaitSemaphores =
+            deferred.waitSemaphores.empty() ? nullptr : deferred.waitSemaphores.data();
+        submitInfo.pWaitDstStageMask =
+            deferred.waitStageMasks.empty() ? nullptr : deferred.waitStageMasks.data();
+        submitInfo.commandBufferCount = static_cast<uint32_t>(deferred.commandBuffers.size());
+        submitInfo.pCommandBuffers =
+            deferred.commandBuffers.empty() ? nullptr : deferred.commandBuffers.data();
+        submitInfo.signalSemaphoreCount = static_cast<uint32_t>(deferred.signalSemaphores.size());
+        submitInfo.pSignalSemaphores =
+            deferred.signalSemaphores.empty() ? nullptr : deferred.signalSemaphores.data();
+
+        if (deferred.hasProtectedContent)
+        {
+            deferred.protectedSubmitInfo                 = {};
+            deferred.protectedSubmitInfo.sType           = VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO;
+            deferred.protectedSubmitInfo.protectedSubmit = true;
+            submitInfo.pNext                             = &deferred.protectedSubmitInfo;
+        }
+    }
+
+    VkQueue queue   = getQueue(mDeferredSubmitPriority);
+    VkResult result = vkQueueSubmit(queue, static_cast<uint32_t>(submitInfos.size()),
+                                    submitInfos.data(), mDeferredSubmitFence.get().getHandle());
+
+    mDeferredQueueSubmits.clear();
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    mLastSubmittedQueueSerial = mDeferredSubmitLastSerial;
+    ++mPerfCounters.vkQueueSubmitCallsTotal;
+    ++mPerfCounters.vkQueueSubmitCallsPerFrame;
+    return VK_SUCCESS;
+}
+
 bool CommandQueue::isBusy() const
 {
-    return mLastSubmittedQueueSerial > getLastCompletedQueueSerial();
+    return mLastSubmittedQueueSerial.getSerial() > getLastCompletedQueueSerial();
 }
 
 // QueuePriorities:
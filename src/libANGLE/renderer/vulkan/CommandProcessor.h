@@ -429,11 +429,43 @@ class CommandQueue final : public CommandQueueInterface
     const angle::VulkanPerfCounters &getPerfCounters() const { return mPerfCounters; }
     void resetPerFramePerfCounters();
 
+    // Tunable submission batching: with a limit above 1, finished command batches are
+    // accumulated and submitted with a single vkQueueSubmit call once the limit is reached or a
+    // dependency forces a flush (fence wait, present, one-off submit, or a context priority
+    // change).  The effect is visible through the vkQueueSubmitCallsPerFrame counter and the
+    // submitted-commands overlay widget.  The default of 1 keeps the unbatched behavior;
+    // RendererVk raises the limit at device initialization when the batchCommandQueueSubmits
+    // feature is enabled.
+    void setMaxBatchedQueueSubmits(size_t maxBatchedSubmits)
+    {
+        mMaxBatchedQueueSubmits = std::max<size_t>(maxBatchedSubmits, 1);
+    }
+
   private:
     void releaseToCommandBatch(bool hasProtectedContent,
                                PrimaryCommandBuffer &&commandBuffer,
                                SecondaryCommandPools *commandPools,
                                CommandBatch *batch);
+
+    // A deep copy of one deferred VkSubmitInfo, kept alive until the batched vkQueueSubmit.
+    struct DeferredQueueSubmit
+    {
+        std::vector<VkSemaphore> waitSemaphores;
+        std::vector<VkPipelineStageFlags> waitStageMasks;
+        std::vector<VkCommandBuffer> commandBuffers;
+        std::vector<VkSemaphore> signalSemaphores;
+        VkProtectedSubmitInfo protectedSubmitInfo;
+        bool hasProtectedContent;
+    };
+
+    angle::Result deferQueueSubmit(Context *context,
+                                   bool hasProtectedContent,
+                                   egl::ContextPriority priority,
+                                   const VkSubmitInfo &submitInfo,
+                                   Shared<Fence> *fenceOut,
+                                   Serial submitQueueSerial);
+    angle::Result flushDeferredQueueSubmits(Context *context);
+    VkResult flushDeferredQueueSubmitsImpl();
     angle::Result retireFinishedCommands(Context *context, size_t finishedCount);
     angle::Result ensurePrimaryCommandBufferValid(Context *context, bool hasProtectedContent);
 
@@ -473,10 +505,11 @@ class CommandQueue final : public CommandQueueInterface
     PrimaryCommandBuffer mProtectedPrimaryCommands;
     PersistentCommandPool mProtectedPrimaryCommandPool;
 
-    // Queue serial management.
+    // Queue serial management.  The factory is the per-queue monotonic counter; reserving a
+    // submit serial is a single wait-free increment on it.
     AtomicSerialFactory mQueueSerialFactory;
-    Serial mLastSubmittedQueueSerial;
-    Serial mCurrentQueueSerial;
+    // Written by the submitting thread, read by isBusy()/waitIdle() from any thread.
+    AtomicQueueSerial mLastSubmittedQueueSerial;
     // This queue serial can be read/write from different threads, so we need to use atomic
     // operations to access the underline value. Since we only do load/store on this value, it
     // should be just a normal uint64_t load/store on most platforms.
@@ -487,6 +520,14 @@ class CommandQueue final : public CommandQueueInterface
 
     FenceRecycler mFenceRecycler;
 
+    // Submissions deferred by the batching policy.  All entries share mDeferredSubmitFence, so a
+    // wait on any coalesced batch is satisfied (conservatively) when the whole group finishes.
+    std::vector<DeferredQueueSubmit> mDeferredQueueSubmits;
+    Shared<Fence> mDeferredSubmitFence;
+    egl::ContextPriority mDeferredSubmitPriority = egl::ContextPriority::Medium;
+    Serial mDeferredSubmitLastSerial;
+    size_t mMaxBatchedQueueSubmits = 1;
+
     angle::VulkanPerfCounters mPerfCounters;
 };
 
@@ -581,6 +622,13 @@ class CommandProcessor final : public Context, public CommandQueueInterface
     uint32_t getDeviceQueueIndex() const { return mCommandQueue.getDeviceQueueIndex(); }
     VkQueue getQueue(egl::ContextPriority priority) { return mCommandQueue.getQueue(priority); }
 
+    // Forwarded to the member command queue; see CommandQueue::setMaxBatchedQueueSubmits.  Only
+    // called during initialization, before the worker thread processes any tasks.
+    void setMaxBatchedQueueSubmits(size_t maxBatchedSubmits)
+    {
+        mCommandQueue.setMaxBatchedQueueSubmits(maxBatchedSubmits);
+    }
+
     // Note that due to inheritance from vk::Context, this class has a set of perf counters as well,
     // but currently only the counters in the member command queue are of interest.
     const angle::VulkanPerfCounters &getPerfCounters() const
@@ -628,8 +676,6 @@ class CommandProcessor final : public Context, public CommandQueueInterface
     bool mWorkerThreadIdle;
     CommandQueue mCommandQueue;
 
-    mutable std::mutex mQueueSerialMutex;
-
     mutable std::mutex mErrorMutex;
     std::queue<Error> mErrors;
 
@@ -183,6 +183,59 @@ bool CanMultiDrawIndirectUseCmd(ContextVk *contextVk,
     return canMultiDrawIndirectUseCmd;
 }
 
+bool CanMultiDrawUseSingleSetup(const gl::Context *context,
+                                VertexArrayVk *vertexArray,
+                                gl::PrimitiveMode mode)
+{
+    // A multi draw can be recorded as one state setup followed by a tight loop of draw commands
+    // unless some part of the single draw path depends on the individual sub draw:
+    //  - line loops and streamed client attributes rebuild index/vertex buffers per sub draw,
+    //  - gl_DrawID needs a uniform update (and a descriptor set sync) between sub draws,
+    //  - active transform feedback counts the vertices of every sub draw,
+    //  - writable shader resources mark their buffers and images dirty after every sub draw,
+    //  - when nothing can be drawn, the general loop's per-draw noop handling applies.
+    const bool isLineLoop          = mode == gl::PrimitiveMode::LineLoop;
+    const bool hasStreamingAttribs = vertexArray->getStreamingVertexAttribsMask().any();
+    const gl::Program *program     = context->getState().getLinkedProgram(context);
+    const bool hasDrawID           = program && program->hasDrawIDUniform();
+    const bool isTransformFeedbackActive = context->getState().isTransformFeedbackActiveUnpaused();
+    const bool hasWritableShaderResources =
+        context->getStateCache().getActiveShaderStorageBufferIndices().any() ||
+        context->getStateCache().getActiveImageUnitIndices().any();
+    const bool canDraw = context->getStateCache().getCanDraw();
+
+    return !isLineLoop && !hasStreamingAttribs && !hasDrawID && !isTransformFeedbackActive &&
+           !hasWritableShaderResources && canDraw;
+}
+
+bool CanMultiDrawElementsUseFirstIndex(ContextVk *contextVk,
+                                       VertexArrayVk *vertexArray,
+                                       gl::DrawElementsType type,
+                                       const GLvoid *const *indices,
+                                       GLsizei drawcount)
+{
+    // Expressing the sub draw offsets as firstIndex against a single index buffer binding
+    // requires the indices to come from a buffer in a format the hardware consumes directly, and
+    // every offset to be aligned to the index size.  Unaligned offsets are invalid in ES but can
+    // slip through on no-error contexts; send those through the general path.
+    if (vertexArray->getState().getElementArrayBuffer() == nullptr ||
+        contextVk->shouldConvertUint8VkIndexType(type))
+    {
+        return false;
+    }
+
+    const size_t indexSize = gl::GetDrawElementsTypeSize(type);
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (reinterpret_cast<uintptr_t>(indices[drawID]) % indexSize != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 uint32_t GetCoverageSampleCount(const gl::State &glState, FramebufferVk *drawFramebuffer)
 {
     if (!glState.isSampleCoverageEnabled())
@@ -228,6 +281,31 @@ bool IsRenderPassStartedAndUsesImage(const vk::RenderPassCommandBufferHelper &re
     return renderPassCommands.started() && renderPassCommands.usesImage(image);
 }
 
+// Whether the destinations of two copy regions overlap.  Batched regions are handed to a single
+// vkCmdCopyImage call, which requires the destination regions to be disjoint.
+bool ImageCopyDstRegionsOverlap(const VkImageCopy &a, const VkImageCopy &b)
+{
+    const VkImageSubresourceLayers &subA = a.dstSubresource;
+    const VkImageSubresourceLayers &subB = b.dstSubresource;
+
+    if (subA.mipLevel != subB.mipLevel)
+    {
+        return false;
+    }
+    if (subA.baseArrayLayer + subA.layerCount <= subB.baseArrayLayer ||
+        subB.baseArrayLayer + subB.layerCount <= subA.baseArrayLayer)
+    {
+        return false;
+    }
+
+    return a.dstOffset.x < b.dstOffset.x + static_cast<int32_t>(b.extent.width) &&
+           b.dstOffset.x < a.dstOffset.x + static_cast<int32_t>(a.extent.width) &&
+           a.dstOffset.y < b.dstOffset.y + static_cast<int32_t>(b.extent.height) &&
+           b.dstOffset.y < a.dstOffset.y + static_cast<int32_t>(a.extent.height) &&
+           a.dstOffset.z < b.dstOffset.z + static_cast<int32_t>(b.extent.depth) &&
+           b.dstOffset.z < a.dstOffset.z + static_cast<int32_t>(a.extent.depth);
+}
+
 bool IsRenderPassStartedAndTransitionsImageLayout(
     const vk::RenderPassCommandBufferHelper &renderPassCommands,
     vk::ImageHelper &image)
@@ -670,6 +748,8 @@ ANGLE_INLINE void ContextVk::onRenderPassFinished(RenderPassClosureReason reason
 
     if (mRenderPassCommandBuffer != nullptr)
     {
+        ++mRenderPassClosureCounts[reason];
+
         // If reason is specified, add it to the command buffer right before ending the render pass,
         // so it will show up in GPU debuggers.
         const char *reasonText = kRenderPassClosureReason[reason];
@@ -906,6 +986,9 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, RendererVk
     mComputeDirtyBits  = mNewComputeCommandBufferDirtyBits;
 
     mActiveImages.fill(nullptr);
+    mRenderPassClosureCounts.fill(0);
+    mTextureUnitSamplerSerials.fill(0);
+    mTextureUnitSamplerStableFrames.fill(0);
 
     // The following dirty bits don't affect the program pipeline:
     //
@@ -1024,13 +1107,27 @@ void ContextVk::onDestroy(const gl::Context *context)
         queryPool.destroy(device);
     }
 
+    mActiveOverlayPipelineStatsQuery.deinit();
+    for (vk::QueryHelper &query : mPendingOverlayPipelineStatsQueries)
+    {
+        query.deinit();
+    }
+    mPendingOverlayPipelineStatsQueries.clear();
+    mOverlayPipelineStatsQueryPool.destroy(device);
+
     // Recycle current commands buffers.
     mRenderer->recycleOutsideRenderPassCommandBufferHelper(device, &mOutsideRenderPassCommands);
     mRenderer->recycleRenderPassCommandBufferHelper(device, &mRenderPassCommands);
 
     mUtils.destroy(mRenderer);
 
+    // Persist the render pass key stream so the next run can pre-create these render passes
+    // before its first frame.
+    mRenderPassCache.storeKeysInBlobCache(this);
+
     mRenderPassCache.destroy(mRenderer);
+    mVertexInputGraphicsPipelines.destroy(mRenderer);
+    mFragmentOutputGraphicsPipelines.destroy(mRenderer);
     mShaderLibrary.destroy(device);
     mGpuEventQueryPool.destroy(device);
     mCommandPools.outsideRenderPassPool.destroy(device);
@@ -1039,6 +1136,52 @@ void ContextVk::onDestroy(const gl::Context *context)
     ASSERT(mCurrentGarbage.empty());
 }
 
+angle::Result ContextVk::getVertexInputGraphicsPipeline(PipelineCacheAccess *pipelineCache,
+                                                        PipelineSource source,
+                                                        const vk::GraphicsPipelineDesc &desc,
+                                                        vk::PipelineHelper **pipelineOut)
+{
+    const vk::GraphicsPipelineDesc *descPtr = nullptr;
+    if (mVertexInputGraphicsPipelines.getPipeline(desc, &descPtr, pipelineOut))
+    {
+        return angle::Result::Continue;
+    }
+
+    // Vertex-input libraries consume no shaders, pipeline layout or render pass.
+    const vk::ShaderAndSerialMap noShaders;
+    const vk::SpecializationConstants noSpecConsts = {};
+    return mVertexInputGraphicsPipelines.createPipeline(this, pipelineCache, vk::RenderPass(),
+                                                        vk::PipelineLayout(), noShaders,
+                                                        noSpecConsts, source, desc, &descPtr,
+                                                        pipelineOut);
+}
+
+angle::Result ContextVk::getFragmentOutputGraphicsPipeline(PipelineCacheAccess *pipelineCache,
+                                                           PipelineSource source,
+                                                           const vk::GraphicsPipelineDesc &desc,
+                                                           vk::PipelineHelper **pipelineOut)
+{
+    const vk::GraphicsPipelineDesc *descPtr = nullptr;
+    if (mFragmentOutputGraphicsPipelines.getPipeline(desc, &descPtr, pipelineOut))
+    {
+        return angle::Result::Continue;
+    }
+
+    // The fragment-output library needs the render pass for the output interface, but no shaders
+    // or pipeline layout.
+    vk::RenderPass *compatibleRenderPass = nullptr;
+    ANGLE_TRY(mRenderPassCache.getCompatibleRenderPass(this, desc.getRenderPassDesc(),
+                                                       &compatibleRenderPass));
+
+    const vk::ShaderAndSerialMap noShaders;
+    const vk::SpecializationConstants noSpecConsts = {};
+    return mFragmentOutputGraphicsPipelines.createPipeline(this, pipelineCache,
+                                                           *compatibleRenderPass,
+                                                           vk::PipelineLayout(), noShaders,
+                                                           noSpecConsts, source, desc, &descPtr,
+                                                           pipelineOut);
+}
+
 VertexArrayVk *ContextVk::getVertexArray() const
 {
     return vk::GetImpl(mState.getVertexArray());
@@ -1049,6 +1192,16 @@ FramebufferVk *ContextVk::getDrawFramebuffer() const
     return vk::GetImpl(mState.getDrawFramebuffer());
 }
 
+void ContextVk::flushBatchedScissoredClears()
+{
+    if (mPendingBatchedClearsFramebuffer != nullptr)
+    {
+        FramebufferVk *framebufferVk     = mPendingBatchedClearsFramebuffer;
+        mPendingBatchedClearsFramebuffer = nullptr;
+        framebufferVk->flushBatchedScissoredClears(this);
+    }
+}
+
 ProgramVk *ContextVk::getProgram() const
 {
     return vk::SafeGetImpl(mState.getProgram());
@@ -1104,7 +1257,8 @@ angle::Result ContextVk::initialize()
     else if (getFeatures().supportsPipelineStatisticsQuery.enabled)
     {
         ANGLE_TRY(mQueryPools[gl::QueryType::PrimitivesGenerated].init(
-            this, VK_QUERY_TYPE_PIPELINE_STATISTICS, vk::kDefaultPrimitivesGeneratedQueryPoolSize));
+            this, VK_QUERY_TYPE_PIPELINE_STATISTICS, vk::kDefaultPrimitivesGeneratedQueryPoolSize,
+            VK_QUERY_PIPELINE_STATISTIC_CLIPPING_INVOCATIONS_BIT));
     }
 
     // Init GLES to Vulkan index type map.
@@ -1182,6 +1336,10 @@ angle::Result ContextVk::initialize()
     // Add context into the share group
     mShareGroupVk->addContext(this);
 
+    // Pre-create the render passes used by the previous run, if their keys were persisted in the
+    // blob cache.  This trades a small amount of startup work for fewer first-frame hitches.
+    ANGLE_TRY(mRenderPassCache.warmUpFromBlobCache(this));
+
     return angle::Result::Continue;
 }
 
@@ -1243,6 +1401,15 @@ angle::Result ContextVk::setupDraw(const gl::Context *context,
                                    const void *indices,
                                    DirtyBits dirtyBitMask)
 {
+    ++mPerfCounters.drawCalls;
+
+    // Batched scissored clears must land in the render pass before this draw does.
+    flushBatchedScissoredClears();
+
+    // Buffers bound through descriptor sets are not re-examined on every draw, so coalesced small
+    // buffer updates are flushed for the whole share group before the draw consumes them.
+    ANGLE_TRY(mShareGroupVk->flushBuffersWithPendingSubData(this));
+
     // Set any dirty bits that depend on draw call parameters or other objects.
     if (mode != mCurrentDrawMode)
     {
@@ -1289,6 +1456,10 @@ angle::Result ContextVk::setupDraw(const gl::Context *context,
         return angle::Result::Continue;
     }
 
+    // The dirty bit handlers below are meant to stay heap-allocation-free; the streamed attrib
+    // and uniform updates above are the known-legitimate allocators in the draw path.
+    ANGLE_ASSERT_NO_ALLOCATIONS("ContextVk::setupDraw dirty bit handlers")
+
     // Flush any relevant dirty bits.
     for (DirtyBits::Iterator dirtyBitIter = dirtyBits.begin(); dirtyBitIter != dirtyBits.end();
          ++dirtyBitIter)
@@ -1508,6 +1679,9 @@ angle::Result ContextVk::setupLineLoopDraw(const gl::Context *context,
 
 angle::Result ContextVk::setupDispatch(const gl::Context *context)
 {
+    // See the equivalent flush in setupDraw.
+    ANGLE_TRY(mShareGroupVk->flushBuffersWithPendingSubData(this));
+
     // Note: numerous tests miss a glMemoryBarrier call between the initial texture data upload and
     // the dispatch call.  Flush the outside render pass command buffer as a workaround.
     // TODO: Remove this and fix tests.  http://anglebug.com/5070
@@ -1921,6 +2095,28 @@ angle::Result ContextVk::handleDirtyAnySamplePassedQueryEnd(DirtyBits::Iterator
 angle::Result ContextVk::handleDirtyGraphicsRenderPass(DirtyBits::Iterator *dirtyBitsIterator,
                                                        DirtyBits dirtyBitMask)
 {
+    // If the application switched draw framebuffers and back without recording anything that
+    // required the render pass to close, the still-open pass targets this same framebuffer with
+    // the same attachment configuration and can simply be reattached instead of broken in two,
+    // saving a load/store round trip through memory on tilers.
+    if (getFeatures().deferRenderPassBreakOnFramebufferSwitch.enabled &&
+        mRenderPassCommands->started() && mRenderPassCommandBuffer == nullptr)
+    {
+        FramebufferVk *drawFramebufferVk = getDrawFramebuffer();
+        if (hasStartedRenderPassWithSerial(drawFramebufferVk->getLastRenderPassSerial()) &&
+            drawFramebufferVk->getRenderPassDesc() == mRenderPassCommands->getRenderPassDesc() &&
+            !drawFramebufferVk->hasDeferredClears() &&
+            !mState.isTransformFeedbackActiveUnpaused())
+        {
+            mRenderPassCommands->growRenderArea(
+                this, drawFramebufferVk->getRotatedScissoredRenderArea(this));
+            mRenderPassCommandBuffer = &mRenderPassCommands->getCommandBuffer();
+            ANGLE_TRY(resumeRenderPassQueriesIfActive());
+            ++mPerfCounters.renderPassBreaksAvoided;
+            return angle::Result::Continue;
+        }
+    }
+
     // If the render pass needs to be recreated, close it using the special mid-dirty-bit-handling
     // function, so later dirty bits can be set.
     if (mRenderPassCommands->started())
@@ -2072,15 +2268,29 @@ ANGLE_INLINE angle::Result ContextVk::handleDirtyTexturesImpl(
 
         // Ensure the image is in the desired layout
         commandBufferHelper->imageRead(this, image.getAspectFlags(), imageLayout, &image);
+
+        // Sampling an image that was a color attachment of the render pass that just closed means
+        // the intermediate result is stored to memory and immediately read back.  These passes
+        // cannot be merged after the fact — pipelines are compiled against single-subpass render
+        // passes — but the application can fuse them itself with framebuffer fetch.
+        if (std::find(mPreviousRenderPassColorImageSerials.begin(),
+                      mPreviousRenderPassColorImageSerials.end(),
+                      image.getImageSerial()) != mPreviousRenderPassColorImageSerials.end())
+        {
+            ANGLE_VK_PERF_WARNING(this, GL_DEBUG_SEVERITY_LOW,
+                                  "Sampling a color attachment of the previous render pass; "
+                                  "consider framebuffer fetch to avoid the intermediate store");
+        }
     }
 
     if (executable->hasTextures())
     {
+        ProgramExecutableVk *executableVk = getExecutable();
+
         UpdatePreCacheActiveTextures(executable->getSamplerBindings(),
                                      executable->getActiveSamplersMask(), mActiveTextures,
-                                     mState.getSamplers(), &mActiveTexturesDesc);
-
-        ProgramExecutableVk *executableVk = getExecutable();
+                                     mState.getSamplers(),
+                                     executableVk->getPromotedSamplerUnits(), &mActiveTexturesDesc);
 
         ANGLE_TRY(executableVk->updateTexturesDescriptorSet(
             this, *executable, mActiveTextures, mState.getSamplers(),
@@ -2128,8 +2338,7 @@ angle::Result ContextVk::handleDirtyGraphicsVertexBuffers(DirtyBits::Iterator *d
             executable->getNonBuiltinAttribLocationsMask();
         const gl::ComponentTypeMask &programAttribsTypeMask = executable->getAttributesTypeMask();
 
-        for (size_t attribIndex : activeAttribLocations)
-        {
+        activeAttribLocations.forEachSetBit([&](size_t attribIndex) {
             const angle::Format &intendedFormat =
                 mRenderer->getFormat(bufferFormats[attribIndex]).getIntendedFormat();
 
@@ -2142,7 +2351,7 @@ angle::Result ContextVk::handleDirtyGraphicsVertexBuffers(DirtyBits::Iterator *d
                 attribType != programAttribType && (programAttribType == gl::ComponentType::Float ||
                                                     attribType == gl::ComponentType::Float);
             strides[attribIndex] = mismatchingType ? 0 : bufferStrides[attribIndex];
-        }
+        });
 
         // TODO: Use the sizes parameters here to fix the robustness issue worked around in
         // crbug.com/1310038
@@ -2160,15 +2369,14 @@ angle::Result ContextVk::handleDirtyGraphicsVertexBuffers(DirtyBits::Iterator *d
 
     // Mark all active vertex buffers as accessed.
     const gl::AttributesMask attribsMask = executable->getActiveAttribLocationsMask();
-    for (size_t attribIndex : attribsMask)
-    {
+    attribsMask.forEachSetBit([&](size_t attribIndex) {
         vk::BufferHelper *arrayBuffer = arrayBufferResources[attribIndex];
         if (arrayBuffer)
         {
             mRenderPassCommands->bufferRead(this, VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT,
                                             vk::PipelineStage::VertexInput, arrayBuffer);
         }
-    }
+    });
 
     return angle::Result::Continue;
 }
@@ -2397,14 +2605,14 @@ angle::Result ContextVk::handleDirtyGraphicsTransformFeedbackBuffersEmulation(
     ProgramExecutableVk *executableVk      = getExecutable();
     vk::BufferHelper *currentUniformBuffer = mDefaultUniformStorage.getCurrentBuffer();
 
-    vk::DescriptorSetDescBuilder uniformsAndXfbDesc;
-    uniformsAndXfbDesc.updateUniformsAndXfb(
+    mUniformsAndXfbDescriptorDesc.reset();
+    mUniformsAndXfbDescriptorDesc.updateUniformsAndXfb(
         this, *executable, *executableVk, currentUniformBuffer, mEmptyBuffer,
         mState.isTransformFeedbackActiveUnpaused(), transformFeedbackVk);
 
     return executableVk->updateUniformsAndXfbDescriptorSet(
         this, &mUpdateDescriptorSetsBuilder, mRenderPassCommands, currentUniformBuffer,
-        &uniformsAndXfbDesc);
+        &mUniformsAndXfbDescriptorDesc);
 }
 
 angle::Result ContextVk::handleDirtyGraphicsTransformFeedbackBuffersExtension(
@@ -2521,7 +2729,7 @@ angle::Result ContextVk::handleDirtyUniformsImpl(vk::CommandBufferHelperCommon *
         vk::SafeGetImpl(mState.getCurrentTransformFeedback());
     ANGLE_TRY(programExecutableVk->updateUniforms(
         this, &mUpdateDescriptorSetsBuilder, commandBufferHelper, &mEmptyBuffer,
-        *mState.getProgramExecutable(), &mDefaultUniformStorage,
+        *mState.getProgramExecutable(), &mDefaultUniformStorage, &mDefaultUniformUploadPool,
         mState.isTransformFeedbackActiveUnpaused(), transformFeedbackVk));
 
     return angle::Result::Continue;
@@ -2843,6 +3051,23 @@ angle::Result ContextVk::handleDirtyDescriptorSetsImpl(CommandBufferHelperT *com
                                             &commandBufferHelper->getCommandBuffer(), pipelineType);
 }
 
+void ContextVk::writeRenderPassClosureCounts(ANGLERenderPassClosureCounts *countsOut) const
+{
+    constexpr size_t kReasonCount = static_cast<size_t>(RenderPassClosureReason::EnumCount);
+    static_assert(kReasonCount <= EGL_RENDER_PASS_CLOSURE_REASON_COUNT_ANGLE,
+                  "ANGLERenderPassClosureCounts is too small for RenderPassClosureReason");
+
+    *countsOut             = {};
+    countsOut->reasonCount = kReasonCount;
+    for (RenderPassClosureReason reason : angle::AllEnums<RenderPassClosureReason>())
+    {
+        const size_t index           = static_cast<size_t>(reason);
+        const char *reasonText       = kRenderPassClosureReason[reason];
+        countsOut->reasonNames[index] = reasonText ? reasonText : "Unspecified";
+        countsOut->counts[index]      = mRenderPassClosureCounts[reason];
+    }
+}
+
 void ContextVk::syncObjectPerfCounters(const angle::VulkanPerfCounters &commandQueuePerfCounters)
 {
     mPerfCounters.descriptorSetCacheTotalSize                = 0;
@@ -2907,6 +3132,23 @@ void ContextVk::syncObjectPerfCounters(const angle::VulkanPerfCounters &commandQ
 
     // Return current drawFramebuffer's cache stats
     mPerfCounters.framebufferCacheSize = mShareGroupVk->getFramebufferCache().getSize();
+
+    // Pipeline cache footprint, as of the last pipeline cache sync.
+    mPerfCounters.pipelineCacheSizeBytes = mRenderer->getPipelineCacheSizeAtLastSync();
+
+    // Buffer pool memory usage.  The unused size relative to the total size is the suballocator's
+    // fragmentation ratio.
+    size_t bufferBlockCount;
+    VkDeviceSize bufferPoolTotalSize;
+    mShareGroupVk->calculateTotalBufferCount(&bufferBlockCount, &bufferPoolTotalSize);
+    mPerfCounters.bufferPoolTotalMemorySize  = bufferPoolTotalSize;
+    mPerfCounters.bufferPoolUnusedMemorySize = mShareGroupVk->calculateTotalBufferUnusedSize();
+
+#if defined(ANGLE_ENABLE_ALLOCATION_PROFILING)
+    // Cumulative process-wide heap allocations from the allocator shim; consumers compute
+    // per-draw or per-frame deltas.  Zero when the shim is not compiled in.
+    mPerfCounters.heapAllocationsTotal = gl::GetAllocationProfileTotalCount();
+#endif
 }
 
 void ContextVk::updateOverlayOnPresent()
@@ -2925,6 +3167,25 @@ void ContextVk::updateOverlayOnPresent()
         renderPassCount->next();
     }
 
+    {
+        gl::RunningGraphWidget *vertexShaderInvocations =
+            overlay->getRunningGraphWidget(gl::WidgetId::VulkanVertexShaderInvocations);
+        vertexShaderInvocations->add(mPerfCounters.vertexShaderInvocations);
+        vertexShaderInvocations->next();
+
+        gl::RunningGraphWidget *fragmentShaderInvocations =
+            overlay->getRunningGraphWidget(gl::WidgetId::VulkanFragmentShaderInvocations);
+        fragmentShaderInvocations->add(mPerfCounters.fragmentShaderInvocations);
+        fragmentShaderInvocations->next();
+    }
+
+    {
+        gl::RunningGraphWidget *attachmentBandwidth =
+            overlay->getRunningGraphWidget(gl::WidgetId::VulkanAttachmentBandwidthMB);
+        attachmentBandwidth->add(mPerfCounters.estimatedAttachmentBandwidthBytes / (1024 * 1024));
+        attachmentBandwidth->next();
+    }
+
     {
         gl::RunningGraphWidget *writeDescriptorSetCount =
             overlay->getRunningGraphWidget(gl::WidgetId::VulkanWriteDescriptorSetCount);
@@ -3005,6 +3266,41 @@ void ContextVk::updateOverlayOnPresent()
     }
 }
 
+void ContextVk::updateTelemetryCountersOnPresent()
+{
+    egl::Display *display = mRenderer->getDisplay();
+    if (!display->isTelemetryActive())
+    {
+        return;
+    }
+
+    syncObjectPerfCounters(mRenderer->getCommandQueuePerfCounters());
+
+    egl::TelemetryCounters &telemetry = display->getTelemetryCounters();
+    telemetry.commandBuffersSubmitted.store(mPerfCounters.commandQueueSubmitCallsTotal,
+                                            std::memory_order_relaxed);
+    telemetry.pipelineCompiles.store(mPerfCounters.pipelineCreationCacheMisses,
+                                     std::memory_order_relaxed);
+    telemetry.pipelineCacheSizeBytes.store(mPerfCounters.pipelineCacheSizeBytes,
+                                           std::memory_order_relaxed);
+    telemetry.descriptorSetCacheSize.store(mPerfCounters.descriptorSetCacheTotalSize,
+                                           std::memory_order_relaxed);
+    telemetry.framebufferCacheSize.store(mPerfCounters.framebufferCacheSize,
+                                         std::memory_order_relaxed);
+    telemetry.descriptorPoolGrowthEvents.store(mPerfCounters.descriptorPoolAllocations,
+                                               std::memory_order_relaxed);
+}
+
+angle::Result ContextVk::prepareDescriptorPoolsForNextFrame()
+{
+    for (DescriptorSetIndex descriptorSetIndex : angle::AllEnums<DescriptorSetIndex>())
+    {
+        ANGLE_TRY(mShareGroupVk->getMetaDescriptorPool(descriptorSetIndex)
+                      .prepareForNextFrame(this));
+    }
+    return angle::Result::Continue;
+}
+
 void ContextVk::addOverlayUsedBuffersCount(vk::CommandBufferHelperCommon *commandBuffer)
 {
     const gl::OverlayType *overlay = mState.getOverlay();
@@ -3044,6 +3340,151 @@ void ContextVk::addOverlayUsedBuffersCount(vk::CommandBufferHelperCommon *comman
     }
 }
 
+void ContextVk::accumulateAttachmentBandwidth()
+{
+    // Estimate the memory traffic the render pass attachments generate: each attachment is read
+    // once if loadOp is LOAD and written once if storeOp is STORE, at pixelBytes per covered pixel.
+    // Resolve attachments add a single-sampled write.  This ignores framebuffer compression and
+    // pixel-local (tiler) memory, but correlates well with how much a pass pays for its
+    // attachments, which is what the counter (and the overlay widget that reads it) is meant to
+    // expose.
+    const vk::RenderPassDesc &desc    = mRenderPassCommands->getRenderPassDesc();
+    const vk::AttachmentOpsArray &ops = mRenderPassCommands->getAttachmentOps();
+    const gl::Rectangle &renderArea   = mRenderPassCommands->getRenderArea();
+
+    const uint64_t resolvePixelCount =
+        static_cast<uint64_t>(renderArea.width) * renderArea.height;
+    const uint64_t pixelCount = resolvePixelCount * std::max<uint8_t>(desc.samples(), 1);
+
+    uint64_t bytes = 0;
+
+    vk::PackedAttachmentIndex attachmentIndexVk(0);
+    for (size_t colorIndexGL = 0; colorIndexGL < desc.colorAttachmentRange(); ++colorIndexGL)
+    {
+        if (!desc.isColorAttachmentEnabled(colorIndexGL))
+        {
+            continue;
+        }
+
+        const angle::Format &format           = angle::Format::Get(desc[colorIndexGL]);
+        const vk::PackedAttachmentOpsDesc &op = ops[attachmentIndexVk];
+
+        const uint64_t accessCount =
+            (op.loadOp == static_cast<uint16_t>(vk::RenderPassLoadOp::Load) ? 1 : 0) +
+            (op.storeOp == static_cast<uint16_t>(vk::RenderPassStoreOp::Store) ? 1 : 0);
+        bytes += pixelCount * format.pixelBytes * accessCount;
+
+        if (desc.hasColorResolveAttachment(colorIndexGL))
+        {
+            bytes += resolvePixelCount * format.pixelBytes;
+        }
+
+        ++attachmentIndexVk;
+    }
+
+    if (desc.hasDepthStencilAttachment())
+    {
+        const angle::Format &format = angle::Format::Get(desc[desc.depthStencilAttachmentIndex()]);
+        const vk::PackedAttachmentOpsDesc &op = ops[attachmentIndexVk];
+
+        const uint64_t depthBytes   = format.depthBits / 8;
+        const uint64_t stencilBytes = format.stencilBits / 8;
+
+        bytes += pixelCount * depthBytes *
+                 ((op.loadOp == static_cast<uint16_t>(vk::RenderPassLoadOp::Load) ? 1 : 0) +
+                  (op.storeOp == static_cast<uint16_t>(vk::RenderPassStoreOp::Store) ? 1 : 0));
+        bytes += pixelCount * stencilBytes *
+                 ((op.stencilLoadOp == static_cast<uint16_t>(vk::RenderPassLoadOp::Load) ? 1 : 0) +
+                  (op.stencilStoreOp == static_cast<uint16_t>(vk::RenderPassStoreOp::Store) ? 1
+                                                                                           : 0));
+
+        if (desc.hasDepthStencilResolveAttachment())
+        {
+            bytes += resolvePixelCount * (depthBytes + stencilBytes);
+        }
+    }
+
+    mPerfCounters.estimatedAttachmentBandwidthBytes += bytes;
+}
+
+angle::Result ContextVk::beginOverlayPipelineStatsQuery()
+{
+    // The query feeds the overlay's vertex/fragment shader invocation widgets; skip it unless one
+    // of those widgets is shown so unrelated overlay usage doesn't pay for per-render-pass queries.
+    const gl::OverlayType *overlay = mState.getOverlay();
+    if (!overlay->isEnabled() || !getFeatures().supportsPipelineStatisticsQuery.enabled ||
+        (!overlay->getRunningGraphWidget(gl::WidgetId::VulkanVertexShaderInvocations)
+              ->isEnabled() &&
+         !overlay->getRunningGraphWidget(gl::WidgetId::VulkanFragmentShaderInvocations)
+              ->isEnabled()))
+    {
+        return angle::Result::Continue;
+    }
+
+    if (!mOverlayPipelineStatsQueryPool.isValid())
+    {
+        ANGLE_TRY(mOverlayPipelineStatsQueryPool.init(
+            this, VK_QUERY_TYPE_PIPELINE_STATISTICS, vk::kDefaultOverlayPipelineStatsQueryPoolSize,
+            vk::kOverlayPipelineStatistics));
+    }
+
+    ASSERT(!mActiveOverlayPipelineStatsQuery.valid());
+    ANGLE_TRY(
+        mOverlayPipelineStatsQueryPool.allocateQuery(this, &mActiveOverlayPipelineStatsQuery, 1));
+    ANGLE_TRY(mActiveOverlayPipelineStatsQuery.beginRenderPassQuery(this));
+
+    return angle::Result::Continue;
+}
+
+void ContextVk::endOverlayPipelineStatsQuery()
+{
+    if (mActiveOverlayPipelineStatsQuery.valid())
+    {
+        mActiveOverlayPipelineStatsQuery.endRenderPassQuery(this);
+        mPendingOverlayPipelineStatsQueries.push_back(
+            std::move(mActiveOverlayPipelineStatsQuery));
+    }
+}
+
+angle::Result ContextVk::checkCompletedOverlayPipelineStatsQueries()
+{
+    int finishedCount = 0;
+
+    Serial lastCompletedSerial = getLastCompletedQueueSerial();
+
+    for (vk::QueryHelper &query : mPendingOverlayPipelineStatsQueries)
+    {
+        // Only check the query if the submission has finished.
+        if (query.usedInRunningCommands(lastCompletedSerial))
+        {
+            break;
+        }
+
+        // The pool is created with the vertex shader invocation statistic before the fragment
+        // shader one, so the results are returned in that order.
+        vk::QueryResult invocations(2);
+        bool available = false;
+        ANGLE_TRY(query.getUint64ResultNonBlocking(this, &invocations, &available));
+        if (!available)
+        {
+            break;
+        }
+
+        mPerfCounters.vertexShaderInvocations += invocations.getResult(0);
+        mPerfCounters.fragmentShaderInvocations += invocations.getResult(1);
+
+        mOverlayPipelineStatsQueryPool.freeQuery(this, &query);
+
+        ++finishedCount;
+    }
+
+    mPendingOverlayPipelineStatsQueries.erase(
+        mPendingOverlayPipelineStatsQueries.begin(),
+        mPendingOverlayPipelineStatsQueries.begin() + finishedCount);
+
+    return angle::Result::Continue;
+}
+
 angle::Result ContextVk::submitFrame(const vk::Semaphore *signalSemaphore,
                                      Submit submission,
                                      Serial *submitSerialOut)
@@ -3125,6 +3566,7 @@ angle::Result ContextVk::onCopyUpdate(VkDeviceSize size)
     ANGLE_TRACE_EVENT0("gpu.angle", "ContextVk::onCopyUpdate");
 
     mTotalBufferToImageCopySize += size;
+    mPerfCounters.estimatedBufferTransferBandwidthBytes += size;
     // If the copy size exceeds the specified threshold, submit the outside command buffer.
     if (mTotalBufferToImageCopySize >= kMaxBufferToImageCopySize)
     {
@@ -3703,7 +4145,28 @@ angle::Result ContextVk::multiDrawArrays(const gl::Context *context,
                                          const GLsizei *counts,
                                          GLsizei drawcount)
 {
-    return rx::MultiDrawArraysGeneral(this, context, mode, firsts, counts, drawcount);
+    VertexArrayVk *vertexArrayVk = getVertexArray();
+    if (drawcount <= 1 || !CanMultiDrawUseSingleSetup(context, vertexArrayVk, mode))
+    {
+        return rx::MultiDrawArraysGeneral(this, context, mode, firsts, counts, drawcount);
+    }
+
+    // Set up pipeline and descriptor state once; the sub draws only differ in their vertex
+    // offsets, so the recording loop is nothing but draw commands.
+    ANGLE_TRY(setupDraw(context, mode, firsts[0], counts[0], 1, gl::DrawElementsType::InvalidEnum,
+                        nullptr, mNonIndexedDirtyBitsMask));
+
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (counts[drawID] <= 0)
+        {
+            continue;
+        }
+        mRenderPassCommandBuffer->draw(gl::GetClampedVertexCount<uint32_t>(counts[drawID]),
+                                       firsts[drawID]);
+    }
+
+    return angle::Result::Continue;
 }
 
 angle::Result ContextVk::multiDrawArraysInstanced(const gl::Context *context,
@@ -3713,8 +4176,27 @@ angle::Result ContextVk::multiDrawArraysInstanced(const gl::Context *context,
                                                   const GLsizei *instanceCounts,
                                                   GLsizei drawcount)
 {
-    return rx::MultiDrawArraysInstancedGeneral(this, context, mode, firsts, counts, instanceCounts,
-                                               drawcount);
+    VertexArrayVk *vertexArrayVk = getVertexArray();
+    if (drawcount <= 1 || !CanMultiDrawUseSingleSetup(context, vertexArrayVk, mode))
+    {
+        return rx::MultiDrawArraysInstancedGeneral(this, context, mode, firsts, counts,
+                                                   instanceCounts, drawcount);
+    }
+
+    ANGLE_TRY(setupDraw(context, mode, firsts[0], counts[0], instanceCounts[0],
+                        gl::DrawElementsType::InvalidEnum, nullptr, mNonIndexedDirtyBitsMask));
+
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (counts[drawID] <= 0 || instanceCounts[drawID] <= 0)
+        {
+            continue;
+        }
+        mRenderPassCommandBuffer->drawInstanced(gl::GetClampedVertexCount<uint32_t>(counts[drawID]),
+                                                instanceCounts[drawID], firsts[drawID]);
+    }
+
+    return angle::Result::Continue;
 }
 
 angle::Result ContextVk::multiDrawArraysIndirect(const gl::Context *context,
@@ -3799,7 +4281,31 @@ angle::Result ContextVk::multiDrawElements(const gl::Context *context,
                                            const GLvoid *const *indices,
                                            GLsizei drawcount)
 {
-    return rx::MultiDrawElementsGeneral(this, context, mode, counts, type, indices, drawcount);
+    VertexArrayVk *vertexArrayVk = getVertexArray();
+    if (drawcount <= 1 || !CanMultiDrawUseSingleSetup(context, vertexArrayVk, mode) ||
+        !CanMultiDrawElementsUseFirstIndex(this, vertexArrayVk, type, indices, drawcount))
+    {
+        return rx::MultiDrawElementsGeneral(this, context, mode, counts, type, indices, drawcount);
+    }
+
+    // Bind the index buffer at offset zero once and let every sub draw select its indices through
+    // firstIndex, so no index buffer rebinding happens between the sub draws.
+    ANGLE_TRY(setupIndexedDraw(context, mode, counts[0], 1, type, nullptr));
+
+    const size_t indexSize = gl::GetDrawElementsTypeSize(type);
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (counts[drawID] <= 0)
+        {
+            continue;
+        }
+        const uint32_t firstIndex =
+            static_cast<uint32_t>(reinterpret_cast<uintptr_t>(indices[drawID]) / indexSize);
+        mRenderPassCommandBuffer->drawIndexedInstancedBaseVertexBaseInstance(counts[drawID], 1,
+                                                                             firstIndex, 0, 0);
+    }
+
+    return angle::Result::Continue;
 }
 
 angle::Result ContextVk::multiDrawElementsInstanced(const gl::Context *context,
@@ -3810,8 +4316,30 @@ angle::Result ContextVk::multiDrawElementsInstanced(const gl::Context *context,
                                                     const GLsizei *instanceCounts,
                                                     GLsizei drawcount)
 {
-    return rx::MultiDrawElementsInstancedGeneral(this, context, mode, counts, type, indices,
-                                                 instanceCounts, drawcount);
+    VertexArrayVk *vertexArrayVk = getVertexArray();
+    if (drawcount <= 1 || !CanMultiDrawUseSingleSetup(context, vertexArrayVk, mode) ||
+        !CanMultiDrawElementsUseFirstIndex(this, vertexArrayVk, type, indices, drawcount))
+    {
+        return rx::MultiDrawElementsInstancedGeneral(this, context, mode, counts, type, indices,
+                                                     instanceCounts, drawcount);
+    }
+
+    ANGLE_TRY(setupIndexedDraw(context, mode, counts[0], instanceCounts[0], type, nullptr));
+
+    const size_t indexSize = gl::GetDrawElementsTypeSize(type);
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (counts[drawID] <= 0 || instanceCounts[drawID] <= 0)
+        {
+            continue;
+        }
+        const uint32_t firstIndex =
+            static_cast<uint32_t>(reinterpret_cast<uintptr_t>(indices[drawID]) / indexSize);
+        mRenderPassCommandBuffer->drawIndexedInstancedBaseVertexBaseInstance(
+            counts[drawID], instanceCounts[drawID], firstIndex, 0, 0);
+    }
+
+    return angle::Result::Continue;
 }
 
 angle::Result ContextVk::multiDrawElementsIndirect(const gl::Context *context,
@@ -4465,6 +4993,21 @@ void ContextVk::updateScissor(const gl::State &glState)
     }
 
     gl::Rectangle scissoredArea = ClipRectToScissor(getState(), viewportClippedRenderArea, false);
+
+    // EGL_KHR_partial_update: rendering outside the frame's declared damage region is undefined,
+    // so the scissor (and with it the render area below) can be clipped to the region's bounding
+    // box.
+    gl::Rectangle damageBounds;
+    if (framebufferVk->getDamageRegionBounds(&damageBounds))
+    {
+        gl::Rectangle damageClippedArea;
+        if (!gl::ClipRectangle(scissoredArea, damageBounds, &damageClippedArea))
+        {
+            damageClippedArea = gl::Rectangle();
+        }
+        scissoredArea = damageClippedArea;
+    }
+
     gl::Rectangle rotatedScissoredArea;
     RotateRectangle(getRotationDrawFramebuffer(), isViewportFlipEnabledForDrawFBO(),
                     renderArea.width, renderArea.height, scissoredArea, &rotatedScissoredArea);
@@ -5753,6 +6296,12 @@ angle::Result ContextVk::onBeginTransformFeedback(
 
     // If any of the buffers were previously used in the render pass, break the render pass as a
     // barrier is needed.
+    //
+    // Note that this break is a true data dependency and the only one capture itself incurs: once
+    // transform feedback is begun, the draws that capture keep writing the buffers as (emulated
+    // path) storage buffers or (extension path) transform feedback buffers inside the same render
+    // pass, with per-draw state limited to driver-uniform offset updates.  Capture therefore does
+    // not break the render pass per draw; only reusing a buffer across a begin/end boundary does.
     for (size_t bufferIndex = 0; bufferIndex < bufferCount; ++bufferIndex)
     {
         const vk::BufferHelper *buffer = buffers[bufferIndex];
@@ -6354,7 +6903,18 @@ angle::Result ContextVk::updateActiveTextures(const gl::Context *context, gl::Co
     const gl::ActiveTextureMask &activeTextures    = executable->getActiveSamplersMask();
     const gl::ActiveTextureTypeArray &textureTypes = executable->getActiveSamplerTypes();
 
-    mActiveTextures.fill(nullptr);
+    const gl::ActiveTextureMask changedUnits = mState.getAndResetChangedTextureUnits();
+
+    // Reset the units not used by the executable so no stale pointers survive an executable
+    // change; the active units keep their previous resolution so unchanged units can be skipped
+    // below.
+    for (size_t textureUnit = 0; textureUnit < mActiveTextures.size(); ++textureUnit)
+    {
+        if (!activeTextures.test(textureUnit))
+        {
+            mActiveTextures[textureUnit] = nullptr;
+        }
+    }
 
     bool recreatePipelineLayout                       = false;
     ImmutableSamplerIndexMap immutableSamplerIndexMap = {};
@@ -6364,6 +6924,22 @@ angle::Result ContextVk::updateActiveTextures(const gl::Context *context, gl::Co
         gl::TextureType textureType = textureTypes[textureUnit];
         ASSERT(textureType != gl::TextureType::InvalidEnum);
 
+        // Units whose binding and sampler did not change since the last walk keep their resolved
+        // texture.  Depth/stencil textures are still reprocessed for feedback loop detection, as
+        // it also depends on the bound draw framebuffer, and textures with immutable samplers to
+        // rebuild the compatibility map below.
+        TextureVk *previousTexture = mActiveTextures[textureUnit];
+        if (!changedUnits.test(textureUnit) && previousTexture != nullptr)
+        {
+            const bool needsFeedbackLoopCheck = texture != nullptr && texture->isDepthOrStencil();
+            const bool hasImmutableSampler    = textureType != gl::TextureType::Buffer &&
+                                             previousTexture->getImage().hasImmutableSampler();
+            if (!needsFeedbackLoopCheck && !hasImmutableSampler)
+            {
+                continue;
+            }
+        }
+
         const bool isIncompleteTexture = texture == nullptr;
 
         // Null textures represent incomplete textures.
@@ -6436,6 +7012,19 @@ angle::Result ContextVk::updateActiveTextures(const gl::Context *context, gl::Co
                 image.getActualFormat().glInternalFormat);
         }
 
+        // Immutable-sampler promotion bookkeeping: a sampler object change on this unit restarts
+        // its stability clock.
+        const SamplerVk *samplerVk = sampler ? vk::GetImpl(sampler) : nullptr;
+        const uint32_t samplerSerial =
+            (samplerVk ? samplerVk->getSampler() : textureVk->getSampler(false))
+                .getSamplerSerial()
+                .getValue();
+        if (samplerSerial != mTextureUnitSamplerSerials[textureUnit])
+        {
+            mTextureUnitSamplerSerials[textureUnit]      = samplerSerial;
+            mTextureUnitSamplerStableFrames[textureUnit] = 0;
+        }
+
         if (image.hasImmutableSampler())
         {
             immutableSamplerIndexMap[image.getYcbcrConversionDesc()] =
@@ -6453,6 +7042,14 @@ angle::Result ContextVk::updateActiveTextures(const gl::Context *context, gl::Co
         recreatePipelineLayout = true;
     }
 
+    // Promote samplers that have stayed stable for kSamplerPromotionFrameThreshold frames into
+    // the pipeline layout as immutable samplers, and demote any promoted sampler that has since
+    // changed.  Either transition requires a new pipeline layout.
+    if (executableVk->updateSamplerPromotions(this, *executable, mActiveTextures))
+    {
+        recreatePipelineLayout = true;
+    }
+
     // Recreate the pipeline layout, if necessary.
     if (recreatePipelineLayout)
     {
@@ -6837,6 +7434,10 @@ angle::Result ContextVk::beginNewRenderPass(
     // here for various reasons, except typically when UtilsVk needs to start one.
     ANGLE_TRY(flushCommandsAndEndRenderPass(RenderPassClosureReason::NewRenderPass));
 
+    // Assume an internal render pass; FramebufferVk overrides this right after for render passes it
+    // starts, so usage history is only recorded for application framebuffers.
+    mCurrentRenderPassFramebufferSerial = Serial();
+
     // The last render pass serial is also incremented and used to update the render pass command
     // buffer helper and the framebuffer object (via the output argument). Note that UtilsVk ignores
     // the output serial.
@@ -6867,6 +7468,8 @@ angle::Result ContextVk::startRenderPass(gl::Rectangle renderArea,
 
     ANGLE_TRY(resumeRenderPassQueriesIfActive());
 
+    ANGLE_TRY(beginOverlayPipelineStatsQuery());
+
     if (commandBufferOut)
     {
         *commandBufferOut = mRenderPassCommandBuffer;
@@ -6930,6 +7533,9 @@ angle::Result ContextVk::flushCommandsAndEndRenderPassImpl(QueueSubmitType queue
         return angle::Result::Continue;
     }
 
+    // Record any batched scissored clears before the render pass is closed.
+    flushBatchedScissoredClears();
+
     // Set dirty bits if render pass was open (and thus will be closed).
     mGraphicsDirtyBits |= mNewGraphicsCommandBufferDirtyBits;
     // Restart at subpass 0.
@@ -6937,6 +7543,9 @@ angle::Result ContextVk::flushCommandsAndEndRenderPassImpl(QueueSubmitType queue
 
     mCurrentTransformFeedbackBuffers.clear();
 
+    mPreviousRenderPassColorImageSerials.clear();
+    mRenderPassCommands->getColorAttachmentImageSerials(&mPreviousRenderPassColorImageSerials);
+
     onRenderPassFinished(reason);
 
     if (mGpuEventsEnabled)
@@ -6949,8 +7558,23 @@ angle::Result ContextVk::flushCommandsAndEndRenderPassImpl(QueueSubmitType queue
 
     addOverlayUsedBuffersCount(mRenderPassCommands);
 
+    endOverlayPipelineStatsQuery();
+    ANGLE_TRY(checkCompletedOverlayPipelineStatsQueries());
+
     pauseTransformFeedbackIfActiveUnpaused();
 
+    if (getFeatures().predictiveRenderPassStoreOps.enabled &&
+        mCurrentRenderPassFramebufferSerial.valid())
+    {
+        // Update the framebuffer's attachment usage history and elide the store of attachments
+        // that are predictably never read back.
+        mRenderPassCommands->updateAndApplyStoreOpHistory(
+            &mRenderPassStoreOpHistories[mCurrentRenderPassFramebufferSerial.getValue()]);
+    }
+
+    // Estimate attachment bandwidth after the store ops have taken their final values.
+    accumulateAttachmentBandwidth();
+
     ANGLE_TRY(mRenderPassCommands->endRenderPass(this));
 
     if (vk::CommandBufferHelperCommon::kEnableCommandStreamDiagnostics)
@@ -7182,6 +7806,10 @@ angle::Result ContextVk::submitOutsideRenderPassCommandsImpl()
 
 angle::Result ContextVk::flushOutsideRenderPassCommands()
 {
+    // Record any batched image copy regions first, so they land in this command buffer whose
+    // barriers cover them.
+    flushPendingImageCopy();
+
     if (mOutsideRenderPassCommands->empty())
     {
         return angle::Result::Continue;
@@ -7445,19 +8073,118 @@ bool ContextVk::shouldSwitchToReadOnlyDepthFeedbackLoopMode(gl::Texture *texture
            !mState.isDepthWriteEnabled() && !drawFramebufferVk->isReadOnlyDepthFeedbackLoopMode();
 }
 
+angle::Result ContextVk::batchImageCopy(vk::ImageHelper *srcImage,
+                                        vk::ImageHelper *dstImage,
+                                        gl::LevelIndex dstLevelGL,
+                                        uint32_t dstLayerStart,
+                                        uint32_t dstLayerCount,
+                                        const VkImageCopy &region)
+{
+    ASSERT(srcImage != dstImage);
+
+    // If this copy follows one between the same pair of images, append the region to the pending
+    // batch; the barrier pair recorded when the batch was started already covers it.  A region
+    // that overlaps a pending destination region cannot join the batch: vkCmdCopyImage leaves the
+    // result of overlapping destination regions undefined, so the batch is cut and a new barrier
+    // orders the two writes.  Similarly, if an open render pass uses either image, the batch is
+    // cut so flushCommandBuffersIfNecessary can close the render pass first.
+    if (mPendingImageCopy.valid() &&
+        mPendingImageCopy.srcImageSerial == srcImage->getImageSerial() &&
+        mPendingImageCopy.dstImageSerial == dstImage->getImageSerial() &&
+        !IsRenderPassStartedAndUsesImage(*mRenderPassCommands, *srcImage) &&
+        !IsRenderPassStartedAndUsesImage(*mRenderPassCommands, *dstImage))
+    {
+        bool overlapsPendingRegion = false;
+        for (const VkImageCopy &pendingRegion : mPendingImageCopy.regions)
+        {
+            if (ImageCopyDstRegionsOverlap(pendingRegion, region))
+            {
+                overlapsPendingRegion = true;
+                break;
+            }
+        }
+
+        if (!overlapsPendingRegion)
+        {
+            mPendingImageCopy.regions.push_back(region);
+            dstImage->onWrite(dstLevelGL, 1, dstLayerStart, dstLayerCount,
+                              VK_IMAGE_ASPECT_COLOR_BIT);
+            mPerfCounters.imageCopyRegionsBatched++;
+            return angle::Result::Continue;
+        }
+    }
+
+    flushPendingImageCopy();
+
+    vk::CommandBufferAccess access;
+    access.onImageTransferRead(VK_IMAGE_ASPECT_COLOR_BIT, srcImage);
+    access.onImageTransferWrite(dstLevelGL, 1, dstLayerStart, dstLayerCount,
+                                VK_IMAGE_ASPECT_COLOR_BIT, dstImage);
+    ANGLE_TRY(onResourceAccess(access));
+
+    ASSERT(srcImage->getCurrentLayout() == VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+    ASSERT(dstImage->getCurrentLayout() == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
+    mPendingImageCopy.srcImage       = srcImage->getImage().getHandle();
+    mPendingImageCopy.dstImage       = dstImage->getImage().getHandle();
+    mPendingImageCopy.srcImageSerial = srcImage->getImageSerial();
+    mPendingImageCopy.dstImageSerial = dstImage->getImageSerial();
+    mPendingImageCopy.srcImageLayout = srcImage->getCurrentLayout();
+    mPendingImageCopy.dstImageLayout = dstImage->getCurrentLayout();
+    mPendingImageCopy.regions.push_back(region);
+
+    return angle::Result::Continue;
+}
+
+void ContextVk::flushPendingImageCopy()
+{
+    if (!mPendingImageCopy.valid())
+    {
+        return;
+    }
+
+    mOutsideRenderPassCommands->getCommandBuffer().copyImage(
+        mPendingImageCopy.srcImage, mPendingImageCopy.srcImageLayout, mPendingImageCopy.dstImage,
+        mPendingImageCopy.dstImageLayout, static_cast<uint32_t>(mPendingImageCopy.regions.size()),
+        mPendingImageCopy.regions.data());
+
+    mPendingImageCopy.srcImage       = VK_NULL_HANDLE;
+    mPendingImageCopy.dstImage       = VK_NULL_HANDLE;
+    mPendingImageCopy.srcImageSerial = vk::ImageSerial();
+    mPendingImageCopy.dstImageSerial = vk::ImageSerial();
+    mPendingImageCopy.regions.clear();
+}
+
 angle::Result ContextVk::onResourceAccess(const vk::CommandBufferAccess &access)
 {
+    // If an image copy batch is pending, record it now; the new access may write the batched
+    // images or otherwise need to order against them.
+    flushPendingImageCopy();
+
+    // Transfer-style consumers (PBO reads, buffer and image copies, utils passes) reach buffer
+    // contents through here; flush any coalesced small buffer updates first.  This re-enters when
+    // the flush itself records its copy, which the share group guards against.
+    ANGLE_TRY(mShareGroupVk->flushBuffersWithPendingSubData(this));
+
     ANGLE_TRY(flushCommandBuffersIfNecessary(access));
 
     vk::OutsideRenderPassCommandBuffer *commandBuffer =
         &mOutsideRenderPassCommands->getCommandBuffer();
 
+    // Collect the layout transitions of all accessed images into one barrier; back-to-back
+    // single-image barriers cause GPU bubbles on some hardware.
+    ASSERT(mImageAccessBarrier.isEmpty());
+    uint32_t imageBarrierCount = 0;
+
     for (const vk::CommandBufferImageAccess &imageAccess : access.getReadImages())
     {
         ASSERT(!IsRenderPassStartedAndUsesImage(*mRenderPassCommands, *imageAccess.image));
 
-        imageAccess.image->recordReadBarrier(this, imageAccess.aspectFlags, imageAccess.imageLayout,
-                                             commandBuffer);
+        if (imageAccess.image->recordReadBarrier(this, imageAccess.aspectFlags,
+                                                 imageAccess.imageLayout, &mImageAccessBarrier))
+        {
+            ++imageBarrierCount;
+        }
         mOutsideRenderPassCommands->retainResource(imageAccess.image);
     }
 
@@ -7465,14 +8192,25 @@ angle::Result ContextVk::onResourceAccess(const vk::CommandBufferAccess &access)
     {
         ASSERT(!IsRenderPassStartedAndUsesImage(*mRenderPassCommands, *imageWrite.access.image));
 
-        imageWrite.access.image->recordWriteBarrier(this, imageWrite.access.aspectFlags,
-                                                    imageWrite.access.imageLayout, commandBuffer);
+        if (imageWrite.access.image->recordWriteBarrier(this, imageWrite.access.aspectFlags,
+                                                        imageWrite.access.imageLayout,
+                                                        &mImageAccessBarrier))
+        {
+            ++imageBarrierCount;
+        }
         mOutsideRenderPassCommands->retainResource(imageWrite.access.image);
         imageWrite.access.image->onWrite(imageWrite.levelStart, imageWrite.levelCount,
                                          imageWrite.layerStart, imageWrite.layerCount,
                                          imageWrite.access.aspectFlags);
     }
 
+    // Report how many individual barrier calls were folded into the merged one.
+    if (imageBarrierCount > 1)
+    {
+        mPerfCounters.imageBarriersMerged += imageBarrierCount - 1;
+    }
+    mImageAccessBarrier.execute(commandBuffer);
+
     for (const vk::CommandBufferBufferAccess &bufferAccess : access.getReadBuffers())
     {
         ASSERT(!mRenderPassCommands->usesBufferForWrite(*bufferAccess.buffer));
@@ -7870,9 +8608,63 @@ uint32_t UpdateDescriptorSetsBuilder::flushDescriptorSetUpdates(VkDevice device)
     return retVal;
 }
 
+DefaultUniformUploadPool::DefaultUniformUploadPool() = default;
+
+DefaultUniformUploadPool::~DefaultUniformUploadPool() = default;
+
+void DefaultUniformUploadPool::updateBufferTenure(vk::BufferSerial bufferSerial,
+                                                  uint32_t bufferGeneration)
+{
+    if (bufferSerial != mBufferSerial || bufferGeneration != mBufferGeneration)
+    {
+        mEntries.clear();
+        mBufferSerial     = bufferSerial;
+        mBufferGeneration = bufferGeneration;
+    }
+}
+
+bool DefaultUniformUploadPool::findMatchingUpload(size_t hash,
+                                                  const angle::MemoryBuffer &data,
+                                                  uint32_t *dynamicOffsetOut) const
+{
+    auto iter = mEntries.find(hash);
+    if (iter == mEntries.end() || iter->second.data.size() != data.size() ||
+        memcmp(iter->second.data.data(), data.data(), data.size()) != 0)
+    {
+        return false;
+    }
+    *dynamicOffsetOut = iter->second.dynamicOffset;
+    return true;
+}
+
+void DefaultUniformUploadPool::recordUpload(size_t hash,
+                                            const angle::MemoryBuffer &data,
+                                            uint32_t dynamicOffset)
+{
+    if (mEntries.size() >= kMaxEntries)
+    {
+        mEntries.clear();
+    }
+
+    Entry &entry = mEntries[hash];
+    if (!entry.data.resize(data.size()))
+    {
+        mEntries.erase(hash);
+        return;
+    }
+    memcpy(entry.data.data(), data.data(), data.size());
+    entry.dynamicOffset = dynamicOffset;
+}
+
 void ContextVk::resetPerFramePerfCounters()
 {
     mPerfCounters.renderPasses                           = 0;
+    mPerfCounters.drawCalls                              = 0;
+    mPerfCounters.vertexShaderInvocations                = 0;
+    mPerfCounters.fragmentShaderInvocations              = 0;
+    mPerfCounters.estimatedAttachmentBandwidthBytes      = 0;
+    mPerfCounters.estimatedTextureFetchBandwidthBytes    = 0;
+    mPerfCounters.estimatedBufferTransferBandwidthBytes  = 0;
     mPerfCounters.writeDescriptorSets                    = 0;
     mPerfCounters.flushedOutsideRenderPassCommandBuffers = 0;
     mPerfCounters.resolveImageCommands                   = 0;
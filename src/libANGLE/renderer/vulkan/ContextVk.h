@@ -92,6 +92,46 @@ class UpdateDescriptorSetsBuilder final : angle::NonCopyable
     std::vector<VkBufferView> mBufferViews;
 };
 
+// Remembers ranges of the context's shared default uniform buffer that hold recently uploaded
+// block contents, keyed by a hash of those contents.  When a program's dirty default uniform
+// block is byte-identical to a block some program already uploaded in the current buffer tenure
+// -- common when many programs share most of their material values -- updateUniforms() aliases
+// the uploaded range through the dynamic descriptor offset instead of uploading another copy.
+// Entries are dropped whenever the underlying buffer moves, since the ranges they name die with
+// it.
+class DefaultUniformUploadPool final : angle::NonCopyable
+{
+  public:
+    DefaultUniformUploadPool();
+    ~DefaultUniformUploadPool();
+
+    // Drops all entries if the shared buffer has moved since they were recorded.
+    void updateBufferTenure(vk::BufferSerial bufferSerial, uint32_t bufferGeneration);
+
+    // Returns the dynamic offset of an uploaded range whose contents equal |data|, if any.
+    bool findMatchingUpload(size_t hash,
+                            const angle::MemoryBuffer &data,
+                            uint32_t *dynamicOffsetOut) const;
+    // Records an upload of |data| at |dynamicOffset|.  A shadow copy of the contents is kept for
+    // exact comparison, so a hash collision can never alias unrelated blocks.
+    void recordUpload(size_t hash, const angle::MemoryBuffer &data, uint32_t dynamicOffset);
+
+  private:
+    // Bounds the shadow-copy memory during heavy uniform churn; the pool only needs to span the
+    // handful of programs an application cycles through between buffer switches.
+    static constexpr size_t kMaxEntries = 64;
+
+    struct Entry
+    {
+        angle::MemoryBuffer data;
+        uint32_t dynamicOffset;
+    };
+
+    vk::BufferSerial mBufferSerial;
+    uint32_t mBufferGeneration = 0;
+    angle::HashMap<size_t, Entry> mEntries;
+};
+
 // Why depth/stencil feedback loop is being updated.  Based on whether it's due to a draw or clear,
 // different GL state affect depth/stencil write.
 enum class UpdateDepthFeedbackLoopReason
@@ -426,6 +466,14 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     angle::Result onFramebufferChange(FramebufferVk *framebufferVk, gl::Command command);
     void onDrawFramebufferRenderPassDescChange(FramebufferVk *framebufferVk,
                                                bool *renderPassDescChangedOut);
+    // Called by FramebufferVk when scissored clears are batched, so they can be recorded before
+    // the next draw or before the render pass is closed.
+    void onBatchedScissoredClear(FramebufferVk *framebufferVk)
+    {
+        mPendingBatchedClearsFramebuffer = framebufferVk;
+    }
+    // Records any pending batched scissored clears into the render pass they were batched against.
+    void flushBatchedScissoredClears();
     void onHostVisibleBufferWrite() { mIsAnyHostVisibleBufferWritten = true; }
 
     void invalidateCurrentTransformFeedbackBuffers();
@@ -537,6 +585,18 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
 
     RenderPassCache &getRenderPassCache() { return mRenderPassCache; }
 
+    // Get or create the vertex-input and fragment-output pipeline libraries for |desc|.  These
+    // subsets carry no shader code, so the libraries are shared by every program in the context
+    // when VK_EXT_graphics_pipeline_library is used.
+    angle::Result getVertexInputGraphicsPipeline(PipelineCacheAccess *pipelineCache,
+                                                 PipelineSource source,
+                                                 const vk::GraphicsPipelineDesc &desc,
+                                                 vk::PipelineHelper **pipelineOut);
+    angle::Result getFragmentOutputGraphicsPipeline(PipelineCacheAccess *pipelineCache,
+                                                    PipelineSource source,
+                                                    const vk::GraphicsPipelineDesc &desc,
+                                                    vk::PipelineHelper **pipelineOut);
+
     bool emulateSeamfulCubeMapSampling() const { return mEmulateSeamfulCubeMapSampling; }
 
     const gl::Debug &getDebug() const { return mState.getDebug(); }
@@ -619,6 +679,18 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
         return flushOutsideRenderPassCommands();
     }
 
+    // Batches compatible image-to-image transfer copies.  Back-to-back copies between the same
+    // source/destination pair (sprite-atlas maintenance commonly issues dozens per frame) are
+    // accumulated and recorded as a single multi-region copyImage with one barrier pair, instead
+    // of one barrier pair per region.  The pending regions are recorded into the outside render
+    // pass command buffer before any other resource access or command buffer flush.
+    angle::Result batchImageCopy(vk::ImageHelper *srcImage,
+                                 vk::ImageHelper *dstImage,
+                                 gl::LevelIndex dstLevelGL,
+                                 uint32_t dstLayerStart,
+                                 uint32_t dstLayerCount,
+                                 const VkImageCopy &region);
+
     angle::Result beginNewRenderPass(vk::MaybeImagelessFramebuffer &framebuffer,
                                      const gl::Rectangle &renderArea,
                                      const vk::RenderPassDesc &renderPassDesc,
@@ -647,6 +719,13 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
         return hasStartedRenderPass() && !mRenderPassCommands->getCommandBuffer().empty();
     }
 
+    // Called by FramebufferVk when it starts a render pass, so the render pass can be attributed
+    // to the framebuffer's attachment usage history (for predictiveRenderPassStoreOps).
+    void onFramebufferRenderPassStarted(Serial framebufferSerial)
+    {
+        mCurrentRenderPassFramebufferSerial = framebufferSerial;
+    }
+
     vk::RenderPassCommandBufferHelper &getStartedRenderPassCommands()
     {
         ASSERT(mRenderPassCommands->started());
@@ -704,8 +783,47 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     QueryVk *getActiveRenderPassQuery(gl::QueryType queryType) const;
 
     void syncObjectPerfCounters(const angle::VulkanPerfCounters &commandQueuePerfCounters);
+
+    // EGL_ANGLE_frame_profile: snapshot the cumulative per-reason render pass closure counters
+    // into the application-visible struct (see doc/RenderPassClosures.md).
+    void writeRenderPassClosureCounts(ANGLERenderPassClosureCounts *countsOut) const;
+
     void updateOverlayOnPresent();
+
+    // EGL_ANGLE_display_telemetry: publish the backend counters into the display's telemetry
+    // block.  No-op until the application queries EGL_TELEMETRY_COUNTERS_ANGLE.
+    void updateTelemetryCountersOnPresent();
+
+    // Give the share group's descriptor pools a chance to pre-allocate for the next frame, so
+    // pool growth happens at swap time rather than in the middle of a draw sequence.
+    angle::Result prepareDescriptorPoolsForNextFrame();
+
+    // Number of consecutive presented frames a texture unit's sampler must stay unchanged before
+    // it is folded into the pipeline layout as an immutable sampler.
+    static constexpr uint32_t kSamplerPromotionFrameThreshold = 30;
+
+    bool isTextureUnitSamplerPromotable(size_t textureUnit) const
+    {
+        return mTextureUnitSamplerStableFrames[textureUnit] >= kSamplerPromotionFrameThreshold;
+    }
+    uint32_t getTextureUnitSamplerSerial(size_t textureUnit) const
+    {
+        return mTextureUnitSamplerSerials[textureUnit];
+    }
+
+    // Called once per present; ages the per-unit sampler stability clocks.
+    void ageSamplerStabilityOnPresent()
+    {
+        for (uint32_t &stableFrames : mTextureUnitSamplerStableFrames)
+        {
+            if (stableFrames < kSamplerPromotionFrameThreshold)
+            {
+                ++stableFrames;
+            }
+        }
+    }
     void addOverlayUsedBuffersCount(vk::CommandBufferHelperCommon *commandBuffer);
+    void accumulateAttachmentBandwidth();
 
     // For testing only.
     void setDefaultUniformBlocksMinSizeForTesting(size_t minSize);
@@ -1225,6 +1343,9 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                                     const EventName &name);
     angle::Result checkCompletedGpuEvents();
     void flushGpuEvents(double nextSyncGpuTimestampS, double nextSyncCpuTimestampS);
+    angle::Result beginOverlayPipelineStatsQuery();
+    void endOverlayPipelineStatsQuery();
+    angle::Result checkCompletedOverlayPipelineStatsQueries();
     void handleDeviceLost();
     bool shouldEmulateSeamfulCubeMapSampling() const;
     void clearAllGarbage();
@@ -1286,6 +1407,7 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
 
     angle::Result onResourceAccess(const vk::CommandBufferAccess &access);
     angle::Result flushCommandBuffersIfNecessary(const vk::CommandBufferAccess &access);
+    void flushPendingImageCopy();
     bool renderPassUsesStorageResources() const;
 
     angle::Result pushDebugGroupImpl(GLenum source, GLuint id, const char *message);
@@ -1345,6 +1467,13 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // we'd instead share a single set of pools between the share groups.
     gl::QueryTypeMap<vk::DynamicQueryPool> mQueryPools;
 
+    // Pipeline statistics queries issued per render pass to feed the overlay's vertex/fragment
+    // shader invocation widgets.  These are internal to the backend and not exposed as GL queries.
+    vk::DynamicQueryPool mOverlayPipelineStatsQueryPool;
+    vk::QueryHelper mActiveOverlayPipelineStatsQuery;
+    // Ended queries whose results are not yet available, in submission order.
+    std::vector<vk::QueryHelper> mPendingOverlayPipelineStatsQueries;
+
     // Queries that need to be closed and reopened with the render pass:
     //
     // - Occlusion queries
@@ -1410,14 +1539,40 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // This info is used in the descriptor update step.
     gl::ActiveTextureArray<TextureVk *> mActiveTextures;
 
+    // Immutable-sampler promotion bookkeeping: the sampler serial last seen on each texture unit
+    // and the number of consecutive presented frames it has stayed unchanged.  Units that stay
+    // stable long enough get their sampler folded into the pipeline layout as an immutable
+    // sampler (see ProgramExecutableVk::updateSamplerPromotions).
+    gl::ActiveTextureArray<uint32_t> mTextureUnitSamplerSerials;
+    gl::ActiveTextureArray<uint32_t> mTextureUnitSamplerStableFrames;
+
     // We use textureSerial to optimize texture binding updates. Each permutation of a
     // {VkImage/VkSampler} generates a unique serial. These object ids are combined to form a unique
     // signature for each descriptor set. This allows us to keep a cache of descriptor sets and
     // avoid calling vkAllocateDesctiporSets each texture update.
     vk::DescriptorSetDesc mActiveTexturesDesc;
 
+    // Framebuffer with batched scissored clears pending against the current render pass, if any.
+    // See the batchScissoredClearAttachments feature.
+    FramebufferVk *mPendingBatchedClearsFramebuffer = nullptr;
+
+    // Color attachments of the most recently closed render pass.  Sampling one of these images in
+    // the following render pass indicates a store-then-sample chain; such passes could be merged
+    // with framebuffer fetch, which is a significant bandwidth win on tilers.
+    angle::FixedVector<vk::ImageSerial, gl::IMPLEMENTATION_MAX_DRAW_BUFFERS>
+        mPreviousRenderPassColorImageSerials;
+
+    // Cumulative number of render passes closed for each reason, for app-visible flush cost
+    // accounting (EGL_RENDER_PASS_CLOSURE_COUNTS_ANGLE).
+    angle::PackedEnumMap<RenderPassClosureReason, uint64_t> mRenderPassClosureCounts;
+
     vk::DescriptorSetDescBuilder mShaderBuffersDescriptorDesc;
 
+    // Scratch descriptor set builder for the uniforms-and-xfb update done on every draw call while
+    // emulating transform feedback.  Reused across draws so the handler doesn't construct (and
+    // potentially heap-allocate) a builder per draw.
+    vk::DescriptorSetDescBuilder mUniformsAndXfbDescriptorDesc;
+
     gl::ActiveTextureArray<TextureVk *> mActiveImages;
 
     // "Current Value" aka default vertex attribute state.
@@ -1436,9 +1591,38 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
 
     RenderPassCache mRenderPassCache;
 
+    // Pipeline libraries for the vertex-input and fragment-output subsets, shared by all programs
+    // when VK_EXT_graphics_pipeline_library is used.  The shaders subset libraries are owned by
+    // the programs, as they are derived from the shader code.
+    VertexInputGraphicsPipelineCache mVertexInputGraphicsPipelines;
+    FragmentOutputGraphicsPipelineCache mFragmentOutputGraphicsPipelines;
+
     vk::OutsideRenderPassCommandBufferHelper *mOutsideRenderPassCommands;
     vk::RenderPassCommandBufferHelper *mRenderPassCommands;
 
+    // Scratch barrier used by onResourceAccess to aggregate the layout transitions of all images
+    // accessed by a command into a single vkCmdPipelineBarrier call.
+    vk::PipelineBarrier mImageAccessBarrier;
+
+    // Image-to-image copy regions accumulated by batchImageCopy and not yet recorded.  The
+    // barriers and content bookkeeping for the batch are performed when the batch is started;
+    // only the VkImage handles are kept so the batch does not dangle if the owning ImageHelper is
+    // released before the regions are recorded (the handles stay valid until the command buffer
+    // retires).  Serials are used to recognize follow-up copies against the same pair.
+    struct PendingImageCopy
+    {
+        bool valid() const { return srcImage != VK_NULL_HANDLE; }
+
+        VkImage srcImage = VK_NULL_HANDLE;
+        VkImage dstImage = VK_NULL_HANDLE;
+        vk::ImageSerial srcImageSerial;
+        vk::ImageSerial dstImageSerial;
+        VkImageLayout srcImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        VkImageLayout dstImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        std::vector<VkImageCopy> regions;
+    };
+    PendingImageCopy mPendingImageCopy;
+
     // The following is used when creating debug-util markers for graphics debuggers (e.g. AGI).  A
     // given gl{Begin|End}Query command may result in commands being submitted to the outside or
     // render-pass command buffer.  The ContextVk::handleGraphicsEventLog() method records the
@@ -1530,6 +1714,10 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // Storage for default uniforms of ProgramVks and ProgramPipelineVks.
     vk::DynamicBuffer mDefaultUniformStorage;
 
+    // Tracks recently uploaded default uniform block contents so that programs whose blocks are
+    // identical can alias the same range of |mDefaultUniformStorage|.
+    DefaultUniformUploadPool mDefaultUniformUploadPool;
+
     std::vector<std::string> mCommandBufferDiagnostics;
 
     // Record GL API calls for debuggers
@@ -1547,6 +1735,12 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // The latest serial used for a started render pass.
     vk::RenderPassSerial mCurrentRenderPassSerial;
     RenderPassSerialFactory mRenderPassSerialFactory;
+
+    // The serial of the framebuffer that started the current render pass (invalid for render
+    // passes started internally, e.g. by UtilsVk), and the per-framebuffer attachment usage
+    // histories used by the predictiveRenderPassStoreOps feature.
+    Serial mCurrentRenderPassFramebufferSerial;
+    angle::HashMap<uint64_t, vk::RenderPassStoreOpHistory> mRenderPassStoreOpHistories;
 };
 
 ANGLE_INLINE angle::Result ContextVk::endRenderPassIfTransformFeedbackBuffer(
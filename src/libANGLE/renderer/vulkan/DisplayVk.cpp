@@ -9,6 +9,8 @@
 
 #include "libANGLE/renderer/vulkan/DisplayVk.h"
 
+#include <algorithm>
+
 #include "common/debug.h"
 #include "common/system_utils.h"
 #include "libANGLE/Context.h"
@@ -514,6 +516,10 @@ void DisplayVk::generateExtensions(egl::DisplayExtensions *outExtensions) const
 
     outExtensions->vulkanImageANGLE = true;
 
+    // Only advertised when pbuffer color buffers are actually allocated exportably; the
+    // allocation mode is chosen at surface creation.
+    outExtensions->surfaceMemoryFdANGLE = getRenderer()->isExportablePbufferMemoryEnabled();
+
     outExtensions->lockSurface3KHR =
         getRenderer()->getFeatures().supportsLockSurfaceExtension.enabled;
 
@@ -522,6 +528,12 @@ void DisplayVk::generateExtensions(egl::DisplayExtensions *outExtensions) const
     outExtensions->timestampSurfaceAttributeANGLE =
         getRenderer()->getFeatures().supportsTimestampSurfaceAttribute.enabled;
 
+    // The frame profile history is exported through eglQuerySurfacePointerANGLE.
+    outExtensions->querySurfacePointer = true;
+    outExtensions->frameProfileANGLE   = true;
+
+    outExtensions->displayTelemetryANGLE = true;
+
     outExtensions->eglColorspaceAttributePassthroughANGLE =
         outExtensions->glColorspace &&
         getRenderer()->getFeatures().eglColorspaceAttributePassthrough.enabled;
@@ -641,9 +653,12 @@ void ShareGroupVk::onDestroy(const egl::Display *display)
         }
     }
 
-    if (mSmallBufferPool)
+    for (std::unique_ptr<vk::BufferPool> &pool : mSmallBufferPools)
     {
-        mSmallBufferPool->destroy(renderer, mOrphanNonEmptyBufferBlock);
+        if (pool)
+        {
+            pool->destroy(renderer, mOrphanNonEmptyBufferBlock);
+        }
     }
 
     mPipelineLayoutCache.destroy(renderer);
@@ -681,6 +696,45 @@ void ShareGroupVk::onTextureRelease(TextureVk *textureVk)
     mTextureUpload.onTextureRelease(textureVk);
 }
 
+void ShareGroupVk::addBufferWithPendingSubData(BufferVk *bufferVk)
+{
+    mBuffersWithPendingSubData.push_back(bufferVk);
+}
+
+void ShareGroupVk::removeBufferWithPendingSubData(BufferVk *bufferVk)
+{
+    mBuffersWithPendingSubData.erase(
+        std::remove(mBuffersWithPendingSubData.begin(), mBuffersWithPendingSubData.end(), bufferVk),
+        mBuffersWithPendingSubData.end());
+}
+
+angle::Result ShareGroupVk::flushBuffersWithPendingSubData(ContextVk *contextVk)
+{
+    // Flushing a buffer records a copy, which re-enters this function through the context's
+    // resource access path; the pending list is detached first so the reentrant call is a no-op.
+    if (mBuffersWithPendingSubData.empty() || mFlushingPendingSubData)
+    {
+        return angle::Result::Continue;
+    }
+
+    mFlushingPendingSubData = true;
+    std::vector<BufferVk *> buffers = std::move(mBuffersWithPendingSubData);
+    mBuffersWithPendingSubData.clear();
+
+    angle::Result result = angle::Result::Continue;
+    for (BufferVk *bufferVk : buffers)
+    {
+        result = bufferVk->flushPendingSubData(contextVk);
+        if (result != angle::Result::Continue)
+        {
+            break;
+        }
+    }
+
+    mFlushingPendingSubData = false;
+    return result;
+}
+
 angle::Result TextureUpload::onMutableTextureUpload(ContextVk *contextVk, TextureVk *newTexture)
 {
     // This feature is currently disabled in the case of display-level texture sharing.
@@ -727,11 +781,11 @@ vk::BufferPool *ShareGroupVk::getDefaultBufferPool(RendererVk *renderer,
                                                    VkDeviceSize size,
                                                    uint32_t memoryTypeIndex)
 {
-    if (size <= kMaxSizeToUseSmallBufferPool &&
-        memoryTypeIndex ==
-            renderer->getVertexConversionBufferMemoryTypeIndex(vk::MemoryHostVisibility::Visible))
+    // Segregate small allocations into a separate size class so that they do not fragment the
+    // general pools that also serve large allocations.
+    if (size <= kMaxSizeToUseSmallBufferPool)
     {
-        if (!mSmallBufferPool)
+        if (!mSmallBufferPools[memoryTypeIndex])
         {
             const vk::Allocator &allocator = renderer->getAllocator();
             VkBufferUsageFlags usageFlags  = GetDefaultBufferUsageFlags(renderer);
@@ -742,9 +796,9 @@ vk::BufferPool *ShareGroupVk::getDefaultBufferPool(RendererVk *renderer,
             std::unique_ptr<vk::BufferPool> pool = std::make_unique<vk::BufferPool>();
             pool->initWithFlags(renderer, vma::VirtualBlockCreateFlagBits::BUDDY, usageFlags, 0,
                                 memoryTypeIndex, memoryPropertyFlags);
-            mSmallBufferPool = std::move(pool);
+            mSmallBufferPools[memoryTypeIndex] = std::move(pool);
         }
-        return mSmallBufferPool.get();
+        return mSmallBufferPools[memoryTypeIndex].get();
     }
     else if (!mDefaultBufferPools[memoryTypeIndex])
     {
@@ -780,9 +834,12 @@ void ShareGroupVk::pruneDefaultBufferPools(RendererVk *renderer)
             pool->pruneEmptyBuffers(renderer);
         }
     }
-    if (mSmallBufferPool)
+    for (std::unique_ptr<vk::BufferPool> &pool : mSmallBufferPools)
     {
-        mSmallBufferPool->pruneEmptyBuffers(renderer);
+        if (pool)
+        {
+            pool->pruneEmptyBuffers(renderer);
+        }
     }
 
     renderer->onBufferPoolPrune();
@@ -801,6 +858,13 @@ bool ShareGroupVk::isDueForBufferPoolPrune(RendererVk *renderer)
         return true;
     }
 
+    // Prune eagerly when allocations approach the memory budget so empty buffer blocks are
+    // returned to the OS before it starts killing processes.
+    if (renderer->getMemoryBudgetTracker()->isUnderPressure())
+    {
+        return true;
+    }
+
     // If we have destroyed a lot of memory, also prune to ensure memory gets freed as soon as
     // possible
     if (renderer->getSuballocationDestroyedSize() >= kMaxTotalEmptyBufferBytes)
@@ -823,11 +887,34 @@ void ShareGroupVk::calculateTotalBufferCount(size_t *bufferCount, VkDeviceSize *
             *totalSize += pool->getMemorySize();
         }
     }
-    if (mSmallBufferPool)
+    for (const std::unique_ptr<vk::BufferPool> &pool : mSmallBufferPools)
+    {
+        if (pool)
+        {
+            *bufferCount += pool->getBufferCount();
+            *totalSize += pool->getMemorySize();
+        }
+    }
+}
+
+VkDeviceSize ShareGroupVk::calculateTotalBufferUnusedSize() const
+{
+    VkDeviceSize totalUnusedSize = 0;
+    for (const std::unique_ptr<vk::BufferPool> &pool : mDefaultBufferPools)
+    {
+        if (pool)
+        {
+            totalUnusedSize += pool->getTotalUnusedMemorySize();
+        }
+    }
+    for (const std::unique_ptr<vk::BufferPool> &pool : mSmallBufferPools)
     {
-        *bufferCount += mSmallBufferPool->getBufferCount();
-        *totalSize += mSmallBufferPool->getMemorySize();
+        if (pool)
+        {
+            totalUnusedSize += pool->getTotalUnusedMemorySize();
+        }
     }
+    return totalUnusedSize;
 }
 
 void ShareGroupVk::logBufferPools() const
@@ -847,11 +934,14 @@ void ShareGroupVk::logBufferPools() const
             INFO() << "\t" << log.str();
         }
     }
-    if (mSmallBufferPool && mSmallBufferPool->getBufferCount() > 0)
+    for (const std::unique_ptr<vk::BufferPool> &pool : mSmallBufferPools)
     {
-        std::ostringstream log;
-        mSmallBufferPool->addStats(&log);
-        INFO() << "\t" << log.str();
+        if (pool && pool->getBufferCount() > 0)
+        {
+            std::ostringstream log;
+            pool->addStats(&log);
+            INFO() << "\t" << log.str();
+        }
     }
 }
 }  // namespace rx
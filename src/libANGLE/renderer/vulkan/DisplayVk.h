@@ -21,6 +21,7 @@ namespace rx
 {
 constexpr VkDeviceSize kMaxTotalEmptyBufferBytes = 16 * 1024 * 1024;
 
+class BufferVk;
 class RendererVk;
 using ContextVkSet = std::set<ContextVk *>;
 
@@ -73,6 +74,7 @@ class ShareGroupVk : public ShareGroupImpl
     bool isDueForBufferPoolPrune(RendererVk *renderer);
 
     void calculateTotalBufferCount(size_t *bufferCount, VkDeviceSize *totalSize) const;
+    VkDeviceSize calculateTotalBufferUnusedSize() const;
     void logBufferPools() const;
 
     void addContext(ContextVk *contextVk);
@@ -80,6 +82,13 @@ class ShareGroupVk : public ShareGroupImpl
 
     void onTextureRelease(TextureVk *textureVk);
 
+    // Buffers with small glBufferSubData updates coalesced in a CPU shadow
+    // (coalesceSmallBufferUpdates).  The list is swept before any GPU consumption of buffer
+    // contents; it lives on the share group because buffers are shared across contexts.
+    void addBufferWithPendingSubData(BufferVk *bufferVk);
+    void removeBufferWithPendingSubData(BufferVk *bufferVk);
+    angle::Result flushBuffersWithPendingSubData(ContextVk *contextVk);
+
   private:
     // VkFramebuffer caches
     FramebufferCache mFramebufferCache;
@@ -105,8 +114,10 @@ class ShareGroupVk : public ShareGroupImpl
     // The per shared group buffer pools that all buffers should sub-allocate from.
     vk::BufferPoolPointerArray mDefaultBufferPools;
 
-    // The pool dedicated for small allocations that uses faster buddy algorithm
-    std::unique_ptr<vk::BufferPool> mSmallBufferPool;
+    // The per memory type pools dedicated for small allocations that use the faster buddy
+    // algorithm. Segregating small allocations from large ones keeps large pools from getting
+    // fragmented by many tiny long-lived suballocations.
+    vk::BufferPoolPointerArray mSmallBufferPools;
     static constexpr VkDeviceSize kMaxSizeToUseSmallBufferPool = 256;
 
     // The system time when last pruneEmptyBuffer gets called.
@@ -115,6 +126,10 @@ class ShareGroupVk : public ShareGroupImpl
     // Texture update manager used to flush uploaded mutable textures.
     TextureUpload mTextureUpload;
 
+    // Buffers with coalesced small updates waiting to be flushed.
+    std::vector<BufferVk *> mBuffersWithPendingSubData;
+    bool mFlushingPendingSubData = false;
+
     // If true, it is expected that a BufferBlock may still in used by textures that outlived
     // ShareGroup. The non-empty BufferBlock will be put into RendererVk's orphan list instead.
     bool mOrphanNonEmptyBufferBlock;
@@ -332,6 +332,8 @@ FramebufferVk::~FramebufferVk() = default;
 void FramebufferVk::destroy(const gl::Context *context)
 {
     ContextVk *contextVk = vk::GetImpl(context);
+    // Batched scissored clears may target attachments that outlive this framebuffer object.
+    contextVk->flushBatchedScissoredClears();
     releaseCurrentFramebuffer(contextVk);
 }
 
@@ -526,6 +528,35 @@ angle::Result FramebufferVk::clearImpl(const gl::Context *context,
     const bool preferDrawOverClearAttachments =
         contextVk->getRenderer()->getFeatures().preferDrawClearOverVkCmdClearAttachments.enabled;
 
+    // Scissored clears that need no color or stencil masking can be recorded with
+    // vkCmdClearAttachments instead of the draw path.  They are accumulated and recorded as a
+    // single command covering every rect; UI-style content commonly issues hundreds of small
+    // scissored clears per frame, and this avoids a pipeline bind and draw for each.
+    if (contextVk->getFeatures().batchScissoredClearAttachments.enabled && scissoredClear &&
+        !maskedClearColor && !maskedClearStencil &&
+        (isMidRenderPassClear || !contextVk->hasStartedRenderPass()))
+    {
+        ASSERT(!preferDrawOverClearAttachments);
+
+        if (!isMidRenderPassClear)
+        {
+            // No render pass is open; start one now so the clear can still be recorded with
+            // vkCmdClearAttachments.  Any deferred clears are folded into the render pass loadOps
+            // in the process, and subsequent scissored clears accumulate in the same batch.  The
+            // draw path would have had to start a render pass anyway, with a pipeline bind and
+            // draw on top.
+            ANGLE_TRY(contextVk->startRenderPass(getRotatedCompleteRenderArea(contextVk), nullptr,
+                                                 nullptr));
+        }
+
+        batchScissoredClear(contextVk, scissoredRenderArea, clearColorBuffers, clearDepth,
+                            clearStencil, clearColorValue, clearDepthStencilValue);
+        return angle::Result::Continue;
+    }
+
+    // Any previously batched scissored clears must be recorded before this clear is.
+    contextVk->flushBatchedScissoredClears();
+
     // Merge current clears with the deferred clears, then proceed with only processing deferred
     // clears.  This simplifies the clear paths such that they don't need to consider both the
     // current and deferred clears.  Additionally, it avoids needing to undo an unresolve
@@ -953,6 +984,7 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
     // We can sometimes end up in a blit with some clear commands saved. Ensure all clear commands
     // are issued before we issue the blit command.
     ANGLE_TRY(flushDeferredClears(contextVk));
+    contextVk->flushBatchedScissoredClears();
 
     const bool blitColorBuffer   = (mask & GL_COLOR_BUFFER_BIT) != 0;
     const bool blitDepthBuffer   = (mask & GL_DEPTH_BUFFER_BIT) != 0;
@@ -1266,6 +1298,7 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
             }
             else
             {
+                ++contextVk->getPerfCounters().blitResolveOutsideSubpass;
                 ANGLE_TRY(resolveColorWithCommand(contextVk, params,
                                                   &readRenderTarget->getImageForCopy()));
             }
@@ -1273,6 +1306,11 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
         // Otherwise use a shader to do blit or resolve.
         else
         {
+            if (isColorResolve)
+            {
+                ++contextVk->getPerfCounters().blitResolveOutsideSubpass;
+            }
+
             // Flush the render pass, which may incur a vkQueueSubmit, before taking any views.
             // Otherwise the view serials would not reflect the render pass they are really used in.
             // http://crbug.com/1272266#c22
@@ -1307,17 +1345,68 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
         // glBlitFramebuffer requires that depth/stencil blits have matching formats.
         ASSERT(AreSrcAndDstFormatsIdentical(readRenderTarget, drawRenderTarget));
 
+        // If possible, fold the resolve into the render pass that rendered to the multisampled
+        // image with a subpass resolve attachment, using VK_KHR_depth_stencil_resolve.  The
+        // restrictions mirror those of the color resolve-with-subpass path above.
+        bool canResolveWithSubpass =
+            isDepthStencilResolve && !flipX && !flipY && areChannelsBlitCompatible &&
+            rotation == SurfaceRotation::Identity &&
+            renderer->getFeatures().supportsDepthStencilResolve.enabled &&
+            mCurrentFramebufferDesc.getLayerCount() == 1;
+
+        // Additionally, a subpass resolve writes both aspects of the resolve attachment
+        // (VK_RESOLVE_MODE_SAMPLE_ZERO_BIT for each), so it can only be used when the blit writes
+        // every aspect the destination format has; otherwise the aspect that was not requested
+        // would be clobbered.
+        if (canResolveWithSubpass)
+        {
+            const angle::Format &drawFormat =
+                drawRenderTarget->getImageForRenderPass().getActualFormat();
+            canResolveWithSubpass = (drawFormat.depthBits == 0 || blitDepthBuffer) &&
+                                    (drawFormat.stencilBits == 0 || blitStencilBuffer);
+        }
+
+        if (canResolveWithSubpass)
+        {
+            // TODO(https://anglebug.com/4968): Support multiple open render passes so we can remove
+            //  this hack to 'restore' the finished render pass.
+            bool isCurrentFramebufferValid = srcFramebufferVk->mCurrentFramebuffer.valid();
+            if (isCurrentFramebufferValid)
+            {
+                contextVk->restoreFinishedRenderPass(srcFramebufferVk->getLastRenderPassSerial());
+            }
+
+            // As with color, the render pass that rendered to the multisampled image must still be
+            // open, the render area must match the resolve area and there should be no flipping or
+            // rotation.
+            canResolveWithSubpass =
+                isCurrentFramebufferValid &&
+                contextVk->hasStartedRenderPassWithSerial(
+                    srcFramebufferVk->getLastRenderPassSerial()) &&
+                blitArea == contextVk->getStartedRenderPassCommands().getRenderArea();
+        }
+
         if (canBlitWithCommand && areChannelsBlitCompatible)
         {
             ANGLE_TRY(blitWithCommand(contextVk, sourceArea, destArea, readRenderTarget,
                                       drawRenderTarget, filter, false, blitDepthBuffer,
                                       blitStencilBuffer, flipX, flipY));
         }
+        else if (canResolveWithSubpass)
+        {
+            AdjustBlitResolveParametersForResolve(sourceArea, destArea, &params);
+            AdjustBlitResolveParametersForPreRotation(rotation, srcFramebufferRotation, &params);
+
+            ANGLE_TRY(resolveDepthStencilWithSubpass(contextVk, params));
+        }
         else
         {
             // Now that all flipping is done, adjust the offsets for resolve and prerotation
             if (isDepthStencilResolve)
             {
+                // The resolve falls back to a draw-based path that re-reads the whole multisampled
+                // image from memory; count it so out-of-pass resolves can be tracked.
+                ++contextVk->getPerfCounters().blitResolveOutsideSubpass;
                 AdjustBlitResolveParametersForResolve(sourceArea, destArea, &params);
             }
             AdjustBlitResolveParametersForPreRotation(rotation, srcFramebufferRotation, &params);
@@ -1402,6 +1491,20 @@ void FramebufferVk::removeColorResolveAttachment(uint32_t colorIndexGL)
     mRenderPassDesc.removeColorResolveAttachment(colorIndexGL);
 }
 
+void FramebufferVk::updateDepthStencilResolveAttachment(
+    vk::ImageOrBufferViewSubresourceSerial resolveImageViewSerial)
+{
+    mCurrentFramebufferDesc.updateDepthStencilResolve(resolveImageViewSerial);
+    mRenderPassDesc.packDepthStencilResolveAttachment();
+}
+
+void FramebufferVk::removeDepthStencilResolveAttachment()
+{
+    mCurrentFramebufferDesc.updateDepthStencilResolve(
+        vk::kInvalidImageOrBufferViewSubresourceSerial);
+    mRenderPassDesc.removeDepthStencilResolveAttachment();
+}
+
 void FramebufferVk::releaseCurrentFramebuffer(ContextVk *contextVk)
 {
     if (mIsCurrentFramebufferCached)
@@ -1506,6 +1609,55 @@ angle::Result FramebufferVk::resolveColorWithSubpass(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
+angle::Result FramebufferVk::resolveDepthStencilWithSubpass(
+    ContextVk *contextVk,
+    const UtilsVk::BlitResolveParameters &params)
+{
+    const gl::State &glState              = contextVk->getState();
+    const gl::Framebuffer *srcFramebuffer = glState.getReadFramebuffer();
+    FramebufferVk *srcFramebufferVk       = vk::GetImpl(srcFramebuffer);
+
+    // Use the draw FBO's depth/stencil attachment as the resolve attachment in the read FBO,
+    // mirroring resolveColorWithSubpass:
+    // - Assign the draw FBO's depth/stencil attachment Serial to the read FBO's resolve attachment
+    // - Deactivate the source Framebuffer, since the description changed
+    // - Update the renderpass description to indicate there's a resolve attachment
+    vk::ImageOrBufferViewSubresourceSerial resolveImageViewSerial =
+        mCurrentFramebufferDesc.getDepthStencilImageViewSerial();
+    ASSERT(resolveImageViewSerial.viewSerial.valid());
+    srcFramebufferVk->updateDepthStencilResolveAttachment(resolveImageViewSerial);
+    srcFramebufferVk->releaseCurrentFramebuffer(contextVk);
+
+    // Since the source FBO was updated with a resolve attachment it didn't have when the render
+    // pass was started, we need to:
+    // 1. Get the new framebuffer
+    //   - The draw framebuffer's ImageView will be used as the resolve attachment, so pass it along
+    //   in case vkCreateFramebuffer() needs to be called to create a new vkFramebuffer with the new
+    //   resolve attachment.
+    RenderTargetVk *drawRenderTarget      = mRenderTargetCache.getDepthStencil();
+    const vk::ImageView *resolveImageView = nullptr;
+    ANGLE_TRY(drawRenderTarget->getImageView(contextVk, &resolveImageView));
+    vk::MaybeImagelessFramebuffer newSrcFramebuffer = {};
+    ANGLE_TRY(srcFramebufferVk->getFramebuffer(contextVk, &newSrcFramebuffer, drawRenderTarget,
+                                               resolveImageView, SwapchainResolveMode::Disabled));
+    // 2. Update the RenderPassCommandBufferHelper with the new framebuffer and render pass
+    vk::RenderPassCommandBufferHelper &commandBufferHelper =
+        contextVk->getStartedRenderPassCommands();
+    commandBufferHelper.updateRenderPassForResolve(contextVk, newSrcFramebuffer,
+                                                   srcFramebufferVk->getRenderPassDesc());
+
+    // End the render pass now since we don't (yet) support subpass dependencies.
+    drawRenderTarget->onDepthStencilResolve(contextVk, mCurrentFramebufferDesc.getLayerCount());
+    ANGLE_TRY(contextVk->flushCommandsAndEndRenderPass(
+        RenderPassClosureReason::AlreadySpecifiedElsewhere));
+
+    // Remove the resolve attachment from the source framebuffer.
+    srcFramebufferVk->removeDepthStencilResolveAttachment();
+    srcFramebufferVk->releaseCurrentFramebuffer(contextVk);
+
+    return angle::Result::Continue;
+}
+
 angle::Result FramebufferVk::resolveColorWithCommand(ContextVk *contextVk,
                                                      const UtilsVk::BlitResolveParameters &params,
                                                      vk::ImageHelper *srcImage)
@@ -2182,8 +2334,14 @@ angle::Result FramebufferVk::getAttachmentsAndRenderTargets(
             RenderTargetInfo(depthStencilRenderTarget, RenderTargetImage::AttachmentImage));
     }
 
+    // The passed in ImageView is used as either a color or a depth/stencil resolve attachment,
+    // based on the format of the render target it comes from.
+    const bool hasExternalDepthStencilResolveAttachment =
+        resolveImageViewIn != nullptr && resolveRenderTargetIn != nullptr &&
+        resolveRenderTargetIn->getImageForRenderPass().getActualFormat().hasDepthOrStencilBits();
+
     // Color resolve attachments.
-    if (resolveImageViewIn)
+    if (resolveImageViewIn && !hasExternalDepthStencilResolveAttachment)
     {
         ASSERT(!HasResolveAttachment(colorRenderTargets, mState.getEnabledDrawBuffers()));
         ASSERT(resolveRenderTargetIn);
@@ -2217,7 +2375,19 @@ angle::Result FramebufferVk::getAttachmentsAndRenderTargets(
     }
 
     // Depth/stencil resolve attachment.
-    if (depthStencilRenderTarget && depthStencilRenderTarget->hasResolveAttachment())
+    if (hasExternalDepthStencilResolveAttachment)
+    {
+        ASSERT(depthStencilRenderTarget);
+
+        // Need to use the passed in ImageView for the resolve attachment, since it came from
+        // another Framebuffer.
+        attachments->push_back(resolveImageViewIn->getHandle());
+        renderTargetsInfoOut->emplace_back(
+            RenderTargetInfo(resolveRenderTargetIn, (resolveRenderTargetIn->hasResolveAttachment())
+                                                        ? RenderTargetImage::ResolveImage
+                                                        : RenderTargetImage::AttachmentImage));
+    }
+    else if (depthStencilRenderTarget && depthStencilRenderTarget->hasResolveAttachment())
     {
         const vk::ImageView *imageView = nullptr;
         ANGLE_TRY(depthStencilRenderTarget->getResolveImageView(contextVk, &imageView));
@@ -2342,8 +2512,10 @@ angle::Result FramebufferVk::getFramebuffer(ContextVk *contextVk,
     else
     {
         // For imageless framebuffers, attachment image and create info objects should be defined
-        // when creating the new framebuffer.
-        std::vector<VkFramebufferAttachmentImageInfoKHR> fbAttachmentImageInfoArray;
+        // when creating the new framebuffer.  The array is only needed until vkCreateFramebuffer
+        // returns, so it lives in the frame arena.
+        angle::PoolVector<VkFramebufferAttachmentImageInfoKHR> fbAttachmentImageInfoArray(
+            contextVk->getState().getFrameArena());
 
         for (auto const &info : renderTargetsInfo)
         {
@@ -2679,6 +2851,137 @@ void FramebufferVk::clearWithCommand(ContextVk *contextVk, const gl::Rectangle &
     return;
 }
 
+void FramebufferVk::batchScissoredClear(ContextVk *contextVk,
+                                        const gl::Rectangle &scissoredRenderArea,
+                                        gl::DrawBufferMask clearColorBuffers,
+                                        bool clearDepth,
+                                        bool clearStencil,
+                                        const VkClearColorValue &clearColorValue,
+                                        const VkClearDepthStencilValue &clearDepthStencilValue)
+{
+    // Rects are only merged while the clear state stays identical; a clear with different state
+    // (or one batched for another framebuffer) flushes what was accumulated so far.  Note that
+    // only one framebuffer can have a non-empty batch at any time; starting a batch flushes the
+    // previous one through ContextVk.
+    const bool mergeable = !mBatchedScissoredClears.rects.empty() &&
+                           mBatchedScissoredClears.colorBuffers == clearColorBuffers &&
+                           mBatchedScissoredClears.clearDepth == clearDepth &&
+                           mBatchedScissoredClears.clearStencil == clearStencil &&
+                           memcmp(&mBatchedScissoredClears.colorValue, &clearColorValue,
+                                  sizeof(clearColorValue)) == 0 &&
+                           memcmp(&mBatchedScissoredClears.depthStencilValue,
+                                  &clearDepthStencilValue, sizeof(clearDepthStencilValue)) == 0;
+    if (!mergeable)
+    {
+        contextVk->flushBatchedScissoredClears();
+
+        mBatchedScissoredClears.colorBuffers      = clearColorBuffers;
+        mBatchedScissoredClears.clearDepth        = clearDepth;
+        mBatchedScissoredClears.clearStencil      = clearStencil;
+        mBatchedScissoredClears.colorValue        = clearColorValue;
+        mBatchedScissoredClears.depthStencilValue = clearDepthStencilValue;
+
+        // Capture the attachment list and access indices now; the framebuffer state may change
+        // before the batch is flushed, but the render pass it is recorded against won't.
+        vk::PackedAttachmentIndex colorIndexVk(0);
+        for (size_t colorIndexGL : mState.getColorAttachmentsMask())
+        {
+            if (clearColorBuffers.test(colorIndexGL))
+            {
+                mBatchedScissoredClears.attachments.emplace_back(VkClearAttachment{
+                    VK_IMAGE_ASPECT_COLOR_BIT, static_cast<uint32_t>(colorIndexGL),
+                    getCorrectedColorClearValue(colorIndexGL, clearColorValue)});
+                mBatchedScissoredClears.colorAccessIndices.push_back(colorIndexVk);
+            }
+            ++colorIndexVk;
+        }
+
+        VkImageAspectFlags dsAspectFlags = 0;
+        VkClearValue dsClearValue        = {};
+        dsClearValue.depthStencil        = clearDepthStencilValue;
+        if (clearDepth)
+        {
+            dsAspectFlags |= VK_IMAGE_ASPECT_DEPTH_BIT;
+        }
+        if (clearStencil)
+        {
+            dsAspectFlags |= VK_IMAGE_ASPECT_STENCIL_BIT;
+        }
+        if (dsAspectFlags != 0)
+        {
+            mBatchedScissoredClears.attachments.emplace_back(
+                VkClearAttachment{dsAspectFlags, 0, dsClearValue});
+        }
+    }
+
+    // Grow the render area now so the rect is guaranteed to be inside it when flushed.
+    vk::RenderPassCommandBufferHelper *renderPassCommands =
+        &contextVk->getStartedRenderPassCommands();
+    renderPassCommands->growRenderArea(contextVk, scissoredRenderArea);
+
+    VkClearRect rect = {};
+    rect.rect        = gl_vk::GetRect(scissoredRenderArea);
+    rect.layerCount  = mState.isMultiview() ? 1 : mCurrentFramebufferDesc.getLayerCount();
+    mBatchedScissoredClears.rects.push_back(rect);
+
+    contextVk->onBatchedScissoredClear(this);
+}
+
+void FramebufferVk::flushBatchedScissoredClears(ContextVk *contextVk)
+{
+    if (mBatchedScissoredClears.rects.empty())
+    {
+        return;
+    }
+
+    // The batch is accumulated strictly while the render pass it was recorded against is open.
+    ASSERT(contextVk->hasStartedRenderPassWithSerial(mLastRenderPassSerial));
+
+    vk::RenderPassCommandBufferHelper *renderPassCommands =
+        &contextVk->getStartedRenderPassCommands();
+
+    for (vk::PackedAttachmentIndex colorIndexVk : mBatchedScissoredClears.colorAccessIndices)
+    {
+        renderPassCommands->onColorAccess(colorIndexVk, vk::ResourceAccess::Write);
+        ++contextVk->getPerfCounters().colorClearAttachments;
+    }
+
+    if (mBatchedScissoredClears.clearDepth)
+    {
+        renderPassCommands->onDepthAccess(vk::ResourceAccess::Write);
+        ++contextVk->getPerfCounters().depthClearAttachments;
+    }
+
+    if (mBatchedScissoredClears.clearStencil)
+    {
+        renderPassCommands->onStencilAccess(vk::ResourceAccess::Write);
+        ++contextVk->getPerfCounters().stencilClearAttachments;
+    }
+
+    if (mBatchedScissoredClears.clearDepth || mBatchedScissoredClears.clearStencil)
+    {
+        // Because we may have changed the depth stencil access mode, update read only depth mode
+        // now.
+        updateRenderPassReadOnlyDepthMode(contextVk, renderPassCommands);
+    }
+
+    ASSERT(!mBatchedScissoredClears.attachments.empty());
+
+    vk::RenderPassCommandBuffer *renderPassCommandBuffer = &renderPassCommands->getCommandBuffer();
+    renderPassCommandBuffer->clearAttachments(
+        static_cast<uint32_t>(mBatchedScissoredClears.attachments.size()),
+        mBatchedScissoredClears.attachments.data(),
+        static_cast<uint32_t>(mBatchedScissoredClears.rects.size()),
+        mBatchedScissoredClears.rects.data());
+
+    mBatchedScissoredClears.colorBuffers.reset();
+    mBatchedScissoredClears.clearDepth   = false;
+    mBatchedScissoredClears.clearStencil = false;
+    mBatchedScissoredClears.attachments.clear();
+    mBatchedScissoredClears.colorAccessIndices.clear();
+    mBatchedScissoredClears.rects.clear();
+}
+
 void FramebufferVk::clearWithLoadOp(ContextVk *contextVk)
 {
     vk::RenderPassCommandBufferHelper *renderPassCommands =
@@ -2984,6 +3287,7 @@ angle::Result FramebufferVk::startNewRenderPass(ContextVk *contextVk,
     ANGLE_TRY(contextVk->beginNewRenderPass(
         framebuffer, renderArea, mRenderPassDesc, renderPassAttachmentOps, colorIndexVk,
         depthStencilAttachmentIndex, packedClearValues, commandBufferOut, &mLastRenderPassSerial));
+    contextVk->onFramebufferRenderPassStarted(mState.getFramebufferSerial());
 
     // Add the images to the renderpass tracking list (through onColorDraw).
     vk::PackedAttachmentIndex colorAttachmentIndex(0);
@@ -3061,6 +3365,11 @@ gl::Extents FramebufferVk::getReadImageExtents() const
 
 // Return the framebuffer's non-rotated render area.  This is a gl::Rectangle that is based on the
 // dimensions of the framebuffer, IS NOT rotated, and IS NOT y-flipped
+bool FramebufferVk::getDamageRegionBounds(gl::Rectangle *boundsOut) const
+{
+    return mBackbuffer != nullptr && mBackbuffer->getDamageRegionBounds(boundsOut);
+}
+
 gl::Rectangle FramebufferVk::getNonRotatedCompleteRenderArea() const
 {
     const gl::Box &dimensions = mState.getDimensions();
@@ -3094,6 +3403,21 @@ gl::Rectangle FramebufferVk::getRotatedScissoredRenderArea(ContextVk *contextVk)
     const gl::Rectangle renderArea = getNonRotatedCompleteRenderArea();
     bool invertViewport            = contextVk->isViewportFlipEnabledForDrawFBO();
     gl::Rectangle scissoredArea    = ClipRectToScissor(contextVk->getState(), renderArea, false);
+
+    // EGL_KHR_partial_update: rendering outside the frame's declared damage region is undefined,
+    // so the render area can additionally be clipped to the region's bounding box.  This keeps
+    // render passes of partial-update frames from touching undamaged tiles.
+    gl::Rectangle damageBounds;
+    if (getDamageRegionBounds(&damageBounds))
+    {
+        gl::Rectangle damageClippedArea;
+        if (!gl::ClipRectangle(scissoredArea, damageBounds, &damageClippedArea))
+        {
+            damageClippedArea = gl::Rectangle();
+        }
+        scissoredArea = damageClippedArea;
+    }
+
     gl::Rectangle rotatedScissoredArea;
     RotateRectangle(contextVk->getRotationDrawFramebuffer(), invertViewport, renderArea.width,
                     renderArea.height, scissoredArea, &rotatedScissoredArea);
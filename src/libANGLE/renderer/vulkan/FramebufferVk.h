@@ -120,6 +120,8 @@ class FramebufferVk : public FramebufferImpl
     void updateColorResolveAttachment(
         uint32_t colorIndexGL,
         vk::ImageOrBufferViewSubresourceSerial resolveImageViewSerial);
+    void updateDepthStencilResolveAttachment(
+        vk::ImageOrBufferViewSubresourceSerial resolveImageViewSerial);
 
     angle::Result getFramebuffer(ContextVk *contextVk,
                                  vk::MaybeImagelessFramebuffer *framebufferOut,
@@ -129,6 +131,10 @@ class FramebufferVk : public FramebufferImpl
 
     bool hasDeferredClears() const { return !mDeferredClears.empty(); }
     angle::Result flushDeferredClears(ContextVk *contextVk);
+    // Records any accumulated scissored clears as a single vkCmdClearAttachments call in the
+    // render pass they were batched against.  Called through ContextVk before the next draw is
+    // recorded or the render pass is closed.
+    void flushBatchedScissoredClears(ContextVk *contextVk);
     void setReadOnlyDepthFeedbackLoopMode(bool readOnlyDepthFeedbackModeEnabled)
     {
         mReadOnlyDepthFeedbackLoopMode = readOnlyDepthFeedbackModeEnabled;
@@ -140,10 +146,15 @@ class FramebufferVk : public FramebufferImpl
     void switchToFramebufferFetchMode(ContextVk *contextVk, bool hasFramebufferFetch);
 
     void removeColorResolveAttachment(uint32_t colorIndexGL);
+    void removeDepthStencilResolveAttachment();
 
     void setBackbuffer(WindowSurfaceVk *backbuffer) { mBackbuffer = backbuffer; }
     WindowSurfaceVk *getBackbuffer() const { return mBackbuffer; }
 
+    // EGL_KHR_partial_update: returns the bounding box of the damage region declared for the
+    // current frame, if this framebuffer is backed by a window surface with a region set.
+    bool getDamageRegionBounds(gl::Rectangle *boundsOut) const;
+
     void releaseCurrentFramebuffer(ContextVk *contextVk);
 
     vk::RenderPassSerial getLastRenderPassSerial() const { return mLastRenderPassSerial; }
@@ -191,6 +202,10 @@ class FramebufferVk : public FramebufferImpl
     angle::Result resolveColorWithSubpass(ContextVk *contextVk,
                                           const UtilsVk::BlitResolveParameters &params);
 
+    // Resolve depth/stencil with subpass attachment (VK_KHR_depth_stencil_resolve)
+    angle::Result resolveDepthStencilWithSubpass(ContextVk *contextVk,
+                                                 const UtilsVk::BlitResolveParameters &params);
+
     // Resolve color with vkCmdResolveImage
     angle::Result resolveColorWithCommand(ContextVk *contextVk,
                                           const UtilsVk::BlitResolveParameters &params,
@@ -217,6 +232,13 @@ class FramebufferVk : public FramebufferImpl
                                 uint8_t stencilMask,
                                 const VkClearColorValue &clearColorValue,
                                 const VkClearDepthStencilValue &clearDepthStencilValue);
+    void batchScissoredClear(ContextVk *contextVk,
+                             const gl::Rectangle &scissoredRenderArea,
+                             gl::DrawBufferMask clearColorBuffers,
+                             bool clearDepth,
+                             bool clearStencil,
+                             const VkClearColorValue &clearColorValue,
+                             const VkClearDepthStencilValue &clearDepthStencilValue);
     void redeferClears(ContextVk *contextVk);
     void redeferClearsForReadFramebuffer(ContextVk *contextVk);
     void redeferClearsImpl(ContextVk *contextVk);
@@ -274,6 +296,27 @@ class FramebufferVk : public FramebufferImpl
 
     vk::ClearValuesArray mDeferredClears;
 
+    // Mid-render-pass scissored clears that share clear state are accumulated here and recorded as
+    // a single vkCmdClearAttachments call covering every rect, instead of one draw-based clear
+    // each.  The attachment list and access indices are captured when the batch is started, so the
+    // flush doesn't depend on framebuffer state that may have changed since.  See the
+    // batchScissoredClearAttachments feature.
+    struct BatchedScissoredClears
+    {
+        // State the batch was started with; used to decide whether a new clear can be merged.
+        gl::DrawBufferMask colorBuffers;
+        bool clearDepth   = false;
+        bool clearStencil = false;
+        VkClearColorValue colorValue               = {};
+        VkClearDepthStencilValue depthStencilValue = {};
+
+        // What gets recorded at flush time.
+        gl::AttachmentVector<VkClearAttachment> attachments;
+        gl::AttachmentVector<vk::PackedAttachmentIndex> colorAccessIndices;
+        std::vector<VkClearRect> rects;
+    };
+    BatchedScissoredClears mBatchedScissoredClears;
+
     // Tracks if we are in depth feedback loop. Depth read only feedback loop is a special kind of
     // depth stencil read only mode. When we are in feedback loop, we must flush renderpass to exit
     // the loop instead of update the layout.
@@ -8,14 +8,19 @@
 
 #include "libANGLE/renderer/vulkan/ProgramExecutableVk.h"
 
+#include "common/WorkerThread.h"
+#include "common/hash_utils.h"
 #include "common/string_utils.h"
+#include "libANGLE/Display.h"
 #include "libANGLE/renderer/glslang_wrapper_utils.h"
+#include "libANGLE/trace.h"
 #include "libANGLE/renderer/vulkan/BufferVk.h"
 #include "libANGLE/renderer/vulkan/DisplayVk.h"
 #include "libANGLE/renderer/vulkan/FramebufferVk.h"
 #include "libANGLE/renderer/vulkan/GlslangWrapperVk.h"
 #include "libANGLE/renderer/vulkan/ProgramPipelineVk.h"
 #include "libANGLE/renderer/vulkan/ProgramVk.h"
+#include "libANGLE/renderer/vulkan/SamplerVk.h"
 #include "libANGLE/renderer/vulkan/TextureVk.h"
 #include "libANGLE/renderer/vulkan/TransformFeedbackVk.h"
 #include "libANGLE/renderer/vulkan/vk_helpers.h"
@@ -219,7 +224,10 @@ void GetPipelineCacheData(ContextVk *contextVk,
 }
 }  // namespace
 
-DefaultUniformBlock::DefaultUniformBlock() = default;
+DefaultUniformBlock::DefaultUniformBlock()
+{
+    dirtyRange.invalidate();
+}
 
 DefaultUniformBlock::~DefaultUniformBlock() = default;
 
@@ -329,6 +337,8 @@ angle::Result ProgramInfo::initProgram(ContextVk *contextVk,
     options.negativeViewportSupported   = contextVk->getFeatures().supportsNegativeViewport.enabled;
     options.isMultisampledFramebufferFetch =
         optionBits.multiSampleFramebufferFetch && shaderType == gl::ShaderType::Fragment;
+    options.addEarlyFragmentTestsOptimization =
+        optionBits.addEarlyFragmentTestsOptimization && shaderType == gl::ShaderType::Fragment;
 
     // Don't validate SPIR-V generated for GLES1 shaders when validation layers are enabled.  The
     // layers already validate SPIR-V, and since GLES1 shaders are controlled by ANGLE, they don't
@@ -360,9 +370,11 @@ void ProgramInfo::release(ContextVk *contextVk)
 
 ProgramExecutableVk::ProgramExecutableVk()
     : mNumDefaultUniformDescriptors(0),
+      mCurrentDefaultUniformBufferGeneration(0),
       mImmutableSamplersMaxDescriptorCount(1),
       mUniformBufferDescriptorType(VK_DESCRIPTOR_TYPE_MAX_ENUM),
-      mDynamicUniformDescriptorOffsets{}
+      mDynamicUniformDescriptorOffsets{},
+      mWarmUpIdentityHash(0)
 {
     for (std::shared_ptr<DefaultUniformBlock> &defaultBlock : mDefaultUniformBlocks)
     {
@@ -383,6 +395,8 @@ void ProgramExecutableVk::resetLayout(ContextVk *contextVk)
     }
     mImmutableSamplersMaxDescriptorCount = 1;
     mImmutableSamplerIndexMap.clear();
+    mPromotedSamplerSerials.clear();
+    mPromotedSamplerUnits.reset();
     mPipelineLayout.reset();
 
     mDescriptorSets.fill(VK_NULL_HANDLE);
@@ -399,7 +413,10 @@ void ProgramExecutableVk::resetLayout(ContextVk *contextVk)
     }
 
     // Initialize with an invalid BufferSerial
-    mCurrentDefaultUniformBufferSerial = vk::BufferSerial();
+    mCurrentDefaultUniformBufferSerial     = vk::BufferSerial();
+    mCurrentDefaultUniformBufferGeneration = 0;
+
+    mCurrentTexturesDesc.reset();
 
     for (ProgramInfo &programInfo : mGraphicsProgramInfos)
     {
@@ -411,6 +428,10 @@ void ProgramExecutableVk::resetLayout(ContextVk *contextVk)
     {
         pipelines.release(contextVk);
     }
+    for (ShadersGraphicsPipelineCache &pipelines : mShadersGraphicsPipelines)
+    {
+        pipelines.release(contextVk);
+    }
     for (vk::PipelineHelper &pipeline : mComputePipelines)
     {
         pipeline.release(contextVk);
@@ -423,6 +444,10 @@ void ProgramExecutableVk::reset(ContextVk *contextVk)
 {
     resetLayout(contextVk);
 
+    mPendingSamplerPromotions.clear();
+
+    mWarmUpIdentityHash = 0;
+
     if (mPipelineCache.valid())
     {
         mPipelineCache.destroy(contextVk->getDevice());
@@ -430,7 +455,7 @@ void ProgramExecutableVk::reset(ContextVk *contextVk)
 }
 
 angle::Result ProgramExecutableVk::initializePipelineCache(
-    ContextVk *contextVk,
+    vk::Context *context,
     const std::vector<uint8_t> &compressedPipelineData)
 {
     ASSERT(!mPipelineCache.valid());
@@ -447,37 +472,40 @@ angle::Result ProgramExecutableVk::initializePipelineCache(
     pipelineCacheCreateInfo.initialDataSize = uncompressedData.size();
     pipelineCacheCreateInfo.pInitialData    = uncompressedData.data();
 
-    if (contextVk->getFeatures().supportsPipelineCreationCacheControl.enabled)
+    if (context->getFeatures().supportsPipelineCreationCacheControl.enabled)
     {
         pipelineCacheCreateInfo.flags |= VK_PIPELINE_CACHE_CREATE_EXTERNALLY_SYNCHRONIZED_BIT_EXT;
     }
 
-    ANGLE_VK_TRY(contextVk, mPipelineCache.init(contextVk->getDevice(), pipelineCacheCreateInfo));
+    ANGLE_VK_TRY(context, mPipelineCache.init(context->getDevice(), pipelineCacheCreateInfo));
 
     // Merge the pipeline cache into RendererVk's.
     // TODO(http://anglebug.com/7369): When VK_EXT_graphics_pipeline_library is supported, do not
     // merge into RendererVk's cache.  |mPipelineCache| will continue to be used in that case.
-    return contextVk->getRenderer()->mergeIntoPipelineCache(mPipelineCache);
+    return context->getRenderer()->mergeIntoPipelineCache(mPipelineCache);
 }
 
-std::unique_ptr<rx::LinkEvent> ProgramExecutableVk::load(ContextVk *contextVk,
-                                                         const gl::ProgramExecutable &glExecutable,
-                                                         bool isSeparable,
-                                                         gl::BinaryInputStream *stream)
+// The worker-thread part of binary loading: everything here only parses the stream and talks to
+// the device and renderer, not the context, so it's safe off the context thread.
+angle::Result ProgramExecutableVk::loadBinaryImpl(vk::Context *context,
+                                                  bool isSeparable,
+                                                  gl::BinaryInputStream *stream,
+                                                  gl::ShaderMap<size_t> *requiredBufferSizesOut)
 {
     gl::ShaderMap<ShaderInterfaceVariableInfoMap::VariableTypeToInfoMap> data;
-    gl::ShaderMap<ShaderInterfaceVariableInfoMap::NameToTypeAndIndexMap> nameToTypeAndIndexMap;
+    gl::ShaderMap<NameToTypeAndIndexMap> nameToTypeAndIndexMap;
     gl::ShaderMap<ShaderInterfaceVariableInfoMap::VariableTypeToIndexMap> indexedResourceMap;
 
     for (gl::ShaderType shaderType : gl::AllShaderTypes())
     {
+        // The entries were saved in sorted order, so each insert appends to the packed array.
         size_t nameCount = stream->readInt<size_t>();
         for (size_t nameIndex = 0; nameIndex < nameCount; ++nameIndex)
         {
             const std::string variableName  = stream->readString();
             ShaderVariableType variableType = stream->readEnum<ShaderVariableType>();
             uint32_t index                  = stream->readInt<uint32_t>();
-            nameToTypeAndIndexMap[shaderType][variableName] = {variableType, index};
+            nameToTypeAndIndexMap[shaderType].insert(variableName, {variableType, index});
         }
 
         for (ShaderVariableType variableType : angle::AllEnums<ShaderVariableType>())
@@ -534,12 +562,11 @@ std::unique_ptr<rx::LinkEvent> ProgramExecutableVk::load(ContextVk *contextVk,
         }
     }
 
-    gl::ShaderMap<size_t> requiredBufferSize;
-    requiredBufferSize.fill(0);
+    requiredBufferSizesOut->fill(0);
     // Deserializes required uniform block memory sizes
     for (gl::ShaderType shaderType : gl::AllShaderTypes())
     {
-        requiredBufferSize[shaderType] = stream->readInt<size_t>();
+        (*requiredBufferSizesOut)[shaderType] = stream->readInt<size_t>();
     }
 
     if (!isSeparable)
@@ -553,23 +580,137 @@ std::unique_ptr<rx::LinkEvent> ProgramExecutableVk::load(ContextVk *contextVk,
             stream->readBytes(compressedPipelineData.data(), compressedPipelineDataSize);
 
             // Initialize the pipeline cache based on cached data.
-            angle::Result status = initializePipelineCache(contextVk, compressedPipelineData);
-            if (status != angle::Result::Continue)
-            {
-                return std::make_unique<LinkEventDone>(status);
-            }
+            ANGLE_TRY(initializePipelineCache(context, compressedPipelineData));
         }
     }
 
-    // Initialize and resize the mDefaultUniformBlocks' memory
-    angle::Result status = resizeUniformBlockMemory(contextVk, glExecutable, requiredBufferSize);
-    if (status != angle::Result::Continue)
+    return angle::Result::Continue;
+}
+
+// Parses a cached program binary and initializes the per-program pipeline cache on a worker
+// thread.  Vulkan errors are captured and surfaced on the context that resolves the link.
+class ProgramExecutableVk::LoadBinaryTask : public vk::Context, public angle::Closure
+{
+  public:
+    LoadBinaryTask(RendererVk *renderer,
+                   ProgramExecutableVk *executableVk,
+                   bool isSeparable,
+                   gl::BinaryInputStream *stream)
+        : vk::Context(renderer), mExecutableVk(executableVk), mIsSeparable(isSeparable)
+    {
+        // Copy the remaining stream data so the caller's stream can go away while the task is in
+        // flight.
+        size_t dataSize    = stream->remainingSize();
+        mDataCopySucceeded = mStreamData.resize(dataSize);
+        if (mDataCopySucceeded)
+        {
+            memcpy(mStreamData.data(), stream->data() + stream->offset(), dataSize);
+        }
+    }
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "ProgramExecutableVk::LoadBinaryTask");
+        if (!mDataCopySucceeded)
+        {
+            mResult = angle::Result::Stop;
+            return;
+        }
+
+        gl::BinaryInputStream stream(mStreamData.data(), mStreamData.size());
+        mResult =
+            mExecutableVk->loadBinaryImpl(this, mIsSeparable, &stream, &mRequiredBufferSizes);
+    }
+
+    void handleError(VkResult result,
+                     const char *file,
+                     const char *function,
+                     unsigned int line) override
     {
-        return std::make_unique<LinkEventDone>(status);
+        mErrorCode     = result;
+        mErrorFile     = file;
+        mErrorFunction = function;
+        mErrorLine     = line;
     }
 
-    status = createPipelineLayout(contextVk, glExecutable, nullptr);
-    return std::make_unique<LinkEventDone>(status);
+    // Propagates the result, including any captured Vulkan error, to |contextVk|.
+    angle::Result getResult(ContextVk *contextVk)
+    {
+        if (mErrorCode != VK_SUCCESS)
+        {
+            contextVk->handleError(mErrorCode, mErrorFile, mErrorFunction, mErrorLine);
+            return angle::Result::Stop;
+        }
+        return mResult;
+    }
+
+    const gl::ShaderMap<size_t> &getRequiredBufferSizes() const { return mRequiredBufferSizes; }
+
+  private:
+    ProgramExecutableVk *mExecutableVk;
+    bool mIsSeparable;
+    bool mDataCopySucceeded;
+    angle::MemoryBuffer mStreamData;
+    gl::ShaderMap<size_t> mRequiredBufferSizes;
+
+    angle::Result mResult = angle::Result::Stop;
+
+    VkResult mErrorCode        = VK_SUCCESS;
+    const char *mErrorFile     = nullptr;
+    const char *mErrorFunction = nullptr;
+    unsigned int mErrorLine    = 0;
+};
+
+class ProgramExecutableVk::LoadBinaryLinkEvent final : public rx::LinkEvent
+{
+  public:
+    LoadBinaryLinkEvent(std::shared_ptr<LoadBinaryTask> task,
+                        std::shared_ptr<angle::WaitableEvent> waitableEvent,
+                        ProgramExecutableVk *executableVk,
+                        const gl::ProgramExecutable &glExecutable)
+        : mTask(std::move(task)),
+          mWaitableEvent(std::move(waitableEvent)),
+          mExecutableVk(executableVk),
+          mGlExecutable(&glExecutable)
+    {}
+
+    angle::Result wait(const gl::Context *context) override
+    {
+        mWaitableEvent->wait();
+
+        ContextVk *contextVk = vk::GetImpl(context);
+        ANGLE_TRY(mTask->getResult(contextVk));
+
+        // The pieces that register with context-owned caches run on the thread that resolves the
+        // link.
+        ANGLE_TRY(mExecutableVk->resizeUniformBlockMemory(contextVk, *mGlExecutable,
+                                                          mTask->getRequiredBufferSizes()));
+        return mExecutableVk->createPipelineLayout(contextVk, *mGlExecutable, nullptr);
+    }
+
+    bool isLinking() override { return !mWaitableEvent->isReady(); }
+
+  private:
+    std::shared_ptr<LoadBinaryTask> mTask;
+    std::shared_ptr<angle::WaitableEvent> mWaitableEvent;
+    ProgramExecutableVk *mExecutableVk;
+    const gl::ProgramExecutable *mGlExecutable;
+};
+
+std::unique_ptr<rx::LinkEvent> ProgramExecutableVk::load(ContextVk *contextVk,
+                                                         const gl::ProgramExecutable &glExecutable,
+                                                         bool isSeparable,
+                                                         gl::BinaryInputStream *stream)
+{
+    // Parse the binary and build the per-program pipeline cache on a worker thread; the frontend
+    // defers waiting on the returned event until the program is first used, so loads of many
+    // cached programs overlap with whatever else the application is doing.
+    auto task = std::make_shared<LoadBinaryTask>(contextVk->getRenderer(), this, isSeparable,
+                                                 stream);
+    std::shared_ptr<angle::WaitableEvent> waitableEvent =
+        contextVk->getRenderer()->getDisplay()->getMultiThreadPool()->postWorkerTask(task);
+    return std::make_unique<LoadBinaryLinkEvent>(std::move(task), std::move(waitableEvent), this,
+                                                 glExecutable);
 }
 
 void ProgramExecutableVk::save(ContextVk *contextVk,
@@ -578,21 +719,19 @@ void ProgramExecutableVk::save(ContextVk *contextVk,
 {
     const gl::ShaderMap<ShaderInterfaceVariableInfoMap::VariableTypeToInfoMap> &data =
         mVariableInfoMap.getData();
-    const gl::ShaderMap<ShaderInterfaceVariableInfoMap::NameToTypeAndIndexMap>
-        &nameToTypeAndIndexMap = mVariableInfoMap.getNameToTypeAndIndexMap();
+    const gl::ShaderMap<NameToTypeAndIndexMap> &nameToTypeAndIndexMap =
+        mVariableInfoMap.getNameToTypeAndIndexMap();
     const gl::ShaderMap<ShaderInterfaceVariableInfoMap::VariableTypeToIndexMap>
         &indexedResourceMap = mVariableInfoMap.getIndexedResourceMap();
 
     for (gl::ShaderType shaderType : gl::AllShaderTypes())
     {
         stream->writeInt(nameToTypeAndIndexMap[shaderType].size());
-        for (const auto &iter : nameToTypeAndIndexMap[shaderType])
+        for (const NameToTypeAndIndexMap::Entry &entry : nameToTypeAndIndexMap[shaderType])
         {
-            const std::string &name          = iter.first;
-            const TypeAndIndex &typeAndIndex = iter.second;
-            stream->writeString(name);
-            stream->writeEnum(typeAndIndex.variableType);
-            stream->writeInt(typeAndIndex.index);
+            stream->writeString(entry.name);
+            stream->writeEnum(entry.typeAndIndex.variableType);
+            stream->writeInt(entry.typeAndIndex.index);
         }
 
         for (ShaderVariableType variableType : angle::AllEnums<ShaderVariableType>())
@@ -677,6 +816,25 @@ void ProgramExecutableVk::clearVariableInfoMap()
     mVariableInfoMap.clear();
 }
 
+uint64_t ProgramExecutableVk::getWarmUpIdentityHash()
+{
+    if (mWarmUpIdentityHash == 0)
+    {
+        uint64_t hash = 0;
+        for (const angle::spirv::Blob &blob : mOriginalShaderInfo.getSpirvBlobs())
+        {
+            if (!blob.empty())
+            {
+                hash = hash * 0x9E3779B97F4A7C15ull +
+                       angle::ComputeGenericHash(blob.data(), blob.size() * sizeof(uint32_t));
+            }
+        }
+        // Reserve zero as the "not yet computed" marker.
+        mWarmUpIdentityHash = hash == 0 ? 1 : hash;
+    }
+    return mWarmUpIdentityHash;
+}
+
 angle::Result ProgramExecutableVk::warmUpPipelineCache(ContextVk *contextVk,
                                                        const gl::ProgramExecutable &glExecutable)
 {
@@ -746,14 +904,18 @@ angle::Result ProgramExecutableVk::warmUpPipelineCache(ContextVk *contextVk,
 
     // Variations that definitely matter:
     //
-    // - PreRotation: It's a boolean specialization constant
-    // - Depth correction: It's a SPIR-V transformation
+    // - PreRotation: It's a boolean specialization constant, so rotated and non-rotated
+    //   pipelines share the same shader modules and differ only in the pipeline desc.
     //
     // There are a number of states that are not currently dynamic (and may never be, such as sample
     // shading), but pre-creating shaders for them is impractical.  Most such state is likely unused
     // by most applications, but variations can be added here for certain apps that are known to
     // benefit from it.
     ProgramTransformOptions transformOptions = {};
+    // Early fragment tests depend only on the linked executable (modulo alpha-to-coverage, which
+    // is rarely enabled), so warm up the variant that is most likely used at draw time.
+    transformOptions.addEarlyFragmentTestsOptimization =
+        glExecutable.hasEarlyFragmentTestsOptimization();
 
     angle::FixedVector<bool, 2> surfaceRotationVariations = {false};
     if (contextVk->getFeatures().enablePreRotateSurfaces.enabled &&
@@ -764,13 +926,36 @@ angle::Result ProgramExecutableVk::warmUpPipelineCache(ContextVk *contextVk,
 
     for (bool rotation : surfaceRotationVariations)
     {
-        transformOptions.surfaceRotation = rotation;
+        vk::GraphicsPipelineTransitionBits transition = {};
+        graphicsPipelineDesc.updateSurfaceRotation(
+            &transition, rotation ? SurfaceRotation::Rotated90Degrees : SurfaceRotation::Identity);
 
         ANGLE_TRY(createGraphicsPipelineImpl(
             contextVk, transformOptions, vk::GraphicsPipelineSubset::Complete, &pipelineCache,
             PipelineSource::WarmUp, graphicsPipelineDesc, glExecutable, &descPtr, &pipeline));
     }
 
+    // Additionally compile any states a previous run captured for this program, supplied through
+    // the warm-start preload list (see RendererVk::loadPipelineWarmUpPreload).
+    std::vector<vk::GraphicsPipelineDesc> preloadDescs;
+    contextVk->getRenderer()->getPipelineWarmUpDescs(getWarmUpIdentityHash(), &preloadDescs);
+    const uint8_t programIndex = GetGraphicsProgramIndex(transformOptions);
+    for (const vk::GraphicsPipelineDesc &preloadDesc : preloadDescs)
+    {
+        // The pipeline caches assert on duplicate entries; skip states already created above.
+        const vk::GraphicsPipelineDesc *existingDescPtr = nullptr;
+        vk::PipelineHelper *existingPipeline            = nullptr;
+        if (mCompleteGraphicsPipelines[programIndex].getPipeline(preloadDesc, &existingDescPtr,
+                                                                 &existingPipeline))
+        {
+            continue;
+        }
+
+        ANGLE_TRY(createGraphicsPipelineImpl(
+            contextVk, transformOptions, vk::GraphicsPipelineSubset::Complete, &pipelineCache,
+            PipelineSource::WarmUp, preloadDesc, glExecutable, &descPtr, &pipeline));
+    }
+
     // Merge the cache with RendererVk's
     return contextVk->getRenderer()->mergeIntoPipelineCache(mPipelineCache);
 }
@@ -1024,7 +1209,31 @@ angle::Result ProgramExecutableVk::addTextureDescriptorSetDesc(
                     samplerBinding.textureType == gl::TextureType::Buffer
                         ? VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER
                         : VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-                descOut->update(info.binding, descType, arraySize, activeStages, nullptr);
+
+                // Fold samplers that updateSamplerPromotions() found stable into the layout as
+                // immutable samplers; their descriptor writes no longer carry sampler identity.
+                const vk::Sampler *promotedSampler = nullptr;
+                if (activeTextures != nullptr &&
+                    descType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER)
+                {
+                    auto promoted = mPendingSamplerPromotions.find(textureUnit);
+                    if (promoted != mPendingSamplerPromotions.end())
+                    {
+                        ASSERT(arraySize == 1);
+                        const gl::Sampler *glSampler =
+                            contextVk->getState().getSampler(textureUnit);
+                        const vk::SamplerHelper &samplerHelper =
+                            glSampler != nullptr
+                                ? vk::GetImpl(glSampler)->getSampler()
+                                : (*activeTextures)[textureUnit]->getSampler(false);
+                        ASSERT(samplerHelper.getSamplerSerial().getValue() == promoted->second);
+                        promotedSampler                      = &samplerHelper.get();
+                        mPromotedSamplerSerials[textureUnit] = promoted->second;
+                        mPromotedSamplerUnits.set(textureUnit);
+                    }
+                }
+
+                descOut->update(info.binding, descType, arraySize, activeStages, promotedSampler);
             }
         }
     }
@@ -1032,6 +1241,81 @@ angle::Result ProgramExecutableVk::addTextureDescriptorSetDesc(
     return angle::Result::Continue;
 }
 
+bool ProgramExecutableVk::updateSamplerPromotions(
+    ContextVk *contextVk,
+    const gl::ProgramExecutable &executable,
+    const gl::ActiveTextureArray<TextureVk *> &activeTextures)
+{
+    const std::vector<gl::SamplerBinding> &samplerBindings = executable.getSamplerBindings();
+    const std::vector<gl::LinkedUniform> &uniforms         = executable.getUniforms();
+
+    // Mirrors the walk in addTextureDescriptorSetDesc(): only bindings that reach the mutable
+    // combined-image-sampler path there are candidates, so the recorded and desired sets always
+    // converge after one layout recreation.
+    mPendingSamplerPromotions.clear();
+
+    for (uint32_t textureIndex = 0; textureIndex < samplerBindings.size(); ++textureIndex)
+    {
+        uint32_t uniformIndex = executable.getUniformIndexFromSamplerIndex(textureIndex);
+        const gl::LinkedUniform &samplerUniform = uniforms[uniformIndex];
+
+        if (samplerUniform.outerArrayOffset > 0)
+        {
+            continue;
+        }
+
+        const gl::SamplerBinding &samplerBinding = samplerBindings[textureIndex];
+        if (samplerBinding.textureType == gl::TextureType::Buffer)
+        {
+            continue;
+        }
+
+        // Immutable sampler arrays are not supported; neither are they for YCbCr.
+        uint32_t arraySize = static_cast<uint32_t>(samplerBinding.boundTextureUnits.size()) *
+                             gl::ArraySizeProduct(samplerUniform.outerArraySizes);
+        if (arraySize != 1)
+        {
+            continue;
+        }
+
+        bool isBindingActive = false;
+        for (gl::ShaderType shaderType : executable.getLinkedShaderStages())
+        {
+            if (!samplerUniform.isActive(shaderType))
+            {
+                continue;
+            }
+            const ShaderInterfaceVariableInfo &info = mVariableInfoMap.getIndexedVariableInfo(
+                shaderType, ShaderVariableType::Texture, textureIndex);
+            if (!info.isDuplicate)
+            {
+                isBindingActive = true;
+                break;
+            }
+        }
+        if (!isBindingActive)
+        {
+            continue;
+        }
+
+        const GLuint textureUnit = samplerBinding.boundTextureUnits[0];
+        TextureVk *textureVk     = activeTextures[textureUnit];
+        if (textureVk == nullptr || textureVk->getImage().hasImmutableSampler())
+        {
+            // YCbCr conversions already fold their (required) immutable sampler.
+            continue;
+        }
+
+        if (contextVk->isTextureUnitSamplerPromotable(textureUnit))
+        {
+            mPendingSamplerPromotions[textureUnit] =
+                contextVk->getTextureUnitSamplerSerial(textureUnit);
+        }
+    }
+
+    return mPendingSamplerPromotions != mPromotedSamplerSerials;
+}
+
 ProgramTransformOptions ProgramExecutableVk::getTransformOptions(
     ContextVk *contextVk,
     const vk::GraphicsPipelineDesc &desc,
@@ -1039,7 +1323,6 @@ ProgramTransformOptions ProgramExecutableVk::getTransformOptions(
 {
     ProgramTransformOptions transformOptions = {};
 
-    transformOptions.surfaceRotation = desc.getSurfaceRotation();
     transformOptions.removeTransformFeedbackEmulation =
         contextVk->getFeatures().emulateTransformFeedback.enabled &&
         !contextVk->getState().isTransformFeedbackActiveUnpaused();
@@ -1047,6 +1330,12 @@ ProgramTransformOptions ProgramExecutableVk::getTransformOptions(
     const bool hasFramebufferFetch = glExecutable.usesFramebufferFetch();
     const bool isMultisampled      = drawFrameBuffer->getSamples() > 1;
     transformOptions.multiSampleFramebufferFetch = hasFramebufferFetch && isMultisampled;
+    // Force early fragment tests when static analysis proved the fragment shader cannot interact
+    // with them.  Alpha-to-coverage modifies sample coverage after shading, so the optimization
+    // must be dropped while it is enabled.
+    transformOptions.addEarlyFragmentTestsOptimization =
+        glExecutable.hasEarlyFragmentTestsOptimization() &&
+        !contextVk->getState().isSampleAlphaToCoverageEnabled();
 
     return transformOptions;
 }
@@ -1100,7 +1389,7 @@ angle::Result ProgramExecutableVk::createGraphicsPipelineImpl(
     // Set specialization constants.  These are also a part of GraphicsPipelineDesc, so that a
     // change in specialization constants also results in a new pipeline.
     vk::SpecializationConstants specConsts;
-    specConsts.surfaceRotation = transformOptions.surfaceRotation;
+    specConsts.surfaceRotation = desc.getSurfaceRotation();
     specConsts.dither          = desc.getEmulatedDitherControl();
 
     // Pull in a compatible RenderPass.
@@ -1109,6 +1398,35 @@ angle::Result ProgramExecutableVk::createGraphicsPipelineImpl(
         contextVk, desc.getRenderPassDesc(), &compatibleRenderPass));
 
     CompleteGraphicsPipelineCache &pipelines = mCompleteGraphicsPipelines[programIndex];
+
+    if (contextVk->getFeatures().supportsGraphicsPipelineLibrary.enabled)
+    {
+        // Create (or reuse) the three subset libraries and fast-link the complete pipeline out of
+        // them.  Variants that only differ in vertex input or fragment output state reuse the
+        // shaders library, which is where the expensive compilation happens.
+        const vk::GraphicsPipelineDesc *subsetDescPtr = nullptr;
+
+        vk::PipelineHelper *shadersPipeline            = nullptr;
+        ShadersGraphicsPipelineCache &shadersPipelines = mShadersGraphicsPipelines[programIndex];
+        if (!shadersPipelines.getPipeline(desc, &subsetDescPtr, &shadersPipeline))
+        {
+            ANGLE_TRY(shaderProgram->createGraphicsPipeline(
+                contextVk, &shadersPipelines, pipelineCache, *compatibleRenderPass,
+                getPipelineLayout(), source, desc, specConsts, &subsetDescPtr, &shadersPipeline));
+        }
+
+        vk::PipelineHelper *vertexInputPipeline    = nullptr;
+        vk::PipelineHelper *fragmentOutputPipeline = nullptr;
+        ANGLE_TRY(contextVk->getVertexInputGraphicsPipeline(pipelineCache, source, desc,
+                                                            &vertexInputPipeline));
+        ANGLE_TRY(contextVk->getFragmentOutputGraphicsPipeline(pipelineCache, source, desc,
+                                                               &fragmentOutputPipeline));
+
+        return pipelines.linkLibraries(contextVk, pipelineCache, getPipelineLayout(),
+                                       vertexInputPipeline, shadersPipeline, fragmentOutputPipeline,
+                                       source, desc, descPtrOut, pipelineOut);
+    }
+
     return shaderProgram->createGraphicsPipeline(contextVk, &pipelines, pipelineCache,
                                                  *compatibleRenderPass, getPipelineLayout(), source,
                                                  desc, specConsts, descPtrOut, pipelineOut);
@@ -1149,6 +1467,13 @@ angle::Result ProgramExecutableVk::createGraphicsPipeline(
 {
     ProgramTransformOptions transformOptions = getTransformOptions(contextVk, desc, glExecutable);
 
+    // When a warm-start capture is requested, record the states pipelines are actually created
+    // with at draw time so later runs can compile them at link instead.
+    if (source == PipelineSource::Draw && contextVk->getRenderer()->pipelineWarmUpDumpEnabled())
+    {
+        contextVk->getRenderer()->recordPipelineWarmUpDesc(getWarmUpIdentityHash(), desc);
+    }
+
     return createGraphicsPipelineImpl(contextVk, transformOptions, pipelineSubset, pipelineCache,
                                       source, desc, glExecutable, descPtrOut, pipelineOut);
 }
@@ -1415,6 +1740,18 @@ angle::Result ProgramExecutableVk::updateTexturesDescriptorSet(
     vk::CommandBufferHelperCommon *commandBufferHelper,
     const vk::DescriptorSetDesc &texturesDesc)
 {
+    // If the description matches what the currently bound descriptor set was obtained for, reuse
+    // the set as-is; this skips the hash and cache lookup for the common case where texture
+    // bindings are unchanged between draws.
+    if (mDescriptorSets[DescriptorSetIndex::Texture] != VK_NULL_HANDLE &&
+        texturesDesc == mCurrentTexturesDesc)
+    {
+        commandBufferHelper->retainResource(
+            &mDescriptorPoolBindings[DescriptorSetIndex::Texture].get());
+        return angle::Result::Continue;
+    }
+    mCurrentTexturesDesc = texturesDesc;
+
     vk::SharedDescriptorSetCacheKey newSharedCacheKey;
     ANGLE_TRY(mDescriptorPools[DescriptorSetIndex::Texture].get().getOrAllocateDescriptorSet(
         context, commandBufferHelper, texturesDesc,
@@ -1536,29 +1873,95 @@ angle::Result ProgramExecutableVk::updateUniforms(
     vk::BufferHelper *emptyBuffer,
     const gl::ProgramExecutable &glExecutable,
     vk::DynamicBuffer *defaultUniformStorage,
+    DefaultUniformUploadPool *uploadPool,
     bool isTransformFeedbackActiveUnpaused,
     TransformFeedbackVk *transformFeedbackVk)
 {
     ASSERT(hasDirtyUniforms());
 
+    // A program bind dirties every stage because the shared uniform buffer may have moved under
+    // us since this program was last used.  If the buffer is still in the same tenure and the
+    // shadow data hasn't actually changed, the copies uploaded last time are still intact and the
+    // old descriptor offsets can simply be rebound.  Together with the redundant-update
+    // elimination in the setUniform* paths, this makes rebinding a program whose uniforms are
+    // only re-set to identical values free of copies and allocations.
+    vk::BufferHelper *currentBuffer = defaultUniformStorage->getCurrentBuffer();
+    if (currentBuffer != nullptr &&
+        mCurrentDefaultUniformBufferSerial == currentBuffer->getBufferSerial() &&
+        mCurrentDefaultUniformBufferGeneration == defaultUniformStorage->getBufferGeneration())
+    {
+        for (gl::ShaderType shaderType : glExecutable.getLinkedShaderStages())
+        {
+            if (mDefaultUniformBlocksDirty[shaderType] &&
+                !mDefaultUniformBlocks[shaderType]->isDirty())
+            {
+                mDefaultUniformBlocksDirty.reset(shaderType);
+            }
+        }
+        if (!hasDirtyUniforms())
+        {
+            return angle::Result::Continue;
+        }
+    }
+
     vk::BufferHelper *defaultUniformBuffer;
     bool anyNewBufferAllocated          = false;
     gl::ShaderMap<VkDeviceSize> offsets = {};  // offset to the beginning of bufferData
     uint32_t offsetIndex                = 0;
     size_t requiredSpace;
 
+    // Cross-program value dedup: if a dirty block's contents are byte-identical to a block some
+    // program already uploaded in the current buffer tenure -- common when many programs share
+    // most of their material values -- alias the uploaded range through the dynamic descriptor
+    // offset instead of uploading another copy.
+    gl::ShaderMap<uint32_t> aliasedOffsets = {};
+    gl::ShaderMap<size_t> blockHashes      = {};
+    gl::ShaderBitSet aliasedStages;
+    gl::ShaderBitSet hashedStages;
+    if (uploadPool != nullptr && currentBuffer != nullptr)
+    {
+        uploadPool->updateBufferTenure(currentBuffer->getBufferSerial(),
+                                       defaultUniformStorage->getBufferGeneration());
+        for (gl::ShaderType shaderType : glExecutable.getLinkedShaderStages())
+        {
+            if (!mDefaultUniformBlocksDirty[shaderType])
+            {
+                continue;
+            }
+            const angle::MemoryBuffer &uniformData = mDefaultUniformBlocks[shaderType]->uniformData;
+            blockHashes[shaderType] =
+                angle::ComputeGenericHash(uniformData.data(), uniformData.size());
+            hashedStages.set(shaderType);
+            if (uploadPool->findMatchingUpload(blockHashes[shaderType], uniformData,
+                                               &aliasedOffsets[shaderType]))
+            {
+                aliasedStages.set(shaderType);
+                mDefaultUniformBlocksDirty.reset(shaderType);
+            }
+        }
+    }
+
     // We usually only update uniform data for shader stages that are actually dirty. But when the
     // buffer for uniform data have switched, because all shader stages are using the same buffer,
     // we then must update uniform data for all shader stages to keep all shader stages' uniform
     // data in the same buffer.
     requiredSpace = calcUniformUpdateRequiredSpace(context, glExecutable, &offsets);
-    ASSERT(requiredSpace > 0);
-
+    if (requiredSpace == 0)
+    {
+        // Every dirty block aliased an existing upload; only the dynamic offsets (and possibly
+        // the descriptor set) need to be updated.
+        ASSERT(aliasedStages.any());
+        defaultUniformBuffer = currentBuffer;
+    }
     // Allocate space from dynamicBuffer. Always try to allocate from the current buffer first.
     // If that failed, we deal with fall out and try again.
-    if (!defaultUniformStorage->allocateFromCurrentBuffer(requiredSpace, &defaultUniformBuffer))
+    else if (!defaultUniformStorage->allocateFromCurrentBuffer(requiredSpace,
+                                                               &defaultUniformBuffer))
     {
         setAllDefaultUniformsDirty(glExecutable);
+        // The aliased ranges live in the buffer that is being replaced;
+        // setAllDefaultUniformsDirty() has re-marked those stages for upload into the new buffer.
+        aliasedStages.reset();
 
         requiredSpace = calcUniformUpdateRequiredSpace(context, glExecutable, &offsets);
         ANGLE_TRY(defaultUniformStorage->allocate(context, requiredSpace, &defaultUniformBuffer,
@@ -1567,21 +1970,61 @@ angle::Result ProgramExecutableVk::updateUniforms(
 
     ASSERT(defaultUniformBuffer);
 
-    uint8_t *bufferData       = defaultUniformBuffer->getMappedMemory();
+    if (uploadPool != nullptr)
+    {
+        // A new buffer may have been allocated above; make sure recorded uploads are keyed to it.
+        uploadPool->updateBufferTenure(defaultUniformBuffer->getBufferSerial(),
+                                       defaultUniformStorage->getBufferGeneration());
+    }
+
+    uint8_t *bufferData       = requiredSpace > 0 ? defaultUniformBuffer->getMappedMemory()
+                                                  : nullptr;
     VkDeviceSize bufferOffset = defaultUniformBuffer->getOffset();
     for (gl::ShaderType shaderType : glExecutable.getLinkedShaderStages())
     {
-        if (mDefaultUniformBlocksDirty[shaderType])
+        if (aliasedStages[shaderType])
+        {
+            mDynamicUniformDescriptorOffsets[offsetIndex] = aliasedOffsets[shaderType];
+            // Aliasing substitutes for an upload, so mirror the clean-marking of the copy path
+            // below.
+            if (mDefaultUniformBlocks[shaderType].use_count() == 1)
+            {
+                mDefaultUniformBlocks[shaderType]->markClean();
+            }
+        }
+        else if (mDefaultUniformBlocksDirty[shaderType])
         {
             const angle::MemoryBuffer &uniformData = mDefaultUniformBlocks[shaderType]->uniformData;
             memcpy(&bufferData[offsets[shaderType]], uniformData.data(), uniformData.size());
             mDynamicUniformDescriptorOffsets[offsetIndex] =
                 static_cast<uint32_t>(bufferOffset + offsets[shaderType]);
             mDefaultUniformBlocksDirty.reset(shaderType);
+            // If the block is shared with a program pipeline, the dirty range has to survive
+            // until every consumer has re-uploaded it, which we can't track; keep it dirty so
+            // the rebind fast path above stays disabled for such blocks.
+            if (mDefaultUniformBlocks[shaderType].use_count() == 1)
+            {
+                mDefaultUniformBlocks[shaderType]->markClean();
+            }
+            if (uploadPool != nullptr)
+            {
+                if (!hashedStages[shaderType])
+                {
+                    blockHashes[shaderType] =
+                        angle::ComputeGenericHash(uniformData.data(), uniformData.size());
+                }
+                uploadPool->recordUpload(blockHashes[shaderType], uniformData,
+                                         mDynamicUniformDescriptorOffsets[offsetIndex]);
+            }
         }
         ++offsetIndex;
     }
-    ANGLE_TRY(defaultUniformBuffer->flush(context->getRenderer()));
+    if (requiredSpace > 0)
+    {
+        ANGLE_TRY(defaultUniformBuffer->flush(context->getRenderer()));
+    }
+
+    mCurrentDefaultUniformBufferGeneration = defaultUniformStorage->getBufferGeneration();
 
     // Because the uniform buffers are per context, we can't rely on dynamicBuffer's allocate
     // function to tell us if you have got a new buffer or not. Other program's use of the buffer
@@ -1651,6 +2094,7 @@ angle::Result ProgramExecutableVk::resizeUniformBlockMemory(
 
             // Initialize uniform buffer memory to zero by default.
             mDefaultUniformBlocks[shaderType]->uniformData.fill(0);
+            mDefaultUniformBlocks[shaderType]->markAllDirty();
             mDefaultUniformBlocksDirty.set(shaderType);
         }
     }
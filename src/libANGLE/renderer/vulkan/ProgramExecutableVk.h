@@ -50,16 +50,19 @@ class ShaderInfo final : angle::NonCopyable
     bool mIsInitialized = false;
 };
 
+// Options that affect the SPIR-V transformation and thus require separate shader modules.
+// Surface rotation is intentionally not included; it is expressed through the pre-rotation
+// specialization constant (part of GraphicsPipelineDesc), so rotated and non-rotated pipeline
+// variants share the same shader modules.
 struct ProgramTransformOptions final
 {
-    uint8_t surfaceRotation : 1;
     uint8_t removeTransformFeedbackEmulation : 1;
     uint8_t multiSampleFramebufferFetch : 1;
+    uint8_t addEarlyFragmentTestsOptimization : 1;
     uint8_t reserved : 5;  // must initialize to zero
     static constexpr uint32_t kPermutationCount = 0x1 << 3;
 };
 static_assert(sizeof(ProgramTransformOptions) == 1, "Size check failed");
-static_assert(static_cast<int>(SurfaceRotation::EnumCount) <= 8, "Size check failed");
 
 class ProgramInfo final : angle::NonCopyable
 {
@@ -97,6 +100,28 @@ struct DefaultUniformBlock final : private angle::NonCopyable
     // Shadow copies of the shader uniform data.
     angle::MemoryBuffer uniformData;
 
+    // Byte range of |uniformData| that changed since the last upload to the GPU.  setUniform*
+    // calls extend it by the bytes they actually modified, and updates that leave the data
+    // unchanged don't extend it at all, so redundantly setting a handful of small uniforms
+    // between draw calls doesn't force the whole block to be copied out again.
+    angle::Range<size_t> dirtyRange;
+
+    void markDirty(size_t offset, size_t size)
+    {
+        ASSERT(size > 0);
+        dirtyRange.extend(offset);
+        dirtyRange.extend(offset + size - 1);
+    }
+    void markAllDirty()
+    {
+        if (!uniformData.empty())
+        {
+            markDirty(0, uniformData.size());
+        }
+    }
+    void markClean() { dirtyRange.invalidate(); }
+    bool isDirty() const { return !dirtyRange.empty(); }
+
     // Since the default blocks are laid out in std140, this tells us where to write on a call
     // to a setUniform method. They are arranged in uniform location order.
     std::vector<sh::BlockMemberInfo> uniformLayout;
@@ -106,6 +131,9 @@ struct DefaultUniformBlock final : private angle::NonCopyable
 using DescriptorSetCountList   = angle::PackedEnumMap<DescriptorSetIndex, uint32_t>;
 using ImmutableSamplerIndexMap = angle::HashMap<vk::YcbcrConversionDesc, uint32_t>;
 
+// Maps a texture unit to the serial of the sampler promoted into the pipeline layout for it.
+using PromotedSamplerSerialMap = angle::HashMap<uint32_t, uint32_t>;
+
 using DefaultUniformBlockMap = gl::ShaderMap<std::shared_ptr<DefaultUniformBlock>>;
 
 class ProgramExecutableVk
@@ -203,6 +231,16 @@ class ProgramExecutableVk
         return (mImmutableSamplerIndexMap == immutableSamplerIndexMap);
     }
 
+    // Recompute which texture units' samplers should be folded into the pipeline layout as
+    // immutable samplers (stable for kSamplerPromotionFrameThreshold frames), and which promoted
+    // ones have since changed and must be demoted.  Returns true if the set differs from what the
+    // current pipeline layout was built with, i.e. the layout must be recreated.
+    bool updateSamplerPromotions(ContextVk *contextVk,
+                                 const gl::ProgramExecutable &executable,
+                                 const gl::ActiveTextureArray<TextureVk *> &activeTextures);
+
+    const gl::ActiveTextureMask &getPromotedSamplerUnits() const { return mPromotedSamplerUnits; }
+
     size_t getDefaultUniformAlignedSize(vk::Context *context, gl::ShaderType shaderType) const
     {
         RendererVk *renderer = context->getRenderer();
@@ -225,6 +263,7 @@ class ProgramExecutableVk
                                  vk::BufferHelper *emptyBuffer,
                                  const gl::ProgramExecutable &glExecutable,
                                  vk::DynamicBuffer *defaultUniformStorage,
+                                 DefaultUniformUploadPool *uploadPool,
                                  bool isTransformFeedbackActiveUnpaused,
                                  TransformFeedbackVk *transformFeedbackVk);
     void onProgramBind(const gl::ProgramExecutable &glExecutable);
@@ -336,22 +375,50 @@ class ProgramExecutableVk
                                              DescriptorSetIndex setIndex,
                                              vk::SharedDescriptorSetCacheKey *newSharedCacheKeyOut);
 
-    angle::Result initializePipelineCache(ContextVk *contextVk,
+    angle::Result initializePipelineCache(vk::Context *context,
                                           const std::vector<uint8_t> &compressedPipelineData);
 
+    // Loading a cached program binary is done on a worker thread; only the steps that register
+    // with context-owned caches are deferred to the thread that resolves the link.
+    class LoadBinaryTask;
+    class LoadBinaryLinkEvent;
+
+    angle::Result loadBinaryImpl(vk::Context *context,
+                                 bool isSeparable,
+                                 gl::BinaryInputStream *stream,
+                                 gl::ShaderMap<size_t> *requiredBufferSizesOut);
+
     void resetLayout(ContextVk *contextVk);
 
+    // A hash of the program's SPIR-V, used to match the program against warm-start pipeline state
+    // preload entries across runs.  Computed lazily.
+    uint64_t getWarmUpIdentityHash();
+
     // Descriptor sets and pools for shader resources for this program.
     vk::DescriptorSetArray<VkDescriptorSet> mDescriptorSets;
     vk::DescriptorSetArray<vk::DescriptorPoolPointer> mDescriptorPools;
     vk::DescriptorSetArray<vk::RefCountedDescriptorPoolBinding> mDescriptorPoolBindings;
     uint32_t mNumDefaultUniformDescriptors;
     vk::BufferSerial mCurrentDefaultUniformBufferSerial;
+    // Which tenure of that buffer the last upload went into; see
+    // DynamicBuffer::getBufferGeneration().
+    uint32_t mCurrentDefaultUniformBufferGeneration;
+
+    // The bindings the currently bound texture descriptor set was obtained for.  Consecutive draws
+    // mostly use identical bindings, in which case even the descriptor set cache lookup can be
+    // skipped.
+    vk::DescriptorSetDesc mCurrentTexturesDesc;
 
     // We keep a reference to the pipeline and descriptor set layouts. This ensures they don't get
     // deleted while this program is in use.
     uint32_t mImmutableSamplersMaxDescriptorCount;
     ImmutableSamplerIndexMap mImmutableSamplerIndexMap;
+    // Sampler units that should be folded as immutable samplers in the next pipeline layout
+    // (computed by updateSamplerPromotions), and the units/serials the current layout was
+    // actually built with.
+    PromotedSamplerSerialMap mPendingSamplerPromotions;
+    PromotedSamplerSerialMap mPromotedSamplerSerials;
+    gl::ActiveTextureMask mPromotedSamplerUnits;
     vk::BindingPointer<vk::PipelineLayout> mPipelineLayout;
     vk::DescriptorSetLayoutPointerArray mDescriptorSetLayouts;
 
@@ -369,6 +436,11 @@ class ProgramExecutableVk
 
     CompleteGraphicsPipelineCache
         mCompleteGraphicsPipelines[ProgramTransformOptions::kPermutationCount];
+    // The shaders-subset pipeline libraries when VK_EXT_graphics_pipeline_library is used.
+    // Complete pipelines are fast-linked out of these and the context-owned vertex-input and
+    // fragment-output libraries, so state-only variants share the compiled shader state.
+    ShadersGraphicsPipelineCache
+        mShadersGraphicsPipelines[ProgramTransformOptions::kPermutationCount];
     vk::ComputePipelineCache mComputePipelines;
 
     DefaultUniformBlockMap mDefaultUniformBlocks;
@@ -376,6 +448,9 @@ class ProgramExecutableVk
 
     ShaderInfo mOriginalShaderInfo;
 
+    // See getWarmUpIdentityHash().  Zero means not yet computed.
+    uint64_t mWarmUpIdentityHash;
+
     // The pipeline cache specific to this program executable.  Currently:
     //
     // - This is only used during warm up (at link time)
@@ -70,27 +70,41 @@ void InitDefaultUniformBlock(const std::vector<sh::ShaderVariable> &uniforms,
     return;
 }
 
+// Updates this small are compared against the shadow copy first; legacy content tends to
+// redundantly set the same handful of uniforms before every draw call, and detecting that is
+// much cheaper than re-uploading the whole default block.
+constexpr size_t kUniformCompareMaxSize = 64;
+
+// Returns false if the update was combined away because the new data matches the shadow copy.
 template <typename T>
-void UpdateDefaultUniformBlock(GLsizei count,
+bool UpdateDefaultUniformBlock(GLsizei count,
                                uint32_t arrayIndex,
                                int componentCount,
                                const T *v,
                                const sh::BlockMemberInfo &layoutInfo,
-                               angle::MemoryBuffer *uniformData)
+                               DefaultUniformBlock *uniformBlock)
 {
     const int elementSize = sizeof(T) * componentCount;
 
-    uint8_t *dst = uniformData->data() + layoutInfo.offset;
+    angle::MemoryBuffer *uniformData = &uniformBlock->uniformData;
+    uint8_t *dst                     = uniformData->data() + layoutInfo.offset;
     if (layoutInfo.arrayStride == 0 || layoutInfo.arrayStride == elementSize)
     {
-        uint32_t arrayOffset = arrayIndex * layoutInfo.arrayStride;
-        uint8_t *writePtr    = dst + arrayOffset;
-        ASSERT(writePtr + (elementSize * count) <= uniformData->data() + uniformData->size());
-        memcpy(writePtr, v, elementSize * count);
+        uint32_t arrayOffset   = arrayIndex * layoutInfo.arrayStride;
+        uint8_t *writePtr      = dst + arrayOffset;
+        const size_t writeSize = static_cast<size_t>(elementSize) * count;
+        ASSERT(writePtr + writeSize <= uniformData->data() + uniformData->size());
+        if (writeSize <= kUniformCompareMaxSize && memcmp(writePtr, v, writeSize) == 0)
+        {
+            return false;
+        }
+        memcpy(writePtr, v, writeSize);
+        uniformBlock->markDirty(layoutInfo.offset + arrayOffset, writeSize);
     }
     else
     {
         // Have to respect the arrayStride between each element of the array.
+        bool changed = false;
         int maxIndex = arrayIndex + count;
         for (int writeIndex = arrayIndex, readIndex = 0; writeIndex < maxIndex;
              writeIndex++, readIndex++)
@@ -99,9 +113,20 @@ void UpdateDefaultUniformBlock(GLsizei count,
             uint8_t *writePtr     = dst + arrayOffset;
             const T *readPtr      = v + (readIndex * componentCount);
             ASSERT(writePtr + elementSize <= uniformData->data() + uniformData->size());
-            memcpy(writePtr, readPtr, elementSize);
+            if (memcmp(writePtr, readPtr, elementSize) != 0)
+            {
+                memcpy(writePtr, readPtr, elementSize);
+                changed = true;
+            }
         }
+        if (!changed)
+        {
+            return false;
+        }
+        uniformBlock->markDirty(layoutInfo.offset + arrayIndex * layoutInfo.arrayStride,
+                                (count - 1) * layoutInfo.arrayStride + elementSize);
     }
+    return true;
 }
 
 template <typename T>
@@ -361,9 +386,11 @@ void ProgramVk::setUniformImpl(GLint location, GLsizei count, const T *v, GLenum
             }
 
             const GLint componentCount = linkedUniform.typeInfo->componentCount;
-            UpdateDefaultUniformBlock(count, locationInfo.arrayIndex, componentCount, v, layoutInfo,
-                                      &uniformBlock.uniformData);
-            mExecutable.mDefaultUniformBlocksDirty.set(shaderType);
+            if (UpdateDefaultUniformBlock(count, locationInfo.arrayIndex, componentCount, v,
+                                          layoutInfo, &uniformBlock))
+            {
+                mExecutable.mDefaultUniformBlocksDirty.set(shaderType);
+            }
         }
     }
     else
@@ -383,6 +410,7 @@ void ProgramVk::setUniformImpl(GLint location, GLsizei count, const T *v, GLenum
 
             ASSERT(linkedUniform.typeInfo->type == gl::VariableBoolVectorType(entryPointType));
 
+            bool changed = false;
             GLint initialArrayOffset =
                 locationInfo.arrayIndex * layoutInfo.arrayStride + layoutInfo.offset;
             for (GLint i = 0; i < count; i++)
@@ -394,11 +422,22 @@ void ProgramVk::setUniformImpl(GLint location, GLsizei count, const T *v, GLenum
 
                 for (int c = 0; c < componentCount; c++)
                 {
-                    dst[c] = (source[c] == static_cast<T>(0)) ? GL_FALSE : GL_TRUE;
+                    const GLint boolValue = (source[c] == static_cast<T>(0)) ? GL_FALSE : GL_TRUE;
+                    if (dst[c] != boolValue)
+                    {
+                        dst[c] = boolValue;
+                        changed = true;
+                    }
                 }
             }
 
-            mExecutable.mDefaultUniformBlocksDirty.set(shaderType);
+            if (changed)
+            {
+                uniformBlock.markDirty(initialArrayOffset,
+                                       (count - 1) * layoutInfo.arrayStride +
+                                           componentCount * sizeof(GLint));
+                mExecutable.mDefaultUniformBlocksDirty.set(shaderType);
+            }
         }
     }
 }
@@ -523,10 +562,28 @@ void ProgramVk::setUniformMatrixfv(GLint location,
             continue;
         }
 
+        // The matrices are written out with each column padded to a vec4.
+        constexpr size_t kMatrixSize = sizeof(GLfloat) * cols * 4;
+        const GLsizei clampedCount   = std::min(
+            count, static_cast<GLsizei>(linkedUniform.getArraySizeProduct() -
+                                        locationInfo.arrayIndex));
+        const size_t writeOffset = layoutInfo.offset + locationInfo.arrayIndex * kMatrixSize;
+        const size_t writeSize   = clampedCount * kMatrixSize;
+
+        // When the source and destination layouts match, a small update can be compared against
+        // the shadow copy and combined away if it is redundant.
+        if (writeSize == 0 ||
+            (rows == 4 && !transpose && writeSize <= kUniformCompareMaxSize &&
+             memcmp(uniformBlock.uniformData.data() + writeOffset, value, writeSize) == 0))
+        {
+            continue;
+        }
+
         SetFloatUniformMatrixGLSL<cols, rows>::Run(
             locationInfo.arrayIndex, linkedUniform.getArraySizeProduct(), count, transpose, value,
             uniformBlock.uniformData.data() + layoutInfo.offset);
 
+        uniformBlock.markDirty(writeOffset, writeSize);
         mExecutable.mDefaultUniformBlocksDirty.set(shaderType);
     }
 }
@@ -130,6 +130,18 @@ void RenderTargetVk::onDepthStencilDraw(ContextVk *contextVk, uint32_t framebuff
                                   mResolveImage);
 }
 
+void RenderTargetVk::onDepthStencilResolve(ContextVk *contextVk, uint32_t framebufferLayerCount)
+{
+    const angle::Format &format = mImage->getActualFormat();
+    ASSERT(format.hasDepthOrStencilBits());
+    ASSERT(framebufferLayerCount <= mLayerCount);
+    ASSERT(mResolveImage == nullptr);
+
+    contextVk->onImageRenderPassWrite(mLevelIndexGL, mLayerIndex, framebufferLayerCount,
+                                      vk::GetDepthStencilAspectFlags(format),
+                                      vk::ImageLayout::DepthStencilResolveAttachment, mImage);
+}
+
 vk::ImageHelper &RenderTargetVk::getImageForRenderPass()
 {
     ASSERT(mImage && mImage->valid());
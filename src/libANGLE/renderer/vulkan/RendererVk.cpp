@@ -14,6 +14,8 @@
 
 #include <EGL/eglext.h>
 
+#include <algorithm>
+
 #include "common/debug.h"
 #include "common/platform.h"
 #include "common/system_utils.h"
@@ -23,6 +25,7 @@
 #include "gpu_info_util/SystemInfo.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
+#include "libANGLE/renderer/MemoryBudget.h"
 #include "libANGLE/renderer/driver_utils.h"
 #include "libANGLE/renderer/glslang_wrapper_utils.h"
 #include "libANGLE/renderer/vulkan/CompilerVk.h"
@@ -70,6 +73,16 @@ constexpr uint32_t kPreferredDefaultUniformBufferSize = 64 * 1024u;
 
 // Update the pipeline cache every this many swaps.
 constexpr uint32_t kPipelineCacheVkUpdatePeriod = 60;
+
+// Default size below which glBufferSubData updates are coalesced in a CPU shadow when the
+// coalesceSmallBufferUpdates feature is enabled.
+constexpr size_t kDefaultSmallBufferUpdateThreshold = 256;
+
+// Number of finished command batches accumulated into a single vkQueueSubmit call when the
+// batchCommandQueueSubmits feature is enabled.  Fence waits, presents, one-off submits and
+// context priority changes flush the accumulated batches early, so a larger limit mostly
+// increases how long fences of fully recorded work stay unsubmitted.
+constexpr size_t kMaxBatchedQueueSubmits = 8;
 // Per the Vulkan specification, as long as Vulkan 1.1+ is returned by vkEnumerateInstanceVersion,
 // ANGLE must indicate the highest version of Vulkan functionality that it uses.  The Vulkan
 // validation layers will issue messages for any core functionality that requires a higher version.
@@ -1035,6 +1048,28 @@ void ComputePipelineCacheVkChunkKey(VkPhysicalDeviceProperties physicalDevicePro
                                hashString.length(), hashOut->data());
 }
 
+void ComputeFormatPropertiesCacheKey(const VkPhysicalDeviceProperties &physicalDeviceProperties,
+                                     bool forceD16TexFilter,
+                                     egl::BlobCache::Key *hashOut)
+{
+    // Bump this version when the serialized layout of the format properties changes.
+    constexpr uint32_t kFormatPropertiesCacheVersion = 1;
+
+    std::ostringstream hashStream("ANGLE Format Properties Cache: ", std::ios_base::ate);
+    // The queried format properties only depend on the device and driver.  The forceD16TexFilter
+    // workaround is folded into the cached properties, so it is part of the key as well.
+    hashStream << std::hex << physicalDeviceProperties.vendorID;
+    hashStream << std::hex << physicalDeviceProperties.deviceID;
+    hashStream << std::hex << physicalDeviceProperties.driverVersion;
+    hashStream << std::hex << kFormatPropertiesCacheVersion;
+    hashStream << std::hex << angle::kNumANGLEFormats;
+    hashStream << std::hex << static_cast<uint32_t>(forceD16TexFilter);
+
+    const std::string &hashString = hashStream.str();
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(hashString.c_str()),
+                               hashString.length(), hashOut->data());
+}
+
 void CompressAndStorePipelineCacheVk(VkPhysicalDeviceProperties physicalDeviceProperties,
                                      DisplayVk *displayVk,
                                      ContextVk *contextVk,
@@ -1149,6 +1184,38 @@ class WaitableCompressEventImpl : public WaitableCompressEvent
     std::shared_ptr<CompressAndStorePipelineCacheTask> mCompressTask;
 };
 
+// Destroys a batch of collected garbage off the submitting thread.  The entries are exclusively
+// owned by the task (their lifetimes completed before collection), so no lock is needed.
+class DestroyGarbageTask : public angle::Closure
+{
+  public:
+    DestroyGarbageTask(RendererVk *renderer,
+                       std::vector<vk::SharedGarbage> &&garbage,
+                       std::vector<vk::SharedBufferSuballocationGarbage> &&suballocationGarbage)
+        : mRenderer(renderer),
+          mGarbage(std::move(garbage)),
+          mSuballocationGarbage(std::move(suballocationGarbage))
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "DestroyGarbageTask");
+        for (vk::SharedGarbage &garbage : mGarbage)
+        {
+            garbage.destroy(mRenderer);
+        }
+        for (vk::SharedBufferSuballocationGarbage &garbage : mSuballocationGarbage)
+        {
+            garbage.destroy(mRenderer);
+        }
+    }
+
+  private:
+    RendererVk *mRenderer;
+    std::vector<vk::SharedGarbage> mGarbage;
+    std::vector<vk::SharedBufferSuballocationGarbage> mSuballocationGarbage;
+};
+
 angle::Result GetAndDecompressPipelineCacheVk(VkPhysicalDeviceProperties physicalDeviceProperties,
                                               DisplayVk *displayVk,
                                               angle::MemoryBuffer *uncompressedData,
@@ -1283,6 +1350,9 @@ RendererVk::RendererVk()
       mPipelineCacheVkUpdateTimeout(kPipelineCacheVkUpdatePeriod),
       mPipelineCacheSizeAtLastSync(0),
       mPipelineCacheInitialized(false),
+      mSharedDepthStencilPoolEnabled(false),
+      mExportablePbufferMemoryEnabled(false),
+      mSmallBufferUpdateThreshold(kDefaultSmallBufferUpdateThreshold),
       mValidationMessageCount(0),
       mCommandProcessor(this),
       mSupportedVulkanPipelineStageMask(0),
@@ -1301,6 +1371,10 @@ RendererVk::~RendererVk()
 {
     mAllocator.release();
     mPipelineCache.release();
+    for (vk::PipelineCache &shard : mPipelineCacheShards)
+    {
+        shard.release();
+    }
     ASSERT(!hasSharedGarbage());
 
     if (mLibVulkanLibrary)
@@ -1331,6 +1405,8 @@ void RendererVk::onDestroy(vk::Context *context)
         handleDeviceLost();
     }
 
+    writePipelineWarmUpDump();
+
     for (std::unique_ptr<vk::BufferBlock> &block : mOrphanedBufferBlocks)
     {
         ASSERT(block->isEmpty());
@@ -1350,6 +1426,16 @@ void RendererVk::onDestroy(vk::Context *context)
         }
     }
 
+    // Wait for any outstanding background garbage destruction before tearing the device down.
+    {
+        std::vector<std::shared_ptr<angle::WaitableEvent>> garbageDestroyEvents;
+        {
+            std::unique_lock<std::mutex> lock(mGarbageMutex);
+            garbageDestroyEvents = std::move(mGarbageDestroyEvents);
+        }
+        angle::WaitableEvent::WaitMany(&garbageDestroyEvents);
+    }
+
     // Assigns an infinite "last completed" serial to force garbage to delete.
     cleanupGarbage(Serial::Infinite());
     ASSERT(!hasSharedGarbage());
@@ -1361,7 +1447,13 @@ void RendererVk::onDestroy(vk::Context *context)
 
     mOneOffCommandPool.destroy(mDevice);
 
+    mDepthStencilImagePool.destroy(this);
+
     mPipelineCache.destroy(mDevice);
+    for (vk::PipelineCache &shard : mPipelineCacheShards)
+    {
+        shard.destroy(mDevice);
+    }
     mSamplerCache.destroy(this);
     mYuvConversionCache.destroy(this);
     mVkFormatDescriptorCountMap.clear();
@@ -1450,7 +1542,10 @@ angle::Result RendererVk::initialize(DisplayVk *displayVk,
     }
 #endif  // defined(ANGLE_SHARED_LIBVULKAN)
 
-    mDisplay                         = display;
+    mDisplay             = display;
+    mMemoryBudgetTracker = displayVk->getMemoryBudgetTracker();
+    mMemoryReport.setBudgetTracker(mMemoryBudgetTracker);
+
     const egl::AttributeMap &attribs = mDisplay->getAttributeMap();
     angle::vk::ScopedVkLoaderEnvironment scopedEnvironment(ShouldUseValidationLayers(attribs),
                                                            ChooseICDFromAttribs(attribs));
@@ -1817,14 +1912,280 @@ angle::Result RendererVk::initialize(DisplayVk *displayVk,
         sh::InitializeGlslang();
     }
 
-    // Initialize the format table.
+    // Initialize the format table.  The VkFormatProperties queried while resolving the table only
+    // depend on the device and driver, so they are persisted in the blob cache; on a hit the
+    // table is resolved without any vkGetPhysicalDeviceFormatProperties calls.
+    const bool formatPropertiesLoadedFromCache = loadCachedFormatProperties(displayVk);
+    if (!formatPropertiesLoadedFromCache)
+    {
+        queryFormatPropertiesOnWorkers();
+    }
     mFormatTable.initialize(this, &mNativeTextureCaps);
+    if (!formatPropertiesLoadedFromCache)
+    {
+        storeCachedFormatProperties(displayVk);
+    }
 
     setGlobalDebugAnnotator();
 
+    loadPipelineWarmUpPreload();
+
+    mSharedDepthStencilPoolEnabled =
+        !angle::GetEnvironmentVar("ANGLE_SHARED_DEPTH_STENCIL_BUFFERS").empty();
+
+    // Headless/server-side rendering: allocate pbuffer color buffers with exportable external
+    // memory so that a consumer process (e.g. a video encoder) can import them without a copy.
+    mExportablePbufferMemoryEnabled =
+        getFeatures().supportsExternalMemoryFd.enabled &&
+        !angle::GetEnvironmentVar("ANGLE_EXPORTABLE_PBUFFER_MEMORY").empty();
+
+    // Cut-off below which glBufferSubData updates are coalesced in a CPU shadow when the
+    // coalesceSmallBufferUpdates feature is enabled.
+    const std::string thresholdStr =
+        angle::GetEnvironmentVar("ANGLE_SMALL_BUFFER_UPDATE_THRESHOLD");
+    if (!thresholdStr.empty())
+    {
+        mSmallBufferUpdateThreshold = strtoul(thresholdStr.c_str(), nullptr, 10);
+    }
+
     return angle::Result::Continue;
 }
 
+bool RendererVk::loadCachedFormatProperties(DisplayVk *displayVk)
+{
+    egl::BlobCache::Key cacheKey;
+    ComputeFormatPropertiesCacheKey(mPhysicalDeviceProperties, mFeatures.forceD16TexFilter.enabled,
+                                    &cacheKey);
+
+    egl::BlobCache::Value cacheValue;
+    size_t cacheSize = 0;
+    if (!displayVk->getBlobCache()->get(displayVk->getScratchBuffer(), cacheKey, &cacheValue,
+                                        &cacheSize) ||
+        cacheSize != sizeof(VkFormatProperties) * angle::kNumANGLEFormats)
+    {
+        return false;
+    }
+
+    memcpy(mFormatProperties.data(), cacheValue.data(), cacheSize);
+    return true;
+}
+
+void RendererVk::storeCachedFormatProperties(DisplayVk *displayVk)
+{
+    egl::BlobCache::Key cacheKey;
+    ComputeFormatPropertiesCacheKey(mPhysicalDeviceProperties, mFeatures.forceD16TexFilter.enabled,
+                                    &cacheKey);
+
+    // Formats that were never queried keep their invalid marker in the stored blob, so loading it
+    // back preserves the lazy query for them.
+    angle::MemoryBuffer data;
+    if (!data.resize(sizeof(VkFormatProperties) * angle::kNumANGLEFormats))
+    {
+        return;
+    }
+    memcpy(data.data(), mFormatProperties.data(), data.size());
+
+    displayVk->getBlobCache()->putApplication(cacheKey, data);
+}
+
+namespace
+{
+// Warm-start pipeline state preload files begin with this magic followed by the size of
+// GraphicsPipelineDesc.  The size doubles as a version check: any change to the desc layout
+// invalidates previously captured preload lists.
+constexpr uint32_t kPipelineWarmUpFileMagic = 0x4C575041;
+
+// Queries VkFormatProperties for a slice of the ANGLE format range on a worker thread.  Each task
+// writes disjoint entries of the renderer's format properties cache, so no synchronization is
+// needed beyond joining the tasks' events.
+class QueryFormatPropertiesTask : public angle::Closure
+{
+  public:
+    QueryFormatPropertiesTask(VkPhysicalDevice physicalDevice,
+                              bool forceD16TexFilter,
+                              size_t firstFormat,
+                              size_t endFormat,
+                              VkFormatProperties *formatProperties)
+        : mPhysicalDevice(physicalDevice),
+          mForceD16TexFilter(forceD16TexFilter),
+          mFirstFormat(firstFormat),
+          mEndFormat(endFormat),
+          mFormatProperties(formatProperties)
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle,startup", "QueryFormatPropertiesTask");
+        for (size_t formatIndex = mFirstFormat; formatIndex < mEndFormat; ++formatIndex)
+        {
+            const angle::FormatID formatID = static_cast<angle::FormatID>(formatIndex);
+            if (formatID == angle::FormatID::NONE)
+            {
+                continue;
+            }
+
+            VkFormat vkFormat = vk::GetVkFormatFromFormatID(formatID);
+            if (vkFormat == VK_FORMAT_UNDEFINED)
+            {
+                continue;
+            }
+
+            VkFormatProperties *properties = &mFormatProperties[formatIndex];
+            vkGetPhysicalDeviceFormatProperties(mPhysicalDevice, vkFormat, properties);
+
+            // Matches the workaround in getFormatFeatureBits for Android devices that don't
+            // indicate filtering support on D16_UNORM.
+            if (mForceD16TexFilter && vkFormat == VK_FORMAT_D16_UNORM)
+            {
+                properties->linearTilingFeatures |=
+                    VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+                properties->optimalTilingFeatures |=
+                    VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+            }
+        }
+    }
+
+  private:
+    VkPhysicalDevice mPhysicalDevice;
+    bool mForceD16TexFilter;
+    size_t mFirstFormat;
+    size_t mEndFormat;
+    VkFormatProperties *mFormatProperties;
+};
+}  // namespace
+
+void RendererVk::queryFormatPropertiesOnWorkers()
+{
+    ANGLE_TRACE_EVENT0("gpu.angle,startup", "RendererVk::queryFormatPropertiesOnWorkers");
+
+    std::shared_ptr<angle::WorkerThreadPool> workerPool = mDisplay->getMultiThreadPool();
+
+    constexpr size_t kQueryTaskCount = 4;
+    constexpr size_t kFormatsPerTask =
+        (angle::kNumANGLEFormats + kQueryTaskCount - 1) / kQueryTaskCount;
+
+    std::vector<std::shared_ptr<angle::WaitableEvent>> events;
+    for (size_t firstFormat = 0; firstFormat < angle::kNumANGLEFormats;
+         firstFormat += kFormatsPerTask)
+    {
+        const size_t endFormat =
+            std::min(firstFormat + kFormatsPerTask, static_cast<size_t>(angle::kNumANGLEFormats));
+        auto task = std::make_shared<QueryFormatPropertiesTask>(
+            mPhysicalDevice, mFeatures.forceD16TexFilter.enabled, firstFormat, endFormat,
+            mFormatProperties.data());
+
+        std::shared_ptr<angle::WaitableEvent> event =
+            workerPool->postWorkerTask(task, angle::TaskPriority::Foreground);
+        if (!event)
+        {
+            // Couldn't post the task; run the queries inline.
+            (*task)();
+            continue;
+        }
+        events.push_back(std::move(event));
+    }
+    angle::WaitableEvent::WaitMany(&events);
+}
+
+void RendererVk::loadPipelineWarmUpPreload()
+{
+    mPipelineWarmUpDumpFile = angle::GetEnvironmentVar("ANGLE_PIPELINE_WARMUP_DUMP_FILE");
+
+    const std::string preloadFile = angle::GetEnvironmentVar("ANGLE_PIPELINE_WARMUP_FILE");
+    if (preloadFile.empty())
+    {
+        return;
+    }
+
+    FILE *file = fopen(preloadFile.c_str(), "rb");
+    if (file == nullptr)
+    {
+        WARN() << "Failed to open pipeline warm-up preload file: " << preloadFile;
+        return;
+    }
+
+    uint32_t magic    = 0;
+    uint32_t descSize = 0;
+    bool valid        = fread(&magic, sizeof(magic), 1, file) == 1 &&
+                 fread(&descSize, sizeof(descSize), 1, file) == 1 &&
+                 magic == kPipelineWarmUpFileMagic &&
+                 descSize == sizeof(vk::GraphicsPipelineDesc);
+
+    while (valid)
+    {
+        PipelineWarmUpEntry entry;
+        if (fread(&entry.programHash, sizeof(entry.programHash), 1, file) != 1)
+        {
+            // Clean end of file.
+            break;
+        }
+        if (fread(&entry.desc, sizeof(entry.desc), 1, file) != 1)
+        {
+            valid = false;
+            break;
+        }
+        mPipelineWarmUpPreload.push_back(entry);
+    }
+
+    fclose(file);
+
+    if (!valid)
+    {
+        WARN() << "Ignoring malformed pipeline warm-up preload file: " << preloadFile;
+        mPipelineWarmUpPreload.clear();
+    }
+}
+
+void RendererVk::recordPipelineWarmUpDesc(uint64_t programHash,
+                                          const vk::GraphicsPipelineDesc &desc)
+{
+    ASSERT(pipelineWarmUpDumpEnabled());
+
+    std::lock_guard<std::mutex> lock(mPipelineWarmUpDumpMutex);
+    for (const PipelineWarmUpEntry &entry : mPipelineWarmUpDump)
+    {
+        if (entry.programHash == programHash &&
+            entry.desc.keyEqual(desc, vk::GraphicsPipelineSubset::Complete))
+        {
+            return;
+        }
+    }
+    mPipelineWarmUpDump.push_back({programHash, desc});
+}
+
+void RendererVk::getPipelineWarmUpDescs(uint64_t programHash,
+                                        std::vector<vk::GraphicsPipelineDesc> *descsOut) const
+{
+    for (const PipelineWarmUpEntry &entry : mPipelineWarmUpPreload)
+    {
+        if (entry.programHash == programHash)
+        {
+            descsOut->push_back(entry.desc);
+        }
+    }
+}
+
+void RendererVk::writePipelineWarmUpDump()
+{
+    std::lock_guard<std::mutex> lock(mPipelineWarmUpDumpMutex);
+    if (mPipelineWarmUpDumpFile.empty() || mPipelineWarmUpDump.empty())
+    {
+        return;
+    }
+
+    angle::SaveFileHelper saveFile(mPipelineWarmUpDumpFile);
+    const uint32_t magic    = kPipelineWarmUpFileMagic;
+    const uint32_t descSize = sizeof(vk::GraphicsPipelineDesc);
+    saveFile.write(reinterpret_cast<const uint8_t *>(&magic), sizeof(magic));
+    saveFile.write(reinterpret_cast<const uint8_t *>(&descSize), sizeof(descSize));
+    for (const PipelineWarmUpEntry &entry : mPipelineWarmUpDump)
+    {
+        saveFile.write(reinterpret_cast<const uint8_t *>(&entry.programHash),
+                       sizeof(entry.programHash));
+        saveFile.write(reinterpret_cast<const uint8_t *>(&entry.desc), sizeof(entry.desc));
+    }
+}
+
 angle::Result RendererVk::initializeMemoryAllocator(DisplayVk *displayVk)
 {
     // This number matches Chromium and was picked by looking at memory usage of
@@ -1929,6 +2290,11 @@ angle::Result RendererVk::initializeMemoryAllocator(DisplayVk *displayVk)
 
 void RendererVk::queryDeviceExtensionFeatures(const vk::ExtensionNameList &deviceExtensionNames)
 {
+    // VK_EXT_memory_budget only adds a physical-device-level query, so using it requires no
+    // change to the device create info.
+    mSupportsMemoryBudgetQuery =
+        ExtensionFound(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME, deviceExtensionNames);
+
     // Default initialize all extension features to false.
     mLineRasterizationFeatures = {};
     mLineRasterizationFeatures.sType =
@@ -2480,6 +2846,9 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
     if (getFeatures().supportsExternalMemoryFd.enabled)
     {
         mEnabledDeviceExtensions.push_back(VK_KHR_EXTERNAL_MEMORY_FD_EXTENSION_NAME);
+#if !defined(ANGLE_SHARED_LIBVULKAN)
+        InitExternalMemoryFdFunctions(mInstance);
+#endif  // !defined(ANGLE_SHARED_LIBVULKAN)
     }
 
     if (getFeatures().supportsExternalMemoryFuchsia.enabled)
@@ -2702,7 +3071,8 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
     }
 
     if (getFeatures().logMemoryReportCallbacks.enabled ||
-        getFeatures().logMemoryReportStats.enabled)
+        getFeatures().logMemoryReportStats.enabled ||
+        mMemoryBudgetTracker->hasPressureCallback())
     {
         if (mMemoryReportFeatures.deviceMemoryReport)
         {
@@ -2715,7 +3085,8 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
             mMemoryReportCallback.pUserData       = this;
             vk::AddToPNextChain(&createInfo, &mMemoryReportCallback);
         }
-        else
+        else if (getFeatures().logMemoryReportCallbacks.enabled ||
+                 getFeatures().logMemoryReportStats.enabled)
         {
             WARN() << "Disabling the following feature(s) because driver does not support "
                       "VK_EXT_device_memory_report extension:";
@@ -2883,6 +3254,11 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
     bool enableProtectedContent =
         queueFamily.supportsProtected() && getFeatures().supportsProtectedMemory.enabled;
 
+    // One queue is requested per EGL context priority level (see
+    // QueueFamily::initializeQueueMap), so that low/medium/high priority contexts in the same
+    // process submit to distinct VkQueues with correspondingly scaled Vulkan queue priorities and
+    // background work does not inflate the frame times of a latency-sensitive context.  When the
+    // family exposes fewer queues, the lower priorities fold into the medium-priority queue.
     uint32_t queueCount = std::min(queueFamily.getDeviceQueueCount(),
                                    static_cast<uint32_t>(egl::ContextPriority::EnumCount));
 
@@ -2939,10 +3315,18 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
     if (isAsyncCommandQueueEnabled())
     {
         ANGLE_TRY(mCommandProcessor.init(displayVk, graphicsQueueMap));
+        if (mFeatures.batchCommandQueueSubmits.enabled)
+        {
+            mCommandProcessor.setMaxBatchedQueueSubmits(kMaxBatchedQueueSubmits);
+        }
     }
     else
     {
         ANGLE_TRY(mCommandQueue.init(displayVk, graphicsQueueMap));
+        if (mFeatures.batchCommandQueueSubmits.enabled)
+        {
+            mCommandQueue.setMaxBatchedQueueSubmits(kMaxBatchedQueueSubmits);
+        }
     }
 
 #if defined(ANGLE_SHARED_LIBVULKAN)
@@ -3002,11 +3386,20 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
     mDefaultUniformBufferSize = std::min(
         mDefaultUniformBufferSize, getPhysicalDeviceProperties().limits.maxUniformBufferRange);
 
-    // Initialize the vulkan pipeline cache.
-    bool success = false;
+    // Create an empty pipeline cache so the handle is immediately usable.  Loading the (possibly
+    // large) blob-cache data and merging it in is deferred to the first getPipelineCache() call,
+    // so cold display bring-up doesn't pay for the disk read and decompression.
     {
         std::unique_lock<std::mutex> lock(mPipelineCacheMutex);
-        ANGLE_TRY(initPipelineCache(displayVk, &mPipelineCache, &success));
+
+        VkPipelineCacheCreateInfo pipelineCacheCreateInfo = {};
+        pipelineCacheCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        if (getFeatures().supportsPipelineCreationCacheControl.enabled)
+        {
+            pipelineCacheCreateInfo.flags |=
+                VK_PIPELINE_CACHE_CREATE_EXTERNALLY_SYNCHRONIZED_BIT_EXT;
+        }
+        ANGLE_VK_TRY(displayVk, mPipelineCache.init(mDevice, pipelineCacheCreateInfo));
         ANGLE_TRY(getPipelineCacheSize(displayVk, &mPipelineCacheSizeAtLastSync));
     }
 
@@ -3036,9 +3429,50 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
     }
     mSupportedVulkanPipelineStageMask = ~unsupportedStages;
 
+    updateMemoryBudget();
+
     return angle::Result::Continue;
 }
 
+void RendererVk::updateMemoryBudget()
+{
+    VkPhysicalDeviceMemoryProperties2 memoryProperties = {};
+    memoryProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT budgetProperties = {};
+    budgetProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+
+    const bool useBudgetExtension =
+        mSupportsMemoryBudgetQuery && vkGetPhysicalDeviceMemoryProperties2KHR != nullptr;
+    if (useBudgetExtension)
+    {
+        memoryProperties.pNext = &budgetProperties;
+        vkGetPhysicalDeviceMemoryProperties2KHR(mPhysicalDevice, &memoryProperties);
+    }
+    else
+    {
+        vkGetPhysicalDeviceMemoryProperties(mPhysicalDevice, &memoryProperties.memoryProperties);
+    }
+
+    // Sum the device-local heaps.  Without VK_EXT_memory_budget the raw heap sizes serve as a
+    // conservative stand-in for the budget.
+    VkDeviceSize budget = 0;
+    for (uint32_t heapIndex = 0; heapIndex < memoryProperties.memoryProperties.memoryHeapCount;
+         ++heapIndex)
+    {
+        if ((memoryProperties.memoryProperties.memoryHeaps[heapIndex].flags &
+             VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) == 0)
+        {
+            continue;
+        }
+        budget += useBudgetExtension
+                      ? budgetProperties.heapBudget[heapIndex]
+                      : memoryProperties.memoryProperties.memoryHeaps[heapIndex].size;
+    }
+
+    mMemoryBudgetTracker->setBudget(budget);
+}
+
 void RendererVk::initializeValidationMessageSuppressions()
 {
     // Build the list of validation errors that are currently expected and should be skipped.
@@ -3627,6 +4061,24 @@ void RendererVk::initFeatures(DisplayVk *displayVk,
         !mFeatures.supportsRenderPassLoadStoreOpNone.enabled &&
             ExtensionFound(VK_QCOM_RENDER_PASS_STORE_OPS_EXTENSION_NAME, deviceExtensionNames));
 
+    // Disabled by default; can mispredict for a frame when an application changes its attachment
+    // usage pattern.  Mostly benefits tiler GPUs, where an unnecessary store costs bandwidth.
+    ANGLE_FEATURE_CONDITION(&mFeatures, predictiveRenderPassStoreOps, false);
+
+    // Disabled by default while the set of closure reasons that are provably safe to defer is
+    // narrow; applications can measure the potential benefit through the render pass closure
+    // counters (see doc/RenderPassClosures.md).
+    ANGLE_FEATURE_CONDITION(&mFeatures, deferRenderPassBreakOnFramebufferSwitch, false);
+
+    // Disabled by default; intended for applications that burst many tiny glBufferSubData calls
+    // into device-local buffers between draws.  The size threshold is tunable through the
+    // ANGLE_SMALL_BUFFER_UPDATE_THRESHOLD environment variable.
+    ANGLE_FEATURE_CONDITION(&mFeatures, coalesceSmallBufferUpdates, false);
+
+    // Disabled by default; useful on desktops with resizable BAR and on UMA systems, where
+    // DEVICE_LOCAL|HOST_VISIBLE memory is not limited to a small window.
+    ANGLE_FEATURE_CONDITION(&mFeatures, adaptiveBufferMemoryType, false);
+
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsDepthClipControl,
                             mDepthClipControlFeatures.depthClipControl == VK_TRUE);
 
@@ -3758,6 +4210,9 @@ void RendererVk::initFeatures(DisplayVk *displayVk,
     // Currently disabled by default: http://anglebug.com/4324
     ANGLE_FEATURE_CONDITION(&mFeatures, asyncCommandQueue, false);
 
+    // Currently disabled by default: http://anglebug.com/8009
+    ANGLE_FEATURE_CONDITION(&mFeatures, batchCommandQueueSubmits, false);
+
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsYUVSamplerConversion,
                             mSamplerYcbcrConversionFeatures.samplerYcbcrConversion != VK_FALSE);
 
@@ -3855,6 +4310,15 @@ void RendererVk::initFeatures(DisplayVk *displayVk,
     ANGLE_FEATURE_CONDITION(&mFeatures, preferDrawClearOverVkCmdClearAttachments,
                             isQualcommProprietary);
 
+    // Batching scissored clears into one vkCmdClearAttachments call relies on that command being
+    // trustworthy; it inherits the Qualcomm exclusion above.
+    ANGLE_FEATURE_CONDITION(&mFeatures, batchScissoredClearAttachments,
+                            !mFeatures.preferDrawClearOverVkCmdClearAttachments.enabled);
+
+    // Compressing staged image updates trades CPU time for pending-update memory, which is only a
+    // good trade on memory-constrained configurations; it is left for applications to opt into.
+    ANGLE_FEATURE_CONDITION(&mFeatures, compressStagedImageUpdates, false);
+
     // r32f image emulation is done unconditionally so VK_FORMAT_FEATURE_STORAGE_*_ATOMIC_BIT is not
     // required.
     ANGLE_FEATURE_CONDITION(&mFeatures, emulateR32fImageAtomicExchange, true);
@@ -3965,6 +4429,23 @@ void RendererVk::initFeatures(DisplayVk *displayVk,
     // due to lost context/device.
     ANGLE_FEATURE_CONDITION(&mFeatures, mutableMipmapTextureUpload, !(IsWindows() && isIntel));
 
+    // http://anglebug.com/7888
+    // Deferring the allocation of glTexStorage textures to first use reduces peak memory for
+    // applications that preallocate large atlases, at the cost of moving the allocation (and
+    // potential OOM) to the middle of the frame.  Opt-in for now.
+    ANGLE_FEATURE_CONDITION(&mFeatures, deferImmutableTextureAllocation, false);
+
+    // http://anglebug.com/7887
+    // Eagerly submitting a texture's staged updates lets the GPU overlap large streaming uploads
+    // with continued command recording, but may cause extra image respecification if the
+    // application redefines levels after the early flush.  Opt-in for now.
+    ANGLE_FEATURE_CONDITION(&mFeatures, eagerlySubmitLargeTextureUpdates, false);
+
+    // http://anglebug.com/7889
+    // Chunked staging bounds peak staging memory for very large uploads, at the cost of extra
+    // copy regions per update.  Only worth it on memory-constrained devices, so opt-in.
+    ANGLE_FEATURE_CONDITION(&mFeatures, stageLargeTextureUpdatesInChunks, false);
+
     // Retain debug info in SPIR-V blob.
     ANGLE_FEATURE_CONDITION(&mFeatures, retainSPIRVDebugInfo, getEnableValidationLayers());
 
@@ -4172,10 +4653,50 @@ angle::Result RendererVk::getPipelineCache(PipelineCacheAccess *pipelineCacheOut
         ANGLE_TRY(getPipelineCacheSize(displayVk, &mPipelineCacheSizeAtLastSync));
     }
 
-    pipelineCacheOut->init(&mPipelineCache, &mPipelineCacheMutex);
+    if (!mPipelineCacheShardsInitialized)
+    {
+        VkPipelineCacheCreateInfo shardCreateInfo = {};
+        shardCreateInfo.sType                     = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        if (mFeatures.supportsPipelineCreationCacheControl.enabled)
+        {
+            shardCreateInfo.flags |=
+                VK_PIPELINE_CACHE_CREATE_EXTERNALLY_SYNCHRONIZED_BIT_EXT;
+        }
+
+        for (vk::PipelineCache &shard : mPipelineCacheShards)
+        {
+            ANGLE_VK_TRY(displayVk, shard.init(mDevice, shardCreateInfo));
+            // Seed the shard with the main cache so blob-cache-preloaded entries are visible to
+            // every shard.
+            shard.merge(mDevice, 1, mPipelineCache.ptr());
+        }
+        mPipelineCacheShardsInitialized = true;
+    }
+
+    // Spread pipeline creation across the shards by thread so concurrent creation from multiple
+    // contexts doesn't serialize on a single cache lock.
+    const size_t shardIndex =
+        std::hash<std::thread::id>()(std::this_thread::get_id()) % kPipelineCacheShardCount;
+    pipelineCacheOut->init(&mPipelineCacheShards[shardIndex],
+                           &mPipelineCacheShardMutexes[shardIndex]);
     return angle::Result::Continue;
 }
 
+void RendererVk::mergePipelineCacheShards()
+{
+    std::unique_lock<std::mutex> lock(mPipelineCacheMutex);
+    if (!mPipelineCacheShardsInitialized)
+    {
+        return;
+    }
+
+    for (size_t shardIndex = 0; shardIndex < kPipelineCacheShardCount; ++shardIndex)
+    {
+        std::unique_lock<std::mutex> shardLock(mPipelineCacheShardMutexes[shardIndex]);
+        mPipelineCache.merge(mDevice, 1, mPipelineCacheShards[shardIndex].ptr());
+    }
+}
+
 angle::Result RendererVk::mergeIntoPipelineCache(const vk::PipelineCache &pipelineCache)
 {
     PipelineCacheAccess globalCache;
@@ -4269,6 +4790,10 @@ angle::Result RendererVk::syncPipelineCacheVk(DisplayVk *displayVk, const gl::Co
 
     mPipelineCacheVkUpdateTimeout = kPipelineCacheVkUpdatePeriod;
 
+    // Fold the per-thread shard caches in first so the serialized blob contains everything
+    // created since the last sync.
+    mergePipelineCacheShards();
+
     size_t pipelineCacheSize = 0;
     ANGLE_TRY(getPipelineCacheSize(displayVk, &pipelineCacheSize));
     if (pipelineCacheSize <= mPipelineCacheSizeAtLastSync)
@@ -4343,8 +4868,10 @@ angle::Result RendererVk::syncPipelineCacheVk(DisplayVk *displayVk, const gl::Co
         auto compressAndStorePipelineCacheTask =
             std::make_shared<CompressAndStorePipelineCacheTask>(
                 displayVk, contextVk, std::move(pipelineCacheData), kMaxTotalSize);
+        // Nothing blocks on cache compression; keep it off the foreground lane.
         mCompressEvent = std::make_shared<WaitableCompressEventImpl>(
-            context->getWorkerThreadPool()->postWorkerTask(compressAndStorePipelineCacheTask),
+            context->getWorkerThreadPool()->postWorkerTask(compressAndStorePipelineCacheTask,
+                                                           angle::TaskPriority::Background),
             compressAndStorePipelineCacheTask);
     }
     else
@@ -4530,40 +5057,37 @@ void RendererVk::pruneOrphanedBufferBlocks()
     }
 }
 
-void RendererVk::cleanupGarbage(Serial lastCompletedQueueSerial)
+void RendererVk::collectCompletedGarbage(
+    Serial lastCompletedQueueSerial,
+    std::vector<vk::SharedGarbage> *garbageOut,
+    std::vector<vk::SharedBufferSuballocationGarbage> *suballocationGarbageOut)
 {
     std::unique_lock<std::mutex> lock(mGarbageMutex);
 
-    // Clean up general garbages
-    while (!mSharedGarbage.empty())
+    // Collect general garbage whose lifetime has completed.  Once off the list the garbage holds
+    // the only reference to its ResourceUse (isCurrentlyInUse was false under the lock), so it can
+    // be destroyed without mGarbageMutex.
+    while (!mSharedGarbage.empty() &&
+           !mSharedGarbage.front().isCurrentlyInUse(lastCompletedQueueSerial))
     {
-        vk::SharedGarbage &garbage = mSharedGarbage.front();
-        if (!garbage.destroyIfComplete(this, lastCompletedQueueSerial))
-        {
-            break;
-        }
+        garbageOut->push_back(std::move(mSharedGarbage.front()));
         mSharedGarbage.pop();
     }
 
-    // Clean up suballocation garbages
+    // Collect suballocation garbage likewise.
     VkDeviceSize suballocationBytesDestroyed = 0;
-    while (!mSuballocationGarbage.empty())
+    while (!mSuballocationGarbage.empty() &&
+           !mSuballocationGarbage.front().isCurrentlyInUse(lastCompletedQueueSerial))
     {
-        vk::SharedBufferSuballocationGarbage &garbage = mSuballocationGarbage.front();
-        VkDeviceSize garbageSize                      = garbage.getSize();
-        if (!garbage.destroyIfComplete(this, lastCompletedQueueSerial))
-        {
-            break;
-        }
-        // Actually destroyed.
+        suballocationBytesDestroyed += mSuballocationGarbage.front().getSize();
+        suballocationGarbageOut->push_back(std::move(mSuballocationGarbage.front()));
         mSuballocationGarbage.pop();
-        suballocationBytesDestroyed += garbageSize;
     }
     mSuballocationGarbageDestroyed += suballocationBytesDestroyed;
     mSuballocationGarbageSizeInBytes -= suballocationBytesDestroyed;
 
-    // Note: do this after clean up mSuballocationGarbage so that we will have more chances to find
-    // orphaned blocks being empty.
+    // Note: suballocations collected above are freed back to their blocks slightly later (by the
+    // caller, or a worker task), so an orphaned block may only be found empty on the next cleanup.
     if (!mOrphanedBufferBlocks.empty())
     {
         pruneOrphanedBufferBlocks();
@@ -4572,11 +5096,53 @@ void RendererVk::cleanupGarbage(Serial lastCompletedQueueSerial)
     // Cache the value with atomic variable for access without mGarbageMutex lock.
     mSuballocationGarbageSizeInBytesCachedAtomic.store(mSuballocationGarbageSizeInBytes,
                                                        std::memory_order_release);
+
+    // Opportunistically forget destruction tasks that have finished.
+    auto eventIsReady = [](const std::shared_ptr<angle::WaitableEvent> &event) {
+        return event->isReady();
+    };
+    mGarbageDestroyEvents.erase(
+        std::remove_if(mGarbageDestroyEvents.begin(), mGarbageDestroyEvents.end(), eventIsReady),
+        mGarbageDestroyEvents.end());
+}
+
+void RendererVk::cleanupGarbage(Serial lastCompletedQueueSerial)
+{
+    std::vector<vk::SharedGarbage> garbage;
+    std::vector<vk::SharedBufferSuballocationGarbage> suballocationGarbage;
+    collectCompletedGarbage(lastCompletedQueueSerial, &garbage, &suballocationGarbage);
+
+    // Destroy outside the lock so threads appending garbage never wait on vkDestroy* calls.
+    for (vk::SharedGarbage &entry : garbage)
+    {
+        entry.destroy(this);
+    }
+    for (vk::SharedBufferSuballocationGarbage &entry : suballocationGarbage)
+    {
+        entry.destroy(this);
+    }
 }
 
 void RendererVk::cleanupCompletedCommandsGarbage()
 {
-    cleanupGarbage(getLastCompletedQueueSerial());
+    std::vector<vk::SharedGarbage> garbage;
+    std::vector<vk::SharedBufferSuballocationGarbage> suballocationGarbage;
+    collectCompletedGarbage(getLastCompletedQueueSerial(), &garbage, &suballocationGarbage);
+
+    if (garbage.empty() && suballocationGarbage.empty())
+    {
+        return;
+    }
+
+    // Destruction spikes (heavy churn can queue thousands of objects) go to a low-priority worker
+    // so this thread only pays for the collection above.
+    auto task = std::make_shared<DestroyGarbageTask>(this, std::move(garbage),
+                                                     std::move(suballocationGarbage));
+    std::shared_ptr<angle::WaitableEvent> event =
+        mDisplay->getMultiThreadPool()->postWorkerTask(task, angle::TaskPriority::Background);
+
+    std::unique_lock<std::mutex> lock(mGarbageMutex);
+    mGarbageDestroyEvents.push_back(std::move(event));
 }
 
 void RendererVk::cleanupPendingSubmissionGarbage()
@@ -4811,6 +5377,14 @@ void RendererVk::handleDeviceLost()
 
 angle::Result RendererVk::finishToSerial(vk::Context *context, Serial serial)
 {
+    // The last completed serial is maintained atomically, so known-finished work can be detected
+    // without taking the queue lock.  Cleanup of the corresponding batches is deferred to the next
+    // checkCompletedCommands call.
+    if (serial <= getLastCompletedQueueSerial())
+    {
+        return angle::Result::Continue;
+    }
+
     std::unique_lock<std::mutex> lock(mCommandQueueMutex);
 
     if (isAsyncCommandQueueEnabled())
@@ -5093,6 +5667,22 @@ VkDeviceSize RendererVk::getPreferedBufferBlockSize(uint32_t memoryTypeIndex) co
 
 namespace vk
 {
+namespace
+{
+GpuMemoryCategory CategoryForObjectType(VkObjectType objectType)
+{
+    switch (objectType)
+    {
+        case VK_OBJECT_TYPE_BUFFER:
+            return GpuMemoryCategory::Buffer;
+        case VK_OBJECT_TYPE_IMAGE:
+            return GpuMemoryCategory::Image;
+        default:
+            return GpuMemoryCategory::Other;
+    }
+}
+}  // namespace
+
 MemoryReport::MemoryReport()
     : mCurrentTotalAllocatedMemory(0),
       mMaxTotalAllocatedMemory(0),
@@ -5125,6 +5715,11 @@ void MemoryReport::processCallback(const VkDeviceMemoryReportCallbackDataEXT &ca
             {
                 mMaxTotalAllocatedMemory = mCurrentTotalAllocatedMemory;
             }
+            if (mBudgetTracker != nullptr)
+            {
+                mBudgetTracker->onAllocation(CategoryForObjectType(callbackData.objectType),
+                                             callbackData.size);
+            }
             break;
         case VK_DEVICE_MEMORY_REPORT_EVENT_TYPE_FREE_EXT:
             reportType = "Free";
@@ -5133,6 +5728,11 @@ void MemoryReport::processCallback(const VkDeviceMemoryReportCallbackDataEXT &ca
             size = mSizesPerType[callbackData.objectType].allocatedMemory - callbackData.size;
             mSizesPerType[callbackData.objectType].allocatedMemory = size;
             mCurrentTotalAllocatedMemory -= callbackData.size;
+            if (mBudgetTracker != nullptr)
+            {
+                mBudgetTracker->onDeallocation(CategoryForObjectType(callbackData.objectType),
+                                               callbackData.size);
+            }
             break;
         case VK_DEVICE_MEMORY_REPORT_EVENT_TYPE_IMPORT_EXT:
             reportType = "Import";
@@ -51,6 +51,7 @@ namespace rx
 {
 class DisplayVk;
 class FramebufferVk;
+class MemoryBudgetTracker;
 
 namespace vk
 {
@@ -66,6 +67,8 @@ class MemoryReport final : angle::NonCopyable
     MemoryReport();
     void processCallback(const VkDeviceMemoryReportCallbackDataEXT &callbackData, bool logCallback);
     void logMemoryReportStats() const;
+    // Also forwards allocation and free events to the display's memory budget tracker.
+    void setBudgetTracker(MemoryBudgetTracker *budgetTracker) { mBudgetTracker = budgetTracker; }
 
   private:
     struct MemorySizes
@@ -82,6 +85,7 @@ class MemoryReport final : angle::NonCopyable
     VkDeviceSize mCurrentTotalImportedMemory;
     VkDeviceSize mMaxTotalImportedMemory;
     angle::HashMap<uint64_t, int> mUniqueIDCounts;
+    MemoryBudgetTracker *mBudgetTracker = nullptr;
 };
 
 // Information used to accurately skip known synchronization issues in ANGLE.
@@ -195,6 +199,8 @@ class RendererVk : angle::NonCopyable
 
     const vk::MemoryProperties &getMemoryProperties() const { return mMemoryProperties; }
 
+    MemoryBudgetTracker *getMemoryBudgetTracker() const { return mMemoryBudgetTracker; }
+
     const vk::Format &getFormat(GLenum internalFormat) const
     {
         return mFormatTable[internalFormat];
@@ -204,6 +210,14 @@ class RendererVk : angle::NonCopyable
 
     angle::Result getPipelineCacheSize(DisplayVk *displayVk, size_t *pipelineCacheSizeOut);
     angle::Result syncPipelineCacheVk(DisplayVk *displayVk, const gl::Context *context);
+    // The VkPipelineCache size as of the last sync, without a vkGetPipelineCacheData round-trip.
+    size_t getPipelineCacheSizeAtLastSync() const { return mPipelineCacheSizeAtLastSync; }
+
+    // Warm-start pipeline state preload (see mPipelineWarmUpPreload).
+    bool pipelineWarmUpDumpEnabled() const { return !mPipelineWarmUpDumpFile.empty(); }
+    void recordPipelineWarmUpDesc(uint64_t programHash, const vk::GraphicsPipelineDesc &desc);
+    void getPipelineWarmUpDescs(uint64_t programHash,
+                                std::vector<vk::GraphicsPipelineDesc> *descsOut) const;
 
     // Issues a new serial for linked shader modules. Used in the pipeline cache.
     Serial issueShaderSerial();
@@ -369,6 +383,19 @@ class RendererVk : angle::NonCopyable
     angle::Result getPipelineCache(PipelineCacheAccess *pipelineCacheOut);
     angle::Result mergeIntoPipelineCache(const vk::PipelineCache &pipelineCache);
 
+    // Window surface depth/stencil sharing, enabled through the
+    // ANGLE_SHARED_DEPTH_STENCIL_BUFFERS environment variable.
+    bool isSharedDepthStencilPoolEnabled() const { return mSharedDepthStencilPoolEnabled; }
+    vk::DepthStencilImagePool &getDepthStencilImagePool() { return mDepthStencilImagePool; }
+
+    // Exportable pbuffer color buffers (EGL_ANGLE_surface_memory_fd), enabled through the
+    // ANGLE_EXPORTABLE_PBUFFER_MEMORY environment variable.
+    bool isExportablePbufferMemoryEnabled() const { return mExportablePbufferMemoryEnabled; }
+
+    // Cut-off below which glBufferSubData updates are coalesced in a CPU shadow
+    // (coalesceSmallBufferUpdates), tunable through ANGLE_SMALL_BUFFER_UPDATE_THRESHOLD.
+    size_t getSmallBufferUpdateThreshold() const { return mSmallBufferUpdateThreshold; }
+
     void onNewValidationMessage(const std::string &message);
     std::string getAndClearLastValidationMessage(uint32_t *countSinceLastClear);
 
@@ -478,6 +505,13 @@ class RendererVk : angle::NonCopyable
     void cleanupCompletedCommandsGarbage();
     void cleanupPendingSubmissionGarbage();
 
+    // Collects garbage whose lifetime has completed in a single mGarbageMutex acquisition; the
+    // collected entries are exclusively owned by the caller and can be destroyed without the lock.
+    void collectCompletedGarbage(
+        Serial lastCompletedQueueSerial,
+        std::vector<vk::SharedGarbage> *garbageOut,
+        std::vector<vk::SharedBufferSuballocationGarbage> *suballocationGarbageOut);
+
     angle::Result submitFrame(vk::Context *context,
                               bool hasProtectedContent,
                               egl::ContextPriority contextPriority,
@@ -634,6 +668,11 @@ class RendererVk : angle::NonCopyable
     angle::Result initPipelineCache(DisplayVk *display,
                                     vk::PipelineCache *pipelineCache,
                                     bool *success);
+    void loadPipelineWarmUpPreload();
+    void writePipelineWarmUpDump();
+    // Fold the per-thread shard caches back into mPipelineCache.  Called with no pipeline cache
+    // locks held.
+    void mergePipelineCacheShards();
 
     template <VkFormatFeatureFlags VkFormatProperties::*features>
     VkFormatFeatureFlags getFormatFeatureBits(angle::FormatID formatID,
@@ -646,6 +685,19 @@ class RendererVk : angle::NonCopyable
     // Initialize VMA allocator and buffer suballocator related data.
     angle::Result initializeMemoryAllocator(DisplayVk *displayVk);
 
+    // Queries the device-local memory budget (through VK_EXT_memory_budget when the driver
+    // exposes it, falling back to the raw heap sizes) and publishes it to the display's
+    // memory budget tracker.
+    void updateMemoryBudget();
+
+    // Persistence of the queried VkFormatProperties across displays and processes, keyed by the
+    // device and driver version.  Returns whether the cache was hit.
+    bool loadCachedFormatProperties(DisplayVk *displayVk);
+    void storeCachedFormatProperties(DisplayVk *displayVk);
+    // On a format-properties cache miss, spread the per-format driver queries over the worker
+    // pool before the (serial) format table resolution runs against the warm cache.
+    void queryFormatPropertiesOnWorkers();
+
     // Query and cache supported fragment shading rates
     bool canSupportFragmentShadingRate(const vk::ExtensionNameList &deviceExtensionNames);
     // Perfer host visiable device local via device local based on device type and heap size.
@@ -659,6 +711,9 @@ class RendererVk : angle::NonCopyable
 
     egl::Display *mDisplay;
 
+    MemoryBudgetTracker *mMemoryBudgetTracker = nullptr;
+    bool mSupportsMemoryBudgetQuery           = false;
+
     void *mLibVulkanLibrary;
 
     mutable bool mCapsInitialized;
@@ -748,6 +803,9 @@ class RendererVk : angle::NonCopyable
     vk::SharedGarbageList mPendingSubmissionGarbage;
     vk::SharedBufferSuballocationGarbageList mSuballocationGarbage;
     vk::SharedBufferSuballocationGarbageList mPendingSubmissionSuballocationGarbage;
+    // Completed garbage is destroyed on a low-priority worker task so the submitting thread only
+    // appends to the lists; these events are waited on before device teardown.
+    std::vector<std::shared_ptr<angle::WaitableEvent>> mGarbageDestroyEvents;
     // Total suballocation garbage size in bytes.
     VkDeviceSize mSuballocationGarbageSizeInBytes;
 
@@ -789,6 +847,41 @@ class RendererVk : angle::NonCopyable
     size_t mPipelineCacheSizeAtLastSync;
     bool mPipelineCacheInitialized;
 
+    // To reduce lock contention when multiple contexts create pipelines concurrently, pipeline
+    // creation is spread over a small set of shard caches selected by thread.  Each shard is
+    // seeded from mPipelineCache (so blob-cache-preloaded data is visible everywhere) and merged
+    // back into it with vkMergePipelineCaches during syncPipelineCacheVk, so serialization still
+    // sees the union of all shards.
+    static constexpr size_t kPipelineCacheShardCount = 4;
+    std::array<std::mutex, kPipelineCacheShardCount> mPipelineCacheShardMutexes;
+    std::array<vk::PipelineCache, kPipelineCacheShardCount> mPipelineCacheShards;
+    bool mPipelineCacheShardsInitialized = false;
+
+    // Depth/stencil images shared between window surfaces (see vk::DepthStencilImagePool).
+    bool mSharedDepthStencilPoolEnabled;
+    vk::DepthStencilImagePool mDepthStencilImagePool;
+
+    // Whether pbuffer color buffers are allocated with exportable external memory.
+    bool mExportablePbufferMemoryEnabled;
+
+    // Size threshold for coalescing small buffer updates.
+    size_t mSmallBufferUpdateThreshold;
+
+    // Warm-start pipeline state preload.  When ANGLE_PIPELINE_WARMUP_DUMP_FILE is set, the
+    // pipeline states created for draw calls are recorded (tagged with a hash of the program's
+    // SPIR-V) and written out at renderer destruction.  When ANGLE_PIPELINE_WARMUP_FILE names such
+    // a capture, link-time warm up additionally compiles the states each program was actually
+    // drawn with, instead of only the default-state guess.
+    struct PipelineWarmUpEntry
+    {
+        uint64_t programHash;
+        vk::GraphicsPipelineDesc desc;
+    };
+    std::vector<PipelineWarmUpEntry> mPipelineWarmUpPreload;
+    std::string mPipelineWarmUpDumpFile;
+    std::mutex mPipelineWarmUpDumpMutex;
+    std::vector<PipelineWarmUpEntry> mPipelineWarmUpDump;
+
     // Latest validation data for debug overlay.
     std::string mLastValidationMessage;
     uint32_t mValidationMessageCount;
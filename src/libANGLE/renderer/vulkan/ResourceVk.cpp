@@ -153,19 +153,24 @@ SharedGarbage &SharedGarbage::operator=(SharedGarbage &&rhs)
 
 bool SharedGarbage::destroyIfComplete(RendererVk *renderer, Serial completedSerial)
 {
-    if (mLifetime.isCurrentlyInUse(completedSerial))
+    if (isCurrentlyInUse(completedSerial))
     {
         return false;
     }
 
+    destroy(renderer);
+
+    return true;
+}
+
+void SharedGarbage::destroy(RendererVk *renderer)
+{
     for (GarbageObject &object : mGarbage)
     {
         object.destroy(renderer);
     }
 
     mLifetime.release();
-
-    return true;
 }
 
 // ResourceUseList implementation.
@@ -170,6 +170,12 @@ class SharedGarbage
 
     bool destroyIfComplete(RendererVk *renderer, Serial completedSerial);
     bool usedInRecordedCommands() const { return mLifetime.usedInRecordedCommands(); }
+    bool isCurrentlyInUse(Serial completedSerial) const
+    {
+        return mLifetime.isCurrentlyInUse(completedSerial);
+    }
+    // Unconditional destruction; the caller has already checked isCurrentlyInUse.
+    void destroy(RendererVk *renderer);
 
   private:
     SharedResourceUse mLifetime;
@@ -358,8 +358,11 @@ void SecondaryCommandBuffer::executeCommands(PrimaryCommandBuffer *primary)
                 case CommandID::CopyImage:
                 {
                     const CopyImageParams *params = getParamPtr<CopyImageParams>(currentCommand);
+                    const VkImageCopy *regions =
+                        Offset<VkImageCopy>(params, sizeof(CopyImageParams));
                     vkCmdCopyImage(cmdBuffer, params->srcImage, params->srcImageLayout,
-                                   params->dstImage, params->dstImageLayout, 1, &params->region);
+                                   params->dstImage, params->dstImageLayout, params->regionCount,
+                                   regions);
                     break;
                 }
                 case CommandID::CopyImageToBuffer:
@@ -224,7 +224,7 @@ struct CopyImageParams
     VkImageLayout srcImageLayout;
     VkImage dstImage;
     VkImageLayout dstImageLayout;
-    VkImageCopy region;
+    uint32_t regionCount;
 };
 VERIFY_4_BYTE_ALIGNMENT(CopyImageParams)
 
@@ -722,6 +722,12 @@ class SecondaryCommandBuffer final : angle::NonCopyable
                    VkImageLayout dstImageLayout,
                    uint32_t regionCount,
                    const VkImageCopy *regions);
+    void copyImage(VkImage srcImage,
+                   VkImageLayout srcImageLayout,
+                   VkImage dstImage,
+                   VkImageLayout dstImageLayout,
+                   uint32_t regionCount,
+                   const VkImageCopy *regions);
 
     void copyImageToBuffer(const Image &srcImage,
                            VkImageLayout srcImageLayout,
@@ -1307,13 +1313,28 @@ ANGLE_INLINE void SecondaryCommandBuffer::copyImage(const Image &srcImage,
                                                     uint32_t regionCount,
                                                     const VkImageCopy *regions)
 {
-    ASSERT(regionCount == 1);
-    CopyImageParams *paramStruct = initCommand<CopyImageParams>(CommandID::CopyImage);
-    paramStruct->srcImage        = srcImage.getHandle();
-    paramStruct->srcImageLayout  = srcImageLayout;
-    paramStruct->dstImage        = dstImage.getHandle();
-    paramStruct->dstImageLayout  = dstImageLayout;
-    paramStruct->region          = regions[0];
+    copyImage(srcImage.getHandle(), srcImageLayout, dstImage.getHandle(), dstImageLayout,
+              regionCount, regions);
+}
+
+ANGLE_INLINE void SecondaryCommandBuffer::copyImage(VkImage srcImage,
+                                                    VkImageLayout srcImageLayout,
+                                                    VkImage dstImage,
+                                                    VkImageLayout dstImageLayout,
+                                                    uint32_t regionCount,
+                                                    const VkImageCopy *regions)
+{
+    uint8_t *writePtr;
+    size_t regionSize = regionCount * sizeof(VkImageCopy);
+    CopyImageParams *paramStruct =
+        initCommand<CopyImageParams>(CommandID::CopyImage, regionSize, &writePtr);
+    paramStruct->srcImage       = srcImage;
+    paramStruct->srcImageLayout = srcImageLayout;
+    paramStruct->dstImage       = dstImage;
+    paramStruct->dstImageLayout = dstImageLayout;
+    paramStruct->regionCount    = regionCount;
+    // Copy variable sized data
+    storePointerParameter(writePtr, regions, regionSize);
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::copyImageToBuffer(const Image &srcImage,
@@ -150,15 +150,20 @@ VkResult BufferSuballocation::map(Context *context)
 bool SharedBufferSuballocationGarbage::destroyIfComplete(RendererVk *renderer,
                                                          Serial completedSerial)
 {
-    if (mLifetime.isCurrentlyInUse(completedSerial))
+    if (isCurrentlyInUse(completedSerial))
     {
         return false;
     }
 
+    destroy(renderer);
+    return true;
+}
+
+void SharedBufferSuballocationGarbage::destroy(RendererVk *renderer)
+{
     mBuffer.destroy(renderer->getDevice());
     mSuballocation.destroy(renderer);
     mLifetime.release();
-    return true;
 }
 }  // namespace vk
 }  // namespace rx
@@ -176,6 +176,12 @@ class SharedBufferSuballocationGarbage
 
     bool destroyIfComplete(RendererVk *renderer, Serial completedSerial);
     bool usedInRecordedCommands() const { return mLifetime.usedInRecordedCommands(); }
+    bool isCurrentlyInUse(Serial completedSerial) const
+    {
+        return mLifetime.isCurrentlyInUse(completedSerial);
+    }
+    // Unconditional destruction; the caller has already checked isCurrentlyInUse.
+    void destroy(RendererVk *renderer);
     VkDeviceSize getSize() const { return mSuballocation.getSize(); }
     bool isSuballocated() const { return mSuballocation.isSuballocated(); }
 
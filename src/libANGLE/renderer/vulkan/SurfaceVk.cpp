@@ -10,6 +10,7 @@
 #include "libANGLE/renderer/vulkan/SurfaceVk.h"
 
 #include "common/debug.h"
+#include "common/system_utils.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
 #include "libANGLE/Overlay.h"
@@ -34,6 +35,39 @@ angle::SubjectIndex kAnySurfaceImageSubjectIndex = 0;
 // swapchain's extent. See VkSurfaceCapabilitiesKHR spec for more details.
 constexpr uint32_t kSurfaceSizedBySwapchain = 0xFFFFFFFFu;
 
+// Runs vkAcquireNextImageKHR on a worker thread so that waiting for the presentation engine to
+// release an image overlaps with application logic instead of stalling the first draw after swap.
+// The result and image index are read by the GL thread only after waiting on the task's event.
+class AcquireNextImageTask : public angle::Closure
+{
+  public:
+    AcquireNextImageTask(VkDevice device,
+                         VkSwapchainKHR swapchain,
+                         VkSemaphore semaphore,
+                         VkResult *resultOut,
+                         uint32_t *imageIndexOut)
+        : mDevice(device),
+          mSwapchain(swapchain),
+          mSemaphore(semaphore),
+          mResultOut(resultOut),
+          mImageIndexOut(imageIndexOut)
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "AcquireNextImageTask");
+        *mResultOut = vkAcquireNextImageKHR(mDevice, mSwapchain, UINT64_MAX, mSemaphore,
+                                            VK_NULL_HANDLE, mImageIndexOut);
+    }
+
+  private:
+    VkDevice mDevice;
+    VkSwapchainKHR mSwapchain;
+    VkSemaphore mSemaphore;
+    VkResult *mResultOut;
+    uint32_t *mImageIndexOut;
+};
+
 GLint GetSampleCount(const egl::Config *config)
 {
     GLint samples = 1;
@@ -138,6 +172,7 @@ angle::Result InitImageHelper(DisplayVk *displayVk,
                               GLint samples,
                               bool isRobustResourceInitEnabled,
                               bool hasProtectedContent,
+                              const void *externalImageCreateInfo,
                               vk::ImageHelper *imageHelper)
 {
     const angle::Format &textureFormat = vkFormat.getActualRenderableImageFormat();
@@ -165,10 +200,11 @@ angle::Result InitImageHelper(DisplayVk *displayVk,
 
     VkImageCreateFlags imageCreateFlags =
         hasProtectedContent ? VK_IMAGE_CREATE_PROTECTED_BIT : vk::kVkImageCreateFlagsNone;
-    ANGLE_TRY(imageHelper->initExternal(
-        displayVk, gl::TextureType::_2D, extents, vkFormat.getIntendedFormatID(),
-        renderableFormatId, samples, usage, imageCreateFlags, vk::ImageLayout::Undefined, nullptr,
-        gl::LevelIndex(0), 1, 1, isRobustResourceInitEnabled, hasProtectedContent));
+    ANGLE_TRY(imageHelper->initExternal(displayVk, gl::TextureType::_2D, extents,
+                                        vkFormat.getIntendedFormatID(), renderableFormatId, samples,
+                                        usage, imageCreateFlags, vk::ImageLayout::Undefined,
+                                        externalImageCreateInfo, gl::LevelIndex(0), 1, 1,
+                                        isRobustResourceInitEnabled, hasProtectedContent));
 
     return angle::Result::Continue;
 }
@@ -405,10 +441,21 @@ angle::Result OffscreenSurfaceVk::AttachmentImage::initialize(DisplayVk *display
                                                               const vk::Format &vkFormat,
                                                               GLint samples,
                                                               bool isRobustResourceInitEnabled,
-                                                              bool hasProtectedContent)
+                                                              bool hasProtectedContent,
+                                                              bool isExportable)
 {
+    VkExternalMemoryImageCreateInfo externalMemoryImageCreateInfo = {};
+    const void *externalImageCreateInfo                           = nullptr;
+    if (isExportable)
+    {
+        externalMemoryImageCreateInfo.sType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO;
+        externalMemoryImageCreateInfo.handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT;
+        externalImageCreateInfo                   = &externalMemoryImageCreateInfo;
+    }
+
     ANGLE_TRY(InitImageHelper(displayVk, width, height, vkFormat, samples,
-                              isRobustResourceInitEnabled, hasProtectedContent, &image));
+                              isRobustResourceInitEnabled, hasProtectedContent,
+                              externalImageCreateInfo, &image));
 
     RendererVk *renderer        = displayVk->getRenderer();
     VkMemoryPropertyFlags flags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
@@ -416,8 +463,28 @@ angle::Result OffscreenSurfaceVk::AttachmentImage::initialize(DisplayVk *display
     {
         flags |= VK_MEMORY_PROPERTY_PROTECTED_BIT;
     }
-    ANGLE_TRY(
-        image.initMemory(displayVk, hasProtectedContent, renderer->getMemoryProperties(), flags));
+
+    if (isExportable)
+    {
+        // Exported memory must be a dedicated, non-suballocated allocation so a consumer process
+        // can import exactly this image's storage through vkGetMemoryFdKHR.
+        VkMemoryRequirements memoryRequirements;
+        image.getImage().getMemoryRequirements(renderer->getDevice(), &memoryRequirements);
+
+        VkExportMemoryAllocateInfo exportMemoryAllocateInfo = {};
+        exportMemoryAllocateInfo.sType       = VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO;
+        exportMemoryAllocateInfo.handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT;
+        const void *extraAllocationInfo      = &exportMemoryAllocateInfo;
+
+        ANGLE_TRY(image.initExternalMemory(displayVk, renderer->getMemoryProperties(),
+                                           memoryRequirements, 1, &extraAllocationInfo,
+                                           renderer->getQueueFamilyIndex(), flags));
+    }
+    else
+    {
+        ANGLE_TRY(image.initMemory(displayVk, hasProtectedContent, renderer->getMemoryProperties(),
+                                   flags));
+    }
 
     imageViews.init(renderer);
 
@@ -439,7 +506,9 @@ OffscreenSurfaceVk::OffscreenSurfaceVk(const egl::SurfaceState &surfaceState, Re
       mWidth(mState.attributes.getAsInt(EGL_WIDTH, 0)),
       mHeight(mState.attributes.getAsInt(EGL_HEIGHT, 0)),
       mColorAttachment(this),
-      mDepthStencilAttachment(this)
+      mDepthStencilAttachment(this),
+      mRenderer(renderer),
+      mColorImageMemoryExportable(false)
 {
     mColorRenderTarget.init(&mColorAttachment.image, &mColorAttachment.imageViews, nullptr, nullptr,
                             gl::LevelIndex(0), 0, 1, RenderTargetTransience::Default);
@@ -469,11 +538,17 @@ angle::Result OffscreenSurfaceVk::initializeImpl(DisplayVk *displayVk)
 
     bool robustInit = mState.isRobustResourceInitEnabled();
 
+    // EGL_ANGLE_surface_memory_fd: multisampled and protected color buffers cannot be handed to
+    // an external consumer, so only single-sampled unprotected pbuffers allocate exportably.
+    mColorImageMemoryExportable = renderer->isExportablePbufferMemoryEnabled() &&
+                                  config->renderTargetFormat != GL_NONE && samples == 1 &&
+                                  !mState.hasProtectedContent();
+
     if (config->renderTargetFormat != GL_NONE)
     {
-        ANGLE_TRY(mColorAttachment.initialize(displayVk, mWidth, mHeight,
-                                              renderer->getFormat(config->renderTargetFormat),
-                                              samples, robustInit, mState.hasProtectedContent()));
+        ANGLE_TRY(mColorAttachment.initialize(
+            displayVk, mWidth, mHeight, renderer->getFormat(config->renderTargetFormat), samples,
+            robustInit, mState.hasProtectedContent(), mColorImageMemoryExportable));
         mColorRenderTarget.init(&mColorAttachment.image, &mColorAttachment.imageViews, nullptr,
                                 nullptr, gl::LevelIndex(0), 0, 1, RenderTargetTransience::Default);
     }
@@ -482,7 +557,7 @@ angle::Result OffscreenSurfaceVk::initializeImpl(DisplayVk *displayVk)
     {
         ANGLE_TRY(mDepthStencilAttachment.initialize(
             displayVk, mWidth, mHeight, renderer->getFormat(config->depthStencilFormat), samples,
-            robustInit, mState.hasProtectedContent()));
+            robustInit, mState.hasProtectedContent(), false));
         mDepthStencilRenderTarget.init(&mDepthStencilAttachment.image,
                                        &mDepthStencilAttachment.imageViews, nullptr, nullptr,
                                        gl::LevelIndex(0), 0, 1, RenderTargetTransience::Default);
@@ -519,10 +594,31 @@ egl::Error OffscreenSurfaceVk::postSubBuffer(const gl::Context * /*context*/,
     return egl::NoError();
 }
 
-egl::Error OffscreenSurfaceVk::querySurfacePointerANGLE(EGLint /*attribute*/, void ** /*value*/)
+egl::Error OffscreenSurfaceVk::querySurfacePointerANGLE(EGLint attribute, void **value)
 {
-    UNREACHABLE();
-    return egl::EglBadCurrentSurface();
+    if (attribute == EGL_SURFACE_MEMORY_FD_ANGLE && mColorImageMemoryExportable)
+    {
+        // Every query exports a fresh opaque file descriptor referencing the color buffer's
+        // memory; the caller assumes ownership of the descriptor.
+        VkMemoryGetFdInfoKHR getFdInfo = {};
+        getFdInfo.sType                = VK_STRUCTURE_TYPE_MEMORY_GET_FD_INFO_KHR;
+        getFdInfo.memory               = mColorAttachment.image.getDeviceMemory().getHandle();
+        getFdInfo.handleType           = VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT;
+
+        int fd = -1;
+        if (vkGetMemoryFdKHR(mRenderer->getDevice(), &getFdInfo, &fd) != VK_SUCCESS)
+        {
+            *value = nullptr;
+            return egl::EglBadAccess();
+        }
+
+        *value = reinterpret_cast<void *>(static_cast<intptr_t>(fd));
+        return egl::NoError();
+    }
+
+    // Frame profiling only applies to window surfaces, which present.
+    *value = nullptr;
+    return egl::EglBadAttribute();
 }
 
 egl::Error OffscreenSurfaceVk::bindTexImage(const gl::Context * /*context*/,
@@ -724,11 +820,18 @@ WindowSurfaceVk::WindowSurfaceVk(const egl::SurfaceState &surfaceState, EGLNativ
       mDesiredSwapchainPresentMode(vk::PresentMode::FifoKHR),
       mMinImageCount(0),
       mPreTransform(VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR),
+      mSwapchainPreTransform(VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR),
       mEmulatedPreTransform(VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR),
       mCompositeAlpha(VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR),
       mCurrentSwapchainImageIndex(0),
       mAcquireImageSemaphore(nullptr),
+      mPreAcquireResult(VK_NOT_READY),
+      mPreAcquireImageIndex(0),
       mDepthStencilImageBinding(this, kAnySurfaceImageSubjectIndex),
+      mDepthStencilExtents{},
+      mDepthStencilSamples(1),
+      mDepthStencilRobustInit(false),
+      mDepthStencilLastImageHandle(VK_NULL_HANDLE),
       mColorImageMSBinding(this, kAnySurfaceImageSubjectIndex),
       mNeedToAcquireNextSwapchainImage(false),
       mFrameCount(1),
@@ -738,9 +841,8 @@ WindowSurfaceVk::WindowSurfaceVk(const egl::SurfaceState &surfaceState, EGLNativ
     // render target will be updated to refer to a swapchain image on every acquire.
     mColorRenderTarget.init(&mColorImageMS, &mColorImageMSViews, nullptr, nullptr,
                             gl::LevelIndex(0), 0, 1, RenderTargetTransience::Default);
-    mDepthStencilRenderTarget.init(&mDepthStencilImage, &mDepthStencilImageViews, nullptr, nullptr,
-                                   gl::LevelIndex(0), 0, 1, RenderTargetTransience::Default);
-    mDepthStencilImageBinding.bind(&mDepthStencilImage);
+    // The depth/stencil render target and observer binding are initialized in
+    // ensureDepthStencilImage() when the depth/stencil image is created or taken from the pool.
     mColorImageMSBinding.bind(&mColorImageMS);
 }
 
@@ -760,6 +862,11 @@ void WindowSurfaceVk::destroy(const egl::Display *display)
     // flush the pipe.
     (void)renderer->finish(displayVk, mState.hasProtectedContent());
 
+    // If a worker-thread acquire is in flight, make sure it is no longer touching the swapchain.
+    // Its result is abandoned; the signaled acquire semaphore is destroyed below.
+    waitForPreAcquire();
+    mPreAcquireEvent.reset();
+
     if (mLockBufferHelper.valid())
     {
         mLockBufferHelper.destroy(renderer);
@@ -791,6 +898,13 @@ void WindowSurfaceVk::destroy(const egl::Display *display)
 
     mPresentSemaphoreRecycler.destroy(device);
 
+    for (PendingFrameProfileTimestamp &pending : mFrameProfilePendingTimestamps)
+    {
+        pending.query.deinit();
+    }
+    mFrameProfilePendingTimestamps.clear();
+    mFrameProfileTimestampQueryPool.destroy(device);
+
     // Call parent class to destroy any resources parent owns.
     SurfaceVk::destroy(display);
 }
@@ -814,7 +928,6 @@ angle::Result WindowSurfaceVk::initializeImpl(DisplayVk *displayVk)
     RendererVk *renderer = displayVk->getRenderer();
 
     mColorImageMSViews.init(renderer);
-    mDepthStencilImageViews.init(renderer);
 
     renderer->reloadVolkIfNeeded();
 
@@ -1069,6 +1182,15 @@ angle::Result WindowSurfaceVk::recreateSwapchain(ContextVk *contextVk, const gl:
     // Otherwise, keep the current swapchain as the old swapchain to be scheduled for destruction
     // and create a new one.
 
+    // Render passes are extent-independent and pipelines use dynamic viewport/scissor state, so
+    // both survive recreation through their caches.  If the swapchain is additionally recreated
+    // with the same extent and transform (a present mode change, or an out-of-date/suboptimal
+    // result without an actual resize), the multisampled color and depth/stencil images remain
+    // compatible too; retain them and recreate only the swapchain image views and framebuffers.
+    const bool retainCompatibleImages = extents.width == getWidth() &&
+                                        extents.height == getHeight() &&
+                                        mPreTransform == mSwapchainPreTransform;
+
     VkSwapchainKHR swapchainToDestroy = VK_NULL_HANDLE;
 
     if (!mOldSwapchains.empty())
@@ -1136,7 +1258,7 @@ angle::Result WindowSurfaceVk::recreateSwapchain(ContextVk *contextVk, const gl:
     VkSwapchainKHR lastSwapchain = mSwapchain;
     mSwapchain                   = VK_NULL_HANDLE;
 
-    releaseSwapchainImages(contextVk);
+    releaseSwapchainImages(contextVk, retainCompatibleImages);
 
     // If prerotation is emulated, adjust the window extents to match what real prerotation would
     // have reported.
@@ -1301,8 +1423,9 @@ angle::Result WindowSurfaceVk::createSwapChain(vk::Context *context,
     // swapchain need to carry over to the new one.  http://anglebug.com/2942
     VkSwapchainKHR newSwapChain = VK_NULL_HANDLE;
     ANGLE_VK_TRY(context, vkCreateSwapchainKHR(device, &swapchainInfo, nullptr, &newSwapChain));
-    mSwapchain            = newSwapChain;
-    mSwapchainPresentMode = mDesiredSwapchainPresentMode;
+    mSwapchain             = newSwapChain;
+    mSwapchainPresentMode  = mDesiredSwapchainPresentMode;
+    mSwapchainPreTransform = mPreTransform;
 
     // If frame timestamp was enabled for the surface, [re]enable it when [re]creating the swapchain
     if (renderer->getFeatures().supportsTimestampSurfaceAttribute.enabled &&
@@ -1346,12 +1469,19 @@ angle::Result WindowSurfaceVk::createSwapChain(vk::Context *context,
         // the resolve.  The ImageHelper::mExtents will have non-rotated extents in order to fit
         // with the rest of ANGLE, (e.g. which calculates the Vulkan scissor with non-rotated
         // values and then rotates the final rectangle).
-        ANGLE_TRY(mColorImageMS.initMSAASwapchain(
-            context, gl::TextureType::_2D, vkExtents, Is90DegreeRotation(getPreTransform()), format,
-            samples, usage, gl::LevelIndex(0), 1, 1, robustInit, mState.hasProtectedContent()));
-        ANGLE_TRY(mColorImageMS.initMemory(context, mState.hasProtectedContent(),
-                                           renderer->getMemoryProperties(),
-                                           VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT));
+        //
+        // The image may have been retained across a size-compatible swapchain recreation, in
+        // which case it is reused as is.
+        if (!mColorImageMS.valid())
+        {
+            ANGLE_TRY(mColorImageMS.initMSAASwapchain(context, gl::TextureType::_2D, vkExtents,
+                                                      Is90DegreeRotation(getPreTransform()), format,
+                                                      samples, usage, gl::LevelIndex(0), 1, 1,
+                                                      robustInit, mState.hasProtectedContent()));
+            ANGLE_TRY(mColorImageMS.initMemory(context, mState.hasProtectedContent(),
+                                               renderer->getMemoryProperties(),
+                                               VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT));
+        }
 
         // Initialize the color render target with the multisampled targets.  If not multisampled,
         // the render target will be updated to refer to a swapchain image on every acquire.
@@ -1375,27 +1505,81 @@ angle::Result WindowSurfaceVk::createSwapChain(vk::Context *context,
     // Initialize depth/stencil if requested.
     if (mState.config->depthStencilFormat != GL_NONE)
     {
-        const vk::Format &dsFormat = renderer->getFormat(mState.config->depthStencilFormat);
+        ANGLE_TRY(ensureDepthStencilImage(context, vkExtents, samples, robustInit));
+    }
 
-        const VkImageUsageFlags dsUsage = kSurfaceVkDepthStencilImageUsageFlags;
+    return angle::Result::Continue;
+}
 
-        ANGLE_TRY(mDepthStencilImage.init(context, gl::TextureType::_2D, vkExtents, dsFormat,
-                                          samples, dsUsage, gl::LevelIndex(0), 1, 1, robustInit,
-                                          mState.hasProtectedContent()));
-        ANGLE_TRY(mDepthStencilImage.initMemory(context, mState.hasProtectedContent(),
-                                                renderer->getMemoryProperties(),
-                                                VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT));
+angle::Result WindowSurfaceVk::ensureDepthStencilImage(vk::Context *context,
+                                                       const VkExtent3D &extents,
+                                                       GLint samples,
+                                                       bool robustInit)
+{
+    RendererVk *renderer       = context->getRenderer();
+    const vk::Format &dsFormat = renderer->getFormat(mState.config->depthStencilFormat);
 
-        mDepthStencilRenderTarget.init(&mDepthStencilImage, &mDepthStencilImageViews, nullptr,
-                                       nullptr, gl::LevelIndex(0), 0, 1,
-                                       RenderTargetTransience::Default);
+    // The entry may have been retained across a size-compatible swapchain recreation, in which
+    // case the image is reused as is.
+    if (mDepthStencilEntry)
+    {
+        ASSERT(mDepthStencilEntry->image.valid());
+        ASSERT(mDepthStencilSamples == samples && mDepthStencilRobustInit == robustInit);
+    }
+    else if (renderer->isSharedDepthStencilPoolEnabled())
+    {
+        mDepthStencilEntry = renderer->getDepthStencilImagePool().acquire(
+            renderer, this, extents, dsFormat.getActualRenderableImageFormatID(), samples,
+            mState.hasProtectedContent());
+    }
+
+    if (!mDepthStencilEntry)
+    {
+        mDepthStencilEntry = std::make_unique<vk::DepthStencilImagePool::Entry>();
+        mDepthStencilEntry->hasProtectedContent = mState.hasProtectedContent();
+        mDepthStencilEntry->imageViews.init(renderer);
+
+        const VkImageUsageFlags dsUsage = kSurfaceVkDepthStencilImageUsageFlags;
 
-        // We will need to pass depth/stencil image views to the RenderTargetVk in the future.
+        ANGLE_TRY(mDepthStencilEntry->image.init(context, gl::TextureType::_2D, extents, dsFormat,
+                                                 samples, dsUsage, gl::LevelIndex(0), 1, 1,
+                                                 robustInit, mState.hasProtectedContent()));
+        ANGLE_TRY(mDepthStencilEntry->image.initMemory(context, mState.hasProtectedContent(),
+                                                       renderer->getMemoryProperties(),
+                                                       VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT));
     }
 
+    mDepthStencilSamples    = samples;
+    mDepthStencilRobustInit = robustInit;
+
+    mDepthStencilRenderTarget.init(&mDepthStencilEntry->image, &mDepthStencilEntry->imageViews,
+                                   nullptr, nullptr, gl::LevelIndex(0), 0, 1,
+                                   RenderTargetTransience::Default);
+    mDepthStencilImageBinding.bind(&mDepthStencilEntry->image);
+
+    // We will need to pass depth/stencil image views to the RenderTargetVk in the future.
+
     return angle::Result::Continue;
 }
 
+bool WindowSurfaceVk::getDamageRegionBounds(gl::Rectangle *boundsOut) const
+{
+    const std::vector<gl::Rectangle> &damageRegion = mState.damageRegion;
+    if (damageRegion.empty())
+    {
+        return false;
+    }
+
+    gl::Rectangle bounds = damageRegion[0];
+    for (size_t index = 1; index < damageRegion.size(); ++index)
+    {
+        gl::GetEnclosingRectangle(bounds, damageRegion[index], &bounds);
+    }
+
+    *boundsOut = bounds;
+    return true;
+}
+
 bool WindowSurfaceVk::isMultiSampled() const
 {
     return mColorImageMS.valid();
@@ -1458,6 +1642,10 @@ angle::Result WindowSurfaceVk::checkForOutOfDateSwapchain(ContextVk *contextVk,
         return angle::Result::Continue;
     }
 
+    // The swapchain is about to be replaced; abandon any acquire that was kicked off on a worker
+    // thread against it.
+    ANGLE_TRY(discardPreAcquiredImage(contextVk));
+
     gl::Extents newSwapchainExtents(mSurfaceCaps.currentExtent.width,
                                     mSurfaceCaps.currentExtent.height, 1);
 
@@ -1470,26 +1658,45 @@ angle::Result WindowSurfaceVk::checkForOutOfDateSwapchain(ContextVk *contextVk,
     return recreateSwapchain(contextVk, newSwapchainExtents);
 }
 
-void WindowSurfaceVk::releaseSwapchainImages(ContextVk *contextVk)
+void WindowSurfaceVk::releaseSwapchainImages(ContextVk *contextVk, bool retainCompatibleImages)
 {
     RendererVk *renderer = contextVk->getRenderer();
 
     mColorRenderTarget.release(contextVk);
     mDepthStencilRenderTarget.release(contextVk);
 
-    if (mDepthStencilImage.valid())
+    if (mDepthStencilEntry && !retainCompatibleImages)
     {
-        mDepthStencilImage.collectViewGarbage(renderer, &mDepthStencilImageViews);
-        mDepthStencilImage.releaseImageFromShareContexts(renderer, contextVk);
-        mDepthStencilImage.releaseStagedUpdates(renderer);
+        mDepthStencilImageBinding.bind(nullptr);
+        mDepthStencilEntry->image.releaseStagedUpdates(renderer);
+        if (renderer->isSharedDepthStencilPoolEnabled())
+        {
+            // The swapchain (and thus possibly the surface size) is being recreated; return the
+            // image to the pool for other surfaces instead of destroying it.
+            renderer->getDepthStencilImagePool().recycle(renderer, this,
+                                                         std::move(mDepthStencilEntry));
+        }
+        else
+        {
+            mDepthStencilEntry->image.collectViewGarbage(renderer,
+                                                         &mDepthStencilEntry->imageViews);
+            mDepthStencilEntry->image.releaseImageFromShareContexts(renderer, contextVk);
+            mDepthStencilEntry.reset();
+        }
     }
 
     if (mColorImageMS.valid())
     {
-        mColorImageMS.collectViewGarbage(renderer, &mColorImageMSViews);
-        mColorImageMS.releaseImageFromShareContexts(renderer, contextVk);
-        mColorImageMS.releaseStagedUpdates(renderer);
+        // The resolve framebuffer references the swapchain image views, so it cannot outlive the
+        // swapchain even when the multisampled image itself is retained.
         contextVk->addGarbage(&mFramebufferMS);
+
+        if (!retainCompatibleImages)
+        {
+            mColorImageMS.collectViewGarbage(renderer, &mColorImageMSViews);
+            mColorImageMS.releaseImageFromShareContexts(renderer, contextVk);
+            mColorImageMS.releaseStagedUpdates(renderer);
+        }
     }
 
     mSwapchainImageBindings.clear();
@@ -1528,8 +1735,13 @@ void WindowSurfaceVk::destroySwapChainImages(DisplayVk *displayVk)
     RendererVk *renderer = displayVk->getRenderer();
     VkDevice device      = displayVk->getDevice();
 
-    mDepthStencilImage.destroy(renderer);
-    mDepthStencilImageViews.destroy(device);
+    if (mDepthStencilEntry)
+    {
+        mDepthStencilImageBinding.bind(nullptr);
+        mDepthStencilEntry->image.destroy(renderer);
+        mDepthStencilEntry->imageViews.destroy(device);
+        mDepthStencilEntry.reset();
+    }
     mColorImageMS.destroy(renderer);
     mColorImageMSViews.destroy(device);
     mFramebufferMS.destroy(device);
@@ -1657,13 +1869,24 @@ angle::Result WindowSurfaceVk::present(ContextVk *contextVk,
     ANGLE_TRACE_EVENT0("gpu.angle", "WindowSurfaceVk::present");
     RendererVk *renderer = contextVk->getRenderer();
 
+    // If a worker-thread acquire is still in flight (the frame was swapped without its swapchain
+    // image ever being accessed), wait for it to finish: the swapchain must be externally
+    // synchronized between vkAcquireNextImageKHR and vkQueuePresentKHR.  The result stays
+    // available for the next acquireNextSwapchainImage().
+    waitForPreAcquire();
+
     // Throttle the submissions to avoid getting too far ahead of the GPU.
     Serial *swapSerial = &mSwapHistory.front();
     mSwapHistory.next();
 
     {
         ANGLE_TRACE_EVENT0("gpu.angle", "WindowSurfaceVk::present: Throttle CPU");
+        const double throttleStart = mFrameProfileEnabled ? angle::GetCurrentSystemTime() : 0.0;
         ANGLE_TRY(renderer->finishToSerial(contextVk, *swapSerial));
+        if (mFrameProfileEnabled)
+        {
+            mFrameProfileThrottleWaitSeconds += angle::GetCurrentSystemTime() - throttleStart;
+        }
     }
 
     SwapchainImage &image               = mSwapchainImages[mCurrentSwapchainImageIndex];
@@ -1745,6 +1968,11 @@ angle::Result WindowSurfaceVk::present(ContextVk *contextVk,
     // present can be destroyed.
     presentHistory.oldSwapchains = std::move(mOldSwapchains);
 
+    if (mFrameProfileEnabled)
+    {
+        ANGLE_TRY(writeFrameProfileTimestamp(contextVk));
+    }
+
     // The overlay is drawn after this.  This ensures that drawing the overlay does not interfere
     // with other functionality, especially counters used to validate said functionality.
     const bool shouldDrawOverlay = overlayHasEnabledWidget(contextVk);
@@ -1760,6 +1988,10 @@ angle::Result WindowSurfaceVk::present(ContextVk *contextVk,
                                                RenderPassClosureReason::AlreadySpecifiedElsewhere));
     }
 
+    contextVk->updateTelemetryCountersOnPresent();
+    ANGLE_TRY(contextVk->prepareDescriptorPoolsForNextFrame());
+    contextVk->ageSamplerStabilityOnPresent();
+
     VkPresentInfoKHR presentInfo   = {};
     presentInfo.sType              = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
     presentInfo.pNext              = pNextChain;
@@ -1799,13 +2031,28 @@ angle::Result WindowSurfaceVk::present(ContextVk *contextVk,
 
     ASSERT(mAcquireImageSemaphore == nullptr);
 
+    const double presentStart = mFrameProfileEnabled ? angle::GetCurrentSystemTime() : 0.0;
     VkResult result = renderer->queuePresent(contextVk, contextVk->getPriority(), presentInfo);
+    if (mFrameProfileEnabled)
+    {
+        mFrameProfilePresentCallSeconds = angle::GetCurrentSystemTime() - presentStart;
+    }
 
     // Set FrameNumber for the presented image.
     mSwapchainImages[mCurrentSwapchainImageIndex].mFrameNumber = mFrameCount++;
 
     ANGLE_TRY(computePresentOutOfDate(contextVk, result, presentOutOfDate));
 
+    if (mFrameProfileEnabled)
+    {
+        ANGLE_TRY(recordFrameProfile(contextVk));
+    }
+
+    if (mRenderPassClosureCountsEnabled)
+    {
+        contextVk->writeRenderPassClosureCounts(&mRenderPassClosureCounts);
+    }
+
     contextVk->resetPerFramePerfCounters();
 
     return angle::Result::Continue;
@@ -1823,10 +2070,23 @@ angle::Result WindowSurfaceVk::swapImpl(const gl::Context *context,
     bool presentOutOfDate = false;
     ANGLE_TRY(present(contextVk, rects, n_rects, pNextChain, &presentOutOfDate));
 
+    // With display-wide depth/stencil sharing, return the depth/stencil image to the pool while
+    // the frame is in flight; it is taken back (or substituted with another surface's idle image)
+    // when the next frame's swapchain image is acquired.  The contents are invalidated on every
+    // swap anyway.  Shared present mode has no meaningful frame boundary, so it keeps its image.
+    if (mDepthStencilEntry && !isSharedPresentMode() &&
+        contextVk->getRenderer()->isSharedDepthStencilPoolEnabled())
+    {
+        releaseDepthStencilToPool(contextVk);
+    }
+
     if (!presentOutOfDate)
     {
         // Defer acquiring the next swapchain image since the swapchain is not out-of-date.
         deferAcquireNextImage();
+        // Overlap the acquire with application logic by kicking it off on a worker thread; the
+        // deferred acquire consumes its result when the image is first needed.
+        preAcquireNextImageOnWorker(contextVk);
     }
     else
     {
@@ -1873,6 +2133,135 @@ void WindowSurfaceVk::deferAcquireNextImage()
     onStateChange(angle::SubjectMessage::SwapchainImageChanged);
 }
 
+void WindowSurfaceVk::releaseDepthStencilToPool(ContextVk *contextVk)
+{
+    RendererVk *renderer = contextVk->getRenderer();
+
+    ASSERT(renderer->isSharedDepthStencilPoolEnabled());
+    ASSERT(mDepthStencilEntry);
+
+    // Remember what to ask the pool for (and which image the cached framebuffers were created
+    // with) when the image is reacquired for the next frame.
+    mDepthStencilExtents         = mDepthStencilEntry->image.getExtents();
+    mDepthStencilLastImageHandle = mDepthStencilEntry->image.getImage().getHandle();
+
+    mDepthStencilRenderTarget.release(contextVk);
+    mDepthStencilRenderTarget.reset();
+    mDepthStencilImageBinding.bind(nullptr);
+
+    renderer->getDepthStencilImagePool().recycle(renderer, this, std::move(mDepthStencilEntry));
+}
+
+angle::Result WindowSurfaceVk::reacquireDepthStencilFromPool(ContextVk *contextVk)
+{
+    ASSERT(!mDepthStencilEntry);
+
+    ANGLE_TRY(ensureDepthStencilImage(contextVk, mDepthStencilExtents, mDepthStencilSamples,
+                                      mDepthStencilRobustInit));
+
+    // If a different image was handed out than the one the cached framebuffers were created with,
+    // those framebuffers reference image views that no longer belong to this surface (or that may
+    // since have been destroyed); schedule them for destruction so they are rebuilt.
+    if (mDepthStencilEntry->image.getImage().getHandle() != mDepthStencilLastImageHandle)
+    {
+        for (SwapchainImage &swapchainImage : mSwapchainImages)
+        {
+            if (swapchainImage.framebuffer.valid())
+            {
+                contextVk->addGarbage(&swapchainImage.framebuffer);
+            }
+            if (swapchainImage.fetchFramebuffer.valid())
+            {
+                contextVk->addGarbage(&swapchainImage.fetchFramebuffer);
+            }
+            if (swapchainImage.framebufferResolveMS.valid())
+            {
+                contextVk->addGarbage(&swapchainImage.framebufferResolveMS);
+            }
+        }
+        if (mFramebufferMS.valid())
+        {
+            contextVk->addGarbage(&mFramebufferMS);
+        }
+    }
+
+    return angle::Result::Continue;
+}
+
+void WindowSurfaceVk::preAcquireNextImageOnWorker(vk::Context *context)
+{
+    ASSERT(mNeedToAcquireNextSwapchainImage);
+
+    // Shared present mode follows a different acquire protocol.  The acquire is also left on the
+    // GL thread if a previous worker acquire has not been consumed yet (the frame was swapped
+    // without its swapchain image ever being accessed).
+    if (isSharedPresentMode() || mPreAcquireEvent)
+    {
+        return;
+    }
+
+    RendererVk *renderer = context->getRenderer();
+    auto task            = std::make_shared<AcquireNextImageTask>(
+        context->getDevice(), mSwapchain, mAcquireImageSemaphores.front().getHandle(),
+        &mPreAcquireResult, &mPreAcquireImageIndex);
+    // If the pool fails to post the task, the event stays null and the acquire simply runs on the
+    // GL thread when the image is first needed.
+    mPreAcquireEvent = renderer->getDisplay()->getMultiThreadPool()->postWorkerTask(
+        task, angle::TaskPriority::Foreground);
+}
+
+void WindowSurfaceVk::waitForPreAcquire()
+{
+    if (mPreAcquireEvent)
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "WindowSurfaceVk::waitForPreAcquire");
+        const double waitStart = mFrameProfileEnabled ? angle::GetCurrentSystemTime() : 0.0;
+        mPreAcquireEvent->wait();
+        if (mFrameProfileEnabled)
+        {
+            mFrameProfileAcquireWaitSeconds += angle::GetCurrentSystemTime() - waitStart;
+        }
+    }
+}
+
+angle::Result WindowSurfaceVk::discardPreAcquiredImage(vk::Context *context)
+{
+    if (!mPreAcquireEvent)
+    {
+        return angle::Result::Continue;
+    }
+
+    waitForPreAcquire();
+    mPreAcquireEvent.reset();
+
+    if (mPreAcquireResult != VK_SUCCESS && mPreAcquireResult != VK_SUBOPTIMAL_KHR)
+    {
+        // A failed acquire leaves the semaphore unsignaled; there is nothing to clean up.
+        return angle::Result::Continue;
+    }
+
+    // The acquired image is abandoned (the swapchain is about to be replaced), but the acquire
+    // semaphore is signaled and would eventually be recycled for a future acquire.  Submit an
+    // empty batch that waits on it so it returns to the unsignaled state before then.
+    const vk::Semaphore &acquireImageSemaphore = mAcquireImageSemaphores.front();
+    mAcquireImageSemaphores.next();
+
+    RendererVk *renderer = context->getRenderer();
+    vk::PrimaryCommandBuffer commandBuffer;
+    ANGLE_TRY(
+        renderer->getCommandBufferOneOff(context, mState.hasProtectedContent(), &commandBuffer));
+    ANGLE_VK_TRY(context, commandBuffer.end());
+
+    Serial serial;
+    ANGLE_TRY(renderer->queueSubmitOneOff(
+        context, std::move(commandBuffer), mState.hasProtectedContent(),
+        egl::ContextPriority::Medium, &acquireImageSemaphore,
+        VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, nullptr, vk::SubmitPolicy::EnsureSubmitted,
+        &serial));
+
+    return angle::Result::Continue;
+}
+
 angle::Result WindowSurfaceVk::doDeferredAcquireNextImage(const gl::Context *context,
                                                           bool presentOutOfDate)
 {
@@ -1910,6 +2299,15 @@ angle::Result WindowSurfaceVk::doDeferredAcquireNextImage(const gl::Context *con
         ANGLE_VK_TRY(contextVk, result);
     }
 
+    // When display-wide depth/stencil sharing is in effect, the image was handed back to the pool
+    // on present; take one back for the new frame.  Swapchain recreation above may already have
+    // recreated it through createSwapChain().
+    if (!mDepthStencilEntry && mState.config->depthStencilFormat != GL_NONE &&
+        contextVk->getRenderer()->isSharedDepthStencilPoolEnabled())
+    {
+        ANGLE_TRY(reacquireDepthStencilFromPool(contextVk));
+    }
+
     // Auto-invalidate the contents of the surface.  According to EGL, on swap:
     //
     // - When EGL_BUFFER_DESTROYED is specified, the contents of the color image can be
@@ -1931,12 +2329,12 @@ angle::Result WindowSurfaceVk::doDeferredAcquireNextImage(const gl::Context *con
                                                            nullptr);
             }
         }
-        if (mDepthStencilImage.valid())
+        if (mDepthStencilEntry)
         {
-            mDepthStencilImage.invalidateSubresourceContent(contextVk, gl::LevelIndex(0), 0, 1,
-                                                            nullptr);
-            mDepthStencilImage.invalidateSubresourceStencilContent(contextVk, gl::LevelIndex(0), 0,
+            mDepthStencilEntry->image.invalidateSubresourceContent(contextVk, gl::LevelIndex(0), 0,
                                                                    1, nullptr);
+            mDepthStencilEntry->image.invalidateSubresourceStencilContent(
+                contextVk, gl::LevelIndex(0), 0, 1, nullptr);
         }
     }
 
@@ -1963,9 +2361,28 @@ VkResult WindowSurfaceVk::acquireNextSwapchainImage(vk::Context *context)
 
     const vk::Semaphore *acquireImageSemaphore = &mAcquireImageSemaphores.front();
 
-    VkResult result =
-        vkAcquireNextImageKHR(device, mSwapchain, UINT64_MAX, acquireImageSemaphore->getHandle(),
-                              VK_NULL_HANDLE, &mCurrentSwapchainImageIndex);
+    VkResult result;
+    if (mPreAcquireEvent)
+    {
+        // Consume the result of the acquire that was kicked off on a worker thread at the end of
+        // the last swap.  The worker used the semaphore at the front of the ring, which has not
+        // been advanced since.
+        waitForPreAcquire();
+        mPreAcquireEvent.reset();
+        result                      = mPreAcquireResult;
+        mCurrentSwapchainImageIndex = mPreAcquireImageIndex;
+    }
+    else
+    {
+        const double acquireStart = mFrameProfileEnabled ? angle::GetCurrentSystemTime() : 0.0;
+        result = vkAcquireNextImageKHR(device, mSwapchain, UINT64_MAX,
+                                       acquireImageSemaphore->getHandle(), VK_NULL_HANDLE,
+                                       &mCurrentSwapchainImageIndex);
+        if (mFrameProfileEnabled)
+        {
+            mFrameProfileAcquireWaitSeconds += angle::GetCurrentSystemTime() - acquireStart;
+        }
+    }
 
     // VK_SUBOPTIMAL_KHR is ok since we still have an Image that can be presented successfully
     if (ANGLE_UNLIKELY(result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR))
@@ -2041,8 +2458,129 @@ egl::Error WindowSurfaceVk::postSubBuffer(const gl::Context *context,
 
 egl::Error WindowSurfaceVk::querySurfacePointerANGLE(EGLint attribute, void **value)
 {
-    UNREACHABLE();
-    return egl::EglBadCurrentSurface();
+    if (attribute == EGL_RENDER_PASS_CLOSURE_COUNTS_ANGLE)
+    {
+        // The snapshot is refreshed at each present once the application has asked for it.
+        mRenderPassClosureCountsEnabled = true;
+
+        *value = &mRenderPassClosureCounts;
+        return egl::NoError();
+    }
+
+    ASSERT(attribute == EGL_FRAME_PROFILE_HISTORY_ANGLE);
+
+    // Collection starts with the first present after the application has asked for the history.
+    mFrameProfileEnabled = true;
+
+    *value = &mFrameProfileHistory;
+    return egl::NoError();
+}
+
+angle::Result WindowSurfaceVk::writeFrameProfileTimestamp(ContextVk *contextVk)
+{
+    if (contextVk->getRenderer()->getQueueFamilyProperties().timestampValidBits == 0)
+    {
+        // GPU frame times stay zero; the CPU-side counters are still collected.
+        return angle::Result::Continue;
+    }
+
+    if (!mFrameProfileQueryPoolValid)
+    {
+        ANGLE_TRY(mFrameProfileTimestampQueryPool.init(contextVk, VK_QUERY_TYPE_TIMESTAMP,
+                                                       vk::kDefaultTimestampQueryPoolSize));
+        mFrameProfileQueryPoolValid = true;
+    }
+
+    PendingFrameProfileTimestamp pending;
+    pending.frameNumber = mFrameCount;
+    pending.recordIndex = mFrameProfileHistory.recordCount % EGL_FRAME_PROFILE_HISTORY_SIZE_ANGLE;
+    ANGLE_TRY(mFrameProfileTimestampQueryPool.allocateQuery(contextVk, &pending.query, 1));
+    ANGLE_TRY(pending.query.flushAndWriteTimestamp(contextVk));
+    mFrameProfilePendingTimestamps.push_back(std::move(pending));
+
+    return angle::Result::Continue;
+}
+
+angle::Result WindowSurfaceVk::recordFrameProfile(ContextVk *contextVk)
+{
+    RendererVk *renderer = contextVk->getRenderer();
+
+    // mFrameCount was already incremented for the frame that was just presented.
+    const uint64_t frameNumber = mFrameCount - 1;
+
+    ANGLEFrameProfileRecord &record =
+        mFrameProfileHistory
+            .records[mFrameProfileHistory.recordCount % EGL_FRAME_PROFILE_HISTORY_SIZE_ANGLE];
+
+    const angle::VulkanPerfCounters &perfCounters      = contextVk->getPerfCounters();
+    const angle::VulkanPerfCounters &queuePerfCounters = renderer->getCommandQueuePerfCounters();
+
+    record.frameNumber         = frameNumber;
+    record.gpuFrameTimeNs      = 0;
+    record.drawCalls           = perfCounters.drawCalls;
+    record.renderPasses        = perfCounters.renderPasses;
+    record.submitCalls         = queuePerfCounters.vkQueueSubmitCallsPerFrame;
+    record.pipelineCacheHits   = perfCounters.pipelineCreationCacheHits;
+    record.pipelineCacheMisses = perfCounters.pipelineCreationCacheMisses;
+    record.writeDescriptorSets = perfCounters.writeDescriptorSets;
+
+    // Swap-path latencies accumulated over the frame, for input-to-photon latency tracking.
+    record.acquireImageWaitNs = static_cast<EGLuint64KHR>(mFrameProfileAcquireWaitSeconds * 1e9);
+    record.swapThrottleWaitNs = static_cast<EGLuint64KHR>(mFrameProfileThrottleWaitSeconds * 1e9);
+    record.presentCallNs      = static_cast<EGLuint64KHR>(mFrameProfilePresentCallSeconds * 1e9);
+    mFrameProfileAcquireWaitSeconds  = 0.0;
+    mFrameProfileThrottleWaitSeconds = 0.0;
+    mFrameProfilePresentCallSeconds  = 0.0;
+
+    const double now      = angle::GetCurrentSystemTime();
+    record.cpuFrameTimeNs = mFrameProfileLastCpuTime == 0.0
+                                ? 0
+                                : static_cast<EGLuint64KHR>((now - mFrameProfileLastCpuTime) * 1e9);
+    mFrameProfileLastCpuTime = now;
+
+    ++mFrameProfileHistory.recordCount;
+
+    // Retire timestamp queries whose results are available and derive GPU frame times from the
+    // deltas between consecutive presents.
+    Serial lastCompletedSerial = contextVk->getLastCompletedQueueSerial();
+    while (!mFrameProfilePendingTimestamps.empty())
+    {
+        PendingFrameProfileTimestamp &pending = mFrameProfilePendingTimestamps.front();
+        if (pending.query.usedInRunningCommands(lastCompletedSerial))
+        {
+            break;
+        }
+
+        vk::QueryResult gpuTimestampCycles(1);
+        bool available = false;
+        ANGLE_TRY(pending.query.getUint64ResultNonBlocking(contextVk, &gpuTimestampCycles,
+                                                           &available));
+        if (!available)
+        {
+            break;
+        }
+
+        // timestampPeriod gives nanoseconds/cycle.
+        const uint64_t timestampNs = static_cast<uint64_t>(
+            gpuTimestampCycles.getResult(vk::QueryResult::kDefaultResultIndex) *
+            static_cast<double>(renderer->getPhysicalDeviceProperties().limits.timestampPeriod));
+
+        if (mFrameProfileLastGpuTimestampNs != 0)
+        {
+            ANGLEFrameProfileRecord &gpuRecord = mFrameProfileHistory.records[pending.recordIndex];
+            // Skip the update if the slot has since been overwritten.
+            if (gpuRecord.frameNumber == pending.frameNumber)
+            {
+                gpuRecord.gpuFrameTimeNs = timestampNs - mFrameProfileLastGpuTimestampNs;
+            }
+        }
+        mFrameProfileLastGpuTimestampNs = timestampNs;
+
+        mFrameProfileTimestampQueryPool.freeQuery(contextVk, &pending.query);
+        mFrameProfilePendingTimestamps.pop_front();
+    }
+
+    return angle::Result::Continue;
 }
 
 egl::Error WindowSurfaceVk::bindTexImage(const gl::Context *context,
@@ -2226,12 +2764,12 @@ angle::Result WindowSurfaceVk::getCurrentFramebuffer(
     }
 
     VkFramebufferCreateInfo framebufferInfo = {};
-    uint32_t attachmentCount                = mDepthStencilImage.valid() ? 2u : 1u;
+    uint32_t attachmentCount                = mDepthStencilEntry ? 2u : 1u;
 
     const gl::Extents rotatedExtents      = mColorRenderTarget.getRotatedExtents();
     std::array<VkImageView, 3> imageViews = {};
 
-    if (mDepthStencilImage.valid())
+    if (mDepthStencilEntry)
     {
         const vk::ImageView *imageView = nullptr;
         ANGLE_TRY(mDepthStencilRenderTarget.getImageView(contextVk, &imageView));
@@ -2341,9 +2879,9 @@ angle::Result WindowSurfaceVk::initializeContents(const gl::Context *context,
         }
         case GL_DEPTH:
         case GL_STENCIL:
-            ASSERT(mDepthStencilImage.valid());
-            mDepthStencilImage.stageRobustResourceClear(gl::ImageIndex::Make2D(0));
-            ANGLE_TRY(mDepthStencilImage.flushAllStagedUpdates(contextVk));
+            ASSERT(mDepthStencilEntry);
+            mDepthStencilEntry->image.stageRobustResourceClear(gl::ImageIndex::Make2D(0));
+            ANGLE_TRY(mDepthStencilEntry->image.flushAllStagedUpdates(contextVk));
             break;
         default:
             UNREACHABLE();
@@ -10,7 +10,10 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_SURFACEVK_H_
 #define LIBANGLE_RENDERER_VULKAN_SURFACEVK_H_
 
+#include <deque>
+
 #include "common/CircularBuffer.h"
+#include "common/WorkerThread.h"
 #include "common/vulkan/vk_headers.h"
 #include "libANGLE/renderer/SurfaceImpl.h"
 #include "libANGLE/renderer/vulkan/RenderTargetVk.h"
@@ -103,7 +106,8 @@ class OffscreenSurfaceVk : public SurfaceVk
                                  const vk::Format &vkFormat,
                                  GLint samples,
                                  bool isRobustResourceInitEnabled,
-                                 bool hasProtectedContent);
+                                 bool hasProtectedContent,
+                                 bool isExportable);
 
         void destroy(const egl::Display *display);
 
@@ -120,6 +124,11 @@ class OffscreenSurfaceVk : public SurfaceVk
     AttachmentImage mColorAttachment;
     AttachmentImage mDepthStencilAttachment;
 
+    // EGL_ANGLE_surface_memory_fd: whether the color attachment's memory was allocated with
+    // VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT export support.
+    RendererVk *mRenderer;
+    bool mColorImageMemoryExportable;
+
     // EGL_KHR_lock_surface3
     vk::BufferHelper mLockBufferHelper;
 };
@@ -290,6 +299,10 @@ class WindowSurfaceVk : public SurfaceVk
                 mDesiredSwapchainPresentMode == vk::PresentMode::SharedContinuousRefreshKHR);
     }
 
+    // EGL_KHR_partial_update: returns the bounding box of the damage region declared for the
+    // current frame, in non-rotated surface coordinates, or false if no region is set.
+    bool getDamageRegionBounds(gl::Rectangle *boundsOut) const;
+
     egl::Error lockSurface(const egl::Display *display,
                            EGLint usageHint,
                            bool preservePixels,
@@ -337,8 +350,21 @@ class WindowSurfaceVk : public SurfaceVk
                                             VkSurfaceCapabilitiesKHR *surfaceCaps);
     angle::Result checkForOutOfDateSwapchain(ContextVk *contextVk, bool presentOutOfDate);
     angle::Result resizeSwapchainImages(vk::Context *context, uint32_t imageCount);
-    void releaseSwapchainImages(ContextVk *contextVk);
+    void releaseSwapchainImages(ContextVk *contextVk, bool retainCompatibleImages);
     void destroySwapChainImages(DisplayVk *displayVk);
+    // Creates the depth/stencil image (or takes a matching one from the display-wide pool when
+    // sharing is enabled) and points the render target and observer binding at it.
+    angle::Result ensureDepthStencilImage(vk::Context *context,
+                                          const VkExtent3D &extents,
+                                          GLint samples,
+                                          bool robustInit);
+    // Returns the depth/stencil image to the display-wide pool while the presented frame is in
+    // flight.  Called from swapImpl() when sharing is enabled.
+    void releaseDepthStencilToPool(ContextVk *contextVk);
+    // Takes a depth/stencil image back from the pool for the new frame.  If a different image is
+    // handed out than last frame's, the cached swapchain framebuffers are scheduled for
+    // destruction so they are rebuilt against the new image.
+    angle::Result reacquireDepthStencilFromPool(ContextVk *contextVk);
     // This method calls vkAcquireNextImageKHR() to acquire the next swapchain image.  It is called
     // when the swapchain is initially created and when present() finds the swapchain out of date.
     // Otherwise, it is scheduled to be called later by deferAcquireNextImage().
@@ -347,6 +373,17 @@ class WindowSurfaceVk : public SurfaceVk
     // acquireNextSwapchainImage() to be called later.
     void deferAcquireNextImage();
 
+    // Kicks the deferred vkAcquireNextImageKHR() off on a worker thread right after present(), so
+    // the wait for the presentation engine to release an image overlaps with application logic
+    // instead of stalling the first draw of the next frame.
+    void preAcquireNextImageOnWorker(vk::Context *context);
+    // Waits for an in-flight worker-thread acquire, if any, leaving its result available for
+    // acquireNextSwapchainImage() to consume.
+    void waitForPreAcquire();
+    // Waits for an in-flight worker-thread acquire and abandons its result.  Called before the
+    // swapchain is recreated.
+    angle::Result discardPreAcquiredImage(vk::Context *context);
+
     angle::Result computePresentOutOfDate(vk::Context *context,
                                           VkResult result,
                                           bool *presentOutOfDate);
@@ -360,6 +397,11 @@ class WindowSurfaceVk : public SurfaceVk
     bool overlayHasEnabledWidget(ContextVk *contextVk) const;
     angle::Result drawOverlay(ContextVk *contextVk, impl::SwapchainImage *image) const;
 
+    // EGL_ANGLE_frame_profile.  The timestamp is written before the frame's commands are
+    // submitted; the record is filled once they are.
+    angle::Result writeFrameProfileTimestamp(ContextVk *contextVk);
+    angle::Result recordFrameProfile(ContextVk *contextVk);
+
     angle::Result newPresentSemaphore(vk::Context *context, vk::Semaphore *semaphoreOut);
 
     bool isMultiSampled() const;
@@ -374,6 +416,9 @@ class WindowSurfaceVk : public SurfaceVk
     vk::PresentMode mDesiredSwapchainPresentMode;  // Desired mode set through setSwapInterval()
     uint32_t mMinImageCount;
     VkSurfaceTransformFlagBitsKHR mPreTransform;
+    // The transform the current swapchain was created with, used to detect recreations that keep
+    // the extent and orientation (and can therefore retain the auxiliary images).
+    VkSurfaceTransformFlagBitsKHR mSwapchainPreTransform;
     VkSurfaceTransformFlagBitsKHR mEmulatedPreTransform;
     VkCompositeAlphaFlagBitsKHR mCompositeAlpha;
 
@@ -419,15 +464,31 @@ class WindowSurfaceVk : public SurfaceVk
     // submissions don't wait on it until the next acquire.
     const vk::Semaphore *mAcquireImageSemaphore;
 
+    // State of an acquire kicked off on a worker thread by preAcquireNextImageOnWorker().  The
+    // result and image index are written by the worker and read by the GL thread only after
+    // waiting on the event.  The worker uses the semaphore at the front of
+    // mAcquireImageSemaphores, which is not advanced until the result is consumed.
+    std::shared_ptr<angle::WaitableEvent> mPreAcquireEvent;
+    VkResult mPreAcquireResult;
+    uint32_t mPreAcquireImageIndex;
+
     // There is no direct signal from Vulkan regarding when a Present semaphore can be be reused.
     // During window resizing when swapchains are recreated every frame, the number of in-flight
     // present semaphores can grow indefinitely.  See doc/PresentSemaphores.md.
     vk::Recycler<vk::Semaphore> mPresentSemaphoreRecycler;
 
-    // Depth/stencil image.  Possibly multisampled.
-    vk::ImageHelper mDepthStencilImage;
-    vk::ImageViewHelper mDepthStencilImageViews;
+    // Depth/stencil image and views.  Possibly multisampled.  When display-wide sharing is
+    // enabled (see vk::DepthStencilImagePool), the entry is returned to the pool on present and
+    // reacquired when the next frame starts; otherwise it stays with the surface for the lifetime
+    // of the swapchain.
+    std::unique_ptr<vk::DepthStencilImagePool::Entry> mDepthStencilEntry;
     angle::ObserverBinding mDepthStencilImageBinding;
+    // Recreation parameters and last image handle for the pooled depth/stencil image, valid while
+    // the image is checked into the pool between frames.
+    VkExtent3D mDepthStencilExtents;
+    GLint mDepthStencilSamples;
+    bool mDepthStencilRobustInit;
+    VkImage mDepthStencilLastImageHandle;
 
     // Multisample color image, view and framebuffer, if multisampling enabled.
     vk::ImageHelper mColorImageMS;
@@ -449,6 +510,32 @@ class WindowSurfaceVk : public SurfaceVk
 
     // GL_EXT_shader_framebuffer_fetch
     FramebufferFetchMode mFramebufferFetchMode = FramebufferFetchMode::Disabled;
+
+    // EGL_ANGLE_frame_profile: per-frame profile records, collected once the application has
+    // queried the history pointer.  GPU frame times are derived from timestamp queries written at
+    // each present; their results are retired a few frames later without blocking.
+    struct PendingFrameProfileTimestamp
+    {
+        uint64_t frameNumber;
+        uint64_t recordIndex;
+        vk::QueryHelper query;
+    };
+
+    bool mFrameProfileEnabled                = false;
+    bool mFrameProfileQueryPoolValid         = false;
+    double mFrameProfileLastCpuTime          = 0.0;
+    uint64_t mFrameProfileLastGpuTimestampNs = 0;
+    // Per-frame latency accumulators; written into the record and reset at each present.
+    double mFrameProfileAcquireWaitSeconds  = 0.0;
+    double mFrameProfileThrottleWaitSeconds = 0.0;
+    double mFrameProfilePresentCallSeconds  = 0.0;
+    vk::DynamicQueryPool mFrameProfileTimestampQueryPool;
+    std::deque<PendingFrameProfileTimestamp> mFrameProfilePendingTimestamps;
+    ANGLEFrameProfileHistory mFrameProfileHistory = {};
+
+    // EGL_RENDER_PASS_CLOSURE_COUNTS_ANGLE (see doc/RenderPassClosures.md)
+    bool mRenderPassClosureCountsEnabled                  = false;
+    ANGLERenderPassClosureCounts mRenderPassClosureCounts = {};
 };
 
 }  // namespace rx
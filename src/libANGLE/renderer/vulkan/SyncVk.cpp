@@ -139,7 +139,8 @@ angle::Result SyncHelper::serverWait(ContextVk *contextVk)
 
     // Every resource already tracks its usage and issues the appropriate barriers, so there's
     // really nothing to do here.  An execution barrier is issued to strictly satisfy what the
-    // application asked for.
+    // application asked for.  Note that this relies on every context submitting to the same
+    // VkQueue in serial order; see doc/MultiQueueParallelism.md.
     vk::OutsideRenderPassCommandBuffer *commandBuffer;
     ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer({}, &commandBuffer));
     commandBuffer->pipelineBarrier(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
@@ -150,6 +151,18 @@ angle::Result SyncHelper::serverWait(ContextVk *contextVk)
 
 angle::Result SyncHelper::getStatus(Context *context, ContextVk *contextVk, bool *signaled)
 {
+    // A valid serial means the sync object was already submitted.  If that serial is known to be
+    // completed, the sync is signaled and there is no need to check completed commands; the
+    // completed serial is an atomic updated by the submission thread, so this path never takes the
+    // command queue lock or enters the driver.  Applications commonly poll already-signaled syncs,
+    // making this the hot path.
+    if (mUse.getSerial().valid() &&
+        !isCurrentlyInUse(context->getRenderer()->getLastCompletedQueueSerial()))
+    {
+        *signaled = true;
+        return angle::Result::Continue;
+    }
+
     // Submit commands if it was deferred on the context that issued the sync object
     ANGLE_TRY(submitSyncIfDeferred(contextVk, RenderPassClosureReason::SyncObjectClientWait));
 
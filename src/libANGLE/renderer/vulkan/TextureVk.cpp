@@ -14,6 +14,7 @@
 #include "image_util/generatemip.inc"
 #include "libANGLE/Config.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/Display.h"
 #include "libANGLE/Image.h"
 #include "libANGLE/MemoryObject.h"
 #include "libANGLE/Surface.h"
@@ -49,6 +50,16 @@ constexpr VkImageAspectFlags kDepthStencilAspects =
 
 constexpr angle::SubjectIndex kTextureImageSubjectIndex = 0;
 
+// With the eagerlySubmitLargeTextureUpdates feature, staged updates that exceed this size are
+// flushed and submitted without waiting for the texture to be used in a draw, so the GPU performs
+// the copies while the application keeps recording.
+constexpr VkDeviceSize kMaxStagedUpdateSizeBeforeEagerSubmit = 32 * 1024 * 1024;
+
+// With the stageLargeTextureUpdatesInChunks feature, a subimage upload whose staging requirement
+// exceeds this size is staged as multiple row bands with separate staging allocations, so peak
+// staging memory is bounded by a few chunks instead of one allocation covering the whole image.
+constexpr VkDeviceSize kStagedUpdateChunkSize = 16 * 1024 * 1024;
+
 // Test whether a texture level is within the range of levels for which the current image is
 // allocated.  This is used to ensure out-of-range updates are staged in the image, and not
 // attempted to be directly applied.
@@ -658,10 +669,20 @@ angle::Result TextureVk::setSubImageImpl(const gl::Context *context,
     }
     else if (pixels)
     {
-        ANGLE_TRY(mImage->stageSubresourceUpdate(
-            contextVk, getNativeImageIndex(index), gl::Extents(area.width, area.height, area.depth),
-            gl::Offset(area.x, area.y, area.z), formatInfo, unpack, type, pixels, vkFormat,
-            getRequiredImageAccess()));
+        bool chunked = false;
+        if (contextVk->getFeatures().stageLargeTextureUpdatesInChunks.enabled)
+        {
+            ANGLE_TRY(stageSubImageInChunks(contextVk, index, area, formatInfo, type, unpack,
+                                            pixels, vkFormat, shouldFlush, &chunked));
+        }
+        if (!chunked)
+        {
+            ANGLE_TRY(mImage->stageSubresourceUpdate(
+                contextVk, getNativeImageIndex(index),
+                gl::Extents(area.width, area.height, area.depth),
+                gl::Offset(area.x, area.y, area.z), formatInfo, unpack, type, pixels, vkFormat,
+                getRequiredImageAccess()));
+        }
     }
 
     // If we used context's staging buffer, flush out the updates
@@ -675,6 +696,15 @@ angle::Result TextureVk::setSubImageImpl(const gl::Context *context,
             ANGLE_TRY(contextVk->submitStagedTextureUpdates());
         }
     }
+    else if (contextVk->getFeatures().eagerlySubmitLargeTextureUpdates.enabled &&
+             mImage->getTotalStagedBufferUpdateSize() >= kMaxStagedUpdateSizeBeforeEagerSubmit)
+    {
+        // Enough data has been staged that waiting for the next draw to flush it would serialize a
+        // large upload right before rendering needs the texture.  Flush and submit the updates now
+        // so the copies overlap with continued command recording.
+        ANGLE_TRY(ensureImageInitialized(contextVk, ImageMipLevels::EnabledLevels));
+        ANGLE_TRY(contextVk->submitStagedTextureUpdates());
+    }
     else if (contextVk->getFeatures().mutableMipmapTextureUpload.enabled &&
              !contextVk->hasDisplayTextureShareGroup() && !mState.getImmutableFormat())
     {
@@ -685,6 +715,95 @@ angle::Result TextureVk::setSubImageImpl(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result TextureVk::stageSubImageInChunks(ContextVk *contextVk,
+                                               const gl::ImageIndex &index,
+                                               const gl::Box &area,
+                                               const gl::InternalFormat &formatInfo,
+                                               GLenum type,
+                                               const gl::PixelUnpackState &unpack,
+                                               const uint8_t *pixels,
+                                               const vk::Format &vkFormat,
+                                               bool allowIntermediateSubmit,
+                                               bool *chunkedOut)
+{
+    *chunkedOut = false;
+
+    const angle::Format &storageFormat = vkFormat.getActualImageFormat(getRequiredImageAccess());
+
+    // Only plain color images with a single depth slice are chunked.  Depth/stencil and YUV
+    // uploads take special-cased staging paths, and 3D uploads are rare enough not to matter.
+    if (area.depth != 1 || storageFormat.hasDepthOrStencilBits() || storageFormat.isYUV)
+    {
+        return angle::Result::Continue;
+    }
+
+    // Compute the staging size of one band of blockHeight pixel rows, and of the whole update.
+    GLuint blockHeight       = formatInfo.compressed ? formatInfo.compressedBlockHeight : 1;
+    VkDeviceSize bandPitch   = 0;
+    VkDeviceSize stagingSize = 0;
+    if (storageFormat.isBlock)
+    {
+        const gl::InternalFormat &storageFormatInfo = vkFormat.getInternalFormatInfo(type);
+        GLuint rowPitch;
+        GLuint totalSize;
+        ANGLE_VK_CHECK_MATH(contextVk, storageFormatInfo.computeCompressedImageSize(
+                                           gl::Extents(area.width, 1, 1), &rowPitch));
+        ANGLE_VK_CHECK_MATH(contextVk,
+                            storageFormatInfo.computeCompressedImageSize(
+                                gl::Extents(area.width, area.height, 1), &totalSize));
+        bandPitch   = rowPitch;
+        stagingSize = totalSize;
+    }
+    else
+    {
+        bandPitch =
+            static_cast<VkDeviceSize>(storageFormat.pixelBytes) * area.width * blockHeight;
+        stagingSize =
+            static_cast<VkDeviceSize>(storageFormat.pixelBytes) * area.width * area.height;
+    }
+
+    const VkDeviceSize bandsPerChunk = bandPitch > 0 ? kStagedUpdateChunkSize / bandPitch : 0;
+    if (stagingSize <= kStagedUpdateChunkSize || bandsPerChunk == 0)
+    {
+        return angle::Result::Continue;
+    }
+
+    GLuint inputRowPitch   = 0;
+    GLuint inputDepthPitch = 0;
+    GLuint inputSkipBytes  = 0;
+    ANGLE_TRY(mImage->CalculateBufferInfo(
+        contextVk, gl::Extents(area.width, area.height, area.depth), formatInfo, unpack, type,
+        index.usesTex3D(), &inputRowPitch, &inputDepthPitch, &inputSkipBytes));
+
+    const GLuint chunkRows = static_cast<GLuint>(bandsPerChunk) * blockHeight;
+    for (GLuint row = 0; row < static_cast<GLuint>(area.height); row += chunkRows)
+    {
+        const GLuint bandHeight = std::min(chunkRows, static_cast<GLuint>(area.height) - row);
+
+        // The input pitch advances one block row (blockHeight pixel rows) at a time, so point the
+        // band at its first block row through the skip bytes.
+        const GLuint bandSkipBytes = inputSkipBytes + row / blockHeight * inputRowPitch;
+
+        ANGLE_TRY(mImage->stageSubresourceUpdateImpl(
+            contextVk, getNativeImageIndex(index), gl::Extents(area.width, bandHeight, 1),
+            gl::Offset(area.x, area.y + row, area.z), formatInfo, unpack, type, pixels, vkFormat,
+            getRequiredImageAccess(), inputRowPitch, inputDepthPitch, bandSkipBytes));
+
+        // Hand the accumulated chunks to the GPU along the way so their staging buffers can be
+        // recycled as the copies complete, instead of all of them staying live until the end of
+        // the upload.
+        if (allowIntermediateSubmit &&
+            mImage->getTotalStagedBufferUpdateSize() >= kMaxStagedUpdateSizeBeforeEagerSubmit)
+        {
+            ANGLE_TRY(ensureImageInitialized(contextVk, ImageMipLevels::EnabledLevels));
+            ANGLE_TRY(contextVk->submitStagedTextureUpdates());
+        }
+    }
+
+    *chunkedOut = true;
+    return angle::Result::Continue;
+}
+
 angle::Result TextureVk::copyImage(const gl::Context *context,
                                    const gl::ImageIndex &index,
                                    const gl::Rectangle &sourceArea,
@@ -1037,6 +1156,8 @@ angle::Result TextureVk::copySubTextureImpl(ContextVk *contextVk,
 
     rx::PixelReadFunction pixelReadFunction   = srcTextureFormat.pixelReadFunction;
     rx::PixelWriteFunction pixelWriteFunction = dstTextureFormat.pixelWriteFunction;
+    angle::FormatID srcCopyFormatID           = srcTextureFormat.id;
+    angle::FormatID dstCopyFormatID           = dstTextureFormat.id;
 
     // Fix up the read/write functions for the sake of luminance/alpha that are emulated with
     // formats whose channels don't correspond to the original format (alpha is emulated with red,
@@ -1044,17 +1165,20 @@ angle::Result TextureVk::copySubTextureImpl(ContextVk *contextVk,
     if (srcIntendedFormat.isLUMA())
     {
         pixelReadFunction = srcIntendedFormat.pixelReadFunction;
+        srcCopyFormatID   = srcIntendedFormat.id;
     }
     if (dstVkFormat.getIntendedFormat().isLUMA())
     {
         pixelWriteFunction = dstVkFormat.getIntendedFormat().pixelWriteFunction;
+        dstCopyFormatID    = dstVkFormat.getIntendedFormat().id;
     }
 
     CopyImageCHROMIUM(sourceData, srcDataRowPitch, srcTextureFormat.pixelBytes, srcDataDepthPitch,
-                      pixelReadFunction, destData, dstDataRowPitch, dstTextureFormat.pixelBytes,
-                      dstDataDepthPitch, pixelWriteFunction, dstFormat.format,
-                      dstFormat.componentType, sourceBox.width, sourceBox.height, sourceBox.depth,
-                      unpackFlipY, unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
+                      srcCopyFormatID, pixelReadFunction, destData, dstDataRowPitch,
+                      dstTextureFormat.pixelBytes, dstDataDepthPitch, dstCopyFormatID,
+                      pixelWriteFunction, dstFormat.format, dstFormat.componentType,
+                      sourceBox.width, sourceBox.height, sourceBox.depth, unpackFlipY,
+                      unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
 
     if (!shouldUpdateBeStaged(gl::LevelIndex(index.getLevelIndex()), dstFormatID))
     {
@@ -1082,10 +1206,6 @@ angle::Result TextureVk::copySubImageImplWithTransfer(ContextVk *contextVk,
     gl::Offset srcOffset = {sourceBox.x, sourceBox.y, sourceBox.z};
     gl::Extents extents  = {sourceBox.width, sourceBox.height, sourceBox.depth};
 
-    // Change source layout if necessary
-    vk::CommandBufferAccess access;
-    access.onImageTransferRead(VK_IMAGE_ASPECT_COLOR_BIT, srcImage);
-
     VkImageSubresourceLayers srcSubresource = {};
     srcSubresource.aspectMask               = VK_IMAGE_ASPECT_COLOR_BIT;
     srcSubresource.mipLevel                 = srcImage->toVkLevel(sourceLevelGL).get();
@@ -1123,12 +1243,6 @@ angle::Result TextureVk::copySubImageImplWithTransfer(ContextVk *contextVk,
         // Make sure any updates to the image are already flushed.
         ANGLE_TRY(ensureImageInitialized(contextVk, ImageMipLevels::EnabledLevels));
 
-        access.onImageTransferWrite(level, 1, baseLayer, layerCount, VK_IMAGE_ASPECT_COLOR_BIT,
-                                    mImage);
-
-        vk::OutsideRenderPassCommandBuffer *commandBuffer;
-        ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(access, &commandBuffer));
-
         VkImageSubresourceLayers destSubresource = srcSubresource;
         destSubresource.mipLevel                 = mImage->toVkLevel(level).get();
         destSubresource.baseArrayLayer           = baseLayer;
@@ -1145,11 +1259,30 @@ angle::Result TextureVk::copySubImageImplWithTransfer(ContextVk *contextVk,
             extents.depth = 1;
         }
 
-        vk::ImageHelper::Copy(srcImage, mImage, srcOffset, dstOffsetModified, extents,
-                              srcSubresource, destSubresource, commandBuffer);
+        VkImageCopy region    = {};
+        region.srcSubresource = srcSubresource;
+        region.srcOffset.x    = srcOffset.x;
+        region.srcOffset.y    = srcOffset.y;
+        region.srcOffset.z    = srcOffset.z;
+        region.dstSubresource = destSubresource;
+        region.dstOffset.x    = dstOffsetModified.x;
+        region.dstOffset.y    = dstOffsetModified.y;
+        region.dstOffset.z    = dstOffsetModified.z;
+        region.extent.width   = extents.width;
+        region.extent.height  = extents.height;
+        region.extent.depth   = extents.depth;
+
+        // Let the context batch this copy with neighboring copies between the same pair of
+        // images; sprite-atlas style workloads issue many small region copies back to back.
+        ANGLE_TRY(
+            contextVk->batchImageCopy(srcImage, mImage, level, baseLayer, layerCount, region));
     }
     else
     {
+        // Change source layout if necessary
+        vk::CommandBufferAccess access;
+        access.onImageTransferRead(VK_IMAGE_ASPECT_COLOR_BIT, srcImage);
+
         // Create a temporary image to stage the copy
         std::unique_ptr<vk::RefCounted<vk::ImageHelper>> stagingImage;
         stagingImage = std::make_unique<vk::RefCounted<vk::ImageHelper>>();
@@ -1414,6 +1547,16 @@ angle::Result TextureVk::setStorageMultisample(const gl::Context *context,
 
     ASSERT(mState.getImmutableFormat());
     ASSERT(!mRedefinedLevels.any());
+
+    // With deferImmutableTextureAllocation, don't commit memory at glTexStorage time; the first
+    // upload or use goes through ensureImageInitialized (e.g. from syncState) and allocates the
+    // image then.  Multisample textures are allocated up front as they are rendered to right away.
+    if (renderer->getFeatures().deferImmutableTextureAllocation.enabled && samples == 1 &&
+        type != gl::TextureType::_2DMultisample && type != gl::TextureType::_2DMultisampleArray)
+    {
+        return angle::Result::Continue;
+    }
+
     ANGLE_TRY(initImage(contextVk, format.getIntendedFormatID(),
                         format.getActualImageFormatID(getRequiredImageAccess()),
                         ImageMipLevels::FullMipChainForGenerateMipmap));
@@ -1781,10 +1924,24 @@ angle::Result TextureVk::redefineLevel(const gl::Context *context,
             bool isUpdateToSingleLevelImage =
                 mImage->getLevelCount() == 1 && mImage->getFirstAllocatedLevel() == levelIndexGL;
 
+            // If the compatibly-redefined image is a single layer (so this call respecifies the
+            // entire contents) but the GPU may still be reading it, staging the new data would
+            // make the upload serialize against those reads.  Release the image instead and let
+            // the data go to a fresh one, similar to BufferVk's buffer ghosting; the old image
+            // stays alive through the usual serial tracking until the GPU is done.  Video decode
+            // targets commonly respecify their texture every frame and hit this path.
+            const bool ghostInUseImage =
+                isCompatibleRedefinition && mImage->getLayerCount() == 1 &&
+                mImage->isCurrentlyInUse(contextVk->getLastCompletedQueueSerial());
+
             // If incompatible, and redefining the single-level image, release it so it can be
             // recreated immediately.  This is an optimization to avoid an extra copy.
-            if (!isCompatibleRedefinition && isUpdateToSingleLevelImage)
+            if ((!isCompatibleRedefinition || ghostInUseImage) && isUpdateToSingleLevelImage)
             {
+                if (ghostInUseImage)
+                {
+                    ++contextVk->getPerfCounters().texturesGhosted;
+                }
                 releaseImage(contextVk);
             }
         }
@@ -2060,15 +2217,28 @@ angle::Result TextureVk::generateMipmap(const gl::Context *context)
     vk::LevelIndex maxLevel  = mImage->toVkLevel(gl::LevelIndex(mState.getMipmapMaxLevel()));
     ASSERT(maxLevel != vk::LevelIndex(0));
 
+    // The compute path generates multiple levels per dispatch with a shared-memory reduction,
+    // while the blit path issues one blit and barrier per level.  Compute amortizes its extra
+    // layout transitions and descriptor updates only on deeper chains, so shallow chains stay on
+    // the blit path when both are available.
+    constexpr uint32_t kMinLevelsToGenerateMipmapWithCompute = 4;
+
+    const uint32_t levelsToGenerate = maxLevel.get() - baseLevel.get();
+    const bool canGenerateWithCompute =
+        CanGenerateMipmapWithCompute(renderer, mImage->getType(), mImage->getActualFormatID(),
+                                     mImage->getSamples(), mOwnsImage);
+    const bool canGenerateWithBlit =
+        renderer->hasImageFormatFeatureBits(mImage->getActualFormatID(), kBlitFeatureFlags);
+
     // If it's possible to generate mipmap in compute, that would give the best possible
     // performance on some hardware.
-    if (CanGenerateMipmapWithCompute(renderer, mImage->getType(), mImage->getActualFormatID(),
-                                     mImage->getSamples(), mOwnsImage))
+    if (canGenerateWithCompute &&
+        (levelsToGenerate > kMinLevelsToGenerateMipmapWithCompute || !canGenerateWithBlit))
     {
         ASSERT((mImageUsageFlags & VK_IMAGE_USAGE_STORAGE_BIT) != 0);
         return generateMipmapsWithCompute(contextVk);
     }
-    else if (renderer->hasImageFormatFeatureBits(mImage->getActualFormatID(), kBlitFeatureFlags))
+    else if (canGenerateWithBlit)
     {
         // Otherwise, use blit if possible.
         return mImage->generateMipmapsWithBlit(contextVk, baseLevel, maxLevel);
@@ -2311,11 +2481,12 @@ angle::Result TextureVk::reinitImageAsRenderable(ContextVk *contextVk,
         for (uint32_t layer = 0; layer < layerCount; layer++)
         {
             CopyImageCHROMIUM(srcData + layer * srcDataLayerPitch, srcDataRowPitch,
-                              srcFormat.pixelBytes, srcDataDepthPitch, pixelReadFunction,
-                              dstData + layer * dstDataLayerPitch, dstDataRowPitch,
-                              dstFormat.pixelBytes, dstDataDepthPitch, pixelWriteFunction,
-                              dstFormatInfo.format, dstFormatInfo.componentType, sourceBox.width,
-                              sourceBox.height, sourceBox.depth, false, false, false);
+                              srcFormat.pixelBytes, srcDataDepthPitch, srcFormat.id,
+                              pixelReadFunction, dstData + layer * dstDataLayerPitch,
+                              dstDataRowPitch, dstFormat.pixelBytes, dstDataDepthPitch,
+                              dstFormat.id, pixelWriteFunction, dstFormatInfo.format,
+                              dstFormatInfo.componentType, sourceBox.width, sourceBox.height,
+                              sourceBox.depth, false, false, false);
         }
     }
 
@@ -3391,10 +3562,13 @@ angle::Result TextureVk::generateMipmapLevelsWithCPU(ContextVk *contextVk,
             gl::ImageIndex::MakeFromType(mState.getType(), currentMipLevel.get(), layer),
             mipLevelExtents, gl::Offset(), &destData, sourceFormat.id));
 
-        // Generate the mipmap into that new buffer
-        sourceFormat.mipGenerationFunction(
-            previousLevelWidth, previousLevelHeight, previousLevelDepth, previousLevelData,
-            previousLevelRowPitch, previousLevelDepthPitch, destData, destRowPitch, destDepthPitch);
+        // Generate the mipmap into that new buffer, splitting large levels across the worker
+        // pool.
+        GenerateMipWithWorkerPool(
+            sourceFormat.mipGenerationFunction,
+            contextVk->getRenderer()->getDisplay()->getMultiThreadPool(), previousLevelWidth,
+            previousLevelHeight, previousLevelDepth, previousLevelData, previousLevelRowPitch,
+            previousLevelDepthPitch, destData, destRowPitch, destDepthPitch);
 
         // Swap for the next iteration
         previousLevelWidth      = mipWidth;
@@ -399,6 +399,21 @@ class TextureVk : public TextureImpl, public angle::ObserverInterface
                                   const uint8_t *pixels,
                                   const vk::Format &vkFormat);
 
+    // With the stageLargeTextureUpdatesInChunks feature, stages a large subimage update as a
+    // series of row bands with separate, bounded staging allocations.  Sets chunkedOut to false
+    // when the update is too small or too exotic to chunk, in which case the caller stages it
+    // whole as usual.
+    angle::Result stageSubImageInChunks(ContextVk *contextVk,
+                                        const gl::ImageIndex &index,
+                                        const gl::Box &area,
+                                        const gl::InternalFormat &formatInfo,
+                                        GLenum type,
+                                        const gl::PixelUnpackState &unpack,
+                                        const uint8_t *pixels,
+                                        const vk::Format &vkFormat,
+                                        bool allowIntermediateSubmit,
+                                        bool *chunkedOut);
+
     angle::Result copyImageDataToBufferAndGetData(ContextVk *contextVk,
                                                   gl::LevelIndex sourceLevelGL,
                                                   uint32_t layerCount,
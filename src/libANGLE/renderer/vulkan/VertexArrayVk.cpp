@@ -159,6 +159,7 @@ VertexArrayVk::VertexArrayVk(ContextVk *contextVk, const gl::VertexArrayState &s
       mCurrentArrayBufferRelativeOffsets{},
       mCurrentArrayBuffers{},
       mCurrentArrayBufferStrides{},
+      mCurrentArrayBufferDivisors{},
       mCurrentElementArrayBuffer(nullptr),
       mLineLoopHelper(contextVk->getRenderer()),
       mDirtyLineLoopTranslation(true)
@@ -170,6 +171,7 @@ VertexArrayVk::VertexArrayVk(ContextVk *contextVk, const gl::VertexArrayState &s
     mCurrentArrayBufferRelativeOffsets.fill(0);
     mCurrentArrayBuffers.fill(&emptyBuffer);
     mCurrentArrayBufferStrides.fill(0);
+    mCurrentArrayBufferDivisors.fill(0);
 }
 
 VertexArrayVk::~VertexArrayVk() {}
@@ -463,34 +465,182 @@ angle::Result VertexArrayVk::convertVertexBufferCPU(ContextVk *contextVk,
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "VertexArrayVk::convertVertexBufferCpu");
 
-    unsigned srcFormatSize = vertexFormat.getIntendedFormat().pixelBytes;
-    unsigned dstFormatSize = vertexFormat.getActualBufferFormat(compressed).pixelBytes;
+    RendererVk *renderer = contextVk->getRenderer();
 
-    size_t numVertices = GetVertexCount(srcBuffer, binding, srcFormatSize);
-    if (numVertices == 0)
+    // A pending conversion to perform in this pass over the source buffer.
+    struct PlannedConversion
     {
-        return angle::Result::Continue;
+        size_t attribIndex;
+        const vk::Format *format;
+        ConversionBuffer *conversion;
+        const gl::VertexBinding *binding;
+        GLuint relativeOffset;
+        bool compressed;
+    };
+
+    // Interleaved legacy formats bind several attributes to the same buffer; converting them one
+    // by one walks the same memory once per attribute.  Plan a single pass instead: gather every
+    // other enabled attribute that reads this buffer through the unaligned CPU path and also has
+    // a conversion pending.  The eligibility conditions mirror syncDirtyAttrib().
+    gl::AttribArray<PlannedConversion> plan;
+    size_t planSize  = 0;
+    plan[planSize++] = {attribIndex, &vertexFormat, conversion, &binding, relativeOffset,
+                        compressed};
+
+    const std::vector<gl::VertexAttribute> &attribs = mState.getVertexAttributes();
+    const std::vector<gl::VertexBinding> &bindings  = mState.getVertexBindings();
+
+    for (size_t otherIndex : mState.getEnabledAttributesMask())
+    {
+        if (otherIndex == attribIndex)
+        {
+            continue;
+        }
+
+        const gl::VertexAttribute &otherAttrib = attribs[otherIndex];
+        const gl::VertexBinding &otherBinding  = bindings[otherAttrib.bindingIndex];
+        gl::Buffer *otherBufferGL              = otherBinding.getBuffer().get();
+
+        if (otherBufferGL == nullptr || vk::GetImpl(otherBufferGL) != srcBuffer ||
+            otherBufferGL->getSize() == 0 ||
+            otherBinding.getDivisor() > renderer->getMaxVertexAttribDivisor())
+        {
+            continue;
+        }
+
+        const vk::Format &otherFormat       = renderer->getFormat(otherAttrib.format->id);
+        const angle::Format &intendedFormat = otherFormat.getIntendedFormat();
+        if (BindingIsAligned(otherBinding, intendedFormat, intendedFormat.channelCount,
+                             otherAttrib.relativeOffset))
+        {
+            // Aligned attributes are converted on the GPU.
+            continue;
+        }
+
+        const bool otherCompressed = renderer->getFeatures().compressVertexData.enabled &&
+                                     gl::IsStaticBufferUsage(otherBufferGL->getUsage()) &&
+                                     otherFormat.canCompressBufferData();
+
+        ConversionBuffer *otherConversion = srcBuffer->getVertexConversionBuffer(
+            renderer, intendedFormat.id, otherBinding.getStride(),
+            otherBinding.getOffset() + otherAttrib.relativeOffset, true);
+        if (!otherConversion->dirty)
+        {
+            continue;
+        }
+
+        // Attributes that read this buffer with an identical layout share one ConversionBuffer;
+        // converting it once covers all of them, and planning it twice would clear its dirty bit
+        // twice.
+        bool alreadyPlanned = false;
+        for (size_t planIndex = 0; planIndex < planSize; ++planIndex)
+        {
+            if (plan[planIndex].conversion == otherConversion)
+            {
+                alreadyPlanned = true;
+                break;
+            }
+        }
+        if (alreadyPlanned)
+        {
+            continue;
+        }
+
+        plan[planSize++] = {otherIndex,          &otherFormat,   otherConversion,
+                            &otherBinding,       otherAttrib.relativeOffset,
+                            otherCompressed};
     }
 
     void *src = nullptr;
     ANGLE_TRY(srcBuffer->mapImpl(contextVk, GL_MAP_READ_BIT, &src));
     const uint8_t *srcBytes = reinterpret_cast<const uint8_t *>(src);
-    srcBytes += binding.getOffset() + relativeOffset;
-    ASSERT(vertexFormat.getVertexInputAlignment(compressed) <= vk::kVertexBufferAlignment);
 
-    vk::BufferHelper *dstBufferHelper = conversion->data.get();
-    // Allocate buffer for results
-    ANGLE_TRY(dstBufferHelper->allocateForVertexConversion(contextVk, numVertices * dstFormatSize,
-                                                           vk::MemoryHostVisibility::Visible));
+    // The source and destination streams of each planned conversion.
+    struct ConversionStream
+    {
+        size_t attribIndex;
+        ConversionBuffer *conversion;
+        vk::BufferHelper *dstBuffer;
+        const uint8_t *srcPtr;
+        uint8_t *dstPtr;
+        size_t numVertices;
+        size_t srcStride;
+        size_t dstFormatSize;
+        VertexCopyFunction vertexLoadFunction;
+    };
+
+    gl::AttribArray<ConversionStream> streams;
+    size_t streamCount = 0;
+    size_t maxVertices = 0;
+
+    for (size_t planIndex = 0; planIndex < planSize; ++planIndex)
+    {
+        const PlannedConversion &planned = plan[planIndex];
 
-    ANGLE_TRY(StreamVertexData(contextVk, dstBufferHelper, srcBytes, numVertices * dstFormatSize, 0,
-                               numVertices, binding.getStride(),
-                               vertexFormat.getVertexLoadFunction(compressed)));
-    ANGLE_TRY(srcBuffer->unmapImpl(contextVk));
-    mCurrentArrayBuffers[attribIndex] = dstBufferHelper;
+        const unsigned srcFormatSize = planned.format->getIntendedFormat().pixelBytes;
+        const unsigned dstFormatSize =
+            planned.format->getActualBufferFormat(planned.compressed).pixelBytes;
 
-    ASSERT(conversion->dirty);
-    conversion->dirty = false;
+        const size_t numVertices = GetVertexCount(srcBuffer, *planned.binding, srcFormatSize);
+        if (numVertices == 0)
+        {
+            // Nothing to convert; the conversion stays dirty, as before.
+            continue;
+        }
+        ASSERT(planned.format->getVertexInputAlignment(planned.compressed) <=
+               vk::kVertexBufferAlignment);
+
+        vk::BufferHelper *dstBufferHelper = planned.conversion->data.get();
+        // Allocate buffer for results
+        ANGLE_TRY(dstBufferHelper->allocateForVertexConversion(
+            contextVk, numVertices * dstFormatSize, vk::MemoryHostVisibility::Visible));
+
+        streams[streamCount++] = {
+            planned.attribIndex,
+            planned.conversion,
+            dstBufferHelper,
+            srcBytes + planned.binding->getOffset() + planned.relativeOffset,
+            dstBufferHelper->getMappedMemory(),
+            numVertices,
+            planned.binding->getStride(),
+            dstFormatSize,
+            planned.format->getVertexLoadFunction(planned.compressed)};
+        maxVertices = std::max(maxVertices, numVertices);
+    }
+
+    // Convert in blocks of vertices so the source block stays cache-resident while every stream
+    // reads it, rather than streaming the whole buffer once per attribute.
+    constexpr size_t kConversionBlockVertices = 1024;
+    for (size_t firstVertex = 0; firstVertex < maxVertices;
+         firstVertex += kConversionBlockVertices)
+    {
+        for (size_t streamIndex = 0; streamIndex < streamCount; ++streamIndex)
+        {
+            ConversionStream &stream = streams[streamIndex];
+            if (firstVertex >= stream.numVertices)
+            {
+                continue;
+            }
+            const size_t count =
+                std::min(kConversionBlockVertices, stream.numVertices - firstVertex);
+            stream.vertexLoadFunction(stream.srcPtr + firstVertex * stream.srcStride,
+                                      stream.srcStride, count,
+                                      stream.dstPtr + firstVertex * stream.dstFormatSize);
+        }
+    }
+
+    for (size_t streamIndex = 0; streamIndex < streamCount; ++streamIndex)
+    {
+        ConversionStream &stream = streams[streamIndex];
+
+        ANGLE_TRY(stream.dstBuffer->flush(renderer));
+        mCurrentArrayBuffers[stream.attribIndex] = stream.dstBuffer;
+
+        ASSERT(stream.conversion->dirty);
+        stream.conversion->dirty = false;
+    }
+
+    ANGLE_TRY(srcBuffer->unmapImpl(contextVk));
 
     return angle::Result::Continue;
 }
@@ -628,7 +778,8 @@ angle::Result VertexArrayVk::updateActiveAttribInfo(ContextVk *contextVk)
             mCurrentArrayBufferCompressed.test(attribIndex),
             mCurrentArrayBufferRelativeOffsets[attribIndex], mCurrentArrayBuffers[attribIndex]));
 
-        mCurrentArrayBufferFormats[attribIndex] = format;
+        mCurrentArrayBufferFormats[attribIndex]  = format;
+        mCurrentArrayBufferDivisors[attribIndex] = binding.getDivisor();
     }
 
     return angle::Result::Continue;
@@ -645,12 +796,29 @@ angle::Result VertexArrayVk::syncDirtyAttrib(ContextVk *contextVk,
     {
         const vk::Format &vertexFormat = renderer->getFormat(attrib.format->id);
 
-        // Init attribute offset to the front-end value
-        mCurrentArrayBufferRelativeOffsets[attribIndex] = attrib.relativeOffset;
-        gl::Buffer *bufferGL                            = binding.getBuffer().get();
+        gl::Buffer *bufferGL = binding.getBuffer().get();
         // Emulated and/or client-side attribs will be streamed
         bool isStreamingVertexAttrib =
             (binding.getDivisor() > renderer->getMaxVertexAttribDivisor()) || (bufferGL == nullptr);
+
+        // Fast path for glVertexAttribPointer churn over client arrays: streamed attribs are
+        // repacked tightly at draw time, so the pipeline vertex input state only depends on the
+        // format, divisor and relative offset -- not on the application's pointer or stride.  If
+        // the previously synced state already matches, the pipeline invalidation below can be
+        // skipped entirely; updateStreamedAttribs picks up the new pointer at the next draw.
+        if (bufferGL == nullptr && !bufferOnly && mStreamingVertexAttribsMask.test(attribIndex) &&
+            mCurrentArrayBufferFormats[attribIndex] == attrib.format->id &&
+            !mCurrentArrayBufferCompressed.test(attribIndex) &&
+            mCurrentArrayBufferDivisors[attribIndex] == binding.getDivisor() &&
+            mCurrentArrayBufferRelativeOffsets[attribIndex] == attrib.relativeOffset &&
+            mCurrentArrayBufferStrides[attribIndex] ==
+                vertexFormat.getActualBufferFormat(false).pixelBytes)
+        {
+            return angle::Result::Continue;
+        }
+
+        // Init attribute offset to the front-end value
+        mCurrentArrayBufferRelativeOffsets[attribIndex] = attrib.relativeOffset;
         mStreamingVertexAttribsMask.set(attribIndex, isStreamingVertexAttrib);
         bool compressed = false;
 
@@ -712,13 +880,16 @@ angle::Result VertexArrayVk::syncDirtyAttrib(ContextVk *contextVk,
                                                          attrib.relativeOffset, compressed));
                     }
 
-                    // If conversion happens, the destination buffer stride may be changed,
-                    // therefore an attribute change needs to be called. Note that it may trigger
-                    // unnecessary vulkan PSO update when the destination buffer stride does not
-                    // change, but for simplicity just make it conservative
-                    bufferOnly = false;
                 }
 
+                // If conversion happens, the destination buffer stride may be changed, therefore
+                // an attribute change needs to be called. Note that it may trigger unnecessary
+                // vulkan PSO update when the destination buffer stride does not change, but for
+                // simplicity just make it conservative.  This is outside the dirty check because
+                // the conversion may already have been performed by a grouped CPU pass for
+                // another attribute sharing this buffer.
+                bufferOnly = false;
+
                 vk::BufferHelper *bufferHelper    = conversion->data.get();
                 mCurrentArrayBuffers[attribIndex] = bufferHelper;
                 VkDeviceSize bufferOffset;
@@ -791,6 +962,7 @@ angle::Result VertexArrayVk::syncDirtyAttrib(ContextVk *contextVk,
 
             mCurrentArrayBufferFormats[attribIndex]    = format;
             mCurrentArrayBufferCompressed[attribIndex] = compressed;
+            mCurrentArrayBufferDivisors[attribIndex]   = binding.getDivisor();
         }
     }
     else
@@ -803,6 +975,7 @@ angle::Result VertexArrayVk::syncDirtyAttrib(ContextVk *contextVk,
         mCurrentArrayBufferHandles[attribIndex]         = emptyBuffer.getBuffer().getHandle();
         mCurrentArrayBufferOffsets[attribIndex]         = emptyBuffer.getOffset();
         mCurrentArrayBufferStrides[attribIndex]         = 0;
+        mCurrentArrayBufferDivisors[attribIndex]        = 0;
         mCurrentArrayBufferCompressed[attribIndex]      = false;
         mCurrentArrayBufferRelativeOffsets[attribIndex] = 0;
 
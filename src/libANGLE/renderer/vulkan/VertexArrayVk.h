@@ -153,6 +153,8 @@ class VertexArrayVk : public VertexArrayImpl
     // Cache strides of attributes for a fast pipeline cache update when VAOs are changed
     gl::AttribArray<angle::FormatID> mCurrentArrayBufferFormats;
     gl::AttribArray<GLuint> mCurrentArrayBufferStrides;
+    // Divisors as last handed to the pipeline description; used to detect no-op attrib updates
+    gl::AttribArray<GLuint> mCurrentArrayBufferDivisors;
     gl::AttributesMask mCurrentArrayBufferCompressed;
     vk::BufferHelper *mCurrentElementArrayBuffer;
 
@@ -48,6 +48,15 @@ angle::Result VulkanSecondaryCommandBuffer::InitializeRenderPassInheritanceInfo(
     inheritanceInfoOut->subpass     = 0;
     inheritanceInfoOut->framebuffer = framebuffer.getHandle();
 
+    // Pipeline statistics queries may be active while this command buffer executes; the statistics
+    // they gather (for the overlay, or to emulate the primitives generated query) must be declared
+    // here.
+    if (contextVk->getFeatures().supportsPipelineStatisticsQuery.enabled)
+    {
+        inheritanceInfoOut->pipelineStatistics =
+            VK_QUERY_PIPELINE_STATISTIC_CLIPPING_INVOCATIONS_BIT | kOverlayPipelineStatistics;
+    }
+
     return angle::Result::Continue;
 }
 
@@ -102,6 +102,12 @@ class VulkanSecondaryCommandBuffer : public priv::CommandBuffer
                    VkImageLayout dstImageLayout,
                    uint32_t regionCount,
                    const VkImageCopy *regions);
+    void copyImage(VkImage srcImage,
+                   VkImageLayout srcImageLayout,
+                   VkImage dstImage,
+                   VkImageLayout dstImageLayout,
+                   uint32_t regionCount,
+                   const VkImageCopy *regions);
 
     void dispatch(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ);
     void dispatchIndirect(const Buffer &buffer, VkDeviceSize offset);
@@ -345,6 +351,18 @@ ANGLE_INLINE void VulkanSecondaryCommandBuffer::copyImage(const Image &srcImage,
                              regions);
 }
 
+ANGLE_INLINE void VulkanSecondaryCommandBuffer::copyImage(VkImage srcImage,
+                                                          VkImageLayout srcImageLayout,
+                                                          VkImage dstImage,
+                                                          VkImageLayout dstImageLayout,
+                                                          uint32_t regionCount,
+                                                          const VkImageCopy *regions)
+{
+    onRecordCommand();
+    CommandBuffer::copyImage(srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount,
+                             regions);
+}
+
 ANGLE_INLINE void VulkanSecondaryCommandBuffer::draw(uint32_t vertexCount,
                                                      uint32_t instanceCount,
                                                      uint32_t firstVertex,
@@ -37,6 +37,60 @@ egl::Error DisplayVkAndroid::initialize(egl::Display *display)
     return egl::NoError();
 }
 
+void DisplayVkAndroid::terminate()
+{
+    destroyParkedAhbImports();
+    DisplayVk::terminate();
+}
+
+bool DisplayVkAndroid::takeParkedAhbImport(AHardwareBuffer *buffer, ParkedAhbImport *importOut)
+{
+    std::unique_lock<std::mutex> lock(mParkedAhbImportsMutex);
+    for (auto iter = mParkedAhbImports.begin(); iter != mParkedAhbImports.end(); ++iter)
+    {
+        if (iter->first == buffer)
+        {
+            *importOut = std::move(iter->second);
+            mParkedAhbImports.erase(iter);
+            return true;
+        }
+    }
+    return false;
+}
+
+void DisplayVkAndroid::parkAhbImport(AHardwareBuffer *buffer, ParkedAhbImport &&import)
+{
+    std::pair<AHardwareBuffer *, ParkedAhbImport> evicted = {};
+    {
+        std::unique_lock<std::mutex> lock(mParkedAhbImportsMutex);
+        mParkedAhbImports.emplace_back(buffer, std::move(import));
+        if (mParkedAhbImports.size() > kMaxParkedAhbImports)
+        {
+            evicted = std::move(mParkedAhbImports.front());
+            mParkedAhbImports.erase(mParkedAhbImports.begin());
+        }
+    }
+
+    if (evicted.second.image != nullptr)
+    {
+        evicted.second.image->releaseImage(mRenderer);
+        SafeDelete(evicted.second.image);
+        mAHBFunctions.release(evicted.first);
+    }
+}
+
+void DisplayVkAndroid::destroyParkedAhbImports()
+{
+    std::unique_lock<std::mutex> lock(mParkedAhbImportsMutex);
+    for (std::pair<AHardwareBuffer *, ParkedAhbImport> &entry : mParkedAhbImports)
+    {
+        entry.second.image->releaseImage(mRenderer);
+        SafeDelete(entry.second.image);
+        mAHBFunctions.release(entry.first);
+    }
+    mParkedAhbImports.clear();
+}
+
 bool DisplayVkAndroid::isValidNativeWindow(EGLNativeWindowType window) const
 {
     return (ANativeWindow_getFormat(window) >= 0);
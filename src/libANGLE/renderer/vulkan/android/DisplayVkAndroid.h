@@ -10,17 +10,45 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_ANDROID_DISPLAYVKANDROID_H_
 #define LIBANGLE_RENDERER_VULKAN_ANDROID_DISPLAYVKANDROID_H_
 
+#include <mutex>
+#include <utility>
+#include <vector>
+
 #include "libANGLE/renderer/vulkan/DisplayVk.h"
 #include "libANGLE/renderer/vulkan/android/AHBFunctions.h"
 
 namespace rx
 {
+namespace vk
+{
+class ImageHelper;
+}  // namespace vk
+
+// A parked AHardwareBuffer import: the Vulkan image wrapper and the properties derived for it
+// when the buffer was first imported.  Parked imports are kept by DisplayVkAndroid between
+// EGLImage lifetimes so that re-importing the same buffer (e.g. a camera buffer ring) skips
+// vkGetAndroidHardwareBufferPropertiesANDROID and image/memory creation entirely.  A parked
+// import holds an AHardwareBuffer reference, so the buffer handle cannot be recycled for a
+// different allocation while the entry lives.
+struct ParkedAhbImport
+{
+    vk::ImageHelper *image = nullptr;
+    gl::Extents size;
+    GLenum internalFormat = GL_NONE;
+    uint64_t usage        = 0;
+    uint32_t levelCount   = 0;
+    bool renderable       = false;
+    bool textureable      = false;
+    bool isYUV            = false;
+};
+
 class DisplayVkAndroid : public DisplayVk
 {
   public:
     DisplayVkAndroid(const egl::DisplayState &state);
 
     egl::Error initialize(egl::Display *display) override;
+    void terminate() override;
 
     bool isValidNativeWindow(EGLNativeWindowType window) const override;
 
@@ -44,10 +72,22 @@ class DisplayVkAndroid : public DisplayVk
 
     const AHBFunctions &getAHBFunctions() const { return mAHBFunctions; }
 
+    // Takes a parked import of |buffer| out of the cache, if one exists.  The caller assumes
+    // ownership of the image and of the AHardwareBuffer reference the entry held.
+    bool takeParkedAhbImport(AHardwareBuffer *buffer, ParkedAhbImport *importOut);
+    // Parks an import of |buffer| for later reuse, assuming ownership of the image and of one
+    // AHardwareBuffer reference.  Evicts the oldest entry if the cache is full.
+    void parkAhbImport(AHardwareBuffer *buffer, ParkedAhbImport &&import);
+
   private:
     void enableRecordableIfSupported(egl::Config *config);
+    void destroyParkedAhbImports();
 
     AHBFunctions mAHBFunctions;
+
+    static constexpr size_t kMaxParkedAhbImports = 16;
+    std::mutex mParkedAhbImportsMutex;
+    std::vector<std::pair<AHardwareBuffer *, ParkedAhbImport>> mParkedAhbImports;
 };
 
 }  // namespace rx
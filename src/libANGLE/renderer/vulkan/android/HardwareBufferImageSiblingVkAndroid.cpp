@@ -142,6 +142,7 @@ HardwareBufferImageSiblingVkAndroid::HardwareBufferImageSiblingVkAndroid(EGLClie
       mLevelCount(0),
       mUsage(0),
       mSamples(0),
+      mParkedInCache(false),
       mImage(nullptr)
 {}
 
@@ -245,6 +246,29 @@ angle::Result HardwareBufferImageSiblingVkAndroid::initImpl(DisplayVk *displayVk
     struct AHardwareBuffer *hardwareBuffer =
         angle::android::ANativeWindowBufferToAHardwareBuffer(windowBuffer);
 
+    // If an earlier import of this buffer is parked in the display's cache, adopt it wholesale:
+    // the image, memory and derived properties are all still valid (the parked entry holds an
+    // AHardwareBuffer reference, so the handle cannot have been recycled), making steady-state
+    // re-imports free of Vulkan queries and allocations.  Only the layout/ownership tracking is
+    // reset so the image is re-acquired from the foreign queue on first access.
+    DisplayVkAndroid *displayAndroid = static_cast<DisplayVkAndroid *>(displayVk);
+    ParkedAhbImport parkedImport;
+    if (displayAndroid->takeParkedAhbImport(hardwareBuffer, &parkedImport))
+    {
+        // The AHardwareBuffer reference held by the entry transfers to this sibling.
+        mSize        = parkedImport.size;
+        mFormat      = gl::Format(parkedImport.internalFormat);
+        mRenderable  = parkedImport.renderable;
+        mTextureable = parkedImport.textureable;
+        mYUV         = parkedImport.isYUV;
+        mLevelCount  = parkedImport.levelCount;
+        mUsage       = parkedImport.usage;
+        mImage       = parkedImport.image;
+
+        mImage->resetToExternalPreInitialized(VK_QUEUE_FAMILY_FOREIGN_EXT);
+        return angle::Result::Continue;
+    }
+
     functions.acquire(hardwareBuffer);
     VkAndroidHardwareBufferFormatPropertiesANDROID bufferFormatProperties;
     bufferFormatProperties.sType =
@@ -443,8 +467,13 @@ void HardwareBufferImageSiblingVkAndroid::onDestroy(const egl::Display *display)
     const AHBFunctions &functions = GetImplAs<DisplayVkAndroid>(display)->getAHBFunctions();
     ASSERT(functions.valid());
 
-    functions.release(angle::android::ANativeWindowBufferToAHardwareBuffer(
-        angle::android::ClientBufferToANativeWindowBuffer(mBuffer)));
+    // If the import was parked in the display's cache, the AHardwareBuffer reference was
+    // transferred to the cache entry.
+    if (!mParkedInCache)
+    {
+        functions.release(angle::android::ANativeWindowBufferToAHardwareBuffer(
+            angle::android::ClientBufferToANativeWindowBuffer(mBuffer)));
+    }
 
     ASSERT(mImage == nullptr);
 }
@@ -506,9 +535,29 @@ void HardwareBufferImageSiblingVkAndroid::release(RendererVk *renderer)
     {
         // TODO: Handle the case where the EGLImage is used in two contexts not in the same share
         // group.  https://issuetracker.google.com/169868803
-        mImage->releaseImage(renderer);
         mImage->releaseStagedUpdates(renderer);
-        SafeDelete(mImage);
+
+        // Park the import in the display's cache instead of destroying it, so that re-importing
+        // the same buffer later (e.g. the next pass over a camera buffer ring) reuses the image.
+        // The sibling's AHardwareBuffer reference transfers to the cache entry.
+        DisplayVkAndroid *displayAndroid =
+            static_cast<DisplayVkAndroid *>(renderer->getDisplay()->getImplementation());
+
+        ParkedAhbImport parkedImport;
+        parkedImport.image          = mImage;
+        parkedImport.size           = mSize;
+        parkedImport.internalFormat = mFormat.info->internalFormat;
+        parkedImport.usage          = mUsage;
+        parkedImport.levelCount     = mLevelCount;
+        parkedImport.renderable     = mRenderable;
+        parkedImport.textureable    = mTextureable;
+        parkedImport.isYUV          = mYUV;
+
+        displayAndroid->parkAhbImport(angle::android::ANativeWindowBufferToAHardwareBuffer(
+                                          angle::android::ClientBufferToANativeWindowBuffer(mBuffer)),
+                                      std::move(parkedImport));
+        mParkedInCache = true;
+        mImage         = nullptr;
     }
 }
 
@@ -58,6 +58,10 @@ class HardwareBufferImageSiblingVkAndroid : public ExternalImageSiblingVk
     uint64_t mUsage;
     size_t mSamples;
 
+    // True when release() parked the import (and its AHardwareBuffer reference) in the display's
+    // import cache instead of destroying it; onDestroy() must then not release the reference.
+    bool mParkedInCache;
+
     vk::ImageHelper *mImage;
 };
 
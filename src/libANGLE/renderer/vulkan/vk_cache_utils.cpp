@@ -2489,6 +2489,13 @@ void DumpPipelineCacheGraph(
             case vk::CacheLookUpFeedback::WarmUpMiss:
                 out << "[style=dashed,color=red]";
                 break;
+            case vk::CacheLookUpFeedback::LinkedDrawHit:
+                // Default is green already
+                out << "[style=dotted]";
+                break;
+            case vk::CacheLookUpFeedback::LinkedDrawMiss:
+                out << "[style=dotted,color=red]";
+                break;
             default:
                 // No feedback available
                 break;
@@ -2633,6 +2640,13 @@ void RenderPassDesc::packDepthStencilResolveAttachment()
     mResolveDepthStencil = true;
 }
 
+void RenderPassDesc::removeDepthStencilResolveAttachment()
+{
+    ASSERT(hasDepthStencilResolveAttachment());
+
+    mResolveDepthStencil = false;
+}
+
 void RenderPassDesc::packDepthStencilUnresolveAttachment(bool unresolveDepth, bool unresolveStencil)
 {
     ASSERT(hasDepthStencilAttachment());
@@ -2942,6 +2956,38 @@ angle::Result GraphicsPipelineDesc::initializePipeline(Context *context,
     const bool hasShadersOrFragmentOutput = GraphicsPipelineHasShadersOrFragmentOutput(subset);
     const bool hasFragmentOutput          = GraphicsPipelineHasFragmentOutput(subset);
 
+    // When only a subset of the pipeline is specified, create a pipeline library covering that
+    // subset.  Complete pipelines are later fast-linked out of the libraries; retain link-time
+    // optimization info so the driver can still optimize link if it chooses to.
+    VkGraphicsPipelineLibraryCreateInfoEXT libraryInfo = {};
+    libraryInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT;
+
+    if (subset != GraphicsPipelineSubset::Complete)
+    {
+        ASSERT(context->getFeatures().supportsGraphicsPipelineLibrary.enabled);
+
+        if (hasVertexInput)
+        {
+            libraryInfo.flags |= VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT;
+        }
+        if (hasShaders)
+        {
+            // The pre-rasterization and fragment shader stages are bundled in the Shaders
+            // subset; they are keyed identically and separating them would not reduce the
+            // number of library compiles.
+            libraryInfo.flags |= VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT |
+                                 VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT;
+        }
+        if (hasFragmentOutput)
+        {
+            libraryInfo.flags |= VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT;
+        }
+
+        createInfo.flags |= VK_PIPELINE_CREATE_LIBRARY_BIT_KHR |
+                            VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+        AddToPNextChain(&createInfo, &libraryInfo);
+    }
+
     if (hasVertexInput)
     {
         initializePipelineVertexInputState(context, &vertexInputState, &dynamicStateList);
@@ -3038,6 +3084,64 @@ angle::Result GraphicsPipelineDesc::initializePipeline(Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result GraphicsPipelineDesc::initializePipelineFromLibraries(
+    Context *context,
+    PipelineCacheAccess *pipelineCache,
+    const PipelineLayout &pipelineLayout,
+    const Pipeline &vertexInputLibrary,
+    const Pipeline &shadersLibrary,
+    const Pipeline &fragmentOutputLibrary,
+    Pipeline *pipelineOut,
+    CacheLookUpFeedback *feedbackOut) const
+{
+    ASSERT(context->getFeatures().supportsGraphicsPipelineLibrary.enabled);
+
+    // All state is provided by the libraries; only the library list and the layout are needed.
+    // Without VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT this is a fast link.
+    const VkPipeline libraries[] = {
+        vertexInputLibrary.getHandle(),
+        shadersLibrary.getHandle(),
+        fragmentOutputLibrary.getHandle(),
+    };
+
+    VkPipelineLibraryCreateInfoKHR libraryInfo = {};
+    libraryInfo.sType        = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR;
+    libraryInfo.libraryCount = static_cast<uint32_t>(angle::ArraySize(libraries));
+    libraryInfo.pLibraries   = libraries;
+
+    VkGraphicsPipelineCreateInfo createInfo = {};
+    createInfo.sType                        = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    createInfo.layout                       = pipelineLayout.getHandle();
+    AddToPNextChain(&createInfo, &libraryInfo);
+
+    VkPipelineCreationFeedback feedback = {};
+
+    VkPipelineCreationFeedbackCreateInfo feedbackInfo = {};
+    feedbackInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO;
+
+    const bool supportsFeedback = context->getFeatures().supportsPipelineCreationFeedback.enabled;
+    if (supportsFeedback)
+    {
+        feedbackInfo.pPipelineCreationFeedback = &feedback;
+        AddToPNextChain(&createInfo, &feedbackInfo);
+    }
+
+    ANGLE_TRY(pipelineCache->createGraphicsPipeline(context, createInfo, pipelineOut));
+
+    if (supportsFeedback)
+    {
+        const bool cacheHit =
+            (feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT) !=
+            0;
+
+        *feedbackOut =
+            cacheHit ? CacheLookUpFeedback::LinkedDrawHit : CacheLookUpFeedback::LinkedDrawMiss;
+        ApplyPipelineCreationFeedback(context, feedback);
+    }
+
+    return angle::Result::Continue;
+}
+
 void GraphicsPipelineDesc::initializePipelineVertexInputState(
     Context *context,
     GraphicsPipelineVertexInputVulkanStructs *stateOut,
@@ -5262,6 +5366,7 @@ void UpdatePreCacheActiveTextures(const std::vector<gl::SamplerBinding> &sampler
                                   const gl::ActiveTextureMask &activeTextures,
                                   const gl::ActiveTextureArray<TextureVk *> &textures,
                                   const gl::SamplerBindingVector &samplers,
+                                  const gl::ActiveTextureMask &promotedSamplers,
                                   DescriptorSetDesc *desc)
 {
     desc->reset();
@@ -5303,7 +5408,12 @@ void UpdatePreCacheActiveTextures(const std::vector<gl::SamplerBinding> &sampler
                 // Layout is implicit.
 
                 infoDesc.imageViewSerialOrOffset = imageViewSerial.viewSerial.getValue();
-                infoDesc.samplerOrBufferSerial   = samplerHelper.getSamplerSerial().getValue();
+                // For promoted (immutable) samplers the layout already pins the sampler; keeping
+                // its serial out of the key lets identical per-draw updates hit the cache.
+                if (!promotedSamplers.test(textureIndex))
+                {
+                    infoDesc.samplerOrBufferSerial = samplerHelper.getSamplerSerial().getValue();
+                }
                 memcpy(&infoDesc.imageSubresourceRange, &imageViewSerial.subresource,
                        sizeof(uint32_t));
             }
@@ -5847,14 +5957,27 @@ void DescriptorSetDescBuilder::updateImagesAndBuffersWithSharedCacheKey(
 template <class SharedCacheKeyT>
 void SharedCacheKeyManager<SharedCacheKeyT>::addKey(const SharedCacheKeyT &key)
 {
-    // If there is invalid key in the array, use it instead of keep expanding the array
-    for (SharedCacheKeyT &sharedCacheKey : mSharedCacheKeys)
+    // Scanning the array for an invalidated slot to reuse would make this O(keys), and this is
+    // called on every new descriptor set for every texture and buffer it references.  Append
+    // instead, and occasionally sweep out the keys whose cache entries have since been destroyed.
+    // The next sweep is scheduled at double the surviving size, so the array stays within a
+    // constant factor of the number of live keys and the sweep cost amortizes to O(1) per add.
+    if (mSharedCacheKeys.size() >= mNextKeyCompactionSize)
     {
-        if (*sharedCacheKey.get() == nullptr)
+        size_t liveKeyCount = 0;
+        for (size_t keyIndex = 0; keyIndex < mSharedCacheKeys.size(); ++keyIndex)
         {
-            sharedCacheKey = key;
-            return;
+            if (*mSharedCacheKeys[keyIndex].get() != nullptr)
+            {
+                if (liveKeyCount != keyIndex)
+                {
+                    mSharedCacheKeys[liveKeyCount] = std::move(mSharedCacheKeys[keyIndex]);
+                }
+                ++liveKeyCount;
+            }
         }
+        mSharedCacheKeys.resize(liveKeyCount);
+        mNextKeyCompactionSize = std::max(liveKeyCount * 2, kMinKeyCompactionSize);
     }
     mSharedCacheKeys.emplace_back(key);
 }
@@ -5873,6 +5996,7 @@ void SharedCacheKeyManager<SharedCacheKeyT>::releaseKeys(ContextVk *contextVk)
         }
     }
     mSharedCacheKeys.clear();
+    mNextKeyCompactionSize = kMinKeyCompactionSize;
 }
 
 template <class SharedCacheKeyT>
@@ -5889,6 +6013,7 @@ void SharedCacheKeyManager<SharedCacheKeyT>::destroyKeys(RendererVk *renderer)
         }
     }
     mSharedCacheKeys.clear();
+    mNextKeyCompactionSize = kMinKeyCompactionSize;
 }
 
 template <class SharedCacheKeyT>
@@ -5897,6 +6022,7 @@ void SharedCacheKeyManager<SharedCacheKeyT>::clear()
     // Caller must have already freed all caches
     assertAllEntriesDestroyed();
     mSharedCacheKeys.clear();
+    mNextKeyCompactionSize = kMinKeyCompactionSize;
 }
 
 template <class SharedCacheKeyT>
@@ -6106,6 +6232,142 @@ angle::Result RenderPassCache::getRenderPassWithOpsImpl(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
+namespace
+{
+// Version tag for the render pass key stream stored in the blob cache; bump when
+// vk::RenderPassDesc changes incompatibly.
+constexpr uint32_t kRenderPassKeyStreamVersion = 1;
+
+void ComputeRenderPassKeyStreamBlobKey(const VkPhysicalDeviceProperties &physicalDeviceProperties,
+                                       egl::BlobCache::Key *hashOut)
+{
+    // Mirrors ComputePipelineCacheVkChunkKey: mix in the pipeline cache UUID and device ids so
+    // key streams are never replayed against an incompatible device.
+    std::ostringstream hashStream("ANGLE RenderPass Key Stream: ", std::ios_base::ate);
+    for (const uint32_t c : physicalDeviceProperties.pipelineCacheUUID)
+    {
+        hashStream << std::hex << c;
+    }
+    hashStream << std::hex << physicalDeviceProperties.vendorID;
+    hashStream << std::hex << physicalDeviceProperties.deviceID;
+
+    const std::string &hashString = hashStream.str();
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(hashString.c_str()),
+                               hashString.length(), hashOut->data());
+}
+
+// The blob cache is untrusted input: entries may be corrupt or hostile.  A deserialized desc is
+// fed to InitializeRenderPassFromDesc, which uses the attachment range to bound fixed-capacity
+// vectors and the format bytes to index the format table, so both must be validated before use.
+bool IsValidDeserializedRenderPassDesc(const vk::RenderPassDesc &desc)
+{
+    if (desc.colorAttachmentRange() > gl::IMPLEMENTATION_MAX_DRAW_BUFFERS)
+    {
+        return false;
+    }
+    for (size_t index = 0; index < gl::IMPLEMENTATION_MAX_DRAW_BUFFERS + 1; ++index)
+    {
+        if (static_cast<uint32_t>(desc[index]) >= angle::kNumANGLEFormats)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
+void RenderPassCache::storeKeysInBlobCache(ContextVk *contextVk) const
+{
+    if (mPayload.empty())
+    {
+        return;
+    }
+
+    RendererVk *renderer = contextVk->getRenderer();
+    DisplayVk *displayVk = vk::GetImpl(renderer->getDisplay());
+
+    const uint32_t count = static_cast<uint32_t>(mPayload.size());
+
+    angle::MemoryBuffer keyStream;
+    if (!keyStream.resize(sizeof(kRenderPassKeyStreamVersion) + sizeof(count) +
+                          count * sizeof(vk::RenderPassDesc)))
+    {
+        return;
+    }
+
+    uint8_t *out = keyStream.data();
+    memcpy(out, &kRenderPassKeyStreamVersion, sizeof(kRenderPassKeyStreamVersion));
+    out += sizeof(kRenderPassKeyStreamVersion);
+    memcpy(out, &count, sizeof(count));
+    out += sizeof(count);
+    for (const auto &outerIt : mPayload)
+    {
+        memcpy(out, &outerIt.first, sizeof(vk::RenderPassDesc));
+        out += sizeof(vk::RenderPassDesc);
+    }
+
+    egl::BlobCache::Key blobKey;
+    ComputeRenderPassKeyStreamBlobKey(renderer->getPhysicalDeviceProperties(), &blobKey);
+    displayVk->getBlobCache()->putApplication(blobKey, keyStream);
+}
+
+angle::Result RenderPassCache::warmUpFromBlobCache(ContextVk *contextVk)
+{
+    RendererVk *renderer = contextVk->getRenderer();
+    DisplayVk *displayVk = vk::GetImpl(renderer->getDisplay());
+
+    egl::BlobCache::Key blobKey;
+    ComputeRenderPassKeyStreamBlobKey(renderer->getPhysicalDeviceProperties(), &blobKey);
+
+    egl::BlobCache::Value keyStream;
+    size_t keyStreamSize = 0;
+    if (!displayVk->getBlobCache()->get(displayVk->getScratchBuffer(), blobKey, &keyStream,
+                                        &keyStreamSize))
+    {
+        // Nothing in the cache; nothing to warm up.
+        return angle::Result::Continue;
+    }
+
+    constexpr size_t kHeaderSize = sizeof(kRenderPassKeyStreamVersion) + sizeof(uint32_t);
+    if (keyStreamSize < kHeaderSize)
+    {
+        return angle::Result::Continue;
+    }
+
+    uint32_t version = 0;
+    uint32_t count   = 0;
+    memcpy(&version, keyStream.data(), sizeof(version));
+    memcpy(&count, keyStream.data() + sizeof(version), sizeof(count));
+
+    // The count is divided rather than multiplied to size the stream so a hostile count cannot
+    // overflow the comparison on 32-bit size_t.
+    if (version != kRenderPassKeyStreamVersion ||
+        count > (keyStreamSize - kHeaderSize) / sizeof(vk::RenderPassDesc))
+    {
+        // Stale or truncated key stream; ignore it.
+        return angle::Result::Continue;
+    }
+
+    const uint8_t *in = keyStream.data() + kHeaderSize;
+    for (uint32_t index = 0; index < count; ++index)
+    {
+        vk::RenderPassDesc desc;
+        memcpy(&desc, in, sizeof(desc));
+        in += sizeof(desc);
+
+        if (!IsValidDeserializedRenderPassDesc(desc))
+        {
+            // A corrupt desc means the stream as a whole cannot be trusted; stop warming up.
+            return angle::Result::Continue;
+        }
+
+        vk::RenderPass *renderPass = nullptr;
+        ANGLE_TRY(getCompatibleRenderPass(contextVk, desc, &renderPass));
+    }
+
+    return angle::Result::Continue;
+}
+
 // PipelineCacheAccess implementation.
 std::unique_lock<std::mutex> PipelineCacheAccess::getLock()
 {
@@ -6232,6 +6494,49 @@ angle::Result GraphicsPipelineCache<Hash>::createPipeline(
     return angle::Result::Continue;
 }
 
+template <typename Hash>
+angle::Result GraphicsPipelineCache<Hash>::linkLibraries(
+    ContextVk *contextVk,
+    PipelineCacheAccess *pipelineCache,
+    const vk::PipelineLayout &pipelineLayout,
+    vk::PipelineHelper *vertexInputPipeline,
+    vk::PipelineHelper *shadersPipeline,
+    vk::PipelineHelper *fragmentOutputPipeline,
+    PipelineSource source,
+    const vk::GraphicsPipelineDesc &desc,
+    const vk::GraphicsPipelineDesc **descPtrOut,
+    vk::PipelineHelper **pipelineOut)
+{
+    ASSERT(mPayload.find(desc) == mPayload.end());
+    static_assert(GraphicsPipelineCacheTypeHelper<Hash>::kSubset ==
+                      vk::GraphicsPipelineSubset::Complete,
+                  "Only complete pipelines are linked out of libraries");
+
+    mCacheStats.missAndIncrementSize();
+
+    vk::Pipeline newPipeline;
+    vk::CacheLookUpFeedback feedback = vk::CacheLookUpFeedback::None;
+
+    ANGLE_TRY(desc.initializePipelineFromLibraries(
+        contextVk, pipelineCache, pipelineLayout, vertexInputPipeline->getPipeline(),
+        shadersPipeline->getPipeline(), fragmentOutputPipeline->getPipeline(), &newPipeline,
+        &feedback));
+
+    if (source == PipelineSource::WarmUp)
+    {
+        feedback = feedback == vk::CacheLookUpFeedback::LinkedDrawHit
+                       ? vk::CacheLookUpFeedback::WarmUpHit
+                       : vk::CacheLookUpFeedback::WarmUpMiss;
+    }
+
+    auto insertedItem = mPayload.emplace(std::piecewise_construct, std::forward_as_tuple(desc),
+                                         std::forward_as_tuple(std::move(newPipeline), feedback));
+    *descPtrOut       = &insertedItem.first->first;
+    *pipelineOut      = &insertedItem.first->second;
+
+    return angle::Result::Continue;
+}
+
 template <typename Hash>
 void GraphicsPipelineCache<Hash>::populate(const vk::GraphicsPipelineDesc &desc,
                                            vk::Pipeline &&pipeline)
@@ -6266,6 +6571,65 @@ template angle::Result GraphicsPipelineCache<GraphicsPipelineDescCompleteHash>::
 template void GraphicsPipelineCache<GraphicsPipelineDescCompleteHash>::populate(
     const vk::GraphicsPipelineDesc &desc,
     vk::Pipeline &&pipeline);
+template angle::Result GraphicsPipelineCache<GraphicsPipelineDescCompleteHash>::linkLibraries(
+    ContextVk *contextVk,
+    PipelineCacheAccess *pipelineCache,
+    const vk::PipelineLayout &pipelineLayout,
+    vk::PipelineHelper *vertexInputPipeline,
+    vk::PipelineHelper *shadersPipeline,
+    vk::PipelineHelper *fragmentOutputPipeline,
+    PipelineSource source,
+    const vk::GraphicsPipelineDesc &desc,
+    const vk::GraphicsPipelineDesc **descPtrOut,
+    vk::PipelineHelper **pipelineOut);
+
+// Instantiate the subset pipeline caches used as VK_EXT_graphics_pipeline_library libraries
+template void GraphicsPipelineCache<GraphicsPipelineDescVertexInputHash>::destroy(
+    RendererVk *rendererVk);
+template void GraphicsPipelineCache<GraphicsPipelineDescVertexInputHash>::release(
+    ContextVk *contextVk);
+template angle::Result GraphicsPipelineCache<GraphicsPipelineDescVertexInputHash>::createPipeline(
+    ContextVk *contextVk,
+    PipelineCacheAccess *pipelineCache,
+    const vk::RenderPass &compatibleRenderPass,
+    const vk::PipelineLayout &pipelineLayout,
+    const vk::ShaderAndSerialMap &shaders,
+    const vk::SpecializationConstants &specConsts,
+    PipelineSource source,
+    const vk::GraphicsPipelineDesc &desc,
+    const vk::GraphicsPipelineDesc **descPtrOut,
+    vk::PipelineHelper **pipelineOut);
+template void GraphicsPipelineCache<GraphicsPipelineDescShadersHash>::destroy(
+    RendererVk *rendererVk);
+template void GraphicsPipelineCache<GraphicsPipelineDescShadersHash>::release(
+    ContextVk *contextVk);
+template angle::Result GraphicsPipelineCache<GraphicsPipelineDescShadersHash>::createPipeline(
+    ContextVk *contextVk,
+    PipelineCacheAccess *pipelineCache,
+    const vk::RenderPass &compatibleRenderPass,
+    const vk::PipelineLayout &pipelineLayout,
+    const vk::ShaderAndSerialMap &shaders,
+    const vk::SpecializationConstants &specConsts,
+    PipelineSource source,
+    const vk::GraphicsPipelineDesc &desc,
+    const vk::GraphicsPipelineDesc **descPtrOut,
+    vk::PipelineHelper **pipelineOut);
+template void GraphicsPipelineCache<GraphicsPipelineDescFragmentOutputHash>::destroy(
+    RendererVk *rendererVk);
+template void GraphicsPipelineCache<GraphicsPipelineDescFragmentOutputHash>::release(
+    ContextVk *contextVk);
+template angle::Result
+GraphicsPipelineCache<GraphicsPipelineDescFragmentOutputHash>::createPipeline(
+    ContextVk *contextVk,
+    PipelineCacheAccess *pipelineCache,
+    const vk::RenderPass &compatibleRenderPass,
+    const vk::PipelineLayout &pipelineLayout,
+    const vk::ShaderAndSerialMap &shaders,
+    const vk::SpecializationConstants &specConsts,
+    PipelineSource source,
+    const vk::GraphicsPipelineDesc &desc,
+    const vk::GraphicsPipelineDesc **descPtrOut,
+    vk::PipelineHelper **pipelineOut);
 
 // DescriptorSetLayoutCache implementation.
 DescriptorSetLayoutCache::DescriptorSetLayoutCache() = default;
@@ -159,6 +159,10 @@ class alignas(4) RenderPassDesc final
     void removeColorUnresolveAttachment(size_t colorIndexGL);
     // Indicate that a depth/stencil attachment should have a corresponding resolve attachment.
     void packDepthStencilResolveAttachment();
+    // Remove the depth/stencil resolve attachment.  Similarly to the color resolve attachment,
+    // used when optimizing blit through resolve attachment to temporarily pack a resolve
+    // attachment and then remove it.
+    void removeDepthStencilResolveAttachment();
     // Indicate that a depth/stencil attachment should take its data from the resolve attachment
     // initially.
     void packDepthStencilUnresolveAttachment(bool unresolveDepth, bool unresolveStencil);
@@ -300,6 +304,8 @@ enum class CacheLookUpFeedback
     None,
     Hit,
     Miss,
+    LinkedDrawHit,
+    LinkedDrawMiss,
     WarmUpHit,
     WarmUpMiss,
 };
@@ -704,6 +710,18 @@ class GraphicsPipelineDesc final
                                      Pipeline *pipelineOut,
                                      CacheLookUpFeedback *feedbackOut) const;
 
+    // Link a complete pipeline out of subset libraries previously created by
+    // initializePipeline().  All state comes from the libraries, so this is a fast link;
+    // VK_EXT_graphics_pipeline_library support is required.
+    angle::Result initializePipelineFromLibraries(Context *context,
+                                                  PipelineCacheAccess *pipelineCache,
+                                                  const PipelineLayout &pipelineLayout,
+                                                  const Pipeline &vertexInputLibrary,
+                                                  const Pipeline &shadersLibrary,
+                                                  const Pipeline &fragmentOutputLibrary,
+                                                  Pipeline *pipelineOut,
+                                                  CacheLookUpFeedback *feedbackOut) const;
+
     // Vertex input state. For ES 3.1 this should be separated into binding and attribute.
     void updateVertexInput(ContextVk *contextVk,
                            GraphicsPipelineTransitionBits *transition,
@@ -1588,17 +1606,21 @@ class DescriptorSetDescBuilder final
     angle::FastMap<uint32_t, kFastDescriptorSetDescLimit> mDynamicOffsets;
     uint32_t mCurrentInfoIndex = 0;
 
-    // Track textures and buffers that used for this descriptorSet.
-    std::vector<TextureVk *> mUsedImages;
-    std::vector<BufferBlock *> mUsedBufferBlocks;
-    std::vector<BufferHelper *> mUsedBufferHelpers;
+    // Track textures and buffers that used for this descriptorSet.  These lists are rebuilt on
+    // every descriptor set update in the draw call path, so they use inline storage to avoid heap
+    // allocations for the common descriptor counts.
+    angle::FastVector<TextureVk *, kFastDescriptorSetDescLimit> mUsedImages;
+    angle::FastVector<BufferBlock *, kFastDescriptorSetDescLimit> mUsedBufferBlocks;
+    angle::FastVector<BufferHelper *, kFastDescriptorSetDescLimit> mUsedBufferHelpers;
 };
 
-// Specialized update for textures.
+// Specialized update for textures.  Units in |promotedSamplers| have their sampler folded into
+// the pipeline layout as an immutable sampler, so sampler identity is left out of their key.
 void UpdatePreCacheActiveTextures(const std::vector<gl::SamplerBinding> &samplerBindings,
                                   const gl::ActiveTextureMask &activeTextures,
                                   const gl::ActiveTextureArray<TextureVk *> &textures,
                                   const gl::SamplerBindingVector &samplers,
+                                  const gl::ActiveTextureMask &promotedSamplers,
                                   DescriptorSetDesc *desc);
 
 // In the FramebufferDesc object:
@@ -1648,6 +1670,12 @@ class FramebufferDesc
         return mSerials[kFramebufferDescColorIndexOffset + index];
     }
 
+    ImageOrBufferViewSubresourceSerial getDepthStencilImageViewSerial()
+    {
+        ASSERT(kFramebufferDescDepthStencilIndex < mSerials.size());
+        return mSerials[kFramebufferDescDepthStencilIndex];
+    }
+
     FramebufferNonResolveAttachmentMask getUnresolveAttachmentMask() const;
     ANGLE_INLINE gl::SrgbWriteControlMode getWriteControlMode() const
     {
@@ -1781,6 +1809,13 @@ class SharedCacheKeyManager
     // Tracks an array of cache keys with refcounting. Note this owns one refcount of
     // SharedCacheKeyT object.
     std::vector<SharedCacheKeyT> mSharedCacheKeys;
+
+    // |addKey| appends instead of scanning the array for an invalidated slot to reuse, so that
+    // retaining a key stays O(1) for objects that participate in many cache entries.  Keys whose
+    // cache entries have since been destroyed are swept out once the array grows past this
+    // watermark, which is then re-derived from the number of surviving keys.
+    static constexpr size_t kMinKeyCompactionSize = 64;
+    size_t mNextKeyCompactionSize                 = kMinKeyCompactionSize;
 };
 
 using FramebufferCacheManager   = SharedCacheKeyManager<SharedFramebufferCacheKey>;
@@ -2042,6 +2077,14 @@ class RenderPassCache final : angle::NonCopyable
                                        const vk::AttachmentOpsArray &attachmentOps,
                                        vk::RenderPass **renderPassOut);
 
+    // Serialize the cache's key stream through the EGL blob cache so that a later run can
+    // pre-create the same render passes before the first frame.
+    void storeKeysInBlobCache(ContextVk *contextVk) const;
+
+    // Load a previously stored key stream and pre-create the corresponding compatible render
+    // passes.  Missing or mismatched blob cache entries are silently ignored.
+    angle::Result warmUpFromBlobCache(ContextVk *contextVk);
+
   private:
     angle::Result getRenderPassWithOpsImpl(ContextVk *contextVk,
                                            const vk::RenderPassDesc &desc,
@@ -2234,15 +2277,36 @@ class GraphicsPipelineCache final : public HasCacheStats<VulkanCacheType::Graphi
                                  const vk::GraphicsPipelineDesc **descPtrOut,
                                  vk::PipelineHelper **pipelineOut);
 
+    // Fast-link a complete pipeline out of subset libraries and place it in the cache.  Only
+    // used with the complete-pipeline cache when VK_EXT_graphics_pipeline_library is supported;
+    // the libraries live in the vertex-input, shaders and fragment-output subset caches.
+    angle::Result linkLibraries(ContextVk *contextVk,
+                                PipelineCacheAccess *pipelineCache,
+                                const vk::PipelineLayout &pipelineLayout,
+                                vk::PipelineHelper *vertexInputPipeline,
+                                vk::PipelineHelper *shadersPipeline,
+                                vk::PipelineHelper *fragmentOutputPipeline,
+                                PipelineSource source,
+                                const vk::GraphicsPipelineDesc &desc,
+                                const vk::GraphicsPipelineDesc **descPtrOut,
+                                vk::PipelineHelper **pipelineOut);
+
     // Helper for VulkanPipelineCachePerf that resets the object without destroying any object.
     void reset() { mPayload.clear(); }
 
   private:
     using KeyEqual = typename GraphicsPipelineCacheTypeHelper<Hash>::KeyEqual;
+    // std::unordered_map for pointer stability; PipelineHelper (and desc) addresses are handed out
+    // and retained across insertions.
     std::unordered_map<vk::GraphicsPipelineDesc, vk::PipelineHelper, Hash, KeyEqual> mPayload;
 };
 
 using CompleteGraphicsPipelineCache = GraphicsPipelineCache<GraphicsPipelineDescCompleteHash>;
+using VertexInputGraphicsPipelineCache =
+    GraphicsPipelineCache<GraphicsPipelineDescVertexInputHash>;
+using ShadersGraphicsPipelineCache = GraphicsPipelineCache<GraphicsPipelineDescShadersHash>;
+using FragmentOutputGraphicsPipelineCache =
+    GraphicsPipelineCache<GraphicsPipelineDescFragmentOutputHash>;
 
 class DescriptorSetLayoutCache final : angle::NonCopyable
 {
@@ -2258,6 +2322,7 @@ class DescriptorSetLayoutCache final : angle::NonCopyable
         vk::BindingPointer<vk::DescriptorSetLayout> *descriptorSetLayoutOut);
 
   private:
+    // std::unordered_map for pointer stability; BindingPointers reference the map elements.
     std::unordered_map<vk::DescriptorSetLayoutDesc, vk::RefCountedDescriptorSetLayout> mPayload;
     CacheStats mCacheStats;
 };
@@ -2276,6 +2341,7 @@ class PipelineLayoutCache final : public HasCacheStats<VulkanCacheType::Pipeline
                                     vk::BindingPointer<vk::PipelineLayout> *pipelineLayoutOut);
 
   private:
+    // std::unordered_map for pointer stability; BindingPointers reference the map elements.
     std::unordered_map<vk::PipelineLayoutDesc, vk::RefCountedPipelineLayout> mPayload;
 };
 
@@ -2292,6 +2358,7 @@ class SamplerCache final : public HasCacheStats<VulkanCacheType::Sampler>
                              vk::SamplerBinding *samplerOut);
 
   private:
+    // std::unordered_map for pointer stability; SamplerBindings reference the map elements.
     std::unordered_map<vk::SamplerDesc, vk::RefCountedSampler> mPayload;
 };
 
@@ -2310,8 +2377,10 @@ class SamplerYcbcrConversionCache final
                                             VkSamplerYcbcrConversion *vkSamplerYcbcrConversionOut);
 
   private:
+    // Lookups copy the VkSamplerYcbcrConversion handle out, so no element address escapes and a
+    // flat map is safe here.
     using SamplerYcbcrConversionMap =
-        std::unordered_map<vk::YcbcrConversionDesc, vk::SamplerYcbcrConversion>;
+        angle::HashMap<vk::YcbcrConversionDesc, vk::SamplerYcbcrConversion>;
     SamplerYcbcrConversionMap mExternalFormatPayload;
     SamplerYcbcrConversionMap mVkFormatPayload;
 };
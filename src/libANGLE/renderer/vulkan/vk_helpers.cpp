@@ -23,6 +23,8 @@
 #include "libANGLE/renderer/vulkan/android/vk_android_utils.h"
 #include "libANGLE/renderer/vulkan/vk_utils.h"
 
+#include "compression_utils_portable.h"
+
 namespace rx
 {
 namespace vk
@@ -37,6 +39,32 @@ constexpr VkClearColorValue kEmulatedInitColorValue = {{0, 0, 0, 1.0f}};
 // We are fine with these values for emulated depth/stencil textures too.
 constexpr VkClearDepthStencilValue kRobustInitDepthStencilValue = {1.0f, 0};
 
+// With the compressStagedImageUpdates feature, staged image updates at least this large are
+// compressed instead of holding a full-size staging allocation until flush.
+constexpr VkDeviceSize kStagedUpdateCompressionThreshold = 1024 * 1024;
+
+// Returns false if compression failed or wouldn't save a meaningful amount of memory, in which
+// case the update is staged uncompressed as usual.
+bool CompressStagedUpdateData(const uint8_t *data, size_t size, angle::MemoryBuffer *compressedData)
+{
+    uLong uncompressedSize       = static_cast<uLong>(size);
+    uLong expectedCompressedSize = zlib_internal::GzipExpectedCompressedSize(uncompressedSize);
+
+    if (!compressedData->resize(expectedCompressedSize))
+    {
+        return false;
+    }
+
+    int zResult = zlib_internal::GzipCompressHelper(compressedData->data(), &expectedCompressedSize,
+                                                    data, uncompressedSize, nullptr, nullptr);
+    if (zResult != Z_OK || expectedCompressedSize >= size / 4 * 3)
+    {
+        return false;
+    }
+
+    return compressedData->resize(expectedCompressedSize);
+}
+
 constexpr VkImageAspectFlags kDepthStencilAspects =
     VK_IMAGE_ASPECT_STENCIL_BIT | VK_IMAGE_ASPECT_DEPTH_BIT;
 
@@ -69,6 +97,46 @@ constexpr gl::ShaderMap<PipelineStage> kPipelineStageShaderMap = {
 
 constexpr size_t kDefaultPoolAllocatorPageSize = 16 * 1024;
 
+// With the predictiveRenderPassStoreOps feature, the number of consecutive render passes after
+// which an attachment's contents were never read before its storeOp is switched to DONT_CARE.
+constexpr uint32_t kStoreOpPredictionPassCount = 8;
+
+// Updates the usage history of one attachment at render pass end.  Returns true if history shows
+// the attachment's stored contents are predictably unused and the store can be elided.
+bool UpdateAttachmentStoreUsage(ImageHelper *image,
+                                RenderPassLoadOp loadOp,
+                                AttachmentStoreUsage *usage)
+{
+    if (image == nullptr || !image->valid())
+    {
+        usage->imageSerial      = kInvalidImageSerial;
+        usage->passesWithoutRead = 0;
+        return false;
+    }
+
+    const uint32_t readCount = image->getReadLayoutTransitionCount();
+
+    // Loading the attachment in this render pass consumes the previously stored contents, as does
+    // any transition to a read layout (sampling, transfer source, present) since the last pass.
+    const bool isSameImage = usage->imageSerial == image->getImageSerial();
+    const bool wasRead =
+        loadOp == RenderPassLoadOp::Load || readCount != usage->readLayoutTransitionCount;
+
+    if (isSameImage && !wasRead)
+    {
+        ++usage->passesWithoutRead;
+    }
+    else
+    {
+        usage->passesWithoutRead = 0;
+    }
+
+    usage->imageSerial               = image->getImageSerial();
+    usage->readLayoutTransitionCount = readCount;
+
+    return usage->passesWithoutRead >= kStoreOpPredictionPassCount;
+}
+
 struct ImageMemoryBarrierData
 {
     char name[44];
@@ -1307,6 +1375,9 @@ CommandBufferHelperCommon::~CommandBufferHelperCommon() {}
 void CommandBufferHelperCommon::initializeImpl(Context *context, CommandPool *commandPool)
 {
     mAllocator.initialize(kDefaultPoolAllocatorPageSize, 1);
+    // Stock the allocator's free page list up front so command recording growth doesn't contend
+    // on the global heap lock while worker threads are replaying other command buffers.
+    mAllocator.preallocatePages(2);
     // Push a scope into the pool allocator so we can easily free and re-init on reset()
     mAllocator.push();
 
@@ -1651,6 +1722,36 @@ void RenderPassCommandBufferHelper::imageRead(ContextVk *contextVk,
         mRenderPassImagesWithLayoutTransition.insert(image->getImageSerial());
     }
 
+    // Estimate the texture fetch footprint of the render pass: the first read of each image adds
+    // its base level's size once.  This is an upper bound on what the pass can pull from the
+    // image, not a fetch count, but it tracks the working set the load/store optimizer and
+    // texture residency decisions act on.
+    if (!image->usedByCommandBuffer(mID))
+    {
+        const angle::Format &format = image->getActualFormat();
+        const VkExtent3D &extents   = image->getExtents();
+
+        uint64_t footprint = 0;
+        if (format.isBlock)
+        {
+            const gl::InternalFormat &formatInfo =
+                gl::GetSizedInternalFormatInfo(format.glInternalFormat);
+            const uint64_t blockCount =
+                static_cast<uint64_t>((extents.width + formatInfo.compressedBlockWidth - 1) /
+                                      formatInfo.compressedBlockWidth) *
+                ((extents.height + formatInfo.compressedBlockHeight - 1) /
+                 formatInfo.compressedBlockHeight) *
+                extents.depth;
+            footprint = blockCount * image->getLayerCount() * formatInfo.pixelBytes;
+        }
+        else
+        {
+            footprint = static_cast<uint64_t>(extents.width) * extents.height * extents.depth *
+                        image->getLayerCount() * format.pixelBytes;
+        }
+        contextVk->getPerfCounters().estimatedTextureFetchBandwidthBytes += footprint;
+    }
+
     // As noted in the header we don't support multiple read layouts for Images.
     // We allow duplicate uses in the RP to accommodate for normal GL sampler usage.
     retainImage(image);
@@ -2127,6 +2228,20 @@ angle::Result RenderPassCommandBufferHelper::beginRenderPassCommandBuffer(Contex
     return getCommandBuffer().begin(contextVk, inheritanceInfo);
 }
 
+void RenderPassCommandBufferHelper::getColorAttachmentImageSerials(
+    angle::FixedVector<ImageSerial, gl::IMPLEMENTATION_MAX_DRAW_BUFFERS> *serialsOut)
+{
+    for (PackedAttachmentIndex index = kAttachmentIndexZero; index < mColorAttachmentsCount;
+         ++index)
+    {
+        const ImageHelper *image = mColorAttachments[index].getImage();
+        if (image != nullptr && serialsOut->size() < serialsOut->max_size())
+        {
+            serialsOut->push_back(image->getImageSerial());
+        }
+    }
+}
+
 angle::Result RenderPassCommandBufferHelper::endRenderPass(ContextVk *contextVk)
 {
     ANGLE_TRY(endRenderPassCommandBuffer(contextVk));
@@ -2268,6 +2383,47 @@ void RenderPassCommandBufferHelper::invalidateRenderPassStencilAttachment(
                                   getRenderPassWriteCommandCount());
 }
 
+void RenderPassCommandBufferHelper::updateAndApplyStoreOpHistory(RenderPassStoreOpHistory *history)
+{
+    ASSERT(mRenderPassStarted);
+
+    const uint32_t currentCmdCount = getRenderPassWriteCommandCount();
+
+    for (PackedAttachmentIndex index = kAttachmentIndexZero; index < mColorAttachmentsCount;
+         ++index)
+    {
+        RenderPassAttachment &attachment   = mColorAttachments[index];
+        const PackedAttachmentOpsDesc &ops = mAttachmentOps[index];
+        if (UpdateAttachmentStoreUsage(attachment.getImage(),
+                                       static_cast<RenderPassLoadOp>(ops.loadOp),
+                                       &history->colorAttachments[index.get()]))
+        {
+            // As far as history shows, the stored contents are never read back; invalidate the
+            // attachment as of the end of the render pass so its storeOp becomes DONT_CARE.  If
+            // the prediction turns out wrong, the contents become undefined for a frame, the read
+            // is counted, and the history falls back to storing.
+            attachment.invalidate(mRenderArea, true, currentCmdCount);
+        }
+    }
+
+    if (mDepthStencilAttachmentIndex != kAttachmentIndexInvalid)
+    {
+        const PackedAttachmentOpsDesc &dsOps = mAttachmentOps[mDepthStencilAttachmentIndex];
+        if (UpdateAttachmentStoreUsage(mDepthAttachment.getImage(),
+                                       static_cast<RenderPassLoadOp>(dsOps.loadOp),
+                                       &history->depthAttachment))
+        {
+            mDepthAttachment.invalidate(mRenderArea, true, currentCmdCount);
+        }
+        if (UpdateAttachmentStoreUsage(mStencilAttachment.getImage(),
+                                       static_cast<RenderPassLoadOp>(dsOps.stencilLoadOp),
+                                       &history->stencilAttachment))
+        {
+            mStencilAttachment.invalidate(mRenderArea, true, currentCmdCount);
+        }
+    }
+}
+
 angle::Result RenderPassCommandBufferHelper::flushToPrimary(Context *context,
                                                             PrimaryCommandBuffer *primary,
                                                             const RenderPass *renderPass)
@@ -2554,6 +2710,7 @@ DynamicBuffer::DynamicBuffer()
     : mUsage(0),
       mHostVisible(false),
       mInitialSize(0),
+      mBufferGeneration(0),
       mNextAllocationOffset(0),
       mSize(0),
       mAlignment(0),
@@ -2565,6 +2722,7 @@ DynamicBuffer::DynamicBuffer(DynamicBuffer &&other)
       mHostVisible(other.mHostVisible),
       mInitialSize(other.mInitialSize),
       mBuffer(std::move(other.mBuffer)),
+      mBufferGeneration(other.mBufferGeneration),
       mNextAllocationOffset(other.mNextAllocationOffset),
       mSize(other.mSize),
       mAlignment(other.mAlignment),
@@ -2704,6 +2862,7 @@ angle::Result DynamicBuffer::allocate(Context *context,
 
     ASSERT(mBuffer->getBlockMemorySize() == mSize);
 
+    ++mBufferGeneration;
     mNextAllocationOffset = 0;
 
     ASSERT(mBuffer != nullptr);
@@ -2837,6 +2996,7 @@ BufferPool::BufferPool()
       mSize(0),
       mMemoryTypeIndex(0),
       mTotalMemorySize(0),
+      mMaxTotalMemorySize(0),
       mNumberOfNewBuffersNeededSinceLastPrune(0)
 {}
 
@@ -2992,6 +3152,7 @@ angle::Result BufferPool::allocateNewBuffer(Context *context, VkDeviceSize sizeI
     }
 
     mTotalMemorySize += block->getMemorySize();
+    mMaxTotalMemorySize = std::max(mMaxTotalMemorySize, mTotalMemorySize);
     // Append the bufferBlock into the pool
     mBufferBlocks.push_back(std::move(block));
     context->getPerfCounters().allocateNewBufferBlockCalls++;
@@ -3141,6 +3302,18 @@ VkDeviceSize BufferPool::getTotalEmptyMemorySize() const
     return totalMemorySize;
 }
 
+VkDeviceSize BufferPool::getTotalUnusedMemorySize() const
+{
+    VkDeviceSize totalUnusedBytes = 0;
+    for (const std::unique_ptr<BufferBlock> &block : mBufferBlocks)
+    {
+        vma::StatInfo statInfo;
+        block->calculateStats(&statInfo);
+        totalUnusedBytes += statInfo.unusedBytes;
+    }
+    return totalUnusedBytes + getTotalEmptyMemorySize();
+}
+
 void BufferPool::addStats(std::ostringstream *out) const
 {
     VkDeviceSize totalUnusedBytes = 0;
@@ -3155,7 +3328,8 @@ void BufferPool::addStats(std::ostringstream *out) const
         totalMemorySize += block->getMemorySize();
     }
     *out << "]"
-         << " total: " << totalUnusedBytes << "/" << totalMemorySize;
+         << " total: " << totalUnusedBytes << "/" << totalMemorySize
+         << " max: " << mMaxTotalMemorySize;
     *out << " emptyBuffers [memorySize:" << getTotalEmptyMemorySize()
          << " count:" << mEmptyBufferBlocks.size()
          << " needed: " << mNumberOfNewBuffersNeededSinceLastPrune << "]";
@@ -3169,6 +3343,7 @@ DescriptorPoolHelper::~DescriptorPoolHelper()
     // Caller must have already freed all caches. Clear call will assert that.
     mDescriptorSetCacheManager.clear();
     ASSERT(mDescriptorSetGarbageList.empty());
+    ASSERT(mDescriptorSetGarbageGenerations.empty());
 }
 
 angle::Result DescriptorPoolHelper::init(Context *context,
@@ -3181,6 +3356,7 @@ angle::Result DescriptorPoolHelper::init(Context *context,
     // be destroyed.
     mDescriptorSetCacheManager.destroyKeys(renderer);
     mDescriptorSetGarbageList.clear();
+    mDescriptorSetGarbageGenerations.clear();
 
     if (mDescriptorPool.valid())
     {
@@ -3215,12 +3391,14 @@ void DescriptorPoolHelper::destroy(RendererVk *renderer)
 {
     mDescriptorSetCacheManager.destroyKeys(renderer);
     mDescriptorSetGarbageList.clear();
+    mDescriptorSetGarbageGenerations.clear();
     mDescriptorPool.destroy(renderer->getDevice());
 }
 
 void DescriptorPoolHelper::release(RendererVk *renderer)
 {
     mDescriptorSetGarbageList.clear();
+    mDescriptorSetGarbageGenerations.clear();
 
     GarbageList garbageList;
     garbageList.emplace_back(GetGarbage(&mDescriptorPool));
@@ -3232,7 +3410,29 @@ bool DescriptorPoolHelper::allocateDescriptorSet(Context *context,
                                                  const DescriptorSetLayout &descriptorSetLayout,
                                                  VkDescriptorSet *descriptorSetsOut)
 {
-    // Try to reuse descriptorSet garbage first
+    // Try to reuse descriptorSet garbage first.  The generation buckets are keyed by last-use
+    // serial, so the oldest generation is recycled first and retires in O(1).
+    if (!mDescriptorSetGarbageGenerations.empty())
+    {
+        RendererVk *rendererVk          = context->getRenderer();
+        Serial lastCompletedQueueSerial = rendererVk->getLastCompletedQueueSerial();
+
+        auto oldestGeneration = mDescriptorSetGarbageGenerations.begin();
+        if (oldestGeneration->first <= lastCompletedQueueSerial)
+        {
+            std::vector<VkDescriptorSet> &descriptorSets = oldestGeneration->second;
+            ASSERT(!descriptorSets.empty());
+            *descriptorSetsOut = descriptorSets.back();
+            descriptorSets.pop_back();
+            if (descriptorSets.empty())
+            {
+                mDescriptorSetGarbageGenerations.erase(oldestGeneration);
+            }
+            mValidDescriptorSets++;
+            return true;
+        }
+    }
+
     if (!mDescriptorSetGarbageList.empty())
     {
         RendererVk *rendererVk          = context->getRenderer();
@@ -3270,7 +3470,10 @@ bool DescriptorPoolHelper::allocateDescriptorSet(Context *context,
 
 // DynamicDescriptorPool implementation.
 DynamicDescriptorPool::DynamicDescriptorPool()
-    : mCurrentPoolIndex(0), mCachedDescriptorSetLayout(VK_NULL_HANDLE)
+    : mCurrentPoolIndex(0),
+      mSetsAllocatedThisFrame(0),
+      mPeakSetsPerFrame(0),
+      mCachedDescriptorSetLayout(VK_NULL_HANDLE)
 {}
 
 DynamicDescriptorPool::~DynamicDescriptorPool()
@@ -3289,6 +3492,8 @@ DynamicDescriptorPool &DynamicDescriptorPool::operator=(DynamicDescriptorPool &&
     std::swap(mCurrentPoolIndex, other.mCurrentPoolIndex);
     std::swap(mDescriptorPools, other.mDescriptorPools);
     std::swap(mPoolSizes, other.mPoolSizes);
+    std::swap(mSetsAllocatedThisFrame, other.mSetsAllocatedThisFrame);
+    std::swap(mPeakSetsPerFrame, other.mPeakSetsPerFrame);
     std::swap(mCachedDescriptorSetLayout, other.mCachedDescriptorSetLayout);
     std::swap(mDescriptorSetCache, other.mDescriptorSetCache);
     return *this;
@@ -3339,6 +3544,9 @@ angle::Result DynamicDescriptorPool::allocateDescriptorSet(
     ASSERT(!mDescriptorPools.empty());
     ASSERT(descriptorSetLayout.getHandle() == mCachedDescriptorSetLayout);
 
+    // Every path below hands out exactly one set; feed the per-frame demand tracker.
+    ++mSetsAllocatedThisFrame;
+
     // First try to allocate from the same pool
     if (bindingOut->valid() &&
         bindingOut->get().allocateDescriptorSet(context, descriptorSetLayout, descriptorSetOut))
@@ -3451,7 +3659,34 @@ angle::Result DynamicDescriptorPool::allocateNewPool(Context *context)
         mMaxSetsPerPool *= mMaxSetsPerPoolMultiplier;
     }
 
-    return mDescriptorPools[mCurrentPoolIndex]->get().init(context, mPoolSizes, mMaxSetsPerPool);
+    // Predictive sizing: additionally make sure a single pool can absorb the peak per-frame
+    // demand observed on this pool, so a widget-count explosion doesn't force a second pool
+    // allocation in the same frame.
+    uint32_t setsPerPool = mMaxSetsPerPool;
+    while (setsPerPool < kMaxSetsPerPoolMax && setsPerPool < mPeakSetsPerFrame)
+    {
+        setsPerPool *= mMaxSetsPerPoolMultiplier;
+    }
+
+    ++context->getPerfCounters().descriptorPoolAllocations;
+
+    return mDescriptorPools[mCurrentPoolIndex]->get().init(context, mPoolSizes, setsPerPool);
+}
+
+angle::Result DynamicDescriptorPool::prepareForNextFrame(Context *context)
+{
+    mPeakSetsPerFrame       = std::max(mPeakSetsPerFrame, mSetsAllocatedThisFrame);
+    mSetsAllocatedThisFrame = 0;
+
+    // If what's left in the current pool can't cover another frame like the peak one, allocate
+    // the next pool now, outside any draw sequence.
+    if (!mDescriptorPools.empty() && mDescriptorPools[mCurrentPoolIndex]->get().valid() &&
+        mDescriptorPools[mCurrentPoolIndex]->get().getFreeDescriptorSets() < mPeakSetsPerFrame)
+    {
+        ANGLE_TRY(allocateNewPool(context));
+    }
+
+    return angle::Result::Continue;
 }
 
 void DynamicDescriptorPool::releaseCachedDescriptorSet(ContextVk *contextVk,
@@ -3650,10 +3885,17 @@ DynamicQueryPool::DynamicQueryPool() = default;
 
 DynamicQueryPool::~DynamicQueryPool() = default;
 
-angle::Result DynamicQueryPool::init(ContextVk *contextVk, VkQueryType type, uint32_t poolSize)
+angle::Result DynamicQueryPool::init(ContextVk *contextVk,
+                                     VkQueryType type,
+                                     uint32_t poolSize,
+                                     VkQueryPipelineStatisticFlags pipelineStatistics)
 {
+    // Pipeline statistics queries (and only those) must specify which statistics to collect.
+    ASSERT((type == VK_QUERY_TYPE_PIPELINE_STATISTICS) == (pipelineStatistics != 0));
+
     ANGLE_TRY(initEntryPool(contextVk, poolSize));
-    mQueryType = type;
+    mQueryType          = type;
+    mPipelineStatistics = pipelineStatistics;
     return angle::Result::Continue;
 }
 
@@ -3691,12 +3933,7 @@ angle::Result DynamicQueryPool::allocatePoolImpl(ContextVk *contextVk,
     queryPoolInfo.flags                 = 0;
     queryPoolInfo.queryType             = this->mQueryType;
     queryPoolInfo.queryCount            = entriesToAllocate;
-    queryPoolInfo.pipelineStatistics    = 0;
-
-    if (this->mQueryType == VK_QUERY_TYPE_PIPELINE_STATISTICS)
-    {
-        queryPoolInfo.pipelineStatistics = VK_QUERY_PIPELINE_STATISTIC_CLIPPING_INVOCATIONS_BIT;
-    }
+    queryPoolInfo.pipelineStatistics    = this->mPipelineStatistics;
 
     ANGLE_VK_TRY(contextVk, poolToAllocate.init(contextVk->getDevice(), queryPoolInfo));
     return angle::Result::Continue;
@@ -4120,9 +4357,11 @@ angle::Result LineLoopHelper::getIndexBufferForElementArrayBuffer(ContextVk *con
                                                                   BufferHelper **bufferOut,
                                                                   uint32_t *indexCountOut)
 {
-    if (glIndexType == gl::DrawElementsType::UnsignedByte ||
-        contextVk->getState().isPrimitiveRestartEnabled())
+    if (contextVk->getState().isPrimitiveRestartEnabled())
     {
+        // With primitive restart, the number of output indices depends on the index values
+        // themselves, but a direct draw needs the index count at record time.  The indices have to
+        // be inspected on the CPU; data-dependent counts are only possible with indirect draws.
         ANGLE_TRACE_EVENT0("gpu.angle", "LineLoopHelper::getIndexBufferForElementArrayBuffer");
 
         void *srcDataMapping = nullptr;
@@ -4134,6 +4373,43 @@ angle::Result LineLoopHelper::getIndexBufferForElementArrayBuffer(ContextVk *con
         return angle::Result::Continue;
     }
 
+    if (contextVk->shouldConvertUint8VkIndexType(glIndexType))
+    {
+        // Expand the unsigned byte indices to unsigned short on the GPU, then close the loop by
+        // copying the first converted index to the end.  This used to map the buffer and convert
+        // on the CPU, which stalls if the buffer is GPU-visible only or in use.
+        *indexCountOut = indexCount + 1;
+
+        size_t allocateBytes = sizeof(uint16_t) * (static_cast<size_t>(indexCount) + 1);
+        ANGLE_TRY(mDynamicIndexBuffer.allocateForVertexConversion(contextVk, allocateBytes,
+                                                                  MemoryHostVisibility::NonVisible));
+
+        UtilsVk::ConvertIndexParameters params = {};
+        params.srcOffset                       = static_cast<uint32_t>(elementArrayOffset);
+        params.dstOffset                       = 0;
+        params.maxIndex                        = static_cast<uint32_t>(indexCount);
+
+        ANGLE_TRY(contextVk->getUtils().convertIndexBuffer(
+            contextVk, &mDynamicIndexBuffer, &elementArrayBufferVk->getBuffer(), params));
+
+        VkBufferCopy copy = {mDynamicIndexBuffer.getOffset(),
+                             mDynamicIndexBuffer.getOffset() + sizeof(uint16_t) * indexCount,
+                             sizeof(uint16_t)};
+
+        vk::CommandBufferAccess access;
+        access.onBufferSelfCopy(&mDynamicIndexBuffer);
+
+        vk::OutsideRenderPassCommandBuffer *commandBuffer;
+        ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(access, &commandBuffer));
+
+        commandBuffer->copyBuffer(mDynamicIndexBuffer.getBuffer(), mDynamicIndexBuffer.getBuffer(),
+                                  1, &copy);
+
+        *bufferOut = &mDynamicIndexBuffer;
+
+        return angle::Result::Continue;
+    }
+
     *indexCountOut = indexCount + 1;
 
     size_t unitSize = contextVk->getVkIndexTypeSize(glIndexType);
@@ -4764,6 +5040,13 @@ angle::Result BufferHelper::copyFromBuffer(ContextVk *contextVk,
 
     commandBuffer->copyBuffer(srcBuffer->getBuffer(), getBuffer(), regionCount, copyRegions);
 
+    VkDeviceSize copiedBytes = 0;
+    for (uint32_t regionIndex = 0; regionIndex < regionCount; ++regionIndex)
+    {
+        copiedBytes += copyRegions[regionIndex].size;
+    }
+    contextVk->getPerfCounters().estimatedBufferTransferBandwidthBytes += copiedBytes;
+
     return angle::Result::Continue;
 }
 
@@ -4967,6 +5250,7 @@ ImageHelper::ImageHelper(ImageHelper &&other)
       mCurrentQueueFamilyIndex(other.mCurrentQueueFamilyIndex),
       mLastNonShaderReadOnlyLayout(other.mLastNonShaderReadOnlyLayout),
       mCurrentShaderReadStageMask(other.mCurrentShaderReadStageMask),
+      mReadLayoutTransitionCount(other.mReadLayoutTransitionCount),
       mYcbcrConversionDesc(other.mYcbcrConversionDesc),
       mFirstAllocatedLevel(other.mFirstAllocatedLevel),
       mLayerCount(other.mLayerCount),
@@ -5004,6 +5288,7 @@ void ImageHelper::resetCachedProperties()
     mCurrentQueueFamilyIndex     = std::numeric_limits<uint32_t>::max();
     mLastNonShaderReadOnlyLayout = ImageLayout::Undefined;
     mCurrentShaderReadStageMask  = 0;
+    mReadLayoutTransitionCount   = 0;
     mFirstAllocatedLevel         = gl::LevelIndex(0);
     mLayerCount                  = 0;
     mLevelCount                  = 0;
@@ -6073,6 +6358,16 @@ void ImageHelper::changeLayoutAndQueue(Context *context,
     barrierImpl(context, aspectMask, newLayout, newQueueFamilyIndex, commandBuffer);
 }
 
+void ImageHelper::resetToExternalPreInitialized(uint32_t externalQueueFamilyIndex)
+{
+    mCurrentLayout           = ImageLayout::ExternalPreInitialized;
+    mCurrentQueueFamilyIndex = externalQueueFamilyIndex;
+
+    // The external owner may have modified the image since it was last used, so assume every
+    // subresource has defined content.
+    setEntireContentDefined();
+}
+
 void ImageHelper::acquireFromExternal(ContextVk *contextVk,
                                       uint32_t externalQueueFamilyIndex,
                                       uint32_t rendererQueueFamilyIndex,
@@ -6202,6 +6497,12 @@ void ImageHelper::barrierImpl(Context *context,
     commandBuffer->imageBarrier(srcStageMask, GetImageLayoutDstStageMask(context, transitionTo),
                                 imageMemoryBarrier);
 
+    if (transitionTo.type == ResourceAccess::ReadOnly &&
+        transitionFrom.type != ResourceAccess::ReadOnly)
+    {
+        ++mReadLayoutTransitionCount;
+    }
+
     mCurrentLayout           = newLayout;
     mCurrentQueueFamilyIndex = newQueueFamilyIndex;
 }
@@ -6212,6 +6513,52 @@ template void ImageHelper::barrierImpl<priv::CommandBuffer>(Context *context,
                                                             uint32_t newQueueFamilyIndex,
                                                             priv::CommandBuffer *commandBuffer);
 
+// Mirrors the template above, but merges the transition into |barrier| so the caller can emit one
+// vkCmdPipelineBarrier for a batch of images.
+void ImageHelper::barrierImpl(Context *context,
+                              VkImageAspectFlags aspectMask,
+                              ImageLayout newLayout,
+                              uint32_t newQueueFamilyIndex,
+                              PipelineBarrier *barrier)
+{
+    if (mCurrentLayout == ImageLayout::SharedPresent)
+    {
+        const ImageMemoryBarrierData &transition = kImageMemoryBarrierData[mCurrentLayout];
+        barrier->mergeMemoryBarrier(transition.srcStageMask, transition.dstStageMask,
+                                    transition.srcAccessMask, transition.dstAccessMask);
+        return;
+    }
+
+    // Make sure we never transition out of SharedPresent
+    ASSERT(mCurrentLayout != ImageLayout::SharedPresent || newLayout == ImageLayout::SharedPresent);
+
+    const ImageMemoryBarrierData &transitionFrom = kImageMemoryBarrierData[mCurrentLayout];
+    const ImageMemoryBarrierData &transitionTo   = kImageMemoryBarrierData[newLayout];
+
+    VkImageMemoryBarrier imageMemoryBarrier = {};
+    initImageMemoryBarrierStruct(aspectMask, newLayout, newQueueFamilyIndex, &imageMemoryBarrier);
+
+    // There might be other shaderRead operations there other than the current layout.
+    VkPipelineStageFlags srcStageMask = GetImageLayoutSrcStageMask(context, transitionFrom);
+    if (mCurrentShaderReadStageMask)
+    {
+        srcStageMask |= mCurrentShaderReadStageMask;
+        mCurrentShaderReadStageMask  = 0;
+        mLastNonShaderReadOnlyLayout = ImageLayout::Undefined;
+    }
+    barrier->mergeImageBarrier(srcStageMask, GetImageLayoutDstStageMask(context, transitionTo),
+                               imageMemoryBarrier);
+
+    if (transitionTo.type == ResourceAccess::ReadOnly &&
+        transitionFrom.type != ResourceAccess::ReadOnly)
+    {
+        ++mReadLayoutTransitionCount;
+    }
+
+    mCurrentLayout           = newLayout;
+    mCurrentQueueFamilyIndex = newQueueFamilyIndex;
+}
+
 bool ImageHelper::updateLayoutAndBarrier(Context *context,
                                          VkImageAspectFlags aspectMask,
                                          ImageLayout newLayout,
@@ -6285,6 +6632,12 @@ bool ImageHelper::updateLayoutAndBarrier(Context *context,
                 mLastNonShaderReadOnlyLayout = mCurrentLayout;
                 mCurrentShaderReadStageMask  = dstStageMask;
             }
+
+            if (transitionTo.type == ResourceAccess::ReadOnly &&
+                transitionFrom.type != ResourceAccess::ReadOnly)
+            {
+                ++mReadLayoutTransitionCount;
+            }
         }
         mCurrentLayout = newLayout;
     }
@@ -6677,9 +7030,7 @@ void ImageHelper::removeSingleSubresourceStagedUpdates(ContextVk *contextVk,
         if (update->isUpdateToLayers(layerIndex, layerCount))
         {
             // Update total staging buffer size
-            mTotalStagedBufferUpdateSize -= update->updateSource == UpdateSource::Buffer
-                                                ? update->data.buffer.bufferHelper->getSize()
-                                                : 0;
+            mTotalStagedBufferUpdateSize -= update->getStagedBufferSize();
             update->release(contextVk->getRenderer());
             levelUpdates->erase(update);
         }
@@ -6737,9 +7088,7 @@ void ImageHelper::removeStagedUpdates(Context *context,
         for (SubresourceUpdate &update : *levelUpdates)
         {
             // Update total staging buffer size
-            mTotalStagedBufferUpdateSize -= update.updateSource == UpdateSource::Buffer
-                                                ? update.data.buffer.bufferHelper->getSize()
-                                                : 0;
+            mTotalStagedBufferUpdateSize -= update.getStagedBufferSize();
             update.release(context->getRenderer());
         }
 
@@ -6984,6 +7333,41 @@ angle::Result ImageHelper::stageSubresourceUpdateImpl(ContextVk *contextVk,
     if (aspectFlags)
     {
         copy.imageSubresource.aspectMask = aspectFlags;
+
+        // Applications commonly re-upload identical data, for example glyph atlases and sprite
+        // sheets shared between the contexts of a share group.  If the data just staged matches
+        // the still-pending update of the same region, drop it before it costs a GPU copy.
+        if (stencilAllocationSize == 0 &&
+            isDuplicateOfLastStagedUpdate(updateLevelGL, copy, storageFormat.id, stagingPointer,
+                                          allocationSize))
+        {
+            currentBuffer->release(contextVk->getRenderer());
+            return angle::Result::Continue;
+        }
+
+        // Optionally hold large updates in compressed form so that bursty uploads don't pin
+        // full-size staging allocations until the flush; the payload is decompressed into a fresh
+        // staging buffer right before it's applied.
+        if (contextVk->getFeatures().compressStagedImageUpdates.enabled &&
+            stencilAllocationSize == 0 && allocationSize >= kStagedUpdateCompressionThreshold)
+        {
+            std::unique_ptr<angle::MemoryBuffer> compressedData =
+                std::make_unique<angle::MemoryBuffer>();
+            if (CompressStagedUpdateData(stagingPointer, allocationSize, compressedData.get()))
+            {
+                // The staged data starts at |stagingOffset|, so the offset relative to the
+                // decompressed payload is zero.
+                copy.bufferOffset = 0;
+                currentBuffer->release(contextVk->getRenderer());
+                appendSubresourceUpdate(updateLevelGL,
+                                        SubresourceUpdate(compressedData.release(), allocationSize,
+                                                          copy, storageFormat.id));
+                pruneSupersededUpdatesForLevel(contextVk, updateLevelGL,
+                                               PruneReason::MemoryOptimization);
+                return angle::Result::Continue;
+            }
+        }
+
         appendSubresourceUpdate(updateLevelGL, SubresourceUpdate(stagingBuffer.get(), currentBuffer,
                                                                  copy, storageFormat.id));
         pruneSupersededUpdatesForLevel(contextVk, updateLevelGL, PruneReason::MemoryOptimization);
@@ -7014,6 +7398,13 @@ angle::Result ImageHelper::reformatStagedBufferUpdates(ContextVk *contextVk,
             if (update.updateSource == UpdateSource::Buffer &&
                 update.data.buffer.formatID == srcFormatID)
             {
+                // Compressed updates have no mapped staging memory to read from; materialize them
+                // first.
+                if (update.data.buffer.bufferHelper == nullptr)
+                {
+                    ANGLE_TRY(decompressStagedUpdate(contextVk, &update));
+                }
+
                 const VkBufferImageCopy &copy = update.data.buffer.copyRegion;
 
                 // Source and dst data are tightly packed
@@ -7046,8 +7437,9 @@ angle::Result ImageHelper::reformatStagedBufferUpdates(ContextVk *contextVk,
                 rx::PixelWriteFunction pixelWriteFunction = dstFormat.pixelWriteFunction;
 
                 CopyImageCHROMIUM(srcData, srcDataRowPitch, srcFormat.pixelBytes, srcDataDepthPitch,
-                                  pixelReadFunction, dstData, dstDataRowPitch, dstFormat.pixelBytes,
-                                  dstDataDepthPitch, pixelWriteFunction, dstFormatInfo.format,
+                                  srcFormatID, pixelReadFunction, dstData, dstDataRowPitch,
+                                  dstFormat.pixelBytes, dstDataDepthPitch, dstFormatID,
+                                  pixelWriteFunction, dstFormatInfo.format,
                                   dstFormatInfo.componentType, copy.imageExtent.width,
                                   copy.imageExtent.height, copy.imageExtent.depth, false, false,
                                   false);
@@ -7080,6 +7472,46 @@ angle::Result ImageHelper::reformatStagedBufferUpdates(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
+angle::Result ImageHelper::decompressStagedUpdate(ContextVk *contextVk, SubresourceUpdate *update)
+{
+    BufferUpdate &bufferUpdate = update->data.buffer;
+    ASSERT(update->updateSource == UpdateSource::Buffer && bufferUpdate.bufferHelper == nullptr);
+    ASSERT(bufferUpdate.compressedData != nullptr && update->refCounted.buffer == nullptr);
+
+    std::unique_ptr<RefCounted<BufferHelper>> stagingBuffer =
+        std::make_unique<RefCounted<BufferHelper>>();
+    BufferHelper *currentBuffer = &stagingBuffer->get();
+
+    uint8_t *stagingPointer;
+    VkDeviceSize stagingOffset;
+    ANGLE_TRY(currentBuffer->allocateForCopyImage(contextVk, bufferUpdate.uncompressedSize,
+                                                  MemoryCoherency::NonCoherent,
+                                                  bufferUpdate.formatID, &stagingOffset,
+                                                  &stagingPointer));
+
+    uLong uncompressedSize = static_cast<uLong>(bufferUpdate.uncompressedSize);
+    int zResult            = zlib_internal::GzipUncompressHelper(
+                   stagingPointer, &uncompressedSize, bufferUpdate.compressedData->data(),
+                   static_cast<uLong>(bufferUpdate.compressedData->size()));
+    ANGLE_VK_CHECK(contextVk,
+                   zResult == Z_OK && uncompressedSize == bufferUpdate.uncompressedSize,
+                   VK_ERROR_INITIALIZATION_FAILED);
+
+    // Update total staging buffer size
+    mTotalStagedBufferUpdateSize -= bufferUpdate.compressedData->size();
+    mTotalStagedBufferUpdateSize += currentBuffer->getSize();
+
+    // Replace the compressed payload with the staging buffer; the copy region's bufferOffset was
+    // relative to the decompressed payload.
+    SafeDelete(bufferUpdate.compressedData);
+    bufferUpdate.bufferHelper = currentBuffer;
+    bufferUpdate.copyRegion.bufferOffset += stagingOffset;
+    update->refCounted.buffer = stagingBuffer.release();
+    update->refCounted.buffer->addRef();
+
+    return angle::Result::Continue;
+}
+
 angle::Result ImageHelper::CalculateBufferInfo(ContextVk *contextVk,
                                                const gl::Extents &glExtents,
                                                const gl::InternalFormat &formatInfo,
@@ -7997,7 +8429,8 @@ angle::Result ImageHelper::flushStagedUpdates(ContextVk *contextVk,
         {
             ASSERT(IsClear(update.updateSource) ||
                    (update.updateSource == UpdateSource::Buffer &&
-                    update.data.buffer.bufferHelper != nullptr) ||
+                    (update.data.buffer.bufferHelper != nullptr ||
+                     update.data.buffer.compressedData != nullptr)) ||
                    (update.updateSource == UpdateSource::Image &&
                     update.refCounted.image != nullptr && update.refCounted.image->isReferenced() &&
                     update.refCounted.image->get().valid()));
@@ -8116,6 +8549,13 @@ angle::Result ImageHelper::flushStagedUpdates(ContextVk *contextVk,
             {
                 BufferUpdate &bufferUpdate = update.data.buffer;
 
+                if (bufferUpdate.bufferHelper == nullptr)
+                {
+                    // The payload was staged in compressed form; decompress it into a staging
+                    // buffer now that the update is about to be applied.
+                    ANGLE_TRY(decompressStagedUpdate(contextVk, &update));
+                }
+
                 BufferHelper *currentBuffer = bufferUpdate.bufferHelper;
                 ASSERT(currentBuffer && currentBuffer->valid());
                 ANGLE_TRY(currentBuffer->flush(renderer));
@@ -8427,7 +8867,7 @@ void ImageHelper::pruneSupersededUpdatesForLevel(ContextVk *contextVk,
         {
             currentUpdateBox = gl::Box(update.data.buffer.copyRegion.imageOffset,
                                        update.data.buffer.copyRegion.imageExtent);
-            updateSize       = update.data.buffer.bufferHelper->getSize();
+            updateSize       = update.getStagedBufferSize();
         }
         else if (update.updateSource == UpdateSource::Image)
         {
@@ -8845,17 +9285,21 @@ bool ImageHelper::canCopyWithTransformForReadPixels(const PackPixelsParams &pack
     // Only allow copies to PBOs with identical format.
     const bool isSameFormatCopy = *readFormat == *packPixelsParams.destFormat;
 
-    // Disallow any transformation.
-    const bool needsTransformation =
-        packPixelsParams.rotation != SurfaceRotation::Identity || packPixelsParams.reverseRowOrder;
+    // Disallow rotation; a y-flip, on the other hand, is done by copying the rows in reverse.
+    const bool needsTransformation = packPixelsParams.rotation != SurfaceRotation::Identity;
 
     // Disallow copies when the output pitch cannot be correctly specified in Vulkan.
     const bool isPitchMultipleOfTexelSize =
         packPixelsParams.outputPitch % readFormat->pixelBytes == 0;
 
+    // A y-flip copies every row as its own region, so the per-row buffer offsets additionally
+    // need to satisfy Vulkan's 4-byte buffer offset alignment for copies.
+    const bool canFlipRows =
+        !packPixelsParams.reverseRowOrder || packPixelsParams.outputPitch % 4 == 0;
+
     // Don't allow copies from emulated formats for simplicity.
     return !hasEmulatedImageFormat() && isSameFormatCopy && !needsTransformation &&
-           isPitchMultipleOfTexelSize;
+           isPitchMultipleOfTexelSize && canFlipRows;
 }
 
 angle::Result ImageHelper::readPixels(ContextVk *contextVk,
@@ -9081,8 +9525,33 @@ angle::Result ImageHelper::readPixelsImpl(ContextVk *contextVk,
         region.imageOffset      = srcOffset;
         region.imageSubresource = srcSubresource;
 
+        if (!packPixelsParams.reverseRowOrder)
+        {
+            copyCommandBuffer->copyImageToBuffer(src->getImage(), src->getCurrentLayout(),
+                                                 packBuffer.getBuffer().getHandle(), 1, &region);
+            return angle::Result::Continue;
+        }
+
+        // A negative buffer pitch can't be expressed in Vulkan, so a y-flipped read copies each
+        // row as its own region with the destination rows in reverse order.  This keeps flipped
+        // reads into a pack buffer — the default framebuffer capture case — on the GPU instead of
+        // falling back to the readback stall and CPU pack below.
+        angle::PoolVector<VkBufferImageCopy> flippedRegions(srcExtent.height, region,
+                                                            contextVk->getState().getFrameArena());
+        for (uint32_t row = 0; row < srcExtent.height; ++row)
+        {
+            VkBufferImageCopy &rowRegion = flippedRegions[row];
+            rowRegion.bufferOffset += static_cast<VkDeviceSize>(srcExtent.height - 1 - row) *
+                                      packPixelsParams.outputPitch;
+            rowRegion.bufferImageHeight = 1;
+            rowRegion.imageOffset.y     = srcOffset.y + static_cast<int32_t>(row);
+            rowRegion.imageExtent.height = 1;
+        }
+
         copyCommandBuffer->copyImageToBuffer(src->getImage(), src->getCurrentLayout(),
-                                             packBuffer.getBuffer().getHandle(), 1, &region);
+                                             packBuffer.getBuffer().getHandle(),
+                                             static_cast<uint32_t>(flippedRegions.size()),
+                                             flippedRegions.data());
         return angle::Result::Continue;
     }
 
@@ -9185,8 +9654,10 @@ angle::Result ImageHelper::packReadPixelBuffer(ContextVk *contextVk,
 // ImageHelper::SubresourceUpdate implementation
 ImageHelper::SubresourceUpdate::SubresourceUpdate() : updateSource(UpdateSource::Buffer)
 {
-    data.buffer.bufferHelper = nullptr;
-    refCounted.buffer        = nullptr;
+    data.buffer.bufferHelper     = nullptr;
+    data.buffer.compressedData   = nullptr;
+    data.buffer.uncompressedSize = 0;
+    refCounted.buffer            = nullptr;
 }
 
 ImageHelper::SubresourceUpdate::~SubresourceUpdate() {}
@@ -9202,9 +9673,25 @@ ImageHelper::SubresourceUpdate::SubresourceUpdate(RefCounted<BufferHelper> *buff
     {
         refCounted.buffer->addRef();
     }
-    data.buffer.bufferHelper = bufferHelperIn;
-    data.buffer.copyRegion   = copyRegionIn;
-    data.buffer.formatID     = formatID;
+    data.buffer.bufferHelper     = bufferHelperIn;
+    data.buffer.compressedData   = nullptr;
+    data.buffer.uncompressedSize = 0;
+    data.buffer.copyRegion       = copyRegionIn;
+    data.buffer.formatID         = formatID;
+}
+
+ImageHelper::SubresourceUpdate::SubresourceUpdate(angle::MemoryBuffer *compressedDataIn,
+                                                  size_t uncompressedSizeIn,
+                                                  const VkBufferImageCopy &copyRegionIn,
+                                                  angle::FormatID formatID)
+    : updateSource(UpdateSource::Buffer)
+{
+    refCounted.buffer            = nullptr;
+    data.buffer.bufferHelper     = nullptr;
+    data.buffer.compressedData   = compressedDataIn;
+    data.buffer.uncompressedSize = uncompressedSizeIn;
+    data.buffer.copyRegion       = copyRegionIn;
+    data.buffer.formatID         = formatID;
 }
 
 ImageHelper::SubresourceUpdate::SubresourceUpdate(RefCounted<ImageHelper> *imageIn,
@@ -9272,9 +9759,10 @@ ImageHelper::SubresourceUpdate::SubresourceUpdate(SubresourceUpdate &&other)
             refCounted.buffer = nullptr;
             break;
         case UpdateSource::Buffer:
-            data.buffer             = other.data.buffer;
-            refCounted.buffer       = other.refCounted.buffer;
-            other.refCounted.buffer = nullptr;
+            data.buffer                      = other.data.buffer;
+            refCounted.buffer                = other.refCounted.buffer;
+            other.data.buffer.compressedData = nullptr;
+            other.refCounted.buffer          = nullptr;
             break;
         case UpdateSource::Image:
             data.image             = other.data.image;
@@ -9324,17 +9812,22 @@ void ImageHelper::SubresourceUpdate::release(RendererVk *renderer)
 
         refCounted.image = nullptr;
     }
-    else if (updateSource == UpdateSource::Buffer && refCounted.buffer != nullptr)
+    else if (updateSource == UpdateSource::Buffer)
     {
-        refCounted.buffer->releaseRef();
-
-        if (!refCounted.buffer->isReferenced())
+        if (refCounted.buffer != nullptr)
         {
-            refCounted.buffer->get().release(renderer);
-            SafeDelete(refCounted.buffer);
+            refCounted.buffer->releaseRef();
+
+            if (!refCounted.buffer->isReferenced())
+            {
+                refCounted.buffer->get().release(renderer);
+                SafeDelete(refCounted.buffer);
+            }
+
+            refCounted.buffer = nullptr;
         }
 
-        refCounted.buffer = nullptr;
+        SafeDelete(data.buffer.compressedData);
     }
 }
 
@@ -9391,6 +9884,16 @@ VkImageAspectFlags ImageHelper::SubresourceUpdate::getDestAspectFlags() const
     }
 }
 
+VkDeviceSize ImageHelper::SubresourceUpdate::getStagedBufferSize() const
+{
+    if (updateSource != UpdateSource::Buffer)
+    {
+        return 0;
+    }
+    return data.buffer.bufferHelper != nullptr ? data.buffer.bufferHelper->getSize()
+                                               : data.buffer.compressedData->size();
+}
+
 std::vector<ImageHelper::SubresourceUpdate> *ImageHelper::getLevelUpdates(gl::LevelIndex level)
 {
     return static_cast<size_t>(level.get()) < mSubresourceUpdates.size()
@@ -9406,6 +9909,57 @@ const std::vector<ImageHelper::SubresourceUpdate> *ImageHelper::getLevelUpdates(
                : nullptr;
 }
 
+bool ImageHelper::isDuplicateOfLastStagedUpdate(gl::LevelIndex level,
+                                                const VkBufferImageCopy &copy,
+                                                angle::FormatID formatID,
+                                                const uint8_t *data,
+                                                size_t dataSize) const
+{
+    const std::vector<SubresourceUpdate> *levelUpdates = getLevelUpdates(level);
+    if (levelUpdates == nullptr || levelUpdates->empty())
+    {
+        return false;
+    }
+
+    // Only the most recent update can be compared against; an older identical update may have
+    // been partially overwritten by an update staged in between.
+    const SubresourceUpdate &lastUpdate = levelUpdates->back();
+    if (lastUpdate.updateSource != UpdateSource::Buffer ||
+        lastUpdate.data.buffer.formatID != formatID)
+    {
+        return false;
+    }
+
+    const VkBufferImageCopy &lastCopy = lastUpdate.data.buffer.copyRegion;
+    if (lastCopy.bufferRowLength != copy.bufferRowLength ||
+        lastCopy.bufferImageHeight != copy.bufferImageHeight ||
+        lastCopy.imageSubresource.aspectMask != copy.imageSubresource.aspectMask ||
+        lastCopy.imageSubresource.mipLevel != copy.imageSubresource.mipLevel ||
+        lastCopy.imageSubresource.baseArrayLayer != copy.imageSubresource.baseArrayLayer ||
+        lastCopy.imageSubresource.layerCount != copy.imageSubresource.layerCount ||
+        memcmp(&lastCopy.imageOffset, &copy.imageOffset, sizeof(copy.imageOffset)) != 0 ||
+        memcmp(&lastCopy.imageExtent, &copy.imageExtent, sizeof(copy.imageExtent)) != 0)
+    {
+        return false;
+    }
+
+    // Staging buffers stay mapped until the update is flushed, so the pending data can be
+    // compared directly.  Compressed updates have no mapped staging memory to compare against.
+    const BufferHelper *lastBuffer = lastUpdate.data.buffer.bufferHelper;
+    if (lastBuffer == nullptr)
+    {
+        return false;
+    }
+
+    const VkDeviceSize lastDataOffset = lastCopy.bufferOffset - lastBuffer->getOffset();
+    if (!lastBuffer->isMapped() || lastDataOffset + dataSize > lastBuffer->getSize())
+    {
+        return false;
+    }
+
+    return memcmp(lastBuffer->getMappedMemory() + lastDataOffset, data, dataSize) == 0;
+}
+
 void ImageHelper::appendSubresourceUpdate(gl::LevelIndex level, SubresourceUpdate &&update)
 {
     if (mSubresourceUpdates.size() <= static_cast<size_t>(level.get()))
@@ -9413,9 +9967,7 @@ void ImageHelper::appendSubresourceUpdate(gl::LevelIndex level, SubresourceUpdat
         mSubresourceUpdates.resize(level.get() + 1);
     }
     // Update total staging buffer size
-    mTotalStagedBufferUpdateSize += update.updateSource == UpdateSource::Buffer
-                                        ? update.data.buffer.bufferHelper->getSize()
-                                        : 0;
+    mTotalStagedBufferUpdateSize += update.getStagedBufferSize();
     mSubresourceUpdates[level.get()].emplace_back(std::move(update));
     onStateChange(angle::SubjectMessage::SubjectChanged);
 }
@@ -9428,9 +9980,7 @@ void ImageHelper::prependSubresourceUpdate(gl::LevelIndex level, SubresourceUpda
     }
 
     // Update total staging buffer size
-    mTotalStagedBufferUpdateSize += update.updateSource == UpdateSource::Buffer
-                                        ? update.data.buffer.bufferHelper->getSize()
-                                        : 0;
+    mTotalStagedBufferUpdateSize += update.getStagedBufferSize();
     mSubresourceUpdates[level.get()].insert(mSubresourceUpdates[level.get()].begin(),
                                             std::move(update));
     onStateChange(angle::SubjectMessage::SubjectChanged);
@@ -10052,6 +10602,87 @@ ImageSubresourceRange MakeImageSubresourceDrawRange(gl::LevelIndex level,
     return range;
 }
 
+// DepthStencilImagePool implementation.
+std::unique_ptr<DepthStencilImagePool::Entry> DepthStencilImagePool::acquire(
+    RendererVk *renderer,
+    const void *owner,
+    const VkExtent3D &extents,
+    angle::FormatID actualFormatID,
+    GLint samples,
+    bool hasProtectedContent)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    auto matches = [&](const std::unique_ptr<Entry> &entry) {
+        const VkExtent3D &entryExtents = entry->image.getExtents();
+        return entryExtents.width == extents.width && entryExtents.height == extents.height &&
+               entry->image.getActualFormatID() == actualFormatID &&
+               entry->image.getSamples() == samples &&
+               entry->hasProtectedContent == hasProtectedContent;
+    };
+
+    // Prefer the entry this surface itself released.
+    for (auto iter = mEntries.begin(); iter != mEntries.end(); ++iter)
+    {
+        if ((*iter)->lastOwner == owner && matches(*iter))
+        {
+            std::unique_ptr<Entry> entry = std::move(*iter);
+            mEntries.erase(iter);
+            return entry;
+        }
+    }
+
+    // Otherwise, only hand over an image the GPU is known to be done with.
+    const Serial lastCompletedSerial = renderer->getLastCompletedQueueSerial();
+    for (auto iter = mEntries.begin(); iter != mEntries.end(); ++iter)
+    {
+        if (matches(*iter) && !(*iter)->image.isCurrentlyInUse(lastCompletedSerial))
+        {
+            std::unique_ptr<Entry> entry = std::move(*iter);
+            mEntries.erase(iter);
+            return entry;
+        }
+    }
+
+    return nullptr;
+}
+
+void DepthStencilImagePool::recycle(RendererVk *renderer,
+                                    const void *owner,
+                                    std::unique_ptr<Entry> entry)
+{
+    entry->lastOwner = owner;
+
+    std::unique_ptr<Entry> evicted;
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mEntries.push_back(std::move(entry));
+        if (mEntries.size() > kMaxEntries)
+        {
+            evicted = std::move(mEntries.front());
+            mEntries.erase(mEntries.begin());
+        }
+    }
+
+    if (evicted)
+    {
+        // Queue the image and its views for destruction once the GPU is done with them.
+        evicted->image.collectViewGarbage(renderer, &evicted->imageViews);
+        evicted->image.releaseImage(renderer);
+    }
+}
+
+void DepthStencilImagePool::destroy(RendererVk *renderer)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    for (std::unique_ptr<Entry> &entry : mEntries)
+    {
+        entry->image.destroy(renderer);
+        entry->imageViews.destroy(renderer->getDevice());
+    }
+    mEntries.clear();
+}
+
 // BufferViewHelper implementation.
 BufferViewHelper::BufferViewHelper() : mOffset(0), mSize(0) {}
 
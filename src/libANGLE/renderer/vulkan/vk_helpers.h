@@ -98,6 +98,11 @@ class DynamicBuffer : angle::NonCopyable
 
     BufferHelper *getCurrentBuffer() const { return mBuffer.get(); }
 
+    // Distinguishes two tenures of the same buffer.  Unlike the buffer serial, this changes when
+    // a retired buffer is picked back up from the free list, at which point allocation restarts
+    // from the beginning and previously written regions get overwritten.
+    uint32_t getBufferGeneration() const { return mBufferGeneration; }
+
     // **Accumulate** an alignment requirement.  A dynamic buffer is used as the staging buffer for
     // image uploads, which can contain updates to unrelated mips, possibly with different formats.
     // The staging buffer should have an alignment that can satisfy all those formats, i.e. it's the
@@ -123,6 +128,7 @@ class DynamicBuffer : angle::NonCopyable
     bool mHostVisible;
     size_t mInitialSize;
     std::unique_ptr<BufferHelper> mBuffer;
+    uint32_t mBufferGeneration;
     uint32_t mNextAllocationOffset;
     size_t mSize;
     size_t mAlignment;
@@ -144,6 +150,7 @@ class DescriptorSetHelper final : public Resource
     }
 
     VkDescriptorSet getDescriptorSet() const { return mDescriptorSet; }
+    Serial getSerial() const { return mUse.getSerial(); }
 
   private:
     VkDescriptorSet mDescriptorSet;
@@ -179,7 +186,20 @@ class DescriptorPoolHelper final : public Resource
     void addGarbage(DescriptorSetHelper &&garbage)
     {
         mValidDescriptorSets--;
-        mDescriptorSetGarbageList.emplace_back(std::move(garbage));
+        if (garbage.usedInRecordedCommands())
+        {
+            // The final queue serial isn't known until the commands are flushed; such sets go
+            // through the unordered garbage list.
+            mDescriptorSetGarbageList.emplace_back(std::move(garbage));
+        }
+        else
+        {
+            // Bucket the set by the serial of its last GPU use (its "generation") so allocation
+            // can recycle from the oldest retired generation in O(1), even when sets are
+            // released out of serial order.
+            mDescriptorSetGarbageGenerations[garbage.getSerial()].push_back(
+                garbage.getDescriptorSet());
+        }
     }
 
     void onNewDescriptorSetAllocated(const vk::SharedDescriptorSetCacheKey &sharedCacheKey)
@@ -187,6 +207,7 @@ class DescriptorPoolHelper final : public Resource
         mDescriptorSetCacheManager.addKey(sharedCacheKey);
     }
     bool hasValidDescriptorSet() const { return mValidDescriptorSets != 0; }
+    uint32_t getFreeDescriptorSets() const { return mFreeDescriptorSets; }
 
   private:
     // Track the number of descriptorSets allocated out of this pool that are valid. DescriptorSets
@@ -200,6 +221,10 @@ class DescriptorPoolHelper final : public Resource
     // list in the renderer to avoid complicated threading issues and other weirdness associated
     // with pooled object destruction. This list is mutually exclusive with mDescriptorSetCache.
     DescriptorSetList mDescriptorSetGarbageList;
+    // Released descriptor sets with a known last-use serial, bucketed by that serial.  The
+    // oldest generation is recycled first once the GPU has moved past it, keeping steady-state
+    // descriptor set allocation free of vkAllocateDescriptorSets calls.
+    std::map<Serial, std::vector<VkDescriptorSet>> mDescriptorSetGarbageGenerations;
     // Manages the texture descriptor set cache that allocated from this pool
     vk::DescriptorSetCacheManager mDescriptorSetCacheManager;
 };
@@ -258,6 +283,11 @@ class DynamicDescriptorPool final : angle::NonCopyable
     // Release the pool if it is no longer been used and contains no valid descriptorSet.
     void checkAndReleaseUnusedPool(RendererVk *renderer, RefCountedDescriptorPoolHelper *pool);
 
+    // Called once per frame, at swap time.  Folds this frame's allocation count into the
+    // observed per-frame peak and, if the current pool cannot absorb another frame like the peak
+    // one, allocates the next pool now so growth doesn't happen inside a draw sequence.
+    angle::Result prepareForNextFrame(Context *context);
+
     // For testing only!
     static uint32_t GetMaxSetsPerPoolForTesting();
     static void SetMaxSetsPerPoolForTesting(uint32_t maxSetsPerPool);
@@ -273,6 +303,11 @@ class DynamicDescriptorPool final : angle::NonCopyable
     size_t mCurrentPoolIndex;
     std::vector<std::unique_ptr<RefCountedDescriptorPoolHelper>> mDescriptorPools;
     std::vector<VkDescriptorPoolSize> mPoolSizes;
+    // Descriptor sets allocated (not served from the cache) since the last frame boundary, and
+    // the largest such count seen on any frame.  The peak informs the size of newly created
+    // pools and when to pre-allocate one at swap time.
+    uint32_t mSetsAllocatedThisFrame;
+    uint32_t mPeakSetsPerFrame;
     // This cached handle is used for verifying the layout being used to allocate descriptor sets
     // from the pool matches the layout that the pool was created for, to ensure that the free
     // descriptor count is accurate and new pools are created appropriately.
@@ -323,6 +358,16 @@ class MetaDescriptorPool final : angle::NonCopyable
         }
     }
 
+    angle::Result prepareForNextFrame(Context *context)
+    {
+        for (auto &iter : mPayload)
+        {
+            RefCountedDescriptorPool &pool = iter.second;
+            ANGLE_TRY(pool.get().prepareForNextFrame(context));
+        }
+        return angle::Result::Continue;
+    }
+
     size_t getTotalCacheKeySizeBytes() const
     {
         size_t totalSize = 0;
@@ -420,6 +465,14 @@ constexpr uint32_t kDefaultOcclusionQueryPoolSize           = 64;
 constexpr uint32_t kDefaultTimestampQueryPoolSize           = 64;
 constexpr uint32_t kDefaultTransformFeedbackQueryPoolSize   = 128;
 constexpr uint32_t kDefaultPrimitivesGeneratedQueryPoolSize = 128;
+constexpr uint32_t kDefaultOverlayPipelineStatsQueryPoolSize = 48;
+
+// The pipeline statistics gathered by the overlay's per-render-pass query.  Declared here because
+// the flags are needed both to create the query pool and to declare the statistics in secondary
+// command buffer inheritance info.
+constexpr VkQueryPipelineStatisticFlags kOverlayPipelineStatistics =
+    VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT |
+    VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT;
 
 class QueryHelper;
 
@@ -429,7 +482,11 @@ class DynamicQueryPool final : public DynamicallyGrowingPool<QueryPool>
     DynamicQueryPool();
     ~DynamicQueryPool() override;
 
-    angle::Result init(ContextVk *contextVk, VkQueryType type, uint32_t poolSize);
+    // Pipeline statistics query pools must additionally specify which statistics to collect.
+    angle::Result init(ContextVk *contextVk,
+                       VkQueryType type,
+                       uint32_t poolSize,
+                       VkQueryPipelineStatisticFlags pipelineStatistics = 0);
     void destroy(VkDevice device);
 
     angle::Result allocateQuery(ContextVk *contextVk, QueryHelper *queryOut, uint32_t queryCount);
@@ -445,6 +502,7 @@ class DynamicQueryPool final : public DynamicallyGrowingPool<QueryPool>
 
     // Information required to create new query pools
     VkQueryType mQueryType;
+    VkQueryPipelineStatisticFlags mPipelineStatistics;
 };
 
 // Stores the result of a Vulkan query call. XFB queries in particular store two result values.
@@ -666,7 +724,9 @@ class PipelineBarrier : angle::NonCopyable
 
     bool isEmpty() const { return mImageMemoryBarriers.empty() && mMemoryBarrierDstAccess == 0; }
 
-    void execute(PrimaryCommandBuffer *primary)
+    // Accepts both primary and secondary command buffers.
+    template <typename CommandBufferT>
+    void execute(CommandBufferT *commandBuffer)
     {
         if (isEmpty())
         {
@@ -683,7 +743,7 @@ class PipelineBarrier : angle::NonCopyable
             memoryBarrier.dstAccessMask = mMemoryBarrierDstAccess;
             memoryBarrierCount++;
         }
-        primary->pipelineBarrier(
+        commandBuffer->pipelineBarrier(
             mSrcStageMask, mDstStageMask, 0, memoryBarrierCount, &memoryBarrier, 0, nullptr,
             static_cast<uint32_t>(mImageMemoryBarriers.size()), mImageMemoryBarriers.data());
 
@@ -944,6 +1004,12 @@ class BufferPool : angle::NonCopyable
     void addStats(std::ostringstream *out) const;
     size_t getBufferCount() const { return mBufferBlocks.size() + mEmptyBufferBlocks.size(); }
     VkDeviceSize getMemorySize() const { return mTotalMemorySize; }
+    // High water mark of mTotalMemorySize, for memory usage telemetry.
+    VkDeviceSize getMaxTotalMemorySize() const { return mMaxTotalMemorySize; }
+    // Sums unused bytes of in-use BufferBlocks plus the size of empty BufferBlocks. The ratio of
+    // this over getMemorySize is the pool's fragmentation ratio. This walks all blocks and is
+    // intended for telemetry, not for per-draw use.
+    VkDeviceSize getTotalUnusedMemorySize() const;
 
   private:
     angle::Result allocateNewBuffer(Context *context, VkDeviceSize sizeInBytes);
@@ -955,6 +1021,7 @@ class BufferPool : angle::NonCopyable
     VkDeviceSize mSize;
     uint32_t mMemoryTypeIndex;
     VkDeviceSize mTotalMemorySize;
+    VkDeviceSize mMaxTotalMemorySize;
     BufferBlockPointerVector mBufferBlocks;
     BufferBlockPointerVector mEmptyBufferBlocks;
     // Tracks the number of new buffers needed for suballocation since last pruneEmptyBuffers call.
@@ -1280,6 +1347,29 @@ class MaybeImagelessFramebuffer : angle::NonCopyable
 
 using RenderPassSerial = Serial;
 
+// Per-attachment record of whether render pass results were consumed after the pass, used by the
+// predictiveRenderPassStoreOps optimization.  ContextVk keeps one RenderPassStoreOpHistory per
+// framebuffer serial; the history is updated every time a render pass on that framebuffer ends.
+struct AttachmentStoreUsage
+{
+    // Identifies the attachment image the history was recorded against; a swapped-out attachment
+    // resets the history.
+    ImageSerial imageSerial;
+    // The image's read layout transition count when the previous render pass ended.  If unchanged
+    // by the time the next render pass ends, the stored contents were never read.
+    uint32_t readLayoutTransitionCount = 0;
+    // Number of consecutive render passes after which the attachment was not read.
+    uint32_t passesWithoutRead = 0;
+};
+
+struct RenderPassStoreOpHistory
+{
+    // Indexed by packed attachment index.
+    gl::AttachmentArray<AttachmentStoreUsage> colorAttachments;
+    AttachmentStoreUsage depthAttachment;
+    AttachmentStoreUsage stencilAttachment;
+};
+
 class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
 {
   public:
@@ -1368,6 +1458,11 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
     void invalidateRenderPassStencilAttachment(const gl::DepthStencilState &dsState,
                                                const gl::Rectangle &invalidateArea);
 
+    // Used by the predictiveRenderPassStoreOps feature at render pass end.  Updates the per-frame
+    // attachment usage history and, for attachments whose stored contents have not been read for
+    // many consecutive render passes, invalidates the attachment so its storeOp becomes DONT_CARE.
+    void updateAndApplyStoreOpHistory(RenderPassStoreOpHistory *history);
+
     void updateRenderPassColorClear(PackedAttachmentIndex colorIndexVk,
                                     const VkClearValue &colorClearValue);
     void updateRenderPassDepthStencilClear(VkImageAspectFlags aspectFlags,
@@ -1407,6 +1502,11 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
     bool hasAnyDepthAccess() { return mDepthAttachment.hasAnyAccess(); }
     bool hasAnyStencilAccess() { return mStencilAttachment.hasAnyAccess(); }
 
+    // Appends the serials of this render pass's color attachment images to |serialsOut|.  Used to
+    // detect when the next render pass samples what was just rendered.
+    void getColorAttachmentImageSerials(
+        angle::FixedVector<ImageSerial, gl::IMPLEMENTATION_MAX_DRAW_BUFFERS> *serialsOut);
+
     void updateRenderPassForResolve(ContextVk *contextVk,
                                     MaybeImagelessFramebuffer &newFramebuffer,
                                     const RenderPassDesc &renderPassDesc);
@@ -1930,7 +2030,13 @@ class ImageHelper final : public Resource, public angle::Subject
         mCurrentLayout = newLayout;
     }
     ImageLayout getCurrentImageLayout() const { return mCurrentLayout; }
+
+    // Resets layout and ownership tracking to the freshly-imported external-memory state, so that
+    // a reused external image is re-acquired from the external queue on first access.  Used when
+    // an AHardwareBuffer import is recycled instead of re-created.
+    void resetToExternalPreInitialized(uint32_t externalQueueFamilyIndex);
     VkImageLayout getCurrentLayout() const;
+    uint32_t getReadLayoutTransitionCount() const { return mReadLayoutTransitionCount; }
 
     gl::Extents getLevelExtents(LevelIndex levelVk) const;
     // Helper function to calculate the extents of a render target created for a certain mip of the
@@ -2105,6 +2211,10 @@ class ImageHelper final : public Resource, public angle::Subject
                                         uint32_t layerCount) const;
     bool hasStagedUpdatesInAllocatedLevels() const;
 
+    // Total size of staged buffer updates not yet flushed, used to decide when updates have grown
+    // large enough to be worth flushing and submitting eagerly.
+    VkDeviceSize getTotalStagedBufferUpdateSize() const { return mTotalStagedBufferUpdateSize; }
+
     bool removeStagedClearUpdatesAndReturnColor(gl::LevelIndex levelGL,
                                                 const VkClearColorValue **color);
 
@@ -2139,6 +2249,31 @@ class ImageHelper final : public Resource, public angle::Subject
         barrierImpl(context, aspectMask, newLayout, mCurrentQueueFamilyIndex, commandBuffer);
     }
 
+    // Variants that collect the transition into |barrier| for deferred, aggregated execution.
+    // They return whether a barrier was recorded.
+    bool recordWriteBarrier(Context *context,
+                            VkImageAspectFlags aspectMask,
+                            ImageLayout newLayout,
+                            PipelineBarrier *barrier)
+    {
+        barrierImpl(context, aspectMask, newLayout, mCurrentQueueFamilyIndex, barrier);
+        return true;
+    }
+
+    bool recordReadBarrier(Context *context,
+                           VkImageAspectFlags aspectMask,
+                           ImageLayout newLayout,
+                           PipelineBarrier *barrier)
+    {
+        if (!isReadBarrierNecessary(newLayout))
+        {
+            return false;
+        }
+
+        barrierImpl(context, aspectMask, newLayout, mCurrentQueueFamilyIndex, barrier);
+        return true;
+    }
+
     bool isQueueChangeNeccesary(uint32_t newQueueFamilyIndex) const
     {
         return mCurrentQueueFamilyIndex != newQueueFamilyIndex;
@@ -2334,6 +2469,13 @@ class ImageHelper final : public Resource, public angle::Subject
     struct BufferUpdate
     {
         BufferHelper *bufferHelper;
+        // With the compressStagedImageUpdates feature, large payloads are staged in compressed
+        // form instead of holding a full-size staging allocation until flush.  In that case
+        // |bufferHelper| is null, the pixel data lives in |compressedData| and
+        // |copyRegion.bufferOffset| is relative to the decompressed payload; the update is
+        // materialized into a staging buffer right before it's applied.
+        angle::MemoryBuffer *compressedData;
+        size_t uncompressedSize;
         VkBufferImageCopy copyRegion;
         angle::FormatID formatID;
     };
@@ -2351,6 +2493,10 @@ class ImageHelper final : public Resource, public angle::Subject
                           BufferHelper *bufferHelperIn,
                           const VkBufferImageCopy &copyRegion,
                           angle::FormatID formatID);
+        SubresourceUpdate(angle::MemoryBuffer *compressedDataIn,
+                          size_t uncompressedSizeIn,
+                          const VkBufferImageCopy &copyRegion,
+                          angle::FormatID formatID);
         SubresourceUpdate(RefCounted<ImageHelper> *imageIn,
                           const VkImageCopy &copyRegion,
                           angle::FormatID formatID);
@@ -2376,6 +2522,9 @@ class ImageHelper final : public Resource, public angle::Subject
                                 uint32_t *baseLayerOut,
                                 uint32_t *layerCountOut) const;
         VkImageAspectFlags getDestAspectFlags() const;
+        // Host memory held by this update until it's flushed: the staging buffer size for buffer
+        // updates, or the compressed payload size for compressed ones.
+        VkDeviceSize getStagedBufferSize() const;
 
         UpdateSource updateSource;
         union
@@ -2424,6 +2573,14 @@ class ImageHelper final : public Resource, public angle::Subject
                      uint32_t newQueueFamilyIndex,
                      CommandBufferT *commandBuffer);
 
+    // Records the transition into |barrier| instead of emitting it immediately, so back-to-back
+    // transitions of multiple images can be merged into a single vkCmdPipelineBarrier call.
+    void barrierImpl(Context *context,
+                     VkImageAspectFlags aspectMask,
+                     ImageLayout newLayout,
+                     uint32_t newQueueFamilyIndex,
+                     PipelineBarrier *barrier);
+
     // If the image has emulated channels, we clear them once so as not to leave garbage on those
     // channels.
     VkColorComponentFlags getEmulatedChannelsMask() const;
@@ -2470,6 +2627,14 @@ class ImageHelper final : public Resource, public angle::Subject
     void appendSubresourceUpdate(gl::LevelIndex level, SubresourceUpdate &&update);
     void prependSubresourceUpdate(gl::LevelIndex level, SubresourceUpdate &&update);
 
+    // Whether the most recent pending update of |level| stages the same data to the same
+    // subresource region, which makes a newly staged update redundant.
+    bool isDuplicateOfLastStagedUpdate(gl::LevelIndex level,
+                                       const VkBufferImageCopy &copy,
+                                       angle::FormatID formatID,
+                                       const uint8_t *data,
+                                       size_t dataSize) const;
+
     enum class PruneReason
     {
         MemoryOptimization,
@@ -2550,6 +2715,10 @@ class ImageHelper final : public Resource, public angle::Subject
     bool canCopyWithTransformForReadPixels(const PackPixelsParams &packPixelsParams,
                                            const angle::Format *readFormat);
 
+    // Materialize a compressed staged update into a fresh staging buffer, right before the update
+    // is applied or its payload needs to be read.
+    angle::Result decompressStagedUpdate(ContextVk *contextVk, SubresourceUpdate *update);
+
     // Returns true if source data and actual image format matches except color space differences.
     bool isDataFormatMatchForCopy(angle::FormatID srcDataFormatID) const
     {
@@ -2593,6 +2762,10 @@ class ImageHelper final : public Resource, public angle::Subject
     // For optimizing transition between different shader readonly layouts
     ImageLayout mLastNonShaderReadOnlyLayout;
     VkPipelineStageFlags mCurrentShaderReadStageMask;
+    // Incremented every time the image transitions from a writable to a read-only layout.  Used by
+    // the predictiveRenderPassStoreOps optimization to tell whether attachment contents were ever
+    // consumed after a render pass.
+    uint32_t mReadLayoutTransitionCount;
     // Track how it is being used by current open renderpass.
     RenderPassUsageFlags mRenderPassUsageFlags;
 
@@ -2942,6 +3115,53 @@ ImageSubresourceRange MakeImageSubresourceDrawRange(gl::LevelIndex level,
                                                     LayerMode layerMode,
                                                     gl::SrgbWriteControlMode srgbWriteControlMode);
 
+// A display-wide recycler for window surface depth/stencil images.  Each WindowSurfaceVk
+// normally owns a depth/stencil image for the lifetime of its swapchain, even though the
+// contents are invalidated on every swap.  When enabled (through the
+// ANGLE_SHARED_DEPTH_STENCIL_BUFFERS environment variable), surfaces return their depth/stencil
+// image to this pool on present and take one back when the next frame starts, so windows that
+// don't render concurrently share a single allocation.
+class DepthStencilImagePool final : angle::NonCopyable
+{
+  public:
+    struct Entry : angle::NonCopyable
+    {
+        ImageHelper image;
+        ImageViewHelper imageViews;
+
+        // The surface that last used the image, preferred on reacquire so a surface gets its own
+        // image back whenever possible.
+        const void *lastOwner    = nullptr;
+        bool hasProtectedContent = false;
+    };
+
+    // Returns a matching pooled entry, or nullptr if none is available.  An entry is always
+    // returned to its previous owner, even if the GPU is still using it; that is no different
+    // from the surface having kept the image.  Entries last used by another surface are only
+    // handed over once the GPU is done with them (tracked through the image's queue serial), so
+    // no synchronization is needed between the surfaces beyond the layout already recorded in
+    // the image.
+    std::unique_ptr<Entry> acquire(RendererVk *renderer,
+                                   const void *owner,
+                                   const VkExtent3D &extents,
+                                   angle::FormatID actualFormatID,
+                                   GLint samples,
+                                   bool hasProtectedContent);
+
+    // Takes ownership of the entry.  If the pool is full, the oldest entry is queued for
+    // destruction once the GPU is done with it.
+    void recycle(RendererVk *renderer, const void *owner, std::unique_ptr<Entry> entry);
+
+    // Destroys all pooled entries.  The device must be idle.
+    void destroy(RendererVk *renderer);
+
+  private:
+    static constexpr size_t kMaxEntries = 8;
+
+    std::mutex mMutex;
+    std::vector<std::unique_ptr<Entry>> mEntries;
+};
+
 class BufferViewHelper final : public Resource
 {
   public:
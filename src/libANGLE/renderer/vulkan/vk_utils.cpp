@@ -945,6 +945,9 @@ PFN_vkGetPhysicalDeviceMemoryProperties2KHR vkGetPhysicalDeviceMemoryProperties2
 // VK_KHR_external_semaphore_fd
 PFN_vkImportSemaphoreFdKHR vkImportSemaphoreFdKHR = nullptr;
 
+// VK_KHR_external_memory_fd
+PFN_vkGetMemoryFdKHR vkGetMemoryFdKHR = nullptr;
+
 // VK_EXT_external_memory_host
 PFN_vkGetMemoryHostPointerPropertiesEXT vkGetMemoryHostPointerPropertiesEXT = nullptr;
 
@@ -1119,6 +1122,12 @@ void InitExternalSemaphoreFdFunctions(VkInstance instance)
     GET_INSTANCE_FUNC(vkImportSemaphoreFdKHR);
 }
 
+// VK_KHR_external_memory_fd
+void InitExternalMemoryFdFunctions(VkInstance instance)
+{
+    GET_INSTANCE_FUNC(vkGetMemoryFdKHR);
+}
+
 void InitExternalMemoryHostFunctions(VkInstance instance)
 {
     GET_INSTANCE_FUNC(vkGetMemoryHostPointerPropertiesEXT);
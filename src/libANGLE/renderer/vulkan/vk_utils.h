@@ -1000,6 +1000,9 @@ void InitGGPStreamDescriptorSurfaceFunctions(VkInstance instance);
 // VK_KHR_external_semaphore_fd
 void InitExternalSemaphoreFdFunctions(VkInstance instance);
 
+// VK_KHR_external_memory_fd
+void InitExternalMemoryFdFunctions(VkInstance instance);
+
 // VK_EXT_external_memory_host
 void InitExternalMemoryHostFunctions(VkInstance instance);
 
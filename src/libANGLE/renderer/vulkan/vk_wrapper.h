@@ -264,6 +264,12 @@ class CommandBuffer : public WrappedObject<CommandBuffer, VkCommandBuffer>
                    VkImageLayout dstImageLayout,
                    uint32_t regionCount,
                    const VkImageCopy *regions);
+    void copyImage(VkImage srcImage,
+                   VkImageLayout srcImageLayout,
+                   VkImage dstImage,
+                   VkImageLayout dstImageLayout,
+                   uint32_t regionCount,
+                   const VkImageCopy *regions);
 
     void dispatch(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ);
     void dispatchIndirect(const Buffer &buffer, VkDeviceSize offset);
@@ -903,10 +909,22 @@ ANGLE_INLINE void CommandBuffer::copyImage(const Image &srcImage,
                                            uint32_t regionCount,
                                            const VkImageCopy *regions)
 {
-    ASSERT(valid() && srcImage.valid() && dstImage.valid());
-    ASSERT(regionCount == 1);
-    vkCmdCopyImage(mHandle, srcImage.getHandle(), srcImageLayout, dstImage.getHandle(),
-                   dstImageLayout, 1, regions);
+    ASSERT(srcImage.valid() && dstImage.valid());
+    copyImage(srcImage.getHandle(), srcImageLayout, dstImage.getHandle(), dstImageLayout,
+              regionCount, regions);
+}
+
+ANGLE_INLINE void CommandBuffer::copyImage(VkImage srcImage,
+                                           VkImageLayout srcImageLayout,
+                                           VkImage dstImage,
+                                           VkImageLayout dstImageLayout,
+                                           uint32_t regionCount,
+                                           const VkImageCopy *regions)
+{
+    ASSERT(valid() && srcImage != VK_NULL_HANDLE && dstImage != VK_NULL_HANDLE);
+    ASSERT(regionCount >= 1);
+    vkCmdCopyImage(mHandle, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount,
+                   regions);
 }
 
 ANGLE_INLINE void CommandBuffer::beginRenderPass(const VkRenderPassBeginInfo &beginInfo,
@@ -1521,6 +1521,15 @@ bool ValidateQueryDisplayAttribBase(const ValidationContext *val,
             }
             break;
 
+        case EGL_TELEMETRY_COUNTERS_ANGLE:
+            if (!display->getExtensions().displayTelemetryANGLE)
+            {
+                val->setError(EGL_BAD_DISPLAY,
+                              "EGL_ANGLE_display_telemetry extension is not available.");
+                return false;
+            }
+            break;
+
         default:
             val->setError(EGL_BAD_ATTRIBUTE, "attribute is not valid.");
             return false;
@@ -2683,6 +2692,24 @@ bool ValidateCreateWindowSurface(const ValidationContext *val,
                 }
                 break;
 
+            case EGL_D3D11_MAX_FRAME_LATENCY_ANGLE:
+                if (!displayExtensions.d3d11FrameLatency)
+                {
+                    val->setError(EGL_BAD_ATTRIBUTE,
+                                  "Attribute EGL_D3D11_MAX_FRAME_LATENCY_ANGLE requires "
+                                  "EGL_ANGLE_d3d11_frame_latency.");
+                    return false;
+                }
+                // DXGI allows a maximum frame latency of 16. Zero leaves the default.
+                if (value < 0 || value > 16)
+                {
+                    val->setError(EGL_BAD_ATTRIBUTE,
+                                  "EGL_D3D11_MAX_FRAME_LATENCY_ANGLE must be "
+                                  "between 0 and 16.");
+                    return false;
+                }
+                break;
+
             case EGL_ROBUST_RESOURCE_INITIALIZATION_ANGLE:
                 if (!display->getExtensions().robustResourceInitializationANGLE)
                 {
@@ -3229,6 +3256,30 @@ bool ValidateMakeCurrent(const ValidationContext *val,
                          SurfaceID readSurfaceID,
                          gl::ContextID contextID)
 {
+    // Fast path: rebinding the context/surface triple that is already current on this thread.
+    // Everything below was validated when these bindings were first made current, and the objects
+    // cannot have been invalidated while current; only display-level state can change, which is
+    // rechecked here.  Some middleware issues such redundant eglMakeCurrent calls at high
+    // frequency.
+    const gl::Context *currentContext = val->eglThread->getContext();
+    if (currentContext != nullptr && currentContext->id().value == contextID.value &&
+        currentContext->getDisplay() == display && display->isInitialized() &&
+        !display->isDeviceLost())
+    {
+        const Surface *currentDraw = val->eglThread->getCurrentDrawSurface();
+        const Surface *currentRead = val->eglThread->getCurrentReadSurface();
+        const bool sameDraw        = currentDraw != nullptr
+                                         ? currentDraw->id().value == drawSurfaceID.value
+                                         : drawSurfaceID.value == 0;
+        const bool sameRead        = currentRead != nullptr
+                                         ? currentRead->id().value == readSurfaceID.value
+                                         : readSurfaceID.value == 0;
+        if (sameDraw && sameRead)
+        {
+            return true;
+        }
+    }
+
     bool noDraw    = drawSurfaceID.value == 0;
     bool noRead    = readSurfaceID.value == 0;
     bool noContext = contextID.value == 0;
@@ -6271,6 +6322,28 @@ bool ValidateQuerySurfacePointerANGLE(const ValidationContext *val,
                 return false;
             }
             break;
+        case EGL_D3D11_FRAME_LATENCY_WAITABLE_OBJECT_ANGLE:
+            if (!display->getExtensions().d3d11FrameLatency)
+            {
+                val->setError(EGL_BAD_ATTRIBUTE);
+                return false;
+            }
+            break;
+        case EGL_SURFACE_MEMORY_FD_ANGLE:
+            if (!display->getExtensions().surfaceMemoryFdANGLE)
+            {
+                val->setError(EGL_BAD_ATTRIBUTE);
+                return false;
+            }
+            break;
+        case EGL_FRAME_PROFILE_HISTORY_ANGLE:
+        case EGL_RENDER_PASS_CLOSURE_COUNTS_ANGLE:
+            if (!display->getExtensions().frameProfileANGLE)
+            {
+                val->setError(EGL_BAD_ATTRIBUTE);
+                return false;
+            }
+            break;
         default:
             val->setError(EGL_BAD_ATTRIBUTE);
             return false;
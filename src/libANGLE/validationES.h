@@ -1021,6 +1021,11 @@ ANGLE_INLINE bool ValidateDrawArraysCommon(const Context *context,
                                            GLsizei count,
                                            GLsizei primcount)
 {
+    if (context->getStateCache().isValidatedDrawArraysCall(mode, first, count, primcount))
+    {
+        return true;
+    }
+
     if (first < 0)
     {
         context->validationError(entryPoint, GL_INVALID_VALUE, err::kNegativeStart);
@@ -1068,7 +1073,13 @@ ANGLE_INLINE bool ValidateDrawArraysCommon(const Context *context,
         }
     }
 
-    return ValidateDrawArraysAttribs(context, entryPoint, first, count);
+    if (!ValidateDrawArraysAttribs(context, entryPoint, first, count))
+    {
+        return false;
+    }
+
+    context->getStateCache().setValidatedDrawArraysCall(mode, first, count, primcount);
+    return true;
 }
 
 ANGLE_INLINE bool ValidateDrawElementsBase(const Context *context,
@@ -1110,6 +1121,11 @@ ANGLE_INLINE bool ValidateDrawElementsCommon(const Context *context,
                                              const void *indices,
                                              GLsizei primcount)
 {
+    if (context->getStateCache().isValidatedDrawElementsCall(mode, count, type, indices, primcount))
+    {
+        return true;
+    }
+
     if (!ValidateDrawElementsBase(context, entryPoint, mode, type))
     {
         return false;
@@ -1229,9 +1245,22 @@ ANGLE_INLINE bool ValidateDrawElementsCommon(const Context *context,
         }
 
         // No op if there are no real indices in the index data (all are primitive restart).
-        return (indexRange.vertexIndexCount > 0);
+        if (indexRange.vertexIndexCount == 0)
+        {
+            return false;
+        }
     }
 
+    // Client-memory index data can be rewritten in place without any dirty notification reaching
+    // the state cache, so a draw whose index range was computed from the client pointer must be
+    // revalidated every time.  Only memoize when the indices come from a bound element array
+    // buffer (whose mutation paths notify the cache), or when buffer access validation is off and
+    // the index data was never read.
+    if (elementArrayBuffer != nullptr || !context->isBufferAccessValidationEnabled())
+    {
+        context->getStateCache().setValidatedDrawElementsCall(mode, count, type, indices,
+                                                              primcount);
+    }
     return true;
 }
 
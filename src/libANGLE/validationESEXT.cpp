@@ -3585,6 +3585,40 @@ bool ValidateShadingRateQCOM(const Context *context, angle::EntryPoint entryPoin
     return true;
 }
 
+bool ValidateBeginLockedDrawsANGLE(const Context *context, angle::EntryPoint entryPoint)
+{
+    if (!context->getExtensions().lockDrawsANGLE)
+    {
+        context->validationError(entryPoint, GL_INVALID_OPERATION, kExtensionNotEnabled);
+        return false;
+    }
+
+    if (context->isLockedDrawsActive())
+    {
+        context->validationError(entryPoint, GL_INVALID_OPERATION, kLockedDrawsActive);
+        return false;
+    }
+
+    return true;
+}
+
+bool ValidateEndLockedDrawsANGLE(const Context *context, angle::EntryPoint entryPoint)
+{
+    if (!context->getExtensions().lockDrawsANGLE)
+    {
+        context->validationError(entryPoint, GL_INVALID_OPERATION, kExtensionNotEnabled);
+        return false;
+    }
+
+    if (!context->isLockedDrawsActive())
+    {
+        context->validationError(entryPoint, GL_INVALID_OPERATION, kLockedDrawsNotActive);
+        return false;
+    }
+
+    return true;
+}
+
 bool ValidateLogicOpANGLE(const Context *context,
                           angle::EntryPoint entryPoint,
                           LogicalOperation opcodePacked)
@@ -228,6 +228,10 @@ bool ValidateVertexAttribDivisorANGLE(const Context *context,
                                       GLuint index,
                                       GLuint divisor);
 
+// GL_ANGLE_lock_draws
+bool ValidateBeginLockedDrawsANGLE(const Context *context, angle::EntryPoint entryPoint);
+bool ValidateEndLockedDrawsANGLE(const Context *context, angle::EntryPoint entryPoint);
+
 // GL_ANGLE_logic_op
 bool ValidateLogicOpANGLE(const Context *context,
                           angle::EntryPoint entryPoint,
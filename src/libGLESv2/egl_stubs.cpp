@@ -480,6 +480,30 @@ EGLBoolean MakeCurrent(Thread *thread,
                        egl::SurfaceID readSurfaceID,
                        gl::ContextID contextID)
 {
+    Surface *previousDraw        = thread->getCurrentDrawSurface();
+    Surface *previousRead        = thread->getCurrentReadSurface();
+    gl::Context *previousContext = thread->getContext();
+
+    // Fast path: rebinding the context/surface triple that is already current on this thread is a
+    // no-op.  Objects cannot be deleted out from under a current binding (they stay alive until
+    // released), so comparing IDs against the current bindings is sufficient and avoids the
+    // object lookups and backend notification below.
+    const bool sameContext = previousContext != nullptr
+                                 ? previousContext->id().value == contextID.value
+                                 : contextID.value == 0;
+    const bool sameDraw    = previousDraw != nullptr
+                                 ? previousDraw->id().value == drawSurfaceID.value
+                                 : drawSurfaceID.value == 0;
+    const bool sameRead    = previousRead != nullptr
+                                 ? previousRead->id().value == readSurfaceID.value
+                                 : readSurfaceID.value == 0;
+    if (sameContext && sameDraw && sameRead &&
+        (previousContext == nullptr || previousContext->getDisplay() == display))
+    {
+        thread->setSuccess();
+        return EGL_TRUE;
+    }
+
     Surface *drawSurface = display->getSurface(drawSurfaceID);
     Surface *readSurface = display->getSurface(readSurfaceID);
     gl::Context *context = display->getContext(contextID);
@@ -488,10 +512,6 @@ EGLBoolean MakeCurrent(Thread *thread,
                          GetDisplayIfValid(display), EGL_FALSE);
     ScopedSyncCurrentContextFromThread scopedSyncCurrent(thread);
 
-    Surface *previousDraw        = thread->getCurrentDrawSurface();
-    Surface *previousRead        = thread->getCurrentReadSurface();
-    gl::Context *previousContext = thread->getContext();
-
     // Only call makeCurrent if the context or surfaces have changed.
     if (previousDraw != drawSurface || previousRead != readSurface || previousContext != context)
     {
@@ -673,6 +693,10 @@ EGLBoolean SwapBuffers(Thread *thread, Display *display, egl::SurfaceID surfaceI
     ANGLE_EGL_TRY_RETURN(thread, eglSurface->swap(thread->getContext()), "eglSwapBuffers",
                          GetSurfaceIfValid(display, surfaceID), EGL_FALSE);
 
+#if defined(ANGLE_ENABLE_ALLOCATION_PROFILING)
+    gl::AdvanceAllocationProfileFrame();
+#endif
+
     thread->setSuccess();
     return EGL_TRUE;
 }
@@ -703,6 +727,14 @@ EGLBoolean Terminate(Thread *thread, Display *display)
     ANGLE_EGL_TRY_RETURN(thread, display->terminate(thread, Display::TerminateReason::Api),
                          "eglTerminate", GetDisplayIfValid(display), EGL_FALSE);
 
+#if defined(ANGLE_ENABLE_ENTRY_POINT_CYCLE_PROFILING)
+    gl::DumpEntryPointCycleProfile();
+#endif
+
+#if defined(ANGLE_ENABLE_ALLOCATION_PROFILING)
+    gl::DumpAllocationProfile();
+#endif
+
     thread->setSuccess();
     return EGL_TRUE;
 }
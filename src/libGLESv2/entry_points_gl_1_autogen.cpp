@@ -37,7 +37,7 @@ void GL_APIENTRY GL_Accum(GLenum op, GLfloat value)
     EVENT(context, GLAccum, "context = %d, op = %s, value = %f", CID(context),
           GLenumToString(BigGLEnum::AccumOp, op), value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -60,7 +60,7 @@ void GL_APIENTRY GL_Begin(GLenum mode)
     EVENT(context, GLBegin, "context = %d, mode = %s", CID(context),
           GLenumToString(BigGLEnum::PrimitiveType, mode));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -91,7 +91,7 @@ void GL_APIENTRY GL_Bitmap(GLsizei width,
           "bitmap = 0x%016" PRIxPTR "",
           CID(context), width, height, xorig, yorig, xmove, ymove, (uintptr_t)bitmap);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -115,7 +115,7 @@ void GL_APIENTRY GL_CallList(GLuint list)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCallList, "context = %d, list = %u", CID(context), list);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -138,7 +138,7 @@ void GL_APIENTRY GL_CallLists(GLsizei n, GLenum type, const void *lists)
     EVENT(context, GLCallLists, "context = %d, n = %d, type = %s, lists = 0x%016" PRIxPTR "",
           CID(context), n, GLenumToString(BigGLEnum::ListNameType, type), (uintptr_t)lists);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -162,7 +162,7 @@ void GL_APIENTRY GL_ClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat
     EVENT(context, GLClearAccum, "context = %d, red = %f, green = %f, blue = %f, alpha = %f",
           CID(context), red, green, blue, alpha);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -185,7 +185,7 @@ void GL_APIENTRY GL_ClearDepth(GLdouble depth)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClearDepth, "context = %d, depth = %f", CID(context), depth);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -207,7 +207,7 @@ void GL_APIENTRY GL_ClearIndex(GLfloat c)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClearIndex, "context = %d, c = %f", CID(context), c);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -230,7 +230,7 @@ void GL_APIENTRY GL_ClipPlane(GLenum plane, const GLdouble *equation)
     EVENT(context, GLClipPlane, "context = %d, plane = %s, equation = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::ClipPlaneName, plane), (uintptr_t)equation);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -254,7 +254,7 @@ void GL_APIENTRY GL_Color3b(GLbyte red, GLbyte green, GLbyte blue)
     EVENT(context, GLColor3b, "context = %d, red = %d, green = %d, blue = %d", CID(context), red,
           green, blue);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -277,7 +277,7 @@ void GL_APIENTRY GL_Color3bv(const GLbyte *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColor3bv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -300,7 +300,7 @@ void GL_APIENTRY GL_Color3d(GLdouble red, GLdouble green, GLdouble blue)
     EVENT(context, GLColor3d, "context = %d, red = %f, green = %f, blue = %f", CID(context), red,
           green, blue);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -323,7 +323,7 @@ void GL_APIENTRY GL_Color3dv(const GLdouble *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColor3dv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -346,7 +346,7 @@ void GL_APIENTRY GL_Color3f(GLfloat red, GLfloat green, GLfloat blue)
     EVENT(context, GLColor3f, "context = %d, red = %f, green = %f, blue = %f", CID(context), red,
           green, blue);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -369,7 +369,7 @@ void GL_APIENTRY GL_Color3fv(const GLfloat *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColor3fv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -392,7 +392,7 @@ void GL_APIENTRY GL_Color3i(GLint red, GLint green, GLint blue)
     EVENT(context, GLColor3i, "context = %d, red = %d, green = %d, blue = %d", CID(context), red,
           green, blue);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -415,7 +415,7 @@ void GL_APIENTRY GL_Color3iv(const GLint *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColor3iv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -438,7 +438,7 @@ void GL_APIENTRY GL_Color3s(GLshort red, GLshort green, GLshort blue)
     EVENT(context, GLColor3s, "context = %d, red = %d, green = %d, blue = %d", CID(context), red,
           green, blue);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -461,7 +461,7 @@ void GL_APIENTRY GL_Color3sv(const GLshort *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColor3sv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -484,7 +484,7 @@ void GL_APIENTRY GL_Color3ub(GLubyte red, GLubyte green, GLubyte blue)
     EVENT(context, GLColor3ub, "context = %d, red = %d, green = %d, blue = %d", CID(context), red,
           green, blue);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -507,7 +507,7 @@ void GL_APIENTRY GL_Color3ubv(const GLubyte *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColor3ubv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -530,7 +530,7 @@ void GL_APIENTRY GL_Color3ui(GLuint red, GLuint green, GLuint blue)
     EVENT(context, GLColor3ui, "context = %d, red = %u, green = %u, blue = %u", CID(context), red,
           green, blue);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -553,7 +553,7 @@ void GL_APIENTRY GL_Color3uiv(const GLuint *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColor3uiv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -576,7 +576,7 @@ void GL_APIENTRY GL_Color3us(GLushort red, GLushort green, GLushort blue)
     EVENT(context, GLColor3us, "context = %d, red = %u, green = %u, blue = %u", CID(context), red,
           green, blue);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -599,7 +599,7 @@ void GL_APIENTRY GL_Color3usv(const GLushort *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColor3usv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -622,7 +622,7 @@ void GL_APIENTRY GL_Color4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha)
     EVENT(context, GLColor4b, "context = %d, red = %d, green = %d, blue = %d, alpha = %d",
           CID(context), red, green, blue, alpha);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -645,7 +645,7 @@ void GL_APIENTRY GL_Color4bv(const GLbyte *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColor4bv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -668,7 +668,7 @@ void GL_APIENTRY GL_Color4d(GLdouble red, GLdouble green, GLdouble blue, GLdoubl
     EVENT(context, GLColor4d, "context = %d, red = %f, green = %f, blue = %f, alpha = %f",
           CID(context), red, green, blue, alpha);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -691,7 +691,7 @@ void GL_APIENTRY GL_Color4dv(const GLdouble *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColor4dv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -713,7 +713,7 @@ void GL_APIENTRY GL_Color4fv(const GLfloat *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColor4fv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -736,7 +736,7 @@ void GL_APIENTRY GL_Color4i(GLint red, GLint green, GLint blue, GLint alpha)
     EVENT(context, GLColor4i, "context = %d, red = %d, green = %d, blue = %d, alpha = %d",
           CID(context), red, green, blue, alpha);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -759,7 +759,7 @@ void GL_APIENTRY GL_Color4iv(const GLint *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColor4iv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -782,7 +782,7 @@ void GL_APIENTRY GL_Color4s(GLshort red, GLshort green, GLshort blue, GLshort al
     EVENT(context, GLColor4s, "context = %d, red = %d, green = %d, blue = %d, alpha = %d",
           CID(context), red, green, blue, alpha);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -805,7 +805,7 @@ void GL_APIENTRY GL_Color4sv(const GLshort *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColor4sv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -827,7 +827,7 @@ void GL_APIENTRY GL_Color4ubv(const GLubyte *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColor4ubv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -850,7 +850,7 @@ void GL_APIENTRY GL_Color4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha
     EVENT(context, GLColor4ui, "context = %d, red = %u, green = %u, blue = %u, alpha = %u",
           CID(context), red, green, blue, alpha);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -873,7 +873,7 @@ void GL_APIENTRY GL_Color4uiv(const GLuint *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColor4uiv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -896,7 +896,7 @@ void GL_APIENTRY GL_Color4us(GLushort red, GLushort green, GLushort blue, GLusho
     EVENT(context, GLColor4us, "context = %d, red = %u, green = %u, blue = %u, alpha = %u",
           CID(context), red, green, blue, alpha);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -919,7 +919,7 @@ void GL_APIENTRY GL_Color4usv(const GLushort *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColor4usv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -943,7 +943,7 @@ void GL_APIENTRY GL_ColorMaterial(GLenum face, GLenum mode)
           GLenumToString(BigGLEnum::TriangleFace, face),
           GLenumToString(BigGLEnum::ColorMaterialParameter, mode));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -967,7 +967,7 @@ void GL_APIENTRY GL_CopyPixels(GLint x, GLint y, GLsizei width, GLsizei height,
     EVENT(context, GLCopyPixels, "context = %d, x = %d, y = %d, width = %d, height = %d, type = %s",
           CID(context), x, y, width, height, GLenumToString(BigGLEnum::PixelCopyType, type));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -990,7 +990,7 @@ void GL_APIENTRY GL_DeleteLists(GLuint list, GLsizei range)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteLists, "context = %d, list = %u, range = %d", CID(context), list, range);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1013,7 +1013,7 @@ void GL_APIENTRY GL_DepthRange(GLdouble n, GLdouble f)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDepthRange, "context = %d, n = %f, f = %f", CID(context), n, f);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1036,7 +1036,7 @@ void GL_APIENTRY GL_DrawBuffer(GLenum buf)
     EVENT(context, GLDrawBuffer, "context = %d, buf = %s", CID(context),
           GLenumToString(BigGLEnum::DrawBufferMode, buf));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1063,7 +1063,7 @@ GL_DrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const v
           CID(context), width, height, GLenumToString(BigGLEnum::PixelFormat, format),
           GLenumToString(BigGLEnum::PixelType, type), (uintptr_t)pixels);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1086,7 +1086,7 @@ void GL_APIENTRY GL_EdgeFlag(GLboolean flag)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEdgeFlag, "context = %d, flag = %s", CID(context), GLbooleanToString(flag));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1109,7 +1109,7 @@ void GL_APIENTRY GL_EdgeFlagv(const GLboolean *flag)
     EVENT(context, GLEdgeFlagv, "context = %d, flag = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)flag);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1131,7 +1131,7 @@ void GL_APIENTRY GL_End()
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEnd, "context = %d", CID(context));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1153,7 +1153,7 @@ void GL_APIENTRY GL_EndList()
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEndList, "context = %d", CID(context));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1175,7 +1175,7 @@ void GL_APIENTRY GL_EvalCoord1d(GLdouble u)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEvalCoord1d, "context = %d, u = %f", CID(context), u);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1198,7 +1198,7 @@ void GL_APIENTRY GL_EvalCoord1dv(const GLdouble *u)
     EVENT(context, GLEvalCoord1dv, "context = %d, u = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)u);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1220,7 +1220,7 @@ void GL_APIENTRY GL_EvalCoord1f(GLfloat u)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEvalCoord1f, "context = %d, u = %f", CID(context), u);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1243,7 +1243,7 @@ void GL_APIENTRY GL_EvalCoord1fv(const GLfloat *u)
     EVENT(context, GLEvalCoord1fv, "context = %d, u = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)u);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1265,7 +1265,7 @@ void GL_APIENTRY GL_EvalCoord2d(GLdouble u, GLdouble v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEvalCoord2d, "context = %d, u = %f, v = %f", CID(context), u, v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1288,7 +1288,7 @@ void GL_APIENTRY GL_EvalCoord2dv(const GLdouble *u)
     EVENT(context, GLEvalCoord2dv, "context = %d, u = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)u);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1310,7 +1310,7 @@ void GL_APIENTRY GL_EvalCoord2f(GLfloat u, GLfloat v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEvalCoord2f, "context = %d, u = %f, v = %f", CID(context), u, v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1333,7 +1333,7 @@ void GL_APIENTRY GL_EvalCoord2fv(const GLfloat *u)
     EVENT(context, GLEvalCoord2fv, "context = %d, u = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)u);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1356,7 +1356,7 @@ void GL_APIENTRY GL_EvalMesh1(GLenum mode, GLint i1, GLint i2)
     EVENT(context, GLEvalMesh1, "context = %d, mode = %s, i1 = %d, i2 = %d", CID(context),
           GLenumToString(BigGLEnum::MeshMode1, mode), i1, i2);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1380,7 +1380,7 @@ void GL_APIENTRY GL_EvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j
     EVENT(context, GLEvalMesh2, "context = %d, mode = %s, i1 = %d, i2 = %d, j1 = %d, j2 = %d",
           CID(context), GLenumToString(BigGLEnum::MeshMode2, mode), i1, i2, j1, j2);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1403,7 +1403,7 @@ void GL_APIENTRY GL_EvalPoint1(GLint i)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEvalPoint1, "context = %d, i = %d", CID(context), i);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1425,7 +1425,7 @@ void GL_APIENTRY GL_EvalPoint2(GLint i, GLint j)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEvalPoint2, "context = %d, i = %d, j = %d", CID(context), i, j);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1449,7 +1449,7 @@ void GL_APIENTRY GL_FeedbackBuffer(GLsizei size, GLenum type, GLfloat *buffer)
           "context = %d, size = %d, type = %s, buffer = 0x%016" PRIxPTR "", CID(context), size,
           GLenumToString(BigGLEnum::FeedbackType, type), (uintptr_t)buffer);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1473,7 +1473,7 @@ void GL_APIENTRY GL_Fogi(GLenum pname, GLint param)
     EVENT(context, GLFogi, "context = %d, pname = %s, param = %d", CID(context),
           GLenumToString(BigGLEnum::FogParameter, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1496,7 +1496,7 @@ void GL_APIENTRY GL_Fogiv(GLenum pname, const GLint *params)
     EVENT(context, GLFogiv, "context = %d, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(BigGLEnum::FogParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1525,7 +1525,7 @@ void GL_APIENTRY GL_Frustum(GLdouble left,
           "context = %d, left = %f, right = %f, bottom = %f, top = %f, zNear = %f, zFar = %f",
           CID(context), left, right, bottom, top, zNear, zFar);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1549,7 +1549,7 @@ GLuint GL_APIENTRY GL_GenLists(GLsizei range)
     EVENT(context, GLGenLists, "context = %d, range = %d", CID(context), range);
 
     GLuint returnValue;
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1578,7 +1578,7 @@ void GL_APIENTRY GL_GetClipPlane(GLenum plane, GLdouble *equation)
     EVENT(context, GLGetClipPlane, "context = %d, plane = %s, equation = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::ClipPlaneName, plane), (uintptr_t)equation);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1602,7 +1602,7 @@ void GL_APIENTRY GL_GetDoublev(GLenum pname, GLdouble *data)
     EVENT(context, GLGetDoublev, "context = %d, pname = %s, data = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(BigGLEnum::GetPName, pname), (uintptr_t)data);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1627,7 +1627,7 @@ void GL_APIENTRY GL_GetLightiv(GLenum light, GLenum pname, GLint *params)
           CID(context), GLenumToString(BigGLEnum::LightName, light),
           GLenumToString(BigGLEnum::LightParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1652,7 +1652,7 @@ void GL_APIENTRY GL_GetMapdv(GLenum target, GLenum query, GLdouble *v)
           CID(context), GLenumToString(BigGLEnum::MapTarget, target),
           GLenumToString(BigGLEnum::GetMapQuery, query), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1677,7 +1677,7 @@ void GL_APIENTRY GL_GetMapfv(GLenum target, GLenum query, GLfloat *v)
           CID(context), GLenumToString(BigGLEnum::MapTarget, target),
           GLenumToString(BigGLEnum::GetMapQuery, query), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1702,7 +1702,7 @@ void GL_APIENTRY GL_GetMapiv(GLenum target, GLenum query, GLint *v)
           CID(context), GLenumToString(BigGLEnum::MapTarget, target),
           GLenumToString(BigGLEnum::GetMapQuery, query), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1728,7 +1728,7 @@ void GL_APIENTRY GL_GetMaterialiv(GLenum face, GLenum pname, GLint *params)
           GLenumToString(BigGLEnum::TriangleFace, face),
           GLenumToString(BigGLEnum::MaterialParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1752,7 +1752,7 @@ void GL_APIENTRY GL_GetPixelMapfv(GLenum map, GLfloat *values)
     EVENT(context, GLGetPixelMapfv, "context = %d, map = %s, values = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::PixelMap, map), (uintptr_t)values);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1776,7 +1776,7 @@ void GL_APIENTRY GL_GetPixelMapuiv(GLenum map, GLuint *values)
     EVENT(context, GLGetPixelMapuiv, "context = %d, map = %s, values = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::PixelMap, map), (uintptr_t)values);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1800,7 +1800,7 @@ void GL_APIENTRY GL_GetPixelMapusv(GLenum map, GLushort *values)
     EVENT(context, GLGetPixelMapusv, "context = %d, map = %s, values = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::PixelMap, map), (uintptr_t)values);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1824,7 +1824,7 @@ void GL_APIENTRY GL_GetPolygonStipple(GLubyte *mask)
     EVENT(context, GLGetPolygonStipple, "context = %d, mask = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)mask);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1850,7 +1850,7 @@ void GL_APIENTRY GL_GetTexGendv(GLenum coord, GLenum pname, GLdouble *params)
           GLenumToString(BigGLEnum::TextureCoordName, coord),
           GLenumToString(BigGLEnum::TextureGenParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1876,7 +1876,7 @@ void GL_APIENTRY GL_GetTexGenfv(GLenum coord, GLenum pname, GLfloat *params)
           GLenumToString(BigGLEnum::TextureCoordName, coord),
           GLenumToString(BigGLEnum::TextureGenParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1902,7 +1902,7 @@ void GL_APIENTRY GL_GetTexGeniv(GLenum coord, GLenum pname, GLint *params)
           GLenumToString(BigGLEnum::TextureCoordName, coord),
           GLenumToString(BigGLEnum::TextureGenParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1931,7 +1931,7 @@ GL_GetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pix
           GLenumToString(BigGLEnum::PixelFormat, format),
           GLenumToString(BigGLEnum::PixelType, type), (uintptr_t)pixels);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureTarget targetPacked = PackParam<TextureTarget>(target);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -1956,7 +1956,7 @@ void GL_APIENTRY GL_IndexMask(GLuint mask)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIndexMask, "context = %d, mask = %u", CID(context), mask);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1978,7 +1978,7 @@ void GL_APIENTRY GL_Indexd(GLdouble c)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIndexd, "context = %d, c = %f", CID(context), c);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -2000,7 +2000,7 @@ void GL_APIENTRY GL_Indexdv(const GLdouble *c)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIndexdv, "context = %d, c = 0x%016" PRIxPTR "", CID(context), (uintptr_t)c);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2022,7 +2022,7 @@ void GL_APIENTRY GL_Indexf(GLfloat c)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIndexf, "context = %d, c = %f", CID(context), c);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -2044,7 +2044,7 @@ void GL_APIENTRY GL_Indexfv(const GLfloat *c)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIndexfv, "context = %d, c = 0x%016" PRIxPTR "", CID(context), (uintptr_t)c);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2066,7 +2066,7 @@ void GL_APIENTRY GL_Indexi(GLint c)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIndexi, "context = %d, c = %d", CID(context), c);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -2088,7 +2088,7 @@ void GL_APIENTRY GL_Indexiv(const GLint *c)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIndexiv, "context = %d, c = 0x%016" PRIxPTR "", CID(context), (uintptr_t)c);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2110,7 +2110,7 @@ void GL_APIENTRY GL_Indexs(GLshort c)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIndexs, "context = %d, c = %d", CID(context), c);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -2132,7 +2132,7 @@ void GL_APIENTRY GL_Indexsv(const GLshort *c)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIndexsv, "context = %d, c = 0x%016" PRIxPTR "", CID(context), (uintptr_t)c);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2154,7 +2154,7 @@ void GL_APIENTRY GL_InitNames()
     Context *context = GetValidGlobalContext();
     EVENT(context, GLInitNames, "context = %d", CID(context));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2177,7 +2177,7 @@ GLboolean GL_APIENTRY GL_IsList(GLuint list)
     EVENT(context, GLIsList, "context = %d, list = %u", CID(context), list);
 
     GLboolean returnValue;
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2206,7 +2206,7 @@ void GL_APIENTRY GL_LightModeli(GLenum pname, GLint param)
     EVENT(context, GLLightModeli, "context = %d, pname = %s, param = %d", CID(context),
           GLenumToString(BigGLEnum::LightModelParameter, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -2230,7 +2230,7 @@ void GL_APIENTRY GL_LightModeliv(GLenum pname, const GLint *params)
     EVENT(context, GLLightModeliv, "context = %d, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::LightModelParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -2255,7 +2255,7 @@ void GL_APIENTRY GL_Lighti(GLenum light, GLenum pname, GLint param)
           GLenumToString(BigGLEnum::LightName, light),
           GLenumToString(BigGLEnum::LightParameter, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -2280,7 +2280,7 @@ void GL_APIENTRY GL_Lightiv(GLenum light, GLenum pname, const GLint *params)
           CID(context), GLenumToString(BigGLEnum::LightName, light),
           GLenumToString(BigGLEnum::LightParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -2304,7 +2304,7 @@ void GL_APIENTRY GL_LineStipple(GLint factor, GLushort pattern)
     EVENT(context, GLLineStipple, "context = %d, factor = %d, pattern = %u", CID(context), factor,
           pattern);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -2327,7 +2327,7 @@ void GL_APIENTRY GL_ListBase(GLuint base)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLListBase, "context = %d, base = %u", CID(context), base);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2350,7 +2350,7 @@ void GL_APIENTRY GL_LoadMatrixd(const GLdouble *m)
     EVENT(context, GLLoadMatrixd, "context = %d, m = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)m);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2372,7 +2372,7 @@ void GL_APIENTRY GL_LoadName(GLuint name)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLoadName, "context = %d, name = %u", CID(context), name);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2399,7 +2399,7 @@ GL_Map1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, con
           CID(context), GLenumToString(BigGLEnum::MapTarget, target), u1, u2, stride, order,
           (uintptr_t)points);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -2427,7 +2427,7 @@ GL_Map1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const
           CID(context), GLenumToString(BigGLEnum::MapTarget, target), u1, u2, stride, order,
           (uintptr_t)points);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -2463,7 +2463,7 @@ void GL_APIENTRY GL_Map2d(GLenum target,
           CID(context), GLenumToString(BigGLEnum::MapTarget, target), u1, u2, ustride, uorder, v1,
           v2, vstride, vorder, (uintptr_t)points);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2500,7 +2500,7 @@ void GL_APIENTRY GL_Map2f(GLenum target,
           CID(context), GLenumToString(BigGLEnum::MapTarget, target), u1, u2, ustride, uorder, v1,
           v2, vstride, vorder, (uintptr_t)points);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2525,7 +2525,7 @@ void GL_APIENTRY GL_MapGrid1d(GLint un, GLdouble u1, GLdouble u2)
     EVENT(context, GLMapGrid1d, "context = %d, un = %d, u1 = %f, u2 = %f", CID(context), un, u1,
           u2);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2548,7 +2548,7 @@ void GL_APIENTRY GL_MapGrid1f(GLint un, GLfloat u1, GLfloat u2)
     EVENT(context, GLMapGrid1f, "context = %d, un = %d, u1 = %f, u2 = %f", CID(context), un, u1,
           u2);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2573,7 +2573,7 @@ GL_MapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble
           "context = %d, un = %d, u1 = %f, u2 = %f, vn = %d, v1 = %f, v2 = %f", CID(context), un,
           u1, u2, vn, v1, v2);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -2598,7 +2598,7 @@ void GL_APIENTRY GL_MapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloa
           "context = %d, un = %d, u1 = %f, u2 = %f, vn = %d, v1 = %f, v2 = %f", CID(context), un,
           u1, u2, vn, v1, v2);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -2623,7 +2623,7 @@ void GL_APIENTRY GL_Materiali(GLenum face, GLenum pname, GLint param)
           GLenumToString(BigGLEnum::TriangleFace, face),
           GLenumToString(BigGLEnum::MaterialParameter, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -2648,7 +2648,7 @@ void GL_APIENTRY GL_Materialiv(GLenum face, GLenum pname, const GLint *params)
           CID(context), GLenumToString(BigGLEnum::TriangleFace, face),
           GLenumToString(BigGLEnum::MaterialParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -2672,7 +2672,7 @@ void GL_APIENTRY GL_MultMatrixd(const GLdouble *m)
     EVENT(context, GLMultMatrixd, "context = %d, m = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)m);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2695,7 +2695,7 @@ void GL_APIENTRY GL_NewList(GLuint list, GLenum mode)
     EVENT(context, GLNewList, "context = %d, list = %u, mode = %s", CID(context), list,
           GLenumToString(BigGLEnum::ListMode, mode));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2717,7 +2717,7 @@ void GL_APIENTRY GL_Normal3b(GLbyte nx, GLbyte ny, GLbyte nz)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLNormal3b, "context = %d, nx = %d, ny = %d, nz = %d", CID(context), nx, ny, nz);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2739,7 +2739,7 @@ void GL_APIENTRY GL_Normal3bv(const GLbyte *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLNormal3bv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2761,7 +2761,7 @@ void GL_APIENTRY GL_Normal3d(GLdouble nx, GLdouble ny, GLdouble nz)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLNormal3d, "context = %d, nx = %f, ny = %f, nz = %f", CID(context), nx, ny, nz);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2783,7 +2783,7 @@ void GL_APIENTRY GL_Normal3dv(const GLdouble *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLNormal3dv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2805,7 +2805,7 @@ void GL_APIENTRY GL_Normal3fv(const GLfloat *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLNormal3fv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2827,7 +2827,7 @@ void GL_APIENTRY GL_Normal3i(GLint nx, GLint ny, GLint nz)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLNormal3i, "context = %d, nx = %d, ny = %d, nz = %d", CID(context), nx, ny, nz);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2849,7 +2849,7 @@ void GL_APIENTRY GL_Normal3iv(const GLint *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLNormal3iv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2871,7 +2871,7 @@ void GL_APIENTRY GL_Normal3s(GLshort nx, GLshort ny, GLshort nz)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLNormal3s, "context = %d, nx = %d, ny = %d, nz = %d", CID(context), nx, ny, nz);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2893,7 +2893,7 @@ void GL_APIENTRY GL_Normal3sv(const GLshort *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLNormal3sv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2922,7 +2922,7 @@ void GL_APIENTRY GL_Ortho(GLdouble left,
           "context = %d, left = %f, right = %f, bottom = %f, top = %f, zNear = %f, zFar = %f",
           CID(context), left, right, bottom, top, zNear, zFar);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -2945,7 +2945,7 @@ void GL_APIENTRY GL_PassThrough(GLfloat token)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPassThrough, "context = %d, token = %f", CID(context), token);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2968,7 +2968,7 @@ void GL_APIENTRY GL_PixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *value
     EVENT(context, GLPixelMapfv, "context = %d, map = %s, mapsize = %d, values = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::PixelMap, map), mapsize, (uintptr_t)values);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -2993,7 +2993,7 @@ void GL_APIENTRY GL_PixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *value
           "context = %d, map = %s, mapsize = %d, values = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(BigGLEnum::PixelMap, map), mapsize, (uintptr_t)values);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -3018,7 +3018,7 @@ void GL_APIENTRY GL_PixelMapusv(GLenum map, GLsizei mapsize, const GLushort *val
           "context = %d, map = %s, mapsize = %d, values = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(BigGLEnum::PixelMap, map), mapsize, (uintptr_t)values);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -3042,7 +3042,7 @@ void GL_APIENTRY GL_PixelStoref(GLenum pname, GLfloat param)
     EVENT(context, GLPixelStoref, "context = %d, pname = %s, param = %f", CID(context),
           GLenumToString(BigGLEnum::PixelStoreParameter, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -3066,7 +3066,7 @@ void GL_APIENTRY GL_PixelTransferf(GLenum pname, GLfloat param)
     EVENT(context, GLPixelTransferf, "context = %d, pname = %s, param = %f", CID(context),
           GLenumToString(BigGLEnum::PixelTransferParameter, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -3090,7 +3090,7 @@ void GL_APIENTRY GL_PixelTransferi(GLenum pname, GLint param)
     EVENT(context, GLPixelTransferi, "context = %d, pname = %s, param = %d", CID(context),
           GLenumToString(BigGLEnum::PixelTransferParameter, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -3114,7 +3114,7 @@ void GL_APIENTRY GL_PixelZoom(GLfloat xfactor, GLfloat yfactor)
     EVENT(context, GLPixelZoom, "context = %d, xfactor = %f, yfactor = %f", CID(context), xfactor,
           yfactor);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -3139,7 +3139,7 @@ void GL_APIENTRY GL_PolygonMode(GLenum face, GLenum mode)
           GLenumToString(BigGLEnum::TriangleFace, face),
           GLenumToString(BigGLEnum::PolygonMode, mode));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -3163,7 +3163,7 @@ void GL_APIENTRY GL_PolygonStipple(const GLubyte *mask)
     EVENT(context, GLPolygonStipple, "context = %d, mask = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)mask);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -3186,7 +3186,7 @@ void GL_APIENTRY GL_PopAttrib()
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPopAttrib, "context = %d", CID(context));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3208,7 +3208,7 @@ void GL_APIENTRY GL_PopName()
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPopName, "context = %d", CID(context));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -3231,7 +3231,7 @@ void GL_APIENTRY GL_PushAttrib(GLbitfield mask)
     EVENT(context, GLPushAttrib, "context = %d, mask = %s", CID(context),
           GLbitfieldToString(BigGLEnum::AttribMask, mask).c_str());
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3253,7 +3253,7 @@ void GL_APIENTRY GL_PushName(GLuint name)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPushName, "context = %d, name = %u", CID(context), name);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3275,7 +3275,7 @@ void GL_APIENTRY GL_RasterPos2d(GLdouble x, GLdouble y)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLRasterPos2d, "context = %d, x = %f, y = %f", CID(context), x, y);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3298,7 +3298,7 @@ void GL_APIENTRY GL_RasterPos2dv(const GLdouble *v)
     EVENT(context, GLRasterPos2dv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3320,7 +3320,7 @@ void GL_APIENTRY GL_RasterPos2f(GLfloat x, GLfloat y)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLRasterPos2f, "context = %d, x = %f, y = %f", CID(context), x, y);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3343,7 +3343,7 @@ void GL_APIENTRY GL_RasterPos2fv(const GLfloat *v)
     EVENT(context, GLRasterPos2fv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3365,7 +3365,7 @@ void GL_APIENTRY GL_RasterPos2i(GLint x, GLint y)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLRasterPos2i, "context = %d, x = %d, y = %d", CID(context), x, y);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3388,7 +3388,7 @@ void GL_APIENTRY GL_RasterPos2iv(const GLint *v)
     EVENT(context, GLRasterPos2iv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3410,7 +3410,7 @@ void GL_APIENTRY GL_RasterPos2s(GLshort x, GLshort y)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLRasterPos2s, "context = %d, x = %d, y = %d", CID(context), x, y);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3433,7 +3433,7 @@ void GL_APIENTRY GL_RasterPos2sv(const GLshort *v)
     EVENT(context, GLRasterPos2sv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3455,7 +3455,7 @@ void GL_APIENTRY GL_RasterPos3d(GLdouble x, GLdouble y, GLdouble z)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLRasterPos3d, "context = %d, x = %f, y = %f, z = %f", CID(context), x, y, z);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -3479,7 +3479,7 @@ void GL_APIENTRY GL_RasterPos3dv(const GLdouble *v)
     EVENT(context, GLRasterPos3dv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3501,7 +3501,7 @@ void GL_APIENTRY GL_RasterPos3f(GLfloat x, GLfloat y, GLfloat z)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLRasterPos3f, "context = %d, x = %f, y = %f, z = %f", CID(context), x, y, z);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -3525,7 +3525,7 @@ void GL_APIENTRY GL_RasterPos3fv(const GLfloat *v)
     EVENT(context, GLRasterPos3fv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3547,7 +3547,7 @@ void GL_APIENTRY GL_RasterPos3i(GLint x, GLint y, GLint z)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLRasterPos3i, "context = %d, x = %d, y = %d, z = %d", CID(context), x, y, z);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -3571,7 +3571,7 @@ void GL_APIENTRY GL_RasterPos3iv(const GLint *v)
     EVENT(context, GLRasterPos3iv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3593,7 +3593,7 @@ void GL_APIENTRY GL_RasterPos3s(GLshort x, GLshort y, GLshort z)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLRasterPos3s, "context = %d, x = %d, y = %d, z = %d", CID(context), x, y, z);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -3617,7 +3617,7 @@ void GL_APIENTRY GL_RasterPos3sv(const GLshort *v)
     EVENT(context, GLRasterPos3sv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3640,7 +3640,7 @@ void GL_APIENTRY GL_RasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
     EVENT(context, GLRasterPos4d, "context = %d, x = %f, y = %f, z = %f, w = %f", CID(context), x,
           y, z, w);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -3664,7 +3664,7 @@ void GL_APIENTRY GL_RasterPos4dv(const GLdouble *v)
     EVENT(context, GLRasterPos4dv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3687,7 +3687,7 @@ void GL_APIENTRY GL_RasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
     EVENT(context, GLRasterPos4f, "context = %d, x = %f, y = %f, z = %f, w = %f", CID(context), x,
           y, z, w);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -3711,7 +3711,7 @@ void GL_APIENTRY GL_RasterPos4fv(const GLfloat *v)
     EVENT(context, GLRasterPos4fv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3734,7 +3734,7 @@ void GL_APIENTRY GL_RasterPos4i(GLint x, GLint y, GLint z, GLint w)
     EVENT(context, GLRasterPos4i, "context = %d, x = %d, y = %d, z = %d, w = %d", CID(context), x,
           y, z, w);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -3758,7 +3758,7 @@ void GL_APIENTRY GL_RasterPos4iv(const GLint *v)
     EVENT(context, GLRasterPos4iv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3781,7 +3781,7 @@ void GL_APIENTRY GL_RasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w)
     EVENT(context, GLRasterPos4s, "context = %d, x = %d, y = %d, z = %d, w = %d", CID(context), x,
           y, z, w);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -3805,7 +3805,7 @@ void GL_APIENTRY GL_RasterPos4sv(const GLshort *v)
     EVENT(context, GLRasterPos4sv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3828,7 +3828,7 @@ void GL_APIENTRY GL_Rectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2)
     EVENT(context, GLRectd, "context = %d, x1 = %f, y1 = %f, x2 = %f, y2 = %f", CID(context), x1,
           y1, x2, y2);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3851,7 +3851,7 @@ void GL_APIENTRY GL_Rectdv(const GLdouble *v1, const GLdouble *v2)
     EVENT(context, GLRectdv, "context = %d, v1 = 0x%016" PRIxPTR ", v2 = 0x%016" PRIxPTR "",
           CID(context), (uintptr_t)v1, (uintptr_t)v2);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3874,7 +3874,7 @@ void GL_APIENTRY GL_Rectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2)
     EVENT(context, GLRectf, "context = %d, x1 = %f, y1 = %f, x2 = %f, y2 = %f", CID(context), x1,
           y1, x2, y2);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3897,7 +3897,7 @@ void GL_APIENTRY GL_Rectfv(const GLfloat *v1, const GLfloat *v2)
     EVENT(context, GLRectfv, "context = %d, v1 = 0x%016" PRIxPTR ", v2 = 0x%016" PRIxPTR "",
           CID(context), (uintptr_t)v1, (uintptr_t)v2);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3920,7 +3920,7 @@ void GL_APIENTRY GL_Recti(GLint x1, GLint y1, GLint x2, GLint y2)
     EVENT(context, GLRecti, "context = %d, x1 = %d, y1 = %d, x2 = %d, y2 = %d", CID(context), x1,
           y1, x2, y2);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3943,7 +3943,7 @@ void GL_APIENTRY GL_Rectiv(const GLint *v1, const GLint *v2)
     EVENT(context, GLRectiv, "context = %d, v1 = 0x%016" PRIxPTR ", v2 = 0x%016" PRIxPTR "",
           CID(context), (uintptr_t)v1, (uintptr_t)v2);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3966,7 +3966,7 @@ void GL_APIENTRY GL_Rects(GLshort x1, GLshort y1, GLshort x2, GLshort y2)
     EVENT(context, GLRects, "context = %d, x1 = %d, y1 = %d, x2 = %d, y2 = %d", CID(context), x1,
           y1, x2, y2);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3989,7 +3989,7 @@ void GL_APIENTRY GL_Rectsv(const GLshort *v1, const GLshort *v2)
     EVENT(context, GLRectsv, "context = %d, v1 = 0x%016" PRIxPTR ", v2 = 0x%016" PRIxPTR "",
           CID(context), (uintptr_t)v1, (uintptr_t)v2);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4013,7 +4013,7 @@ GLint GL_APIENTRY GL_RenderMode(GLenum mode)
           GLenumToString(BigGLEnum::RenderingMode, mode));
 
     GLint returnValue;
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4042,7 +4042,7 @@ void GL_APIENTRY GL_Rotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z)
     EVENT(context, GLRotated, "context = %d, angle = %f, x = %f, y = %f, z = %f", CID(context),
           angle, x, y, z);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4064,7 +4064,7 @@ void GL_APIENTRY GL_Scaled(GLdouble x, GLdouble y, GLdouble z)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLScaled, "context = %d, x = %f, y = %f, z = %f", CID(context), x, y, z);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4087,7 +4087,7 @@ void GL_APIENTRY GL_SelectBuffer(GLsizei size, GLuint *buffer)
     EVENT(context, GLSelectBuffer, "context = %d, size = %d, buffer = 0x%016" PRIxPTR "",
           CID(context), size, (uintptr_t)buffer);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -4110,7 +4110,7 @@ void GL_APIENTRY GL_TexCoord1d(GLdouble s)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexCoord1d, "context = %d, s = %f", CID(context), s);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4133,7 +4133,7 @@ void GL_APIENTRY GL_TexCoord1dv(const GLdouble *v)
     EVENT(context, GLTexCoord1dv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4155,7 +4155,7 @@ void GL_APIENTRY GL_TexCoord1f(GLfloat s)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexCoord1f, "context = %d, s = %f", CID(context), s);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4178,7 +4178,7 @@ void GL_APIENTRY GL_TexCoord1fv(const GLfloat *v)
     EVENT(context, GLTexCoord1fv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4200,7 +4200,7 @@ void GL_APIENTRY GL_TexCoord1i(GLint s)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexCoord1i, "context = %d, s = %d", CID(context), s);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4223,7 +4223,7 @@ void GL_APIENTRY GL_TexCoord1iv(const GLint *v)
     EVENT(context, GLTexCoord1iv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4245,7 +4245,7 @@ void GL_APIENTRY GL_TexCoord1s(GLshort s)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexCoord1s, "context = %d, s = %d", CID(context), s);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4268,7 +4268,7 @@ void GL_APIENTRY GL_TexCoord1sv(const GLshort *v)
     EVENT(context, GLTexCoord1sv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4290,7 +4290,7 @@ void GL_APIENTRY GL_TexCoord2d(GLdouble s, GLdouble t)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexCoord2d, "context = %d, s = %f, t = %f", CID(context), s, t);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4313,7 +4313,7 @@ void GL_APIENTRY GL_TexCoord2dv(const GLdouble *v)
     EVENT(context, GLTexCoord2dv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4335,7 +4335,7 @@ void GL_APIENTRY GL_TexCoord2f(GLfloat s, GLfloat t)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexCoord2f, "context = %d, s = %f, t = %f", CID(context), s, t);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4358,7 +4358,7 @@ void GL_APIENTRY GL_TexCoord2fv(const GLfloat *v)
     EVENT(context, GLTexCoord2fv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4380,7 +4380,7 @@ void GL_APIENTRY GL_TexCoord2i(GLint s, GLint t)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexCoord2i, "context = %d, s = %d, t = %d", CID(context), s, t);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4403,7 +4403,7 @@ void GL_APIENTRY GL_TexCoord2iv(const GLint *v)
     EVENT(context, GLTexCoord2iv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4425,7 +4425,7 @@ void GL_APIENTRY GL_TexCoord2s(GLshort s, GLshort t)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexCoord2s, "context = %d, s = %d, t = %d", CID(context), s, t);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4448,7 +4448,7 @@ void GL_APIENTRY GL_TexCoord2sv(const GLshort *v)
     EVENT(context, GLTexCoord2sv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4470,7 +4470,7 @@ void GL_APIENTRY GL_TexCoord3d(GLdouble s, GLdouble t, GLdouble r)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexCoord3d, "context = %d, s = %f, t = %f, r = %f", CID(context), s, t, r);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4493,7 +4493,7 @@ void GL_APIENTRY GL_TexCoord3dv(const GLdouble *v)
     EVENT(context, GLTexCoord3dv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4515,7 +4515,7 @@ void GL_APIENTRY GL_TexCoord3f(GLfloat s, GLfloat t, GLfloat r)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexCoord3f, "context = %d, s = %f, t = %f, r = %f", CID(context), s, t, r);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4538,7 +4538,7 @@ void GL_APIENTRY GL_TexCoord3fv(const GLfloat *v)
     EVENT(context, GLTexCoord3fv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4560,7 +4560,7 @@ void GL_APIENTRY GL_TexCoord3i(GLint s, GLint t, GLint r)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexCoord3i, "context = %d, s = %d, t = %d, r = %d", CID(context), s, t, r);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4583,7 +4583,7 @@ void GL_APIENTRY GL_TexCoord3iv(const GLint *v)
     EVENT(context, GLTexCoord3iv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4605,7 +4605,7 @@ void GL_APIENTRY GL_TexCoord3s(GLshort s, GLshort t, GLshort r)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexCoord3s, "context = %d, s = %d, t = %d, r = %d", CID(context), s, t, r);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4628,7 +4628,7 @@ void GL_APIENTRY GL_TexCoord3sv(const GLshort *v)
     EVENT(context, GLTexCoord3sv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4651,7 +4651,7 @@ void GL_APIENTRY GL_TexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q)
     EVENT(context, GLTexCoord4d, "context = %d, s = %f, t = %f, r = %f, q = %f", CID(context), s, t,
           r, q);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -4675,7 +4675,7 @@ void GL_APIENTRY GL_TexCoord4dv(const GLdouble *v)
     EVENT(context, GLTexCoord4dv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4698,7 +4698,7 @@ void GL_APIENTRY GL_TexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q)
     EVENT(context, GLTexCoord4f, "context = %d, s = %f, t = %f, r = %f, q = %f", CID(context), s, t,
           r, q);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -4722,7 +4722,7 @@ void GL_APIENTRY GL_TexCoord4fv(const GLfloat *v)
     EVENT(context, GLTexCoord4fv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4745,7 +4745,7 @@ void GL_APIENTRY GL_TexCoord4i(GLint s, GLint t, GLint r, GLint q)
     EVENT(context, GLTexCoord4i, "context = %d, s = %d, t = %d, r = %d, q = %d", CID(context), s, t,
           r, q);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -4769,7 +4769,7 @@ void GL_APIENTRY GL_TexCoord4iv(const GLint *v)
     EVENT(context, GLTexCoord4iv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4792,7 +4792,7 @@ void GL_APIENTRY GL_TexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q)
     EVENT(context, GLTexCoord4s, "context = %d, s = %d, t = %d, r = %d, q = %d", CID(context), s, t,
           r, q);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -4816,7 +4816,7 @@ void GL_APIENTRY GL_TexCoord4sv(const GLshort *v)
     EVENT(context, GLTexCoord4sv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4840,7 +4840,7 @@ void GL_APIENTRY GL_TexGend(GLenum coord, GLenum pname, GLdouble param)
           GLenumToString(BigGLEnum::TextureCoordName, coord),
           GLenumToString(BigGLEnum::TextureGenParameter, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -4865,7 +4865,7 @@ void GL_APIENTRY GL_TexGendv(GLenum coord, GLenum pname, const GLdouble *params)
           CID(context), GLenumToString(BigGLEnum::TextureCoordName, coord),
           GLenumToString(BigGLEnum::TextureGenParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -4890,7 +4890,7 @@ void GL_APIENTRY GL_TexGenf(GLenum coord, GLenum pname, GLfloat param)
           GLenumToString(BigGLEnum::TextureCoordName, coord),
           GLenumToString(BigGLEnum::TextureGenParameter, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -4915,7 +4915,7 @@ void GL_APIENTRY GL_TexGenfv(GLenum coord, GLenum pname, const GLfloat *params)
           CID(context), GLenumToString(BigGLEnum::TextureCoordName, coord),
           GLenumToString(BigGLEnum::TextureGenParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -4940,7 +4940,7 @@ void GL_APIENTRY GL_TexGeni(GLenum coord, GLenum pname, GLint param)
           GLenumToString(BigGLEnum::TextureCoordName, coord),
           GLenumToString(BigGLEnum::TextureGenParameter, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -4965,7 +4965,7 @@ void GL_APIENTRY GL_TexGeniv(GLenum coord, GLenum pname, const GLint *params)
           CID(context), GLenumToString(BigGLEnum::TextureCoordName, coord),
           GLenumToString(BigGLEnum::TextureGenParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -5000,7 +5000,7 @@ void GL_APIENTRY GL_TexImage1D(GLenum target,
           width, border, GLenumToString(BigGLEnum::PixelFormat, format),
           GLenumToString(BigGLEnum::PixelType, type), (uintptr_t)pixels);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -5025,7 +5025,7 @@ void GL_APIENTRY GL_Translated(GLdouble x, GLdouble y, GLdouble z)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTranslated, "context = %d, x = %f, y = %f, z = %f", CID(context), x, y, z);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5047,7 +5047,7 @@ void GL_APIENTRY GL_Vertex2d(GLdouble x, GLdouble y)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertex2d, "context = %d, x = %f, y = %f", CID(context), x, y);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5069,7 +5069,7 @@ void GL_APIENTRY GL_Vertex2dv(const GLdouble *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertex2dv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5091,7 +5091,7 @@ void GL_APIENTRY GL_Vertex2f(GLfloat x, GLfloat y)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertex2f, "context = %d, x = %f, y = %f", CID(context), x, y);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5113,7 +5113,7 @@ void GL_APIENTRY GL_Vertex2fv(const GLfloat *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertex2fv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5135,7 +5135,7 @@ void GL_APIENTRY GL_Vertex2i(GLint x, GLint y)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertex2i, "context = %d, x = %d, y = %d", CID(context), x, y);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5157,7 +5157,7 @@ void GL_APIENTRY GL_Vertex2iv(const GLint *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertex2iv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5179,7 +5179,7 @@ void GL_APIENTRY GL_Vertex2s(GLshort x, GLshort y)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertex2s, "context = %d, x = %d, y = %d", CID(context), x, y);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5201,7 +5201,7 @@ void GL_APIENTRY GL_Vertex2sv(const GLshort *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertex2sv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5223,7 +5223,7 @@ void GL_APIENTRY GL_Vertex3d(GLdouble x, GLdouble y, GLdouble z)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertex3d, "context = %d, x = %f, y = %f, z = %f", CID(context), x, y, z);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5245,7 +5245,7 @@ void GL_APIENTRY GL_Vertex3dv(const GLdouble *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertex3dv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5267,7 +5267,7 @@ void GL_APIENTRY GL_Vertex3f(GLfloat x, GLfloat y, GLfloat z)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertex3f, "context = %d, x = %f, y = %f, z = %f", CID(context), x, y, z);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5289,7 +5289,7 @@ void GL_APIENTRY GL_Vertex3fv(const GLfloat *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertex3fv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5311,7 +5311,7 @@ void GL_APIENTRY GL_Vertex3i(GLint x, GLint y, GLint z)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertex3i, "context = %d, x = %d, y = %d, z = %d", CID(context), x, y, z);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5333,7 +5333,7 @@ void GL_APIENTRY GL_Vertex3iv(const GLint *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertex3iv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5355,7 +5355,7 @@ void GL_APIENTRY GL_Vertex3s(GLshort x, GLshort y, GLshort z)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertex3s, "context = %d, x = %d, y = %d, z = %d", CID(context), x, y, z);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5377,7 +5377,7 @@ void GL_APIENTRY GL_Vertex3sv(const GLshort *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertex3sv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5400,7 +5400,7 @@ void GL_APIENTRY GL_Vertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
     EVENT(context, GLVertex4d, "context = %d, x = %f, y = %f, z = %f, w = %f", CID(context), x, y,
           z, w);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5422,7 +5422,7 @@ void GL_APIENTRY GL_Vertex4dv(const GLdouble *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertex4dv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5445,7 +5445,7 @@ void GL_APIENTRY GL_Vertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
     EVENT(context, GLVertex4f, "context = %d, x = %f, y = %f, z = %f, w = %f", CID(context), x, y,
           z, w);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5467,7 +5467,7 @@ void GL_APIENTRY GL_Vertex4fv(const GLfloat *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertex4fv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5490,7 +5490,7 @@ void GL_APIENTRY GL_Vertex4i(GLint x, GLint y, GLint z, GLint w)
     EVENT(context, GLVertex4i, "context = %d, x = %d, y = %d, z = %d, w = %d", CID(context), x, y,
           z, w);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5512,7 +5512,7 @@ void GL_APIENTRY GL_Vertex4iv(const GLint *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertex4iv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5535,7 +5535,7 @@ void GL_APIENTRY GL_Vertex4s(GLshort x, GLshort y, GLshort z, GLshort w)
     EVENT(context, GLVertex4s, "context = %d, x = %d, y = %d, z = %d, w = %d", CID(context), x, y,
           z, w);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5557,7 +5557,7 @@ void GL_APIENTRY GL_Vertex4sv(const GLshort *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertex4sv, "context = %d, v = 0x%016" PRIxPTR "", CID(context), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5585,7 +5585,7 @@ GLboolean GL_APIENTRY GL_AreTexturesResident(GLsizei n,
           CID(context), n, (uintptr_t)textures, (uintptr_t)residences);
 
     GLboolean returnValue;
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -5617,7 +5617,7 @@ void GL_APIENTRY GL_ArrayElement(GLint i)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLArrayElement, "context = %d, i = %d", CID(context), i);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5649,7 +5649,7 @@ void GL_APIENTRY GL_CopyTexImage1D(GLenum target,
           CID(context), GLenumToString(BigGLEnum::TextureTarget, target), level,
           GLenumToString(BigGLEnum::InternalFormat, internalformat), x, y, width, border);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -5678,7 +5678,7 @@ GL_CopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y
           CID(context), GLenumToString(BigGLEnum::TextureTarget, target), level, xoffset, x, y,
           width);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -5704,7 +5704,7 @@ void GL_APIENTRY GL_EdgeFlagPointer(GLsizei stride, const void *pointer)
     EVENT(context, GLEdgeFlagPointer, "context = %d, stride = %d, pointer = 0x%016" PRIxPTR "",
           CID(context), stride, (uintptr_t)pointer);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5729,7 +5729,7 @@ void GL_APIENTRY GL_IndexPointer(GLenum type, GLsizei stride, const void *pointe
           "context = %d, type = %s, stride = %d, pointer = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(BigGLEnum::IndexPointerType, type), stride, (uintptr_t)pointer);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5752,7 +5752,7 @@ void GL_APIENTRY GL_Indexub(GLubyte c)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIndexub, "context = %d, c = %d", CID(context), c);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5774,7 +5774,7 @@ void GL_APIENTRY GL_Indexubv(const GLubyte *c)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIndexubv, "context = %d, c = 0x%016" PRIxPTR "", CID(context), (uintptr_t)c);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5798,7 +5798,7 @@ void GL_APIENTRY GL_InterleavedArrays(GLenum format, GLsizei stride, const void
           "context = %d, format = %s, stride = %d, pointer = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(BigGLEnum::InterleavedArrayFormat, format), stride, (uintptr_t)pointer);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -5822,7 +5822,7 @@ void GL_APIENTRY GL_PopClientAttrib()
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPopClientAttrib, "context = %d", CID(context));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5846,7 +5846,7 @@ void GL_APIENTRY GL_PrioritizeTextures(GLsizei n, const GLuint *textures, const
           "context = %d, n = %d, textures = 0x%016" PRIxPTR ", priorities = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)textures, (uintptr_t)priorities);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -5871,7 +5871,7 @@ void GL_APIENTRY GL_PushClientAttrib(GLbitfield mask)
     EVENT(context, GLPushClientAttrib, "context = %d, mask = %s", CID(context),
           GLbitfieldToString(BigGLEnum::ClientAttribMask, mask).c_str());
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -5905,7 +5905,7 @@ void GL_APIENTRY GL_TexSubImage1D(GLenum target,
           GLenumToString(BigGLEnum::PixelFormat, format),
           GLenumToString(BigGLEnum::PixelType, type), (uintptr_t)pixels);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -5944,7 +5944,7 @@ void GL_APIENTRY GL_CompressedTexImage1D(GLenum target,
           GLenumToString(BigGLEnum::InternalFormat, internalformat), width, border, imageSize,
           (uintptr_t)data);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5980,7 +5980,7 @@ void GL_APIENTRY GL_CompressedTexSubImage1D(GLenum target,
           CID(context), GLenumToString(BigGLEnum::TextureTarget, target), level, xoffset, width,
           GLenumToString(BigGLEnum::InternalFormat, format), imageSize, (uintptr_t)data);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -6008,7 +6008,7 @@ void GL_APIENTRY GL_GetCompressedTexImage(GLenum target, GLint level, void *img)
           "context = %d, target = %s, level = %d, img = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(BigGLEnum::TextureTarget, target), level, (uintptr_t)img);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureTarget targetPacked = PackParam<TextureTarget>(target);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -6034,7 +6034,7 @@ void GL_APIENTRY GL_LoadTransposeMatrixd(const GLdouble *m)
     EVENT(context, GLLoadTransposeMatrixd, "context = %d, m = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)m);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6058,7 +6058,7 @@ void GL_APIENTRY GL_LoadTransposeMatrixf(const GLfloat *m)
     EVENT(context, GLLoadTransposeMatrixf, "context = %d, m = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)m);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6082,7 +6082,7 @@ void GL_APIENTRY GL_MultTransposeMatrixd(const GLdouble *m)
     EVENT(context, GLMultTransposeMatrixd, "context = %d, m = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)m);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6106,7 +6106,7 @@ void GL_APIENTRY GL_MultTransposeMatrixf(const GLfloat *m)
     EVENT(context, GLMultTransposeMatrixf, "context = %d, m = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)m);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6130,7 +6130,7 @@ void GL_APIENTRY GL_MultiTexCoord1d(GLenum target, GLdouble s)
     EVENT(context, GLMultiTexCoord1d, "context = %d, target = %s, s = %f", CID(context),
           GLenumToString(BigGLEnum::TextureUnit, target), s);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6154,7 +6154,7 @@ void GL_APIENTRY GL_MultiTexCoord1dv(GLenum target, const GLdouble *v)
     EVENT(context, GLMultiTexCoord1dv, "context = %d, target = %s, v = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::TextureUnit, target), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6178,7 +6178,7 @@ void GL_APIENTRY GL_MultiTexCoord1f(GLenum target, GLfloat s)
     EVENT(context, GLMultiTexCoord1f, "context = %d, target = %s, s = %f", CID(context),
           GLenumToString(BigGLEnum::TextureUnit, target), s);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6202,7 +6202,7 @@ void GL_APIENTRY GL_MultiTexCoord1fv(GLenum target, const GLfloat *v)
     EVENT(context, GLMultiTexCoord1fv, "context = %d, target = %s, v = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::TextureUnit, target), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6226,7 +6226,7 @@ void GL_APIENTRY GL_MultiTexCoord1i(GLenum target, GLint s)
     EVENT(context, GLMultiTexCoord1i, "context = %d, target = %s, s = %d", CID(context),
           GLenumToString(BigGLEnum::TextureUnit, target), s);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6250,7 +6250,7 @@ void GL_APIENTRY GL_MultiTexCoord1iv(GLenum target, const GLint *v)
     EVENT(context, GLMultiTexCoord1iv, "context = %d, target = %s, v = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::TextureUnit, target), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6274,7 +6274,7 @@ void GL_APIENTRY GL_MultiTexCoord1s(GLenum target, GLshort s)
     EVENT(context, GLMultiTexCoord1s, "context = %d, target = %s, s = %d", CID(context),
           GLenumToString(BigGLEnum::TextureUnit, target), s);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6298,7 +6298,7 @@ void GL_APIENTRY GL_MultiTexCoord1sv(GLenum target, const GLshort *v)
     EVENT(context, GLMultiTexCoord1sv, "context = %d, target = %s, v = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::TextureUnit, target), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6322,7 +6322,7 @@ void GL_APIENTRY GL_MultiTexCoord2d(GLenum target, GLdouble s, GLdouble t)
     EVENT(context, GLMultiTexCoord2d, "context = %d, target = %s, s = %f, t = %f", CID(context),
           GLenumToString(BigGLEnum::TextureUnit, target), s, t);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6346,7 +6346,7 @@ void GL_APIENTRY GL_MultiTexCoord2dv(GLenum target, const GLdouble *v)
     EVENT(context, GLMultiTexCoord2dv, "context = %d, target = %s, v = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::TextureUnit, target), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6370,7 +6370,7 @@ void GL_APIENTRY GL_MultiTexCoord2f(GLenum target, GLfloat s, GLfloat t)
     EVENT(context, GLMultiTexCoord2f, "context = %d, target = %s, s = %f, t = %f", CID(context),
           GLenumToString(BigGLEnum::TextureUnit, target), s, t);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6394,7 +6394,7 @@ void GL_APIENTRY GL_MultiTexCoord2fv(GLenum target, const GLfloat *v)
     EVENT(context, GLMultiTexCoord2fv, "context = %d, target = %s, v = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::TextureUnit, target), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6418,7 +6418,7 @@ void GL_APIENTRY GL_MultiTexCoord2i(GLenum target, GLint s, GLint t)
     EVENT(context, GLMultiTexCoord2i, "context = %d, target = %s, s = %d, t = %d", CID(context),
           GLenumToString(BigGLEnum::TextureUnit, target), s, t);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6442,7 +6442,7 @@ void GL_APIENTRY GL_MultiTexCoord2iv(GLenum target, const GLint *v)
     EVENT(context, GLMultiTexCoord2iv, "context = %d, target = %s, v = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::TextureUnit, target), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6466,7 +6466,7 @@ void GL_APIENTRY GL_MultiTexCoord2s(GLenum target, GLshort s, GLshort t)
     EVENT(context, GLMultiTexCoord2s, "context = %d, target = %s, s = %d, t = %d", CID(context),
           GLenumToString(BigGLEnum::TextureUnit, target), s, t);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6490,7 +6490,7 @@ void GL_APIENTRY GL_MultiTexCoord2sv(GLenum target, const GLshort *v)
     EVENT(context, GLMultiTexCoord2sv, "context = %d, target = %s, v = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::TextureUnit, target), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6514,7 +6514,7 @@ void GL_APIENTRY GL_MultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdou
     EVENT(context, GLMultiTexCoord3d, "context = %d, target = %s, s = %f, t = %f, r = %f",
           CID(context), GLenumToString(BigGLEnum::TextureUnit, target), s, t, r);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -6538,7 +6538,7 @@ void GL_APIENTRY GL_MultiTexCoord3dv(GLenum target, const GLdouble *v)
     EVENT(context, GLMultiTexCoord3dv, "context = %d, target = %s, v = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::TextureUnit, target), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6562,7 +6562,7 @@ void GL_APIENTRY GL_MultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat
     EVENT(context, GLMultiTexCoord3f, "context = %d, target = %s, s = %f, t = %f, r = %f",
           CID(context), GLenumToString(BigGLEnum::TextureUnit, target), s, t, r);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -6586,7 +6586,7 @@ void GL_APIENTRY GL_MultiTexCoord3fv(GLenum target, const GLfloat *v)
     EVENT(context, GLMultiTexCoord3fv, "context = %d, target = %s, v = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::TextureUnit, target), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6610,7 +6610,7 @@ void GL_APIENTRY GL_MultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r)
     EVENT(context, GLMultiTexCoord3i, "context = %d, target = %s, s = %d, t = %d, r = %d",
           CID(context), GLenumToString(BigGLEnum::TextureUnit, target), s, t, r);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -6634,7 +6634,7 @@ void GL_APIENTRY GL_MultiTexCoord3iv(GLenum target, const GLint *v)
     EVENT(context, GLMultiTexCoord3iv, "context = %d, target = %s, v = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::TextureUnit, target), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6658,7 +6658,7 @@ void GL_APIENTRY GL_MultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort
     EVENT(context, GLMultiTexCoord3s, "context = %d, target = %s, s = %d, t = %d, r = %d",
           CID(context), GLenumToString(BigGLEnum::TextureUnit, target), s, t, r);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -6682,7 +6682,7 @@ void GL_APIENTRY GL_MultiTexCoord3sv(GLenum target, const GLshort *v)
     EVENT(context, GLMultiTexCoord3sv, "context = %d, target = %s, v = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::TextureUnit, target), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6706,7 +6706,7 @@ void GL_APIENTRY GL_MultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdou
     EVENT(context, GLMultiTexCoord4d, "context = %d, target = %s, s = %f, t = %f, r = %f, q = %f",
           CID(context), GLenumToString(BigGLEnum::TextureUnit, target), s, t, r, q);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -6730,7 +6730,7 @@ void GL_APIENTRY GL_MultiTexCoord4dv(GLenum target, const GLdouble *v)
     EVENT(context, GLMultiTexCoord4dv, "context = %d, target = %s, v = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::TextureUnit, target), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6754,7 +6754,7 @@ void GL_APIENTRY GL_MultiTexCoord4fv(GLenum target, const GLfloat *v)
     EVENT(context, GLMultiTexCoord4fv, "context = %d, target = %s, v = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::TextureUnit, target), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6778,7 +6778,7 @@ void GL_APIENTRY GL_MultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GL
     EVENT(context, GLMultiTexCoord4i, "context = %d, target = %s, s = %d, t = %d, r = %d, q = %d",
           CID(context), GLenumToString(BigGLEnum::TextureUnit, target), s, t, r, q);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -6802,7 +6802,7 @@ void GL_APIENTRY GL_MultiTexCoord4iv(GLenum target, const GLint *v)
     EVENT(context, GLMultiTexCoord4iv, "context = %d, target = %s, v = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::TextureUnit, target), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6826,7 +6826,7 @@ void GL_APIENTRY GL_MultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort
     EVENT(context, GLMultiTexCoord4s, "context = %d, target = %s, s = %d, t = %d, r = %d, q = %d",
           CID(context), GLenumToString(BigGLEnum::TextureUnit, target), s, t, r, q);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -6850,7 +6850,7 @@ void GL_APIENTRY GL_MultiTexCoord4sv(GLenum target, const GLshort *v)
     EVENT(context, GLMultiTexCoord4sv, "context = %d, target = %s, v = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::TextureUnit, target), (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6876,7 +6876,7 @@ void GL_APIENTRY GL_FogCoordPointer(GLenum type, GLsizei stride, const void *poi
           "context = %d, type = %s, stride = %d, pointer = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(BigGLEnum::FogPointerTypeEXT, type), stride, (uintptr_t)pointer);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -6899,7 +6899,7 @@ void GL_APIENTRY GL_FogCoordd(GLdouble coord)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFogCoordd, "context = %d, coord = %f", CID(context), coord);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -6922,7 +6922,7 @@ void GL_APIENTRY GL_FogCoorddv(const GLdouble *coord)
     EVENT(context, GLFogCoorddv, "context = %d, coord = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)coord);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -6944,7 +6944,7 @@ void GL_APIENTRY GL_FogCoordf(GLfloat coord)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFogCoordf, "context = %d, coord = %f", CID(context), coord);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -6967,7 +6967,7 @@ void GL_APIENTRY GL_FogCoordfv(const GLfloat *coord)
     EVENT(context, GLFogCoordfv, "context = %d, coord = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)coord);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -6996,7 +6996,7 @@ void GL_APIENTRY GL_MultiDrawArrays(GLenum mode,
           CID(context), GLenumToString(BigGLEnum::PrimitiveType, mode), (uintptr_t)first,
           (uintptr_t)count, drawcount);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         PrimitiveMode modePacked = PackParam<PrimitiveMode>(mode);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -7029,7 +7029,7 @@ void GL_APIENTRY GL_MultiDrawElements(GLenum mode,
           CID(context), GLenumToString(BigGLEnum::PrimitiveType, mode), (uintptr_t)count,
           GLenumToString(BigGLEnum::DrawElementsType, type), (uintptr_t)indices, drawcount);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         PrimitiveMode modePacked    = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked = PackParam<DrawElementsType>(type);
@@ -7057,7 +7057,7 @@ void GL_APIENTRY GL_PointParameteri(GLenum pname, GLint param)
     EVENT(context, GLPointParameteri, "context = %d, pname = %s, param = %d", CID(context),
           GLenumToString(BigGLEnum::AllEnums, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -7081,7 +7081,7 @@ void GL_APIENTRY GL_PointParameteriv(GLenum pname, const GLint *params)
     EVENT(context, GLPointParameteriv, "context = %d, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::AllEnums, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -7105,7 +7105,7 @@ void GL_APIENTRY GL_SecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue)
     EVENT(context, GLSecondaryColor3b, "context = %d, red = %d, green = %d, blue = %d",
           CID(context), red, green, blue);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -7129,7 +7129,7 @@ void GL_APIENTRY GL_SecondaryColor3bv(const GLbyte *v)
     EVENT(context, GLSecondaryColor3bv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -7153,7 +7153,7 @@ void GL_APIENTRY GL_SecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue
     EVENT(context, GLSecondaryColor3d, "context = %d, red = %f, green = %f, blue = %f",
           CID(context), red, green, blue);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -7177,7 +7177,7 @@ void GL_APIENTRY GL_SecondaryColor3dv(const GLdouble *v)
     EVENT(context, GLSecondaryColor3dv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -7201,7 +7201,7 @@ void GL_APIENTRY GL_SecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue)
     EVENT(context, GLSecondaryColor3f, "context = %d, red = %f, green = %f, blue = %f",
           CID(context), red, green, blue);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -7225,7 +7225,7 @@ void GL_APIENTRY GL_SecondaryColor3fv(const GLfloat *v)
     EVENT(context, GLSecondaryColor3fv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -7249,7 +7249,7 @@ void GL_APIENTRY GL_SecondaryColor3i(GLint red, GLint green, GLint blue)
     EVENT(context, GLSecondaryColor3i, "context = %d, red = %d, green = %d, blue = %d",
           CID(context), red, green, blue);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -7273,7 +7273,7 @@ void GL_APIENTRY GL_SecondaryColor3iv(const GLint *v)
     EVENT(context, GLSecondaryColor3iv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -7297,7 +7297,7 @@ void GL_APIENTRY GL_SecondaryColor3s(GLshort red, GLshort green, GLshort blue)
     EVENT(context, GLSecondaryColor3s, "context = %d, red = %d, green = %d, blue = %d",
           CID(context), red, green, blue);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -7321,7 +7321,7 @@ void GL_APIENTRY GL_SecondaryColor3sv(const GLshort *v)
     EVENT(context, GLSecondaryColor3sv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -7345,7 +7345,7 @@ void GL_APIENTRY GL_SecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue)
     EVENT(context, GLSecondaryColor3ub, "context = %d, red = %d, green = %d, blue = %d",
           CID(context), red, green, blue);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -7369,7 +7369,7 @@ void GL_APIENTRY GL_SecondaryColor3ubv(const GLubyte *v)
     EVENT(context, GLSecondaryColor3ubv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -7393,7 +7393,7 @@ void GL_APIENTRY GL_SecondaryColor3ui(GLuint red, GLuint green, GLuint blue)
     EVENT(context, GLSecondaryColor3ui, "context = %d, red = %u, green = %u, blue = %u",
           CID(context), red, green, blue);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -7417,7 +7417,7 @@ void GL_APIENTRY GL_SecondaryColor3uiv(const GLuint *v)
     EVENT(context, GLSecondaryColor3uiv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -7441,7 +7441,7 @@ void GL_APIENTRY GL_SecondaryColor3us(GLushort red, GLushort green, GLushort blu
     EVENT(context, GLSecondaryColor3us, "context = %d, red = %u, green = %u, blue = %u",
           CID(context), red, green, blue);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -7465,7 +7465,7 @@ void GL_APIENTRY GL_SecondaryColor3usv(const GLushort *v)
     EVENT(context, GLSecondaryColor3usv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -7494,7 +7494,7 @@ void GL_APIENTRY GL_SecondaryColorPointer(GLint size,
           CID(context), size, GLenumToString(BigGLEnum::ColorPointerType, type), stride,
           (uintptr_t)pointer);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -7518,7 +7518,7 @@ void GL_APIENTRY GL_WindowPos2d(GLdouble x, GLdouble y)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLWindowPos2d, "context = %d, x = %f, y = %f", CID(context), x, y);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -7541,7 +7541,7 @@ void GL_APIENTRY GL_WindowPos2dv(const GLdouble *v)
     EVENT(context, GLWindowPos2dv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -7563,7 +7563,7 @@ void GL_APIENTRY GL_WindowPos2f(GLfloat x, GLfloat y)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLWindowPos2f, "context = %d, x = %f, y = %f", CID(context), x, y);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -7586,7 +7586,7 @@ void GL_APIENTRY GL_WindowPos2fv(const GLfloat *v)
     EVENT(context, GLWindowPos2fv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -7608,7 +7608,7 @@ void GL_APIENTRY GL_WindowPos2i(GLint x, GLint y)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLWindowPos2i, "context = %d, x = %d, y = %d", CID(context), x, y);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -7631,7 +7631,7 @@ void GL_APIENTRY GL_WindowPos2iv(const GLint *v)
     EVENT(context, GLWindowPos2iv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -7653,7 +7653,7 @@ void GL_APIENTRY GL_WindowPos2s(GLshort x, GLshort y)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLWindowPos2s, "context = %d, x = %d, y = %d", CID(context), x, y);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -7676,7 +7676,7 @@ void GL_APIENTRY GL_WindowPos2sv(const GLshort *v)
     EVENT(context, GLWindowPos2sv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -7698,7 +7698,7 @@ void GL_APIENTRY GL_WindowPos3d(GLdouble x, GLdouble y, GLdouble z)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLWindowPos3d, "context = %d, x = %f, y = %f, z = %f", CID(context), x, y, z);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -7722,7 +7722,7 @@ void GL_APIENTRY GL_WindowPos3dv(const GLdouble *v)
     EVENT(context, GLWindowPos3dv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -7744,7 +7744,7 @@ void GL_APIENTRY GL_WindowPos3f(GLfloat x, GLfloat y, GLfloat z)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLWindowPos3f, "context = %d, x = %f, y = %f, z = %f", CID(context), x, y, z);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -7768,7 +7768,7 @@ void GL_APIENTRY GL_WindowPos3fv(const GLfloat *v)
     EVENT(context, GLWindowPos3fv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -7790,7 +7790,7 @@ void GL_APIENTRY GL_WindowPos3i(GLint x, GLint y, GLint z)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLWindowPos3i, "context = %d, x = %d, y = %d, z = %d", CID(context), x, y, z);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -7814,7 +7814,7 @@ void GL_APIENTRY GL_WindowPos3iv(const GLint *v)
     EVENT(context, GLWindowPos3iv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -7836,7 +7836,7 @@ void GL_APIENTRY GL_WindowPos3s(GLshort x, GLshort y, GLshort z)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLWindowPos3s, "context = %d, x = %d, y = %d, z = %d", CID(context), x, y, z);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -7860,7 +7860,7 @@ void GL_APIENTRY GL_WindowPos3sv(const GLshort *v)
     EVENT(context, GLWindowPos3sv, "context = %d, v = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -7887,7 +7887,7 @@ void GL_APIENTRY GL_GetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr
           static_cast<unsigned long long>(offset), static_cast<unsigned long long>(size),
           (uintptr_t)data);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -7912,7 +7912,7 @@ void GL_APIENTRY GL_GetQueryObjectiv(GLuint id, GLenum pname, GLint *params)
           "context = %d, id = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), id,
           GLenumToString(BigGLEnum::QueryObjectParameterName, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         QueryID idPacked = PackParam<QueryID>(id);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -7937,7 +7937,7 @@ void *GL_APIENTRY GL_MapBuffer(GLenum target, GLenum access)
           GLenumToString(BigGLEnum::BufferAccessARB, access));
 
     void *returnValue;
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         BufferBinding targetPacked = PackParam<BufferBinding>(target);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -37,7 +37,7 @@ void GL_APIENTRY GL_BeginConditionalRender(GLuint id, GLenum mode)
     EVENT(context, GLBeginConditionalRender, "context = %d, id = %u, mode = %s", CID(context), id,
           GLenumToString(BigGLEnum::ConditionalRenderMode, mode));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -62,7 +62,7 @@ void GL_APIENTRY GL_BindFragDataLocation(GLuint program, GLuint color, const GLc
           "context = %d, program = %u, color = %u, name = 0x%016" PRIxPTR "", CID(context), program,
           color, (uintptr_t)name);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked = PackParam<ShaderProgramID>(program);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -88,7 +88,7 @@ void GL_APIENTRY GL_ClampColor(GLenum target, GLenum clamp)
     EVENT(context, GLClampColor, "context = %d, target = %s, clamp = %s", CID(context),
           GLenumToString(BigGLEnum::AllEnums, target), GLenumToString(BigGLEnum::AllEnums, clamp));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -111,7 +111,7 @@ void GL_APIENTRY GL_EndConditionalRender()
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEndConditionalRender, "context = %d", CID(context));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -142,7 +142,7 @@ void GL_APIENTRY GL_FramebufferTexture1D(GLenum target,
           GLenumToString(BigGLEnum::FramebufferAttachment, attachment),
           GLenumToString(BigGLEnum::TextureTarget, textarget), texture, level);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureTarget textargetPacked = PackParam<TextureTarget>(textarget);
         TextureID texturePacked       = PackParam<TextureID>(texture);
@@ -180,7 +180,7 @@ void GL_APIENTRY GL_FramebufferTexture3D(GLenum target,
           GLenumToString(BigGLEnum::FramebufferAttachment, attachment),
           GLenumToString(BigGLEnum::TextureTarget, textarget), texture, level, zoffset);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureTarget textargetPacked = PackParam<TextureTarget>(textarget);
         TextureID texturePacked       = PackParam<TextureID>(texture);
@@ -208,7 +208,7 @@ void GL_APIENTRY GL_VertexAttribI1i(GLuint index, GLint x)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttribI1i, "context = %d, index = %u, x = %d", CID(context), index, x);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -232,7 +232,7 @@ void GL_APIENTRY GL_VertexAttribI1iv(GLuint index, const GLint *v)
     EVENT(context, GLVertexAttribI1iv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -255,7 +255,7 @@ void GL_APIENTRY GL_VertexAttribI1ui(GLuint index, GLuint x)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttribI1ui, "context = %d, index = %u, x = %u", CID(context), index, x);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -279,7 +279,7 @@ void GL_APIENTRY GL_VertexAttribI1uiv(GLuint index, const GLuint *v)
     EVENT(context, GLVertexAttribI1uiv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -303,7 +303,7 @@ void GL_APIENTRY GL_VertexAttribI2i(GLuint index, GLint x, GLint y)
     EVENT(context, GLVertexAttribI2i, "context = %d, index = %u, x = %d, y = %d", CID(context),
           index, x, y);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -327,7 +327,7 @@ void GL_APIENTRY GL_VertexAttribI2iv(GLuint index, const GLint *v)
     EVENT(context, GLVertexAttribI2iv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -351,7 +351,7 @@ void GL_APIENTRY GL_VertexAttribI2ui(GLuint index, GLuint x, GLuint y)
     EVENT(context, GLVertexAttribI2ui, "context = %d, index = %u, x = %u, y = %u", CID(context),
           index, x, y);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -375,7 +375,7 @@ void GL_APIENTRY GL_VertexAttribI2uiv(GLuint index, const GLuint *v)
     EVENT(context, GLVertexAttribI2uiv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -399,7 +399,7 @@ void GL_APIENTRY GL_VertexAttribI3i(GLuint index, GLint x, GLint y, GLint z)
     EVENT(context, GLVertexAttribI3i, "context = %d, index = %u, x = %d, y = %d, z = %d",
           CID(context), index, x, y, z);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -423,7 +423,7 @@ void GL_APIENTRY GL_VertexAttribI3iv(GLuint index, const GLint *v)
     EVENT(context, GLVertexAttribI3iv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -447,7 +447,7 @@ void GL_APIENTRY GL_VertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z)
     EVENT(context, GLVertexAttribI3ui, "context = %d, index = %u, x = %u, y = %u, z = %u",
           CID(context), index, x, y, z);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -471,7 +471,7 @@ void GL_APIENTRY GL_VertexAttribI3uiv(GLuint index, const GLuint *v)
     EVENT(context, GLVertexAttribI3uiv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -495,7 +495,7 @@ void GL_APIENTRY GL_VertexAttribI4bv(GLuint index, const GLbyte *v)
     EVENT(context, GLVertexAttribI4bv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -519,7 +519,7 @@ void GL_APIENTRY GL_VertexAttribI4sv(GLuint index, const GLshort *v)
     EVENT(context, GLVertexAttribI4sv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -543,7 +543,7 @@ void GL_APIENTRY GL_VertexAttribI4ubv(GLuint index, const GLubyte *v)
     EVENT(context, GLVertexAttribI4ubv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -567,7 +567,7 @@ void GL_APIENTRY GL_VertexAttribI4usv(GLuint index, const GLushort *v)
     EVENT(context, GLVertexAttribI4usv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -598,7 +598,7 @@ void GL_APIENTRY GL_GetActiveUniformName(GLuint program,
           ", uniformName = 0x%016" PRIxPTR "",
           CID(context), program, uniformIndex, bufSize, (uintptr_t)length, (uintptr_t)uniformName);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked = PackParam<ShaderProgramID>(program);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -625,7 +625,7 @@ void GL_APIENTRY GL_PrimitiveRestartIndex(GLuint index)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPrimitiveRestartIndex, "context = %d, index = %u", CID(context), index);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -659,7 +659,7 @@ void GL_APIENTRY GL_MultiDrawElementsBaseVertex(GLenum mode,
           GLenumToString(BigGLEnum::DrawElementsType, type), (uintptr_t)indices, drawcount,
           (uintptr_t)basevertex);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         PrimitiveMode modePacked    = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked = PackParam<DrawElementsType>(type);
@@ -688,7 +688,7 @@ void GL_APIENTRY GL_ProvokingVertex(GLenum mode)
     EVENT(context, GLProvokingVertex, "context = %d, mode = %s", CID(context),
           GLenumToString(BigGLEnum::VertexProvokingMode, mode));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ProvokingVertexConvention modePacked = PackParam<ProvokingVertexConvention>(mode);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -722,7 +722,7 @@ void GL_APIENTRY GL_TexImage2DMultisample(GLenum target,
           GLenumToString(BigGLEnum::InternalFormat, internalformat), width, height,
           GLbooleanToString(fixedsamplelocations));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -759,7 +759,7 @@ void GL_APIENTRY GL_TexImage3DMultisample(GLenum target,
           GLenumToString(BigGLEnum::InternalFormat, internalformat), width, height, depth,
           GLbooleanToString(fixedsamplelocations));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -792,7 +792,7 @@ void GL_APIENTRY GL_BindFragDataLocationIndexed(GLuint program,
           "context = %d, program = %u, colorNumber = %u, index = %u, name = 0x%016" PRIxPTR "",
           CID(context), program, colorNumber, index, (uintptr_t)name);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked = PackParam<ShaderProgramID>(program);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -819,7 +819,7 @@ void GL_APIENTRY GL_ColorP3ui(GLenum type, GLuint color)
     EVENT(context, GLColorP3ui, "context = %d, type = %s, color = %u", CID(context),
           GLenumToString(BigGLEnum::ColorPointerType, type), color);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -843,7 +843,7 @@ void GL_APIENTRY GL_ColorP3uiv(GLenum type, const GLuint *color)
     EVENT(context, GLColorP3uiv, "context = %d, type = %s, color = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(BigGLEnum::ColorPointerType, type), (uintptr_t)color);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -867,7 +867,7 @@ void GL_APIENTRY GL_ColorP4ui(GLenum type, GLuint color)
     EVENT(context, GLColorP4ui, "context = %d, type = %s, color = %u", CID(context),
           GLenumToString(BigGLEnum::ColorPointerType, type), color);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -891,7 +891,7 @@ void GL_APIENTRY GL_ColorP4uiv(GLenum type, const GLuint *color)
     EVENT(context, GLColorP4uiv, "context = %d, type = %s, color = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(BigGLEnum::ColorPointerType, type), (uintptr_t)color);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -916,7 +916,7 @@ GLint GL_APIENTRY GL_GetFragDataIndex(GLuint program, const GLchar *name)
           CID(context), program, (uintptr_t)name);
 
     GLint returnValue;
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked = PackParam<ShaderProgramID>(program);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -948,7 +948,7 @@ void GL_APIENTRY GL_GetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params)
           "context = %d, id = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), id,
           GLenumToString(BigGLEnum::QueryObjectParameterName, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         QueryID idPacked = PackParam<QueryID>(id);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -973,7 +973,7 @@ void GL_APIENTRY GL_GetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *param
           "context = %d, id = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), id,
           GLenumToString(BigGLEnum::QueryObjectParameterName, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         QueryID idPacked = PackParam<QueryID>(id);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -1000,7 +1000,7 @@ void GL_APIENTRY GL_MultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords
           CID(context), GLenumToString(BigGLEnum::TextureUnit, texture),
           GLenumToString(BigGLEnum::TexCoordPointerType, type), coords);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1027,7 +1027,7 @@ void GL_APIENTRY GL_MultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint
           GLenumToString(BigGLEnum::TextureUnit, texture),
           GLenumToString(BigGLEnum::TexCoordPointerType, type), (uintptr_t)coords);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1053,7 +1053,7 @@ void GL_APIENTRY GL_MultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords
           CID(context), GLenumToString(BigGLEnum::TextureUnit, texture),
           GLenumToString(BigGLEnum::TexCoordPointerType, type), coords);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1080,7 +1080,7 @@ void GL_APIENTRY GL_MultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint
           GLenumToString(BigGLEnum::TextureUnit, texture),
           GLenumToString(BigGLEnum::TexCoordPointerType, type), (uintptr_t)coords);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1106,7 +1106,7 @@ void GL_APIENTRY GL_MultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords
           CID(context), GLenumToString(BigGLEnum::TextureUnit, texture),
           GLenumToString(BigGLEnum::TexCoordPointerType, type), coords);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1133,7 +1133,7 @@ void GL_APIENTRY GL_MultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint
           GLenumToString(BigGLEnum::TextureUnit, texture),
           GLenumToString(BigGLEnum::TexCoordPointerType, type), (uintptr_t)coords);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1159,7 +1159,7 @@ void GL_APIENTRY GL_MultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords
           CID(context), GLenumToString(BigGLEnum::TextureUnit, texture),
           GLenumToString(BigGLEnum::TexCoordPointerType, type), coords);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1186,7 +1186,7 @@ void GL_APIENTRY GL_MultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint
           GLenumToString(BigGLEnum::TextureUnit, texture),
           GLenumToString(BigGLEnum::TexCoordPointerType, type), (uintptr_t)coords);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1211,7 +1211,7 @@ void GL_APIENTRY GL_NormalP3ui(GLenum type, GLuint coords)
     EVENT(context, GLNormalP3ui, "context = %d, type = %s, coords = %u", CID(context),
           GLenumToString(BigGLEnum::NormalPointerType, type), coords);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1235,7 +1235,7 @@ void GL_APIENTRY GL_NormalP3uiv(GLenum type, const GLuint *coords)
     EVENT(context, GLNormalP3uiv, "context = %d, type = %s, coords = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::NormalPointerType, type), (uintptr_t)coords);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1259,7 +1259,7 @@ void GL_APIENTRY GL_QueryCounter(GLuint id, GLenum target)
     EVENT(context, GLQueryCounter, "context = %d, id = %u, target = %s", CID(context), id,
           GLenumToString(BigGLEnum::QueryCounterTarget, target));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         QueryID idPacked       = PackParam<QueryID>(id);
         QueryType targetPacked = PackParam<QueryType>(target);
@@ -1285,7 +1285,7 @@ void GL_APIENTRY GL_SecondaryColorP3ui(GLenum type, GLuint color)
     EVENT(context, GLSecondaryColorP3ui, "context = %d, type = %s, color = %u", CID(context),
           GLenumToString(BigGLEnum::ColorPointerType, type), color);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1309,7 +1309,7 @@ void GL_APIENTRY GL_SecondaryColorP3uiv(GLenum type, const GLuint *color)
     EVENT(context, GLSecondaryColorP3uiv, "context = %d, type = %s, color = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::ColorPointerType, type), (uintptr_t)color);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1333,7 +1333,7 @@ void GL_APIENTRY GL_TexCoordP1ui(GLenum type, GLuint coords)
     EVENT(context, GLTexCoordP1ui, "context = %d, type = %s, coords = %u", CID(context),
           GLenumToString(BigGLEnum::TexCoordPointerType, type), coords);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1357,7 +1357,7 @@ void GL_APIENTRY GL_TexCoordP1uiv(GLenum type, const GLuint *coords)
     EVENT(context, GLTexCoordP1uiv, "context = %d, type = %s, coords = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::TexCoordPointerType, type), (uintptr_t)coords);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1381,7 +1381,7 @@ void GL_APIENTRY GL_TexCoordP2ui(GLenum type, GLuint coords)
     EVENT(context, GLTexCoordP2ui, "context = %d, type = %s, coords = %u", CID(context),
           GLenumToString(BigGLEnum::TexCoordPointerType, type), coords);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1405,7 +1405,7 @@ void GL_APIENTRY GL_TexCoordP2uiv(GLenum type, const GLuint *coords)
     EVENT(context, GLTexCoordP2uiv, "context = %d, type = %s, coords = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::TexCoordPointerType, type), (uintptr_t)coords);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1429,7 +1429,7 @@ void GL_APIENTRY GL_TexCoordP3ui(GLenum type, GLuint coords)
     EVENT(context, GLTexCoordP3ui, "context = %d, type = %s, coords = %u", CID(context),
           GLenumToString(BigGLEnum::TexCoordPointerType, type), coords);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1453,7 +1453,7 @@ void GL_APIENTRY GL_TexCoordP3uiv(GLenum type, const GLuint *coords)
     EVENT(context, GLTexCoordP3uiv, "context = %d, type = %s, coords = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::TexCoordPointerType, type), (uintptr_t)coords);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1477,7 +1477,7 @@ void GL_APIENTRY GL_TexCoordP4ui(GLenum type, GLuint coords)
     EVENT(context, GLTexCoordP4ui, "context = %d, type = %s, coords = %u", CID(context),
           GLenumToString(BigGLEnum::TexCoordPointerType, type), coords);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1501,7 +1501,7 @@ void GL_APIENTRY GL_TexCoordP4uiv(GLenum type, const GLuint *coords)
     EVENT(context, GLTexCoordP4uiv, "context = %d, type = %s, coords = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::TexCoordPointerType, type), (uintptr_t)coords);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1527,7 +1527,7 @@ void GL_APIENTRY GL_VertexAttribP1ui(GLuint index, GLenum type, GLboolean normal
           GLenumToString(BigGLEnum::VertexAttribPointerType, type), GLbooleanToString(normalized),
           value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1556,7 +1556,7 @@ void GL_APIENTRY GL_VertexAttribP1uiv(GLuint index,
           CID(context), index, GLenumToString(BigGLEnum::VertexAttribPointerType, type),
           GLbooleanToString(normalized), (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1583,7 +1583,7 @@ void GL_APIENTRY GL_VertexAttribP2ui(GLuint index, GLenum type, GLboolean normal
           GLenumToString(BigGLEnum::VertexAttribPointerType, type), GLbooleanToString(normalized),
           value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1612,7 +1612,7 @@ void GL_APIENTRY GL_VertexAttribP2uiv(GLuint index,
           CID(context), index, GLenumToString(BigGLEnum::VertexAttribPointerType, type),
           GLbooleanToString(normalized), (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1639,7 +1639,7 @@ void GL_APIENTRY GL_VertexAttribP3ui(GLuint index, GLenum type, GLboolean normal
           GLenumToString(BigGLEnum::VertexAttribPointerType, type), GLbooleanToString(normalized),
           value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1668,7 +1668,7 @@ void GL_APIENTRY GL_VertexAttribP3uiv(GLuint index,
           CID(context), index, GLenumToString(BigGLEnum::VertexAttribPointerType, type),
           GLbooleanToString(normalized), (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1695,7 +1695,7 @@ void GL_APIENTRY GL_VertexAttribP4ui(GLuint index, GLenum type, GLboolean normal
           GLenumToString(BigGLEnum::VertexAttribPointerType, type), GLbooleanToString(normalized),
           value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1724,7 +1724,7 @@ void GL_APIENTRY GL_VertexAttribP4uiv(GLuint index,
           CID(context), index, GLenumToString(BigGLEnum::VertexAttribPointerType, type),
           GLbooleanToString(normalized), (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1749,7 +1749,7 @@ void GL_APIENTRY GL_VertexP2ui(GLenum type, GLuint value)
     EVENT(context, GLVertexP2ui, "context = %d, type = %s, value = %u", CID(context),
           GLenumToString(BigGLEnum::VertexPointerType, type), value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1773,7 +1773,7 @@ void GL_APIENTRY GL_VertexP2uiv(GLenum type, const GLuint *value)
     EVENT(context, GLVertexP2uiv, "context = %d, type = %s, value = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::VertexPointerType, type), (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1797,7 +1797,7 @@ void GL_APIENTRY GL_VertexP3ui(GLenum type, GLuint value)
     EVENT(context, GLVertexP3ui, "context = %d, type = %s, value = %u", CID(context),
           GLenumToString(BigGLEnum::VertexPointerType, type), value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1821,7 +1821,7 @@ void GL_APIENTRY GL_VertexP3uiv(GLenum type, const GLuint *value)
     EVENT(context, GLVertexP3uiv, "context = %d, type = %s, value = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::VertexPointerType, type), (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1845,7 +1845,7 @@ void GL_APIENTRY GL_VertexP4ui(GLenum type, GLuint value)
     EVENT(context, GLVertexP4ui, "context = %d, type = %s, value = %u", CID(context),
           GLenumToString(BigGLEnum::VertexPointerType, type), value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1869,7 +1869,7 @@ void GL_APIENTRY GL_VertexP4uiv(GLenum type, const GLuint *value)
     EVENT(context, GLVertexP4uiv, "context = %d, type = %s, value = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::VertexPointerType, type), (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
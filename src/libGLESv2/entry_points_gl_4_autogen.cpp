@@ -37,7 +37,7 @@ void GL_APIENTRY GL_BeginQueryIndexed(GLenum target, GLuint index, GLuint id)
     EVENT(context, GLBeginQueryIndexed, "context = %d, target = %s, index = %u, id = %u",
           CID(context), GLenumToString(BigGLEnum::QueryTarget, target), index, id);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         QueryID idPacked = PackParam<QueryID>(id);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -63,7 +63,7 @@ void GL_APIENTRY GL_DrawTransformFeedback(GLenum mode, GLuint id)
     EVENT(context, GLDrawTransformFeedback, "context = %d, mode = %s, id = %u", CID(context),
           GLenumToString(BigGLEnum::PrimitiveType, mode), id);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TransformFeedbackID idPacked = PackParam<TransformFeedbackID>(id);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -89,7 +89,7 @@ void GL_APIENTRY GL_DrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint s
     EVENT(context, GLDrawTransformFeedbackStream, "context = %d, mode = %s, id = %u, stream = %u",
           CID(context), GLenumToString(BigGLEnum::PrimitiveType, mode), id, stream);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TransformFeedbackID idPacked = PackParam<TransformFeedbackID>(id);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -115,7 +115,7 @@ void GL_APIENTRY GL_EndQueryIndexed(GLenum target, GLuint index)
     EVENT(context, GLEndQueryIndexed, "context = %d, target = %s, index = %u", CID(context),
           GLenumToString(BigGLEnum::QueryTarget, target), index);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -147,7 +147,7 @@ void GL_APIENTRY GL_GetActiveSubroutineName(GLuint program,
           CID(context), program, GLenumToString(BigGLEnum::ShaderType, shadertype), index, bufSize,
           (uintptr_t)length, (uintptr_t)name);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked = PackParam<ShaderProgramID>(program);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -183,7 +183,7 @@ void GL_APIENTRY GL_GetActiveSubroutineUniformName(GLuint program,
           CID(context), program, GLenumToString(BigGLEnum::ShaderType, shadertype), index, bufSize,
           (uintptr_t)length, (uintptr_t)name);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked = PackParam<ShaderProgramID>(program);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -218,7 +218,7 @@ void GL_APIENTRY GL_GetActiveSubroutineUniformiv(GLuint program,
           CID(context), program, GLenumToString(BigGLEnum::ShaderType, shadertype), index,
           GLenumToString(BigGLEnum::SubroutineParameterName, pname), (uintptr_t)values);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked = PackParam<ShaderProgramID>(program);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -250,7 +250,7 @@ void GL_APIENTRY GL_GetProgramStageiv(GLuint program,
           CID(context), program, GLenumToString(BigGLEnum::ShaderType, shadertype),
           GLenumToString(BigGLEnum::ProgramStagePName, pname), (uintptr_t)values);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked = PackParam<ShaderProgramID>(program);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -279,7 +279,7 @@ void GL_APIENTRY GL_GetQueryIndexediv(GLenum target, GLuint index, GLenum pname,
           CID(context), GLenumToString(BigGLEnum::QueryTarget, target), index,
           GLenumToString(BigGLEnum::QueryParameterName, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -306,7 +306,7 @@ GLuint GL_APIENTRY GL_GetSubroutineIndex(GLuint program, GLenum shadertype, cons
           program, GLenumToString(BigGLEnum::ShaderType, shadertype), (uintptr_t)name);
 
     GLuint returnValue;
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked = PackParam<ShaderProgramID>(program);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -343,7 +343,7 @@ GLint GL_APIENTRY GL_GetSubroutineUniformLocation(GLuint program,
           program, GLenumToString(BigGLEnum::ShaderType, shadertype), (uintptr_t)name);
 
     GLint returnValue;
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked = PackParam<ShaderProgramID>(program);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -379,7 +379,7 @@ void GL_APIENTRY GL_GetUniformSubroutineuiv(GLenum shadertype, GLint location, G
           "context = %d, shadertype = %s, location = %d, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(BigGLEnum::ShaderType, shadertype), location, (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -406,7 +406,7 @@ void GL_APIENTRY GL_GetUniformdv(GLuint program, GLint location, GLdouble *param
           "context = %d, program = %u, location = %d, params = 0x%016" PRIxPTR "", CID(context),
           program, location, (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
@@ -432,7 +432,7 @@ void GL_APIENTRY GL_PatchParameterfv(GLenum pname, const GLfloat *values)
     EVENT(context, GLPatchParameterfv, "context = %d, pname = %s, values = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::PatchParameterName, pname), (uintptr_t)values);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -455,7 +455,7 @@ void GL_APIENTRY GL_Uniform1d(GLint location, GLdouble x)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform1d, "context = %d, location = %d, x = %f", CID(context), location, x);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -481,7 +481,7 @@ void GL_APIENTRY GL_Uniform1dv(GLint location, GLsizei count, const GLdouble *va
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -506,7 +506,7 @@ void GL_APIENTRY GL_Uniform2d(GLint location, GLdouble x, GLdouble y)
     EVENT(context, GLUniform2d, "context = %d, location = %d, x = %f, y = %f", CID(context),
           location, x, y);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -532,7 +532,7 @@ void GL_APIENTRY GL_Uniform2dv(GLint location, GLsizei count, const GLdouble *va
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -557,7 +557,7 @@ void GL_APIENTRY GL_Uniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z
     EVENT(context, GLUniform3d, "context = %d, location = %d, x = %f, y = %f, z = %f", CID(context),
           location, x, y, z);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -583,7 +583,7 @@ void GL_APIENTRY GL_Uniform3dv(GLint location, GLsizei count, const GLdouble *va
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -608,7 +608,7 @@ void GL_APIENTRY GL_Uniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z
     EVENT(context, GLUniform4d, "context = %d, location = %d, x = %f, y = %f, z = %f, w = %f",
           CID(context), location, x, y, z, w);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -634,7 +634,7 @@ void GL_APIENTRY GL_Uniform4dv(GLint location, GLsizei count, const GLdouble *va
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -663,7 +663,7 @@ void GL_APIENTRY GL_UniformMatrix2dv(GLint location,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -693,7 +693,7 @@ void GL_APIENTRY GL_UniformMatrix2x3dv(GLint location,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -724,7 +724,7 @@ void GL_APIENTRY GL_UniformMatrix2x4dv(GLint location,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -755,7 +755,7 @@ void GL_APIENTRY GL_UniformMatrix3dv(GLint location,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -785,7 +785,7 @@ void GL_APIENTRY GL_UniformMatrix3x2dv(GLint location,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -816,7 +816,7 @@ void GL_APIENTRY GL_UniformMatrix3x4dv(GLint location,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -847,7 +847,7 @@ void GL_APIENTRY GL_UniformMatrix4dv(GLint location,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -877,7 +877,7 @@ void GL_APIENTRY GL_UniformMatrix4x2dv(GLint location,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -908,7 +908,7 @@ void GL_APIENTRY GL_UniformMatrix4x3dv(GLint location,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -936,7 +936,7 @@ void GL_APIENTRY GL_UniformSubroutinesuiv(GLenum shadertype, GLsizei count, cons
           "context = %d, shadertype = %s, count = %d, indices = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(BigGLEnum::ShaderType, shadertype), count, (uintptr_t)indices);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -963,7 +963,7 @@ void GL_APIENTRY GL_DepthRangeArrayv(GLuint first, GLsizei count, const GLdouble
           "context = %d, first = %u, count = %d, v = 0x%016" PRIxPTR "", CID(context), first, count,
           (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -987,7 +987,7 @@ void GL_APIENTRY GL_DepthRangeIndexed(GLuint index, GLdouble n, GLdouble f)
     EVENT(context, GLDepthRangeIndexed, "context = %d, index = %u, n = %f, f = %f", CID(context),
           index, n, f);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1012,7 +1012,7 @@ void GL_APIENTRY GL_GetDoublei_v(GLenum target, GLuint index, GLdouble *data)
           "context = %d, target = %s, index = %u, data = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(BigGLEnum::GetPName, target), index, (uintptr_t)data);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1036,7 +1036,7 @@ void GL_APIENTRY GL_GetFloati_v(GLenum target, GLuint index, GLfloat *data)
     EVENT(context, GLGetFloati_v, "context = %d, target = %s, index = %u, data = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::GetPName, target), index, (uintptr_t)data);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1061,7 +1061,7 @@ void GL_APIENTRY GL_GetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *par
           "context = %d, index = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), index,
           GLenumToString(BigGLEnum::VertexAttribEnum, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1086,7 +1086,7 @@ void GL_APIENTRY GL_ProgramUniform1d(GLuint program, GLint location, GLdouble v0
     EVENT(context, GLProgramUniform1d, "context = %d, program = %u, location = %d, v0 = %f",
           CID(context), program, location, v0);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
@@ -1116,7 +1116,7 @@ void GL_APIENTRY GL_ProgramUniform1dv(GLuint program,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
@@ -1145,7 +1145,7 @@ void GL_APIENTRY GL_ProgramUniform2d(GLuint program, GLint location, GLdouble v0
           "context = %d, program = %u, location = %d, v0 = %f, v1 = %f", CID(context), program,
           location, v0, v1);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
@@ -1176,7 +1176,7 @@ void GL_APIENTRY GL_ProgramUniform2dv(GLuint program,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
@@ -1206,7 +1206,7 @@ GL_ProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GL
           "context = %d, program = %u, location = %d, v0 = %f, v1 = %f, v2 = %f", CID(context),
           program, location, v0, v1, v2);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
@@ -1237,7 +1237,7 @@ void GL_APIENTRY GL_ProgramUniform3dv(GLuint program,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
@@ -1271,7 +1271,7 @@ void GL_APIENTRY GL_ProgramUniform4d(GLuint program,
           "context = %d, program = %u, location = %d, v0 = %f, v1 = %f, v2 = %f, v3 = %f",
           CID(context), program, location, v0, v1, v2, v3);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
@@ -1303,7 +1303,7 @@ void GL_APIENTRY GL_ProgramUniform4dv(GLuint program,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
@@ -1337,7 +1337,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2dv(GLuint program,
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
@@ -1372,7 +1372,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x3dv(GLuint program,
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
@@ -1407,7 +1407,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x4dv(GLuint program,
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
@@ -1442,7 +1442,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3dv(GLuint program,
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
@@ -1477,7 +1477,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x2dv(GLuint program,
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
@@ -1512,7 +1512,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x4dv(GLuint program,
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
@@ -1547,7 +1547,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4dv(GLuint program,
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
@@ -1582,7 +1582,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x2dv(GLuint program,
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
@@ -1617,7 +1617,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x3dv(GLuint program,
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
@@ -1646,7 +1646,7 @@ void GL_APIENTRY GL_ScissorArrayv(GLuint first, GLsizei count, const GLint *v)
     EVENT(context, GLScissorArrayv, "context = %d, first = %u, count = %d, v = 0x%016" PRIxPTR "",
           CID(context), first, count, (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1672,7 +1672,7 @@ GL_ScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei
           "context = %d, index = %u, left = %d, bottom = %d, width = %d, height = %d", CID(context),
           index, left, bottom, width, height);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1696,7 +1696,7 @@ void GL_APIENTRY GL_ScissorIndexedv(GLuint index, const GLint *v)
     EVENT(context, GLScissorIndexedv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1719,7 +1719,7 @@ void GL_APIENTRY GL_VertexAttribL1d(GLuint index, GLdouble x)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttribL1d, "context = %d, index = %u, x = %f", CID(context), index, x);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1743,7 +1743,7 @@ void GL_APIENTRY GL_VertexAttribL1dv(GLuint index, const GLdouble *v)
     EVENT(context, GLVertexAttribL1dv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1767,7 +1767,7 @@ void GL_APIENTRY GL_VertexAttribL2d(GLuint index, GLdouble x, GLdouble y)
     EVENT(context, GLVertexAttribL2d, "context = %d, index = %u, x = %f, y = %f", CID(context),
           index, x, y);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1791,7 +1791,7 @@ void GL_APIENTRY GL_VertexAttribL2dv(GLuint index, const GLdouble *v)
     EVENT(context, GLVertexAttribL2dv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1815,7 +1815,7 @@ void GL_APIENTRY GL_VertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdoub
     EVENT(context, GLVertexAttribL3d, "context = %d, index = %u, x = %f, y = %f, z = %f",
           CID(context), index, x, y, z);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1839,7 +1839,7 @@ void GL_APIENTRY GL_VertexAttribL3dv(GLuint index, const GLdouble *v)
     EVENT(context, GLVertexAttribL3dv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1863,7 +1863,7 @@ void GL_APIENTRY GL_VertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdoub
     EVENT(context, GLVertexAttribL4d, "context = %d, index = %u, x = %f, y = %f, z = %f, w = %f",
           CID(context), index, x, y, z, w);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1887,7 +1887,7 @@ void GL_APIENTRY GL_VertexAttribL4dv(GLuint index, const GLdouble *v)
     EVENT(context, GLVertexAttribL4dv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1915,7 +1915,7 @@ GL_VertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, c
           CID(context), index, size, GLenumToString(BigGLEnum::VertexAttribLType, type), stride,
           (uintptr_t)pointer);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1941,7 +1941,7 @@ void GL_APIENTRY GL_ViewportArrayv(GLuint first, GLsizei count, const GLfloat *v
     EVENT(context, GLViewportArrayv, "context = %d, first = %u, count = %d, v = 0x%016" PRIxPTR "",
           CID(context), first, count, (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1965,7 +1965,7 @@ void GL_APIENTRY GL_ViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat
     EVENT(context, GLViewportIndexedf, "context = %d, index = %u, x = %f, y = %f, w = %f, h = %f",
           CID(context), index, x, y, w, h);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1989,7 +1989,7 @@ void GL_APIENTRY GL_ViewportIndexedfv(GLuint index, const GLfloat *v)
     EVENT(context, GLViewportIndexedfv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -2020,7 +2020,7 @@ void GL_APIENTRY GL_DrawArraysInstancedBaseInstance(GLenum mode,
           CID(context), GLenumToString(BigGLEnum::PrimitiveType, mode), first, count, instancecount,
           baseinstance);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         PrimitiveMode modePacked = PackParam<PrimitiveMode>(mode);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -2057,7 +2057,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseInstance(GLenum mode,
           GLenumToString(BigGLEnum::PrimitiveType, type), (uintptr_t)indices, instancecount,
           baseinstance);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         PrimitiveMode modePacked    = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked = PackParam<DrawElementsType>(type);
@@ -2097,7 +2097,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertexBaseInstance(GLenum mode,
           GLenumToString(BigGLEnum::DrawElementsType, type), (uintptr_t)indices, instancecount,
           basevertex, baseinstance);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         PrimitiveMode modePacked    = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked = PackParam<DrawElementsType>(type);
@@ -2129,7 +2129,7 @@ void GL_APIENTRY GL_DrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsiz
           "context = %d, mode = %s, id = %u, instancecount = %d", CID(context),
           GLenumToString(BigGLEnum::PrimitiveType, mode), id, instancecount);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TransformFeedbackID idPacked = PackParam<TransformFeedbackID>(id);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -2160,7 +2160,7 @@ void GL_APIENTRY GL_DrawTransformFeedbackStreamInstanced(GLenum mode,
           "context = %d, mode = %s, id = %u, stream = %u, instancecount = %d", CID(context),
           GLenumToString(BigGLEnum::PrimitiveType, mode), id, stream, instancecount);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TransformFeedbackID idPacked = PackParam<TransformFeedbackID>(id);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -2192,7 +2192,7 @@ void GL_APIENTRY GL_GetActiveAtomicCounterBufferiv(GLuint program,
           CID(context), program, bufferIndex,
           GLenumToString(BigGLEnum::AtomicCounterBufferPName, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked = PackParam<ShaderProgramID>(program);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -2224,7 +2224,7 @@ void GL_APIENTRY GL_TexStorage1D(GLenum target,
           GLenumToString(BigGLEnum::TextureTarget, target), levels,
           GLenumToString(BigGLEnum::SizedInternalFormat, internalformat), width);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2258,7 +2258,7 @@ void GL_APIENTRY GL_ClearBufferData(GLenum target,
           GLenumToString(BigGLEnum::PixelFormat, format),
           GLenumToString(BigGLEnum::PixelType, type), (uintptr_t)data);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2295,7 +2295,7 @@ void GL_APIENTRY GL_ClearBufferSubData(GLenum target,
           GLenumToString(BigGLEnum::PixelFormat, format),
           GLenumToString(BigGLEnum::PixelType, type), (uintptr_t)data);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -2329,7 +2329,7 @@ void GL_APIENTRY GL_GetInternalformati64v(GLenum target,
           GLenumToString(BigGLEnum::InternalFormat, internalformat),
           GLenumToString(BigGLEnum::InternalFormatPName, pname), count, (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -2360,7 +2360,7 @@ GLint GL_APIENTRY GL_GetProgramResourceLocationIndex(GLuint program,
           (uintptr_t)name);
 
     GLint returnValue;
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked = PackParam<ShaderProgramID>(program);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -2396,7 +2396,7 @@ void GL_APIENTRY GL_InvalidateBufferData(GLuint buffer)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLInvalidateBufferData, "context = %d, buffer = %u", CID(context), buffer);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         BufferID bufferPacked = PackParam<BufferID>(buffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -2422,7 +2422,7 @@ void GL_APIENTRY GL_InvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsi
           "context = %d, buffer = %u, offset = %llu, length = %llu", CID(context), buffer,
           static_cast<unsigned long long>(offset), static_cast<unsigned long long>(length));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         BufferID bufferPacked = PackParam<BufferID>(buffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -2449,7 +2449,7 @@ void GL_APIENTRY GL_InvalidateTexImage(GLuint texture, GLint level)
     EVENT(context, GLInvalidateTexImage, "context = %d, texture = %u, level = %d", CID(context),
           texture, level);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -2484,7 +2484,7 @@ void GL_APIENTRY GL_InvalidateTexSubImage(GLuint texture,
           "= %d, height = %d, depth = %d",
           CID(context), texture, level, xoffset, yoffset, zoffset, width, height, depth);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -2517,7 +2517,7 @@ void GL_APIENTRY GL_MultiDrawArraysIndirect(GLenum mode,
           CID(context), GLenumToString(BigGLEnum::PrimitiveType, mode), (uintptr_t)indirect,
           drawcount, stride);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         PrimitiveMode modePacked = PackParam<PrimitiveMode>(mode);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -2552,7 +2552,7 @@ void GL_APIENTRY GL_MultiDrawElementsIndirect(GLenum mode,
           GLenumToString(BigGLEnum::DrawElementsType, type), (uintptr_t)indirect, drawcount,
           stride);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         PrimitiveMode modePacked    = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked = PackParam<DrawElementsType>(type);
@@ -2583,7 +2583,7 @@ void GL_APIENTRY GL_ShaderStorageBlockBinding(GLuint program,
           "context = %d, program = %u, storageBlockIndex = %u, storageBlockBinding = %u",
           CID(context), program, storageBlockIndex, storageBlockBinding);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked = PackParam<ShaderProgramID>(program);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -2622,7 +2622,7 @@ void GL_APIENTRY GL_TextureView(GLuint texture,
           GLenumToString(BigGLEnum::SizedInternalFormat, internalformat), minlevel, numlevels,
           minlayer, numlayers);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -2654,7 +2654,7 @@ void GL_APIENTRY GL_VertexAttribLFormat(GLuint attribindex,
           "context = %d, attribindex = %u, size = %d, type = %s, relativeoffset = %u", CID(context),
           attribindex, size, GLenumToString(BigGLEnum::VertexAttribLType, type), relativeoffset);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -2686,7 +2686,7 @@ void GL_APIENTRY GL_BindBuffersBase(GLenum target,
           CID(context), GLenumToString(BigGLEnum::BufferTargetARB, target), first, count,
           (uintptr_t)buffers);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         const BufferID *buffersPacked = PackParam<const BufferID *>(buffers);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -2720,7 +2720,7 @@ void GL_APIENTRY GL_BindBuffersRange(GLenum target,
           CID(context), GLenumToString(BigGLEnum::BufferTargetARB, target), first, count,
           (uintptr_t)buffers, (uintptr_t)offsets, (uintptr_t)sizes);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         const BufferID *buffersPacked = PackParam<const BufferID *>(buffers);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -2748,7 +2748,7 @@ void GL_APIENTRY GL_BindImageTextures(GLuint first, GLsizei count, const GLuint
           "context = %d, first = %u, count = %d, textures = 0x%016" PRIxPTR "", CID(context), first,
           count, (uintptr_t)textures);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -2774,7 +2774,7 @@ void GL_APIENTRY GL_BindSamplers(GLuint first, GLsizei count, const GLuint *samp
           "context = %d, first = %u, count = %d, samplers = 0x%016" PRIxPTR "", CID(context), first,
           count, (uintptr_t)samplers);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2799,7 +2799,7 @@ void GL_APIENTRY GL_BindTextures(GLuint first, GLsizei count, const GLuint *text
           "context = %d, first = %u, count = %d, textures = 0x%016" PRIxPTR "", CID(context), first,
           count, (uintptr_t)textures);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2829,7 +2829,7 @@ void GL_APIENTRY GL_BindVertexBuffers(GLuint first,
           ", offsets = 0x%016" PRIxPTR ", strides = 0x%016" PRIxPTR "",
           CID(context), first, count, (uintptr_t)buffers, (uintptr_t)offsets, (uintptr_t)strides);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         const BufferID *buffersPacked = PackParam<const BufferID *>(buffers);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -2862,7 +2862,7 @@ void GL_APIENTRY GL_BufferStorage(GLenum target,
           static_cast<unsigned long long>(size), (uintptr_t)data,
           GLbitfieldToString(BigGLEnum::BufferStorageMask, flags).c_str());
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         BufferBinding targetPacked = PackParam<BufferBinding>(target);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -2891,7 +2891,7 @@ GL_ClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const
           CID(context), texture, level, GLenumToString(BigGLEnum::PixelFormat, format),
           GLenumToString(BigGLEnum::PixelType, type), (uintptr_t)data);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -2931,7 +2931,7 @@ void GL_APIENTRY GL_ClearTexSubImage(GLuint texture,
           GLenumToString(BigGLEnum::PixelFormat, format),
           GLenumToString(BigGLEnum::PixelType, type), (uintptr_t)data);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -2961,7 +2961,7 @@ void GL_APIENTRY GL_BindTextureUnit(GLuint unit, GLuint texture)
     EVENT(context, GLBindTextureUnit, "context = %d, unit = %u, texture = %u", CID(context), unit,
           texture);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -3002,7 +3002,7 @@ void GL_APIENTRY GL_BlitNamedFramebuffer(GLuint readFramebuffer,
         dstX1, dstY1, GLbitfieldToString(BigGLEnum::ClearBufferMask, mask).c_str(),
         GLenumToString(BigGLEnum::BlitFramebufferFilter, filter));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -3032,7 +3032,7 @@ GLenum GL_APIENTRY GL_CheckNamedFramebufferStatus(GLuint framebuffer, GLenum tar
           CID(context), framebuffer, GLenumToString(BigGLEnum::FramebufferTarget, target));
 
     GLenum returnValue;
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -3075,7 +3075,7 @@ void GL_APIENTRY GL_ClearNamedBufferData(GLuint buffer,
           GLenumToString(BigGLEnum::PixelFormat, format),
           GLenumToString(BigGLEnum::PixelType, type), (uintptr_t)data);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         BufferID bufferPacked = PackParam<BufferID>(buffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -3113,7 +3113,7 @@ void GL_APIENTRY GL_ClearNamedBufferSubData(GLuint buffer,
           GLenumToString(BigGLEnum::PixelFormat, format),
           GLenumToString(BigGLEnum::PixelType, type), (uintptr_t)data);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         BufferID bufferPacked = PackParam<BufferID>(buffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -3147,7 +3147,7 @@ void GL_APIENTRY GL_ClearNamedFramebufferfi(GLuint framebuffer,
           CID(context), framebuffer, GLenumToString(BigGLEnum::Buffer, buffer), drawbuffer, depth,
           stencil);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -3179,7 +3179,7 @@ void GL_APIENTRY GL_ClearNamedFramebufferfv(GLuint framebuffer,
           CID(context), framebuffer, GLenumToString(BigGLEnum::Buffer, buffer), drawbuffer,
           (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -3211,7 +3211,7 @@ void GL_APIENTRY GL_ClearNamedFramebufferiv(GLuint framebuffer,
           CID(context), framebuffer, GLenumToString(BigGLEnum::Buffer, buffer), drawbuffer,
           (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -3243,7 +3243,7 @@ void GL_APIENTRY GL_ClearNamedFramebufferuiv(GLuint framebuffer,
           CID(context), framebuffer, GLenumToString(BigGLEnum::Buffer, buffer), drawbuffer,
           (uintptr_t)value);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -3271,7 +3271,7 @@ void GL_APIENTRY GL_ClipControl(GLenum origin, GLenum depth)
           GLenumToString(BigGLEnum::ClipControlOrigin, origin),
           GLenumToString(BigGLEnum::ClipControlDepth, depth));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -3304,7 +3304,7 @@ void GL_APIENTRY GL_CompressedTextureSubImage1D(GLuint texture,
           CID(context), texture, level, xoffset, width,
           GLenumToString(BigGLEnum::InternalFormat, format), imageSize, (uintptr_t)data);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -3343,7 +3343,7 @@ void GL_APIENTRY GL_CompressedTextureSubImage2D(GLuint texture,
           CID(context), texture, level, xoffset, yoffset, width, height,
           GLenumToString(BigGLEnum::InternalFormat, format), imageSize, (uintptr_t)data);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -3385,7 +3385,7 @@ void GL_APIENTRY GL_CompressedTextureSubImage3D(GLuint texture,
           CID(context), texture, level, xoffset, yoffset, zoffset, width, height, depth,
           GLenumToString(BigGLEnum::InternalFormat, format), imageSize, (uintptr_t)data);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -3421,7 +3421,7 @@ void GL_APIENTRY GL_CopyNamedBufferSubData(GLuint readBuffer,
           CID(context), readBuffer, writeBuffer, static_cast<unsigned long long>(readOffset),
           static_cast<unsigned long long>(writeOffset), static_cast<unsigned long long>(size));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3453,7 +3453,7 @@ void GL_APIENTRY GL_CopyTextureSubImage1D(GLuint texture,
           "context = %d, texture = %u, level = %d, xoffset = %d, x = %d, y = %d, width = %d",
           CID(context), texture, level, xoffset, x, y, width);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -3489,7 +3489,7 @@ void GL_APIENTRY GL_CopyTextureSubImage2D(GLuint texture,
           "width = %d, height = %d",
           CID(context), texture, level, xoffset, yoffset, x, y, width, height);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -3527,7 +3527,7 @@ void GL_APIENTRY GL_CopyTextureSubImage3D(GLuint texture,
           "%d, y = %d, width = %d, height = %d",
           CID(context), texture, level, xoffset, yoffset, zoffset, x, y, width, height);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -3555,7 +3555,7 @@ void GL_APIENTRY GL_CreateBuffers(GLsizei n, GLuint *buffers)
     EVENT(context, GLCreateBuffers, "context = %d, n = %d, buffers = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)buffers);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         BufferID *buffersPacked = PackParam<BufferID *>(buffers);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -3580,7 +3580,7 @@ void GL_APIENTRY GL_CreateFramebuffers(GLsizei n, GLuint *framebuffers)
     EVENT(context, GLCreateFramebuffers, "context = %d, n = %d, framebuffers = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)framebuffers);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3604,7 +3604,7 @@ void GL_APIENTRY GL_CreateProgramPipelines(GLsizei n, GLuint *pipelines)
     EVENT(context, GLCreateProgramPipelines, "context = %d, n = %d, pipelines = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)pipelines);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -3629,7 +3629,7 @@ void GL_APIENTRY GL_CreateQueries(GLenum target, GLsizei n, GLuint *ids)
     EVENT(context, GLCreateQueries, "context = %d, target = %s, n = %d, ids = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(BigGLEnum::QueryTarget, target), n, (uintptr_t)ids);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -3653,7 +3653,7 @@ void GL_APIENTRY GL_CreateRenderbuffers(GLsizei n, GLuint *renderbuffers)
     EVENT(context, GLCreateRenderbuffers, "context = %d, n = %d, renderbuffers = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)renderbuffers);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         RenderbufferID *renderbuffersPacked = PackParam<RenderbufferID *>(renderbuffers);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -3679,7 +3679,7 @@ void GL_APIENTRY GL_CreateSamplers(GLsizei n, GLuint *samplers)
     EVENT(context, GLCreateSamplers, "context = %d, n = %d, samplers = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)samplers);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -3704,7 +3704,7 @@ void GL_APIENTRY GL_CreateTextures(GLenum target, GLsizei n, GLuint *textures)
           "context = %d, target = %s, n = %d, textures = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(BigGLEnum::TextureTarget, target), n, (uintptr_t)textures);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3728,7 +3728,7 @@ void GL_APIENTRY GL_CreateTransformFeedbacks(GLsizei n, GLuint *ids)
     EVENT(context, GLCreateTransformFeedbacks, "context = %d, n = %d, ids = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)ids);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -3752,7 +3752,7 @@ void GL_APIENTRY GL_CreateVertexArrays(GLsizei n, GLuint *arrays)
     EVENT(context, GLCreateVertexArrays, "context = %d, n = %d, arrays = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)arrays);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         VertexArrayID *arraysPacked = PackParam<VertexArrayID *>(arrays);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -3777,7 +3777,7 @@ void GL_APIENTRY GL_DisableVertexArrayAttrib(GLuint vaobj, GLuint index)
     EVENT(context, GLDisableVertexArrayAttrib, "context = %d, vaobj = %u, index = %u", CID(context),
           vaobj, index);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         VertexArrayID vaobjPacked = PackParam<VertexArrayID>(vaobj);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -3803,7 +3803,7 @@ void GL_APIENTRY GL_EnableVertexArrayAttrib(GLuint vaobj, GLuint index)
     EVENT(context, GLEnableVertexArrayAttrib, "context = %d, vaobj = %u, index = %u", CID(context),
           vaobj, index);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         VertexArrayID vaobjPacked = PackParam<VertexArrayID>(vaobj);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -3830,7 +3830,7 @@ void GL_APIENTRY GL_FlushMappedNamedBufferRange(GLuint buffer, GLintptr offset,
           "context = %d, buffer = %u, offset = %llu, length = %llu", CID(context), buffer,
           static_cast<unsigned long long>(offset), static_cast<unsigned long long>(length));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         BufferID bufferPacked = PackParam<BufferID>(buffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -3856,7 +3856,7 @@ void GL_APIENTRY GL_GenerateTextureMipmap(GLuint texture)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenerateTextureMipmap, "context = %d, texture = %u", CID(context), texture);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -3886,7 +3886,7 @@ void GL_APIENTRY GL_GetCompressedTextureImage(GLuint texture,
           "context = %d, texture = %u, level = %d, bufSize = %d, pixels = 0x%016" PRIxPTR "",
           CID(context), texture, level, bufSize, (uintptr_t)pixels);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -3925,7 +3925,7 @@ void GL_APIENTRY GL_GetCompressedTextureSubImage(GLuint texture,
           CID(context), texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize,
           (uintptr_t)pixels);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -3955,7 +3955,7 @@ void GL_APIENTRY GL_GetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLi
           "context = %d, buffer = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), buffer,
           GLenumToString(BigGLEnum::AllEnums, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         BufferID bufferPacked = PackParam<BufferID>(buffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -3983,7 +3983,7 @@ void GL_APIENTRY GL_GetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint
           "context = %d, buffer = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), buffer,
           GLenumToString(BigGLEnum::AllEnums, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         BufferID bufferPacked = PackParam<BufferID>(buffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -4011,7 +4011,7 @@ void GL_APIENTRY GL_GetNamedBufferPointerv(GLuint buffer, GLenum pname, void **p
           "context = %d, buffer = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), buffer,
           GLenumToString(BigGLEnum::AllEnums, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         BufferID bufferPacked = PackParam<BufferID>(buffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -4042,7 +4042,7 @@ void GL_APIENTRY GL_GetNamedBufferSubData(GLuint buffer,
           CID(context), buffer, static_cast<unsigned long long>(offset),
           static_cast<unsigned long long>(size), (uintptr_t)data);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         BufferID bufferPacked = PackParam<BufferID>(buffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -4074,7 +4074,7 @@ void GL_APIENTRY GL_GetNamedFramebufferAttachmentParameteriv(GLuint framebuffer,
           CID(context), framebuffer, GLenumToString(BigGLEnum::FramebufferAttachment, attachment),
           GLenumToString(BigGLEnum::FramebufferAttachmentParameterName, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -4104,7 +4104,7 @@ void GL_APIENTRY GL_GetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pn
           "context = %d, framebuffer = %u, pname = %s, param = 0x%016" PRIxPTR "", CID(context),
           framebuffer, GLenumToString(BigGLEnum::GetFramebufferParameter, pname), (uintptr_t)param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -4135,7 +4135,7 @@ void GL_APIENTRY GL_GetNamedRenderbufferParameteriv(GLuint renderbuffer,
           renderbuffer, GLenumToString(BigGLEnum::RenderbufferParameterName, pname),
           (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         RenderbufferID renderbufferPacked = PackParam<RenderbufferID>(renderbuffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -4167,7 +4167,7 @@ void GL_APIENTRY GL_GetQueryBufferObjecti64v(GLuint id,
           GLenumToString(BigGLEnum::QueryObjectParameterName, pname),
           static_cast<unsigned long long>(offset));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         BufferID bufferPacked = PackParam<BufferID>(buffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -4196,7 +4196,7 @@ void GL_APIENTRY GL_GetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pnam
           GLenumToString(BigGLEnum::QueryObjectParameterName, pname),
           static_cast<unsigned long long>(offset));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         BufferID bufferPacked = PackParam<BufferID>(buffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -4228,7 +4228,7 @@ void GL_APIENTRY GL_GetQueryBufferObjectui64v(GLuint id,
           GLenumToString(BigGLEnum::QueryObjectParameterName, pname),
           static_cast<unsigned long long>(offset));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         BufferID bufferPacked = PackParam<BufferID>(buffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -4257,7 +4257,7 @@ void GL_APIENTRY GL_GetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pna
           GLenumToString(BigGLEnum::QueryObjectParameterName, pname),
           static_cast<unsigned long long>(offset));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         BufferID bufferPacked = PackParam<BufferID>(buffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -4292,7 +4292,7 @@ void GL_APIENTRY GL_GetTextureImage(GLuint texture,
           CID(context), texture, level, GLenumToString(BigGLEnum::PixelFormat, format),
           GLenumToString(BigGLEnum::PixelType, type), bufSize, (uintptr_t)pixels);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -4324,7 +4324,7 @@ void GL_APIENTRY GL_GetTextureLevelParameterfv(GLuint texture,
           CID(context), texture, level, GLenumToString(BigGLEnum::GetTextureParameter, pname),
           (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -4356,7 +4356,7 @@ void GL_APIENTRY GL_GetTextureLevelParameteriv(GLuint texture,
           CID(context), texture, level, GLenumToString(BigGLEnum::GetTextureParameter, pname),
           (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -4384,7 +4384,7 @@ void GL_APIENTRY GL_GetTextureParameterIiv(GLuint texture, GLenum pname, GLint *
           "context = %d, texture = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           texture, GLenumToString(BigGLEnum::GetTextureParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -4412,7 +4412,7 @@ void GL_APIENTRY GL_GetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint
           "context = %d, texture = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           texture, GLenumToString(BigGLEnum::GetTextureParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -4440,7 +4440,7 @@ void GL_APIENTRY GL_GetTextureParameterfv(GLuint texture, GLenum pname, GLfloat
           "context = %d, texture = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           texture, GLenumToString(BigGLEnum::GetTextureParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -4467,7 +4467,7 @@ void GL_APIENTRY GL_GetTextureParameteriv(GLuint texture, GLenum pname, GLint *p
           "context = %d, texture = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           texture, GLenumToString(BigGLEnum::GetTextureParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -4510,7 +4510,7 @@ void GL_APIENTRY GL_GetTextureSubImage(GLuint texture,
         GLenumToString(BigGLEnum::PixelFormat, format), GLenumToString(BigGLEnum::PixelType, type),
         bufSize, (uintptr_t)pixels);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -4543,7 +4543,7 @@ void GL_APIENTRY GL_GetTransformFeedbacki64_v(GLuint xfb,
           "context = %d, xfb = %u, pname = %s, index = %u, param = 0x%016" PRIxPTR "", CID(context),
           xfb, GLenumToString(BigGLEnum::TransformFeedbackPName, pname), index, (uintptr_t)param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4569,7 +4569,7 @@ void GL_APIENTRY GL_GetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint ind
           "context = %d, xfb = %u, pname = %s, index = %u, param = 0x%016" PRIxPTR "", CID(context),
           xfb, GLenumToString(BigGLEnum::TransformFeedbackPName, pname), index, (uintptr_t)param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -4595,7 +4595,7 @@ void GL_APIENTRY GL_GetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint *para
           "context = %d, xfb = %u, pname = %s, param = 0x%016" PRIxPTR "", CID(context), xfb,
           GLenumToString(BigGLEnum::TransformFeedbackPName, pname), (uintptr_t)param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -4625,7 +4625,7 @@ void GL_APIENTRY GL_GetVertexArrayIndexed64iv(GLuint vaobj,
           CID(context), vaobj, index, GLenumToString(BigGLEnum::VertexArrayPName, pname),
           (uintptr_t)param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         VertexArrayID vaobjPacked = PackParam<VertexArrayID>(vaobj);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -4654,7 +4654,7 @@ void GL_APIENTRY GL_GetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum p
           CID(context), vaobj, index, GLenumToString(BigGLEnum::VertexArrayPName, pname),
           (uintptr_t)param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         VertexArrayID vaobjPacked = PackParam<VertexArrayID>(vaobj);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -4682,7 +4682,7 @@ void GL_APIENTRY GL_GetVertexArrayiv(GLuint vaobj, GLenum pname, GLint *param)
           "context = %d, vaobj = %u, pname = %s, param = 0x%016" PRIxPTR "", CID(context), vaobj,
           GLenumToString(BigGLEnum::VertexArrayPName, pname), (uintptr_t)param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         VertexArrayID vaobjPacked = PackParam<VertexArrayID>(vaobj);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -4712,7 +4712,7 @@ GL_GetnColorTable(GLenum target, GLenum format, GLenum type, GLsizei bufSize, vo
           GLenumToString(BigGLEnum::PixelFormat, format),
           GLenumToString(BigGLEnum::PixelType, type), bufSize, (uintptr_t)table);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4739,7 +4739,7 @@ void GL_APIENTRY GL_GetnCompressedTexImage(GLenum target, GLint lod, GLsizei buf
           CID(context), GLenumToString(BigGLEnum::TextureTarget, target), lod, bufSize,
           (uintptr_t)pixels);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -4770,7 +4770,7 @@ GL_GetnConvolutionFilter(GLenum target, GLenum format, GLenum type, GLsizei bufS
           GLenumToString(BigGLEnum::PixelFormat, format),
           GLenumToString(BigGLEnum::PixelType, type), bufSize, (uintptr_t)image);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -4805,7 +4805,7 @@ void GL_APIENTRY GL_GetnHistogram(GLenum target,
           GLbooleanToString(reset), GLenumToString(BigGLEnum::PixelFormat, format),
           GLenumToString(BigGLEnum::PixelType, type), bufSize, (uintptr_t)values);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4832,7 +4832,7 @@ void GL_APIENTRY GL_GetnMapdv(GLenum target, GLenum query, GLsizei bufSize, GLdo
           CID(context), GLenumToString(BigGLEnum::MapTarget, target),
           GLenumToString(BigGLEnum::MapQuery, query), bufSize, (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -4858,7 +4858,7 @@ void GL_APIENTRY GL_GetnMapfv(GLenum target, GLenum query, GLsizei bufSize, GLfl
           CID(context), GLenumToString(BigGLEnum::MapTarget, target),
           GLenumToString(BigGLEnum::MapQuery, query), bufSize, (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -4884,7 +4884,7 @@ void GL_APIENTRY GL_GetnMapiv(GLenum target, GLenum query, GLsizei bufSize, GLin
           CID(context), GLenumToString(BigGLEnum::MapTarget, target),
           GLenumToString(BigGLEnum::MapQuery, query), bufSize, (uintptr_t)v);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -4917,7 +4917,7 @@ void GL_APIENTRY GL_GetnMinmax(GLenum target,
           GLenumToString(BigGLEnum::PixelFormat, format),
           GLenumToString(BigGLEnum::PixelType, type), bufSize, (uintptr_t)values);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4943,7 +4943,7 @@ void GL_APIENTRY GL_GetnPixelMapfv(GLenum map, GLsizei bufSize, GLfloat *values)
           "context = %d, map = %s, bufSize = %d, values = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(BigGLEnum::PixelMap, map), bufSize, (uintptr_t)values);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4968,7 +4968,7 @@ void GL_APIENTRY GL_GetnPixelMapuiv(GLenum map, GLsizei bufSize, GLuint *values)
           "context = %d, map = %s, bufSize = %d, values = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(BigGLEnum::PixelMap, map), bufSize, (uintptr_t)values);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -4993,7 +4993,7 @@ void GL_APIENTRY GL_GetnPixelMapusv(GLenum map, GLsizei bufSize, GLushort *value
           "context = %d, map = %s, bufSize = %d, values = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(BigGLEnum::PixelMap, map), bufSize, (uintptr_t)values);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5017,7 +5017,7 @@ void GL_APIENTRY GL_GetnPolygonStipple(GLsizei bufSize, GLubyte *pattern)
     EVENT(context, GLGetnPolygonStipple, "context = %d, bufSize = %d, pattern = 0x%016" PRIxPTR "",
           CID(context), bufSize, (uintptr_t)pattern);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -5054,7 +5054,7 @@ void GL_APIENTRY GL_GetnSeparableFilter(GLenum target,
           GLenumToString(BigGLEnum::PixelType, type), rowBufSize, (uintptr_t)row, columnBufSize,
           (uintptr_t)column, (uintptr_t)span);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5090,7 +5090,7 @@ void GL_APIENTRY GL_GetnTexImage(GLenum target,
           GLenumToString(BigGLEnum::PixelFormat, format),
           GLenumToString(BigGLEnum::PixelType, type), bufSize, (uintptr_t)pixels);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5116,7 +5116,7 @@ void GL_APIENTRY GL_GetnUniformdv(GLuint program, GLint location, GLsizei bufSiz
           "context = %d, program = %u, location = %d, bufSize = %d, params = 0x%016" PRIxPTR "",
           CID(context), program, location, bufSize, (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
@@ -5146,7 +5146,7 @@ void GL_APIENTRY GL_InvalidateNamedFramebufferData(GLuint framebuffer,
           "context = %d, framebuffer = %u, numAttachments = %d, attachments = 0x%016" PRIxPTR "",
           CID(context), framebuffer, numAttachments, (uintptr_t)attachments);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -5181,7 +5181,7 @@ void GL_APIENTRY GL_InvalidateNamedFramebufferSubData(GLuint framebuffer,
           ", x = %d, y = %d, width = %d, height = %d",
           CID(context), framebuffer, numAttachments, (uintptr_t)attachments, x, y, width, height);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -5211,7 +5211,7 @@ void *GL_APIENTRY GL_MapNamedBuffer(GLuint buffer, GLenum access)
           GLenumToString(BigGLEnum::BufferAccessARB, access));
 
     void *returnValue;
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         BufferID bufferPacked = PackParam<BufferID>(buffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -5248,7 +5248,7 @@ void *GL_APIENTRY GL_MapNamedBufferRange(GLuint buffer,
           GLbitfieldToString(BigGLEnum::MapBufferAccessMask, access).c_str());
 
     void *returnValue;
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         BufferID bufferPacked = PackParam<BufferID>(buffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -5283,7 +5283,7 @@ void GL_APIENTRY GL_NamedBufferData(GLuint buffer, GLsizeiptr size, const void *
           CID(context), buffer, static_cast<unsigned long long>(size), (uintptr_t)data,
           GLenumToString(BigGLEnum::VertexBufferObjectUsage, usage));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         BufferID bufferPacked = PackParam<BufferID>(buffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -5313,7 +5313,7 @@ void GL_APIENTRY GL_NamedBufferStorage(GLuint buffer,
           CID(context), buffer, static_cast<unsigned long long>(size), (uintptr_t)data,
           GLbitfieldToString(BigGLEnum::BufferStorageMask, flags).c_str());
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         BufferID bufferPacked = PackParam<BufferID>(buffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -5344,7 +5344,7 @@ void GL_APIENTRY GL_NamedBufferSubData(GLuint buffer,
           CID(context), buffer, static_cast<unsigned long long>(offset),
           static_cast<unsigned long long>(size), (uintptr_t)data);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         BufferID bufferPacked = PackParam<BufferID>(buffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -5371,7 +5371,7 @@ void GL_APIENTRY GL_NamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf)
     EVENT(context, GLNamedFramebufferDrawBuffer, "context = %d, framebuffer = %u, buf = %s",
           CID(context), framebuffer, GLenumToString(BigGLEnum::ColorBuffer, buf));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -5398,7 +5398,7 @@ void GL_APIENTRY GL_NamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, c
           "context = %d, framebuffer = %u, n = %d, bufs = 0x%016" PRIxPTR "", CID(context),
           framebuffer, n, (uintptr_t)bufs);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -5426,7 +5426,7 @@ void GL_APIENTRY GL_NamedFramebufferParameteri(GLuint framebuffer, GLenum pname,
           "context = %d, framebuffer = %u, pname = %s, param = %d", CID(context), framebuffer,
           GLenumToString(BigGLEnum::FramebufferParameterName, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -5453,7 +5453,7 @@ void GL_APIENTRY GL_NamedFramebufferReadBuffer(GLuint framebuffer, GLenum src)
     EVENT(context, GLNamedFramebufferReadBuffer, "context = %d, framebuffer = %u, src = %s",
           CID(context), framebuffer, GLenumToString(BigGLEnum::ColorBuffer, src));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -5485,7 +5485,7 @@ void GL_APIENTRY GL_NamedFramebufferRenderbuffer(GLuint framebuffer,
           CID(context), framebuffer, GLenumToString(BigGLEnum::FramebufferAttachment, attachment),
           GLenumToString(BigGLEnum::RenderbufferTarget, renderbuffertarget), renderbuffer);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         FramebufferID framebufferPacked   = PackParam<FramebufferID>(framebuffer);
         RenderbufferID renderbufferPacked = PackParam<RenderbufferID>(renderbuffer);
@@ -5520,7 +5520,7 @@ void GL_APIENTRY GL_NamedFramebufferTexture(GLuint framebuffer,
           framebuffer, GLenumToString(BigGLEnum::FramebufferAttachment, attachment), texture,
           level);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         TextureID texturePacked         = PackParam<TextureID>(texture);
@@ -5554,7 +5554,7 @@ void GL_APIENTRY GL_NamedFramebufferTextureLayer(GLuint framebuffer,
           CID(context), framebuffer, GLenumToString(BigGLEnum::FramebufferAttachment, attachment),
           texture, level, layer);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         TextureID texturePacked         = PackParam<TextureID>(texture);
@@ -5588,7 +5588,7 @@ void GL_APIENTRY GL_NamedRenderbufferStorage(GLuint renderbuffer,
           CID(context), renderbuffer, GLenumToString(BigGLEnum::InternalFormat, internalformat),
           width, height);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         RenderbufferID renderbufferPacked = PackParam<RenderbufferID>(renderbuffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -5622,7 +5622,7 @@ void GL_APIENTRY GL_NamedRenderbufferStorageMultisample(GLuint renderbuffer,
           CID(context), renderbuffer, samples,
           GLenumToString(BigGLEnum::InternalFormat, internalformat), width, height);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         RenderbufferID renderbufferPacked = PackParam<RenderbufferID>(renderbuffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -5649,7 +5649,7 @@ void GL_APIENTRY GL_TextureBarrier()
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTextureBarrier, "context = %d", CID(context));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -5673,7 +5673,7 @@ void GL_APIENTRY GL_TextureBuffer(GLuint texture, GLenum internalformat, GLuint
           CID(context), texture, GLenumToString(BigGLEnum::SizedInternalFormat, internalformat),
           buffer);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         BufferID bufferPacked   = PackParam<BufferID>(buffer);
@@ -5707,7 +5707,7 @@ void GL_APIENTRY GL_TextureBufferRange(GLuint texture,
         CID(context), texture, GLenumToString(BigGLEnum::SizedInternalFormat, internalformat),
         buffer, static_cast<unsigned long long>(offset), static_cast<unsigned long long>(size));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         BufferID bufferPacked   = PackParam<BufferID>(buffer);
@@ -5736,7 +5736,7 @@ void GL_APIENTRY GL_TextureParameterIiv(GLuint texture, GLenum pname, const GLin
           "context = %d, texture = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           texture, GLenumToString(BigGLEnum::TextureParameterName, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -5763,7 +5763,7 @@ void GL_APIENTRY GL_TextureParameterIuiv(GLuint texture, GLenum pname, const GLu
           "context = %d, texture = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           texture, GLenumToString(BigGLEnum::TextureParameterName, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -5789,7 +5789,7 @@ void GL_APIENTRY GL_TextureParameterf(GLuint texture, GLenum pname, GLfloat para
     EVENT(context, GLTextureParameterf, "context = %d, texture = %u, pname = %s, param = %f",
           CID(context), texture, GLenumToString(BigGLEnum::TextureParameterName, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -5816,7 +5816,7 @@ void GL_APIENTRY GL_TextureParameterfv(GLuint texture, GLenum pname, const GLflo
           "context = %d, texture = %u, pname = %s, param = 0x%016" PRIxPTR "", CID(context),
           texture, GLenumToString(BigGLEnum::TextureParameterName, pname), (uintptr_t)param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -5842,7 +5842,7 @@ void GL_APIENTRY GL_TextureParameteri(GLuint texture, GLenum pname, GLint param)
     EVENT(context, GLTextureParameteri, "context = %d, texture = %u, pname = %s, param = %d",
           CID(context), texture, GLenumToString(BigGLEnum::TextureParameterName, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -5869,7 +5869,7 @@ void GL_APIENTRY GL_TextureParameteriv(GLuint texture, GLenum pname, const GLint
           "context = %d, texture = %u, pname = %s, param = 0x%016" PRIxPTR "", CID(context),
           texture, GLenumToString(BigGLEnum::TextureParameterName, pname), (uintptr_t)param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -5899,7 +5899,7 @@ void GL_APIENTRY GL_TextureStorage1D(GLuint texture,
           "context = %d, texture = %u, levels = %d, internalformat = %s, width = %d", CID(context),
           texture, levels, GLenumToString(BigGLEnum::SizedInternalFormat, internalformat), width);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -5931,7 +5931,7 @@ void GL_APIENTRY GL_TextureStorage2D(GLuint texture,
           CID(context), texture, levels,
           GLenumToString(BigGLEnum::SizedInternalFormat, internalformat), width, height);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -5967,7 +5967,7 @@ void GL_APIENTRY GL_TextureStorage2DMultisample(GLuint texture,
           GLenumToString(BigGLEnum::SizedInternalFormat, internalformat), width, height,
           GLbooleanToString(fixedsamplelocations));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -6004,7 +6004,7 @@ void GL_APIENTRY GL_TextureStorage3D(GLuint texture,
           CID(context), texture, levels,
           GLenumToString(BigGLEnum::SizedInternalFormat, internalformat), width, height, depth);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -6041,7 +6041,7 @@ void GL_APIENTRY GL_TextureStorage3DMultisample(GLuint texture,
           GLenumToString(BigGLEnum::SizedInternalFormat, internalformat), width, height, depth,
           GLbooleanToString(fixedsamplelocations));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -6080,7 +6080,7 @@ void GL_APIENTRY GL_TextureSubImage1D(GLuint texture,
           GLenumToString(BigGLEnum::PixelFormat, format),
           GLenumToString(BigGLEnum::PixelType, type), (uintptr_t)pixels);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -6119,7 +6119,7 @@ void GL_APIENTRY GL_TextureSubImage2D(GLuint texture,
           GLenumToString(BigGLEnum::PixelFormat, format),
           GLenumToString(BigGLEnum::PixelType, type), (uintptr_t)pixels);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -6161,7 +6161,7 @@ void GL_APIENTRY GL_TextureSubImage3D(GLuint texture,
           GLenumToString(BigGLEnum::PixelFormat, format),
           GLenumToString(BigGLEnum::PixelType, type), (uintptr_t)pixels);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureID texturePacked = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -6190,7 +6190,7 @@ void GL_APIENTRY GL_TransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint
     EVENT(context, GLTransformFeedbackBufferBase, "context = %d, xfb = %u, index = %u, buffer = %u",
           CID(context), xfb, index, buffer);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         BufferID bufferPacked = PackParam<BufferID>(buffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -6223,7 +6223,7 @@ void GL_APIENTRY GL_TransformFeedbackBufferRange(GLuint xfb,
           CID(context), xfb, index, buffer, static_cast<unsigned long long>(offset),
           static_cast<unsigned long long>(size));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         BufferID bufferPacked = PackParam<BufferID>(buffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -6250,7 +6250,7 @@ GLboolean GL_APIENTRY GL_UnmapNamedBuffer(GLuint buffer)
     EVENT(context, GLUnmapNamedBuffer, "context = %d, buffer = %u", CID(context), buffer);
 
     GLboolean returnValue;
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         BufferID bufferPacked = PackParam<BufferID>(buffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -6282,7 +6282,7 @@ void GL_APIENTRY GL_VertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, G
           "context = %d, vaobj = %u, attribindex = %u, bindingindex = %u", CID(context), vaobj,
           attribindex, bindingindex);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         VertexArrayID vaobjPacked = PackParam<VertexArrayID>(vaobj);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -6317,7 +6317,7 @@ void GL_APIENTRY GL_VertexArrayAttribFormat(GLuint vaobj,
           CID(context), vaobj, attribindex, size, GLenumToString(BigGLEnum::VertexAttribType, type),
           GLbooleanToString(normalized), relativeoffset);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         VertexArrayID vaobjPacked = PackParam<VertexArrayID>(vaobj);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -6351,7 +6351,7 @@ void GL_APIENTRY GL_VertexArrayAttribIFormat(GLuint vaobj,
           CID(context), vaobj, attribindex, size,
           GLenumToString(BigGLEnum::VertexAttribIType, type), relativeoffset);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         VertexArrayID vaobjPacked = PackParam<VertexArrayID>(vaobj);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -6384,7 +6384,7 @@ void GL_APIENTRY GL_VertexArrayAttribLFormat(GLuint vaobj,
           CID(context), vaobj, attribindex, size,
           GLenumToString(BigGLEnum::VertexAttribLType, type), relativeoffset);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         VertexArrayID vaobjPacked = PackParam<VertexArrayID>(vaobj);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -6412,7 +6412,7 @@ void GL_APIENTRY GL_VertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex,
           "context = %d, vaobj = %u, bindingindex = %u, divisor = %u", CID(context), vaobj,
           bindingindex, divisor);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         VertexArrayID vaobjPacked = PackParam<VertexArrayID>(vaobj);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -6439,7 +6439,7 @@ void GL_APIENTRY GL_VertexArrayElementBuffer(GLuint vaobj, GLuint buffer)
     EVENT(context, GLVertexArrayElementBuffer, "context = %d, vaobj = %u, buffer = %u",
           CID(context), vaobj, buffer);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         VertexArrayID vaobjPacked = PackParam<VertexArrayID>(vaobj);
         BufferID bufferPacked     = PackParam<BufferID>(buffer);
@@ -6472,7 +6472,7 @@ void GL_APIENTRY GL_VertexArrayVertexBuffer(GLuint vaobj,
           CID(context), vaobj, bindingindex, buffer, static_cast<unsigned long long>(offset),
           stride);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         VertexArrayID vaobjPacked = PackParam<VertexArrayID>(vaobj);
         BufferID bufferPacked     = PackParam<BufferID>(buffer);
@@ -6509,7 +6509,7 @@ void GL_APIENTRY GL_VertexArrayVertexBuffers(GLuint vaobj,
           CID(context), vaobj, first, count, (uintptr_t)buffers, (uintptr_t)offsets,
           (uintptr_t)strides);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         VertexArrayID vaobjPacked     = PackParam<VertexArrayID>(vaobj);
         const BufferID *buffersPacked = PackParam<const BufferID *>(buffers);
@@ -6546,7 +6546,7 @@ void GL_APIENTRY GL_MultiDrawArraysIndirectCount(GLenum mode,
           CID(context), GLenumToString(BigGLEnum::PrimitiveType, mode), (uintptr_t)indirect,
           static_cast<unsigned long long>(drawcount), maxdrawcount, stride);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -6581,7 +6581,7 @@ void GL_APIENTRY GL_MultiDrawElementsIndirectCount(GLenum mode,
           GLenumToString(BigGLEnum::DrawElementsType, type), (uintptr_t)indirect,
           static_cast<unsigned long long>(drawcount), maxdrawcount, stride);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -6608,7 +6608,7 @@ void GL_APIENTRY GL_PolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat cl
     EVENT(context, GLPolygonOffsetClamp, "context = %d, factor = %f, units = %f, clamp = %f",
           CID(context), factor, units, clamp);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -6641,7 +6641,7 @@ void GL_APIENTRY GL_SpecializeShader(GLuint shader,
           CID(context), shader, (uintptr_t)pEntryPoint, numSpecializationConstants,
           (uintptr_t)pConstantIndex, (uintptr_t)pConstantValue);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -28,7 +28,7 @@ void GL_APIENTRY GL_AlphaFunc(GLenum func, GLfloat ref)
     EVENT(context, GLAlphaFunc, "context = %d, func = %s, ref = %f", CID(context),
           GLenumToString(GLESEnum::AlphaFunction, func), ref);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         AlphaTestFunc funcPacked = PackParam<AlphaTestFunc>(func);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -53,7 +53,7 @@ void GL_APIENTRY GL_AlphaFuncx(GLenum func, GLfixed ref)
     EVENT(context, GLAlphaFuncx, "context = %d, func = %s, ref = 0x%X", CID(context),
           GLenumToString(GLESEnum::AlphaFunction, func), ref);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         AlphaTestFunc funcPacked = PackParam<AlphaTestFunc>(func);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -79,7 +79,7 @@ void GL_APIENTRY GL_ClearColorx(GLfixed red, GLfixed green, GLfixed blue, GLfixe
           "context = %d, red = 0x%X, green = 0x%X, blue = 0x%X, alpha = 0x%X", CID(context), red,
           green, blue, alpha);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -102,7 +102,7 @@ void GL_APIENTRY GL_ClearDepthx(GLfixed depth)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClearDepthx, "context = %d, depth = 0x%X", CID(context), depth);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -125,7 +125,7 @@ void GL_APIENTRY GL_ClientActiveTexture(GLenum texture)
     EVENT(context, GLClientActiveTexture, "context = %d, texture = %s", CID(context),
           GLenumToString(GLESEnum::TextureUnit, texture));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -149,7 +149,7 @@ void GL_APIENTRY GL_ClipPlanef(GLenum p, const GLfloat *eqn)
     EVENT(context, GLClipPlanef, "context = %d, p = %s, eqn = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::ClipPlaneName, p), (uintptr_t)eqn);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -172,7 +172,7 @@ void GL_APIENTRY GL_ClipPlanex(GLenum plane, const GLfixed *equation)
     EVENT(context, GLClipPlanex, "context = %d, plane = %s, equation = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::ClipPlaneName, plane), (uintptr_t)equation);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -196,7 +196,7 @@ void GL_APIENTRY GL_Color4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat al
     EVENT(context, GLColor4f, "context = %d, red = %f, green = %f, blue = %f, alpha = %f",
           CID(context), red, green, blue, alpha);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -220,7 +220,7 @@ void GL_APIENTRY GL_Color4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte a
     EVENT(context, GLColor4ub, "context = %d, red = %d, green = %d, blue = %d, alpha = %d",
           CID(context), red, green, blue, alpha);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -244,7 +244,7 @@ void GL_APIENTRY GL_Color4x(GLfixed red, GLfixed green, GLfixed blue, GLfixed al
     EVENT(context, GLColor4x, "context = %d, red = 0x%X, green = 0x%X, blue = 0x%X, alpha = 0x%X",
           CID(context), red, green, blue, alpha);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -270,7 +270,7 @@ void GL_APIENTRY GL_ColorPointer(GLint size, GLenum type, GLsizei stride, const
           CID(context), size, GLenumToString(GLESEnum::ColorPointerType, type), stride,
           (uintptr_t)pointer);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         VertexAttribType typePacked = PackParam<VertexAttribType>(type);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -294,7 +294,7 @@ void GL_APIENTRY GL_DepthRangex(GLfixed n, GLfixed f)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDepthRangex, "context = %d, n = 0x%X, f = 0x%X", CID(context), n, f);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -317,7 +317,7 @@ void GL_APIENTRY GL_DisableClientState(GLenum array)
     EVENT(context, GLDisableClientState, "context = %d, array = %s", CID(context),
           GLenumToString(GLESEnum::EnableCap, array));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ClientVertexArrayType arrayPacked = PackParam<ClientVertexArrayType>(array);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -342,7 +342,7 @@ void GL_APIENTRY GL_EnableClientState(GLenum array)
     EVENT(context, GLEnableClientState, "context = %d, array = %s", CID(context),
           GLenumToString(GLESEnum::EnableCap, array));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ClientVertexArrayType arrayPacked = PackParam<ClientVertexArrayType>(array);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -367,7 +367,7 @@ void GL_APIENTRY GL_Fogf(GLenum pname, GLfloat param)
     EVENT(context, GLFogf, "context = %d, pname = %s, param = %f", CID(context),
           GLenumToString(GLESEnum::FogParameter, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -390,7 +390,7 @@ void GL_APIENTRY GL_Fogfv(GLenum pname, const GLfloat *params)
     EVENT(context, GLFogfv, "context = %d, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::FogParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -413,7 +413,7 @@ void GL_APIENTRY GL_Fogx(GLenum pname, GLfixed param)
     EVENT(context, GLFogx, "context = %d, pname = %s, param = 0x%X", CID(context),
           GLenumToString(GLESEnum::FogPName, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -436,7 +436,7 @@ void GL_APIENTRY GL_Fogxv(GLenum pname, const GLfixed *param)
     EVENT(context, GLFogxv, "context = %d, pname = %s, param = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::FogPName, pname), (uintptr_t)param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -459,7 +459,7 @@ void GL_APIENTRY GL_Frustumf(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat
     EVENT(context, GLFrustumf, "context = %d, l = %f, r = %f, b = %f, t = %f, n = %f, f = %f",
           CID(context), l, r, b, t, n, f);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -484,7 +484,7 @@ void GL_APIENTRY GL_Frustumx(GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed
           "context = %d, l = 0x%X, r = 0x%X, b = 0x%X, t = 0x%X, n = 0x%X, f = 0x%X", CID(context),
           l, r, b, t, n, f);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -508,7 +508,7 @@ void GL_APIENTRY GL_GetClipPlanef(GLenum plane, GLfloat *equation)
     EVENT(context, GLGetClipPlanef, "context = %d, plane = %s, equation = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::ClipPlaneName, plane), (uintptr_t)equation);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -532,7 +532,7 @@ void GL_APIENTRY GL_GetClipPlanex(GLenum plane, GLfixed *equation)
     EVENT(context, GLGetClipPlanex, "context = %d, plane = %s, equation = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::ClipPlaneName, plane), (uintptr_t)equation);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -556,7 +556,7 @@ void GL_APIENTRY GL_GetFixedv(GLenum pname, GLfixed *params)
     EVENT(context, GLGetFixedv, "context = %d, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::GetPName, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -581,7 +581,7 @@ void GL_APIENTRY GL_GetLightfv(GLenum light, GLenum pname, GLfloat *params)
           CID(context), GLenumToString(GLESEnum::LightName, light),
           GLenumToString(GLESEnum::LightParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         LightParameter pnamePacked = PackParam<LightParameter>(pname);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -607,7 +607,7 @@ void GL_APIENTRY GL_GetLightxv(GLenum light, GLenum pname, GLfixed *params)
           CID(context), GLenumToString(GLESEnum::LightName, light),
           GLenumToString(GLESEnum::LightParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         LightParameter pnamePacked = PackParam<LightParameter>(pname);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -634,7 +634,7 @@ void GL_APIENTRY GL_GetMaterialfv(GLenum face, GLenum pname, GLfloat *params)
           GLenumToString(GLESEnum::TriangleFace, face),
           GLenumToString(GLESEnum::MaterialParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         MaterialParameter pnamePacked = PackParam<MaterialParameter>(pname);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -661,7 +661,7 @@ void GL_APIENTRY GL_GetMaterialxv(GLenum face, GLenum pname, GLfixed *params)
           GLenumToString(GLESEnum::TriangleFace, face),
           GLenumToString(GLESEnum::MaterialParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         MaterialParameter pnamePacked = PackParam<MaterialParameter>(pname);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -688,7 +688,7 @@ void GL_APIENTRY GL_GetTexEnvfv(GLenum target, GLenum pname, GLfloat *params)
           GLenumToString(GLESEnum::TextureEnvTarget, target),
           GLenumToString(GLESEnum::TextureEnvParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureEnvTarget targetPacked   = PackParam<TextureEnvTarget>(target);
         TextureEnvParameter pnamePacked = PackParam<TextureEnvParameter>(pname);
@@ -716,7 +716,7 @@ void GL_APIENTRY GL_GetTexEnviv(GLenum target, GLenum pname, GLint *params)
           GLenumToString(GLESEnum::TextureEnvTarget, target),
           GLenumToString(GLESEnum::TextureEnvParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureEnvTarget targetPacked   = PackParam<TextureEnvTarget>(target);
         TextureEnvParameter pnamePacked = PackParam<TextureEnvParameter>(pname);
@@ -744,7 +744,7 @@ void GL_APIENTRY GL_GetTexEnvxv(GLenum target, GLenum pname, GLfixed *params)
           GLenumToString(GLESEnum::TextureEnvTarget, target),
           GLenumToString(GLESEnum::TextureEnvParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureEnvTarget targetPacked   = PackParam<TextureEnvTarget>(target);
         TextureEnvParameter pnamePacked = PackParam<TextureEnvParameter>(pname);
@@ -772,7 +772,7 @@ void GL_APIENTRY GL_GetTexParameterxv(GLenum target, GLenum pname, GLfixed *para
           GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::GetTextureParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureType targetPacked = PackParam<TextureType>(target);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -798,7 +798,7 @@ void GL_APIENTRY GL_LightModelf(GLenum pname, GLfloat param)
     EVENT(context, GLLightModelf, "context = %d, pname = %s, param = %f", CID(context),
           GLenumToString(GLESEnum::LightModelParameter, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -822,7 +822,7 @@ void GL_APIENTRY GL_LightModelfv(GLenum pname, const GLfloat *params)
     EVENT(context, GLLightModelfv, "context = %d, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::LightModelParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -846,7 +846,7 @@ void GL_APIENTRY GL_LightModelx(GLenum pname, GLfixed param)
     EVENT(context, GLLightModelx, "context = %d, pname = %s, param = 0x%X", CID(context),
           GLenumToString(GLESEnum::LightModelParameter, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -870,7 +870,7 @@ void GL_APIENTRY GL_LightModelxv(GLenum pname, const GLfixed *param)
     EVENT(context, GLLightModelxv, "context = %d, pname = %s, param = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::LightModelParameter, pname), (uintptr_t)param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -895,7 +895,7 @@ void GL_APIENTRY GL_Lightf(GLenum light, GLenum pname, GLfloat param)
           GLenumToString(GLESEnum::LightName, light),
           GLenumToString(GLESEnum::LightParameter, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         LightParameter pnamePacked = PackParam<LightParameter>(pname);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -921,7 +921,7 @@ void GL_APIENTRY GL_Lightfv(GLenum light, GLenum pname, const GLfloat *params)
           CID(context), GLenumToString(GLESEnum::LightName, light),
           GLenumToString(GLESEnum::LightParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         LightParameter pnamePacked = PackParam<LightParameter>(pname);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -947,7 +947,7 @@ void GL_APIENTRY GL_Lightx(GLenum light, GLenum pname, GLfixed param)
           GLenumToString(GLESEnum::LightName, light),
           GLenumToString(GLESEnum::LightParameter, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         LightParameter pnamePacked = PackParam<LightParameter>(pname);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -973,7 +973,7 @@ void GL_APIENTRY GL_Lightxv(GLenum light, GLenum pname, const GLfixed *params)
           CID(context), GLenumToString(GLESEnum::LightName, light),
           GLenumToString(GLESEnum::LightParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         LightParameter pnamePacked = PackParam<LightParameter>(pname);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -997,7 +997,7 @@ void GL_APIENTRY GL_LineWidthx(GLfixed width)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLineWidthx, "context = %d, width = 0x%X", CID(context), width);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1019,7 +1019,7 @@ void GL_APIENTRY GL_LoadIdentity()
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLoadIdentity, "context = %d", CID(context));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1042,7 +1042,7 @@ void GL_APIENTRY GL_LoadMatrixf(const GLfloat *m)
     EVENT(context, GLLoadMatrixf, "context = %d, m = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)m);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1065,7 +1065,7 @@ void GL_APIENTRY GL_LoadMatrixx(const GLfixed *m)
     EVENT(context, GLLoadMatrixx, "context = %d, m = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)m);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1088,7 +1088,7 @@ void GL_APIENTRY GL_LogicOp(GLenum opcode)
     EVENT(context, GLLogicOp, "context = %d, opcode = %s", CID(context),
           GLenumToString(GLESEnum::LogicOp, opcode));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         LogicalOperation opcodePacked = PackParam<LogicalOperation>(opcode);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -1113,7 +1113,7 @@ void GL_APIENTRY GL_Materialf(GLenum face, GLenum pname, GLfloat param)
           GLenumToString(GLESEnum::TriangleFace, face),
           GLenumToString(GLESEnum::MaterialParameter, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         MaterialParameter pnamePacked = PackParam<MaterialParameter>(pname);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -1139,7 +1139,7 @@ void GL_APIENTRY GL_Materialfv(GLenum face, GLenum pname, const GLfloat *params)
           CID(context), GLenumToString(GLESEnum::TriangleFace, face),
           GLenumToString(GLESEnum::MaterialParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         MaterialParameter pnamePacked = PackParam<MaterialParameter>(pname);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -1165,7 +1165,7 @@ void GL_APIENTRY GL_Materialx(GLenum face, GLenum pname, GLfixed param)
           GLenumToString(GLESEnum::TriangleFace, face),
           GLenumToString(GLESEnum::MaterialParameter, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         MaterialParameter pnamePacked = PackParam<MaterialParameter>(pname);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -1191,7 +1191,7 @@ void GL_APIENTRY GL_Materialxv(GLenum face, GLenum pname, const GLfixed *param)
           CID(context), GLenumToString(GLESEnum::TriangleFace, face),
           GLenumToString(GLESEnum::MaterialParameter, pname), (uintptr_t)param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         MaterialParameter pnamePacked = PackParam<MaterialParameter>(pname);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -1216,7 +1216,7 @@ void GL_APIENTRY GL_MatrixMode(GLenum mode)
     EVENT(context, GLMatrixMode, "context = %d, mode = %s", CID(context),
           GLenumToString(GLESEnum::MatrixMode, mode));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         MatrixType modePacked = PackParam<MatrixType>(mode);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -1241,7 +1241,7 @@ void GL_APIENTRY GL_MultMatrixf(const GLfloat *m)
     EVENT(context, GLMultMatrixf, "context = %d, m = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)m);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1264,7 +1264,7 @@ void GL_APIENTRY GL_MultMatrixx(const GLfixed *m)
     EVENT(context, GLMultMatrixx, "context = %d, m = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)m);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1287,7 +1287,7 @@ void GL_APIENTRY GL_MultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat
     EVENT(context, GLMultiTexCoord4f, "context = %d, target = %s, s = %f, t = %f, r = %f, q = %f",
           CID(context), GLenumToString(GLESEnum::TextureUnit, target), s, t, r, q);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1312,7 +1312,7 @@ void GL_APIENTRY GL_MultiTexCoord4x(GLenum texture, GLfixed s, GLfixed t, GLfixe
           "context = %d, texture = %s, s = 0x%X, t = 0x%X, r = 0x%X, q = 0x%X", CID(context),
           GLenumToString(GLESEnum::TextureUnit, texture), s, t, r, q);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1335,7 +1335,7 @@ void GL_APIENTRY GL_Normal3f(GLfloat nx, GLfloat ny, GLfloat nz)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLNormal3f, "context = %d, nx = %f, ny = %f, nz = %f", CID(context), nx, ny, nz);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1358,7 +1358,7 @@ void GL_APIENTRY GL_Normal3x(GLfixed nx, GLfixed ny, GLfixed nz)
     EVENT(context, GLNormal3x, "context = %d, nx = 0x%X, ny = 0x%X, nz = 0x%X", CID(context), nx,
           ny, nz);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1382,7 +1382,7 @@ void GL_APIENTRY GL_NormalPointer(GLenum type, GLsizei stride, const void *point
           "context = %d, type = %s, stride = %d, pointer = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::NormalPointerType, type), stride, (uintptr_t)pointer);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         VertexAttribType typePacked = PackParam<VertexAttribType>(type);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -1407,7 +1407,7 @@ void GL_APIENTRY GL_Orthof(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n
     EVENT(context, GLOrthof, "context = %d, l = %f, r = %f, b = %f, t = %f, n = %f, f = %f",
           CID(context), l, r, b, t, n, f);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1431,7 +1431,7 @@ void GL_APIENTRY GL_Orthox(GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n
           "context = %d, l = 0x%X, r = 0x%X, b = 0x%X, t = 0x%X, n = 0x%X, f = 0x%X", CID(context),
           l, r, b, t, n, f);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1454,7 +1454,7 @@ void GL_APIENTRY GL_PointParameterf(GLenum pname, GLfloat param)
     EVENT(context, GLPointParameterf, "context = %d, pname = %s, param = %f", CID(context),
           GLenumToString(GLESEnum::AllEnums, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         PointParameter pnamePacked = PackParam<PointParameter>(pname);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -1479,7 +1479,7 @@ void GL_APIENTRY GL_PointParameterfv(GLenum pname, const GLfloat *params)
     EVENT(context, GLPointParameterfv, "context = %d, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         PointParameter pnamePacked = PackParam<PointParameter>(pname);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -1504,7 +1504,7 @@ void GL_APIENTRY GL_PointParameterx(GLenum pname, GLfixed param)
     EVENT(context, GLPointParameterx, "context = %d, pname = %s, param = 0x%X", CID(context),
           GLenumToString(GLESEnum::AllEnums, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         PointParameter pnamePacked = PackParam<PointParameter>(pname);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -1529,7 +1529,7 @@ void GL_APIENTRY GL_PointParameterxv(GLenum pname, const GLfixed *params)
     EVENT(context, GLPointParameterxv, "context = %d, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         PointParameter pnamePacked = PackParam<PointParameter>(pname);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -1553,7 +1553,7 @@ void GL_APIENTRY GL_PointSize(GLfloat size)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPointSize, "context = %d, size = %f", CID(context), size);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1575,7 +1575,7 @@ void GL_APIENTRY GL_PointSizex(GLfixed size)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPointSizex, "context = %d, size = 0x%X", CID(context), size);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1598,7 +1598,7 @@ void GL_APIENTRY GL_PolygonOffsetx(GLfixed factor, GLfixed units)
     EVENT(context, GLPolygonOffsetx, "context = %d, factor = 0x%X, units = 0x%X", CID(context),
           factor, units);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1621,7 +1621,7 @@ void GL_APIENTRY GL_PopMatrix()
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPopMatrix, "context = %d", CID(context));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1643,7 +1643,7 @@ void GL_APIENTRY GL_PushMatrix()
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPushMatrix, "context = %d", CID(context));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1666,7 +1666,7 @@ void GL_APIENTRY GL_Rotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
     EVENT(context, GLRotatef, "context = %d, angle = %f, x = %f, y = %f, z = %f", CID(context),
           angle, x, y, z);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1689,7 +1689,7 @@ void GL_APIENTRY GL_Rotatex(GLfixed angle, GLfixed x, GLfixed y, GLfixed z)
     EVENT(context, GLRotatex, "context = %d, angle = 0x%X, x = 0x%X, y = 0x%X, z = 0x%X",
           CID(context), angle, x, y, z);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1712,7 +1712,7 @@ void GL_APIENTRY GL_SampleCoveragex(GLclampx value, GLboolean invert)
     EVENT(context, GLSampleCoveragex, "context = %d, value = 0x%X, invert = %s", CID(context),
           value, GLbooleanToString(invert));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid =
@@ -1735,7 +1735,7 @@ void GL_APIENTRY GL_Scalef(GLfloat x, GLfloat y, GLfloat z)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLScalef, "context = %d, x = %f, y = %f, z = %f", CID(context), x, y, z);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1757,7 +1757,7 @@ void GL_APIENTRY GL_Scalex(GLfixed x, GLfixed y, GLfixed z)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLScalex, "context = %d, x = 0x%X, y = 0x%X, z = 0x%X", CID(context), x, y, z);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -1780,7 +1780,7 @@ void GL_APIENTRY GL_ShadeModel(GLenum mode)
     EVENT(context, GLShadeModel, "context = %d, mode = %s", CID(context),
           GLenumToString(GLESEnum::ShadingModel, mode));
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         ShadingModel modePacked = PackParam<ShadingModel>(mode);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -1807,7 +1807,7 @@ void GL_APIENTRY GL_TexCoordPointer(GLint size, GLenum type, GLsizei stride, con
           CID(context), size, GLenumToString(GLESEnum::TexCoordPointerType, type), stride,
           (uintptr_t)pointer);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         VertexAttribType typePacked = PackParam<VertexAttribType>(type);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -1833,7 +1833,7 @@ void GL_APIENTRY GL_TexEnvf(GLenum target, GLenum pname, GLfloat param)
           GLenumToString(GLESEnum::TextureEnvTarget, target),
           GLenumToString(GLESEnum::TextureEnvParameter, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureEnvTarget targetPacked   = PackParam<TextureEnvTarget>(target);
         TextureEnvParameter pnamePacked = PackParam<TextureEnvParameter>(pname);
@@ -1860,7 +1860,7 @@ void GL_APIENTRY GL_TexEnvfv(GLenum target, GLenum pname, const GLfloat *params)
           CID(context), GLenumToString(GLESEnum::TextureEnvTarget, target),
           GLenumToString(GLESEnum::TextureEnvParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureEnvTarget targetPacked   = PackParam<TextureEnvTarget>(target);
         TextureEnvParameter pnamePacked = PackParam<TextureEnvParameter>(pname);
@@ -1887,7 +1887,7 @@ void GL_APIENTRY GL_TexEnvi(GLenum target, GLenum pname, GLint param)
           GLenumToString(GLESEnum::TextureEnvTarget, target),
           GLenumToString(GLESEnum::TextureEnvParameter, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureEnvTarget targetPacked   = PackParam<TextureEnvTarget>(target);
         TextureEnvParameter pnamePacked = PackParam<TextureEnvParameter>(pname);
@@ -1914,7 +1914,7 @@ void GL_APIENTRY GL_TexEnviv(GLenum target, GLenum pname, const GLint *params)
           CID(context), GLenumToString(GLESEnum::TextureEnvTarget, target),
           GLenumToString(GLESEnum::TextureEnvParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureEnvTarget targetPacked   = PackParam<TextureEnvTarget>(target);
         TextureEnvParameter pnamePacked = PackParam<TextureEnvParameter>(pname);
@@ -1941,7 +1941,7 @@ void GL_APIENTRY GL_TexEnvx(GLenum target, GLenum pname, GLfixed param)
           GLenumToString(GLESEnum::TextureEnvTarget, target),
           GLenumToString(GLESEnum::TextureEnvParameter, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureEnvTarget targetPacked   = PackParam<TextureEnvTarget>(target);
         TextureEnvParameter pnamePacked = PackParam<TextureEnvParameter>(pname);
@@ -1968,7 +1968,7 @@ void GL_APIENTRY GL_TexEnvxv(GLenum target, GLenum pname, const GLfixed *params)
           CID(context), GLenumToString(GLESEnum::TextureEnvTarget, target),
           GLenumToString(GLESEnum::TextureEnvParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureEnvTarget targetPacked   = PackParam<TextureEnvTarget>(target);
         TextureEnvParameter pnamePacked = PackParam<TextureEnvParameter>(pname);
@@ -1995,7 +1995,7 @@ void GL_APIENTRY GL_TexParameterx(GLenum target, GLenum pname, GLfixed param)
           CID(context), GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::GetTextureParameter, pname), param);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureType targetPacked = PackParam<TextureType>(target);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -2022,7 +2022,7 @@ void GL_APIENTRY GL_TexParameterxv(GLenum target, GLenum pname, const GLfixed *p
           GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::GetTextureParameter, pname), (uintptr_t)params);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         TextureType targetPacked = PackParam<TextureType>(target);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -2046,7 +2046,7 @@ void GL_APIENTRY GL_Translatef(GLfloat x, GLfloat y, GLfloat z)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTranslatef, "context = %d, x = %f, y = %f, z = %f", CID(context), x, y, z);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2069,7 +2069,7 @@ void GL_APIENTRY GL_Translatex(GLfixed x, GLfixed y, GLfixed z)
     EVENT(context, GLTranslatex, "context = %d, x = 0x%X, y = 0x%X, z = 0x%X", CID(context), x, y,
           z);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = (context->skipValidation() ||
@@ -2094,7 +2094,7 @@ void GL_APIENTRY GL_VertexPointer(GLint size, GLenum type, GLsizei stride, const
           CID(context), size, GLenumToString(GLESEnum::VertexPointerType, type), stride,
           (uintptr_t)pointer);
 
-    if (context)
+    if (ANGLE_LIKELY(context != nullptr))
     {
         VertexAttribType typePacked = PackParam<VertexAttribType>(type);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -173,6 +173,10 @@ ANGLE_EXPORT void GL_APIENTRY GL_DrawElementsInstancedANGLE(GLenum mode,
                                                             GLsizei primcount);
 ANGLE_EXPORT void GL_APIENTRY GL_VertexAttribDivisorANGLE(GLuint index, GLuint divisor);
 
+// GL_ANGLE_lock_draws
+ANGLE_EXPORT void GL_APIENTRY GL_BeginLockedDrawsANGLE();
+ANGLE_EXPORT void GL_APIENTRY GL_EndLockedDrawsANGLE();
+
 // GL_ANGLE_logic_op
 ANGLE_EXPORT void GL_APIENTRY GL_LogicOpANGLE(GLenum opcode);
 
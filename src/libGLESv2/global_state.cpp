@@ -147,7 +147,7 @@ void SetCurrentThreadTLS(Thread *thread)
     SetTLSValue(CurrentThreadIndex, thread);
 }
 #else
-thread_local Thread *gCurrentThread = nullptr;
+thread_local Thread *gCurrentThread ANGLE_HOT_TLS_MODEL = nullptr;
 #endif
 
 angle::GlobalMutex &GetGlobalMutex()
@@ -229,7 +229,7 @@ void GenerateContextLostErrorOnContext(Context *context)
     }
 }
 
-void GenerateContextLostErrorOnCurrentGlobalContext()
+ANGLE_NOINLINE void GenerateContextLostErrorOnCurrentGlobalContext()
 {
     // If the client starts issuing GL calls before ANGLE has had a chance to initialize,
     // GenerateContextLostErrorOnCurrentGlobalContext can be called before AllocateCurrentThread has
@@ -97,7 +97,7 @@ class Thread;
 extern Thread *GetCurrentThreadTLS();
 extern void SetCurrentThreadTLS(Thread *thread);
 #else
-extern thread_local Thread *gCurrentThread;
+extern thread_local Thread *gCurrentThread ANGLE_HOT_TLS_MODEL;
 #endif
 
 angle::GlobalMutex &GetGlobalMutex();
@@ -174,7 +174,9 @@ ANGLE_INLINE Context *GetValidGlobalContext()
 
 // Generate a context lost error on the context if it is non-null and lost.
 void GenerateContextLostErrorOnContext(Context *context);
-void GenerateContextLostErrorOnCurrentGlobalContext();
+// Kept out of line so the no-context branch of every generated entry point stays a compact call;
+// see get_valid_context_check in generate_entry_points.py.
+ANGLE_NOINLINE void GenerateContextLostErrorOnCurrentGlobalContext();
 
 #if defined(ANGLE_FORCE_CONTEXT_CHECK_EVERY_CALL)
 // TODO(b/177574181): This should be handled in a backend-specific way.
@@ -2976,6 +2976,17 @@ void GL_APIENTRY glVertexAttribDivisorANGLE(GLuint index, GLuint divisor)
     return GL_VertexAttribDivisorANGLE(index, divisor);
 }
 
+// GL_ANGLE_lock_draws
+void GL_APIENTRY glBeginLockedDrawsANGLE()
+{
+    return GL_BeginLockedDrawsANGLE();
+}
+
+void GL_APIENTRY glEndLockedDrawsANGLE()
+{
+    return GL_EndLockedDrawsANGLE();
+}
+
 // GL_ANGLE_logic_op
 void GL_APIENTRY glLogicOpANGLE(GLenum opcode)
 {
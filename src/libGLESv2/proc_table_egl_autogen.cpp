@@ -166,6 +166,7 @@ const ProcEntry g_procTable[] = {
     {"glAttachShader", P(GL_AttachShader)},
     DESKTOP_ONLY("glBegin", GL_Begin)
     DESKTOP_ONLY("glBeginConditionalRender", GL_BeginConditionalRender)
+    {"glBeginLockedDrawsANGLE", P(GL_BeginLockedDrawsANGLE)},
     {"glBeginPerfMonitorAMD", P(GL_BeginPerfMonitorAMD)},
     {"glBeginPixelLocalStorageANGLE", P(GL_BeginPixelLocalStorageANGLE)},
     {"glBeginQuery", P(GL_BeginQuery)},
@@ -471,6 +472,7 @@ const ProcEntry g_procTable[] = {
     DESKTOP_ONLY("glEnd", GL_End)
     DESKTOP_ONLY("glEndConditionalRender", GL_EndConditionalRender)
     DESKTOP_ONLY("glEndList", GL_EndList)
+    {"glEndLockedDrawsANGLE", P(GL_EndLockedDrawsANGLE)},
     {"glEndPerfMonitorAMD", P(GL_EndPerfMonitorAMD)},
     {"glEndPixelLocalStorageANGLE", P(GL_EndPixelLocalStorageANGLE)},
     {"glEndQuery", P(GL_EndQuery)},
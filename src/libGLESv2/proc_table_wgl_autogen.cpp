@@ -47,6 +47,7 @@ const ProcEntry g_procTable[] = {
     {"glAttachShader", P(GL_AttachShader)},
     {"glBegin", P(GL_Begin)},
     {"glBeginConditionalRender", P(GL_BeginConditionalRender)},
+    {"glBeginLockedDrawsANGLE", P(GL_BeginLockedDrawsANGLE)},
     {"glBeginPerfMonitorAMD", P(GL_BeginPerfMonitorAMD)},
     {"glBeginPixelLocalStorageANGLE", P(GL_BeginPixelLocalStorageANGLE)},
     {"glBeginQuery", P(GL_BeginQuery)},
@@ -352,6 +353,7 @@ const ProcEntry g_procTable[] = {
     {"glEnd", P(GL_End)},
     {"glEndConditionalRender", P(GL_EndConditionalRender)},
     {"glEndList", P(GL_EndList)},
+    {"glEndLockedDrawsANGLE", P(GL_EndLockedDrawsANGLE)},
     {"glEndPerfMonitorAMD", P(GL_EndPerfMonitorAMD)},
     {"glEndPixelLocalStorageANGLE", P(GL_EndPixelLocalStorageANGLE)},
     {"glEndQuery", P(GL_EndQuery)},
@@ -46,6 +46,34 @@ void BitSetIteratorPerfTest<T>::step()
     mBits.reset();
 }
 
+// Same workload as BitSetIteratorPerfTest, but using the forEachSetBit callback API instead of
+// the iterator, for a direct comparison of the two traversal paths.
+template <typename T>
+class BitSetForEachPerfTest : public ANGLEPerfTest
+{
+  public:
+    BitSetForEachPerfTest();
+
+    void step() override;
+
+    T mBits;
+};
+
+template <typename T>
+BitSetForEachPerfTest<T>::BitSetForEachPerfTest()
+    : ANGLEPerfTest(::testing::UnitTest::GetInstance()->current_test_case()->name(), "", "_run", 1)
+{}
+
+template <typename T>
+void BitSetForEachPerfTest<T>::step()
+{
+    mBits.flip();
+
+    mBits.forEachSetBit([](size_t bit) { ANGLE_UNUSED_VARIABLE(bit); });
+
+    mBits.reset();
+}
+
 using TestTypes = Types<angle::BitSet32<32>,
                         angle::BitSet64<32>,
                         angle::BitSet64<64>,
@@ -72,4 +100,11 @@ TYPED_TEST(BitSetIteratorPerfTest, Run)
     this->run();
 }
 
+TYPED_TEST_SUITE(BitSetForEachPerfTest, TestTypes, BitSetIteratorTypeNames);
+
+TYPED_TEST(BitSetForEachPerfTest, Run)
+{
+    this->run();
+}
+
 }  // anonymous namespace
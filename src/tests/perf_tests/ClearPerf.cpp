@@ -35,7 +35,8 @@ struct ClearParams final : public RenderTestParams
 
         internalFormat = GL_RGBA8;
 
-        scissoredClear = false;
+        scissoredClear       = false;
+        smallScissoredClears = false;
     }
 
     std::string story() const override;
@@ -46,6 +47,9 @@ struct ClearParams final : public RenderTestParams
     GLenum internalFormat;
 
     bool scissoredClear;
+
+    // Mimics UI toolkits: an opening draw followed by many small scissored clears per frame.
+    bool smallScissoredClears;
 };
 
 std::ostream &operator<<(std::ostream &os, const ClearParams &params)
@@ -70,6 +74,11 @@ std::string ClearParams::story() const
         strstr << "_scissoredClear";
     }
 
+    if (smallScissoredClears)
+    {
+        strstr << "_smallScissoredClears";
+    }
+
     return strstr.str();
 }
 
@@ -156,7 +165,33 @@ void ClearBenchmark::drawBenchmark()
 
     startGpuTimer();
 
-    if (params.scissoredClear)
+    if (params.smallScissoredClears)
+    {
+        // Open the render pass with a draw so the scissored clears below land mid-render-pass,
+        // like UI widgets clearing their subrects between draws.
+        constexpr GLuint kClearsPerFrame = 200;
+        constexpr GLsizei kClearSize     = 64;
+
+        glDisable(GL_SCISSOR_TEST);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        glEnable(GL_SCISSOR_TEST);
+
+        const GLsizei cols = params.fboSize / kClearSize;
+        for (GLuint index = 0; index < kClearsPerFrame; ++index)
+        {
+            const GLsizei x = static_cast<GLsizei>(index % cols) * kClearSize;
+            const GLsizei y = static_cast<GLsizei>(index / cols) * kClearSize;
+            glScissor(x, y, kClearSize, kClearSize);
+
+            // Clear colors repeat in runs, as produced by toolkits clearing widget backgrounds;
+            // backends can batch runs of identical clears.
+            const float value = static_cast<float>(index / 50) * 0.25f;
+            glClearColor(value, value, 1.0f - value, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT);
+        }
+        glDisable(GL_SCISSOR_TEST);
+    }
+    else if (params.scissoredClear)
     {
         angle::RNG rng;
         const GLuint width  = params.fboSize;
@@ -225,6 +260,16 @@ ClearParams VulkanParams(bool emulatedFormat, bool scissoredClear)
     return params;
 }
 
+ClearParams VulkanSmallScissoredClearsParams()
+{
+    ClearParams params;
+    params.eglParameters        = egl_platform::VULKAN();
+    params.smallScissoredClears = true;
+    // One iteration is one clear; drawBenchmark issues 200 of them per frame.
+    params.iterationsPerStep = 200;
+    return params;
+}
+
 }  // anonymous namespace
 
 TEST_P(ClearBenchmark, Run)
@@ -238,4 +283,5 @@ ANGLE_INSTANTIATE_TEST(ClearBenchmark,
                        OpenGLOrGLESParams(),
                        VulkanParams(false, false),
                        VulkanParams(true, false),
-                       VulkanParams(false, true));
+                       VulkanParams(false, true),
+                       VulkanSmallScissoredClearsParams());
@@ -0,0 +1,477 @@
+//
+// Copyright 2022 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CorpusCompilerPerf:
+//   Shader translator throughput benchmark that replays a corpus of real shader sources instead
+//   of CompilerPerf's fixed synthetic ones.  Point ANGLE_SHADER_CORPUS_DIR at a directory with a
+//   manifest.txt (one shader file per line, *.vert sources compiled as vertex shaders, everything
+//   else as fragment); without the variable a small built-in corpus keeps the test runnable on
+//   any bot.
+//
+//   Each step replays the whole corpus across the configured worker threads.  Reported metrics:
+//   .shaders_per_second across all threads, .median_latency and .p95_latency per shader, and a
+//   phase split of .frontend_time (parse, validation and AST transforms) versus .translate_time
+//   (output generation), obtained by compiling once without and once with object code.  The
+//   translator cannot depend on the event tracer for per-pass timestamps without a layering
+//   violation, so the phase split is measured from the outside at that granularity.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "GLSLANG/ShaderLang.h"
+#include "common/string_utils.h"
+#include "common/system_utils.h"
+#include "compiler/translator/Compiler.h"
+#include "compiler/translator/InitializeGlobals.h"
+#include "compiler/translator/PoolAlloc.h"
+#include "test_utils/runner/TestSuite.h"
+#include "util/test_utils.h"
+
+namespace
+{
+struct CorpusShader
+{
+    std::string source;
+    GLenum type;
+};
+
+// Built-in fallback corpus, used when ANGLE_SHADER_CORPUS_DIR is not set.  Small but varied:
+// flat color, a texture loop, ESSL300 control flow and a skinning vertex shader.
+const char *kFallbackFlatFrag = R"(precision mediump float;
+uniform vec4 uColor;
+void main()
+{
+    gl_FragColor = uColor;
+})";
+
+const char *kFallbackLoopFrag = R"(precision highp float;
+varying vec2 vTexCoord;
+uniform sampler2D uTex;
+uniform int uTapCount;
+void main()
+{
+    vec4 accum = vec4(0.0);
+    for (int i = 0; i < 16; ++i)
+    {
+        if (i >= uTapCount)
+        {
+            break;
+        }
+        accum += texture2D(uTex, vTexCoord + vec2(float(i) * 0.01, 0.0));
+    }
+    gl_FragColor = accum / float(uTapCount);
+})";
+
+const char *kFallbackControlFlowFrag = R"(#version 300 es
+precision highp float;
+in vec2 vTexCoord;
+uniform sampler2D uTex;
+uniform int uMode;
+out vec4 oColor;
+void main()
+{
+    vec4 color = texture(uTex, vTexCoord);
+    switch (uMode)
+    {
+        case 0:
+            color.rgb = vec3(dot(color.rgb, vec3(0.299, 0.587, 0.114)));
+            break;
+        case 1:
+            color.rgb = pow(color.rgb, vec3(1.0 / 2.2));
+            break;
+        default:
+            color.rgb = 1.0 - color.rgb;
+            break;
+    }
+    oColor = color;
+})";
+
+const char *kFallbackSkinningVert = R"(#version 300 es
+in vec3 aPosition;
+in vec4 aWeights;
+in uvec4 aJoints;
+uniform mat4 uJointMatrices[32];
+uniform mat4 uViewProjection;
+out vec3 vWorldPos;
+void main()
+{
+    mat4 skin = aWeights.x * uJointMatrices[aJoints.x] +
+                aWeights.y * uJointMatrices[aJoints.y] +
+                aWeights.z * uJointMatrices[aJoints.z] +
+                aWeights.w * uJointMatrices[aJoints.w];
+    vec4 worldPos = skin * vec4(aPosition, 1.0);
+    vWorldPos     = worldPos.xyz;
+    gl_Position   = uViewProjection * worldPos;
+})";
+
+struct CorpusCompilerPerfParams
+{
+    CorpusCompilerPerfParams(ShShaderOutput output, size_t threadCount)
+        : output(output), threadCount(threadCount)
+    {
+        std::stringstream testIdStream;
+        switch (output)
+        {
+            case SH_HLSL_4_1_OUTPUT:
+                testIdStream << "HLSL_4_1";
+                break;
+            case SH_GLSL_450_CORE_OUTPUT:
+                testIdStream << "GLSL_4_50";
+                break;
+            case SH_ESSL_OUTPUT:
+                testIdStream << "ESSL";
+                break;
+            default:
+                UNREACHABLE();
+                break;
+        }
+        testIdStream << "_" << threadCount << "_threads";
+        testId = testIdStream.str();
+    }
+
+    ShShaderOutput output;
+    size_t threadCount;
+    std::string testId;
+};
+
+std::ostream &operator<<(std::ostream &stream, const CorpusCompilerPerfParams &p)
+{
+    stream << p.testId;
+    return stream;
+}
+
+class CorpusCompilerPerfTest : public ANGLEPerfTest,
+                               public ::testing::WithParamInterface<CorpusCompilerPerfParams>
+{
+  public:
+    CorpusCompilerPerfTest();
+
+    void step() override;
+
+    void SetUp() override;
+    void TearDown() override;
+
+    void reportCorpusMetrics();
+
+  private:
+    void loadCorpus();
+    void workerThread();
+
+    std::vector<CorpusShader> mCorpus;
+
+    std::vector<std::thread> mThreads;
+
+    // Steps are dispatched by bumping the generation; workers pull shader indices from the
+    // shared cursor until the corpus is exhausted, then report in.
+    std::mutex mMutex;
+    std::condition_variable mCondVar;
+    uint64_t mWorkGeneration = 0;
+    size_t mWorkersDone      = 0;
+    bool mExiting            = false;
+    std::atomic<size_t> mShaderCursor{0};
+    std::atomic<bool> mWorkerFailed{false};
+
+    // Accumulated across all trials, merged by workers under mMutex.
+    std::vector<double> mFullCompileLatencies;
+    double mTotalFrontendSeconds  = 0.0;
+    double mTotalTranslateSeconds = 0.0;
+};
+
+CorpusCompilerPerfTest::CorpusCompilerPerfTest()
+    : ANGLEPerfTest("CorpusCompilerPerf", "", GetParam().testId, 1)
+{}
+
+void CorpusCompilerPerfTest::loadCorpus()
+{
+    std::string corpusDir = angle::GetEnvironmentVar("ANGLE_SHADER_CORPUS_DIR");
+    if (!corpusDir.empty())
+    {
+        std::string manifestPath = corpusDir + angle::GetPathSeparator() + "manifest.txt";
+        std::string manifest;
+        if (!angle::ReadEntireFileToString(manifestPath.c_str(), &manifest))
+        {
+            failTest("Could not read " + manifestPath);
+            return;
+        }
+
+        std::vector<std::string> fileNames =
+            angle::SplitString(manifest, "\r\n", angle::WhitespaceHandling::TRIM_WHITESPACE,
+                               angle::SplitResult::SPLIT_WANT_NONEMPTY);
+        for (const std::string &fileName : fileNames)
+        {
+            std::string shaderPath = corpusDir + angle::GetPathSeparator() + fileName;
+            CorpusShader shader;
+            if (!angle::ReadEntireFileToString(shaderPath.c_str(), &shader.source))
+            {
+                failTest("Could not read " + shaderPath);
+                return;
+            }
+            shader.type = angle::EndsWith(fileName, ".vert") ? GL_VERTEX_SHADER
+                                                             : GL_FRAGMENT_SHADER;
+            mCorpus.push_back(std::move(shader));
+        }
+    }
+    else
+    {
+        mCorpus.push_back({kFallbackFlatFrag, GL_FRAGMENT_SHADER});
+        mCorpus.push_back({kFallbackLoopFrag, GL_FRAGMENT_SHADER});
+        mCorpus.push_back({kFallbackControlFlowFrag, GL_FRAGMENT_SHADER});
+        mCorpus.push_back({kFallbackSkinningVert, GL_VERTEX_SHADER});
+    }
+
+    if (mCorpus.empty())
+    {
+        failTest("Shader corpus is empty.");
+    }
+}
+
+void CorpusCompilerPerfTest::workerThread()
+{
+    angle::PoolAllocator allocator;
+    allocator.push();
+    SetGlobalPoolAllocator(&allocator);
+
+    ShBuiltInResources resources;
+    sh::InitBuiltInResources(&resources);
+    resources.FragmentPrecisionHigh = true;
+
+    sh::TCompiler *translators[2] = {};
+    const GLenum kStages[2]       = {GL_FRAGMENT_SHADER, GL_VERTEX_SHADER};
+    for (size_t stage = 0; stage < 2; ++stage)
+    {
+        translators[stage] =
+            sh::ConstructCompiler(kStages[stage], SH_GLES3_SPEC, GetParam().output);
+        if (translators[stage] == nullptr || !translators[stage]->Init(resources))
+        {
+            mWorkerFailed = true;
+        }
+    }
+
+    ShCompileOptions frontendOptions = {};
+    frontendOptions.variables        = true;
+
+    ShCompileOptions fullOptions              = frontendOptions;
+    fullOptions.objectCode                    = true;
+    fullOptions.initializeUninitializedLocals = true;
+    fullOptions.initOutputVariables           = true;
+
+    uint64_t lastGeneration = 0;
+
+    while (!mWorkerFailed)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCondVar.wait(lock,
+                          [&]() { return mExiting || mWorkGeneration != lastGeneration; });
+            if (mExiting)
+            {
+                break;
+            }
+            lastGeneration = mWorkGeneration;
+        }
+
+        std::vector<double> fullLatencies;
+        double frontendSeconds  = 0.0;
+        double translateSeconds = 0.0;
+        bool success            = true;
+
+        for (size_t index = mShaderCursor++; index < mCorpus.size(); index = mShaderCursor++)
+        {
+            const CorpusShader &shader  = mCorpus[index];
+            sh::TCompiler *translator   = translators[shader.type == GL_VERTEX_SHADER ? 1 : 0];
+            const char *shaderStrings[] = {shader.source.c_str()};
+
+            double start = angle::GetCurrentSystemTime();
+            success      = translator->compile(shaderStrings, 1, frontendOptions) && success;
+            const double frontendTime = angle::GetCurrentSystemTime() - start;
+
+            start   = angle::GetCurrentSystemTime();
+            success = translator->compile(shaderStrings, 1, fullOptions) && success;
+            const double fullTime = angle::GetCurrentSystemTime() - start;
+
+            fullLatencies.push_back(fullTime);
+            frontendSeconds += frontendTime;
+            translateSeconds += std::max(0.0, fullTime - frontendTime);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (!success)
+            {
+                mWorkerFailed = true;
+            }
+            mFullCompileLatencies.insert(mFullCompileLatencies.end(), fullLatencies.begin(),
+                                         fullLatencies.end());
+            mTotalFrontendSeconds += frontendSeconds;
+            mTotalTranslateSeconds += translateSeconds;
+            ++mWorkersDone;
+        }
+        mCondVar.notify_all();
+    }
+
+    for (sh::TCompiler *translator : translators)
+    {
+        SafeDelete(translator);
+    }
+    SetGlobalPoolAllocator(nullptr);
+    allocator.pop();
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        // Wake the dispatcher if it is waiting on a step this worker will never finish.
+        ++mWorkersDone;
+    }
+    mCondVar.notify_all();
+}
+
+void CorpusCompilerPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    InitializePoolIndex();
+
+    // Probe output availability on the main thread before spinning up workers.
+    {
+        angle::PoolAllocator allocator;
+        allocator.push();
+        SetGlobalPoolAllocator(&allocator);
+        ShHandle probe = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_SPEC,
+                                               GetParam().output);
+        const bool available = probe != nullptr;
+        if (available)
+        {
+            sh::Destruct(probe);
+        }
+        SetGlobalPoolAllocator(nullptr);
+        allocator.pop();
+
+        if (!available)
+        {
+            skipTest("Translator output not available in this build.");
+            return;
+        }
+    }
+
+    loadCorpus();
+    if (mSkipTest)
+    {
+        return;
+    }
+
+    for (size_t threadIndex = 0; threadIndex < GetParam().threadCount; ++threadIndex)
+    {
+        mThreads.emplace_back([this]() { workerThread(); });
+    }
+}
+
+void CorpusCompilerPerfTest::TearDown()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mExiting = true;
+    }
+    mCondVar.notify_all();
+
+    for (std::thread &thread : mThreads)
+    {
+        thread.join();
+    }
+    mThreads.clear();
+
+    FreePoolIndex();
+
+    ANGLEPerfTest::TearDown();
+}
+
+void CorpusCompilerPerfTest::step()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mShaderCursor = 0;
+        mWorkersDone  = 0;
+        ++mWorkGeneration;
+    }
+    mCondVar.notify_all();
+
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondVar.wait(lock, [&]() {
+            return mWorkersDone >= GetParam().threadCount || mWorkerFailed;
+        });
+    }
+
+    if (mWorkerFailed)
+    {
+        failTest("Worker thread compile failed.");
+    }
+}
+
+void CorpusCompilerPerfTest::reportCorpusMetrics()
+{
+    if (mFullCompileLatencies.empty())
+    {
+        return;
+    }
+
+    std::sort(mFullCompileLatencies.begin(), mFullCompileLatencies.end());
+
+    const size_t count        = mFullCompileLatencies.size();
+    const double medianLatency = mFullCompileLatencies[count / 2];
+    const double p95Latency    = mFullCompileLatencies[(count * 95) / 100];
+
+    double fullSeconds = 0.0;
+    for (double latency : mFullCompileLatencies)
+    {
+        fullSeconds += latency;
+    }
+
+    // Aggregate throughput over all threads, counting only the object-code compiles.
+    const double shadersPerSecond = static_cast<double>(count) /
+                                    (fullSeconds / static_cast<double>(GetParam().threadCount));
+
+    mReporter->RegisterImportantMetric(".shaders_per_second", "count");
+    mReporter->AddResult(".shaders_per_second", shadersPerSecond);
+    angle::TestSuite::GetInstance()->addHistogramSample(
+        mName + mBackend + ".shaders_per_second", mStory, shadersPerSecond, "count");
+
+    // processClockResult normalizes by the last trial's step count, so scale the per-shader and
+    // per-step values back up to it.
+    const double lastTrialSteps = static_cast<double>(getNumStepsPerformed());
+
+    mReporter->RegisterImportantMetric(".median_latency", "us");
+    mReporter->RegisterImportantMetric(".p95_latency", "us");
+    mReporter->RegisterImportantMetric(".frontend_time", "us");
+    mReporter->RegisterImportantMetric(".translate_time", "us");
+    processClockResult(".median_latency", medianLatency * lastTrialSteps);
+    processClockResult(".p95_latency", p95Latency * lastTrialSteps);
+    processClockResult(".frontend_time",
+                       mTotalFrontendSeconds / static_cast<double>(count) * lastTrialSteps);
+    processClockResult(".translate_time",
+                       mTotalTranslateSeconds / static_cast<double>(count) * lastTrialSteps);
+}
+
+TEST_P(CorpusCompilerPerfTest, Run)
+{
+    run();
+    reportCorpusMetrics();
+}
+
+ANGLE_INSTANTIATE_TEST(CorpusCompilerPerfTest,
+                       CorpusCompilerPerfParams(SH_HLSL_4_1_OUTPUT, 1),
+                       CorpusCompilerPerfParams(SH_HLSL_4_1_OUTPUT, 4),
+                       CorpusCompilerPerfParams(SH_GLSL_450_CORE_OUTPUT, 1),
+                       CorpusCompilerPerfParams(SH_GLSL_450_CORE_OUTPUT, 4),
+                       CorpusCompilerPerfParams(SH_ESSL_OUTPUT, 1),
+                       CorpusCompilerPerfParams(SH_ESSL_OUTPUT, 4));
+
+}  // anonymous namespace
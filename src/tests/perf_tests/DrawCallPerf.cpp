@@ -27,6 +27,7 @@ enum class StateChange
     Scissor,
     ManyTextureDraw,
     Uniform,
+    ClientArrayPointer,
     InvalidEnum,
     EnumCount = InvalidEnum,
 };
@@ -79,6 +80,9 @@ std::string DrawArraysPerfParams::story() const
         case StateChange::Uniform:
             strstr << "_uniform";
             break;
+        case StateChange::ClientArrayPointer:
+            strstr << "_client_array_pointer";
+            break;
         default:
             break;
     }
@@ -144,6 +148,8 @@ class DrawCallPerfBenchmark : public ANGLERenderTest,
     int mNumTris = GetParam().numTris;
     std::vector<GLuint> mVBOPool;
     size_t mCurrentVBO = 0;
+    std::vector<GLfloat> mPackedClientData;
+    std::vector<GLfloat> mInterleavedClientData;
 };
 
 DrawCallPerfBenchmark::DrawCallPerfBenchmark() : ANGLERenderTest("DrawCallPerf", GetParam()) {}
@@ -234,6 +240,29 @@ void main()
         mProgram1 = CompileProgram(kVS, kFS);
         ASSERT_NE(0u, mProgram1);
     }
+    else if (params.stateChange == StateChange::ClientArrayPointer)
+    {
+        mProgram1 = SetupSimpleDrawProgram();
+        ASSERT_NE(0u, mProgram1);
+
+        // The same triangles, packed tightly and interleaved with padding.  Alternating between
+        // the two layouts changes the client pointer and stride on every draw, the way legacy
+        // client-array content does.
+        for (int triIndex = 0; triIndex < mNumTris; ++triIndex)
+        {
+            GLfloat offset = static_cast<GLfloat>(triIndex) / static_cast<GLfloat>(mNumTris);
+            const GLfloat positions[6] = {offset, 1.0f, offset, 0.0f, offset + 0.01f, 0.0f};
+            for (int vertexIndex = 0; vertexIndex < 3; ++vertexIndex)
+            {
+                mPackedClientData.push_back(positions[vertexIndex * 2]);
+                mPackedClientData.push_back(positions[vertexIndex * 2 + 1]);
+                mInterleavedClientData.push_back(positions[vertexIndex * 2]);
+                mInterleavedClientData.push_back(positions[vertexIndex * 2 + 1]);
+                mInterleavedClientData.push_back(0.0f);
+                mInterleavedClientData.push_back(0.0f);
+            }
+        }
+    }
     else
     {
         mProgram1 = SetupSimpleDrawProgram();
@@ -547,6 +576,22 @@ void DrawWithEightTextures(unsigned int iterations,
     }
 }
 
+void ChangeClientArrayPointerThenDraw(unsigned int iterations,
+                                      GLsizei numElements,
+                                      const GLfloat *packedData,
+                                      const GLfloat *interleavedData)
+{
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    for (unsigned int it = 0; it < iterations; it++)
+    {
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, packedData);
+        glDrawArrays(GL_TRIANGLES, 0, numElements);
+
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(GLfloat), interleavedData);
+        glDrawArrays(GL_TRIANGLES, 0, numElements);
+    }
+}
+
 void UpdateUniformThenDraw(unsigned int iterations, GLsizei numElements)
 {
     for (unsigned int it = 0; it < iterations; it++)
@@ -613,6 +658,11 @@ void DrawCallPerfBenchmark::drawBenchmark()
         case StateChange::Uniform:
             UpdateUniformThenDraw(params.iterationsPerStep, numElements);
             break;
+        case StateChange::ClientArrayPointer:
+            ChangeClientArrayPointerThenDraw(params.iterationsPerStep, numElements,
+                                             mPackedClientData.data(),
+                                             mInterleavedClientData.data());
+            break;
         case StateChange::InvalidEnum:
             ADD_FAILURE() << "Invalid state change.";
             break;
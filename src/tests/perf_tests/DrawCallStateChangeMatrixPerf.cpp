@@ -0,0 +1,318 @@
+//
+// Copyright 2022 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DrawCallStateChangeMatrixPerf:
+//   Draw call overhead benchmark that crosses several state-change dimensions instead of varying
+//   one at a time.  DrawCallPerf covers single state changes; dirty-bit regressions in the
+//   backends tend to appear only when several kinds of state change between draws (for example a
+//   vertex array switch combined with a texture switch and a scissor change).
+//
+//   The instantiated matrix contains the no-change baseline, every single dimension, every pair
+//   of dimensions and the full combination.  Each cell is its own story in the harness's
+//   machine-readable output, so per-dimension cost is the single-dimension story minus the
+//   baseline, and the interaction cost of a combination is its story minus the sum of its
+//   dimensions' individual costs.
+//
+
+#include "ANGLEPerfTest.h"
+#include "DrawCallPerfParams.h"
+#include "test_utils/draw_call_perf_utils.h"
+#include "util/shader_utils.h"
+
+namespace
+{
+// The crossed state-change dimensions, one bit each.
+constexpr uint32_t kDimVertexArray = 1 << 0;
+constexpr uint32_t kDimTexture     = 1 << 1;
+constexpr uint32_t kDimProgram     = 1 << 2;
+constexpr uint32_t kDimScissor     = 1 << 3;
+constexpr uint32_t kDimUniform     = 1 << 4;
+constexpr uint32_t kDimCount       = 5;
+constexpr uint32_t kAllDims        = (1 << kDimCount) - 1;
+
+struct DrawCallMatrixParams final : public DrawCallPerfParams
+{
+    DrawCallMatrixParams()
+    {
+        // Vertex array objects require ES 3.0.
+        majorVersion = 3;
+        minorVersion = 0;
+    }
+
+    std::string story() const override;
+
+    uint32_t stateChangeMask = 0;
+};
+
+std::string DrawCallMatrixParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << DrawCallPerfParams::story();
+
+    if (stateChangeMask == 0)
+    {
+        strstr << "_baseline";
+    }
+    if ((stateChangeMask & kDimVertexArray) != 0)
+    {
+        strstr << "_vao";
+    }
+    if ((stateChangeMask & kDimTexture) != 0)
+    {
+        strstr << "_tex";
+    }
+    if ((stateChangeMask & kDimProgram) != 0)
+    {
+        strstr << "_prog";
+    }
+    if ((stateChangeMask & kDimScissor) != 0)
+    {
+        strstr << "_scissor";
+    }
+    if ((stateChangeMask & kDimUniform) != 0)
+    {
+        strstr << "_uni";
+    }
+
+    return strstr.str();
+}
+
+std::ostream &operator<<(std::ostream &os, const DrawCallMatrixParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+GLuint CreateColorTexture2D(GLubyte r, GLubyte g, GLubyte b)
+{
+    GLuint texture;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+
+    const GLubyte pixel[4] = {r, g, b, 255};
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    return texture;
+}
+
+class DrawCallStateChangeMatrixBenchmark
+    : public ANGLERenderTest,
+      public ::testing::WithParamInterface<DrawCallMatrixParams>
+{
+  public:
+    DrawCallStateChangeMatrixBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mPrograms[2]        = {};
+    GLint mUniformLocations[2] = {};
+    GLuint mBuffers[2]         = {};
+    GLuint mVertexArrays[2]    = {};
+    GLuint mTextures[2]        = {};
+    int mNumTris               = GetParam().numTris;
+};
+
+DrawCallStateChangeMatrixBenchmark::DrawCallStateChangeMatrixBenchmark()
+    : ANGLERenderTest("DrawCallStateChangeMatrixPerf", GetParam())
+{}
+
+void DrawCallStateChangeMatrixBenchmark::initializeBenchmark()
+{
+    const auto &params = GetParam();
+
+    // Both programs use the same attribute layout, a sampler and a vec4 uniform, so every
+    // dimension composes with every other.  The second program differs enough to require a
+    // pipeline change.
+    constexpr char kVS[] = R"(attribute vec2 vPosition;
+varying vec2 v_texCoord;
+void main()
+{
+    gl_Position = vec4(vPosition, 0, 1);
+    v_texCoord = vPosition * 0.5 + 0.5;
+})";
+
+    constexpr char kFS1[] = R"(precision mediump float;
+varying vec2 v_texCoord;
+uniform sampler2D tex;
+uniform vec4 uni;
+void main()
+{
+    gl_FragColor = texture2D(tex, v_texCoord) + uni;
+})";
+
+    constexpr char kFS2[] = R"(precision mediump float;
+varying vec2 v_texCoord;
+uniform sampler2D tex;
+uniform vec4 uni;
+void main()
+{
+    gl_FragColor = texture2D(tex, v_texCoord) * uni;
+})";
+
+    mPrograms[0] = CompileProgram(kVS, kFS1);
+    ASSERT_NE(0u, mPrograms[0]);
+    mPrograms[1] = CompileProgram(kVS, kFS2);
+    ASSERT_NE(0u, mPrograms[1]);
+
+    for (size_t programIndex = 0; programIndex < 2; ++programIndex)
+    {
+        glBindAttribLocation(mPrograms[programIndex], 0, "vPosition");
+        glLinkProgram(mPrograms[programIndex]);
+
+        glUseProgram(mPrograms[programIndex]);
+        glUniform1i(glGetUniformLocation(mPrograms[programIndex], "tex"), 0);
+        mUniformLocations[programIndex] = glGetUniformLocation(mPrograms[programIndex], "uni");
+        ASSERT_NE(-1, mUniformLocations[programIndex]);
+    }
+
+    glGenVertexArrays(2, mVertexArrays);
+    for (size_t bufferIndex = 0; bufferIndex < 2; ++bufferIndex)
+    {
+        mBuffers[bufferIndex] = Create2DTriangleBuffer(mNumTris, GL_STATIC_DRAW);
+
+        glBindVertexArray(mVertexArrays[bufferIndex]);
+        glBindBuffer(GL_ARRAY_BUFFER, mBuffers[bufferIndex]);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+        glEnableVertexAttribArray(0);
+    }
+
+    mTextures[0] = CreateColorTexture2D(255, 0, 0);
+    mTextures[1] = CreateColorTexture2D(0, 255, 0);
+
+    // Static bindings for the dimensions that do not change during the test.
+    glUseProgram(mPrograms[0]);
+    glBindVertexArray(mVertexArrays[0]);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, mTextures[0]);
+
+    if ((params.stateChangeMask & kDimScissor) != 0)
+    {
+        glEnable(GL_SCISSOR_TEST);
+    }
+
+    glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void DrawCallStateChangeMatrixBenchmark::destroyBenchmark()
+{
+    glDeleteProgram(mPrograms[0]);
+    glDeleteProgram(mPrograms[1]);
+    glDeleteBuffers(2, mBuffers);
+    glDeleteVertexArrays(2, mVertexArrays);
+    glDeleteTextures(2, mTextures);
+}
+
+void DrawCallStateChangeMatrixBenchmark::drawBenchmark()
+{
+    const auto &params        = GetParam();
+    const uint32_t mask       = params.stateChangeMask;
+    const GLsizei numElements = static_cast<GLsizei>(3 * mNumTris);
+    const unsigned int width  = getWindow()->getWidth();
+    const unsigned int height = getWindow()->getHeight();
+
+    size_t programIndex = 0;
+
+    for (unsigned int it = 0; it < params.iterationsPerStep; ++it)
+    {
+        const size_t alternate = it & 1;
+
+        if ((mask & kDimVertexArray) != 0)
+        {
+            glBindVertexArray(mVertexArrays[alternate]);
+        }
+        if ((mask & kDimTexture) != 0)
+        {
+            glBindTexture(GL_TEXTURE_2D, mTextures[alternate]);
+        }
+        if ((mask & kDimProgram) != 0)
+        {
+            programIndex = alternate;
+            glUseProgram(mPrograms[programIndex]);
+        }
+        if ((mask & kDimUniform) != 0)
+        {
+            const float f =
+                static_cast<float>(it) / static_cast<float>(params.iterationsPerStep);
+            glUniform4f(mUniformLocations[programIndex], f, f, f, f);
+        }
+        if ((mask & kDimScissor) != 0)
+        {
+            if (alternate == 0)
+            {
+                glScissor(0, 0, width / 2, height);
+            }
+            else
+            {
+                glScissor(0, 0, width, height / 2);
+            }
+        }
+
+        glDrawArrays(GL_TRIANGLES, 0, numElements);
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+TEST_P(DrawCallStateChangeMatrixBenchmark, Run)
+{
+    run();
+}
+
+using namespace params;
+using P = DrawCallMatrixParams;
+
+P ApplyStateChangeMask(const P &in, uint32_t stateChangeMask)
+{
+    P out             = in;
+    out.stateChangeMask = stateChangeMask;
+    return out;
+}
+
+std::vector<uint32_t> GetStateChangeMasks()
+{
+    std::vector<uint32_t> masks;
+
+    // The no-change baseline and each dimension on its own, for per-dimension attribution.
+    masks.push_back(0);
+    for (uint32_t dim = 0; dim < kDimCount; ++dim)
+    {
+        masks.push_back(1u << dim);
+    }
+
+    // Every pair of dimensions, to expose interaction costs.
+    for (uint32_t dim1 = 0; dim1 < kDimCount; ++dim1)
+    {
+        for (uint32_t dim2 = dim1 + 1; dim2 < kDimCount; ++dim2)
+        {
+            masks.push_back((1u << dim1) | (1u << dim2));
+        }
+    }
+
+    // The combination most often seen regressing in the wild, and everything at once.
+    masks.push_back(kDimVertexArray | kDimTexture | kDimScissor);
+    masks.push_back(kAllDims);
+
+    return masks;
+}
+
+std::vector<P> gTestsWithMask =
+    CombineWithValues({P()}, GetStateChangeMasks(), ApplyStateChangeMask);
+std::vector<P> gTestsWithRenderer =
+    CombineWithFuncs(gTestsWithMask, {D3D11<P>, GL<P>, Metal<P>, Vulkan<P>});
+std::vector<P> gTestsWithDevice =
+    CombineWithFuncs(gTestsWithRenderer, {Passthrough<P>, NullDevice<P>});
+
+ANGLE_INSTANTIATE_TEST_ARRAY(DrawCallStateChangeMatrixBenchmark, gTestsWithDevice);
+
+}  // anonymous namespace
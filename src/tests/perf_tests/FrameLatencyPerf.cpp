@@ -0,0 +1,199 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FrameLatencyPerf:
+//   End-to-end swap-path latency benchmark.  Samples the EGL_ANGLE_frame_profile history every
+//   frame and reports p50/p95/p99 of the time spent waiting for a swapchain image, throttling on
+//   earlier frames' completion and inside the present call.  Unlike the throughput benchmarks,
+//   this gives frame pacing changes a regression harness for latency.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+#include "util/EGLWindow.h"
+#include "util/shader_utils.h"
+
+using namespace angle;
+
+namespace
+{
+struct FrameLatencyParams final : public RenderTestParams
+{
+    FrameLatencyParams()
+    {
+        iterationsPerStep = 1;
+
+        windowWidth  = 256;
+        windowHeight = 256;
+    }
+
+    std::string story() const override { return RenderTestParams::story(); }
+};
+
+std::ostream &operator<<(std::ostream &os, const FrameLatencyParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+class FrameLatencyBenchmark : public ANGLERenderTest,
+                              public ::testing::WithParamInterface<FrameLatencyParams>
+{
+  public:
+    FrameLatencyBenchmark() : ANGLERenderTest("FrameLatency", GetParam()) {}
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+    void reportPercentiles();
+
+  private:
+    void collectNewRecords();
+    void reportMetricPercentiles(const char *metric, std::vector<uint64_t> *samplesNs);
+
+    GLuint mProgram                          = 0;
+    const ANGLEFrameProfileHistory *mHistory = nullptr;
+    uint64_t mConsumedRecords                = 0;
+
+    std::vector<uint64_t> mAcquireWaitNs;
+    std::vector<uint64_t> mThrottleWaitNs;
+    std::vector<uint64_t> mPresentCallNs;
+};
+
+void FrameLatencyBenchmark::initializeBenchmark()
+{
+    EGLWindow *window  = static_cast<EGLWindow *>(getGLWindow());
+    EGLDisplay display = window->getDisplay();
+
+    const char *extensions = eglQueryString(display, EGL_EXTENSIONS);
+    if (extensions == nullptr || strstr(extensions, "EGL_ANGLE_frame_profile") == nullptr)
+    {
+        skipTest("EGL_ANGLE_frame_profile not supported");
+        return;
+    }
+
+    PFNEGLQUERYSURFACEPOINTERANGLEPROC querySurfacePointer =
+        reinterpret_cast<PFNEGLQUERYSURFACEPOINTERANGLEPROC>(
+            eglGetProcAddress("eglQuerySurfacePointerANGLE"));
+    ASSERT_NE(nullptr, querySurfacePointer);
+
+    void *history = nullptr;
+    querySurfacePointer(display, window->getSurface(), EGL_FRAME_PROFILE_HISTORY_ANGLE, &history);
+    ASSERT_NE(nullptr, history);
+    mHistory = static_cast<const ANGLEFrameProfileHistory *>(history);
+
+    // Frames are kept deliberately cheap so the swap path dominates what is measured.
+    constexpr char kVS[] = R"(void main()
+{
+    gl_Position = vec4(0, 0, 0, 1);
+})";
+
+    constexpr char kFS[] = R"(precision mediump float;
+void main()
+{
+    gl_FragColor = vec4(0);
+})";
+
+    mProgram = CompileProgram(kVS, kFS);
+    ASSERT_NE(0u, mProgram);
+    glUseProgram(mProgram);
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void FrameLatencyBenchmark::destroyBenchmark()
+{
+    glDeleteProgram(mProgram);
+}
+
+void FrameLatencyBenchmark::drawBenchmark()
+{
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+    collectNewRecords();
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void FrameLatencyBenchmark::collectNewRecords()
+{
+    // Records are written at present, so at this point the previous frame's record is available.
+    // The ring only keeps the last EGL_FRAME_PROFILE_HISTORY_SIZE_ANGLE frames; sampling every
+    // frame keeps up comfortably, but guard against overwritten entries regardless.
+    const uint64_t recordCount = mHistory->recordCount;
+    uint64_t firstRecord       = mConsumedRecords;
+    if (recordCount > firstRecord + EGL_FRAME_PROFILE_HISTORY_SIZE_ANGLE)
+    {
+        firstRecord = recordCount - EGL_FRAME_PROFILE_HISTORY_SIZE_ANGLE;
+    }
+
+    for (uint64_t index = firstRecord; index < recordCount; ++index)
+    {
+        const ANGLEFrameProfileRecord &record =
+            mHistory->records[index % EGL_FRAME_PROFILE_HISTORY_SIZE_ANGLE];
+        mAcquireWaitNs.push_back(record.acquireImageWaitNs);
+        mThrottleWaitNs.push_back(record.swapThrottleWaitNs);
+        mPresentCallNs.push_back(record.presentCallNs);
+    }
+    mConsumedRecords = recordCount;
+}
+
+void FrameLatencyBenchmark::reportMetricPercentiles(const char *metric,
+                                                    std::vector<uint64_t> *samplesNs)
+{
+    if (samplesNs->empty())
+    {
+        return;
+    }
+
+    std::sort(samplesNs->begin(), samplesNs->end());
+
+    constexpr double kPercentiles[]       = {0.50, 0.95, 0.99};
+    constexpr const char *kSuffixes[]     = {"_p50", "_p95", "_p99"};
+    constexpr double kMicrosecondsPerNano = 1e-3;
+
+    for (size_t index = 0; index < ArraySize(kPercentiles); ++index)
+    {
+        const size_t sampleIndex =
+            std::min(static_cast<size_t>(kPercentiles[index] * samplesNs->size()),
+                     samplesNs->size() - 1);
+        const std::string name = std::string(metric) + kSuffixes[index];
+        mReporter->RegisterImportantMetric(name, "us");
+        mReporter->AddResult(name,
+                             static_cast<double>((*samplesNs)[sampleIndex]) * kMicrosecondsPerNano);
+    }
+}
+
+void FrameLatencyBenchmark::reportPercentiles()
+{
+    reportMetricPercentiles(".acquire_wait", &mAcquireWaitNs);
+    reportMetricPercentiles(".throttle_wait", &mThrottleWaitNs);
+    reportMetricPercentiles(".present_call", &mPresentCallNs);
+}
+
+FrameLatencyParams VulkanParams()
+{
+    FrameLatencyParams params;
+    params.eglParameters = egl_platform::VULKAN();
+    return params;
+}
+
+}  // anonymous namespace
+
+TEST_P(FrameLatencyBenchmark, Run)
+{
+    run();
+    reportPercentiles();
+}
+
+ANGLE_INSTANTIATE_TEST(FrameLatencyBenchmark, VulkanParams());
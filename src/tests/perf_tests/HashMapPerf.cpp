@@ -0,0 +1,108 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// HashMapPerf:
+//   Compares lookup performance of the map types used for hot caches
+//   (std::unordered_map, angle::HashMap and angle::FlatUnorderedMap) at
+//   typical cache working-set sizes.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <gmock/gmock.h>
+
+#include <unordered_map>
+
+#include "common/FastVector.h"
+#include "common/angleutils.h"
+
+using namespace testing;
+
+namespace
+{
+// Roughly the population of a warmed-up per-context cache (samplers, render
+// passes, framebuffers).
+constexpr size_t kWorkingSetSize = 64;
+
+// A simple LCG keeps the keys deterministic but not sequential.
+constexpr uint64_t NextKey(uint64_t key)
+{
+    return key * 6364136223846793005ull + 1442695040888963407ull;
+}
+
+template <typename T>
+class HashMapPerfTest : public ANGLEPerfTest
+{
+  public:
+    HashMapPerfTest();
+
+    void step() override;
+
+    T mMap;
+    std::vector<uint64_t> mPresentKeys;
+    std::vector<uint64_t> mMissingKeys;
+    uint64_t mAccumulator = 0;
+};
+
+template <typename T>
+HashMapPerfTest<T>::HashMapPerfTest()
+    : ANGLEPerfTest(::testing::UnitTest::GetInstance()->current_test_case()->name(), "", "_run", 1)
+{
+    uint64_t key = 0x9E3779B97F4A7C15ull;
+    for (size_t i = 0; i < kWorkingSetSize; ++i)
+    {
+        key = NextKey(key);
+        mMap[key] = key;
+        mPresentKeys.push_back(key);
+        key = NextKey(key);
+        mMissingKeys.push_back(key);
+    }
+}
+
+template <typename T>
+void HashMapPerfTest<T>::step()
+{
+    // Mix hits and misses; both show up in cache lookups.
+    for (uint64_t key : mPresentKeys)
+    {
+        auto it = mMap.find(key);
+        if (it != mMap.end())
+        {
+            mAccumulator += it->second;
+        }
+    }
+    for (uint64_t key : mMissingKeys)
+    {
+        if (mMap.find(key) != mMap.end())
+        {
+            mAccumulator += 1;
+        }
+    }
+}
+
+using TestTypes = Types<std::unordered_map<uint64_t, uint64_t>,
+                        angle::HashMap<uint64_t, uint64_t>,
+                        angle::FlatUnorderedMap<uint64_t, uint64_t, kWorkingSetSize>>;
+
+constexpr char kTestTypeNames[][100] = {"UnorderedMap", "HashMap", "FlatUnorderedMap"};
+
+class HashMapTypeNames
+{
+  public:
+    template <typename MapType>
+    static std::string GetName(int typeIndex)
+    {
+        return kTestTypeNames[typeIndex];
+    }
+};
+
+TYPED_TEST_SUITE(HashMapPerfTest, TestTypes, HashMapTypeNames);
+
+TYPED_TEST(HashMapPerfTest, Run)
+{
+    this->run();
+}
+
+}  // anonymous namespace
@@ -0,0 +1,500 @@
+//
+// Copyright 2022 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryFootprintPerf:
+//   Tracks ANGLE's own memory footprint under representative workloads: many programs, many
+//   textures, buffer churn and a deep framebuffer chain.  Besides the harness's process-level
+//   .memory_median/.memory_max metrics, on backends that expose GL_AMD_performance_monitor the
+//   test reports per-subsystem peak bytes (pipeline cache, descriptor set cache keys, buffer
+//   pools) as sizeInBytes metrics, so a regression in one subsystem is attributable from the
+//   dashboard instead of showing up only as unexplained process growth.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+#include "common/debug.h"
+#include "test_utils/draw_call_perf_utils.h"
+#include "test_utils/runner/TestSuite.h"
+#include "util/shader_utils.h"
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 8;
+
+constexpr size_t kNumPrograms     = 64;
+constexpr size_t kNumTextures     = 128;
+constexpr size_t kTextureSize     = 64;
+constexpr size_t kNumBuffers      = 16;
+constexpr size_t kNumFramebuffers = 8;
+constexpr size_t kFramebufferSize = 512;
+
+enum class Workload
+{
+    ManyPrograms,
+    ManyTextures,
+    BufferChurn,
+    DeepFramebuffers,
+};
+
+const char *WorkloadToString(Workload workload)
+{
+    switch (workload)
+    {
+        case Workload::ManyPrograms:
+            return "many_programs";
+        case Workload::ManyTextures:
+            return "many_textures";
+        case Workload::BufferChurn:
+            return "buffer_churn";
+        case Workload::DeepFramebuffers:
+            return "deep_framebuffers";
+        default:
+            UNREACHABLE();
+            return "";
+    }
+}
+
+struct MemoryFootprintParams final : public RenderTestParams
+{
+    MemoryFootprintParams()
+    {
+        iterationsPerStep = kIterationsPerStep;
+
+        majorVersion = 2;
+        minorVersion = 0;
+        windowWidth  = 512;
+        windowHeight = 512;
+    }
+
+    std::string story() const override;
+
+    Workload workload = Workload::ManyPrograms;
+};
+
+std::ostream &operator<<(std::ostream &os, const MemoryFootprintParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+std::string MemoryFootprintParams::story() const
+{
+    std::stringstream strstr;
+    strstr << RenderTestParams::story() << "_" << WorkloadToString(workload);
+    return strstr.str();
+}
+
+class MemoryFootprintBenchmark : public ANGLERenderTest,
+                                 public ::testing::WithParamInterface<MemoryFootprintParams>
+{
+  public:
+    MemoryFootprintBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+    void reportSubsystemFootprint();
+
+  private:
+    void initManyPrograms();
+    void initManyTextures();
+    void initBufferChurn();
+    void initDeepFramebuffers();
+
+    void sampleSubsystemCounters();
+    void reportSizeMetric(const char *metric, uint64_t bytes);
+
+    std::vector<GLuint> mPrograms;
+    std::vector<GLuint> mTextures;
+    std::vector<GLuint> mBuffers;
+    std::vector<GLuint> mFramebuffers;
+    std::vector<GLuint> mRenderbuffers;
+    GLuint mVertexBuffer = 0;
+    std::vector<float> mChurnData;
+
+    // Subsystem byte counters are sampled every step; the reported value is the peak, which is
+    // what a CI threshold should bound.
+    CounterNameToIndexMap mCounterIndexMap;
+    uint64_t mMaxPipelineCacheSizeBytes         = 0;
+    uint64_t mMaxDescriptorSetCacheKeySizeBytes = 0;
+    uint64_t mMaxBufferPoolTotalMemorySize      = 0;
+    uint64_t mMaxBufferPoolUnusedMemorySize     = 0;
+};
+
+MemoryFootprintBenchmark::MemoryFootprintBenchmark()
+    : ANGLERenderTest("MemoryFootprintPerf", GetParam())
+{}
+
+void MemoryFootprintBenchmark::initializeBenchmark()
+{
+    switch (GetParam().workload)
+    {
+        case Workload::ManyPrograms:
+            initManyPrograms();
+            break;
+        case Workload::ManyTextures:
+            initManyTextures();
+            break;
+        case Workload::BufferChurn:
+            initBufferChurn();
+            break;
+        case Workload::DeepFramebuffers:
+            initDeepFramebuffers();
+            break;
+    }
+
+    glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+
+    if (IsGLExtensionEnabled("GL_AMD_performance_monitor"))
+    {
+        mCounterIndexMap = BuildCounterNameToIndexMap();
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void MemoryFootprintBenchmark::initManyPrograms()
+{
+    constexpr char kVS[] = R"(attribute vec2 vPosition;
+void main()
+{
+    gl_Position = vec4(vPosition, 0, 1);
+})";
+
+    // Each program folds a distinct constant into its fragment shader so no shader or pipeline
+    // cache can deduplicate them; every program contributes its own cache entries.
+    for (size_t programIndex = 0; programIndex < kNumPrograms; ++programIndex)
+    {
+        std::stringstream fsStream;
+        fsStream << "precision mediump float;\n"
+                 << "void main()\n"
+                 << "{\n"
+                 << "    gl_FragColor = vec4(" << static_cast<float>(programIndex) / kNumPrograms
+                 << ", 0.0, 0.0, 1.0);\n"
+                 << "}\n";
+
+        GLuint program = CompileProgram(kVS, fsStream.str().c_str());
+        ASSERT_NE(0u, program);
+        glBindAttribLocation(program, 0, "vPosition");
+        glLinkProgram(program);
+        mPrograms.push_back(program);
+    }
+
+    mVertexBuffer = Create2DTriangleBuffer(1, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(0);
+}
+
+void MemoryFootprintBenchmark::initManyTextures()
+{
+    constexpr char kVS[] = R"(attribute vec2 vPosition;
+varying vec2 v_texCoord;
+void main()
+{
+    gl_Position = vec4(vPosition, 0, 1);
+    v_texCoord = vPosition * 0.5 + 0.5;
+})";
+
+    constexpr char kFS[] = R"(precision mediump float;
+varying vec2 v_texCoord;
+uniform sampler2D tex;
+void main()
+{
+    gl_FragColor = texture2D(tex, v_texCoord);
+})";
+
+    GLuint program = CompileProgram(kVS, kFS);
+    ASSERT_NE(0u, program);
+    glBindAttribLocation(program, 0, "vPosition");
+    glLinkProgram(program);
+    glUseProgram(program);
+    glUniform1i(glGetUniformLocation(program, "tex"), 0);
+    mPrograms.push_back(program);
+
+    std::vector<GLubyte> textureData(kTextureSize * kTextureSize * 4);
+    for (size_t textureIndex = 0; textureIndex < kNumTextures; ++textureIndex)
+    {
+        std::fill(textureData.begin(), textureData.end(),
+                  static_cast<GLubyte>(textureIndex & 0xFF));
+
+        GLuint texture;
+        glGenTextures(1, &texture);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kTextureSize, kTextureSize, 0, GL_RGBA,
+                     GL_UNSIGNED_BYTE, textureData.data());
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        mTextures.push_back(texture);
+    }
+
+    mVertexBuffer = Create2DTriangleBuffer(1, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(0);
+    glActiveTexture(GL_TEXTURE0);
+}
+
+void MemoryFootprintBenchmark::initBufferChurn()
+{
+    GLuint program = SetupSimpleDrawProgram();
+    ASSERT_NE(0u, program);
+    mPrograms.push_back(program);
+
+    // Each buffer holds a triangle list that gets orphaned and refilled every step, exercising
+    // the staging buffers and the suballocator's buffer pools.
+    constexpr size_t kTrisPerBuffer = 1024;
+    mChurnData.reserve(kTrisPerBuffer * 6);
+    for (size_t tri = 0; tri < kTrisPerBuffer; ++tri)
+    {
+        mChurnData.push_back(0.0f);
+        mChurnData.push_back(1.0f);
+        mChurnData.push_back(-1.0f);
+        mChurnData.push_back(-1.0f);
+        mChurnData.push_back(1.0f);
+        mChurnData.push_back(-1.0f);
+    }
+
+    for (size_t bufferIndex = 0; bufferIndex < kNumBuffers; ++bufferIndex)
+    {
+        GLuint buffer;
+        glGenBuffers(1, &buffer);
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        glBufferData(GL_ARRAY_BUFFER, mChurnData.size() * sizeof(float), mChurnData.data(),
+                     GL_DYNAMIC_DRAW);
+        mBuffers.push_back(buffer);
+    }
+
+    glEnableVertexAttribArray(0);
+}
+
+void MemoryFootprintBenchmark::initDeepFramebuffers()
+{
+    GLuint program = SetupSimpleDrawProgram();
+    ASSERT_NE(0u, program);
+    mPrograms.push_back(program);
+
+    // A chain of offscreen render targets stands in for a deep swapchain; the harness does not
+    // control the real swapchain depth.
+    for (size_t framebufferIndex = 0; framebufferIndex < kNumFramebuffers; ++framebufferIndex)
+    {
+        GLuint renderbuffer;
+        glGenRenderbuffers(1, &renderbuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, renderbuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA4, kFramebufferSize, kFramebufferSize);
+        mRenderbuffers.push_back(renderbuffer);
+
+        GLuint framebuffer;
+        glGenFramebuffers(1, &framebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER,
+                                  renderbuffer);
+        ASSERT_EQ(static_cast<GLenum>(GL_FRAMEBUFFER_COMPLETE),
+                  glCheckFramebufferStatus(GL_FRAMEBUFFER));
+        mFramebuffers.push_back(framebuffer);
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    mVertexBuffer = Create2DTriangleBuffer(1, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(0);
+}
+
+void MemoryFootprintBenchmark::destroyBenchmark()
+{
+    for (GLuint program : mPrograms)
+    {
+        glDeleteProgram(program);
+    }
+    if (!mTextures.empty())
+    {
+        glDeleteTextures(static_cast<GLsizei>(mTextures.size()), mTextures.data());
+    }
+    if (!mBuffers.empty())
+    {
+        glDeleteBuffers(static_cast<GLsizei>(mBuffers.size()), mBuffers.data());
+    }
+    if (!mFramebuffers.empty())
+    {
+        glDeleteFramebuffers(static_cast<GLsizei>(mFramebuffers.size()), mFramebuffers.data());
+    }
+    if (!mRenderbuffers.empty())
+    {
+        glDeleteRenderbuffers(static_cast<GLsizei>(mRenderbuffers.size()), mRenderbuffers.data());
+    }
+    if (mVertexBuffer != 0)
+    {
+        glDeleteBuffers(1, &mVertexBuffer);
+    }
+}
+
+void MemoryFootprintBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    for (unsigned int it = 0; it < params.iterationsPerStep; ++it)
+    {
+        switch (params.workload)
+        {
+            case Workload::ManyPrograms:
+                for (GLuint program : mPrograms)
+                {
+                    glUseProgram(program);
+                    glDrawArrays(GL_TRIANGLES, 0, 3);
+                }
+                break;
+
+            case Workload::ManyTextures:
+                for (GLuint texture : mTextures)
+                {
+                    glBindTexture(GL_TEXTURE_2D, texture);
+                    glDrawArrays(GL_TRIANGLES, 0, 3);
+                }
+                break;
+
+            case Workload::BufferChurn:
+                for (GLuint buffer : mBuffers)
+                {
+                    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+                    glBufferData(GL_ARRAY_BUFFER, mChurnData.size() * sizeof(float), nullptr,
+                                 GL_DYNAMIC_DRAW);
+                    glBufferSubData(GL_ARRAY_BUFFER, 0, mChurnData.size() * sizeof(float),
+                                    mChurnData.data());
+                    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+                    glDrawArrays(GL_TRIANGLES, 0, 3);
+                }
+                break;
+
+            case Workload::DeepFramebuffers:
+                for (GLuint framebuffer : mFramebuffers)
+                {
+                    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+                    glViewport(0, 0, kFramebufferSize, kFramebufferSize);
+                    glClear(GL_COLOR_BUFFER_BIT);
+                    glDrawArrays(GL_TRIANGLES, 0, 3);
+                }
+                glBindFramebuffer(GL_FRAMEBUFFER, 0);
+                glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
+                break;
+        }
+    }
+
+    sampleSubsystemCounters();
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void MemoryFootprintBenchmark::sampleSubsystemCounters()
+{
+    if (mCounterIndexMap.empty())
+    {
+        return;
+    }
+
+    const angle::VulkanPerfCounters counters = GetPerfCounters(mCounterIndexMap);
+
+    mMaxPipelineCacheSizeBytes =
+        std::max(mMaxPipelineCacheSizeBytes, counters.pipelineCacheSizeBytes);
+    mMaxDescriptorSetCacheKeySizeBytes =
+        std::max(mMaxDescriptorSetCacheKeySizeBytes, counters.descriptorSetCacheKeySizeBytes);
+    mMaxBufferPoolTotalMemorySize =
+        std::max(mMaxBufferPoolTotalMemorySize, counters.bufferPoolTotalMemorySize);
+    mMaxBufferPoolUnusedMemorySize =
+        std::max(mMaxBufferPoolUnusedMemorySize, counters.bufferPoolUnusedMemorySize);
+}
+
+void MemoryFootprintBenchmark::reportSizeMetric(const char *metric, uint64_t bytes)
+{
+    perf_test::MetricInfo metricInfo;
+    if (!mReporter->GetMetricInfo(metric, &metricInfo))
+    {
+        mReporter->RegisterImportantMetric(metric, "sizeInBytes");
+    }
+
+    mReporter->AddResult(metric, static_cast<size_t>(bytes));
+
+    angle::TestSuite::GetInstance()->addHistogramSample(mName + mBackend + metric, mStory,
+                                                        static_cast<double>(bytes),
+                                                        "sizeInBytes_smallerIsBetter");
+}
+
+void MemoryFootprintBenchmark::reportSubsystemFootprint()
+{
+    if (mCounterIndexMap.empty())
+    {
+        return;
+    }
+
+    reportSizeMetric(".pipeline_cache_size", mMaxPipelineCacheSizeBytes);
+    reportSizeMetric(".descriptor_set_cache_key_size", mMaxDescriptorSetCacheKeySizeBytes);
+    reportSizeMetric(".buffer_pool_size", mMaxBufferPoolTotalMemorySize);
+    reportSizeMetric(".buffer_pool_unused_size", mMaxBufferPoolUnusedMemorySize);
+}
+
+TEST_P(MemoryFootprintBenchmark, Run)
+{
+    run();
+    reportSubsystemFootprint();
+}
+
+MemoryFootprintParams D3D11Params(Workload workload)
+{
+    MemoryFootprintParams params;
+    params.eglParameters = egl_platform::D3D11_NULL();
+    params.workload      = workload;
+    return params;
+}
+
+MemoryFootprintParams MetalParams(Workload workload)
+{
+    MemoryFootprintParams params;
+    params.eglParameters = egl_platform::METAL();
+    params.workload      = workload;
+    return params;
+}
+
+MemoryFootprintParams OpenGLOrGLESParams(Workload workload)
+{
+    MemoryFootprintParams params;
+    params.eglParameters = egl_platform::OPENGL_OR_GLES_NULL();
+    params.workload      = workload;
+    return params;
+}
+
+MemoryFootprintParams VulkanParams(Workload workload)
+{
+    MemoryFootprintParams params;
+    params.eglParameters = egl_platform::VULKAN_NULL();
+    params.workload      = workload;
+    return params;
+}
+
+ANGLE_INSTANTIATE_TEST(MemoryFootprintBenchmark,
+                       D3D11Params(Workload::ManyPrograms),
+                       D3D11Params(Workload::ManyTextures),
+                       D3D11Params(Workload::BufferChurn),
+                       D3D11Params(Workload::DeepFramebuffers),
+                       MetalParams(Workload::ManyPrograms),
+                       MetalParams(Workload::ManyTextures),
+                       MetalParams(Workload::BufferChurn),
+                       MetalParams(Workload::DeepFramebuffers),
+                       OpenGLOrGLESParams(Workload::ManyPrograms),
+                       OpenGLOrGLESParams(Workload::ManyTextures),
+                       OpenGLOrGLESParams(Workload::BufferChurn),
+                       OpenGLOrGLESParams(Workload::DeepFramebuffers),
+                       VulkanParams(Workload::ManyPrograms),
+                       VulkanParams(Workload::ManyTextures),
+                       VulkanParams(Workload::BufferChurn),
+                       VulkanParams(Workload::DeepFramebuffers));
+
+}  // anonymous namespace
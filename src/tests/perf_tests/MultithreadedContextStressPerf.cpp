@@ -0,0 +1,417 @@
+//
+// Copyright 2022 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MultithreadedContextStressPerf:
+//   Stress benchmark for simultaneous GL on several contexts of one share group.  Worker threads
+//   concurrently upload textures, compile programs and issue draws, which funnels them through
+//   the share group's and resource managers' locks.  Each step runs one synchronized batch on
+//   every thread, so .wall_time is the per-batch cost under contention and scaling across the
+//   thread-count stories shows how close each backend gets to linear.
+//
+//   The reported .lock_wait_time is the per-batch thread time in excess of the single-threaded
+//   cost of the same work, measured at startup on the main context.  Timing the internal mutexes
+//   directly would put a clock read in the per-call hot path and perturb exactly what this test
+//   is meant to watch, so serialization is derived from the outside instead.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "common/debug.h"
+#include "common/system_utils.h"
+#include "util/EGLWindow.h"
+#include "util/shader_utils.h"
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 4;
+
+constexpr size_t kDrawsPerBatch  = 64;
+constexpr size_t kTextureDim     = 128;
+constexpr EGLint kPBufferSize    = 256;
+constexpr size_t kBaselineBatches = 8;
+
+struct MultithreadedContextStressParams final : public RenderTestParams
+{
+    MultithreadedContextStressParams()
+    {
+        iterationsPerStep = kIterationsPerStep;
+
+        majorVersion = 2;
+        minorVersion = 0;
+        windowWidth  = 256;
+        windowHeight = 256;
+    }
+
+    std::string story() const override;
+
+    size_t threadCount = 4;
+};
+
+std::ostream &operator<<(std::ostream &os, const MultithreadedContextStressParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+std::string MultithreadedContextStressParams::story() const
+{
+    std::stringstream strstr;
+    strstr << RenderTestParams::story() << "_" << threadCount << "_threads";
+    return strstr.str();
+}
+
+class MultithreadedContextStressBenchmark
+    : public ANGLERenderTest,
+      public ::testing::WithParamInterface<MultithreadedContextStressParams>
+{
+  public:
+    MultithreadedContextStressBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+    void reportContentionMetrics();
+
+  private:
+    // One batch of work on whichever context is current: a texture upload, a program compile
+    // and a burst of draws.  Returns false on GL failure.
+    bool runWorkBatch(uint64_t batchIndex, size_t threadIndex);
+    void workerThread(size_t threadIndex);
+
+    std::vector<std::thread> mThreads;
+
+    // Batches are dispatched by bumping the generation; workers run one batch per generation
+    // and report completion.
+    std::mutex mMutex;
+    std::condition_variable mCondVar;
+    uint64_t mWorkGeneration = 0;
+    size_t mWorkersDone      = 0;
+    bool mExiting            = false;
+    std::atomic<bool> mWorkerFailed{false};
+
+    // Accumulated across all trials; normalized per batch using mTotalBatches.
+    double mTotalWorkerBusySeconds = 0.0;
+    uint64_t mTotalBatches         = 0;
+    double mBaselineBatchSeconds   = 0.0;
+};
+
+MultithreadedContextStressBenchmark::MultithreadedContextStressBenchmark()
+    : ANGLERenderTest("MultithreadedContextStressPerf", GetParam())
+{}
+
+bool MultithreadedContextStressBenchmark::runWorkBatch(uint64_t batchIndex, size_t threadIndex)
+{
+    // Texture upload.
+    static thread_local std::vector<GLubyte> textureData(kTextureDim * kTextureDim * 4);
+    std::fill(textureData.begin(), textureData.end(),
+              static_cast<GLubyte>((batchIndex + threadIndex) & 0xFF));
+
+    GLuint texture;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kTextureDim, kTextureDim, 0, GL_RGBA,
+                 GL_UNSIGNED_BYTE, textureData.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    // Program compile and link.  The folded constant is unique per thread and batch so shader
+    // caches cannot collapse the work.
+    constexpr char kVS[] = R"(attribute vec2 vPosition;
+varying vec2 v_texCoord;
+void main()
+{
+    gl_Position = vec4(vPosition, 0, 1);
+    v_texCoord = vPosition * 0.5 + 0.5;
+})";
+
+    std::stringstream fsStream;
+    fsStream << "precision mediump float;\n"
+             << "varying vec2 v_texCoord;\n"
+             << "uniform sampler2D tex;\n"
+             << "void main()\n"
+             << "{\n"
+             << "    gl_FragColor = texture2D(tex, v_texCoord) + vec4(0.0, 0.0, 0.0, "
+             << (batchIndex % 256) / 256.0 << " + " << threadIndex << ".0);\n"
+             << "}\n";
+
+    GLuint program = CompileProgram(kVS, fsStream.str().c_str());
+    if (program == 0)
+    {
+        return false;
+    }
+
+    glBindAttribLocation(program, 0, "vPosition");
+    glLinkProgram(program);
+    glUseProgram(program);
+    glUniform1i(glGetUniformLocation(program, "tex"), 0);
+
+    const float triangle[6] = {0.0f, 1.0f, -1.0f, -1.0f, 1.0f, -1.0f};
+    GLuint buffer;
+    glGenBuffers(1, &buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(triangle), triangle, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(0);
+
+    for (size_t draw = 0; draw < kDrawsPerBatch; ++draw)
+    {
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+
+    // Bound the amount of outstanding work per batch.
+    glFinish();
+
+    glDeleteBuffers(1, &buffer);
+    glDeleteProgram(program);
+    glDeleteTextures(1, &texture);
+
+    return glGetError() == GL_NO_ERROR;
+}
+
+void MultithreadedContextStressBenchmark::workerThread(size_t threadIndex)
+{
+    EGLWindow *window  = static_cast<EGLWindow *>(getGLWindow());
+    EGLDisplay display = window->getDisplay();
+    EGLConfig config   = window->getConfig();
+
+    EGLSurface surface = EGL_NO_SURFACE;
+    EGLContext context = EGL_NO_CONTEXT;
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        EGLint pbufferAttributes[] = {
+            EGL_WIDTH, kPBufferSize, EGL_HEIGHT, kPBufferSize, EGL_NONE, EGL_NONE,
+        };
+        surface = eglCreatePbufferSurface(display, config, pbufferAttributes);
+        context = reinterpret_cast<EGLContext>(window->createContextGeneric(
+            reinterpret_cast<GLWindowContext>(window->getContext())));
+
+        if (surface == EGL_NO_SURFACE || context == EGL_NO_CONTEXT ||
+            eglMakeCurrent(display, surface, surface, context) == EGL_FALSE)
+        {
+            mWorkerFailed = true;
+        }
+    }
+
+    uint64_t lastGeneration = 0;
+
+    while (!mWorkerFailed)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCondVar.wait(lock,
+                          [&]() { return mExiting || mWorkGeneration != lastGeneration; });
+            if (mExiting)
+            {
+                break;
+            }
+            lastGeneration = mWorkGeneration;
+        }
+
+        const double start = angle::GetCurrentSystemTime();
+        const bool success = runWorkBatch(lastGeneration, threadIndex);
+        const double busy  = angle::GetCurrentSystemTime() - start;
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (!success)
+            {
+                mWorkerFailed = true;
+            }
+            mTotalWorkerBusySeconds += busy;
+            ++mWorkersDone;
+        }
+        mCondVar.notify_all();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (surface != EGL_NO_SURFACE)
+        {
+            eglDestroySurface(display, surface);
+        }
+        if (context != EGL_NO_CONTEXT)
+        {
+            eglDestroyContext(display, context);
+        }
+        // Wake the dispatcher if it is waiting on a batch this worker will never finish.
+        ++mWorkersDone;
+    }
+    mCondVar.notify_all();
+}
+
+void MultithreadedContextStressBenchmark::initializeBenchmark()
+{
+    if (GetParam().driver != GLESDriverType::AngleEGL)
+    {
+        skipTest("Test requires the ANGLE EGL driver for shared worker contexts.");
+        return;
+    }
+
+    glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
+
+    // Single-threaded cost of one batch, on the main context.  Used to separate contention from
+    // the work itself when reporting .lock_wait_time.  Take the fastest batch as the baseline so
+    // startup noise does not inflate the contention estimate.
+    double fastestBatch = 0.0;
+    for (size_t batch = 0; batch < kBaselineBatches; ++batch)
+    {
+        const double start = angle::GetCurrentSystemTime();
+        if (!runWorkBatch(batch, 0))
+        {
+            failTest("Baseline work batch failed.");
+            return;
+        }
+        const double elapsed = angle::GetCurrentSystemTime() - start;
+        if (batch == 0 || elapsed < fastestBatch)
+        {
+            fastestBatch = elapsed;
+        }
+    }
+    mBaselineBatchSeconds = fastestBatch;
+
+    for (size_t threadIndex = 0; threadIndex < GetParam().threadCount; ++threadIndex)
+    {
+        mThreads.emplace_back(
+            [this, threadIndex]() { workerThread(threadIndex); });
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void MultithreadedContextStressBenchmark::destroyBenchmark()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mExiting = true;
+    }
+    mCondVar.notify_all();
+
+    for (std::thread &thread : mThreads)
+    {
+        thread.join();
+    }
+    mThreads.clear();
+}
+
+void MultithreadedContextStressBenchmark::drawBenchmark()
+{
+    const size_t threadCount = GetParam().threadCount;
+
+    for (unsigned int it = 0; it < kIterationsPerStep; ++it)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mWorkersDone = 0;
+            ++mWorkGeneration;
+        }
+        mCondVar.notify_all();
+
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCondVar.wait(lock,
+                          [&]() { return mWorkersDone >= threadCount || mWorkerFailed; });
+        }
+
+        ++mTotalBatches;
+
+        if (mWorkerFailed)
+        {
+            failTest("Worker thread failed.");
+            return;
+        }
+    }
+}
+
+void MultithreadedContextStressBenchmark::reportContentionMetrics()
+{
+    if (mTotalBatches == 0)
+    {
+        return;
+    }
+
+    const size_t threadCount = GetParam().threadCount;
+
+    // Average thread time per batch, and its excess over the single-threaded cost of the same
+    // work summed across threads.  processClockResult normalizes by the steps of the last trial,
+    // so scale the per-batch averages back up to that trial's batch count.
+    const double busyPerBatch =
+        mTotalWorkerBusySeconds / static_cast<double>(mTotalBatches * threadCount);
+    const double lockWaitPerBatch =
+        std::max(0.0, (busyPerBatch - mBaselineBatchSeconds) * threadCount);
+
+    const double lastTrialBatches =
+        static_cast<double>(getNumStepsPerformed()) * kIterationsPerStep;
+
+    mReporter->RegisterImportantMetric(".worker_busy_time", "us");
+    mReporter->RegisterImportantMetric(".lock_wait_time", "us");
+    processClockResult(".worker_busy_time", busyPerBatch * lastTrialBatches);
+    processClockResult(".lock_wait_time", lockWaitPerBatch * lastTrialBatches);
+}
+
+TEST_P(MultithreadedContextStressBenchmark, Run)
+{
+    run();
+    reportContentionMetrics();
+}
+
+MultithreadedContextStressParams D3D11Params(size_t threadCount)
+{
+    MultithreadedContextStressParams params;
+    params.eglParameters = egl_platform::D3D11();
+    params.threadCount   = threadCount;
+    return params;
+}
+
+MultithreadedContextStressParams MetalParams(size_t threadCount)
+{
+    MultithreadedContextStressParams params;
+    params.eglParameters = egl_platform::METAL();
+    params.threadCount   = threadCount;
+    return params;
+}
+
+MultithreadedContextStressParams OpenGLOrGLESParams(size_t threadCount)
+{
+    MultithreadedContextStressParams params;
+    params.eglParameters = egl_platform::OPENGL_OR_GLES();
+    params.threadCount   = threadCount;
+    return params;
+}
+
+MultithreadedContextStressParams VulkanParams(size_t threadCount)
+{
+    MultithreadedContextStressParams params;
+    params.eglParameters = egl_platform::VULKAN();
+    params.threadCount   = threadCount;
+    return params;
+}
+
+ANGLE_INSTANTIATE_TEST(MultithreadedContextStressBenchmark,
+                       D3D11Params(2),
+                       D3D11Params(4),
+                       D3D11Params(8),
+                       MetalParams(2),
+                       MetalParams(4),
+                       MetalParams(8),
+                       OpenGLOrGLESParams(2),
+                       OpenGLOrGLESParams(4),
+                       OpenGLOrGLESParams(8),
+                       VulkanParams(2),
+                       VulkanParams(4),
+                       VulkanParams(8));
+
+}  // anonymous namespace
@@ -0,0 +1,276 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// StartupLatencyPerfTest:
+//   Measures ANGLE's contribution to application cold start: the timeline from
+//   eglInitialize through the first swap, broken down into display initialization
+//   stages (captured from the built-in histogram markers), first context current,
+//   first pipeline compile and first swap.
+//
+
+#include "ANGLEPerfTest.h"
+#include "common/platform.h"
+#include "common/system_utils.h"
+#include "platform/PlatformMethods.h"
+#include "test_utils/angle_test_configs.h"
+#include "test_utils/angle_test_instantiate.h"
+#include "util/Timer.h"
+#include "util/shader_utils.h"
+
+using namespace testing;
+
+namespace
+{
+// Captures the display initialization stage markers emitted by egl::Display::initialize.
+struct Captures final : private angle::NonCopyable
+{
+    Timer timer;
+    size_t backendInitMS    = 0;
+    size_t capsGenerationMS = 0;
+    size_t displayInitMS    = 0;
+};
+
+double CapturePlatform_currentTime(angle::PlatformMethods *platformMethods)
+{
+    Captures *captures = static_cast<Captures *>(platformMethods->context);
+    return captures->timer.getElapsedWallClockTime();
+}
+
+void CapturePlatform_histogramCustomCounts(angle::PlatformMethods *platformMethods,
+                                           const char *name,
+                                           int sample,
+                                           int /*min*/,
+                                           int /*max*/,
+                                           int /*bucketCount*/)
+{
+    Captures *captures = static_cast<Captures *>(platformMethods->context);
+
+    // These must match the names of the histograms.
+    if (strcmp(name, "GPU.ANGLE.DisplayInitializeBackendMS") == 0)
+    {
+        captures->backendInitMS += static_cast<size_t>(sample);
+    }
+    else if (strcmp(name, "GPU.ANGLE.DisplayCapsGenerationMS") == 0)
+    {
+        captures->capsGenerationMS += static_cast<size_t>(sample);
+    }
+    else if (strcmp(name, "GPU.ANGLE.DisplayInitializeMS") == 0)
+    {
+        captures->displayInitMS += static_cast<size_t>(sample);
+    }
+}
+
+constexpr char kSimpleVS[] = R"(attribute vec4 vPosition;
+void main()
+{
+    gl_Position = vPosition;
+})";
+
+constexpr char kSimpleFS[] = R"(precision mediump float;
+void main()
+{
+    gl_FragColor = vec4(0.0, 1.0, 0.0, 1.0);
+})";
+
+class StartupLatencyPerfTest : public ANGLEPerfTest,
+                               public WithParamInterface<angle::PlatformParameters>
+{
+  public:
+    StartupLatencyPerfTest();
+    ~StartupLatencyPerfTest();
+
+    void step() override;
+    void SetUp() override;
+    void TearDown() override;
+
+  private:
+    OSWindow *mOSWindow;
+    EGLDisplay mDisplay;
+    Captures mCaptures;
+    std::unique_ptr<angle::Library> mEGLLibrary;
+
+    // Wall-clock totals across steps, in milliseconds.
+    double mInitializeMS          = 0;
+    double mFirstContextCurrentMS = 0;
+    double mFirstPipelineMS       = 0;
+    double mFirstSwapMS           = 0;
+};
+
+StartupLatencyPerfTest::StartupLatencyPerfTest()
+    : ANGLEPerfTest("StartupLatency", "", "_run", 1), mOSWindow(nullptr), mDisplay(EGL_NO_DISPLAY)
+{
+    auto platform = GetParam().eglParameters;
+
+    std::vector<EGLint> displayAttributes;
+    displayAttributes.push_back(EGL_PLATFORM_ANGLE_TYPE_ANGLE);
+    displayAttributes.push_back(platform.renderer);
+    displayAttributes.push_back(EGL_PLATFORM_ANGLE_MAX_VERSION_MAJOR_ANGLE);
+    displayAttributes.push_back(platform.majorVersion);
+    displayAttributes.push_back(EGL_PLATFORM_ANGLE_MAX_VERSION_MINOR_ANGLE);
+    displayAttributes.push_back(platform.minorVersion);
+    displayAttributes.push_back(EGL_PLATFORM_ANGLE_DEVICE_TYPE_ANGLE);
+    displayAttributes.push_back(platform.deviceType);
+    displayAttributes.push_back(EGL_NONE);
+
+    mOSWindow = OSWindow::New();
+    mOSWindow->initialize("StartupLatency Test", 64, 64);
+
+    mEGLLibrary.reset(
+        angle::OpenSharedLibrary(ANGLE_EGL_LIBRARY_NAME, angle::SearchType::ModuleDir));
+
+    LoadProc getProc = reinterpret_cast<LoadProc>(mEGLLibrary->getSymbol("eglGetProcAddress"));
+
+    if (!getProc)
+    {
+        abortTest();
+        return;
+    }
+
+    LoadUtilEGL(getProc);
+    LoadUtilGLES(getProc);
+
+    if (!eglGetPlatformDisplayEXT)
+    {
+        abortTest();
+        return;
+    }
+
+    mDisplay = eglGetPlatformDisplayEXT(EGL_PLATFORM_ANGLE_ANGLE,
+                                        reinterpret_cast<void *>(mOSWindow->getNativeDisplay()),
+                                        &displayAttributes[0]);
+}
+
+StartupLatencyPerfTest::~StartupLatencyPerfTest()
+{
+    OSWindow::Delete(&mOSWindow);
+}
+
+void StartupLatencyPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    ASSERT_NE(EGL_NO_DISPLAY, mDisplay);
+
+    angle::PlatformMethods *platformMethods = nullptr;
+    ASSERT_TRUE(ANGLEGetDisplayPlatform(mDisplay, angle::g_PlatformMethodNames,
+                                        angle::g_NumPlatformMethods, &mCaptures, &platformMethods));
+
+    platformMethods->currentTime           = CapturePlatform_currentTime;
+    platformMethods->histogramCustomCounts = CapturePlatform_histogramCustomCounts;
+
+    mReporter->RegisterImportantMetric(".Initialize", "ms");
+    mReporter->RegisterImportantMetric(".BackendInit", "ms");
+    mReporter->RegisterImportantMetric(".CapsGeneration", "ms");
+    mReporter->RegisterImportantMetric(".FirstContextCurrent", "ms");
+    mReporter->RegisterImportantMetric(".FirstPipelineCompile", "ms");
+    mReporter->RegisterImportantMetric(".FirstSwap", "ms");
+}
+
+void StartupLatencyPerfTest::step()
+{
+    // Replays the full cold-start sequence an application goes through, sampling the wall clock
+    // at each milestone. In-process caches (DLLs, the D3D compiler, the Vulkan loader) stay warm
+    // across steps; the display-level work is fully repeated.
+    Timer timer;
+    timer.start();
+
+    EGLint majorVersion, minorVersion;
+    ASSERT_EQ(static_cast<EGLBoolean>(EGL_TRUE),
+              eglInitialize(mDisplay, &majorVersion, &minorVersion));
+
+    double initializeDone = timer.getElapsedWallClockTime();
+
+    EGLint numConfigs;
+    EGLint configAttrs[] = {EGL_RED_SIZE,
+                            8,
+                            EGL_GREEN_SIZE,
+                            8,
+                            EGL_BLUE_SIZE,
+                            8,
+                            EGL_RENDERABLE_TYPE,
+                            GetParam().majorVersion == 3 ? EGL_OPENGL_ES3_BIT : EGL_OPENGL_ES2_BIT,
+                            EGL_SURFACE_TYPE,
+                            EGL_WINDOW_BIT,
+                            EGL_NONE};
+
+    EGLConfig config = nullptr;
+    ASSERT_TRUE(eglChooseConfig(mDisplay, configAttrs, &config, 1, &numConfigs));
+
+    EGLContext context = eglCreateContext(mDisplay, config, EGL_NO_CONTEXT, nullptr);
+    ASSERT_NE(EGL_NO_CONTEXT, context);
+
+    EGLSurface surface =
+        eglCreateWindowSurface(mDisplay, config, mOSWindow->getNativeWindow(), nullptr);
+    ASSERT_NE(EGL_NO_SURFACE, surface);
+    ASSERT_TRUE(eglMakeCurrent(mDisplay, surface, surface, context));
+
+    double contextCurrentDone = timer.getElapsedWallClockTime();
+
+    // First pipeline compile: a minimal program plus the first draw using it, which is what
+    // triggers backend pipeline creation.
+    GLuint program = CompileProgram(kSimpleVS, kSimpleFS);
+    ASSERT_NE(0u, program);
+    glUseProgram(program);
+
+    constexpr GLfloat kVertices[] = {0.0f, 0.5f, -0.5f, -0.5f, 0.5f, -0.5f};
+    GLuint buffer                 = 0;
+    glGenBuffers(1, &buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kVertices), kVertices, GL_STATIC_DRAW);
+
+    GLint positionLocation = glGetAttribLocation(program, "vPosition");
+    ASSERT_NE(-1, positionLocation);
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(positionLocation);
+
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glFinish();
+
+    double firstPipelineDone = timer.getElapsedWallClockTime();
+
+    eglSwapBuffers(mDisplay, surface);
+
+    double firstSwapDone = timer.getElapsedWallClockTime();
+
+    glDeleteBuffers(1, &buffer);
+    glDeleteProgram(program);
+    eglMakeCurrent(mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglDestroySurface(mDisplay, surface);
+    eglDestroyContext(mDisplay, context);
+    ASSERT_EQ(static_cast<EGLBoolean>(EGL_TRUE), eglTerminate(mDisplay));
+
+    mInitializeMS += initializeDone * 1000.0;
+    mFirstContextCurrentMS += (contextCurrentDone - initializeDone) * 1000.0;
+    mFirstPipelineMS += (firstPipelineDone - contextCurrentDone) * 1000.0;
+    mFirstSwapMS += firstSwapDone * 1000.0;
+}
+
+void StartupLatencyPerfTest::TearDown()
+{
+    ANGLEPerfTest::TearDown();
+    mReporter->AddResult(".Initialize", normalizedTime(static_cast<size_t>(mInitializeMS)));
+    mReporter->AddResult(".BackendInit", normalizedTime(mCaptures.backendInitMS));
+    mReporter->AddResult(".CapsGeneration", normalizedTime(mCaptures.capsGenerationMS));
+    mReporter->AddResult(".FirstContextCurrent",
+                         normalizedTime(static_cast<size_t>(mFirstContextCurrentMS)));
+    mReporter->AddResult(".FirstPipelineCompile",
+                         normalizedTime(static_cast<size_t>(mFirstPipelineMS)));
+    mReporter->AddResult(".FirstSwap", normalizedTime(static_cast<size_t>(mFirstSwapMS)));
+
+    ANGLEResetDisplayPlatform(mDisplay);
+}
+
+TEST_P(StartupLatencyPerfTest, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(StartupLatencyPerfTest,
+                       angle::ES2_D3D11(),
+                       angle::ES2_METAL(),
+                       angle::ES2_OPENGLES(),
+                       angle::ES2_VULKAN());
+
+}  // namespace
@@ -19,6 +19,7 @@
 #include "util/capture/traces_export.h"
 #include "util/egl_loader_autogen.h"
 #include "util/png_utils.h"
+#include "util/shader_utils.h"
 #include "util/test_utils.h"
 
 #include <rapidjson/document.h>
@@ -175,7 +176,11 @@ class TracePerfTest : public ANGLERenderTest
         return static_cast<int>(frameCount());
     }
 
-    void TestBody() override { run(); }
+    void TestBody() override
+    {
+        run();
+        reportEstimatedBandwidth();
+    }
 
     bool traceNameIs(const char *name) const
     {
@@ -200,6 +205,10 @@ class TracePerfTest : public ANGLERenderTest
     void saveScreenshot(const std::string &screenshotName) override;
     void swap();
 
+    void initEstimatedBandwidthSampling();
+    void sampleEstimatedBandwidth();
+    void reportEstimatedBandwidth();
+
     std::unique_ptr<const TracePerfParams> mParams;
 
     uint32_t mStartFrame;
@@ -225,6 +234,16 @@ class TracePerfTest : public ANGLERenderTest
     uint32_t mTotalFrameCount                                           = 0;
     bool mScreenshotSaved                                               = false;
     std::unique_ptr<TraceReplayInterface> mTraceReplay;
+
+    // Estimated memory bandwidth accounting (Vulkan backend only).  The per-frame counters are
+    // sampled after every replayed frame and reset at swap, so deltas are accumulated here and
+    // averaged per frame at the end of the run.
+    CounterNameToIndexMap mBandwidthCounterIndexMap;
+    angle::VulkanPerfCounters mLastBandwidthCounters    = {};
+    uint64_t mTotalAttachmentBandwidthBytes             = 0;
+    uint64_t mTotalTextureFetchBandwidthBytes           = 0;
+    uint64_t mTotalBufferTransferBandwidthBytes         = 0;
+    uint32_t mBandwidthSampleFrames                     = 0;
 };
 
 TracePerfTest *gCurrentTracePerfTest = nullptr;
@@ -1489,6 +1508,75 @@ void TracePerfTest::initializeBenchmark()
     {
         getGLWindow()->swap();
     }
+
+    initEstimatedBandwidthSampling();
+}
+
+void TracePerfTest::initEstimatedBandwidthSampling()
+{
+    if (!IsGLExtensionEnabled("GL_AMD_performance_monitor"))
+    {
+        return;
+    }
+
+    CounterNameToIndexMap indexMap = BuildCounterNameToIndexMap();
+    if (indexMap.find("estimatedAttachmentBandwidthBytes") == indexMap.end())
+    {
+        return;
+    }
+
+    mBandwidthCounterIndexMap = std::move(indexMap);
+    mLastBandwidthCounters    = GetPerfCounters(mBandwidthCounterIndexMap);
+}
+
+void TracePerfTest::sampleEstimatedBandwidth()
+{
+    if (mBandwidthCounterIndexMap.empty())
+    {
+        return;
+    }
+
+    const angle::VulkanPerfCounters counters = GetPerfCounters(mBandwidthCounterIndexMap);
+
+    // The counters reset at swap; when the current value is below the last sample, a reset
+    // happened and the current value is already the delta.
+    auto accumulateDelta = [](uint64_t current, uint64_t last) {
+        return current >= last ? current - last : current;
+    };
+
+    mTotalAttachmentBandwidthBytes +=
+        accumulateDelta(counters.estimatedAttachmentBandwidthBytes,
+                        mLastBandwidthCounters.estimatedAttachmentBandwidthBytes);
+    mTotalTextureFetchBandwidthBytes +=
+        accumulateDelta(counters.estimatedTextureFetchBandwidthBytes,
+                        mLastBandwidthCounters.estimatedTextureFetchBandwidthBytes);
+    mTotalBufferTransferBandwidthBytes +=
+        accumulateDelta(counters.estimatedBufferTransferBandwidthBytes,
+                        mLastBandwidthCounters.estimatedBufferTransferBandwidthBytes);
+
+    mLastBandwidthCounters = counters;
+    ++mBandwidthSampleFrames;
+}
+
+void TracePerfTest::reportEstimatedBandwidth()
+{
+    if (mBandwidthSampleFrames == 0)
+    {
+        return;
+    }
+
+    const uint64_t totalBytes = mTotalAttachmentBandwidthBytes + mTotalTextureFetchBandwidthBytes +
+                                mTotalBufferTransferBandwidthBytes;
+
+    // Reported in kilobytes through the harness's standard size metric path.
+    processMemoryResult(".estimated_attachment_bandwidth_per_frame",
+                        mTotalAttachmentBandwidthBytes / mBandwidthSampleFrames / 1000);
+    processMemoryResult(".estimated_texture_fetch_bandwidth_per_frame",
+                        mTotalTextureFetchBandwidthBytes / mBandwidthSampleFrames / 1000);
+    processMemoryResult(".estimated_buffer_transfer_bandwidth_per_frame",
+                        mTotalBufferTransferBandwidthBytes / mBandwidthSampleFrames / 1000);
+    processMemoryResult(".estimated_total_bandwidth_per_frame",
+                        totalBytes / mBandwidthSampleFrames / 1000);
 }
 
 #undef TRACE_TEST_CASE
@@ -1575,6 +1663,7 @@ void TracePerfTest::drawBenchmark()
     stopGpuTimer();
 
     updatePerfCounters();
+    sampleEstimatedBandwidth();
 
     if (mParams->surfaceType == SurfaceType::Offscreen)
     {
@@ -0,0 +1,99 @@
+//
+// Copyright 2022 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// VertexConversionPerfTest:
+//   Performance test for CPU vertex format conversion.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <gmock/gmock.h>
+
+#include "libANGLE/renderer/copyvertex.h"
+
+using namespace testing;
+
+namespace
+{
+constexpr size_t kVertexCount = 100000;
+
+struct Unorm8x4Params
+{
+    using ComponentType                     = GLubyte;
+    static constexpr size_t kComponentCount = 4;
+    static constexpr bool kNormalized       = true;
+};
+
+struct Snorm8x4Params
+{
+    using ComponentType                     = GLbyte;
+    static constexpr size_t kComponentCount = 4;
+    static constexpr bool kNormalized       = true;
+};
+
+struct Unorm16x4Params
+{
+    using ComponentType                     = GLushort;
+    static constexpr size_t kComponentCount = 4;
+    static constexpr bool kNormalized       = true;
+};
+
+template <typename ParamsT>
+class VertexConversionPerfTest : public ANGLEPerfTest
+{
+  public:
+    VertexConversionPerfTest();
+
+    void step() override;
+
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+};
+
+template <typename ParamsT>
+VertexConversionPerfTest<ParamsT>::VertexConversionPerfTest()
+    : ANGLEPerfTest(::testing::UnitTest::GetInstance()->current_test_case()->name(), "", "_run", 1)
+{
+    mInput.resize(kVertexCount * sizeof(typename ParamsT::ComponentType) *
+                  ParamsT::kComponentCount);
+    for (size_t i = 0; i < mInput.size(); i++)
+    {
+        mInput[i] = static_cast<uint8_t>(i);
+    }
+    mOutput.resize(kVertexCount * sizeof(float) * 4);
+}
+
+template <typename ParamsT>
+void VertexConversionPerfTest<ParamsT>::step()
+{
+    rx::CopyToFloatVertexData<typename ParamsT::ComponentType, ParamsT::kComponentCount, 4,
+                              ParamsT::kNormalized, false>(
+        mInput.data(),
+        sizeof(typename ParamsT::ComponentType) * ParamsT::kComponentCount, kVertexCount,
+        mOutput.data());
+}
+
+using TestTypes = Types<Unorm8x4Params, Snorm8x4Params, Unorm16x4Params>;
+
+constexpr char kTestTypeNames[][100] = {"Unorm8x4ToFloat", "Snorm8x4ToFloat", "Unorm16x4ToFloat"};
+
+class VertexConversionTypeNames
+{
+  public:
+    template <typename ParamsT>
+    static std::string GetName(int typeIndex)
+    {
+        return kTestTypeNames[typeIndex];
+    }
+};
+
+TYPED_TEST_SUITE(VertexConversionPerfTest, TestTypes, VertexConversionTypeNames);
+
+TYPED_TEST(VertexConversionPerfTest, Run)
+{
+    this->run();
+}
+
+}  // anonymous namespace
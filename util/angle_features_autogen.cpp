@@ -16,6 +16,7 @@ namespace angle
 namespace
 {
 constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
+    {Feature::AdaptiveBufferMemoryType, "adaptiveBufferMemoryType"},
     {Feature::AddAndTrueToLoopCondition, "addAndTrueToLoopCondition"},
     {Feature::AddMockTextureNoRenderTarget, "addMockTextureNoRenderTarget"},
     {Feature::AdjustSrcDstRegionForBlitFramebuffer, "adjustSrcDstRegionForBlitFramebuffer"},
@@ -43,6 +44,8 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::AlwaysUseStagedBufferUpdates, "alwaysUseStagedBufferUpdates"},
     {Feature::AsyncCommandQueue, "asyncCommandQueue"},
     {Feature::Avoid1BitAlphaTextureFormats, "avoid1BitAlphaTextureFormats"},
+    {Feature::BatchCommandQueueSubmits, "batchCommandQueueSubmits"},
+    {Feature::BatchScissoredClearAttachments, "batchScissoredClearAttachments"},
     {Feature::BindTransformFeedbackBufferBeforeBindBufferRange,
      "bindTransformFeedbackBufferBeforeBindBufferRange"},
     {Feature::BottomLeftOriginPresentRegionRectangles, "bottomLeftOriginPresentRegionRectangles"},
@@ -55,12 +58,16 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::ClampPointSize, "clampPointSize"},
     {Feature::ClearToZeroOrOneBroken, "clearToZeroOrOneBroken"},
     {Feature::ClipSrcRegionForBlitFramebuffer, "clipSrcRegionForBlitFramebuffer"},
+    {Feature::CoalesceSmallBufferUpdates, "coalesceSmallBufferUpdates"},
+    {Feature::CompressStagedImageUpdates, "compressStagedImageUpdates"},
     {Feature::CompressVertexData, "compressVertexData"},
     {Feature::CopyIOSurfaceToNonIOSurfaceForReadOptimization,
      "copyIOSurfaceToNonIOSurfaceForReadOptimization"},
     {Feature::CopyTextureToBufferForReadOptimization, "copyTextureToBufferForReadOptimization"},
     {Feature::DecodeEncodeSRGBForGenerateMipmap, "decodeEncodeSRGBForGenerateMipmap"},
     {Feature::DeferFlushUntilEndRenderPass, "deferFlushUntilEndRenderPass"},
+    {Feature::DeferImmutableTextureAllocation, "deferImmutableTextureAllocation"},
+    {Feature::DeferRenderPassBreakOnFramebufferSwitch, "deferRenderPassBreakOnFramebufferSwitch"},
     {Feature::DepthClamping, "depthClamping"},
     {Feature::DepthStencilBlitExtraCopy, "depthStencilBlitExtraCopy"},
     {Feature::DirectMetalGeneration, "directMetalGeneration"},
@@ -91,6 +98,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::DontRelinkProgramsInParallel, "dontRelinkProgramsInParallel"},
     {Feature::DontUseLoopsToInitializeVariables, "dontUseLoopsToInitializeVariables"},
     {Feature::DoWhileGLSLCausesGPUHang, "doWhileGLSLCausesGPUHang"},
+    {Feature::EagerlySubmitLargeTextureUpdates, "eagerlySubmitLargeTextureUpdates"},
     {Feature::EglColorspaceAttributePassthrough, "eglColorspaceAttributePassthrough"},
     {Feature::EmulateAbsIntFunction, "emulateAbsIntFunction"},
     {Feature::EmulateAdvancedBlendEquations, "emulateAdvancedBlendEquations"},
@@ -188,6 +196,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::PersistentlyMappedBuffers, "persistentlyMappedBuffers"},
     {Feature::PreAddTexelFetchOffsets, "preAddTexelFetchOffsets"},
     {Feature::PrecisionSafeDivision, "precisionSafeDivision"},
+    {Feature::PredictiveRenderPassStoreOps, "predictiveRenderPassStoreOps"},
     {Feature::PreemptivelyStartProvokingVertexCommandBuffer,
      "preemptivelyStartProvokingVertexCommandBuffer"},
     {Feature::PreferAggregateBarrierCalls, "preferAggregateBarrierCalls"},
@@ -231,6 +240,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::ShiftInstancedArrayDataWithOffset, "shiftInstancedArrayDataWithOffset"},
     {Feature::SingleThreadedTextureDecompression, "singleThreadedTextureDecompression"},
     {Feature::SkipVSConstantRegisterZero, "skipVSConstantRegisterZero"},
+    {Feature::StageLargeTextureUpdatesInChunks, "stageLargeTextureUpdatesInChunks"},
     {Feature::SupportsAndroidHardwareBuffer, "supportsAndroidHardwareBuffer"},
     {Feature::SupportsAndroidNativeFenceSync, "supportsAndroidNativeFenceSync"},
     {Feature::SupportsBlendOperationAdvanced, "supportsBlendOperationAdvanced"},
@@ -320,6 +330,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::UnsizedSRGBReadPixelsDoesntTransform, "unsizedSRGBReadPixelsDoesntTransform"},
     {Feature::UploadDataToIosurfacesWithStagingBuffers, "uploadDataToIosurfacesWithStagingBuffers"},
     {Feature::UploadTextureDataInChunks, "uploadTextureDataInChunks"},
+    {Feature::UseBufferRenameChainOnOrphan, "useBufferRenameChainOnOrphan"},
     {Feature::UseInstancedPointSpriteEmulation, "useInstancedPointSpriteEmulation"},
     {Feature::UseMultipleDescriptorsForExternalFormats, "useMultipleDescriptorsForExternalFormats"},
     {Feature::UseNonZeroStencilWriteMaskStaticState, "useNonZeroStencilWriteMaskStaticState"},
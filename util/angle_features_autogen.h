@@ -16,6 +16,7 @@ namespace angle
 {
 enum class Feature
 {
+    AdaptiveBufferMemoryType,
     AddAndTrueToLoopCondition,
     AddMockTextureNoRenderTarget,
     AdjustSrcDstRegionForBlitFramebuffer,
@@ -42,6 +43,8 @@ enum class Feature
     AlwaysUseStagedBufferUpdates,
     AsyncCommandQueue,
     Avoid1BitAlphaTextureFormats,
+    BatchCommandQueueSubmits,
+    BatchScissoredClearAttachments,
     BindTransformFeedbackBufferBeforeBindBufferRange,
     BottomLeftOriginPresentRegionRectangles,
     BresenhamLineRasterization,
@@ -53,11 +56,15 @@ enum class Feature
     ClampPointSize,
     ClearToZeroOrOneBroken,
     ClipSrcRegionForBlitFramebuffer,
+    CoalesceSmallBufferUpdates,
+    CompressStagedImageUpdates,
     CompressVertexData,
     CopyIOSurfaceToNonIOSurfaceForReadOptimization,
     CopyTextureToBufferForReadOptimization,
     DecodeEncodeSRGBForGenerateMipmap,
     DeferFlushUntilEndRenderPass,
+    DeferImmutableTextureAllocation,
+    DeferRenderPassBreakOnFramebufferSwitch,
     DepthClamping,
     DepthStencilBlitExtraCopy,
     DirectMetalGeneration,
@@ -85,6 +92,7 @@ enum class Feature
     DontRelinkProgramsInParallel,
     DontUseLoopsToInitializeVariables,
     DoWhileGLSLCausesGPUHang,
+    EagerlySubmitLargeTextureUpdates,
     EglColorspaceAttributePassthrough,
     EmulateAbsIntFunction,
     EmulateAdvancedBlendEquations,
@@ -178,6 +186,7 @@ enum class Feature
     PersistentlyMappedBuffers,
     PreAddTexelFetchOffsets,
     PrecisionSafeDivision,
+    PredictiveRenderPassStoreOps,
     PreemptivelyStartProvokingVertexCommandBuffer,
     PreferAggregateBarrierCalls,
     PreferCpuForBuffersubdata,
@@ -216,6 +225,7 @@ enum class Feature
     ShiftInstancedArrayDataWithOffset,
     SingleThreadedTextureDecompression,
     SkipVSConstantRegisterZero,
+    StageLargeTextureUpdatesInChunks,
     SupportsAndroidHardwareBuffer,
     SupportsAndroidNativeFenceSync,
     SupportsBlendOperationAdvanced,
@@ -296,6 +306,7 @@ enum class Feature
     UnsizedSRGBReadPixelsDoesntTransform,
     UploadDataToIosurfacesWithStagingBuffers,
     UploadTextureDataInChunks,
+    UseBufferRenameChainOnOrphan,
     UseInstancedPointSpriteEmulation,
     UseMultipleDescriptorsForExternalFormats,
     UseNonZeroStencilWriteMaskStaticState,
@@ -48,6 +48,9 @@ void ReplayTraceFunctionCall(const CallCapture &call, const TraceFunctionMap &cu
             glAttachShader(gShaderProgramMap[captures[0].value.GLuintVal],
                            gShaderProgramMap[captures[1].value.GLuintVal]);
             break;
+        case angle::EntryPoint::GLBeginLockedDrawsANGLE:
+            glBeginLockedDrawsANGLE();
+            break;
         case angle::EntryPoint::GLBeginPerfMonitorAMD:
             glBeginPerfMonitorAMD(captures[0].value.GLuintVal);
             break;
@@ -934,6 +937,9 @@ void ReplayTraceFunctionCall(const CallCapture &call, const TraceFunctionMap &cu
         case angle::EntryPoint::GLEnableiOES:
             glEnableiOES(captures[0].value.GLenumVal, captures[1].value.GLuintVal);
             break;
+        case angle::EntryPoint::GLEndLockedDrawsANGLE:
+            glEndLockedDrawsANGLE();
+            break;
         case angle::EntryPoint::GLEndPerfMonitorAMD:
             glEndPerfMonitorAMD(captures[0].value.GLuintVal);
             break;
@@ -11,7 +11,10 @@
 
 #include "angle_trace_gl.h"
 
+#include <condition_variable>
+#include <mutex>
 #include <string>
+#include <thread>
 
 namespace
 {
@@ -26,8 +29,26 @@ DecompressCallback gDecompressCallback;
 DeleteCallback gDeleteCallback;
 std::string gBinaryDataDir = ".";
 
+// The binary data is loaded on a worker thread so that file I/O and decompression overlap with
+// the GL calls made during setup.  gBinaryDataLoaded counts how many bytes of gBinaryData are
+// valid; GetBinaryData() blocks until the range it needs has been read.
+std::thread gBinaryDataLoadThread;
+std::mutex gBinaryDataMutex;
+std::condition_variable gBinaryDataCondition;
+size_t gBinaryDataLoaded = 0;
+bool gBinaryDataLoadDone = false;
+
+void JoinBinaryDataLoadThread()
+{
+    if (gBinaryDataLoadThread.joinable())
+    {
+        gBinaryDataLoadThread.join();
+    }
+}
+
 void DeleteBinaryData()
 {
+    JoinBinaryDataLoadThread();
     if (gBinaryData)
     {
         if (gDeleteCallback)
@@ -40,6 +61,8 @@ void DeleteBinaryData()
         }
         gBinaryData = nullptr;
     }
+    gBinaryDataLoaded   = 0;
+    gBinaryDataLoadDone = false;
 }
 
 void LoadBinaryData(const char *fileName)
@@ -52,6 +75,7 @@ void LoadBinaryData(const char *fileName)
     if (fp == 0)
     {
         fprintf(stderr, "Error loading binary data file: %s\n", fileName);
+        gBinaryDataLoadDone = true;
         return;
     }
     fseek(fp, 0, SEEK_END);
@@ -64,14 +88,25 @@ void LoadBinaryData(const char *fileName)
             fprintf(stderr, "Filename does not end in .gz");
             exit(1);
         }
-        std::vector<uint8_t> compressedData(size);
-        (void)fread(compressedData.data(), 1, size, fp);
-        gBinaryData = gDecompressCallback(compressedData);
-        if (gBinaryData == nullptr)
-        {
-            // Error already printed by the callback
-            exit(1);
-        }
+        // The decompress callback inflates the file in a single call, so the data only becomes
+        // available as a whole; both the read and the decompression run on the worker thread.
+        gBinaryDataLoadThread = std::thread([fp, size]() {
+            std::vector<uint8_t> compressedData(size);
+            (void)fread(compressedData.data(), 1, size, fp);
+            fclose(fp);
+            uint8_t *binaryData = gDecompressCallback(compressedData);
+            if (binaryData == nullptr)
+            {
+                // Error already printed by the callback
+                exit(1);
+            }
+            {
+                std::lock_guard<std::mutex> lock(gBinaryDataMutex);
+                gBinaryData         = binaryData;
+                gBinaryDataLoadDone = true;
+            }
+            gBinaryDataCondition.notify_all();
+        });
     }
     else
     {
@@ -80,10 +115,37 @@ void LoadBinaryData(const char *fileName)
             fprintf(stderr, "Filename does not end in .angledata");
             exit(1);
         }
-        gBinaryData = new uint8_t[size];
-        (void)fread(gBinaryData, 1, size, fp);
+        // The uncompressed size is known up front, so the buffer can be published immediately and
+        // filled in file order; readers only wait for the range they need.
+        gBinaryData           = new uint8_t[size];
+        gBinaryDataLoadThread = std::thread([fp, size]() {
+            constexpr size_t kReadChunkSize = 1024 * 1024;
+            const size_t totalSize          = static_cast<size_t>(size);
+            size_t loaded                   = 0;
+            while (loaded < totalSize)
+            {
+                size_t chunkSize = totalSize - loaded;
+                if (chunkSize > kReadChunkSize)
+                {
+                    chunkSize = kReadChunkSize;
+                }
+                size_t read = fread(gBinaryData + loaded, 1, chunkSize, fp);
+                loaded += read;
+                {
+                    std::lock_guard<std::mutex> lock(gBinaryDataMutex);
+                    gBinaryDataLoaded   = loaded;
+                    gBinaryDataLoadDone = read == 0 || loaded == totalSize;
+                }
+                gBinaryDataCondition.notify_all();
+                if (read == 0)
+                {
+                    fprintf(stderr, "Error reading binary data file\n");
+                    break;
+                }
+            }
+            fclose(fp);
+        });
     }
-    fclose(fp);
 }
 
 EGLClientBuffer GetClientBuffer(EGLenum target, uintptr_t key)
@@ -206,6 +268,20 @@ void SetBinaryDataDir(const char *dataDir)
     gBinaryDataDir = dataDir;
 }
 
+uint8_t *GetBinaryData(size_t offset, size_t size)
+{
+    std::unique_lock<std::mutex> lock(gBinaryDataMutex);
+    gBinaryDataCondition.wait(
+        lock, [=]() { return gBinaryDataLoadDone || gBinaryDataLoaded >= offset + size; });
+    return gBinaryData + offset;
+}
+
+void WaitForBinaryDataLoad()
+{
+    std::unique_lock<std::mutex> lock(gBinaryDataMutex);
+    gBinaryDataCondition.wait(lock, []() { return gBinaryDataLoadDone; });
+}
+
 template <typename T>
 T *AllocateZeroedValues(size_t count)
 {
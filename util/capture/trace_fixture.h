@@ -83,6 +83,13 @@ void UpdateCurrentProgram(GLuint program);
 
 extern uint8_t *gBinaryData;
 extern uint8_t *gReadBuffer;
+
+// The binary data file is read (and decompressed) on a worker thread so the load overlaps with
+// the GL calls made during setup.  GetBinaryData blocks until [offset, offset + size) is
+// available, then returns a pointer to it; WaitForBinaryDataLoad blocks until the whole file is
+// resident (needed when gBinaryData is referenced directly, as older traces do).
+uint8_t *GetBinaryData(size_t offset, size_t size);
+void WaitForBinaryDataLoad(void);
 extern uint8_t *gClientArrays[];
 
 extern GLuint *gBufferMap;
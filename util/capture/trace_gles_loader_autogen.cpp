@@ -491,6 +491,8 @@ ANGLE_TRACE_LOADER_EXPORT PFNGLDRAWARRAYSINSTANCEDANGLEPROC t_glDrawArraysInstan
 ANGLE_TRACE_LOADER_EXPORT PFNGLDRAWELEMENTSINSTANCEDANGLEPROC t_glDrawElementsInstancedANGLE;
 ANGLE_TRACE_LOADER_EXPORT PFNGLVERTEXATTRIBDIVISORANGLEPROC t_glVertexAttribDivisorANGLE;
 ANGLE_TRACE_LOADER_EXPORT PFNGLLOGICOPANGLEPROC t_glLogicOpANGLE;
+ANGLE_TRACE_LOADER_EXPORT PFNGLBEGINLOCKEDDRAWSANGLEPROC t_glBeginLockedDrawsANGLE;
+ANGLE_TRACE_LOADER_EXPORT PFNGLENDLOCKEDDRAWSANGLEPROC t_glEndLockedDrawsANGLE;
 ANGLE_TRACE_LOADER_EXPORT PFNGLTEXSTORAGEMEMFLAGS2DANGLEPROC t_glTexStorageMemFlags2DANGLE;
 ANGLE_TRACE_LOADER_EXPORT PFNGLTEXSTORAGEMEMFLAGS2DMULTISAMPLEANGLEPROC
     t_glTexStorageMemFlags2DMultisampleANGLE;
@@ -1577,6 +1579,10 @@ void LoadTraceGLES(LoadProc loadProc)
     t_glVertexAttribDivisorANGLE =
         reinterpret_cast<PFNGLVERTEXATTRIBDIVISORANGLEPROC>(loadProc("glVertexAttribDivisorANGLE"));
     t_glLogicOpANGLE = reinterpret_cast<PFNGLLOGICOPANGLEPROC>(loadProc("glLogicOpANGLE"));
+    t_glBeginLockedDrawsANGLE =
+        reinterpret_cast<PFNGLBEGINLOCKEDDRAWSANGLEPROC>(loadProc("glBeginLockedDrawsANGLE"));
+    t_glEndLockedDrawsANGLE =
+        reinterpret_cast<PFNGLENDLOCKEDDRAWSANGLEPROC>(loadProc("glEndLockedDrawsANGLE"));
     t_glTexStorageMemFlags2DANGLE = reinterpret_cast<PFNGLTEXSTORAGEMEMFLAGS2DANGLEPROC>(
         loadProc("glTexStorageMemFlags2DANGLE"));
     t_glTexStorageMemFlags2DMultisampleANGLE =
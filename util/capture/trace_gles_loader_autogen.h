@@ -491,6 +491,8 @@
 #define glDrawElementsInstancedANGLE t_glDrawElementsInstancedANGLE
 #define glVertexAttribDivisorANGLE t_glVertexAttribDivisorANGLE
 #define glLogicOpANGLE t_glLogicOpANGLE
+#define glBeginLockedDrawsANGLE t_glBeginLockedDrawsANGLE
+#define glEndLockedDrawsANGLE t_glEndLockedDrawsANGLE
 #define glTexStorageMemFlags2DANGLE t_glTexStorageMemFlags2DANGLE
 #define glTexStorageMemFlags2DMultisampleANGLE t_glTexStorageMemFlags2DMultisampleANGLE
 #define glTexStorageMemFlags3DANGLE t_glTexStorageMemFlags3DANGLE
@@ -1328,6 +1330,8 @@ ANGLE_TRACE_LOADER_EXPORT extern PFNGLDRAWARRAYSINSTANCEDANGLEPROC t_glDrawArray
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLDRAWELEMENTSINSTANCEDANGLEPROC t_glDrawElementsInstancedANGLE;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLVERTEXATTRIBDIVISORANGLEPROC t_glVertexAttribDivisorANGLE;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLLOGICOPANGLEPROC t_glLogicOpANGLE;
+ANGLE_TRACE_LOADER_EXPORT extern PFNGLBEGINLOCKEDDRAWSANGLEPROC t_glBeginLockedDrawsANGLE;
+ANGLE_TRACE_LOADER_EXPORT extern PFNGLENDLOCKEDDRAWSANGLEPROC t_glEndLockedDrawsANGLE;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLTEXSTORAGEMEMFLAGS2DANGLEPROC t_glTexStorageMemFlags2DANGLE;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLTEXSTORAGEMEMFLAGS2DMULTISAMPLEANGLEPROC
     t_glTexStorageMemFlags2DMultisampleANGLE;
@@ -197,10 +197,12 @@ class Parser : angle::NonCopyable
             size_t numParams = 0;
             skipCast();
             size_t tokenStart = mIndex;
+            int parenDepth    = 0;
             while (peek() != ';')
             {
                 // Skip casts.
-                if (peek() == ',' || (peek() == ')' && mIndex != tokenStart))
+                if (parenDepth == 0 &&
+                    (peek() == ',' || (peek() == ')' && mIndex != tokenStart)))
                 {
                     ASSERT(numParams <= kMaxParameters);
                     Token &token = paramTokens[numParams++];
@@ -214,6 +216,16 @@ class Parser : angle::NonCopyable
                 }
                 else
                 {
+                    // Nested calls such as GetBinaryData(100, 21) form a single token; track
+                    // parentheses so their commas don't split the parameter.
+                    if (peek() == '(')
+                    {
+                        ++parenDepth;
+                    }
+                    else if (peek() == ')' && parenDepth > 0)
+                    {
+                        --parenDepth;
+                    }
                     advance();
                 }
             }
@@ -395,7 +407,7 @@ void PackMemPointer(ParamBuffer &params,
                     const char *offsetString,
                     uint8_t *mem)
 {
-    ASSERT(gBinaryData);
+    ASSERT(mem != nullptr);
     uint32_t offset = atoi(offsetString);
     params.addUnnamedParam(paramType, reinterpret_cast<PointerT>(&mem[offset]));
 }
@@ -427,9 +439,22 @@ void PackConstPointerParameter(ParamBuffer &params, ParamType paramType, const T
     {
         params.addUnnamedParam(paramType, reinterpret_cast<const T *>(0));
     }
+    else if (token[0] == 'G')
+    {
+        ASSERT(BeginsWith(token, "GetBinaryData(") && EndsWith(token, ")"));
+        uint32_t offset        = atoi(&token[strlen("GetBinaryData(")]);
+        const char *sizeString = strchr(token, ',');
+        ASSERT(sizeString != nullptr);
+        uint32_t size = atoi(sizeString + 1);
+        params.addUnnamedParam(paramType,
+                               reinterpret_cast<const T *>(GetBinaryData(offset, size)));
+    }
     else if (token[0] == '&')
     {
         ASSERT(BeginsWith(token, "&gBinaryData[") && EndsWith(token, "]"));
+        // Older traces reference gBinaryData directly; the pointer is baked at parse time, so
+        // the asynchronous load must have finished before it can be used.
+        WaitForBinaryDataLoad();
         PackMemPointer<const T *>(params, paramType, &token[strlen("&gBinaryData[")], gBinaryData);
     }
     else
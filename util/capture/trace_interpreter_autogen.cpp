@@ -777,6 +777,13 @@ CallCapture ParseCallCapture(const Token &nameToken,
             ParseParameters<std::remove_pointer<PFNGLATTACHSHADERPROC>::type>(paramTokens, shaders);
         return CallCapture(EntryPoint::GLAttachShader, std::move(params));
     }
+    if (strcmp(nameToken, "glBeginLockedDrawsANGLE") == 0)
+    {
+        ParamBuffer params =
+            ParseParameters<std::remove_pointer<PFNGLBEGINLOCKEDDRAWSANGLEPROC>::type>(paramTokens,
+                                                                                       shaders);
+        return CallCapture(EntryPoint::GLBeginLockedDrawsANGLE, std::move(params));
+    }
     if (strcmp(nameToken, "glBeginPerfMonitorAMD") == 0)
     {
         ParamBuffer params =
@@ -2054,6 +2061,13 @@ CallCapture ParseCallCapture(const Token &nameToken,
             ParseParameters<std::remove_pointer<PFNGLENABLEIOESPROC>::type>(paramTokens, shaders);
         return CallCapture(EntryPoint::GLEnableiOES, std::move(params));
     }
+    if (strcmp(nameToken, "glEndLockedDrawsANGLE") == 0)
+    {
+        ParamBuffer params =
+            ParseParameters<std::remove_pointer<PFNGLENDLOCKEDDRAWSANGLEPROC>::type>(paramTokens,
+                                                                                     shaders);
+        return CallCapture(EntryPoint::GLEndLockedDrawsANGLE, std::move(params));
+    }
     if (strcmp(nameToken, "glEndPerfMonitorAMD") == 0)
     {
         ParamBuffer params = ParseParameters<std::remove_pointer<PFNGLENDPERFMONITORAMDPROC>::type>(
@@ -488,6 +488,8 @@ ANGLE_UTIL_EXPORT PFNGLDRAWARRAYSINSTANCEDANGLEPROC l_glDrawArraysInstancedANGLE
 ANGLE_UTIL_EXPORT PFNGLDRAWELEMENTSINSTANCEDANGLEPROC l_glDrawElementsInstancedANGLE;
 ANGLE_UTIL_EXPORT PFNGLVERTEXATTRIBDIVISORANGLEPROC l_glVertexAttribDivisorANGLE;
 ANGLE_UTIL_EXPORT PFNGLLOGICOPANGLEPROC l_glLogicOpANGLE;
+ANGLE_UTIL_EXPORT PFNGLBEGINLOCKEDDRAWSANGLEPROC l_glBeginLockedDrawsANGLE;
+ANGLE_UTIL_EXPORT PFNGLENDLOCKEDDRAWSANGLEPROC l_glEndLockedDrawsANGLE;
 ANGLE_UTIL_EXPORT PFNGLTEXSTORAGEMEMFLAGS2DANGLEPROC l_glTexStorageMemFlags2DANGLE;
 ANGLE_UTIL_EXPORT PFNGLTEXSTORAGEMEMFLAGS2DMULTISAMPLEANGLEPROC
     l_glTexStorageMemFlags2DMultisampleANGLE;
@@ -1546,6 +1548,10 @@ void LoadUtilGLES(LoadProc loadProc)
     l_glVertexAttribDivisorANGLE =
         reinterpret_cast<PFNGLVERTEXATTRIBDIVISORANGLEPROC>(loadProc("glVertexAttribDivisorANGLE"));
     l_glLogicOpANGLE = reinterpret_cast<PFNGLLOGICOPANGLEPROC>(loadProc("glLogicOpANGLE"));
+    l_glBeginLockedDrawsANGLE =
+        reinterpret_cast<PFNGLBEGINLOCKEDDRAWSANGLEPROC>(loadProc("glBeginLockedDrawsANGLE"));
+    l_glEndLockedDrawsANGLE =
+        reinterpret_cast<PFNGLENDLOCKEDDRAWSANGLEPROC>(loadProc("glEndLockedDrawsANGLE"));
     l_glTexStorageMemFlags2DANGLE = reinterpret_cast<PFNGLTEXSTORAGEMEMFLAGS2DANGLEPROC>(
         loadProc("glTexStorageMemFlags2DANGLE"));
     l_glTexStorageMemFlags2DMultisampleANGLE =
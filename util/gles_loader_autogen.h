@@ -491,6 +491,8 @@
 #define glDrawElementsInstancedANGLE l_glDrawElementsInstancedANGLE
 #define glVertexAttribDivisorANGLE l_glVertexAttribDivisorANGLE
 #define glLogicOpANGLE l_glLogicOpANGLE
+#define glBeginLockedDrawsANGLE l_glBeginLockedDrawsANGLE
+#define glEndLockedDrawsANGLE l_glEndLockedDrawsANGLE
 #define glTexStorageMemFlags2DANGLE l_glTexStorageMemFlags2DANGLE
 #define glTexStorageMemFlags2DMultisampleANGLE l_glTexStorageMemFlags2DMultisampleANGLE
 #define glTexStorageMemFlags3DANGLE l_glTexStorageMemFlags3DANGLE
@@ -1318,6 +1320,8 @@ ANGLE_UTIL_EXPORT extern PFNGLDRAWARRAYSINSTANCEDANGLEPROC l_glDrawArraysInstanc
 ANGLE_UTIL_EXPORT extern PFNGLDRAWELEMENTSINSTANCEDANGLEPROC l_glDrawElementsInstancedANGLE;
 ANGLE_UTIL_EXPORT extern PFNGLVERTEXATTRIBDIVISORANGLEPROC l_glVertexAttribDivisorANGLE;
 ANGLE_UTIL_EXPORT extern PFNGLLOGICOPANGLEPROC l_glLogicOpANGLE;
+ANGLE_UTIL_EXPORT extern PFNGLBEGINLOCKEDDRAWSANGLEPROC l_glBeginLockedDrawsANGLE;
+ANGLE_UTIL_EXPORT extern PFNGLENDLOCKEDDRAWSANGLEPROC l_glEndLockedDrawsANGLE;
 ANGLE_UTIL_EXPORT extern PFNGLTEXSTORAGEMEMFLAGS2DANGLEPROC l_glTexStorageMemFlags2DANGLE;
 ANGLE_UTIL_EXPORT extern PFNGLTEXSTORAGEMEMFLAGS2DMULTISAMPLEANGLEPROC
     l_glTexStorageMemFlags2DMultisampleANGLE;